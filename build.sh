@@ -7,6 +7,8 @@ BUILD_SCRIPT_DIR="$PROJDIR/build"
 
 CFLAGS="-Wall -Werror -Wno-unknown-pragmas -Wno-gcc-install-dir-libstdcxx -Wno-unknown-warning-option -std=c11 -march=native"
 CFLAGS="$CFLAGS -D_DEFAULT_SOURCE -D_GNU_SOURCE -DCOY_PROFILE -I$SOURCEDIR -I$TESTDIR"
+# The tests are built a second time with the optional allocator statistics and tracing compiled in.
+INSTRUMENTED_CFLAGS="-DMAG_STATS=1 -DMAG_TRACE=1 -DMAG_TRACE_SHARED_HOOK=1 -DMAG_TRACE_HOOK_STORAGE"
 LDLIBS="-ldl -lm -lpthread"
 
 CC=cc
@@ -26,6 +28,7 @@ then
     echo "clean compiled programs"
     echo
     rm -f test
+    rm -f test_instrumented
     rm -r -f *.dSYM
     rm -r -f *.dat  # Used for checking random distributions.
     rm -f $BUILD_SCRIPT_DIR/build
@@ -39,10 +42,11 @@ else
     ./build
     cd ..
     $CC $CFLAGS $TESTDIR/test.c -o test $LDLIBS
+    $CC $CFLAGS $INSTRUMENTED_CFLAGS $TESTDIR/test.c -o test_instrumented $LDLIBS
 fi
 
 if [ "$#" -gt 0 -a "$1" = "test" ]
 then
-    ./test
+    ./test && ./test_instrumented
 fi
 
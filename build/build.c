@@ -60,7 +60,7 @@ build_magpie()
     size oi = 0; //output index
     char finished_lib[ECO_KiB(350)] = {0};
 
-    char main_buffer[ECO_KiB(100)] = {0};
+    char main_buffer[ECO_KiB(250)] = {0};
     size mb_size = 0;
     char win32_buffer[ECO_KiB(100)] = {0};
     size w32_size = 0;
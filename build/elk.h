@@ -0,0 +1,8751 @@
+#ifndef _ELK_HEADER_
+#define _ELK_HEADER_
+
+/* TODO: Parse more date formats (Specifically: 1 Jan, 2025    */
+
+/* Change some warning settings for MSVC. This code is well tested and we use some "tricks" for performance, and I don't
+ * want to be bothered in other projects by those warnings.
+ */
+
+#pragma warning(push)
+#pragma warning(disable:4146) /* Applying '-' unary operator to unsigned. Someimes we bit fiddle! */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef __EMSCRIPTEN__
+#include <immintrin.h>
+#endif
+
+#ifndef __AVX2__
+#define __AVX2__ 0
+#endif
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+#define ELK_AVX_512 1
+#else
+#define ELK_AVX_512 0
+#endif
+
+#if defined(_WIN64) || defined(_WIN32)
+#define __builtin_clz(a) __lzcnt(a)
+#define __builtin_clzll(a) __lzcnt64(a)
+#define __builtin_popcount(a) __popcnt(a)
+#define __builtin_popcountll(a) __popcnt64(a)
+#define __builtin_ctz(a) _tzcnt_u32(a)
+#define __builtin_ctzll(a) _BItScanForward64(a)
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                 Define simpler types
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _TYPE_ALIASES_
+#define _TYPE_ALIASES_
+
+typedef int32_t     b32;
+#ifndef false
+   #define false 0
+   #define true  1
+#endif
+	
+#if !defined(_WINDOWS_) && !defined(_INC_WINDOWS)
+typedef char       byte;
+#endif
+
+typedef ptrdiff_t  size;
+typedef size_t    usize;
+
+typedef uintptr_t  uptr;
+typedef intptr_t   iptr;
+
+typedef float       f32;
+typedef double      f64;
+
+typedef uint8_t      u8;
+typedef uint16_t    u16;
+typedef uint32_t    u32;
+typedef uint64_t    u64;
+typedef int8_t       i8;
+typedef int16_t     i16;
+typedef int32_t     i32;
+typedef int64_t     i64;
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ * Declare parts of the standard C library I use. These should almost always be implemented as compiler intrinsics anyway.
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+int memcmp(const void *s1, const void *s2, size_t n);
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *                                                      Memory Sizes
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+#define ECO_KiB(a) ((a) * INT64_C(1024))
+#define ECO_MiB(a) (ECO_KiB(a) * INT64_C(1024))
+#define ECO_GiB(a) (ECO_MiB(a) * INT64_C(1024))
+#define ECO_TiB(a) (ECO_GiB(a) * INT64_C(1024))
+
+#define ECO_KB(a) ((a) * INT64_C(1000))
+#define ECO_MB(a) (ECO_KB(a) * INT64_C(1000))
+#define ECO_GB(a) (ECO_MB(a) * INT64_C(1000))
+#define ECO_TB(a) (ECO_GB(a) * INT64_C(1000))
+
+#define ECO_ARRAY_SIZE(A) (sizeof(A) / sizeof(A[0])) /* Only works on arrays and not pointers! */
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                 Mathematical Constants
+ *-------------------------------------------------------------------------------------------------------------------------*/
+#ifndef M_PI /* Assume if they have PI, they have them all.*/
+static f64 const ELK_PI       = 3.14159265358979323846;
+static f64 const ELK_PI_2     = 1.57079632679489661923;
+static f64 const ELK_PI_4     = 0.785398163397448309616;
+static f64 const ELK_1_PI     = 0.318309886183790671538;
+static f64 const ELK_2_PI     = 0.636619772367581343076;
+static f64 const ELK_2_SQRTPI = 1.12837916709551257390;
+
+static f64 const ELK_E        = 2.7182818284590452356;
+
+static f64 const ELK_LN2      = 0.693147180559945309417;
+
+static f64 const ELK_SQRT2    = 1.41421356237309504880;
+static f64 const ELK_1_SQRT2  = 0.707106781186547524401;
+#else
+static f64 const ELK_PI       = M_PI;
+static f64 const ELK_PI_2     = M_PI_2;
+static f64 const ELK_PI_4     = M_PI_4;
+static f64 const ELK_1_PI     = M_1_PI;
+static f64 const ELK_2_PI     = M_2_PI;
+static f64 const ELK_2_SQRTPI = M_2_SQRTPI;
+
+static f64 const ELK_E        = M_E;
+
+static f64 const ELK_LN2      = M_LN2;
+
+static f64 const ELK_SQRT2    = M_SQRT2;
+static f64 const ELK_1_SQRT2  = M_SQRT1_2;
+#endif
+
+static f64 const ELK_GOLDEN   = 1.61803398874989484820;
+static f64 const ELK_1_GOLDEN = 0.61803398874989484820;
+
+static f64 const ELK_SQRT2PI  = 2.50662827463100024161;
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ * Declare parts of the standard C library I use. These should almost always be implemented as compiler intrinsics anyway.
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+void *memcpy(void *dst, void const *src, size_t num_bytes);
+void *memset(void *buffer, int val, size_t num_bytes);
+int memcmp(const void *s1, const void *s2, size_t num_bytes);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                       Error Handling
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+/* Crash immediately, useful with a debugger! */
+#ifndef HARD_EXIT
+  #define HARD_EXIT (*(int volatile*)0) 
+#endif
+
+#ifndef PanicIf
+  #define PanicIf(assertion) StopIf((assertion), HARD_EXIT)
+#endif
+
+#ifndef Panic
+  #define Panic() HARD_EXIT
+#endif
+
+#ifndef StopIf
+  #define StopIf(assertion, error_action) if (assertion) { error_action; }
+#endif
+
+#ifndef Assert
+  #ifndef NDEBUG
+    #define Assert(assertion) if(!(assertion)) { HARD_EXIT; }
+  #else
+    #define Assert(assertion) (void)(assertion)
+  #endif
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                  Date and Time Handling
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * The standard C library interface for time isn't threadsafe in general, so I'm reimplementing parts of it here.
+ *
+ * To do that is pretty difficult! So I'm specializing based on my needs.
+ *  - I work entirely in UTC, so I won't bother with timezones. Timezones require interfacing with the OS, and so it belongs
+ *    in a platform library anyway.
+ *  - I mainly handle meteorological data, including observations and forecasts. I'm not concerned with time and dates
+ *    before the 19th century or after the 21st century. Covering more is fine, but not necessary.
+ *  - Given the restrictions above, I'm going to make the code as simple and fast as I can.
+ *  - The end result covers the time ranging from midnight January 1st, 1 ADE to the last second of the day on 
+ *    December 31st, 32767.
+ */
+
+static i64 const SECONDS_PER_MINUTE = INT64_C(60);
+static i64 const MINUTES_PER_HOUR = INT64_C(60);
+static i64 const HOURS_PER_DAY = INT64_C(24);
+static i64 const DAYS_PER_YEAR = INT64_C(365);
+static i64 const SECONDS_PER_HOUR = INT64_C(60) * INT64_C(60);
+static i64 const SECONDS_PER_DAY = INT64_C(60) * INT64_C(60) * INT64_C(24);
+static i64 const SECONDS_PER_YEAR = INT64_C(60) * INT64_C(60) * INT64_C(24) * INT64_C(365);
+
+typedef i64 ElkTime;
+typedef i64 ElkTimeDiff;
+
+typedef struct 
+{
+    i16 year;        /* 1-32,767 */
+    i8 month;        /* 1-12     */
+    i8 day;          /* 1-31     */
+    i8 hour;         /* 0-23     */
+    i8 minute;       /* 0-59     */
+    i8 second;       /* 0-59     */
+    i16 day_of_year; /* 1-366    */
+} ElkStructTime;
+
+typedef enum
+{
+    ElkSecond = 1,
+    ElkMinute = 60,
+    ElkHour = 60 * 60,
+    ElkDay = 60 * 60 * 24,
+    ElkWeek = 60 * 60 * 24 * 7,
+} ElkTimeUnit;
+
+static ElkTime const elk_unix_epoch_timestamp = INT64_C(62135596800);
+
+static inline i64 elk_time_to_unix_epoch(ElkTime time);
+static inline ElkTime elk_time_from_unix_timestamp(i64 unixtime);
+static inline b32 elk_is_leap_year(int year);
+static inline ElkTime elk_make_time(ElkStructTime tm); /* Ignores the day_of_year member. */
+static inline ElkTime elk_time_truncate_to_hour(ElkTime time);
+static inline ElkTime elk_time_truncate_to_specific_hour(ElkTime time, int hour);
+static inline ElkTime elk_time_add(ElkTime time, ElkTimeDiff change_in_time);
+static inline ElkTimeDiff elk_time_difference(ElkTime a, ElkTime b); /* a - b */
+
+static inline ElkTime elk_time_from_ymd_and_hms(int year, int month, int day, int hour, int minutes, int seconds);
+static inline ElkTime elk_time_from_yd_and_hms(int year, int day_of_year, int hour, int minutes, int seconds);
+static inline ElkStructTime elk_make_struct_time(ElkTime time);
+
+/* If ElkTime has both date and time, why bother with a separate type for JUST dates? Because I can make it smaller in size
+ * so it takes up less space. The valid dates range from 0001-01-01 to 32767-12-31 (YYYY-MM-DD).
+ */
+typedef i32 ElkDate;
+typedef i32 ElkDateDiff;
+
+typedef struct
+{
+    i16 year;
+    i8 month;
+    i8 day;
+} ElkStructDate;
+
+static inline ElkDate elk_date_from_ymd(int year, int month, int day);
+static inline ElkDate elk_date_from_unix_timestamp(i64 unixtime);
+static inline ElkDate elk_date_from_struct_date(ElkStructDate sdate);
+static inline i64 elk_date_to_unix_epoch(ElkDate date);
+static inline ElkStructDate elk_make_struct_date(ElkDate date);
+static inline ElkDateDiff elk_date_difference(ElkDate a, ElkDate b); /* a - b, the difference in days. */
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                      String Slice
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * An altenrate implementation of strings with "fat pointers" that are pointers to the start and the length of the string.
+ * When strings are copied or moved, every effort is made to keep them null terminated so they MIGHT play nice with the
+ * standard C string implementation, but you can't count on this. If there isn't enough room when a string is copied for the
+ * null terminator, it won't be there.
+ *
+ * WARNING: Slices are only meant to alias into larger strings and so have no built in memory management functions. It's
+ * unadvised to have an ElkStr that is the only thing that contains a pointer from malloc(). A seperate pointer to any 
+ * buffer should be kept around for memory management purposes.
+ *
+ * WARNING: Comparisions are NOT utf-8 safe. They look 1 byte at a time, so if you're using fancy utf-8 stuff, no promises.
+ */
+
+typedef struct 
+{
+    char *start;  /* points at first character in the string                                  */
+    size len;     /* the length of the string (not including a null terminator if it's there) */
+} ElkStr;
+
+ElkStr const elk_str_null = { 0 };
+
+typedef struct
+{
+    ElkStr left;
+    ElkStr right;
+} ElkStrSplitPair;
+
+static inline ElkStr elk_str_from_cstring(char *src);
+static inline ElkStr elk_str_copy(size dst_len, char *restrict dest, ElkStr src);
+static inline ElkStr elk_str_strip(ElkStr input);                          /* Strips leading and trailing whitespace       */
+static inline ElkStr elk_str_substr(ElkStr str, size start, size len);     /* Create a substring from a longer string      */
+static inline i32 elk_str_cmp(ElkStr left, ElkStr right);                  /* 0 if equal, -1 if left is first, 1 otherwise */
+static inline b32 elk_str_eq(ElkStr const left, ElkStr const right);       /* Faster than elk_str_cmp, checks length first */
+static inline b32 elk_str_null_terminated(ElkStr const str);               /* Can cause a segfault, good to use in Asserts */
+static inline ElkStrSplitPair elk_str_split_on_char(ElkStr str, char const split_char);
+static inline ElkStrSplitPair elk_str_split_on_substr(ElkStr str, ElkStr split_str);      /* Removes split_str             */
+static inline ElkStrSplitPair elk_str_split_on_substr_nt(ElkStr str, char *nt_string);
+static inline ElkStrSplitPair elk_str_split_at_substr(ElkStr str, ElkStr split_str);      /* split_str starts right member */
+static inline ElkStrSplitPair elk_str_split_at_substr_nt(ElkStr str, char *nt_string);
+static inline i64 elk_str_line_count(ElkStr str);
+
+
+/* Parsing values from strings.
+ *
+ * In all cases the input string is assumed to be stripped of leading and trailing whitespace. Any suffixes that are non-
+ * numeric will cause a parse error for the number parsing cases. Robust parsers check for more error cases, and fast 
+ * parsers make more assumptions. 
+ *
+ * For f64, the fast parser assumes no NaN or Infinity values or any errors of any kind. The robust parser checks for NaN,
+ * +/- Infinity, and overflow.
+ *
+ * Parsing datetimes assumes a format YYYY-MM-DD HH:MM:SS, YYYY-MM-DDTHH:MM:SS, YYYYDDDHHMMSS. The latter format is the 
+ * year, day of the year, hours, minutes, and seconds.
+ *
+ * In general, these functions return true on success and false on failure. On falure the out argument is left untouched.
+ */
+static inline b32 elk_str_parse_i64(ElkStr str, i64 *result);
+static inline b32 elk_str_robust_parse_f64(ElkStr str, f64 *out);
+static inline b32 elk_str_fast_parse_f64(ElkStr str, f64 *out);
+static inline b32 elk_str_parse_datetime(ElkStr str, ElkTime *out);
+static inline b32 elk_str_parse_usa_date(ElkStr str, ElkDate *out); /* MM-DD-YYYY format */
+static inline b32 elk_str_parse_ymd_date(ElkStr str, ElkDate *out); /* YYYY-MM-DD format */
+static inline b32 elk_str_parse_date(ElkStr str, ElkDate *out);     /* detect format */
+
+#define elk_str_parse_elk_time(str, result) elk_str_parse_i64((str), (result))
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                      Hashes
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * Non-cryptographically secure hash functions.
+ *
+ * If you're passing user supplied data to this, it's possible that a nefarious actor could send data specifically designed
+ * to jam up one of these functions. So don't use them to write a web browser or server, or banking software. They should be
+ * good and fast though for data munging.
+ *
+ * To build a custom "fnv1a" hash function just follow the example of the implementation of elk_fnv1a_hash below. For the 
+ * first member of a struct, call the accumulate function with the fnv_offset_bias, then call the accumulate function for
+ * each remaining member of the struct. This will leave the padding out of the calculation, which is good because we cannot 
+ * guarantee what is in the padding.
+ */
+typedef b32 (*ElkEqFunction)(void const *left, void const *right);
+
+typedef u64 (*ElkHashFunction)(size const size_bytes, void const *value);
+typedef u64 (*ElkSimpleHash)(void const *object); /* Already knows the size of the object to be hashed! */
+
+static inline u64 elk_fnv1a_hash(size const n, void const *value);
+static inline u64 elk_fnv1a_hash_accumulate(size const size_bytes, void const *value, u64 const hash_so_far);
+static inline u64 elk_fnv1a_hash_str(ElkStr str);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *                                         
+ *                                          Parsing Commonly Encountered File Types
+ *
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                       CSV Parsing
+ *---------------------------------------------------------------------------------------------------------------------------
+ * Parsing a string may modify it, especially if it uses quotes a lot. The only function in this API that modifies the 
+ * the string in place is the elk_csv_unquote_str() function. So, this function cannot be used if you're parsing a string 
+ * stored in read only memory, which is probably the case if parsing a memory mapped file. None of the other functions in 
+ * this API modify the string they are parsing. However, you (the user) may modify strings (memory) returned by the 
+ * elk_csv_*_next_token() functions. So be very careful using this API if you're parsing read only memory.
+ *
+ * The CSV format I handle is pretty simple. Anything goes inside quoted strings. Quotes in a quoted string have to be 
+ * escaped by another quote, e.g. "Frank ""The Tank"" Johnson". Comment lines are allowed, but they must be full lines, no
+ * end of line comments, and they must start with a '#' character.
+ *
+ * Comments in CSV are rare, and can really slow down the parser. But I do find comments useful when I use CSV for some
+ * smaller configuration files. So I've implemented two CSV parser functions. The first is the "full" version, and it can
+ * handle comments anywhere. The second is the "fast" parser, which can handle comment lines at the beginning of the file, 
+ * but once it gets past there it is more agressively optimized by assuming no more comment lines. This allows for a much
+ * faster parser for large CSV files without interspersed comments.
+ */
+typedef struct
+{
+    size row;     /* The number of CSV rows parsed so far, this includes blank lines. */
+    size col;     /* CSV column, that is, how many commas have we passed              */
+    ElkStr value; /* The value not including the comma or any new line character      */
+} ElkCsvToken;
+
+typedef struct
+{
+    ElkStr remaining;       /* The portion of the string remaining to be parsed. Useful for diagnosing parse errors. */
+    size row;               /* Only counts parseable rows, comment lines don't count.                                */
+    size col;               /* CSV column, that is, how many commas have we passed on this line.                     */
+    b32 error;              /* Have we encountered an error while parsing?                                           */
+#if ELK_AVX_512
+    i32 byte_pos;
+
+    __m512i buf;
+    u64 buf_comma_bits;
+    u64 buf_newline_bits;
+    u64 buf_any_delimiter_bits;
+    u64 carry;
+#elif __AVX2__
+    i32 byte_pos;
+
+    __m256i buf;
+    u32 buf_comma_bits;
+    u32 buf_newline_bits;
+    u32 buf_any_delimiter_bits;
+    u32 carry;
+#endif
+} ElkCsvParser;
+
+static inline ElkCsvParser elk_csv_create_parser(ElkStr input);
+static inline ElkCsvToken elk_csv_full_next_token(ElkCsvParser *parser);
+static inline ElkCsvToken elk_csv_fast_next_token(ElkCsvParser *parser);
+static inline b32 elk_csv_finished(ElkCsvParser *parser);
+static inline ElkStr elk_csv_unquote_str(ElkStr str, ElkStr const buffer);
+static inline ElkStr elk_csv_simple_unquote_str(ElkStr str);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *                                         
+ *                                                    Random Numbers
+ *
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                 Uniform Random Deviates
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+/* This random number generator is a counter based generator.
+ *
+ * Different versions can be used in different threads with different keys, or if each thread increments the counter by the
+ * number of threads they can use the same key.
+ *
+ * Philox and Threefish were some of the original design ideas for the counter based PRNGs, but this one is based on an
+ * algorithm by Bernard Widynski. The paper for the algorithm can be found at https://arxiv.org/abs/2004.06278.
+ *
+ * Since the output only depends on the key and the counter, jumping ahead is just an addition to the counter. For parallel
+ * work, split the problem into tasks (NOT threads) and give each task its own substream with elk_random_state_split() using
+ * the task index as the stream_id. The substream only depends on the parent state and the stream_id, so the results are bit
+ * identical no matter how many threads the tasks get spread over. Substreams get a key from the same table of vetted keys
+ * as elk_random_state_create() and a hashed starting counter, so overlapping sequences are vanishingly unlikely.
+ */
+typedef struct
+{
+    u64 key;
+    u64 counter;
+} ElkRandomState;
+
+static inline ElkRandomState elk_random_state_create(u64 seed);
+static inline ElkRandomState elk_random_state_split(ElkRandomState const *state, u64 stream_id); /* Parent is unchanged. */
+static inline void elk_random_state_skip(ElkRandomState *state, u64 n);                /* Same as n calls to uniform_u64.  */
+static inline u64 elk_random_state_uniform_u64(ElkRandomState *state);                 /* Includes the whole range of u64. */
+static inline f64 elk_random_state_uniform_f64(ElkRandomState *state);                 /* Random deviate in 0.-1.          */
+
+/* Unbiased random integers in [0, bound) using Daniel Lemire's nearly divisionless method, https://arxiv.org/abs/1805.10941.
+ * The slow path with the division is only taken with a probability of about bound / 2^64.
+ *
+ * The paired version gets two values from a single call to the generator, one in [0, bound0) and one in [0, bound1), which
+ * is useful for shuffling. It requires bound0 * bound1 to fit in a u64. See https://arxiv.org/abs/2408.06213.
+ */
+static inline u64 elk_random_state_uniform_bounded_u64(ElkRandomState *state, u64 bound);
+static inline void elk_random_state_uniform_bounded_pair_u64(ElkRandomState *state, u64 bound0, u64 bound1, u64 *out0, u64 *out1);
+
+/* The vectorized bounded integer generators are limited to 32 bit bounds since there is no 64 x 64 -> 128 bit multiply
+ * instruction for vectors. Each result is in the low half of a 64 bit lane.
+ */
+#if __AVX2__
+
+typedef struct
+{
+    __m256i key;
+    __m256i counter;
+} ElkAVX2RandomState;
+
+static inline ElkAVX2RandomState elk_avx2_random_state_create(u64 seed);
+static inline ElkAVX2RandomState elk_avx2_random_state_split(ElkRandomState const *state, u64 stream_id); /* 4 substreams */
+static inline void elk_avx2_random_state_skip(ElkAVX2RandomState *state, u64 n);       /* Skips n values in EVERY lane.    */
+static inline __m256i elk_avx2_random_state_uniform_u64(ElkAVX2RandomState *state);    /* Includes the whole range of u64. */
+static inline __m256d elk_avx2_random_state_uniform_f64(ElkAVX2RandomState *state);    /* Random deviate in 0.-1.          */
+static inline __m256i elk_avx2_random_state_uniform_bounded_u32(ElkAVX2RandomState *state, u32 bound); /* u64 lanes  */
+
+#endif
+
+#if ELK_AVX_512
+
+typedef struct
+{
+    __m512i key;
+    __m512i counter;
+} ElkAVX512RandomState;
+
+static inline ElkAVX512RandomState elk_avx512_random_state_create(u64 seed);
+static inline ElkAVX512RandomState elk_avx512_random_state_split(ElkRandomState const *state, u64 stream_id); /* 8 subs */
+static inline void elk_avx512_random_state_skip(ElkAVX512RandomState *state, u64 n);   /* Skips n values in EVERY lane.    */
+static inline __m512i elk_avx512_random_state_uniform_u64(ElkAVX512RandomState *state); /* Includes the whole range of u64.*/
+static inline __m512d elk_avx512_random_state_uniform_f64(ElkAVX512RandomState *state); /* Random deviate in 0.-1.         */
+static inline __m512i elk_avx512_random_state_uniform_bounded_u32(ElkAVX512RandomState *state, u32 bound); /* u64 lanes */
+
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *                                         
+ *                                                         Math
+ *
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+/* Kahan summation for more accurately adding floating point numbers.
+ *
+ * This accumulator is best just zero initialized. The err member accumulates the rounding error of all the additions, so the
+ * compensated total is sum - err, use elk_kahan_accumulator_result() to get it. Accumulators from different threads or 
+ * different chunks of an array can be combined with elk_kahan_accumulator_merge().
+ *
+ * The array functions use the widest vector accumulator available with several independent accumulators in flight to hide
+ * the latency of the additions, then reduce them all at the end. The strided version follows the pak_radix_sort convention,
+ * 'offset' is the offset in bytes into a structure where the f64 is and 'stride' is the size of the structure.
+ */
+typedef struct
+{
+    f64 sum;
+    f64 err;
+} ElkKahanAccumulator;
+
+static inline ElkKahanAccumulator elk_kahan_accumulator_add(ElkKahanAccumulator acc, f64 value);
+static inline ElkKahanAccumulator elk_kahan_accumulator_merge(ElkKahanAccumulator a, ElkKahanAccumulator b);
+static inline f64 elk_kahan_accumulator_result(ElkKahanAccumulator acc);
+
+static inline f64 elk_kahan_sum_f64(size n, f64 const *data);
+static inline f64 elk_kahan_sum_strided_f64(size n, void const *data, size offset, size stride);
+
+#if __AVX2__
+
+typedef struct
+{
+    __m256d sum;
+    __m256d err;
+} ElkAVX2KahanAccumulator;
+
+static inline ElkAVX2KahanAccumulator elk_avx2_kahan_accumulator_add(ElkAVX2KahanAccumulator acc, __m256d value);
+static inline ElkKahanAccumulator elk_avx2_kahan_accumulator_reduce(ElkAVX2KahanAccumulator acc);
+
+#endif
+
+#if ELK_AVX_512
+
+typedef struct
+{
+    __m512d sum;
+    __m512d err;
+} ElkAVX512KahanAccumulator;
+
+static inline ElkAVX512KahanAccumulator elk_avx512_kahan_accumulator_add(ElkAVX512KahanAccumulator acc, __m512d value);
+static inline ElkKahanAccumulator elk_avx512_kahan_accumulator_reduce(ElkAVX512KahanAccumulator acc);
+
+#endif
+
+/* Single pass statistics.
+ *
+ * Count, NaN count, min, max, mean, and variance from one pass over the data. NaN values are counted in nan_count and
+ * otherwise ignored, so count is the number of non-NaN values and min/max are only meaningful when count > 0. The mean and
+ * m2 (sum of squared deviations from the mean) are updated with Welford's algorithm for single values, and the array 
+ * functions process the data in small blocks that are merged in with the parallel update of Chan et al., one set of
+ * statistics per vector lane. 
+ *
+ * This is best just zero initialized. Statistics computed on different threads or different chunks of an array are combined
+ * with elk_statistics_merge(). The strided versions follow the pak_radix_sort convention, 'offset' is the offset in bytes 
+ * into a structure where the value is and 'stride' is the size of the structure.
+ */
+typedef struct
+{
+    size count;     /* Number of non-NaN values.                      */
+    size nan_count; /* Number of NaN values skipped.                  */
+    f64 min;
+    f64 max;
+    f64 mean;
+    f64 m2;         /* Sum of squared deviations from the mean.       */
+} ElkStatistics;
+
+static inline ElkStatistics elk_statistics_add(ElkStatistics stats, f64 value);
+static inline ElkStatistics elk_statistics_merge(ElkStatistics a, ElkStatistics b);
+static inline f64 elk_statistics_variance(ElkStatistics stats); /* Unbiased sample variance, 0.0 if count < 2.         */
+
+static inline ElkStatistics elk_statistics_f64(size n, f64 const *data);
+static inline ElkStatistics elk_statistics_f32(size n, f32 const *data);
+static inline ElkStatistics elk_statistics_strided_f64(size n, void const *data, size offset, size stride);
+static inline ElkStatistics elk_statistics_strided_f32(size n, void const *data, size offset, size stride);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *
+ *
+ *                                          Implementation of `inline` functions.
+ *
+ *
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+static inline i64
+elk_num_leap_years_since_epoch(i64 year)
+{
+    Assert(year >= 1);
+
+    year -= 1;
+    return year / 4 - year / 100 + year / 400;
+}
+
+static inline i64
+elk_days_since_epoch(int year)
+{
+    /* Days in the years up to now. */
+    i64 const num_leap_years_since_epoch = elk_num_leap_years_since_epoch(year);
+    i64 ts = (year - 1) * DAYS_PER_YEAR + num_leap_years_since_epoch;
+
+    return ts;
+}
+
+static inline i64
+elk_time_to_unix_epoch(ElkTime time)
+{
+    return time - elk_unix_epoch_timestamp;
+}
+
+static inline ElkTime
+elk_time_from_unix_timestamp(i64 unixtime)
+{
+    return unixtime + elk_unix_epoch_timestamp;
+}
+
+static inline b32
+elk_is_leap_year(int year)
+{
+    if (year % 4 != 0) { return false; }
+    if (year % 100 == 0 && year % 400 != 0) { return false; }
+    return true;
+}
+
+static inline ElkTime
+elk_make_time(ElkStructTime tm)
+{
+    return elk_time_from_ymd_and_hms(tm.year, tm.month, tm.day, tm.hour, tm.minute, tm.second);
+}
+
+static inline ElkTime
+elk_time_truncate_to_hour(ElkTime time)
+{
+    ElkTime adjusted = time;
+
+    i64 const seconds = adjusted % SECONDS_PER_MINUTE;
+    adjusted -= seconds;
+
+    i64 const minutes = (adjusted / SECONDS_PER_MINUTE) % MINUTES_PER_HOUR;
+    adjusted -= minutes * SECONDS_PER_MINUTE;
+
+    Assert(adjusted >= 0);
+
+    return adjusted;
+}
+
+static inline ElkTime
+elk_time_truncate_to_specific_hour(ElkTime time, int hour)
+{
+    Assert(hour >= 0 && hour <= 23 && time >= 0);
+
+    ElkTime adjusted = time;
+
+    i64 const seconds = adjusted % SECONDS_PER_MINUTE;
+    adjusted -= seconds;
+
+    i64 const minutes = (adjusted / SECONDS_PER_MINUTE) % MINUTES_PER_HOUR;
+    adjusted -= minutes * SECONDS_PER_MINUTE;
+
+    i64 actual_hour = (adjusted / SECONDS_PER_HOUR) % HOURS_PER_DAY;
+    if (actual_hour < hour) { actual_hour += 24; }
+
+    i64 change_hours = actual_hour - hour;
+    Assert(change_hours >= 0);
+    adjusted -= change_hours * SECONDS_PER_HOUR;
+
+    Assert(adjusted >= 0);
+
+    return adjusted;
+}
+
+static inline ElkTime
+elk_time_add(ElkTime time, ElkTimeDiff change_in_time)
+{
+    ElkTime result = time + change_in_time;
+    Assert(result >= 0);
+    return result;
+}
+
+static inline ElkTimeDiff
+elk_time_difference(ElkTime a, ElkTime b)
+{
+    return a - b;
+}
+
+/* Days in a year up to beginning of month */
+static i64 const sum_days_to_month[2][13] = {
+    {0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334},
+    {0, 0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335},
+};
+
+
+static inline ElkTime
+elk_time_from_ymd_and_hms(int year, int month, int day, int hour, int minutes, int seconds)
+{
+    Assert(year >= 1 && year <= INT16_MAX);
+    Assert(day >= 1 && day <= 31);
+    Assert(month >= 1 && month <= 12);
+    Assert(hour >= 0 && hour <= 23);
+    Assert(minutes >= 0 && minutes <= 59);
+    Assert(seconds >= 0 && seconds <= 59);
+
+    /* Seconds in the years up to now. */
+    i64 const num_leap_years_since_epoch = elk_num_leap_years_since_epoch(year);
+    ElkTime ts = (year - 1) * SECONDS_PER_YEAR + num_leap_years_since_epoch * SECONDS_PER_DAY;
+
+    /* Seconds in the months up to the start of this month */
+    i64 const days_until_start_of_month =
+        elk_is_leap_year(year) ? sum_days_to_month[1][month] : sum_days_to_month[0][month];
+    ts += days_until_start_of_month * SECONDS_PER_DAY;
+
+    /* Seconds in the days of the month up to this one. */
+    ts += (day - 1) * SECONDS_PER_DAY;
+
+    /* Seconds in the hours, minutes, & seconds so far this day. */
+    ts += hour * SECONDS_PER_HOUR;
+    ts += minutes * SECONDS_PER_MINUTE;
+    ts += seconds;
+
+    Assert(ts >= 0);
+
+    return ts;
+}
+
+static inline ElkTime 
+elk_time_from_yd_and_hms(int year, int day_of_year, int hour, int minutes, int seconds)
+{
+    Assert(year >= 1 && year <= INT16_MAX);
+    Assert(day_of_year >= 1 && day_of_year <= 366);
+    Assert(hour >= 0 && hour <= 23);
+    Assert(minutes >= 0 && minutes <= 59);
+    Assert(seconds >= 0 && seconds <= 59);
+
+    /* Seconds in the years up to now. */
+    i64 const num_leap_years_since_epoch = elk_num_leap_years_since_epoch(year);
+    ElkTime ts = (year - 1) * SECONDS_PER_YEAR + num_leap_years_since_epoch * SECONDS_PER_DAY;
+
+    /* Seconds in the days up to now. */
+    ts += (day_of_year - 1) * SECONDS_PER_DAY;
+
+    /* Seconds in the hours, minutes, & seconds so far this day. */
+    ts += hour * SECONDS_PER_HOUR;
+    ts += minutes * SECONDS_PER_MINUTE;
+    ts += seconds;
+
+    Assert(ts >= 0);
+
+    return ts;
+}
+
+static inline ElkStructTime 
+elk_make_struct_time(ElkTime time)
+{
+    Assert(time >= 0);
+
+    /* Get the seconds part and then trim it off and convert to minutes */
+    int const second = (int const)(time % SECONDS_PER_MINUTE);
+    time = (time - second) / SECONDS_PER_MINUTE;
+    Assert(time >= 0 && second >= 0 && second <= 59);
+
+    /* Get the minutes part, trim it off and convert to hours. */
+    int const minute = (int const)(time % MINUTES_PER_HOUR);
+    time = (time - minute) / MINUTES_PER_HOUR;
+    Assert(time >= 0 && minute >= 0 && minute <= 59);
+
+    /* Get the hours part, trim it off and convert to days. */
+    int const hour = (int const)(time % HOURS_PER_DAY);
+    time = (time - hour) / HOURS_PER_DAY;
+    Assert(time >= 0 && hour >= 0 && hour <= 23);
+
+    /* Rename variable for clarity */
+    i64 const days_since_epoch = time;
+
+    /* Calculate the year */
+    int year = (int)(days_since_epoch / (DAYS_PER_YEAR) + 1); /* High estimate, but good starting point. */
+    i64 test_time = elk_days_since_epoch(year);
+    while (test_time > days_since_epoch) 
+    {
+        int step = (int)((test_time - days_since_epoch) / (DAYS_PER_YEAR + 1));
+        step = step == 0 ? 1 : step;
+        year -= step;
+        test_time = elk_days_since_epoch(year);
+    }
+    Assert(test_time <= elk_days_since_epoch(year));
+    time -= elk_days_since_epoch(year); /* Now it's days since start of the year. */
+    Assert(time >= 0);
+    i16 day_of_year = (i16)(time + 1);
+
+    /* Calculate the month */
+    int month = 0;
+    int leap_year_idx = elk_is_leap_year(year) ? 1 : 0;
+    for (month = 1; month <= 11; month++)
+    {
+        if (sum_days_to_month[leap_year_idx][month + 1] > time) { break; }
+    }
+    Assert(time >= 0 && month > 0 && month <= 12);
+    time -= sum_days_to_month[leap_year_idx][month]; /* Now in days since start of month */
+
+    /* Calculate the day */
+    int const day = (int const)(time + 1);
+    Assert(day > 0 && day <= 31);
+
+    return (ElkStructTime)
+    {
+        .year = year,
+        .month = month, 
+        .day = day, 
+        .hour = hour, 
+        .minute = minute, 
+        .second = second,
+        .day_of_year = day_of_year,
+    };
+}
+
+static inline ElkStructDate 
+elk_make_struct_date(ElkDate date)
+{
+    Assert(date >= 0);
+
+    i64 const days_since_epoch = date;
+
+    /* Calculate the year */
+    int year = (int)(days_since_epoch / (DAYS_PER_YEAR) + 1); /* High estimate, but good starting point. */
+    i64 test_time = elk_days_since_epoch(year);
+    while (test_time > days_since_epoch) 
+    {
+        int step = (int)((test_time - days_since_epoch) / (DAYS_PER_YEAR + 1));
+        step = step == 0 ? 1 : step;
+        year -= step;
+        test_time = elk_days_since_epoch(year);
+    }
+    Assert(test_time <= elk_days_since_epoch(year));
+    date -= (i32)elk_days_since_epoch(year); /* Now it's days since start of the year. */
+    Assert(date >= 0);
+    Assert(year >= 1 && year <= INT16_MAX);
+
+    /* Calculate the month */
+    int month = 0;
+    int leap_year_idx = elk_is_leap_year(year) ? 1 : 0;
+    for (month = 1; month <= 11; month++)
+    {
+        if (sum_days_to_month[leap_year_idx][month + 1] > date) { break; }
+    }
+    Assert(date >= 0 && month >= 1 && month <= 12);
+    date -= (i32)sum_days_to_month[leap_year_idx][month]; /* Now in days since start of month */
+
+    /* Calculate the day */
+    int const day = (int const)(date + 1);
+    Assert(day >= 1 && day <= 31);
+
+    return (ElkStructDate) { .year = year, .month = month, .day = day, };
+}
+
+static inline ElkDate
+elk_date_from_struct_date(ElkStructDate sdate)
+{
+    return elk_date_from_ymd(sdate.year, sdate.month, sdate.day);
+}
+
+static inline ElkDateDiff 
+elk_date_difference(ElkDate a, ElkDate b)
+{
+    return a - b;
+}
+
+static inline ElkDate 
+elk_date_from_ymd(int year, int month, int day)
+{
+    Assert(year >= 1 && year <= INT16_MAX);
+    Assert(day >= 1 && day <= 31);
+    Assert(month >= 1 && month <= 12);
+
+    /* Days in the years up to now. */
+    i32 const num_leap_years_since_epoch = (i32)elk_num_leap_years_since_epoch(year);
+    ElkDate dt = (year - 1) * 365 + num_leap_years_since_epoch;
+
+    /* Days in the months up to the start of this month */
+    i64 const days_until_start_of_month =
+        elk_is_leap_year(year) ? sum_days_to_month[1][month] : sum_days_to_month[0][month];
+    dt += (i32)days_until_start_of_month;
+
+    /* Days in the days of the month up to this one. */
+    dt += (day - 1);
+
+    Assert(dt >= 0 && dt <= 11967899);
+
+    return dt;
+}
+
+static inline i64 
+elk_date_to_unix_epoch(ElkDate date)
+{
+    return date * SECONDS_PER_DAY - elk_unix_epoch_timestamp;
+}
+
+static inline ElkDate 
+elk_date_from_unix_timestamp(i64 unixtime)
+{
+    return (ElkDate)((unixtime + elk_unix_epoch_timestamp) / SECONDS_PER_DAY);
+}
+
+static inline ElkStr
+elk_str_from_cstring(char *src)
+{
+    size len;
+    for (len = 0; *(src + len) != '\0'; ++len) ; /* intentionally left blank. */
+    return (ElkStr){.start = src, .len = len};
+}
+
+static inline ElkStr
+elk_str_copy(size dst_len, char *restrict dest, ElkStr src)
+{
+    size const copy_len = src.len < dst_len ? src.len : dst_len;
+    memcpy(dest, src.start, copy_len);
+
+    /* Add a terminating zero IFF we can. */
+    if(copy_len < dst_len) { dest[copy_len] = '\0'; }
+
+    return (ElkStr){.start = dest, .len = copy_len};
+}
+
+static inline ElkStr
+elk_str_strip(ElkStr input)
+{
+    char *const start = input.start;
+    size start_offset = 0;
+    for (start_offset = 0; start_offset < input.len && start[start_offset] <= 0x20; ++start_offset);
+
+    size end_offset = 0;
+    for (end_offset = input.len - 1; end_offset > start_offset && start[end_offset] <= 0x20; --end_offset);
+
+    return (ElkStr) { .start = &start[start_offset], .len = end_offset - start_offset + 1 };
+}
+
+static inline 
+ElkStr elk_str_substr(ElkStr str, size start, size len)
+{
+    Assert(start >= 0 && len > 0 && start + len <= str.len);
+    char *ptr_start = (char *)((size)str.start + start);
+    return (ElkStr) {.start = ptr_start, .len = len};
+}
+
+static inline i32
+elk_str_cmp(ElkStr left, ElkStr right)
+{
+    if(left.start == right.start && left.len == right.len) { return 0; }
+
+    size len = left.len > right.len ? right.len : left.len;
+
+    for (size i = 0; i < len; ++i) 
+    {
+        if (left.start[i] < right.start[i]) { return -1; }
+        else if (left.start[i] > right.start[i]) { return 1; }
+    }
+
+    if (left.len == right.len) { return 0; }
+    if (left.len > right.len) { return 1; }
+    return -1;
+}
+
+static inline b32
+elk_str_eq(ElkStr const left, ElkStr const right)
+{
+    if (left.len != right.len) { return false; }
+    size len = left.len > right.len ? right.len : left.len;
+    return !memcmp(left.start, right.start, len);
+}
+
+static inline b32 
+elk_str_null_terminated(ElkStr const str)
+{
+    return str.start[str.len] == '\0';
+}
+
+static inline ElkStrSplitPair
+elk_str_split_on_char(ElkStr str, char const split_char)
+{
+    // TODO: SIMD-ize this function.
+    ElkStr left = { .start = str.start, .len = 0 };
+    ElkStr right = { .start = NULL, .len = 0 };
+
+    for(char const *c = str.start; left.len < str.len && *c != split_char; ++c, ++left.len);
+
+    if(left.len + 1 < str.len)
+    {
+        right.start = &str.start[left.len + 1];
+        right.len = str.len - left.len - 1;
+    }
+
+    return (ElkStrSplitPair) { .left = left, .right = right};
+}
+
+static inline ElkStrSplitPair 
+elk_str_split_at_substr(ElkStr str, ElkStr split_str)
+{
+    /* No data to search or nothing to split on. */
+    if(!str.start || str.len ==0 || !split_str.start || split_str.len == 0)
+    {
+        return (ElkStrSplitPair) { .left = str, .right = elk_str_null };
+    }
+
+    /* Delegate to elk_str_split_on_char if split_str is only a single character. */
+    if(split_str.len == 1) 
+    {
+        ElkStrSplitPair pair = elk_str_split_on_char(str, split_str.start[0]);
+
+        /* Correct the match so the right string includes the split_str */
+        if( pair.right.start)
+        {
+            pair.right.start = pair.right.start - 1;
+            pair.right.len = pair.right.len + 1;
+        }
+
+        return pair;
+    }
+
+    /* Check to make sure we have AVX2 */
+#if ELK_AVX_512
+    {
+        __m512i const first = _mm512_set1_epi8(split_str.start[0]);
+        char const second = (split_str.len >= 2) ? split_str.start[1] : 0;  /* dummy if len = 1 */
+
+        char const * const end = str.start + str.len - split_str.len + 1;
+        char * ptr = str.start;
+
+        /* Aligned prolog */
+        while((uptr)ptr % 64 != 0 && ptr < end)
+        {
+            if (
+                    *ptr == split_str.start[0]
+                    && (split_str.len < 2 || *(ptr + 1) == second)
+                    && memcmp(ptr, split_str.start, split_str.len) == 0
+               ) 
+            {
+                ElkStr left = { .start = str.start, .len = (size)(ptr - str.start) };
+                ElkStr right = { .start = ptr, .len = (size)(str.len - left.len) };
+                return (ElkStrSplitPair) { .left = left, .right = right };
+            }
+
+            ++ptr;
+        }
+
+        /* Main AVX512 loop */
+        while(ptr + 64 <= end)
+        {
+            __m512i const chunk = _mm512_load_si512((const __m512i*)ptr);
+            u64 mask = (u64)_mm512_cmpeq_epi8_mask(chunk, first);
+
+            while(mask != 0)
+            {
+                int bit = __builtin_ctzll(mask);
+                mask &= mask - 1;               // clear lowest set bit
+
+                char *candidate = ptr + bit;
+
+                /* Early rejection with second byte (huge win if second byte uncommon) */
+                if (split_str.len >= 2 && candidate[1] != second) { continue; }
+
+                if (memcmp(candidate, split_str.start, split_str.len) == 0)
+                {
+                    ElkStr left = { .start = str.start, .len = (size)(candidate - str.start) };
+                    ElkStr right = { .start = candidate, .len = (size)(str.len - left.len) };
+                    return (ElkStrSplitPair) { .left = left, .right = right };
+                }
+            }
+            ptr += 64;
+        }
+
+        /* Scalar tail (usually tiny) */
+        while (ptr < end)
+        {
+            if (
+                    *ptr == split_str.start[0]
+                    && (split_str.len < 2 || *(ptr + 1) == second)
+                    && memcmp(ptr, split_str.start, split_str.len) == 0
+               ) 
+            {
+                ElkStr left = { .start = str.start, .len = (size)(ptr - str.start) };
+                ElkStr right = { .start = ptr, .len = (size)(str.len - left.len) };
+                return (ElkStrSplitPair) { .left = left, .right = right };
+            }
+
+            ++ptr;
+        }
+    }
+    /* Check to make sure we have AVX2 */
+#elif __AVX2__
+    {
+        __m256i const first = _mm256_set1_epi8(split_str.start[0]);
+        char const second = (split_str.len >= 2) ? split_str.start[1] : 0;  /* dummy if len = 1 */
+
+        char const * const end = str.start + str.len - split_str.len + 1;
+        char * ptr = str.start;
+
+        /* Aligned prolog */
+        while((uptr)ptr % 32 != 0 && ptr < end)
+        {
+            if (
+                    *ptr == split_str.start[0]
+                    && (split_str.len < 2 || *(ptr + 1) == second)
+                    && memcmp(ptr, split_str.start, split_str.len) == 0
+               ) 
+            {
+                ElkStr left = { .start = str.start, .len = (size)(ptr - str.start) };
+                ElkStr right = { .start = ptr, .len = (size)(str.len - left.len) };
+                return (ElkStrSplitPair) { .left = left, .right = right };
+            }
+
+            ++ptr;
+        }
+
+        /* Main AVX2 loop */
+        while(ptr + 32 <= end)
+        {
+            __m256i const chunk = _mm256_load_si256((const __m256i*)ptr);
+            __m256i const eq    = _mm256_cmpeq_epi8(chunk, first);
+            int mask            = _mm256_movemask_epi8(eq);
+
+            while(mask != 0)
+            {
+                int bit = __builtin_ctz(mask);
+                mask &= mask - 1;               // clear lowest set bit
+
+                char *candidate = ptr + bit;
+
+                /* Early rejection with second byte (huge win if second byte uncommon) */
+                if (split_str.len >= 2 && candidate[1] != second) { continue; }
+
+                if (memcmp(candidate, split_str.start, split_str.len) == 0)
+                {
+                    ElkStr left = { .start = str.start, .len = (size)(candidate - str.start) };
+                    ElkStr right = { .start = candidate, .len = (size)(str.len - left.len) };
+                    return (ElkStrSplitPair) { .left = left, .right = right };
+                }
+            }
+            ptr += 32;
+        }
+
+        /* Scalar tail (usually tiny) */
+        while (ptr < end)
+        {
+            if (
+                    *ptr == split_str.start[0]
+                    && (split_str.len < 2 || *(ptr + 1) == second)
+                    && memcmp(ptr, split_str.start, split_str.len) == 0
+               ) 
+            {
+                ElkStr left = { .start = str.start, .len = (size)(ptr - str.start) };
+                ElkStr right = { .start = ptr, .len = (size)(str.len - left.len) };
+                return (ElkStrSplitPair) { .left = left, .right = right };
+            }
+
+            ++ptr;
+        }
+    }
+#else
+    {
+        char const first = split_str.start[0];
+        char const *last_possible = str.start + str.len - split_str.len;
+
+        for(char *p = str.start; p <=last_possible; ++p)
+        {
+            /* Quick single-byte filter, big win when first char rarely matches */
+            if (*p == first && memcmp(p, split_str.start, split_str.len) == 0)
+            {
+                ElkStr left = { .start = str.start, .len = (size)(p - str.start) };
+                ElkStr right = { .start = p, .len = (size)(str.len - left.len) };
+                return (ElkStrSplitPair) { .left = left, .right = right };
+            }
+        }
+    }
+#endif
+
+    return (ElkStrSplitPair) { .left = str, .right = elk_str_null };
+}
+
+static inline 
+ElkStrSplitPair elk_str_split_at_substr_nt(ElkStr str, char *nt_string)
+{
+    ElkStr sub = elk_str_from_cstring(nt_string);
+    return elk_str_split_at_substr(str, sub);
+}
+
+
+
+static inline ElkStrSplitPair 
+elk_str_split_on_substr(ElkStr str, ElkStr split_str)
+{
+    /* No data to search or nothing to split on. */
+    if(!str.start || str.len ==0 || !split_str.start || split_str.len == 0)
+    {
+        return (ElkStrSplitPair) { .left = str, .right = elk_str_null };
+    }
+
+    /* Delegate to elk_str_split_on_char if split_str is only a single character. */
+    if(split_str.len == 1) { return elk_str_split_on_char(str, split_str.start[0]); }
+
+    /* Check to make sure we have AVX512 */
+#if ELK_AVX_512
+    {
+        __m512i const first = _mm512_set1_epi8(split_str.start[0]);
+        char const second = (split_str.len >= 2) ? split_str.start[1] : 0;  /* dummy if len = 1 */
+
+        char const * const end = str.start + str.len - split_str.len + 1;
+        char * ptr = str.start;
+
+        /* Aligned prolog */
+        while((uptr)ptr % 64 != 0 && ptr < end)
+        {
+            if (
+                    *ptr == split_str.start[0]
+                    && (split_str.len < 2 || *(ptr + 1) == second)
+                    && memcmp(ptr, split_str.start, split_str.len) == 0
+               ) 
+            {
+                ElkStr left = { .start = str.start, .len = (size)(ptr - str.start) };
+                ElkStr right = { .start = ptr + split_str.len, .len = (size)(str.len - split_str.len - left.len) };
+                return (ElkStrSplitPair) { .left = left, .right = right };
+            }
+
+            ++ptr;
+        }
+
+        /* Main AVX512 loop */
+        while(ptr + 64 <= end)
+        {
+            __m512i const chunk = _mm512_load_si512((const __m512i*)ptr);
+            u64 mask = (u64)_mm512_cmpeq_epi8_mask(chunk, first);
+
+            while(mask != 0)
+            {
+                int bit = __builtin_ctzll(mask);
+                mask &= mask - 1;               // clear lowest set bit
+
+                char *candidate = ptr + bit;
+
+                /* Early rejection with second byte (huge win if second byte uncommon) */
+                if (split_str.len >= 2 && candidate[1] != second) { continue; }
+
+                if (memcmp(candidate, split_str.start, split_str.len) == 0)
+                {
+                    ElkStr left = { .start = str.start, .len = (size)(candidate - str.start) };
+                    ElkStr right = { .start = candidate + split_str.len, .len = (size)(str.len - split_str.len - left.len) };
+                    return (ElkStrSplitPair) { .left = left, .right = right };
+                }
+            }
+            ptr += 64;
+        }
+
+        /* Scalar tail (usually tiny) */
+        while (ptr < end)
+        {
+            if (
+                    *ptr == split_str.start[0]
+                    && (split_str.len < 2 || *(ptr + 1) == second)
+                    && memcmp(ptr, split_str.start, split_str.len) == 0
+               ) 
+            {
+                ElkStr left = { .start = str.start, .len = (size)(ptr - str.start) };
+                ElkStr right = { .start = ptr + split_str.len, .len = (size)(str.len - split_str.len - left.len) };
+                return (ElkStrSplitPair) { .left = left, .right = right };
+            }
+
+            ++ptr;
+        }
+    }
+    /* Check to make sure we have AVX2 */
+#elif __AVX2__
+    {
+        __m256i const first = _mm256_set1_epi8(split_str.start[0]);
+        char const second = (split_str.len >= 2) ? split_str.start[1] : 0;  /* dummy if len = 1 */
+
+        char const * const end = str.start + str.len - split_str.len + 1;
+        char * ptr = str.start;
+
+        /* Aligned prolog */
+        while((uptr)ptr % 32 != 0 && ptr < end)
+        {
+            if (
+                    *ptr == split_str.start[0]
+                    && (split_str.len < 2 || *(ptr + 1) == second)
+                    && memcmp(ptr, split_str.start, split_str.len) == 0
+               ) 
+            {
+                ElkStr left = { .start = str.start, .len = (size)(ptr - str.start) };
+                ElkStr right = { .start = ptr + split_str.len, .len = (size)(str.len - split_str.len - left.len) };
+                return (ElkStrSplitPair) { .left = left, .right = right };
+            }
+
+            ++ptr;
+        }
+
+        /* Main AVX2 loop */
+        while(ptr + 32 <= end)
+        {
+            __m256i const chunk = _mm256_load_si256((const __m256i*)ptr);
+            __m256i const eq    = _mm256_cmpeq_epi8(chunk, first);
+            int mask            = _mm256_movemask_epi8(eq);
+
+            while(mask != 0)
+            {
+                int bit = __builtin_ctz(mask);
+                mask &= mask - 1;               // clear lowest set bit
+
+                char *candidate = ptr + bit;
+
+                /* Early rejection with second byte (huge win if second byte uncommon) */
+                if (split_str.len >= 2 && candidate[1] != second) { continue; }
+
+                if (memcmp(candidate, split_str.start, split_str.len) == 0)
+                {
+                    ElkStr left = { .start = str.start, .len = (size)(candidate - str.start) };
+                    ElkStr right = { .start = candidate + split_str.len, .len = (size)(str.len - split_str.len - left.len) };
+                    return (ElkStrSplitPair) { .left = left, .right = right };
+                }
+            }
+            ptr += 32;
+        }
+
+        /* Scalar tail (usually tiny) */
+        while (ptr < end)
+        {
+            if (
+                    *ptr == split_str.start[0]
+                    && (split_str.len < 2 || *(ptr + 1) == second)
+                    && memcmp(ptr, split_str.start, split_str.len) == 0
+               ) 
+            {
+                ElkStr left = { .start = str.start, .len = (size)(ptr - str.start) };
+                ElkStr right = { .start = ptr + split_str.len, .len = (size)(str.len - split_str.len - left.len) };
+                return (ElkStrSplitPair) { .left = left, .right = right };
+            }
+
+            ++ptr;
+        }
+    }
+#else
+    {
+        char const first = split_str.start[0];
+        char const *last_possible = str.start + str.len - split_str.len;
+
+        for(char *p = str.start; p <=last_possible; ++p)
+        {
+            /* Quick single-byte filter, big win when first char rarely matches */
+            if (*p == first && memcmp(p, split_str.start, split_str.len) == 0)
+            {
+                ElkStr left = { .start = str.start, .len = (size)(p - str.start) };
+                ElkStr right = { .start = p + split_str.len, .len = (size)(str.len - split_str.len - left.len) };
+                return (ElkStrSplitPair) { .left = left, .right = right };
+            }
+        }
+    }
+#endif
+
+    return (ElkStrSplitPair) { .left = str, .right = elk_str_null };
+}
+
+static inline 
+ElkStrSplitPair elk_str_split_on_substr_nt(ElkStr str, char *nt_string)
+{
+    ElkStr sub = elk_str_from_cstring(nt_string);
+    return elk_str_split_on_substr(str, sub);
+}
+
+static inline i64 
+elk_str_line_count(ElkStr str)
+{
+    StopIf(!str.start || str.len <= 0, return 0);
+
+    i64 count = 1;
+
+    /* Check to make sure we have AVX512. */
+#if ELK_AVX_512
+    {
+        __m512i newline = _mm512_set1_epi8('\n');
+
+        char const *s = str.start;
+        uptr addr = (uptr)s;
+        usize offset = addr & 63;
+        usize num_to_align = 64 - offset;
+        usize length = str.len;
+        
+        /* Prefix */
+        if(num_to_align > 0 && num_to_align <= length)
+        {
+            for(usize c = 0; c < num_to_align; ++c)
+            {
+                if(s[c] == '\n') { count += 1; }
+            }
+            length -= num_to_align;
+            s += num_to_align;
+        }
+
+        /* Main body */
+        while (length >= 64) {
+            __m512i chunk = _mm512_load_si512((__m512i const *)s);
+
+            /* Compare for newlines and extract bitmask (bit i set if byte i == '\n') */
+            u64 nl_mask = (u64)_mm512_cmpeq_epi8_mask(chunk, newline);
+
+            count += __builtin_popcountll(nl_mask);
+
+            s += 64;
+            length -= 64;
+        }
+
+        /* Suffix */
+        if(length > 0)
+        {
+            for(usize c = 0; c < length; ++c)
+            {
+                if(s[c] == '\n') { count += 1; }
+            }
+        }
+    }
+    /* Check to make sure we have AVX2. */
+#elif __AVX2__
+    {
+        __m256i newline = _mm256_set1_epi8('\n');
+
+        char const *s = str.start;
+        uptr addr = (uptr)s;
+        usize offset = addr & 31;
+        usize num_to_align = 32 - offset;
+        usize length = str.len;
+        
+        /* Prefix */
+        if(num_to_align > 0 && num_to_align <= length)
+        {
+            for(usize c = 0; c < num_to_align; ++c)
+            {
+                if(s[c] == '\n') { count += 1; }
+            }
+            length -= num_to_align;
+            s += num_to_align;
+        }
+
+        /* Main body */
+        while (length >= 32) {
+            __m256i chunk = _mm256_load_si256((__m256i const *)s);
+
+            /* Compare for newlines and extract bitmask (bit i set if byte i == '\n') */
+            __m256i eq_nl = _mm256_cmpeq_epi8(chunk, newline);
+            u32 nl_mask = (u32)_mm256_movemask_epi8(eq_nl);
+
+            count += __builtin_popcount(nl_mask);
+
+            s += 32;
+            length -= 32;
+        }
+
+        /* Suffix */
+        if(length > 0)
+        {
+            for(usize c = 0; c < length; ++c)
+            {
+                if(s[c] == '\n') { count += 1; }
+            }
+        }
+    }
+#else
+    {
+        for(size c = 0; c < str.len; ++c)
+        {
+            if(str.start[c] == '\n') { count += 1; }
+        }
+    }
+#endif
+
+    return count;
+}
+
+_Static_assert(sizeof(size) == sizeof(uptr), "intptr_t and uintptr_t aren't the same size?!");
+
+static inline b32 
+elk_str_helper_parse_i64(ElkStr str, i64 *result)
+{
+    u64 parsed = 0;
+    b32 neg_flag = false;
+    b32 in_digits = false;
+    char const *c = str.start;
+    while (true)
+    {
+        /* We've reached the end of the string. */
+        if (!*c || c >= (str.start + (uptr)str.len)) { break; }
+
+        /* Is a digit? */
+        if (*c + 0U - '0' <= 9U) 
+        {
+            in_digits = true;                    /* Signal we've passed +/- signs */
+            parsed = parsed * 10 + (*c - '0');   /* Accumulate digits */
+
+        }
+        else if (*c == '-' && !in_digits) { neg_flag = true; }
+        else if (*c == '+' && !in_digits) { neg_flag = false; }
+        else { return false; }
+
+        /* Move to the next character */
+        ++c;
+    }
+
+    *result = neg_flag ? -parsed : parsed;
+    return true;
+}
+
+static inline b32
+elk_str_parse_i64(ElkStr str, i64 *result)
+{
+    /* Empty string is an error */
+    StopIf(str.len == 0, return false);
+
+#if 0
+    /* Check that first the string is short enough, 16 bytes, and second that it does not cross a 4 KiB memory boundary.
+     * The boundary check is needed because we can't be sure that we have access to the other page. If we don't, seg-fault!
+     */
+    if(str.len <= 16 && ((((uptr)str.start + str.len) % ECO_KiB(4)) >= 16))
+    {
+        /* _0_ Load, but ensure the last digit is in the last position */
+        u8 len = (u8)str.len;
+        uptr start = (uptr)str.start + str.len - 16;
+        __m128i value = _mm_loadu_si128((__m128i const *)start);
+        __m128i const positions = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+        __m128i const positions_mask = _mm_cmpgt_epi8(positions, _mm_set1_epi8(len));
+        value = _mm_andnot_si128(positions_mask, value);                                 /* Mask out data we didn't want.*/
+ 
+        /* _1_ detect negative sign */
+        __m128i const neg_sign = _mm_set1_epi8('-');
+        __m128i const pos_sign = _mm_set1_epi8('+');
+        __m128i const neg_mask = _mm_cmpeq_epi8(value, neg_sign);
+        __m128i const pos_mask = _mm_cmpeq_epi8(value, pos_sign);
+        i32 neg_flag = _mm_movemask_epi8(neg_mask);
+        i32 pos_flag = _mm_movemask_epi8(pos_mask);
+        neg_flag = (neg_flag >> (16 - str.len)) & 0x01; /* 0-false or 1-true, remember movemask reverses bits. */
+        pos_flag = (pos_flag >> (16 - str.len)) & 0x01; /* 0-false or 1-true, remember movemask reverses bits. */
+
+        /* _2_ mask out negative sign and non-digit characters */
+        __m128i const not_digits = _mm_or_si128(
+                _mm_cmpgt_epi8(value, _mm_set1_epi8('9')),
+                _mm_cmplt_epi8(value, _mm_set1_epi8('0')));
+        value = _mm_andnot_si128(not_digits, value);
+
+        /* _3_ movemask to get bits representing data */
+        u32 const digit_bits = (~_mm_movemask_epi8(not_digits)) & 0xFFFF;
+
+        /* _4_ _mm_popcnt_u32 to get the number of digits, depending on - sign, if less than string length, ERROR! */
+        i32 const num_digits = _mm_popcnt_u32(digit_bits);
+        if(num_digits < ((neg_flag || pos_flag) ? len - 1 : len)) { return false; }
+
+        /* _5_ subtract '0' from fields with digits. */
+        __m128i const zero_char = _mm_set1_epi8('0');
+        value = _mm_sub_epi8(value, zero_char);
+        value = _mm_andnot_si128(not_digits, value);     /* Re-zero the bytes that had zeros before this operation */
+        
+        /* _6_ _mm_maddubs_epi16(_2_, first constant) */
+        __m128i const m1 = _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1);
+        value = _mm_maddubs_epi16(value, m1);
+        
+        /* _7_ _mm_madd_epi16(_6_, second constant) */
+        __m128i const m2 = _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1);
+        value = _mm_madd_epi16(value, m2);
+
+        /* _8_ _mm_packs_epi32(_7_, _7_) */
+        value = _mm_packs_epi32(_mm_setzero_si128(), value);
+
+        /* _9_ _mm_madd_epi16(_8_, third constant) */
+        __m128i const m3 = _mm_setr_epi16(0, 0, 0, 0, 10000, 1, 10000, 1);
+        value = _mm_madd_epi16(value, m3);
+
+        /* _10_ _mm_mul_epu32(_10_, fourth constant multiplier) */
+        __m128i const m4 = _mm_set1_epi32(100000000);
+        __m128i value_top = _mm_mul_epu32(value, m4);
+
+        /* _11_ shuffle value into little endian for the 64 bit add coming up. _mm_shuffle_epi32(_9_, 0xB4) 0b 00 11 00 00 */
+        value = _mm_shuffle_epi32(value, 0x30); 
+
+        /* _12_ _mm_add_epi64(_9_, _11_) */
+        value = _mm_add_epi64(value, value_top);
+
+        /* _13_ __int64 val = _mm_extract_epi64(_12_, 0) */
+        *result = (neg_flag ? -1 : 1) * _mm_extract_epi64(value, 1);
+        return true;
+
+    }
+    else
+    {
+        return elk_str_helper_parse_i64(str, result);
+    }
+#else
+    return elk_str_helper_parse_i64(str, result);
+#endif
+}
+
+#pragma warning(disable : 4723)
+static inline b32
+elk_str_robust_parse_f64(ElkStr str, f64 *out)
+{
+    /* The following block is required to create NAN/INF witnout using math.h on MSVC. Using #define NAN (0.0/0.0) doesn't
+     * work either on MSVC, which gives C2124 divide by zero error.
+     */
+    static f64 const ELK_ZERO = 0.0;
+    f64 const ELK_INF = 1.0 / ELK_ZERO;
+    f64 const ELK_NEG_INF = -1.0 / ELK_ZERO;
+    f64 const ELK_NAN = 0.0 / ELK_ZERO;
+
+    StopIf(str.len == 0, goto ERR_RETURN);
+
+    char const *c = str.start;
+    char const *end = str.start + str.len;
+    size len_remaining = str.len;
+
+    i8 sign = 0;        /* 0 is positive, 1 is negative */
+    i8 exp_sign = 0;    /* 0 is positive, 1 is negative */
+    i16 exponent = 0;
+    i64 mantissa = 0;
+    i16 extra_exp = 0;  /* decimal places after the point */
+
+    /* Check & parse a sign */
+    if (*c == '-')      { sign =  1; --len_remaining; ++c; }
+    else if (*c == '+') { sign =  0; --len_remaining; ++c; }
+
+    /* check for nan/NAN/NaN/Nan inf/INF/Inf */
+    if (len_remaining == 3) 
+    {
+        if(memcmp(c, "nan", 3) == 0 || memcmp(c, "NAN", 3) == 0 || memcmp(c, "NaN", 3) == 0 || memcmp(c, "Nan", 3) == 0) 
+        { 
+            *out = ELK_NAN; return true;
+        }
+
+        if(memcmp(c, "inf", 3) == 0 || memcmp(c, "Inf", 3) == 0 || memcmp(c, "INF", 3) == 0)
+        {
+            if(sign == 0) *out = ELK_INF;
+            else if(sign == 1) *out = ELK_NEG_INF;
+            return true; 
+        }
+    }
+
+    /* check for infinity/INFINITY/Infinity */
+    if (len_remaining == 8) 
+    {
+        if(memcmp(c, "infinity", 8) == 0 || memcmp(c, "Infinity", 8) == 0 || memcmp(c, "INFINITY", 8) == 0)
+        {
+            if(sign == 0) *out = ELK_INF;
+            else if(sign == 1) *out = ELK_NEG_INF;
+            return true; 
+        }
+    }
+
+    /* Parse the mantissa up to the decimal point or exponent part */
+    char digit;
+    while (c < end)
+    {
+        digit = *c - '0';
+
+        if(digit < 10 && digit >= 0)
+        {
+            mantissa = mantissa * 10 + digit;
+            ++c;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    /* Check for the decimal point */
+    if(c < end && *c == '.')
+    {
+        ++c;
+
+        /* Parse the mantissa up to the decimal point or exponent part */
+        while(c < end)
+        {
+            digit = *c - '0';
+
+            if(digit < 10 && digit >= 0)
+            {
+                /* overflow check */
+                StopIf((INT64_MAX - digit) / 10 < mantissa, goto ERR_RETURN); 
+
+                mantissa = mantissa * 10 + digit;
+                extra_exp += 1;
+
+                ++c;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    /* Account for negative signs */
+    mantissa = sign == 1 ? -mantissa : mantissa;
+
+    /* Start the exponent */
+    if(c < end && (*c == 'e' || *c == 'E')) 
+    {
+        ++c;
+
+        if (*c == '-') { exp_sign = 1; ++c; }
+        else if (*c == '+') { exp_sign = 0; ++c; }
+
+        /* Parse the mantissa up to the decimal point or exponent part */
+        while(c < end)
+        {
+            digit = *c - '0';
+
+            if(digit < 10 && digit >= 0)
+            {
+                /* Overflow check */
+                StopIf((INT16_MAX - digit) / 10 < exponent, goto ERR_RETURN); 
+
+                exponent = exponent * 10 + digit;
+
+                ++c;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        /* Account for negative signs */
+        exponent = exp_sign == 1 ? -exponent : exponent;
+    }
+
+    /* Once we get here we're done. Should be end of string. */
+    StopIf( c!= end, goto ERR_RETURN);
+
+    /* Account for decimal point location. */
+    exponent -= extra_exp;
+
+    /* Check for overflow */
+    StopIf(exponent < -307 || exponent > 308, goto ERR_RETURN);
+
+    f64 exp_part = 1.0;
+    for (int i = 0; i < exponent; ++i) { exp_part *= 10.0; }
+    for (int i = 0; i > exponent; --i) { exp_part /= 10.0; }
+
+    f64 value = (f64)mantissa * exp_part;
+    StopIf(value == ELK_INF || value == ELK_NEG_INF, goto ERR_RETURN);
+
+    *out = value;
+    return true;
+
+ERR_RETURN:
+    *out = ELK_NAN;
+    return false;
+}
+#pragma warning(default : 4723)
+
+#pragma warning(disable : 4723)
+static inline b32 
+elk_str_fast_parse_f64(ElkStr str, f64 *out)
+{
+    /* The following block is required to create NAN/INF witnout using math.h on MSVC Using */
+    /* #define NAN (0.0/0.0) doesn't work either on MSVC, which gives C2124 divide by zero error. */
+    static f64 const ELK_ZERO = 0.0;
+    f64 const ELK_INF = 1.0 / ELK_ZERO;
+    f64 const ELK_NEG_INF = -1.0 / ELK_ZERO;
+    f64 const ELK_NAN = 0.0 / ELK_ZERO;
+
+    StopIf(str.len == 0, goto ERR_RETURN);
+
+    char const *c = str.start;
+    char const *end = str.start + str.len;
+
+    i8 sign = 0;        /* 0 is positive, 1 is negative */
+    i8 exp_sign = 0;    /* 0 is positive, 1 is negative */
+    i16 exponent = 0;
+    i64 mantissa = 0;
+    i16 extra_exp = 0;  /* decimal places after the point */
+
+    /* Check & parse a sign */
+    if (*c == '-')      { sign =  1; ++c; }
+    else if (*c == '+') { sign =  0; ++c; }
+
+    /* Parse the mantissa up to the decimal point or exponent part */
+    char digit = *c - '0';
+    while (c < end && digit  < 10 && digit  >= 0)
+    {
+        mantissa = mantissa * 10 + digit;
+        ++c;
+        digit = *c - '0';
+    }
+
+    /* Check for the decimal point */
+    if (c < end && *c == '.')
+    {
+        ++c;
+
+        /* Parse the mantissa up to the decimal point or exponent part */
+        digit = *c - '0';
+        while (c < end && digit < 10 && digit >= 0)
+        {
+            mantissa = mantissa * 10 + digit;
+            extra_exp += 1;
+
+            ++c;
+            digit = *c - '0';
+        }
+    }
+
+    /* Account for negative signs */
+    mantissa = sign == 1 ? -mantissa : mantissa;
+
+    /* Start the exponent */
+    if (c < end && (*c == 'e' || *c == 'E')) 
+    {
+        ++c;
+
+        if (*c == '-') { exp_sign = 1; ++c; }
+        else if (*c == '+') { exp_sign = 0; ++c; }
+
+        /* Parse the mantissa up to the decimal point or exponent part */
+        digit = *c - '0';
+        while (c < end && digit < 10 && digit >= 0)
+        {
+            exponent = exponent * 10 + digit;
+
+            ++c;
+            digit = *c - '0';
+        }
+
+        /* Account for negative signs */
+        exponent = exp_sign == 1 ? -exponent : exponent;
+    }
+
+    /* Account for decimal point location. */
+    exponent -= extra_exp;
+
+    f64 exp_part = 1.0;
+    for (int i = 0; i < exponent; ++i) { exp_part *= 10.0; }
+    for (int i = 0; i > exponent; --i) { exp_part /= 10.0; }
+
+    f64 value = (f64)mantissa * exp_part;
+    StopIf(value == ELK_INF || value == ELK_NEG_INF, goto ERR_RETURN);
+
+    *out = value;
+    return true;
+
+ERR_RETURN:
+    *out = ELK_NAN;
+    return false;
+}
+#pragma warning(default : 4723)
+
+#ifndef __EMSCRIPTEN__
+static inline b32
+elk_str_parse_datetime_long_format(ElkStr str, ElkTime *out)
+{
+    /* Calculate the start address to load it into the buffer with just the right positions for the characters. */
+    uptr start = (uptr)str.start + str.len + 7 - 32;
+
+    /* YYYY-MM-DD HH:MM:SS and YYYY-MM-DDTHH:MM:SS formats */
+    /* Check to make sure we have AVX and that the string buffer won't cross a 4 KiB boundary. */
+    if(__AVX2__ && ((((uptr)str.start + str.len + 7) % ECO_KiB(4)) >= 32))
+    {
+        __m256i dt_string = _mm256_loadu_si256((__m256i *)start);
+
+        /* Shuffle around the numbers to get them in position for doing math. */
+        __m256i shuffle = _mm256_setr_epi8(
+                0xFF, 0xFF, 0xFF, 0xFF,    6,    7,    8,    9, 0xFF, 0xFF,   11,   12, 0xFF, 0xFF,   14,   15,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,    1,    2, 0xFF, 0xFF,    4,    5, 0xFF, 0xFF,    7,    8);
+        dt_string = _mm256_shuffle_epi8(dt_string, shuffle);
+
+        /* Subtract out the zero char value and mask out lanes that hold no data we need */
+        dt_string = _mm256_sub_epi8(dt_string, _mm256_set1_epi8('0'));
+        __m256i data_mask = _mm256_setr_epi8(
+                0xFF, 0xFF, 0xFF, 0xFF,    0,    0,    0,    0, 0xFF, 0xFF,    0,    0, 0xFF, 0xFF,    0,    0,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,    0,    0, 0xFF, 0xFF,    0,    0, 0xFF, 0xFF,    0,    0);
+        dt_string = _mm256_andnot_si256(data_mask, dt_string);
+
+        /* Multiply and add adjacent lanes */
+        __m256i madd_const1 = _mm256_setr_epi8(
+                0,  0,  0,  0, 10,  1, 10,  1,  0,  0, 10,  1,  0,  0, 10,  1,
+                0,  0,  0,  0,  0,  0, 10,  1,  0,  0, 10,  1,  0,  0, 10,  1);
+        __m256i vals16 = _mm256_maddubs_epi16(dt_string, madd_const1);
+
+        /* Month, day, hour, minute, second are already done! Now need to calculate year. */
+        __m256i madd_const2 = _mm256_setr_epi16(0, 0, 100, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+        __m256i vals32 = _mm256_madd_epi16(vals16, madd_const2);
+
+        i16 year = _mm256_extract_epi32(vals32, 1);
+        i8 month = _mm256_extract_epi16(vals16, 5);
+        i8 day = _mm256_extract_epi16(vals16, 7);
+        i8 hour = _mm256_extract_epi16(vals16, 11);
+        i8 minutes = _mm256_extract_epi16(vals16, 13);
+        i8 seconds = _mm256_extract_epi16(vals16, 15);
+
+            *out = elk_time_from_ymd_and_hms(year, month, day, hour, minutes, seconds);
+            return true;
+    }
+    else
+    {
+        i64 year = INT64_MIN;
+        i64 month = INT64_MIN;
+        i64 day = INT64_MIN;
+        i64 hour = INT64_MIN;
+        i64 minutes = INT64_MIN;
+        i64 seconds = INT64_MIN;
+
+        if(
+            elk_str_parse_i64(elk_str_substr(str,  0, 4), &year    ) && 
+            elk_str_parse_i64(elk_str_substr(str,  5, 2), &month   ) &&
+            elk_str_parse_i64(elk_str_substr(str,  8, 2), &day     ) &&
+            elk_str_parse_i64(elk_str_substr(str, 11, 2), &hour    ) &&
+            elk_str_parse_i64(elk_str_substr(str, 14, 2), &minutes ) &&
+            elk_str_parse_i64(elk_str_substr(str, 17, 2), &seconds ))
+        {
+            *out = elk_time_from_ymd_and_hms((i16)year, (i8)month, (i8)day, (i8)hour, (i8)minutes, (i8)seconds);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+#else
+
+static inline b32
+elk_str_parse_datetime_long_format(ElkStr str, ElkTime *out)
+{
+    i64 year = INT64_MIN;
+    i64 month = INT64_MIN;
+    i64 day = INT64_MIN;
+    i64 hour = INT64_MIN;
+    i64 minutes = INT64_MIN;
+    i64 seconds = INT64_MIN;
+
+    if(
+        elk_str_parse_i64(elk_str_substr(str,  0, 4), &year    ) && 
+        elk_str_parse_i64(elk_str_substr(str,  5, 2), &month   ) &&
+        elk_str_parse_i64(elk_str_substr(str,  8, 2), &day     ) &&
+        elk_str_parse_i64(elk_str_substr(str, 11, 2), &hour    ) &&
+        elk_str_parse_i64(elk_str_substr(str, 14, 2), &minutes ) &&
+        elk_str_parse_i64(elk_str_substr(str, 17, 2), &seconds ))
+    {
+        *out = elk_time_from_ymd_and_hms((i16)year, (i8)month, (i8)day, (i8)hour, (i8)minutes, (i8)seconds);
+        return true;
+    }
+
+    return false;
+}
+#endif
+
+static inline b32
+elk_str_parse_datetime_compact_doy(ElkStr str, ElkTime *out)
+{
+    /* YYYYDDDHHMMSS format */
+    i64 year = INT64_MIN;
+    i64 day_of_year = INT64_MIN;
+    i64 hour = INT64_MIN;
+    i64 minutes = INT64_MIN;
+    i64 seconds = INT64_MIN;
+
+    if(
+        elk_str_parse_i64(elk_str_substr(str,  0, 4), &year        ) && 
+        elk_str_parse_i64(elk_str_substr(str,  4, 3), &day_of_year ) &&
+        elk_str_parse_i64(elk_str_substr(str,  7, 2), &hour        ) &&
+        elk_str_parse_i64(elk_str_substr(str,  9, 2), &minutes     ) &&
+        elk_str_parse_i64(elk_str_substr(str, 11, 2), &seconds     ))
+    {
+        *out = elk_time_from_yd_and_hms((i16)year, (i8)day_of_year, (i8)hour, (i8)minutes, (i8)seconds);
+        return true;
+    }
+
+    return false;
+}
+
+static inline b32
+elk_str_parse_datetime(ElkStr str, ElkTime *out)
+{
+    /* Check the length to find out what type of string we are parsing. */
+    switch(str.len)
+    {
+        /* YYYY-MM-DD HH:MM:SS and YYYY-MM-DDTHH:MM:SS formats */
+        case 19: return elk_str_parse_datetime_long_format(str, out);
+
+        /* YYYYDDDHHMMSS format */
+        case 13: return elk_str_parse_datetime_compact_doy(str, out);
+
+        default: return false;
+    }
+
+    return false;
+}
+
+static inline b32 
+elk_str_parse_usa_date(ElkStr str, ElkDate *out)
+{
+    /* MM-DD-YYYY format */
+    i64 year = INT64_MIN;
+    i64 month = INT64_MIN;
+    i64 day = INT64_MIN;
+
+    if(
+        elk_str_parse_i64(elk_str_substr(str,  6, 4), &year    ) && 
+        elk_str_parse_i64(elk_str_substr(str,  0, 2), &month   ) &&
+        elk_str_parse_i64(elk_str_substr(str,  3, 2), &day     ))
+    {
+        *out = elk_date_from_ymd((i16)year, (i8)month, (i8)day);
+        return true;
+    }
+
+    return false;
+}
+
+static inline b32 
+elk_str_parse_ymd_date(ElkStr str, ElkDate *out)
+{
+    /* YYYY-MM-DD format */
+    i64 year = INT64_MIN;
+    i64 month = INT64_MIN;
+    i64 day = INT64_MIN;
+
+    if(
+        elk_str_parse_i64(elk_str_substr(str,  0, 4), &year    ) && 
+        elk_str_parse_i64(elk_str_substr(str,  5, 2), &month   ) &&
+        elk_str_parse_i64(elk_str_substr(str,  8, 2), &day     ))
+    {
+        *out = elk_date_from_ymd((i16)year, (i8)month, (i8)day);
+        return true;
+    }
+
+    return false;
+}
+
+static inline b32 
+elk_str_parse_date(ElkStr str, ElkDate *out)
+{
+    if(str.start[2] == '-' || str.start[2] == '/')
+    {
+        return elk_str_parse_usa_date(str, out);
+    }
+    else if(str.start[4] == '-' || str.start[4] == '/')
+    {
+        return elk_str_parse_ymd_date(str, out);
+    }
+
+    return false;
+}
+
+static u64 const fnv_offset_bias = 0xcbf29ce484222325;
+static u64 const fnv_prime = 0x00000100000001b3;
+
+static inline u64
+elk_fnv1a_hash_accumulate(size const size_bytes, void const *value, u64 const hash_so_far)
+{
+    u8 const *data = value;
+
+    u64 hash = hash_so_far;
+    for (size i = 0; i < size_bytes; ++i)
+    {
+        hash ^= data[i];
+        hash *= fnv_prime;
+    }
+
+    return hash;
+}
+
+static inline u64
+elk_fnv1a_hash(size const n, void const *value)
+{
+    return elk_fnv1a_hash_accumulate(n, value, fnv_offset_bias);
+}
+
+static inline u64
+elk_fnv1a_hash_str(ElkStr str)
+{
+    return elk_fnv1a_hash(str.len, str.start);
+}
+
+#if __AVX2__ || ELK_AVX_512
+static inline void elk_csv_helper_load_new_buffer_aligned(ElkCsvParser *p, i8 skip_bytes);
+#endif
+
+static inline ElkCsvParser 
+elk_csv_create_parser(ElkStr input)
+{
+    ElkCsvParser parser = { .remaining=input, .row=0, .col=0, .error=false };
+
+    /* Scan past leading comment lines. */
+    while(*parser.remaining.start == '#')
+    {
+        /* We must be on a comment line if we got here, so read just past the end of the line */
+        while(*parser.remaining.start && parser.remaining.len > 0)
+        {
+            char last_char = *parser.remaining.start;
+            ++parser.remaining.start;
+            --parser.remaining.len;
+            if(last_char == '\n') { break; }
+        }
+    }
+
+#if ELK_AVX_512
+    i8 skip_bytes = (i8)((uptr)parser.remaining.start - ((uptr)parser.remaining.start & ~0x3F));
+    parser.remaining.start = (char *)((uptr)parser.remaining.start & ~0x3F); /* Force 64 byte alignment */
+    parser.carry = 0;
+    elk_csv_helper_load_new_buffer_aligned(&parser, skip_bytes);
+#elif __AVX2__
+    i8 skip_bytes = (i8)((uptr)parser.remaining.start - ((uptr)parser.remaining.start & ~0x1F));
+    parser.remaining.start = (char *)((uptr)parser.remaining.start & ~0x1F); /* Force 32 byte alignment */
+    parser.carry = 0;
+    elk_csv_helper_load_new_buffer_aligned(&parser, skip_bytes);
+#endif
+
+    return parser;
+}
+
+static inline b32 
+elk_csv_finished(ElkCsvParser *parser)
+{
+    return parser->error || parser->remaining.len <= 0;
+}
+
+static inline ElkCsvToken 
+elk_csv_full_next_token(ElkCsvParser *parser)
+{
+    StopIf(elk_csv_finished(parser), goto ERR_RETURN);
+
+    /* Current position in parser and how much we've processed */
+    char *next_char = parser->remaining.start;
+    int num_chars_proc = 0;
+    size row = parser->row;
+    size col = parser->col;
+
+    /* Handle comment lines */
+    while(col == 0 && *next_char == '#')
+    {
+        /* We must be on a comment line if we got here, so read just past the end of the line */
+        
+        while(*next_char && parser->remaining.len - num_chars_proc > 0)
+        {
+            char *last_char = next_char;
+            ++next_char;
+            ++num_chars_proc;
+            if(*last_char == '\n') { break; }
+        }
+    }
+
+    /* The data for the next value to return */
+    char *next_value_start = next_char;
+    size next_value_len = 0;
+
+#if ELK_AVX_512
+    /* Do SIMD */
+
+    /* Are we in a quoted string where we should ignore commas? */
+    b32 stop = false;
+    u64 carry = 0;
+
+    __m512i quotes = _mm512_set1_epi8('"');
+    __m512i commas = _mm512_set1_epi8(',');
+    __m512i newlines = _mm512_set1_epi8('\n');
+
+    while(!stop && parser->remaining.len > num_chars_proc + 64)
+    {
+        __m512i chars = _mm512_loadu_si512((__m512i *)next_char);
+
+        __mmask64 quote_mask = _mm512_cmpeq_epi8_mask(chars, quotes);
+        __mmask64 comma_mask = _mm512_cmpeq_epi8_mask(chars, commas);
+        __mmask64 newline_mask = _mm512_cmpeq_epi8_mask(chars, newlines);
+
+        /* https://nullprogram.com/blog/2021/12/04/ - public domain code to create running mask */
+        u64 running_quote_mask = _cvtmask64_u64(quote_mask);
+        u64 r = running_quote_mask;
+
+        while(running_quote_mask)
+        {
+            r ^= -running_quote_mask ^ running_quote_mask;
+            running_quote_mask &= running_quote_mask - 1;
+        }
+
+        running_quote_mask = r ^ carry;
+        carry = -(running_quote_mask >> 63);
+        quote_mask = _cvtu64_mask64(running_quote_mask);
+
+        comma_mask = _kandn_mask64(quote_mask, comma_mask);
+        u64 comma_bits = _cvtmask64_u64(comma_mask);
+        newline_mask = _kandn_mask64(quote_mask, newline_mask);
+        u64 newline_bits = _cvtmask64_u64(newline_mask);
+
+        __mmask64 comma_or_newline_mask = _kor_mask64(comma_mask, newline_mask);
+        u64 comma_or_newline_bits = _cvtmask64_u64(comma_or_newline_mask);
+
+        u64 first_non_zero_bit_lsb = comma_or_newline_bits & ~(comma_or_newline_bits - 1);
+        i64 bit_pos = 63 - __builtin_clzll(first_non_zero_bit_lsb);
+        bit_pos = bit_pos > 63 || bit_pos < 0 ? 63 : bit_pos;
+
+        b32 comma = (comma_bits >> bit_pos) & 1ULL;
+        b32 newline = (newline_bits >> bit_pos) & 1ULL;
+        b32 comma_or_newline = (comma_or_newline_bits >> bit_pos) & 1ULL;
+
+        parser->row += newline;
+        parser->col += -col * newline + comma;
+        next_value_len += bit_pos + 1 - comma_or_newline;
+
+        next_char += bit_pos + 1 ;
+        num_chars_proc += bit_pos + 1 ;
+
+        stop = comma_or_newline;
+    }
+
+    b32 in_string = carry > 0;
+
+#elif __AVX2__
+    /* Do SIMD */
+
+    /* Are we in a quoted string where we should ignore commas? */
+    b32 stop = false;
+    u32 carry = 0;
+
+    __m256i quotes = _mm256_set1_epi8('"');
+    __m256i commas = _mm256_set1_epi8(',');
+    __m256i newlines = _mm256_set1_epi8('\n');
+
+    __m256i S = _mm256_setr_epi64x(0x0000000000000000, 0x0101010101010101, 0x0202020202020202, 0x0303030303030303);
+    __m256i M = _mm256_set1_epi64x(0x7fbfdfeff7fbfdfe);
+    __m256i A = _mm256_set1_epi64x(0xffffffffffffffff);
+
+    while(!stop && parser->remaining.len > num_chars_proc + 32)
+    {
+        __m256i chars = _mm256_lddqu_si256((__m256i *)next_char);
+
+        __m256i quote_mask = _mm256_cmpeq_epi8(chars, quotes);
+        __m256i comma_mask = _mm256_cmpeq_epi8(chars, commas);
+        __m256i newline_mask = _mm256_cmpeq_epi8(chars, newlines);
+
+        /* https://nullprogram.com/blog/2021/12/04/ - public domain code to create running mask */
+        u32 running_quote_mask = _mm256_movemask_epi8(quote_mask);
+        u32 r = running_quote_mask;
+
+        while(running_quote_mask)
+        {
+            r ^= -running_quote_mask ^ running_quote_mask;
+            running_quote_mask &= running_quote_mask - 1;
+        }
+
+        running_quote_mask = r ^ carry;
+        carry = -(running_quote_mask >> 31);
+        quote_mask = _mm256_set1_epi32(running_quote_mask);
+        quote_mask = _mm256_shuffle_epi8(quote_mask, S);
+        quote_mask = _mm256_or_si256(quote_mask, M);
+        quote_mask = _mm256_cmpeq_epi8(quote_mask, A);
+
+        comma_mask = _mm256_andnot_si256(quote_mask, comma_mask);
+        u32 comma_bits = _mm256_movemask_epi8(comma_mask);
+        newline_mask = _mm256_andnot_si256(quote_mask, newline_mask);
+        u32 newline_bits = _mm256_movemask_epi8(newline_mask);
+
+        __m256i comma_or_newline_mask = _mm256_or_si256(comma_mask, newline_mask);
+        u32 comma_or_newline_bits = _mm256_movemask_epi8(comma_or_newline_mask);
+
+        u32 first_non_zero_bit_lsb = comma_or_newline_bits & ~(comma_or_newline_bits - 1);
+        i32 bit_pos = 31 - __builtin_clz(first_non_zero_bit_lsb);
+        bit_pos = bit_pos > 31 || bit_pos < 0 ? 31 : bit_pos;
+
+        b32 comma = (comma_bits >> bit_pos) & 1;
+        b32 newline = (newline_bits >> bit_pos) & 1;
+        b32 comma_or_newline = (comma_or_newline_bits >> bit_pos) & 1;
+
+        parser->row += newline;
+        parser->col += -col * newline + comma;
+        next_value_len += bit_pos + 1 - comma_or_newline;
+
+        next_char += bit_pos + 1 ;
+        num_chars_proc += bit_pos + 1 ;
+
+        stop = comma_or_newline;
+    }
+
+    b32 in_string = carry > 0;
+#else
+    b32 stop = false;
+    u32 carry = 0;
+
+    b32 in_string = carry > 0;
+#endif
+
+    /* Finish up when not 32 remaining. */
+    while(!stop && parser->remaining.len > num_chars_proc)
+    {
+        switch(*next_char)
+        {
+            case '\n':
+            {
+                parser->row += 1;
+                parser->col = 0;
+                --next_value_len;
+                stop = true;
+            } break;
+
+            case '"':
+            {
+                in_string = !in_string;
+            } break;
+
+            case ',':
+            {
+                if(!in_string) 
+                {
+                    parser->col += 1;
+                    --next_value_len;
+                    stop = true;
+                }
+            } break;
+
+            default: break;
+        }
+
+        ++next_value_len;
+        ++next_char;
+        ++num_chars_proc;
+    }
+
+    parser->remaining.start = next_char;
+    parser->remaining.len -= num_chars_proc;
+
+    return (ElkCsvToken){ .row=row, .col=col, .value=(ElkStr){ .start=next_value_start, .len=next_value_len }};
+
+ERR_RETURN:
+    parser->error = true;
+    return (ElkCsvToken){ .row=parser->row, .col=parser->col, .value=(ElkStr){.start=parser->remaining.start, .len=0}};
+}
+
+#if ELK_AVX_512
+
+static inline void
+elk_csv_helper_load_new_buffer_aligned(ElkCsvParser *p, i8 skip_bytes)
+{
+    Assert((uptr)p->remaining.start % 64 == 0); /* Always aligned on a 64 byte boundary. */
+
+    /* Constants for matching delimiters & quotes. */
+    __m512i quotes = _mm512_set1_epi8('"');
+    __m512i commas = _mm512_set1_epi8(',');
+    __m512i newlines = _mm512_set1_epi8('\n');
+
+    /* Load data into the buffer. */
+    if(p->remaining.len < 64)
+    {
+        __m512i raw_data = _mm512_load_si512((__m512i *)(p->remaining.start));
+
+        u64 len = p->remaining.len;
+        u64 mask_bits = (1ULL << len) ^ ((1ULL << len) - 1ULL);
+        __m512i mask = _mm512_maskz_mov_epi8(_cvtu64_mask64(mask_bits), _mm512_set1_epi8((char)0xFF));
+        p->buf = _mm512_and_si512(raw_data, mask);
+    }
+    else
+    {
+        p->buf = _mm512_load_si512((__m512i *)(p->remaining.start));
+    }
+
+    /* Zero out leading bytes if necessary so they don't accidently match a delimiter. */
+    if(skip_bytes)
+    {
+        Assert(skip_bytes > 0 && skip_bytes < 64);
+        u64 len = skip_bytes - 1;
+        u64 mask_bits = (1ULL << len) ^ ((1ULL << len) - 1ULL);
+        __m512i mask = _mm512_maskz_mov_epi8(_cvtu64_mask64(mask_bits), _mm512_set1_epi8((char)0xFF));
+        p->buf = _mm512_andnot_si512(mask, p->buf);
+    }
+
+    __mmask64 quote_mask = _mm512_cmpeq_epi8_mask(p->buf, quotes);
+    __mmask64 comma_mask = _mm512_cmpeq_epi8_mask(p->buf, commas);
+    __mmask64 newline_mask = _mm512_cmpeq_epi8_mask(p->buf, newlines);
+
+    /* https://nullprogram.com/blog/2021/12/04/ - public domain code to create running mask */
+    u64 running_quote_mask = _cvtmask64_u64(quote_mask);
+    u64 r = running_quote_mask;
+
+    while(running_quote_mask)
+    {
+        r ^= -running_quote_mask ^ running_quote_mask;
+        running_quote_mask &= running_quote_mask - 1;
+    }
+
+    running_quote_mask = r ^ p->carry;
+    p->carry = -(running_quote_mask >> 63);
+    quote_mask = _cvtu64_mask64(running_quote_mask);
+
+    comma_mask = _kandn_mask64(quote_mask, comma_mask);
+    p->buf_comma_bits = _cvtmask64_u64(comma_mask);
+    newline_mask = _kandn_mask64(quote_mask, newline_mask);
+    p->buf_newline_bits = _cvtmask64_u64(newline_mask);
+
+    __mmask64 comma_or_newline_mask = _kor_mask64(comma_mask, newline_mask);
+    p->buf_any_delimiter_bits = _cvtmask64_u64(comma_or_newline_mask);
+
+    p->remaining.start += skip_bytes;
+    p->byte_pos = skip_bytes;
+}
+
+static inline ElkCsvToken
+elk_csv_fast_next_token(ElkCsvParser *parser)
+{
+    size row = parser->row;
+    size col = parser->col;
+
+    StopIf(elk_csv_finished(parser), goto ERR_RETURN);
+
+    /* Keep track of where this specific token actually starts in memory */
+    char *token_start = parser->remaining.start;
+    size next_value_len = 0;
+    b32 stop = false;
+
+    while(!stop)
+    {
+        u64 any_delim = parser->buf_any_delimiter_bits;
+
+        /* If no delimiters are left in the CURRENTLY loaded 64-byte buffer */
+        if (any_delim == 0) 
+        {
+            /* Consume the rest of this buffer */
+            i32 run_len = 64 - parser->byte_pos;
+            next_value_len += run_len;
+            
+            /* Advance the parsing pointer strictly to the next 32-byte aligned boundary */
+            parser->remaining.start += run_len;
+            parser->remaining.len -= run_len;
+
+            if (parser->remaining.len > 0)
+            {
+                /* This will maintain perfect 64-byte alignment because we stepped by the exact remainder */
+                elk_csv_helper_load_new_buffer_aligned(parser, 0);
+                continue; 
+            }
+            else
+            {
+                stop = true;
+                break;
+            }
+        }
+
+        /* We have a delimiter! Cleanly isolate the lowest bit using Trailing Zero Count */
+        i32 bit_pos = _tzcnt_u64(any_delim); 
+        i32 run_len = bit_pos - parser->byte_pos;
+
+        u64 first_non_zero_bit_lsb = 1ULL << bit_pos;
+
+        b32 comma = (parser->buf_comma_bits >> bit_pos) & 1ULL;
+        b32 newline = (parser->buf_newline_bits >> bit_pos) & 1ULL;
+
+        /* Clear the bit */
+        parser->buf_comma_bits &= ~first_non_zero_bit_lsb;
+        parser->buf_newline_bits &= ~first_non_zero_bit_lsb;
+        parser->buf_any_delimiter_bits &= ~first_non_zero_bit_lsb;
+
+        /* Update tracking states */
+        parser->row += newline;
+        parser->col += -col * newline + comma;
+        
+        next_value_len += run_len;
+        
+        /* Advance structural state past the delimiter */
+        parser->remaining.start += run_len + 1;
+        parser->remaining.len -= run_len + 1;
+        parser->byte_pos = bit_pos + 1;
+
+        stop = true; /* Found our delimiter, time to return the token! */
+
+        /* If we consumed right up to the end of the buffer, reload next iteration */
+        if (parser->byte_pos >= 64)
+        {
+            if (parser->remaining.len > 0)
+            {
+                elk_csv_helper_load_new_buffer_aligned(parser, 0);
+            }
+        }
+    }
+
+    return (ElkCsvToken){ .row=row, .col=col, .value=(ElkStr){.start=token_start, .len=next_value_len}};
+
+ERR_RETURN:
+    parser->error = true;
+    return (ElkCsvToken){ .row=row, .col=col, .value=(ElkStr){.start=parser->remaining.start, .len=0}};
+}
+
+#elif __AVX2__
+
+static const _Alignas(32) u8 CLEAR_MASKS[32][32] =
+    {
+        {255, 0},
+        {255, 255, 0},
+        {255, 255, 255, 0},
+        {255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0},
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
+    };
+
+static inline void
+elk_csv_helper_load_new_buffer_aligned(ElkCsvParser *p, i8 skip_bytes)
+{
+    Assert((uptr)p->remaining.start % 32 == 0); /* Always aligned on a 32 byte boundary. */
+
+    /* SIMD constants for expanding a bit as index mask to a byte mask. */
+    __m256i S = _mm256_setr_epi64x(0x0000000000000000, 0x0101010101010101, 0x0202020202020202, 0x0303030303030303);
+    __m256i M = _mm256_set1_epi64x(0x7fbfdfeff7fbfdfe);
+    __m256i A = _mm256_set1_epi64x(0xffffffffffffffff);
+
+    /* Constants for matching delimiters & quotes. */
+    __m256i quotes = _mm256_set1_epi8('"');
+    __m256i commas = _mm256_set1_epi8(',');
+    __m256i newlines = _mm256_set1_epi8('\n');
+
+    /* Load data into the buffer. */
+    if(p->remaining.len < 32)
+    {
+        __m256i raw_data = _mm256_load_si256((__m256i *)(p->remaining.start));
+        __m256i mask = _mm256_load_si256((__m256i const *)CLEAR_MASKS[p->remaining.len]);
+        p->buf = _mm256_and_si256(raw_data, mask);
+    }
+    else
+    {
+        p->buf = _mm256_load_si256((__m256i *)(p->remaining.start));
+    }
+
+    /* Zero out leading bytes if necessary so they don't accidently match a delimiter. */
+    if(skip_bytes)
+    {
+        Assert(skip_bytes > 0 && skip_bytes < 32);
+        __m256i mask = _mm256_load_si256((__m256i const *)CLEAR_MASKS[skip_bytes - 1]);
+        p->buf = _mm256_andnot_si256(mask, p->buf);
+    }
+
+    __m256i quote_mask = _mm256_cmpeq_epi8(p->buf, quotes);
+    __m256i comma_mask = _mm256_cmpeq_epi8(p->buf, commas);
+    __m256i newline_mask = _mm256_cmpeq_epi8(p->buf, newlines);
+
+    /* https://nullprogram.com/blog/2021/12/04/ - public domain code to create running mask */
+    u32 running_quote_mask = _mm256_movemask_epi8(quote_mask);
+    u32 r = running_quote_mask;
+
+    while(running_quote_mask)
+    {
+        r ^= -running_quote_mask ^ running_quote_mask;
+        running_quote_mask &= running_quote_mask - 1;
+    }
+
+    running_quote_mask = r ^ p->carry;
+    p->carry = -(running_quote_mask >> 31);
+    quote_mask = _mm256_set1_epi32(running_quote_mask);
+    quote_mask = _mm256_shuffle_epi8(quote_mask, S);
+    quote_mask = _mm256_or_si256(quote_mask, M);
+    quote_mask = _mm256_cmpeq_epi8(quote_mask, A);
+
+    comma_mask = _mm256_andnot_si256(quote_mask, comma_mask);
+    p->buf_comma_bits = _mm256_movemask_epi8(comma_mask);
+    newline_mask = _mm256_andnot_si256(quote_mask, newline_mask);
+    p->buf_newline_bits = _mm256_movemask_epi8(newline_mask);
+
+    __m256i comma_or_newline_mask = _mm256_or_si256(comma_mask, newline_mask);
+    p->buf_any_delimiter_bits = _mm256_movemask_epi8(comma_or_newline_mask);
+    p->remaining.start += skip_bytes;
+    p->byte_pos = skip_bytes;
+}
+
+static inline ElkCsvToken
+elk_csv_fast_next_token(ElkCsvParser *parser)
+{
+    size row = parser->row;
+    size col = parser->col;
+
+    StopIf(elk_csv_finished(parser), goto ERR_RETURN);
+
+    /* Keep track of where this specific token actually starts in memory */
+    char *token_start = parser->remaining.start;
+    size next_value_len = 0;
+    b32 stop = false;
+
+    while(!stop)
+    {
+        u32 any_delim = parser->buf_any_delimiter_bits;
+
+        /* If no delimiters are left in the CURRENTly loaded 32-byte buffer */
+        if (any_delim == 0) 
+        {
+            /* Consume the rest of this buffer */
+            i32 run_len = 32 - parser->byte_pos;
+            next_value_len += run_len;
+            
+            /* Advance the parsing pointer strictly to the next 32-byte aligned boundary */
+            parser->remaining.start += run_len;
+            parser->remaining.len -= run_len;
+
+            if (parser->remaining.len > 0)
+            {
+                /* This will maintain perfect 32-byte alignment because we stepped by the exact remainder */
+                elk_csv_helper_load_new_buffer_aligned(parser, 0);
+                continue; 
+            }
+            else
+            {
+                stop = true;
+                break;
+            }
+        }
+
+        /* We have a delimiter! Cleanly isolate the lowest bit using Trailing Zero Count */
+        i32 bit_pos = _tzcnt_u32(any_delim); 
+        i32 run_len = bit_pos - parser->byte_pos;
+
+        u32 first_non_zero_bit_lsb = 1u << bit_pos;
+
+        b32 comma = (parser->buf_comma_bits >> bit_pos) & 1;
+        b32 newline = (parser->buf_newline_bits >> bit_pos) & 1;
+
+        /* Clear the bit */
+        parser->buf_comma_bits &= ~first_non_zero_bit_lsb;
+        parser->buf_newline_bits &= ~first_non_zero_bit_lsb;
+        parser->buf_any_delimiter_bits &= ~first_non_zero_bit_lsb;
+
+        /* Update tracking states */
+        parser->row += newline;
+        parser->col += -col * newline + comma;
+        
+        next_value_len += run_len;
+        
+        /* Advance structural state past the delimiter */
+        parser->remaining.start += run_len + 1;
+        parser->remaining.len -= run_len + 1;
+        parser->byte_pos = bit_pos + 1;
+
+        stop = true; /* Found our delimiter, time to return the token! */
+
+        /* If we consumed right up to the end of the buffer, reload next iteration */
+        if (parser->byte_pos >= 32)
+        {
+            if (parser->remaining.len > 0)
+            {
+                elk_csv_helper_load_new_buffer_aligned(parser, 0);
+            }
+        }
+    }
+
+    return (ElkCsvToken){ .row=row, .col=col, .value=(ElkStr){.start=token_start, .len=next_value_len}};
+
+ERR_RETURN:
+    parser->error = true;
+    return (ElkCsvToken){ .row=row, .col=col, .value=(ElkStr){.start=parser->remaining.start, .len=0}};
+}
+
+#else
+
+static inline ElkCsvToken 
+elk_csv_fast_next_token(ElkCsvParser *parser)
+{
+    return elk_csv_full_next_token(parser);
+}
+
+#endif
+
+static inline ElkStr 
+elk_csv_unquote_str(ElkStr str, ElkStr const buffer)
+{
+    /* remove any leading and trailing white space */
+    str = elk_str_strip(str);
+
+    if(str.len >= 2 && str.start[0] == '"')
+    {
+        /* Ok, now we've got a quoted non-empty string. */
+        int next_read = 1;
+        int next_write = 0;
+        size len = 0;
+
+        while(next_read < str.len && next_write < buffer.len)
+        {
+            if(str.start[next_read] == '"')
+            {
+                next_read++;
+                if(next_read >= str.len - 2) { break; }
+            }
+
+            buffer.start[next_write] = str.start[next_read];
+
+            len += 1;
+            next_read += 1;
+            next_write += 1;
+        }
+
+        return (ElkStr){ .start=buffer.start, .len=len};
+    }
+
+    return str;
+}
+
+static inline ElkStr 
+elk_csv_simple_unquote_str(ElkStr str)
+{
+    /* Handle string that isn't even quoted! */
+    if(str.len < 2 || str.start[0] != '"') { return str; }
+
+    return (ElkStr){ .start = str.start + 1, .len = str.len - 2};
+}
+
+static u64 const elk_random_keys[] = {
+    0xc8e4fd154ce32f6d, 0xfcbd6e154bf53ed9, 0xea6342c76bf95d47, 0xfb9e125878fa6cb3, 0xa1ed294ba7fe8b31,
+    0xcf29ba8dc5f1a98d, 0x815a7d4ed4e3b7f9, 0x163acbf213f5d867, 0x674e2d1542f9e6d3, 0xebc9672872ecf651,
+    0xec13a6976ecf14ad, 0x42c86e3a9de3542b, 0x5489de2cbce65297, 0x49bc37fdcad971f3, 0xd5b4213fe7db8f61,
+    0xbf785e3215ac7ebd, 0x46be329546e1ad3b, 0x8b7ef19654e3dca7, 0x1d7683c983d7eb15, 0x3724b1c872d9fa81,
+    0x2af73db87fab18ed, 0xa185f4cbadcf285b, 0x53d684c1fbd246c7, 0x35fda1821cd68735, 0xfd3791543bd985a1,
+    0x7f59c4b657cb941f, 0x19f3e5b765cea27b, 0xf6235eca95b2c1e7, 0x9d827c5ba2b3df45, 0x8a149e2dc2a6feb1,
+    0xa9234cbdcea91d2f, 0xab134cd21f9c2d8b, 0x65c48e132c9e3bf7, 0x7e943bd54dc26b75, 0x4b3a29d76ab579d1,
+    0xfa2871eba6b7984f, 0x4bd2596ed48c96ab, 0xa9463c1ed4aec629, 0x39a5fc81f3b1e495, 0x72f9c8a323a5e4f1,
+    0xb7cf8a2652b8136f, 0xb372ac465f8932db, 0x16dab9f87ead5149, 0xaf9ed4c87b8e4fa5, 0xbcae598dcba48e13,
+    0xd3bc94fed6948c7f, 0xbacd24f1f4768aeb, 0xfeca9382147acb59, 0xf4a18b53237ed9c5, 0xfa96251875a1f943,
+    0xb247ef5982a4179f, 0x695781dbaf98371d, 0x782ae64dce8b3579, 0xad5b918edb8c64e5, 0x4e98ac3feb9f8463,
+    0xd1bc48f21a7382bf, 0xa763b9e54986a13d, 0x9d3fe5643456bf89, 0x7acf9b287369bdf5, 0x7f4823ba926ced73,
+    0x5acef64ba3721bcf, 0x8af4673dcf752b4d, 0x2bc59ae1fe563ab9, 0xb639dc821e6b5a27, 0x71d692e32c5d6893,
+    0x8ec7d3f4394d76ef, 0x6cf18d298972a56d, 0xa1c698dba765b4d9, 0x527f618dc569d347, 0x167d892ed46ae2b3,
+    0x63547dbfe47df231, 0xf84de9565472318d, 0xa8e4dc232d543fe9, 0x89f56da76d384e57, 0x42ea36b87b496dc3,
+    0x17fd98ba9a5d8c41, 0x763f529cb63f7a9d, 0xe8794dcfe753c91b, 0xd7e4f9c1f534d987, 0x5fa74d621548d7e3,
+    0x783c12e6534bf761, 0xe7c435b8724e15bd, 0xc1258b6a9f61453b, 0xae842f6cbe2453a7, 0x176f8e4dcd498315,
+    0xc48512bfec4b9281, 0x8bd269cfe62a7fcd, 0x7fbe5932172f9e4b, 0x34fa7d954632cdb7, 0xad1b36598736ec25,
+    0xc471f3598437fb91, 0xfec831d9823a19fd, 0x58f9746baf1e296b, 0xeb6a512dce2148d7, 0x635c9b81fd137845,
+    0xe32f6dc43d2786b1, 0x924ec7a54b1a952f, 0x74af9cd6571da38b, 0x3bc5d689861eb2f7, 0xfb6da23cb823e175,
+    0xf8e53adba425efc1, 0x2cb1735dc4281e3f, 0x5fb2843dcdf82e9b, 0x7bc4f8632efc4d19, 0xe98fdcb32bef4c85,
+    0xa5d3fe465bf37ae1, 0xfdc145376ae4895f, 0xc847ae1985f697cb, 0xa4efd35ba5fbc739, 0xb296a73cb3fed6a5,
+    0x8b67ad3ed5e2f613, 0x9621b48323e5147f, 0xb31528e651f723eb, 0x9625bce76feb4259, 0xcbf97a287bed61c5,
+    0x453edc298ace7f23, 0xc9571deba9c27d8f, 0x9cad83fba6d48cfb, 0xed8a9471f4e7bc69, 0xa9184f6214e9cad5,
+    0xb128c47324cdea53, 0xaef846b764d218af, 0xdb4637fa91e5382d, 0xd31c5afbafd73689, 0x1eb6345a9dca46f5,
+    0xbd6ae9cfebcd8573, 0x412c9b8ed8ae73cf, 0xd69578b219c3a24d, 0xa951c32437d5c1b9, 0x98cd6a2545b8cf17,
+    0x5b4f19d764bade83, 0x8c5632f7628aebdf, 0x8e72d5cba3b12c5d, 0x814adfbedfa43bc9, 0xbca693f1fec85b37,
+    0x4ec597d21ecb69a3, 0x4cf172e54cbd8921, 0xd9a61e5438af967d, 0xc49b1f6767a2b5e9, 0x3948ec1ba8b6d457,
+    0xe62f3d8cb5a8e4c3, 0x7abf63ced5abf341, 0xe952ac31f3ae129d, 0x31a5fe6764c3521b, 0x5ce4b9632ea34f67,
+    0xdaeb23954c976ed3, 0x59e3a6b76c9a8d51, 0xba1ce5f6586c7bad, 0x6fb4127dc67f9a2b, 0x854c9d7fe582da97,
+    0x4dba59efe495d8f3, 0xfcd62e8324a9f871, 0xd6e219c5438a16cd, 0x149defb8719e264b, 0xae17f8b98f9154b7,
+    0x684723bcbea68425, 0xe48a276dcda78391, 0x1ae82cbdca6981fd, 0x18965dafe76c9f5b, 0x3c469bd2165faec7,
+    0xdec682154782ed35, 0x8ba1d3f76475fca1, 0x845d3b7a94782b1f, 0x6d2384ca916c2a7b, 0xc1643d7baf5d39e7,
+    0xa1b52d9ede817965, 0xa4ce23b1fd6487c1, 0x7cb8ea121c57963f, 0xab67dc132c58a49b, 0x92dc85b6586dc419,
+    0xb823691a976fd285, 0x6a92ef8ba674f2e1, 0x9637a8fdc487215f, 0xb2163cded1572fab, 0x4f9853dedf5b4e29,
+    0xda43f1721f3e4d95, 0x36d1afe54d527bf1, 0xd3948fb65c438a6f, 0xb58e16276a3598db, 0x368127acb73ac849,
+    0x1c8d6f9ba63cd7b5, 0xef43159dc65fe723, 0x52e6814fe463158f, 0xf5b76392135624fb, 0xb72f4ca8715a4369,
+    0x5a4eb7287f3b62d5, 0x51f23eca9d4e8153, 0xa8132fb98b317e9f, 0x12d5aebcba349e1d, 0xe51bc62fe825bd79,
+    0x257bf931f628cbe5, 0xea8c6f32172ceb63, 0x253e9b84342de8bf, 0xe8276ab98654293d, 0x81ef56dcb12537a9,
+    0x4a7512dcbf2a5817, 0xda21f43cbe1c7683, 0x25b814ecba1c74df, 0x9f57bd31fb21a35d, 0xf69b57243a14b2c9,
+    0x72985a365a28d137, 0x3b4987565618df93, 0x965c4b876419dcef, 0xd8e912fa942f1e6d, 0x93fd65bcb4123cd9,
+    0xa3b4f8ecbef35c47, 0xb53d64afedf76ab3, 0x64e752832dfb8a31, 0x8c51d4932afc978d, 0xbf78291437dea6f9,
+    0xc73ef4a989f2d567, 0xe94f2b6a97f6e5d3, 0x7e381b4cb6e9f451, 0xc1294afdc4fb13ad, 0xb2d59a7ed1fe432b,
+    0x2f3e9b8543f25197, 0xa275cfe32dc46fe3, 0xa7bf3e454cd78e61, 0xd32c479549e87cbd, 0x3e4c618767ed9c3b,
+    0xef721c3985dfcba7, 0x91c53afdc7d3ea15, 0x9564d27fe4d5f981, 0xae54192324c817ed, 0xa91d836543ec275b,
+    0xf89d53a761de35c7, 0x65e7fdca9fd18635, 0xb152fc7a9ed584a1, 0x41258d6babc7931f, 0x16d7358fe8d9a17b,
+    0x149cd2afe59bafd7, 0x6ec983a217afce45, 0x87dbfa4546a3fdb1, 0xd34cb25875b61c2f, 0x8e643a5763d72c8b,
+    0xe51d3a8981cb3af7, 0xef7cd63a9fbe4a75, 0x5a3b71fdceb278d1, 0x621db7cfecb3974f, 0x7a46ef521dc695ab,
+    0xbc56fea438bac529, 0xea42719547acd395, 0x67e5f1a8769ed3f1, 0x34d286eba7b4126f, 0x6958ebfdc4a631db,
+    0xbca4df2ed1b84f39, 0x527f43bedf8b4ea5, 0x71bfd9832f9e7d13, 0x1d93c2643d918b7f, 0xbfa4e9d54c7389eb,
+    0x7d8b63f54b86ca59, 0x4f6e782ba679d8c5, 0x8457b2fcb69ce843, 0x8f6e214cb37de59f, 0x2ad3ce71f5a4361d,
+    0xe13fb6c212b63479, 0xe69d8cf541a963e5, 0xeca145365f9c8263, 0x5b38a7165c6d71bf, 0xd6b218f98b719f2d,
+    0x1f2a8c4dca63be89, 0x625ac34ed876bcf5, 0x8c3ae571f569ec73, 0x1eb85642145ae9cf, 0x17d28394357f1a4d,
+    0xe296a417647238b9, 0x748a165cb1a65927, 0x1b39ad2cbf5a6793, 0xd6845eca9c4a75ef, 0xc812f9bdcb5e946d,
+    0xed853af1fa61b3d9, 0x8d7b5e621b85d247, 0xeb7683c54967e1b3, 0xa9cbd3765769ef21, 0x5ba817c9845b1f7d,
+    0xed8cbf19835f2de9, 0x97bec34dc1824d57, 0x34a96b8edf456bc3, 0x4a8579b1fe598b41, 0xa95c36821e3b789d,
+    0xa73f8c643c4ea81b, 0x5b147ef65b41d687, 0xb58dce798954d6e3, 0x928673bcb948f561, 0x231875bdc65914bd,
+    0x42eb7c9fe56d243b, 0xe8b4235fe15f42a7, 0xe2d34a5763748215, 0x1349e8b54e358f71, 0x172ecf354b267ecd,
+    0xebf638576c2a9d4b, 0x4bfe1587682eacb7, 0x17c6359dc941eb25, 0xd5b279aed734fa91, 0x86e754dfe53618fd,
+    0x6dbf4ce2153a286b, 0x3d5cfbe6542c36d7, 0x91e38d2a912f6745, 0xb571896a9f2385b1, 0x3296fe8bad16942f,
+    0xb1c85f6dcd17a28b, 0x14b9a53ed92ab1f7, 0x3126ab4fe81dcf65, 0xc741a9f54832fec1, 0x98d13b2768251d3f,
+    0xdc94561875162d9b, 0x12f58c69852a4c19, 0xea47632ba21d4b85, 0x31fa4be98cfd69e1, 0x7f6be13cbce1985f,
+    0xc472593feaf396cb, 0x13859f421bf7c639, 0x14fdeb5328f9d4a5, 0xacfe489768fce513, 0xd1453b2765cde27f,
+    0xe48c5b2a96f432eb, 0x426f3e7dc3f74159, 0x95864fadc1e84fb5, 0xba4f35edcfdb7e23, 0x649ecbf21ebd6c8f,
+    0x95d2c6a43cd18afb, 0x7bd928654ae3cb69, 0xba16ef7548e6c9d5, 0xceb74f2987dae953, 0x4e75bc3984cbe6af,
+    0x3abfe52cb5cf172d, 0x8976c2e1f4e23589, 0x3cd4851212d764f5, 0x3159ac4651ea8473, 0x46bea9f54eba72cf,
+    0x16ed2b976cbe914d, 0xcd91864768c1bfa9, 0x93f65e4ba9b4ce17, 0xcf7a269dc7b6ed83, 0xa84f7b9dc497eadf,
+    0xb7d6a5c326ac1b5d, 0x65318b9434bf2ac9, 0x4b8de76984d25a37, 0x29f785ca91d568a3, 0xcfda6b187fca9821,
+    0xd15728f98eab957d, 0xc36b18edcb8da4e9, 0x8c274961fab1d357, 0xc46ed93219a5e2c3, 0x3ef91b4659b8f241,
+    0x27c19f4656ba219d, 0x4f3e6a97648b2ef9, 0xd47f91ca92af3e67, 0x9d74518cb1a26cd3, 0xcb96374edfa68c51,
+    0xd625ea71fe8679ad, 0xf7596a821e7ca92b, 0x21bc7e932b6ec897, 0x7539fc465a91d7f3, 0xe8134af989a4f671,
+    0xe3c5a61ba69715cd, 0x98674bfed69a254b, 0x23c7e59fe29d43b7, 0xea78295fe1af7325, 0x759d31b653b48291,
+    0xbe794df32c647fed, 0xac5b31f43d679e5b, 0x4b376f154b59adc7, 0xaf758439897edc35, 0x365412adc872fba1,
+    0xf9b4178ed7852a1f, 0x6ade32c1f486297b, 0x1495acd2146a38e7, 0xc37f5a84329d4865, 0x3b7dec86528f76c1,
+    0x7f4523e98e72953f, 0xfbe517398e65a39b, 0x16d49f7cbd68c319, 0x14aec58fea6bd185, 0x9a6ed38fe75bcfd1,
+    0xafbe582439721e4f, 0x68c9bfe437642eab, 0x84ba2d5985674d29, 0xa235e6c9826a4c95, 0x392b87ca925c6af1,
+    0x2dc9f63bad3e796f, 0x6f9c347dce4297db, 0x48f5e9b1fd35c749, 0x9d183ef21c38d6b5, 0xeb62cd454a5be623,
+    0xcf294ab6574ce38f, 0xc546179a986123fb, 0x2fe9b81dc8754269, 0x2179538dc34861d5, 0x5c728f1ed15a7f43,
+    0x5b962e1dce2b6d9f, 0xd86bf4732e3f8c1d, 0x8d192fe54e32bc79, 0xc1be49d76b24cae5, 0xfde16a787b28ea63,
+    0x57abfe298629e7bf, 0xf14b63dcb74e183d, 0xb2561a4fe74136a9, 0x6bd2c3f1f8345617, 0x6d8ce49214297583,
+    0xaf71bdc6512973df, 0xb3d84a676f1c925d, 0x4cfe3b876d2fa1c9, 0x2e41bd3a9b13cf27, 0x8591d7ecba15de93,
+    0x45a67e2ba716dbef, 0x297f3d81f72a1c6d, 0xf5d2eba4361e2bd9, 0xfe59c83768215b47, 0x1dceb549851469b3,
+    0x54dae89cb4278931, 0x485fba165ef7968d, 0xb71c6f287ceba5f9, 0xa3bde92cbafec467, 0x1e6378fdc9f1e4d3,
+    0x9f726ab32ae6f351, 0x134bc26548f712ad, 0xb83941f767fa412b, 0x5892fab764ec3f87, 0x174f8a5982cf5de3,
+    0x6d3fa51cb2f38d61, 0x64b1f37a9fe47abd, 0x6e4f9721fde79a3b, 0x3d971a821debc9a7, 0x56f1ca943aced915,
+    0x98b3de765ad2f781, 0xa7f2b34878c416ed, 0xd86ac27ba7e8265b, 0xa38e647cb5ea34c7, 0xa1c89fedc2ed7435,
+    0xd3257a6fe2df73a1, 0xf3dc7a4653d4921f, 0x5b6df4232ec49f6b, 0xf7d823a43cb6aed7, 0x126358f769bacd45,
+    0xc916b437679decb1, 0xf2698d4ba8c31b2f, 0xa92168dfe6d42a8b, 0x65db129fe4c639f7, 0x3ec764f213db4975,
+    0x9ebf384543bc67d1, 0x1ecb839651be864f, 0x6b24d8c76fc294ab, 0x51847ae98eb6c429, 0xf8c3e6abacb8d295,
+    0x3a895ecdc89ad2f1, 0x79b84ecdc68bde5f, 0x2fe6b9d437912fcb, 0x4c961af327b54e39, 0x96f1e8d763b74da5,
+    0x1be75c4984ba7c13, 0x7db136c9819c6a7f, 0x8edc192a9d6f78eb, 0x8439ab2edea2c859, 0x47a2f691fb94d7c5,
+    0x9cd7b3121ca9e743, 0xcda1e5b3287ae49f, 0xd8ae3bc7689e251d, 0xa8dc174ba8b14379, 0x42fb76dcb7a462e5,
+    0x4a98165ed4b98163, 0x415fe36dc1786eaf, 0x5f2e79bdcf6b8e2d, 0xa81f75621e5fad89, 0x3267b9143d72cbf5,
+    0xf381cae54c85eb73, 0x3cd4fbe54956e8cf, 0xca6f2d1ba87b194d, 0xc4fa7e2dc56e27b9, 0x182bac9fe6a15827,
+    0xcfe4a831f2a47693, 0xe459b3d2128674ef, 0x7d84ca35417a936d, 0x1c4d38a54f5ca2d9, 0xf8b53a298d6fc147,
+    0x4b762d898b62dfa3, 0x6934fa2cba76fe21, 0x7183a2bdc9581e7d, 0xa39cf5d1f65a2ce9, 0xa3d8cef2186e3c57,
+    0xf9b1ca6545716ac3, 0xbf47ed2a93758a41, 0xdc4e672ba145879d, 0x4d35bfc98f49a71b, 0x46e59c8bae3dc587,
+    0x23de976cba4fc5e3, 0x5b6ec73feb73f461, 0xec814a632a5613bd, 0xb72d4f865a69423b, 0xbe569c47685c41a7,
+    0xebd41a59864c5ef3, 0x4b72fa3cb4528e71, 0xa54e732ba1437bcd, 0xfa5cb87edf269c4b, 0x5b49f731fe28cab7,
+    0x146e73d21e3cda25, 0xabe734f54b3fe891, 0xdc1243876a4317fd, 0x9c786bea9a35276b, 0x47a19b8cb82935d7,
+    0x9a5832ced82c7645, 0xa2d617ced53e74b1, 0x8acd631fe451932f, 0x139a2fe65234a18b, 0xbe5c1f943d15afe7,
+    0xc692b3a54d19ce65, 0x6f18e427692aedc1, 0x9be6d458781deb3f, 0x26435afed8132c9b, 0xcdbea26fe8264b19,
+    0xc5724b61f6194a85, 0xa36178b4352b68e1, 0x47aefcb5431d875f, 0xb467c9e8732195cb, 0xc2d637a87ef2c539,
+    0x2e8675d98cf6d3a5, 0xfe69283babf9e413, 0x31d278fcb8dae17f, 0x892e4bcdc7fd21eb, 0x2f6ab95328e13f49,
+    0xabc1589327f34eb5, 0x6ec1d4f765f87d23, 0x8a5432f652e96b8f, 0xd5c2ba6761ec79fb, 0x3b79da687edfba69,
+    0x83da746babe2c8d5, 0x5b97d621fbd6e853, 0x958d7c1219c7e5af, 0xf96c3ab549eb162d, 0x948db5f657de2489,
+    0xc7912e4a98d163f5, 0xb649183cb6e58273, 0xa71f893ba3d671cf, 0xe71894dcb1c98f3d, 0xd9f85b3edfbc8ea9,
+    0xfc17d2632eafbd17, 0xf9316b454db2ec83, 0x96acd32438a4e9df, 0xc9b263e769c81a5d, 0xd15b96c876db28c9,
+    0x31ba824cb6ce4937, 0x3a624defe5d167a3, 0x2d38ca41f4d59721, 0xab1f456212c6947d, 0x12dc49a541c8a3e9,
+    0x384eb9654fadc257, 0xc3b812f76b9fd1c3, 0x57a62e898ba4ef31, 0x687bd4acb9a51f8d, 0xcb26e94dc6a72df9,
+    0x8659dce1f5ab3d67, 0xa138db92169e5bd3, 0x19b6ad3546c28b51, 0xb573edf652b378ad, 0xf65721e871c6a82b,
+    0xf9be4d265f8ac697, 0x376eb2ca9d8bc6f3, 0x81fc2a3dcb9fe571, 0x3fac9261fa9314cd, 0x1d4ec5b21ca7234b,
+    0x9ba36d5438a942b7, 0x42fec1a768ac7125, 0x1d69a2e8749d6f81, 0x9584123a93817ced, 0xbe9f341dc1839d5b,
+    0x7ab1c24edf65abc7, 0x87deb251fe79db35, 0xec1b8d932d6ce9a1, 0xdab523743a6de81f, 0xba712cd65c93287b,
+    0x7fd3b6498a9536e7, 0x8bf932adc89a4765, 0x54ba38ced48b75c1, 0x41c685bdc27d843f, 0xe832f561f371a29b,
+    0xe68d31c54385c219, 0x2e1b9c432e46cf75, 0x6ea32cb54b58ced1, 0x1ed3c987695aec4f, 0xb2e63798785f1dab,
+    0x254fa8ceda734c29, 0x6c254e7fe8764b95, 0x7c56be9fe45869f1, 0x53d9f862134b786f, 0x28e17b54324e86db,
+    0x2cb4eda98271c649, 0x4d21b7a98f63d4b5, 0xfd5782ebad68e523, 0xf173ca6bab49e28f, 0xc58f37bed95c12fb,
+    0xc8e9342fea5f3169, 0xbd957f3219624fc5, 0x7e1b6c4329567e43, 0x2ba479e654376c9f, 0xa9ecbf18734a8b1d,
+    0x8752a6c9813eab79, 0xa6f2375baf31c9e5, 0x9284cafdcd24e963, 0xca7d3f6eda25e6bf, 0x2df87b432c4a173d,
+    0x1bd429354b3d25a9, 0xc8ebf5398a3f4517, 0x3762eb1cba527483, 0xe4c87f9ba63572df, 0xf2651c4dc438915d,
+    0xa5418fced12a8fb9, 0xce12a8bdcf1dbe27, 0x2b1cd7e54f21ed93, 0xdc4ab6854b13daef, 0x5ac942165c271b6d,
+    0x8a6523476b182ad9, 0x23af95bcb91d3a47, 0x5a179f4dc71f58b3, 0xbc356aefe7249831, 0xe4c73f21f314958d,
+    0x59c1ab632317a4f9, 0xc8435d26521bc367, 0x34cde9a65efbc2d3, 0xbe9376587bdfe251, 0x2b4c5d798bf421ad,
+    0x7c5f9a8ba9e63f1b, 0x876c49fdc6f93e87, 0x63c9adfed6fa5ce3, 0x4a12675325fe7c61, 0x627d581434f179bd,
+    0x923c54e762f4a93b, 0xe495861761f5c8a7, 0x27bd9af87fead815, 0xf283e7da9bdce681, 0x2df796ca98acf4ed,
+    0x34b6a7d1fae3245b, 0xbcd386f21ae643c7, 0x846f1ab549ea7235, 0x84ab327656ec72a1, 0x3ac254d653ab6efd,
+    0xbfce8a6983d19e6b, 0x4b7df9ea91e3acd7, 0x74563e9bafb7dc45, 0xf598bc41fdc8eab1, 0x6e78c5b21cabe92f,
+    0xacdb71943acf198b, 0xc8b2df565ac238f7, 0x2b9586ea9ad64875, 0xae6c3f2ba5c976d1, 0x1c4f298ba3cb854f,
+    0xcbaf837ed2ce83ab, 0xd5aeb9c1f4d1c329, 0x38c5d67432c4d195, 0xf9625be43d96cfe1, 0x6bf937143b98ed5f,
+    0x31d95286598a1ecb, 0xf536429878af2d39, 0xfa49dc1ed8b24ca5, 0x5ac273dfe8c67b13, 0x157e6cafe3b8697f,
+    0xa586df42139a87eb, 0x89c2ab5432aeb759, 0xbefd521872a1d6c5, 0x1bcf76d98fa5e643, 0x75bcef987c86e39f,
+    0x63d5412cbc9a241d, 0xb1789eafebad3279, 0x8496725ed89f41e5, 0xa6db4e8219a27f53, 0x87dc4eb325846daf,
+    0xefcd512654978c2d, 0x4ac2df36526bac89, 0x14257b89817dbaf5, 0xf1796becbf81ea73, 0xf35d6e4bab63e7cf,
+    0xcf76a531fc97184d, 0xe7b6cd421d7a26b9, 0xb82619d43b9d4627, 0xb3784a954a8f6593, 0xdc269b1a968273ef,
+    0x64a7921cb485926d, 0xc26e37fdc367a1d9, 0x7ba364fed16abf37, 0xa3be9f2cbf5dcea3, 0x4e3a82154e73fd21,
+    0x26cf39143e641c7d, 0xd71863b54c562be9, 0xd163c8a98c6a3b57, 0xa61548cba86d59c3, 0xf978265dc86f7941,
+    0x5e64137fe452869d, 0x8c5e4361f375a61b, 0xa6eb39c21259c487, 0x45b8c9f6516ac4e3, 0x7d21ba687f5de361,
+    0x1de4b3598e6312bd, 0x9ae675dbad76413b, 0x4cb5e79dcb463f97, 0x7b51af4dc8495df3, 0xd35a2e71f84c6d71,
+    0x9dbe5c32153f6acd, 0x27ebd5c436529a4b, 0xd2635c476234c9b7, 0x6f539e4ba148d925, 0x2156cd498f3be791,
+    0xa452f8e98a2be5fd, 0x4d3b8aefed41256b, 0x4576b8e1fb2534d7, 0x856d43f21c297345, 0x7adb9486594a73b1,
+    0xa62bc397674c812f, 0xb93fea57642e8f7b, 0x4c8b7d2a9432ade7, 0x1f5349acb124cd65, 0x1ef52a3baf27ebc1,
+    0x85f2d3aedc19ea3f, 0xe18c95d43d2e1a9b, 0x92ac6d476d324a19, 0xe2f1b3a87c134985, 0x7c3bd48a9a2867e1,
+    0xf632541cb71a865f, 0xc6d58e2ba51d84cb, 0xb3a9768ed51fb439, 0xfab95821f413d2a5, 0x824c5af76547e213,
+    0xfba94d832bc5de6f, 0xbd7ea8154ae81fdb, 0x1d9463c76afc2e49, 0x36792fc878ef3db5, 0xb8ae97fcb9f47c23,
+    0xaecb912dc5e46a8f, 0xf84cd67ed3e678fb, 0xa9fe457213fcb869, 0x9327cad432feb7d5, 0x3fa6cb8982f1e753,
+    0x9bfd64e76dc3e4af, 0x5f7836ba9ce8152d, 0x12f7954baceb2389, 0x8921f3acb9dc42f5, 0x9ae7542fe9df6173,
+    0xc54e9ad217c26ebf, 0x62f519a326c58e3d, 0x791d843543e68da9, 0xf2b6c5a763eabc17, 0xa75b64d871cedb83,
+    0xbefa16287ca1e8df, 0x274b56ecbec4195d, 0x345d97f1fbd627c9, 0x9eacbf321cdb4837, 0x265a479329cd56a3,
+    0x75db3c1659cf8621, 0x5be1d27986c2937d, 0x65fac8e984c5a2e9, 0xafd13becb3d9c157, 0xa42d1b9ed1a9cfb3,
+    0x6b814d7cbf9cde31, 0xd81efab43fa21e8d, 0x21796b343da42cf9, 0x6bdf7a154db83c67, 0xdf8ce14768b95ad3,
+    0xd4e2568a98bd7a51, 0xbe149facb49f67ad, 0x478d953fe5c3a72b, 0xc3e659f1f2b4c597, 0xc7a1f35212a8c5f3,
+    0xb43517c652abe471, 0xb19842f54e7bf2cd, 0x1528f6398ea1324b, 0xe2f964da9da541b7, 0x12659e3dcba86f15,
+    0xc46b5f9ed79a6e81, 0xa7cf8621f47a6bed, 0xe371cd62147f8c5b, 0x3c2185e43482bac7, 0xa7dbf5187296da35,
+    0x5e649c876297e8a1, 0xfd6538c98d6ae71f, 0x913d8a2bad8e167b, 0x9c4df58edc9135e7, 0x745bafc1fca37465,
+    0x629c4db32b9874c1, 0xb769d415497a823f, 0xdefab1c5456d819b, 0xf16492b7635d9ef7, 0xa86fd59ba382ce75,
+    0xdf38ca4ba275ecd1, 0x3e1284dbad57eb4f, 0xcd738461fe591cab, 0x681473f21d6e3b29, 0xc31e87a43d714a95,
+    0x39fbd1765b7468f1, 0x35978fba9a45876f, 0x1498635ba64985db, 0x479265edc36db549, 0xf2d19a8ed26fc3b5,
+    0xf58ec931f185e423, 0xc7adb2343265e18f, 0x4befda654e5821fb, 0xc5ad81376d4b2f59, 0xa34c69587a4d3ec5,
+    0x79ce531bab617d43, 0xa1ef728dc8436b9f, 0x57e8649fe7468a1d, 0xd37a5821f438ba79, 0x3daf9c82143cb8e5,
+    0x513a47c6524fd863, 0x542f36b87142e5bf, 0x15d876fa9f47163d, 0xdb32e69cbe3824a9, 0xa8dbfe5cbd3c5417,
+    0x8a6931dedb4e6283, 0xc3e869bfe94271df, 0x4e915ab219238f4d, 0xce2f176436258eb9, 0x9ef8c6376539bd27,
+    0x13e2fad8742bdc93, 0xea2bfd98712dc9ef, 0xd98e7f1cbf231a6d, 0xcbe718fdce1528d9, 0xaf2edcb1fd1a3947,
+    0xbf56ed732d1c57b3, 0x1739f4565b2e8731, 0x5a824b976a21948d, 0x3a86b1e98714a3f9, 0x43e6829cb518c267,
+    0xe86b145cb529c1d3, 0xba2fe87dc32bdf41, 0x28b451d98acbfe9d, 0x7439b6a54df23e1b, 0x2e86f1d32cf43d87,
+    0x739fa6c54af75be3, 0x2c94f5b659fa7b61, 0x7b5126c875fc68bd, 0x1235f46ba5ef983b, 0x78a4bf2ed4f2c6a7,
+    0xb54da2efe3f6d715, 0x9bf612d323f9e581, 0xbe2f1a4541c9f3ed, 0x4ad281576fde135b, 0xe274c8f98de142c7,
+    0x8ac9561bace67135, 0x3df21eacbad76f91, 0x827354fba5b86cfd, 0x953da461f4ec8d6b, 0x61e59fb214cf9bd7,
+    0x3e97162436e2db45, 0x6459c3b763d5e9b1, 0x39ca152761c7e82f, 0x129d5eb76fdc178b, 0x168dcbfa9cbd26f7,
+    0x978ca23fecd14675, 0x28c579e1fac475d1, 0xf493ba521ac7834f, 0xf57312a436d982ab, 0x319854f656cdb129,
+    0x219d6ab763aebf85, 0x4e1ac8d984a3cde1, 0x613d8cfa91a4ec5f, 0xdf82a9ebaf971dcb, 0x5436f9e1feab2c39,
+    0xf5d4c1621d9e3ba5, 0x5ad7e3c65dc27a13, 0xadfc63454ab3687f, 0x1d4bfa9547a586eb, 0x3c4a5f1984cab659,
+    0xd23a1ecba39db4c5, 0xa6195b4dc2afd543, 0x2b41538ed1a3e29f, 0x19cba58654b7231d, 0x26ac7b154fba3179,
+    0xed86af954c8a3fd5, 0xa7f219687b9d6e53, 0x3c91f74879816caf, 0xf59b641dc7948b2d, 0x489257efe475ab89,
+    0xa21dc83fe378b9f5, 0xca46fbe2148cd973, 0xa9cd61e4327ed6cf, 0x76e1ab3982a3174d, 0xc67dfea87f8625b9,
+    0x3bd6e97cbe9a4527, 0x89a5d7bcbd8c6493, 0x65498f7cb97c62ef, 0xa2e37451fa82916d, 0x85174b6217638fc9,
+    0x75cabd932586be37, 0xf73b1ac65468cda3, 0x2c1784f9847bec21, 0x4fb57c89815efa7d, 0xa28351dcbf632ae9,
+    0x1af84c9ede863a57, 0x5b89cd41fd6958c3, 0x6ed257a32d6c7841, 0x67c49d132a4e759d, 0x81ab6f376972a51b,
+    0x6e1c24aba964c387, 0x8ae2396ba567c2e3, 0x768f12bdc47ae261, 0x58fde69cb149efad, 0x5a632b7dcd5e1f2b,
+    0x81d7c5421f523e97, 0xec9865232d465cf3, 0xfc819a765d496c71, 0xb597f8c6583a69cd, 0x95184c7ba73e894b,
+    0x5924a61ed641c8b7, 0x4de7a1bfe764d825, 0x2e5d9fa1f347e691, 0x75e93b421238e4fd, 0xa93f2ec8725d146b,
+    0x432bd5e76e4f23d7, 0x9a58246bae637245, 0x7af82dcbad4672b1, 0xe6f8349cba387e1f, 0x2df5a38ed62a8e7b,
+    0x58d7a2f1f52d9ce7, 0x8b5c9af32831dc65, 0xa728db365634eac1, 0x9165af287426e93f, 0xf13b6dc8723a189b,
+    0x8c1f2a4baf2d3819, 0xfed692bcbd1f3785, 0x25b7a13edc2376e1, 0x97b1a63feb16845f, 0x29e7d8432a1783cb,
+    0x9be23f16581cb239, 0xa349bef7672ec1a5, 0x467fdae98632cef1, 0x57c41fda9413ed6f, 0xf73da52ba3261edb,
+    0xda678f9cbef82d49, 0x7c9b82efedfa3cb5, 0x68f3c7521cfe6b23, 0xef2c9b543be1698f, 0x8fe63a9549e387fb,
+    0x8efabc9548f5b769, 0x5cd6f42984f9b6d5, 0x58f2ac9ba4fcd653, 0x193f56da92ced3af, 0x17e8b32fe3f5142d,
+    0xc27f683541f63289, 0x12b538f43ed941f5, 0xb21ca8454cdb5f63, 0x623dfe1548ac5dbf, 0x1fc9eda879e18c3d,
+    0x94e1dfacb6e38ca9, 0x4963dcaed5e6cb17, 0x92a8dbe1f4e9da83, 0xc681b3e213bac7df, 0xe3927ac432bef75d,
+    0x9b5fd27871e326c9, 0xd13b2e6a9fd84637, 0xdce2a5898ed965a3, 0x8493d71babdc8521, 0xe3b92fcdc9be827d,
+    0xe3b2ac51f7c2a1e9, 0x9be745f218c3bf47, 0x6b4ac5e325a6ceb3, 0x4f36e2b765b9ed31, 0x21de3986529afb8d,
+    0xda96efb872ae1bf9, 0xc81ea73bafc23b67, 0xf17bac6dceb659d3, 0x5e29d4c1fdca7951, 0x7c5b6a321c9b76ad,
+    0x3a2cf91438ae962b, 0x1a295fb658b1c497, 0x2ed3857987a5c4f3, 0x836e975ba5b8e371, 0x3d478e9ba398f1cd,
+    0x31a65e8fe3ad214b, 0x2f8ec75dcd8e2fa7, 0x162587932fa36e15, 0xc6918fe43ea56d81, 0xd27fc3b43b876aed,
+    0x6fa41925497c8a5b, 0xb8753ca9856ea9c7, 0x94baf17dc7a1d935, 0xcd478fbed594e7a1, 0x67bca52ed397e61f,
+    0x581eadf3239a157b, 0x1ecfb956519c24e7, 0xc2f765387e9f4365, 0x148dab598e9473c1, 0x912d8e7bac96813f,
+    0x42731eadca567f8b, 0x59f64b8dc65a9df7, 0xdfb8ea51f46ebd75, 0x31ac79e43672ebd1, 0x8742fea32573ea4f,
+    0xafcb5316537619ab, 0xe5dcab49817b3a29, 0x75269dfbaf6d3895, 0x31926acbac6e57f1, 0xfd1b52aedc72856f,
+    0x2da9b8e1fa6584db, 0xcbf817621c68b349, 0x367cb894386ac2b5, 0xa614dbe7687ed123, 0xa46b3fe98451de7f,
+    0x2864b97a93641feb, 0x72af9e5dc1672e59, 0xf69da78cbf493dc5, 0x8aeb3d51fe5d6c43, 0xde9cbfa21c3e5a9f,
+    0x9a2d6b454c53891d, 0xef98db765c34b879, 0x148e2da76938b7e5, 0x94fde15ba84bd763, 0xc27d413a953cd4bf,
+    0x53b6cadfe672153d, 0xfe28b591f16523a9, 0xbc192ed542695317, 0x35cbef965f4b6183, 0x2a8e9b354b2a5ecf,
+    0x34eba2f76a2f7e4d, 0x2cf974687a328db9, 0x51c973fed935bc27, 0x7c42a3bfe627db93, 0x67dc291ed429c8ef,
+    0xa75b18e2142cf86d, 0x3ca84fb7654127d9, 0xdf895ceba1253847, 0x3bf7629a9f1856b3, 0x71c4d98bae2b8631,
+    0x3612d47bab1c738d, 0x29cb1f6dca1e82f9, 0xca462df1fa23c167, 0x64e718b32815bfc3, 0xd78293b65728de41,
+    0xb82a71c65418fc9d, 0xfeb385d9853e2d1b, 0xa13f874cb4213c87, 0x2d94785a9df25ae3, 0x4efc812dcdf57a61,
+    0xa35d91bfeaf867bd, 0x14cf3a621afc973b, 0x5b97c6f328feb5a7, 0x791c2bd879f2d615, 0xf893b16a97f5e481,
+    0xae37bd6984c6f2ed, 0x19c36a5dc4fa125b, 0xed3f47acb2fd31c7, 0x3a81652cbdce4f25, 0x7ac12f532fd36e91,
+    0x4bfd96232ac46bfd, 0xc6d395e43ae78c6b, 0xc2e1d68546eb9ad7, 0x13ecaf6987deca45, 0x698d321ba6d2e8b1,
+    0x685d3f7cb5c4e72f, 0x2d5e69c1f3e7168b, 0xec6ba98213da25f7, 0x1528b4e761ed3475, 0xed3f5b465ebf64d1,
+    0x1abdf6987dc3824f, 0x47d51fb87cd581ab, 0xd718f95cb8c7af19, 0x9d43156ed6cabe85, 0x48af92b1f59dbce1,
+    0xd5bf2e7326a1eb5f, 0xae52bc7435d41acb, 0x29cd648764d72b39, 0xe7543f2871db39a5, 0x3abcdf698fbd6913,
+    0x8537dfca9cae567f, 0xd58fbc4edca285eb, 0xcdf5e761fac6b459, 0xcb1485e219a8b3c5, 0x3fdcb59658abd243,
+    0xf2136ea5458cd19f, 0xdfe2856a97b4321d, 0x49dcfeaba3b42f69, 0x396be21cb1a73ed5, 0xb19c287dcf9a6d53,
+    0x5dce63afed7c5baf, 0x9f8d53121c8f7a2d, 0x6bd852a43d72ba89, 0xbcd897143a94b8f5, 0x759d342656a9d873,
+    0xd2b85fe98479d5cf, 0x936ea41ba38cf54d, 0xdac4b85fe5a124b9, 0x3cfeb5d1f1b65427, 0x92e68ba541b86293,
+    0xeb726ad43d7961ef, 0x6e8dac243c6b7f5d, 0xd491ec354a5f7ec9, 0x5df9c3ba9a82bd37, 0x9f4e8a2cb875dca3,
+    0x1fa2547ed678eb21, 0xba316ecfe35af97d, 0xb6129d83246d18e9, 0x54cb391764a13957, 0x8b6173d9819457c3,
+    0x4c12938baf698741, 0xca56e3298e5a749d, 0x823a1d6bac6d941b, 0xc6af481eda5fb287, 0xad6f3721f974c1e3,
+    0xe4285a632976df51, 0xf785cb432546fead, 0xf1e7b248756a1e2b, 0x1b82e749835e2d97, 0x7ed8c26ba2715bf3,
+    0x1846a7bdcf546b71, 0x967524ecbe3568cd, 0x28d34ac1fd3a984b, 0x51a93fb21c3da6b7, 0xba2163843a4fc725,
+    0xfdeb54787a63e591, 0x78fe3dc98745e3fd, 0xea6c4f2dc759136b, 0x8c6e529dc45b32d7, 0xcd6794bed27e6145,
+    0xfb97386ede426fa1, 0x14d75e832e347d1f, 0x1a3cd6943e258d7b, 0x428ac6354c289be7, 0x1a762948792dcb65,
+    0x3cb8de29873fd9c1, 0x8a459fdcb742e83f, 0xc8524bdfe635179b, 0x8a6ed731f54a3719, 0xcfb79ed2142c3685,
+    0xabe2cd78723d65e1, 0x9ced3a187e21835f, 0xc79632a87e1482cb, 0xa5d6c71bad27b139, 0xc1f5e67dca18bf95,
+    0xea3986bdc72abdf1, 0x4b8a19dcb51edc6f, 0xafd1347547231cdb, 0x394dfc8657162c49, 0xecd76ba874183ab5,
+    0xe7f5864a941c6a23, 0x4f3d98c76dec578f, 0x81d5c4398ade76fb, 0xd7145f3edcf2b569, 0x1ac8269fe9f6b4d5,
+    0xe3cb65d21af9d453, 0xf72bd31436e9d2af, 0x7d3ab2c656ecf12d, 0x2d51c96ba6f23189, 0x56c1f2da92d43fe5,
+    0xb456deacb1f85e63, 0x2d3c574a9ed85cbf, 0x57bed341faec7b3d, 0xf1bcd4521cdf7ba9, 0xf9e4a6d54be3ca17,
+    0x813b92e54ae5d983, 0x169e38f545b7c6df, 0x12dc685984caf65d, 0x982573aba4de15c9, 0x6948c25ed6e14537,
+    0x6425d3c1f1e564a3, 0xa15fe3b653e98421, 0x92fe78543fca817d, 0x96eb73c43cab7fd9, 0xe87f591659bfae47,
+    0x4963c51878a2cdb3, 0xa69ed12ba8b6ec31, 0x6b42198dc4b6fa8d, 0x9a825b4fe4cb1af9, 0x3f7d854214ce2a67,
+    0x893c614764c158d3, 0x2614d9ca92d47851, 0x741d6ba54fb675ad, 0x54fa36d87eca952b, 0xe2d315f98cadb397,
+    0x9c257badc89eb2f3, 0xba593671f9b4e271, 0x8d16eb321684efbd, 0x4a7b361546a81f3b, 0xbe2459a6549b2ea7,
+    0xb836de1983ae4d15, 0x728419cba3b26c81, 0xa8721d9baf8369ed, 0xc65d7f8edea6895b, 0x259eb4a1fd69a8c7,
+    0x4ab76dc21b9dc835, 0x25f689c4398fd6a1, 0x8562b1a76893e51f, 0x921ec73a98a6147b, 0x4138e65cb5a923e7,
+    0x69148dbed3ac4265, 0x8ba2175ed39e62c1, 0x65e72fbdcd817e2f, 0x97b35f421f637e8b, 0x21ce58a32d659cf7,
+    0xc793afe43d69bc75, 0xde98f3b6586bcad1, 0xb63a1459876ed94f, 0x31749cfed67318ab, 0x6537adcfe5a63829,
+    0x3584ba21f28a3795, 0x8a5791c3238b56f1, 0x258dc974318d746f, 0x4129bf565f6183db, 0x6b854ed98e75b249,
+    0x82967f4a9d67c1b5, 0xdb2896ecba69cf13, 0xbe92d17cb64acd7f, 0x27fdc8aba54dfceb, 0x8b97c1d218732d59,
+    0x5924bdc324763bc5, 0x5d76bf8982796b43, 0xf5e92678714b589f, 0xe17dbf3a9f4e781d, 0x8b9ca7edce41b679,
+    0x687342aedc43b6e5, 0x7f65a281fb48d563, 0x15dcb9a21948d3bf, 0xdf432ca5485bf23d, 0xd491e8f7675f12a9,
+    0x8a973f5cb9845217, 0xd59fb41cb2465f73, 0x9f43c5eba1375dcf, 0x7ae3854cbf2a7c4d, 0x5b96da71fd2e7cb9,
+    0x3f791c543e41cb27, 0xceb842165c24da93, 0x71c4f9b54925c7ef, 0x24c5f1965829f76d, 0x3e2648aba73c16d9,
+    0xb8f5491dc83f2647, 0xd6be4c5fe74265b3, 0x36e54fa1f2478531, 0x493fc6754139728d, 0x136b29854e2b81f9,
+    0x2148cde54c1daf57, 0x6c43fd287a21bec3, 0xe84c7bda9a25ed41, 0xa543ed6ba715fb9d, 0x65a9374fe7392c1b,
+    0x4e7ca8b1f51d2b87, 0xdc72ba53261f49e3, 0xb342e1c985237961, 0xf16248e9821476bd, 0x81b74af65ef7963b,
+    0x5eb432876df9b4a7, 0xf842b7ea9afdc415, 0x721f346cb9efd381, 0xed95a23cb7c3f1ed, 0x26dc159439f7215b,
+    0x97e23ab435e82fb7, 0xd312a5c876fb4e25, 0xe6351ca873fe5d91, 0xdb4fc13982e16afd, 0xf4853e1a9fe38a6b,
+    0x7253b16cbce5a9d7, 0x4dc6e981fbeac945, 0xd51e92f329ecd7b1, 0xb7e865d438bed62f, 0x4c2a938769e3158b,
+    0xc7d2654a98d624f7, 0xf163745cb6ea4375, 0x75e69c4ba4eb63d1, 0x73b298dcb2cd714f, 0x9f7d2b4edec17f9b,
+    0x54b9e8d32fc4ae19, 0x5f287da32ec6bd85, 0x4763b8f549a8cbe1, 0x24bec695479bda5f, 0xb8dae357659ef8cb,
+    0xfcab649dc7d42a39, 0x1b68e95fe4d638a5, 0xbe43da51f4da6813, 0x4a83c19212cb657f, 0xfd8e672431ad74eb,
+    0xe6abc1376fc1b359, 0x453fea187ea4b2c5, 0xe145d96a9cb8d143, 0xef57c8aba697ce8f, 0xe5c9a26ba579edfb,
+    0xb147f6aed5af1e69, 0x3186475217a23cd5, 0xa9b156f324b76c53, 0x6cfa93e542b759af, 0xe2b53f6761ab792d,
+    0x18b47c965f6ea789, 0x6a5c4efbad91b7f5, 0x214ceb7feca4d673, 0xb82539efe986d4cf, 0x1c395a621a89f34d,
+    0x836cadb5478d13b9, 0x83fac6d768af4327, 0xc6ea1d4ba7b46193, 0x72c84bfa92845edf, 0xda2641ecb1987e5d,
+    0xf38157bcbf5a7dc9, 0xeb27d6f1fd6eac37, 0x82ce17a32e71dba3, 0x98a764d54c85ea21, 0xbf892a743a65f87d,
+    0xc1ea85f6586a17e9, 0xfd23e7bcb69d2857, 0x35eab1fcb58f46c3, 0x7189adefe5a38641, 0xca432951f185739d,
+    0x24eb31854278931b, 0xfb3c87943f5cb187, 0xc4f321854b5cafd3, 0x1a5b7de98b72de51, 0xb79fde587853fcad,
+    0xe36cf2adc9671d2b, 0x513b864fe65a2c97, 0x64cedb1fe56c4af3, 0xdc5162e3246f5a71, 0x3bd769e5435267cd,
+    0x6f4d28e98165974b, 0x84eba1f76f38a5b7, 0xc61f7b2a9e4bc625, 0xfd24695bab5ed491, 0xdb94f5acb951e2fd,
+    0x39f2cbe1fa75126b, 0x1fbe85a32a5831d7, 0x6b45d813286a4f35, 0x9c6ef738764c5ea1, 0x72eac819834e6c1f,
+    0xd218796ba1428c7b, 0x51248eacbf249ae7, 0x7fad243ede28ca65, 0xef489b21fb3ad8c1, 0xda849e521a2cd73f,
+    0x27afbce65c42169b, 0xd734b6598b453619, 0x68be5d1cba293485, 0x8269753cb73a64e1, 0x7f24816cb43c725f,
+    0x841fdb6ed23f71cb, 0x76f1c3dede13af29, 0xd79a5f132f14be95, 0xf68b7ed54d27bcf1, 0xac32fe954a19db6f,
+    0x7429fa16571cf9db, 0x1f39c42dca312b49, 0x4175fbded81439b5, 0x8e1c6a4fe7186923, 0x1b7ce43fe31a568f,
+    0x46587b93231c75fb, 0x4a315b76521fa469, 0x6b2319576ef1b3d5, 0x321e75898cf6d253, 0xf947dac879e6d1af,
+    0xcfb6834a97c8ef1d, 0x1a78d49cb6ec1f79, 0x87e2539cb6cf2de5, 0xbdc7934218f25d63, 0xbcfd2a1323e45abf,
+    0x91ca84f652f87a3d, 0x14eb973651fc78a9, 0x5ac1fde76fdeb917, 0xc9d8a35bace1d783, 0xac1fd53ba9b3c5df,
+    0xb3ed24afe9c7f45d, 0x72f519b328ea14c9, 0x3e52819659ed2437, 0x986e5c3767df52a3, 0xe954186ba7e58321,
+    0xb9674e3a92c47f6d, 0x7f6832cba1c67ed9, 0xcf6735ba9fcbad47, 0x56efa391fd9eacb3, 0x293bd1454dc2eb31,
+    0x2cf9d8532ab3f98d, 0x6e91c7d54ac618f9, 0xe5da329658db2967, 0x785dcfba96bc47d3, 0x69db1a2cb4cf6751,
+    0x37bd51efe3c274ad, 0x67ae3bd1f1d6942b, 0x81a95f6431d8b297, 0xbfed21754e9ab1f3, 0xd123b8e54b9dcf61,
+    0xca4278965981febd, 0x36df5c2989a51e3b, 0xf64c152dc8b62da7, 0xde86b5afe7ba4c15, 0x8f2574e1f4ad5b81,
+    0xa687fc32139f58ed, 0x3bc7ed6543c2985b, 0x8217e39651b4a6c7, 0x38eabf476fa9c735, 0x2b7d9c387e8bd5a1,
+    0x8dc3175a9a8cd41f, 0x4e2d593feca2137b, 0xd692eab1f9a532e7, 0x5ef276432ab94165, 0x19c5623436895fb1,
+    0x24b9f816548b6d2f, 0x1f2c3986527f6d8b, 0x8fc1562ba1829bf7, 0xed321cabaf84cb75, 0x65ed783cbe67c9d1,
+    0x6c3a5bdfeb6ad84f, 0xce19fda2195df6ab, 0x3d4e81a65ca13729, 0x657cf3187ba43695, 0x2c8163fba79865f1,
+    0x5b4f2d6cb48a736f, 0x1fd6793ba36c72db, 0x35a4cd9ed27fa149, 0xa6fb1d2ede62bfa5, 0x412ef6732f76ce13,
+    0x4ba12f832b46dc7f, 0xe5f9d8743948faeb, 0x914cbf787a6e1c59, 0xf3eb482cb9713ac5, 0x974d65ced9856a43,
+    0x4b386a1ed346579f, 0xa3e69c51f35a871d, 0x5c6871e2124da579, 0x96bed7a4316fa4e5, 0x1ade74c98f72d463,
+    0x2476ec587c45d2bf, 0x85e7d61a9b58f13d, 0x2b7f9a8edb5c21a9, 0xea68b47cb84c2ef5, 0xa7453df1f9615e73,
+    0xc3b97d5217435bcf, 0x27c6195325367b4d, 0xe89235d652387ab9, 0xc52f34e9814dba27, 0x5123dc787e2fc893,
+    0x12eb6c9a9b32c6ef, 0xe32ba8fdcb24f56d, 0xa36c75d1fb3815d9, 0xf6abc5721b3c2547, 0xbad39417692e54b3,
+    0xe29fb87a9a628431, 0x639a584ba634718d, 0x216d4a9ba3257fe9, 0x71a3b85dc129ae57, 0x4c3e6bfa9f1badc3,
+    0x76891aefeb2fdc41, 0x835617243c12fa9d, 0xf51a47e65d362a1b, 0x8a79fc465c192a87, 0xd246f318791b48e3,
+    0x92baef8cb92e5861, 0xf34127cdc62175bd, 0x9acd621fe614953b, 0x8f6a3471f216b3a7, 0x9d483bc7642ac315,
+    0x3d26f8454efbd281, 0x369fcd7438eabfcd, 0xe79f54c87ae21f4b, 0x57cf2d4989f42eb7, 0x623af75cb9f84d25,
+    0xf7dc132ed6fa5c91, 0xf2e6194dc3eb59fd, 0xde3ba17213ef796b, 0xa7c1348543f2a8d7, 0xcb1ae43871f6c845,
+    0x7b2da8965fe8d6b1, 0xc91ef5387bcad52f, 0xdb65239879cdf38b, 0x7c9381bdcad123f7, 0xf49dac81fae64275,
+    0xf3168d2439e862d1, 0xd5cfe81325c96e3f, 0xdba379c543dc6e9b, 0xed6c1a4763cf8d19, 0x2d3145ca91e2bc85,
+    0xe34c62a98fb5cae1, 0x7164a98bacb7d95f, 0xadb8249fe8a9f7cb, 0x9e546d732bce1839, 0xdf8276954bd137a5,
+    0xef1584798ad56713, 0x2c63584a95c8647f, 0xcb5a4f8984c973eb, 0xe92a7f8cb3cda259, 0xfd5c483ed2bfa1c5,
+    0x57a4693edea4cf23, 0xa3fd75121e94cd8f, 0xe48f9c632a86ecfb, 0xec498b654cab1d69, 0xdf3b8627689e2bd5,
+    0x7e4d5acba9c16b53, 0x8491b3adc6b358af, 0x1cdae84fe4b6782d, 0x278fcb91f2cba689, 0x41fc5a92129ca6f5,
+    0x3cb8196541afc573, 0xd145f7b65e82d3cf, 0x67b439187c96f24d, 0xf924d7c87da812b9, 0xdbcf684edbac4127,
+    0x31f5cb7dc79d4f83, 0x4b9182cfe6815cdf, 0xb1e34cd216937c5d, 0xb7a284e323857bc9, 0x7ba4ed865289ab37,
+    0xe43962a7617dc9a3, 0xb2ae14398e7fd921, 0x187e3f4bac82f67d, 0x1958c6bedc8516e9, 0x5d7c4f61fc9a2657,
+    0x3dfa1ce21a8b45c3, 0x1efb6ad43a9e7541, 0x7d4baf865681729d, 0x98e1a76ba685921b, 0x871e96acb285af67,
+    0x68721b5cb168aed3, 0x29861c4baf6bcd51, 0xf379ceadc94febad, 0x357efc943e741c2b, 0x62fdb5c43d652b97,
+    0x8c32e5165b6849f3, 0xb8ef7c398a6c5971, 0xf45968da974e56cd, 0xfc46a98ed571964b, 0x3524c67fe263a4b7,
+    0xc9fa5321f178c425, 0xc392a615426ad391, 0x32d86e143e4ac1fd, 0x67fa49354a3def5b, 0xde75c4698b532fc7,
+    0x91c6d75bab674e35, 0xea82cf3dc9485da1, 0x2367dc5ed74a6b1f, 0x6487e5b1f43e6a7b, 0xad7549f32541a9e7,
+    0x2be61f387243c965, 0x472afb898246d7c1, 0xf4cba3587e29d63f, 0x59a23bc87d2cf49b, 0xfb97e5acbc4f2519,
+    0xc4d5e16fec624385, 0x4fc652b1fa4763e1, 0xeb2146c32a39715f, 0x91e7f83435296fab, 0x6bf8e517653d8e29,
+    0x4e85cb698431bd95, 0x8dc9264a9234cbf1, 0x67fbd18a9e15da6f, 0xed93f54bac17f8db, 0xa95384b1fc2d1a49,
+    0x72ea68d43c1f28b5, 0xf17b46287c146823, 0x243c9ba87a14658f, 0x9b7254ea961874fb, 0x7e658b1cb51ca369,
+    0x93847edcb41ea2d5, 0xad968b7fe642d153, 0xd14a29ebabd2ce9f, 0x14b9efd32bc5fe1d, 0xe8b13fc43cf81e79,
+    0xc48af72549fa2ce5, 0x45aef12879fe4c63, 0x31a8d25987e159bf, 0x48279fdcb6f4793d, 0x16d284ced3f587a9,
+    0x13de674fe3fab817, 0xc6f7b4a212fdc683, 0xd1298fc431ceb4df, 0xeb62a4d76ec2f35d, 0x1fedb9687de613c9,
+    0xf741528a9cea4237, 0x8415f7ecb9ec51a3, 0xf194de6a96ab4def, 0x9cbe7f51f5c17e6d, 0x74bfae9215e37cd9,
+    0xdb7c45a323e6ac47, 0x734fc51652e8cab3, 0x931dfc2872ecda31, 0x1f4d79a65cafe78d, 0x2516874badc317f9,
+    0x9bce685fecd52867, 0x96a3bc21fac946d3, 0x276ca8f32adc7651, 0x786f195327be63ad, 0xe64dbf2767d1932b,
+    0x416f3e7985d4b197, 0x24df316982b6afe3, 0x6542d38ba2b9ce61, 0x8671ad598f79ecbd, 0xa2f519ceda8efc3b,
+    0x6efca8b21eb32ca7, 0x1962b3a43dc74b15, 0xcadb64854bc95a81, 0xcf37ed95469a57ed, 0xcb183f2a94ae875b,
+    0x897c2a6ed4b1a5c7, 0x95d174afe2b4c635, 0xda638c91f2b7d4a1, 0xb382e1f542a9d31f, 0xc7e3f5a43e8cf17b,
+    0x3aec8b965c9f21e7, 0x8e31f4b98ca23f45, 0xa65f42198a965eb1, 0x5f1d4e7cb7986c2f, 0x9ad7213fe47a6c8b,
+    0x234de86fe36d8af7, 0xe84dc1b32491ca75, 0x38547b165394c8d1, 0x9eab78c65196d74f, 0xa9ecb7f54e68f5ab,
+    0x5fd7421bae8d1629, 0x38615e4cbc8f2495, 0x986c75dedb9364f1, 0x34bea86fea95726f, 0x865afb43296871db,
+    0xbec8d513256b8f39, 0xfd6e1945436d9ea5, 0x198dc63a9582cd13, 0x3ef5764a9163db7f, 0x2d3ea4698d45f9eb,
+    0xc79a235ede6a1b59, 0xcf23ba41fb6d29c5, 0x136bda721c7f5943, 0xe98d3a743b72569f, 0x3dea48954a75861d,
+    0xe4268adcb658a479, 0x8fd5e1ba946ba3e5, 0xb61548ecb47ec263, 0x372b85adc362d1bf, 0xdab4e57cbc54ef2d,
+    0xe9158f732e461f89, 0xf8d765e43c492df5, 0x1a98d6276b5c4d73, 0xb521ea97683e4acf, 0x5f19ebacb9527a4d,
+    0xf54acd6ed63478b9, 0xad16be8fe548b927, 0xf56a8b71f24bc793, 0xe5c381d2123cb5ef, 0xb91e47d87251f46d,
+    0x2c1b5ef87f3514d9, 0x913c548bae592347, 0x3974cd8a9d4a52b3, 0xe7c652bdcb5d7231, 0x14af8d2cb82e5f7d,
+    0x68ab5e71f6327de9, 0x36da1e821824ad57, 0x789dc3454527abc3, 0xf372da48753adb41, 0x28daf457612ce89d,
+    0xec21fd9baf43291b, 0x7893be4dce142987, 0xaf9283cedc1847e3, 0xaf975eb1fc2b5761, 0xfca89bd3291c64bd,
+    0x4587b236591f843b, 0x4cd8baf76813b2a7, 0xa9fc654ba837c215, 0x8c3df94ba428cf71, 0xb2753f9a9218becd,
+    0xe1a38dc98ceafd4b, 0xfe56ba1dcaef1db7, 0x7413a9621df34c25, 0xcf168b343cf65b91, 0x3decaf2439e758fd,
+    0x37adc6f545fc786b, 0xdce8a13984fe96d7, 0x28e67d4cb6f1c745, 0x26583b9dc3f4d5b1, 0x21f857edc1e7d42f,
+    0x81db293431e9f28b, 0x39e7c4f54edc12f7, 0xab6cf3e76cdf3175, 0x5a1f9d487ad35fc1, 0x135c672989c56d3f,
+    0x7d4568fba5e76d9b, 0x94c1d72ed5eb8c19, 0xeb3f9c81f3deab85, 0xf5ec283435d2c9e1, 0x7e463ac542c3d85f,
+    0xef82dab541d5f6cb, 0xcfb9ea276fdb1739, 0x7fd25b398ecd26a5, 0x4a6d3efbabcf5613, 0xa814c9bedac2637f,
+    0x7dbcf361f8c572eb, 0x4be76c1327d8a159, 0x2cfa674324ca9fb5, 0x938fcb4765adbe23, 0x69bf482763a1dc8f,
+    0xf5a7d1687193eafb, 0xed849a3bafb71c69, 0x74631c9dceb92ad5, 0x3a6b87e1fcbd4a53, 0xe375dc421b9e47af,
+    0xdf894cb54ab3872d, 0x9531a78437c4a589, 0x9463c25876b8a4f5, 0xd14c867a95abc473, 0xedc2135a938db2cf,
+    0x5c17964dc3a2f14d, 0x24c63befefa521b9, 0xab4215d32ea83f17, 0x1ec9d7532d9a4e83, 0xd21ef3a4397a4bdf,
+    0xd32be1c5498f6b5d, 0xba81d96cb6827ac9, 0x7954d8ced695ba37, 0xc15a673fe497c8a3, 0xb2a9f371f49bd821,
+    0x36be4a92128ce57d, 0x12c6d5a763a215e9, 0x1b25c8398fa62457, 0x45e1cd687e9854c3, 0x4f35d61bad9b7341,
+    0x4d27febcba7c619d, 0xb7f648ecb75d6ef9, 0xe9d674b1f582ae67, 0xb4fe68921675acd3, 0x31bd9ce43478dc51,
+    0x32ce76f54258e9ad, 0xce2f7568716df92b, 0xef67bd9cbf612a97, 0xab72965cbd7548f3, 0xe91b2c5fed695871,
+    0x283794f1fa4965cd, 0x38157b621a6d854b, 0x7c2498e3285f93b7, 0xb7524e187984c325, 0xf491cedba576d291,
+    0x18bea4f98246bfed, 0x4a1f652ba149fe5b, 0x1a6425fbaf4d1ec7, 0xc534dea1fe714d35, 0x5feb64232e645ca1,
+    0xad86cb243c476a1f, 0x7e8632a54c3a697b, 0xd2c3e8f6563c98e7, 0x7c92ea8ba73fb865, 0xd75962fcb753d6c1,
+    0x38e2469dc246d53f, 0x15c47defe147f39b, 0xcd1f3b86536c2419, 0xdb3491576f4e3285, 0xdc65a3198d5362e1,
+    0x35b172e98b236e4f, 0x1b6dac7989256eab, 0x38becf5dc73a8d29, 0xca21843fe62dac95, 0x8f47a3ded53ebaf1,
+    0x73fbc5421532d96f, 0xac72e1565324f7db, 0x9e5c34a8723a1849, 0x1628a7c98f1c27b5, 0x6d1753ebad1e5723,
+    0xb429351cbc21648f, 0xa7526bdeda1473fb, 0xb2a5d641fb17a269, 0xdf76e9243829a1d5, 0xb278d3e6571cbf43,
+    0xe97a4fc6541ebd9f, 0x2e46a5c98523fc1d, 0x9d65a23cb3251d79, 0xd8e21f6a9df72be5, 0x21c87f9dcdfa4b63,
+    0xf583ca7ed9ec48bf, 0x18c9fd521aef683d, 0x2695d7f43bf286a9, 0x6fdc12e549f5b617, 0x2c49f13876f9c583,
+    0x176e24b874e9b3df, 0xf4de891a93fce25d, 0xd8c6951ed4f312c9, 0x1d935afedfe64137, 0xa63145f21ed74f93,
+    0xc916ba532ab84cef, 0xefba7d6439eb5c6d, 0x81bf6ca547cf6bd9, 0xf8ed4b2a98e2ab47, 0x73d69aeba6e5c9b3,
+    0x8e2c47adc5e8d931, 0xf6dc2481f2cae68d, 0x495de3c212bce5f9, 0x37ca2fd983e12567, 0x9b6ef2c87fc645d3,
+    0x4ce6ba798ed97451, 0x16fbc2d87bc962ad, 0xe418c67ba9cd812b, 0x425eb7cdc5be9f87, 0x73b2e461f6b2ade3,
+    0x7d26a51327b5cd61, 0xc5e2a9832396eabd, 0xc7529bd652c9fa3b, 0xc18f9d4762ce1ba7, 0x378e265a9fc24a15,
+    0x4692b1dcbec45981, 0xc86243fdcba756ed, 0x6ac589b1f9ca865b, 0x59ec431218ad94c7, 0x2ef56dc328afb435,
+    0x48a15fd767b4d3a1, 0x476e381985a6d21f, 0x46fe1ca98297ef6b, 0xdb751eacb29a1fd7, 0x32b91d6cbf9d2e45,
+    0xc7a34861fe925db1, 0x67dbe3821d946b2f, 0xba15fc232d956a8b, 0x8c7e32a43b6a89f7, 0x19234ef5468db975,
+    0x9cf7653a958fb7d1, 0x6b7493acb592d64f, 0x198fabced285f4ab, 0x3a95cf21f3ba1529, 0xaed4c3f541ac2395,
+    0x8cf6da354e8d53f1, 0x7512edf65d92716f, 0x3541bef65a736fcb, 0xc627581bab768e39, 0x4936bc5dc7689da5,
+    0x84eb1c2fe67dbc13, 0xf4618d3ed35eca7f, 0x3ad498521462f8eb, 0xf9168b3543861a59, 0x642195b7617928c5,
+    0xbde2814a9f7c5843, 0x1cd568f98c6d459f, 0x5ba7149cbc72851d, 0xa6e9b54fec64a379, 0x95ca47e1f967a2e5,
+    0xbe1569d3297ac163, 0x2f1d4b632549beaf, 0x4569f8b7645fce2d, 0x496ef38ba4631e89, 0xc234e57ba1762cf5,
+    0x8b563d4cbf594c73, 0x3f1d687cbd3a49cf, 0xac4d7531fb3e694d, 0x15afcd832d4187b9, 0x689ca5f43c54b827,
+    0x9178a4f65a47c693, 0xbaf425987638b4ef, 0xc8b245ea954be36d, 0xf724186ba34ef2d9, 0x139a2bcfe1853247,
+    0x5891d74fef4751b3, 0xdf3b81543e496f21, 0x6c7bd8343c2a5e7d, 0xd9a6fb354a2d6ce9, 0xc56d8f398b31ac57,
+    0x295438ea9824bac3, 0x16f9875dc837da41, 0x7923ef4dc428e79d, 0x349ad7bfe43cf71b, 0xb7dac5e3243f1687,
+    0xf861ca79815246e3, 0xb6e1479a9f287561, 0xb6cf3e487e1863bd, 0x8d2e63ba9d1c823b, 0x8641e3adcb2e91a7,
+    0xf914eb5dc821aef3, 0xd8349ba1f824ce71, 0x9d21b4532615ebcd, 0xb7f931843518fc4b, 0x48961df7642d1cb7,
+    0xdb3c29fa941f3b25, 0x5cda7e698ef25a91, 0x438d951a9be357fd, 0x5db3f18edcf5876b, 0x7a56891fe8fa95d7,
+    0xae16578219fdb645, 0xd79ba85437efc4b1, 0x6a3b14c767e4d32f, 0xc63a759874e5f18b, 0x18d9fc5ba4e921f7,
+    0x4da19c6ba1eb2f65, 0x3e8bc65a9fbd4ec1, 0x7154ac3febd16c3f, 0xafdbc1421de36c9b, 0x916d25743ce68b19,
+    0x2a5f6c3437e9ba85, 0x1d8ec59656dcb8e1, 0xf7bc26d984bec75f, 0x7621c8ba94d2f5cb, 0x5d3148fed4e71639,
+    0x423df7b1f1e924a5, 0xd342c7e542ec6513, 0x9e2756d43ebd527f, 0xd5439b765dc271eb, 0xea4916376bc38f49,
+    0xf1ae643878c69eb5, 0x752f19cba7c9bd23, 0xf9312c5ed49acb8f, 0xf2684bedc38ed9fb, 0x5ac1def325d31b69,
+    0xfdb37c2543c629d5, 0x9feb367871da4953, 0xea379b865e9b46af, 0xba4213798cae762d, 0x2a57148cbdc1a489,
+    0xf47cad8ed9b4a3f5, 0xbf54ca91f9b8c273, 0x1f64b9d32698b1cf, 0xd584bca3258acf3d, 0x3b64e295437dfea9,
+    0xf5bc427a95b43e17, 0xae724d6ba1b64d83, 0x83d26b1a9e874adf, 0x78bef39dce8b6a5d, 0x28e3b6a1fb7e68c9,
+    0xb5fa2e932da1b937, 0x47fc98a32b94c7a3, 0x3f5e8b1659a8d721, 0x5f1326d76589e47d, 0x6fbe8519847bf3e9,
+    0x8215aefdc4af1357, 0xab79246fe1a452c3, 0x37a2961fefa87241, 0x16ad7ce21e675f8d, 0x59c6b4d32c5a6df9,
+    0xda6fe9843b5e9d67, 0xe6fbc3176971abd3, 0x12fc537ba984db51, 0xade2584cb465e8ad, 0xda4bc81ed469f82b,
+    0x3c5d4921f36d1897, 0xd38b76f2148e27f3, 0x1a3de87982a35671, 0xf35bae243f7564cd, 0xb62a9de87e69834b,
+    0x3dafc2898d5c92b7, 0xb23c685dca7eb125, 0x65f74dced962cf81, 0x64c82eb1f653bced, 0xdf49b8a21746fd5b,
+    0xdaf3927434591dc7, 0x5783af49847d2c35, 0xf8cbd639826f4ba1, 0x41f3682bae53691f, 0x7c4652edce34687b,
+    0x245f798edc3896e7, 0xa6748ef1fa3cb765, 0xc268ebd3294eb5c1, 0xac98db465961d43f, 0xc61a95d76754f29b,
+    0xde67abfcb7682319, 0xbe3827fdc46b3185, 0x2dc4a17ba25b4fd1, 0xd1f29c6bac2e5d4f, 0x65d723e1fe326dab,
+    0x1e47acd21e358c29, 0x8691b2e43d27ab95, 0x8b7ef1d6583ab9f1, 0x7de5a8b6572dc86f, 0x25e63f4a9731f6db,
+    0x5972fc1ed8351749, 0x8bc15a6fe43826b5, 0x6ab72e51f14b5623, 0xfba946c5412c538f, 0xf26d9be54d1e62fb,
+    0xb7f653987e23a169, 0x527ea1687b149fc5, 0x7c5ed61a9a18be43, 0x5d41c96ba618bc9f, 0xe2ac746ba62ceb1d,
+    0xf4a827c1f6321c79, 0xb69e25a437142ae5, 0x6cd7b21875184a63, 0x4b28df37621947bf, 0x3bde41965efb673d,
+    0x13fe9ca76cfe75a9, 0x52f6e3dbacf2b517, 0x183d27bedaf5c483, 0xa5f1934dc7e6b2df, 0x214879f327f9e15d,
+    0x5127fae324daefb9, 0x3e8946a765de1f27, 0x64d23e1985f24e93, 0xec2587f981d54bef, 0x95f61c7a9fe85b6d,
+    0x5c8f7b398ceb6ad9, 0x452f3961fbde9a47, 0xea7cb1932ae1c8b3, 0xfc267e954ae5d831, 0x1893fae437c6e58d,
+    0x6e283b4765c8e4f9, 0x3dae564ba5ed1467, 0x4c2786dba5cf24d3, 0xd1c6395ed2e47351, 0xe9dc2a7fefc561ad,
+    0x27fba6832ec87f1b, 0x8ca9f5432dcb9e87, 0x72fc68d548ad9ce3, 0xf4de7b3879b2dc61, 0x4fb7a65876a3e9bd,
+    0x7235c8dba5c6f93b, 0x3c9bd7efe4db19a7, 0x3f65c921f4cd3915, 0x5764d91323cf4781, 0x4a7f1bd541b265ed,
+    0x52fd86743fc6845b, 0x23a8be465eb893c7, 0x6fd73e498dacb235, 0xe684bd5cb89ec2a1, 0xc84f39eba681befd,
+    0xb967384ed593fe6b, 0xa19f42b325a61ed7, 0xd725c1a436ba2d45, 0x4eafdb97639d4cb1, 0xbd645198719e5a2f,
+    0xf7d69ca87fa2698b, 0x8743d95cbda498f7, 0xa2bd541feda9b875, 0xf783e2d1f98ab6d1, 0x97be3d52198dc54f,
+    0x6ab139c54781f3ab, 0x2f3ced6878b61429, 0xa4cfd81ba6b83295, 0xe163fbdcb49a52f1, 0x2ca14deba18b4e5f,
+    0x345967da9d6f5ecb, 0xb6d7e9c1fe728d39, 0x47dca8921e749ca5, 0xde1924754d78cb13, 0x38b6f7a4385ac97f,
+    0xd2c83ab5465cd7eb, 0x45ef632dc7a21859, 0x19f3dabed69427c5, 0x293be8cfe2a95743, 0xd76591bfe17a549f,
+    0x2df95784328c741d, 0x792af8143e5f8279, 0x532e68a76d73a1e5, 0xceb784f98c76bf53, 0x695713d87846bdaf,
+    0x1fe47d3ba759ec2d, 0x38a7b25cb54dfc89, 0x2ae8c19fe6712bf5, 0x31d698c216854b73, 0xae21d984325648cf,
+    0x741e26f8715a684d, 0x573feb465f3d76b9, 0xc84b52da9d4fa627, 0x2d937bacbd62c593, 0xab8c527dc945b3ef,
+    0xf962a381f948e26d, 0xa175c8e3274af1d9, 0x7f91b546596e2147, 0x25f3aeb987614fa3, 0x628aed9ba4756e21,
+    0xf846319ba1365c7d, 0xf53d7e6baf286be9, 0xbce1265dce2d9b57, 0xe491c67feb2fa9c3, 0x5e7b91632c53d941,
+    0x612c5de43a24e69d, 0x253db4765938f61b, 0xd7395caba93c1587, 0x5f16c39ba74d25e3, 0x37582cded8527461,
+    0x739158dfe13462bd, 0x95a267bfef27813b, 0xaebd97f32e1a8f97, 0xdb13f8654c1b9df3, 0x7915bad65a2fbd71,
+    0xa2bd98e76812eacd, 0x78b461ca9815fa4b, 0x86f495bed6281ab7, 0x6a9b41efe71c3a25, 0xd2c8fa31f52e4891,
+    0xf923e7c4342156fd, 0x4f35be287213856b, 0x9fa7db643ef594d7, 0xa46ebc987df9b345, 0xe43d1a2879fac3b1,
+    0x32c6eb9a98edc12f, 0xed47915ba6d1ef7b, 0x2819e54dc6d41fe7, 0x93f846c217f82e65, 0x9d5b8c7435f94dc1,
+    0xb62da59762ec5b3f, 0xb6cf3ed761ef5a9b, 0x913c4fd87fe38a19, 0x85924cfbade4b985, 0xc9a5b21dcad8b7e1,
+    0x4bd8e52fe8dac65f, 0x7cb83f4217ade4cb, 0xe4f821d76ae21539, 0x23f1db9878e623a5, 0x68fdc59ba7e96413,
+    0x92e3867a93da517f, 0x2ba34ef981ca5fdb, 0x95f43a2badbf7e49, 0x2e4adf31fec29db5, 0x1f8bc7421ed6bc23,
+    0x4187acd329b6ca8f, 0x8ba2397436a9d8fb, 0xfe47d63545bdf869, 0xf1a2c4dba7c128d5, 0x8ac13b7dc7d64853,
+    0x164a5b7ed2c745af, 0xcbe946f1f1ca752d, 0xde98b76321cd7389, 0x7f8651943dae92f5, 0xebd614a76eb4c173,
+    0x714cae965984aebf, 0x95ab6f376897ce3d, 0xb6d98f7cb578fda9, 0x146ebf9dc6ae2d17, 0xa79d46c1f6b14c83,
+    0x85b74a9215a349df, 0x38c6bf7432b7695d, 0xbf4c1ae541ba67c9, 0x498f15b65f9da837, 0x72319e587d8fb6a3,
+    0x6a84132cbca4d621, 0xc7b14e3dca95e37d, 0x5d478b1ed687f2e9, 0x6bf8e91439ac1257, 0xfa75ce96579e41c3,
+    0x4a2186f987a26f31, 0x413ba76872935e8d, 0xd571a49ba1856cf9, 0x27863b1cbf5a9c67, 0xd7e9b3fcbe6c9ad3,
+    0x7eb15c9feb7fca51, 0xfd58eb321b62e7ad, 0x67b3f2143a85f72b, 0x21cf9ea54b8a1697, 0xfed46c1a978b26f3,
+    0xbe49287cb69e4571, 0x6872ba5cb48163cd, 0x4ed5c82fe195824b, 0x98b42eafef5691b7, 0x1a26f4b32e69af15,
+    0x1afd3b743d5cbe81, 0x7e1a6324384fabed, 0x6b94a3287962fc5b, 0xc1479d8ba9651bc7, 0xa54f37ced8792b35,
+    0x214c63bfe56c49a1, 0xd7a5496fe36d581f, 0xbe14c5732351867b, 0x824c6ad5416395e7, 0xba4c31987f38b465,
+    0xd9eba4687e59b4c1, 0x86ef52b98a5bc23f, 0x752c61eba84fe19b, 0x7d58293feb753219, 0x726e839fe9462f75,
+    0x2cb8aef327584ed1, 0x82b59dc3263a5c4f, 0x269d4b17623e5cab, 0x2d984c1ba3518b29, 0xe561db898f23ba95,
+    0x852cd7abad36b8f1, 0xb6a4d28edb29c76f, 0x63f82d71f82ae5db, 0x7adc14821a2ef549, 0xc31d96f87a6324b5,
+    0x9bd7f6ea9a486523, 0xa97621fba639528f, 0xdc18937a943a61fb, 0xfb37d62cb12d7f59, 0x4fd78e3cbf219ec5,
+    0x5637cb81fe15bd43, 0xb7ec81a32d15cb9f, 0x491386e54b28ea1d, 0x3a2ed165481cfa79, 0x9624f158782f19e5,
+    0xc5ea1f3dca124963, 0x2f8651cdc71546bf, 0x95a67c8fe419763d, 0xc29ea6b1f21c74a9, 0x74913e56532ea417,
+    0x718e9a454defb283, 0x4c7da9865ae3b1df, 0xd1ecb38769e5cf4d, 0xc37de14657d6feb9, 0x1e846c7ba8fb1e27,
+    0x17493b6cb6fe2d93, 0xf723418dc5d14aef, 0x1d6a857214f35a6d, 0xa7bc8e6432f568d9, 0xcb24d19651fba947,
+    0xe5829fb65feda7b3, 0x427a6de98bdfc731, 0x78ce5f9a9ac2e48d, 0x1b7e3d2cb8c5e3f9, 0x49ec76b1f9ea1367,
+    0x1b49f5d218eb42d3, 0x9ce8db6548de6251, 0xb2c6d89764c15f9d, 0xc12d734983d47e1b, 0xc2d8f4aba1e59d87,
+    0xdcf654987fc89be3, 0xfd793b6a9eadcb61, 0x195476dfe79fc8bd, 0xd8cbf7421ac2f83b, 0xb639a1d43bd518a7,
+    0x5bca4e8769da3815, 0xb3752d6a97dc4681, 0x35febc1983ac54ed, 0x7c246f1dc4d1835b, 0x96b5c14fe1d492c7,
+    0x9285761fefc8b135, 0x749f8b232ea8bf91, 0x87dbfe432b79acfd, 0x3c9da8b4398fed6b, 0xbde1943769a31cd7,
+    0x6497ef1ba9b72c45, 0x72f86cbed6c84ab1, 0x7d68c3bed4ab592f, 0x638ad421f2ae578b, 0x17869a5323b196f7,
+    0x17b238a541c3b675, 0xf62931754f97b5d1, 0x3d26ae976d89c34f, 0x6b32a1e7697ce2ab, 0xd1e9f45cba8ef129,
+    0x86d4721feab43195, 0x1bf72c6ed7964fe1, 0x36159f8216984d5f, 0x98c5d27323795dcb, 0x3f8c9526528e7c39,
+    0x953726a872819ba5, 0x12f7cdba9f85ca13, 0xa415792bad65c87f, 0x7163c94dca58d6eb, 0x386cb9dfea7cf659,
+    0x21a7be832a8f16c5, 0x9ca2bdf87ba25643, 0xf1382ca54786539f, 0xe726415ba589731d, 0x46b8139cb36c8179,
+    0x654af3dba16c8fd5, 0x5e796fadcf71be53, 0xc3e15a4fed53bcaf, 0x7c48b3621c56eb2d, 0x5c9b1a632c47fb89,
+    0xac4b27f5496c1af5, 0x4eac3589896f2a73, 0x3587ce4ba86247cf, 0xb15fa38dc385674d, 0xa729851fe24875b9,
+    0x9ca57261f16ca527, 0xe6975ba3216eb493, 0xbe6cf1d54d51b2ef, 0x96f431287c54e16d, 0x92b8f1c76a35efc9,
+    0x13b6d94a9b5a1f37, 0x8154d23cb85c2ea3, 0x29534cfdc86f5d21, 0x6739d4e1f6425b7d, 0xc45de76215346ae9,
+    0xd438fb1542389a57, 0xed63b197614ba8c3, 0xef17d6487f3ec841, 0xb685ca398c31e59d, 0x5281acebac34f51b,
+    0xc76e89bfec391487, 0xb7286591f95a24e3, 0x15d72ce32a4d5361, 0x637cae25473f51bd, 0xe13fd42986437f2b,
+    0x26387daba3248e97, 0x249e5c1ba1279cf3, 0x638d24ca9f2abc71, 0xc7d524698a1eb9cd, 0x8c2947bfec21f94b,
+    0x9812fc343d2419b7, 0xde281f576c183925, 0x364c5bf76a2b4791, 0x6ac17f89871b45fd, 0x1ca5963ba51f746b,
+    0x8c351b9dc51293d7, 0x9cb74defe317b245, 0x7c9fa51edef7c2b1, 0x42f1db832cd8be1f, 0xf8a1c49329fade7b,
+    0x2fe8cb3438bdfce7, 0x13df7c898af32d65, 0x4c6eb5da98f64bc1, 0x5e913dacb6e85a3f, 0xa894c1fed3fc589b,
+    0xb35a49fed3fe7819, 0xeba2c68323f1b785, 0x25af9c3652f4b6e1, 0x7c2369843ed7c45f, 0x48d72ea65ad8e3cb,
+    0x92b4ecf87adcf239, 0x38b46fecb9df12a5, 0x8419ba5edae56213, 0xbd25af1ed7c54e6f, 0xf91b458214c75edb,
+    0x427cefa323eb7d49, 0x461dc23542de8cb5, 0x4c5b8ed984e1cb23, 0x4c15f6d76eb3c98f, 0xd6af3bc98ca5d7fb,
+    0x5bd7861edbcaf769, 0xdf672c81f9bc17d5, 0xc76a9f521acf2753, 0x327dcab438c254af, 0x2a43e91658c6742d,
+    0xac5e12f764da7289, 0xea712c5983cb91f5, 0x9743dc5a91bdaf63, 0xe2fc8b6a9e81adbf, 0xbce54fa1fb94ec3d,
+    0xbead36721d85fca9, 0xacfd42b54dba2c17, 0xfb49153659ad2b83, 0xf5cb8d26569e38df, 0xf1a8369ba7b2685d,
+    0x52c6b18ed3b476c9, 0xc451263fe2c9a637, 0x6c98ae51f19cb5a3, 0xf3a1c49543aec521, 0x7a1fdc654f91e27d,
+    0xabc817365c84f1e9, 0xf587e2398db92157, 0x2d6b7ca87a892fb3, 0x2f13894cb89c5e31, 0x28ad7f3cb57f4c8d,
+    0x3edb148fe4826bf9, 0x8edb53a213a49b67, 0x6f9cdea54287a9d3, 0x6af9c187628bc951, 0x48bd9ef54f5ec6ad,
+    0x2c1dbf3a9d81f62b, 0xf23e87cdcda41597, 0xf3d124aedb9825f3, 0xb35a97d1fa9b5471, 0xbc3e19a2187b52cd,
+    0x876fa3e4368f714b, 0x31f8aed654628fa7, 0x5e8df76a9386ae15, 0x1c34a8dba267bd81, 0x1543ba287f48baed,
+    0xe32c47ba9c4dea5b, 0x79e6c241fd621ac7, 0x1634ed921d862a35, 0x3bfd95843c6748a1, 0x3bec6285496a571f,
+    0xe1d2b54a984d657b, 0x693daceba35f84e7, 0x57fd6b4ed482b365, 0xcd9ae71fe276b3c1, 0xa1b8365ede58c13f,
+    0x5d6a1b821e39df8b, 0xc976f1a32a3bedf7, 0x248deb398c612e75, 0x7a8e4b598a654cd1, 0x329165eba9375b4f,
+    0x3d6781ced63859ab, 0x8c97ae6fe54d7a29, 0x6e5329cfe23fa895, 0x1d9f68732453b7f1, 0xec194bd87134c56f,
+    0xe2b95fd65f27e4db, 0x6db31ac87d2bf349, 0x74f9d61a9c4e13b5, 0x4876912edc716423, 0xcb2a847eda34518f,
+    0xa645d21ed7265feb, 0x7d81c5e2162a7e59, 0xbd92c6e4342b8dc5, 0x4f79c168752fac43, 0xa3f62c987132ca9f,
+    0xf6ad71598f25e91d, 0x5dfa62ecbd16f879, 0x3acfb48edc2b18e5, 0x6b798ca1fb1e2863, 0xc3d9eb643a2145bf,
+    0xf4b158676a14753d, 0xd4bc79e6581673a9, 0xb2d3847a962ba317, 0xd48729cba52db183, 0x7a843169821d9ecf,
+    0xf139c57a9bf1ce4d, 0x458f317dcae3fdb9, 0x651b29743cf81d27, 0xd42fc6854bfa2c93, 0x6834912547db39ef,
+    0x1edfc94657ef496d, 0x35f2edcba5f267d9, 0x17b6c8fdc3f5a847, 0x261d8fbed2f8a6b3, 0x439b7e6fe2fbc631,
+    0x1967524321fec38d, 0xefab74954dc1e2f9, 0xe5bcd8798de51267, 0x57c21fb87be841d3, 0xdf2cb67989da5f41,
+    0x78c53df986cb4e9d, 0x6ea1f35ba5cf6d1b, 0xb5e2d4c1f4e29c87, 0xa416c5e214d59ae3, 0xf68741a543e8ca61,
+    0xc7fd82b541e9c7bd, 0xdeb214765fade73b, 0xf7cb8d3a9ed216a7, 0x15b497fcbcd63715, 0x6c48a31febd94581,
+    0x4b37df81f7b953ed, 0xda85614218cd725b, 0xcde8ab6435bf81c7, 0xdc5f246876c3af25, 0x29f7dce873c5be91,
+    0xc9d1b4a87196abfd, 0x469ea1d87f89ec6b, 0xb246f38a9b8cfad7, 0x2e4a9581fdc12b45, 0x872b1a532dc549b1,
+    0x56cd3b143ab7582f, 0x23cf56b437ca568b, 0xc19236a764ac85f7, 0xf289317a93bfa475, 0x8c3f249dc5a3b4d1,
+    0xa854c76ed1a6c24f, 0x56a9b34edf87e1ab, 0xf741e6a32d7aef19, 0x8e12b9c43c9d1f85, 0x12d5caf76b924de1,
+    0xeca5fd287a934c5f, 0x1e8fd4ba97865acb, 0x9b8df4aed58a7b39, 0xac31d5efe37d89a5, 0x1edba92fe48fb913,
+    0x781d6af21392c67f, 0xacfe59143184d5eb, 0x1c2fea843e78f459, 0x594d72c87e8b14c5, 0xa2365efbac9e2543,
+    0x74cb562dcb81529f, 0x87e3b6afea95721d, 0x491d5ebfe4857f69, 0x497e516214698ed5, 0x1a6d2fc3247cad53,
+    0xb124dc65425e9baf, 0x5f21bc398173ea2d, 0x5b3a6e187e54fa89, 0xa1be362cbd6819f5, 0x72b8d93fed6c2973,
+    0x6578cdefe95d36cf, 0xd18796c32b81764d, 0x61aed9c32a6374b9, 0x9c3eb8265968a427, 0xfa382459856ab293,
+    0x68feb2a9835ba1ef, 0xb61d5f3a914ebf5d, 0x1fc82edbad42fec9, 0xf7e48cb1fd561e37, 0x4a61d9521e582da3,
+    0x2a37e6b54d6b5c21, 0x1a92c3b6593e4a7d, 0x2fea69387a4168e9, 0x4a6829bdc843a957, 0x7ad638ced546a7c3,
+    0x2bca917fe35ac741, 0x7b6cf4a1f13bc49d, 0x1a82e934325fe41b, 0xc25e93d76f541387, 0x1d2465f98d5742e3,
+    0x236cbe5a9d4a5261, 0x32da495878294fad, 0x8d4a2c9ba83d6e2b, 0x537ba4cfe6318d97, 0x1cb4928fe6249bf3,
+    0xd8a795232536cb71, 0x1a82b9654327b8cd, 0x5a21f9c7612ce84b, 0xe1485c965d1ef6b7, 0x36b4927cbe143825,
+    0x78b61c2dcd274691, 0x685fa79dca1854fd, 0x6734dcb1f91c736b, 0x657a1f94391e82d7, 0x1295c4d87932b145,
+    0xf4d239587624bfa1, 0xc13db7898426bd1f, 0x1784c6da9218ed7b, 0x691bec876cd9fbe7, 0x9c2de37babfe1c65,
+    0x163eca8febf24ac1, 0x58d93ce21be4593f, 0xad61fe432af6579b, 0xce9d781546fb8719, 0x2193f7c874fda685,
+    0x1bf86ce984dfa5e1, 0x415cf29ba4e2c35f, 0xa147589ba1f5e2cb, 0xf719e6bdced8f139, 0x9a5ed6c43fec21a5,
+    0xd61e74a54abc3ef1, 0x9e1ad2765ac14d6f, 0xce953a4768e35cdb, 0xa1f36e9ba8e67c49, 0x6378e5cdc4e98ab5,
+    0xf598b1adc5edba23, 0x564fabced2ceb78f, 0xef5b7da213c2d6fb, 0x158ce7d431d4f569, 0x6df193a54fc916d5,
+    0x428f3ac98edc2653, 0xc7ab362879bd43af, 0x9fb8137cbac1732d, 0x6b58e43fead47189, 0xb47126fed4b68fe5,
+    0xf3569a4215c9ae63, 0xa54df673238a9cbf, 0xd3a7c526529fcb3d, 0xea9bd53761c2fba9, 0x861349ea9fc62b17,
+    0x4a85df6cbec92a83, 0x79bc235dcb9a37df, 0xa862cf31f9ae475d, 0xa64d28932ab175c9, 0xc9742d6329c4a537,
+    0x4bd52e1656c7b4a3, 0x1f3285b986bac421, 0xc5f3d149839bc17d, 0x8d213459817ecfd9, 0x5a16f34dcea31f47,
+    0xb4e9a6c1fd962eb3, 0x9145afb32ea95d31, 0x9e4a26132c7a4b8d, 0xbd617c34387d5af9, 0xeb54d87658b19a67,
+    0xd4eb19acb694a8d3, 0xc36821ded4a7c851, 0x68cd1b9fe278c5ad, 0x6c9f3a81f18ce52b, 0x29a74f53218ef397,
+    0xbd84f2376e9524f3, 0x9d5c84376ea85371, 0xca861e276b7851cd, 0x5a8de4f9897a6f3b, 0x186472bcb85d6ea7,
+    0x245c876fe782ad15, 0xb37c2e41f574bc81, 0x6c34e9721365b9ed, 0xfcbd83743268e95b, 0xb47d23c5415bf8c7,
+    0x6e2f1ac98e7f1935, 0xf34a728cbe8347a1, 0x97b584ecbc87561f, 0x57216abfec59647b, 0xce56fad1f95b83e7,
+    0x94a36d12197ea265, 0xd28b13965873b2c1, 0xec3746287564be2f, 0x6ae29d187245de8b, 0x7bcd25fa9148ecf7,
+    0xa731c8fbaf4c1d75, 0x29a346dbac5f3bd1, 0xe1b2759fec625a4f, 0xa8f3e6421d3458ab, 0xead6b2743c4a7829,
+    0x3e2f9c15483ca795, 0xa7fd61e9874da6f1, 0x32ac8efba751c46f, 0xfd3914aba254e3db, 0x356c914ed157f249,
+    0xcbd4587fef4a12b5, 0xbdeac6454f6d5123, 0x86abcf454b2d3e7f, 0xf35694d76a325deb, 0xd1f57cb98b247d59,
+    0x1f25c7eba9278bc5, 0xa38d45fed72cab43, 0xf4e3a25dc42db89f, 0xc39d82a1f542e81d, 0x3cd9be721423f679,
+    0xebca36f7623817e5, 0x3cfa48b98f1b2763, 0x7f5a39187d1c34bf, 0x5f813b4a9b1f643d, 0x38912c4edc1372a9,
+    0x29471bafeb36a217, 0x9387425fe618af73, 0x4f58db2325189dcf, 0x86d7c914351ebc4d, 0x3c845d676421fcb9,
+    0x4f58917ba4351c27, 0xf5c76ba98ef62b93, 0x8b69321a9bd738ef, 0x89c6ea4dcafb486d, 0x2fc31a8dc8fe56d9,
+    0xed5acb732bf1a647, 0x2d9fe74328f4a5b3, 0xdaf4319767f8c531, 0xa28134f764f9c28d, 0xa7bc96d873ebd1f9,
+    0xc7319f8a91cdef57, 0x712649ebaed42fc3, 0x294a7db1fcd75e41, 0x147aec621be74c9d, 0xda36f8e439ea6c1b,
+    0x9687132439de6b87, 0x63a94ce767d1a9e3, 0x13fe2d4ba7e4c961, 0x1b279eda93e5c6bd, 0x6172bc8dc2d9e63b,
+    0x5a3dc14fe1dcf4a7, 0xbda4c16543df2615, 0x43ace1576fd35481, 0x36d29c754cb652ed, 0x5ca9be876cd9715b,
+    0x587fea3658ca6fb7, 0x971df23ba7bd9e25, 0xed87c35fe6c2bd91, 0x9a2346bfe493bafd, 0xd58374e213c5ea6b,
+    0x9d72ca8432b8f9d7, 0x75e1cdb872cd1a45, 0x1ba862c76eaf38b1, 0x651c37da9db3572f, 0x52483dfbadc4658b,
+    0x7951f2aedab984f7, 0x3c856ef1f8bca375, 0xa591d473279ea3d1, 0x9fe4a18657a2c14f, 0x983ac7d65483df9b,
+    0x3572eca873a6fe19, 0xc5bf923a92ba1e85, 0x3218769a9f8b3ce1, 0x89af5d3bac8e3b5f, 0x567de9f1fd8259cb,
+    0xb7a36f521db57a39, 0x4c1ba2932cb798a5, 0xfd94bac6579cb813, 0x9ec43d17648db57f, 0xd582bf4a9581d4eb,
+    0xb781ea3dc2a4f359, 0xda2c9e7fe2a813c5, 0xe3cd95bfef9b5243, 0xf95d81a32e7c419f, 0x4ba16c232a6d4efb,
+    0xfae8d7654c827e69, 0xfd65be176a748cd5, 0x98fa5d2cb978ac53, 0x3c581b9dc458b9af, 0xef25b8acb46ec92d,
+    0xb8e9145fe361f789, 0x8d4e9613239418f5, 0x81afd45651a92873, 0xb923a8154e6935cf, 0x458ae2d98e7c654d,
+    0xcd421e898c5f63b9, 0x9cb2f64edc84a327, 0x24c98a1fea76b193, 0xcb1f573dc5469edf, 0x9af134821649be5d,
+    0xc64b2ae3234bedc9, 0xc9351f4a95821d37, 0x3def726a91752ca3, 0x627d348baf685b21, 0xe41f2abcbe3a497d,
+    0xdb4ca23edb3c57e9, 0xc36de5bfeb3f9857, 0xe463f7921b52a6c3, 0xde9375f43a57c641, 0x53c8d9765647c39d,
+    0xfd164ea9865ae31b, 0xf7c429aba34df187, 0x28eab57dc57241e3, 0x8973ab2dce364f51, 0xe84d9261fc264ead,
+    0xd7af5c621e396d2b, 0xa38bc5243b2d6c97, 0x2e78f4b6592e8af3, 0x8c6327a98943ca71, 0x1efc5b2a9624b7cd,
+    0x9b8ca24dc528e74b, 0xfc6213bed32af5b7, 0x67da4521f34e1725, 0x7af2b4e873624591, 0x4ef3a9676e1453fd,
+    0xe5dfc9365e18726b, 0x8dfac6976c2a81d7, 0x768b41f98a1c9f35, 0x1f39e7acb72f9ea1, 0x8c3614bed723bc1f,
+    0x423f5be1f514ec7b, 0x16b5ac932416fae7, 0x73e12da8742c1b65, 0x1c5a6478742e39c1, 0xa5bd23476cde483f,
+    0x4a78d1b98df2569b, 0x13825ebcbcf58619, 0x97cd248edbf9a485, 0x2d5438aed7fba4e1, 0x951f764217edb25f,
+    0xdf4e673546f2e1cb, 0x34af2d1765d4ef29, 0x4eb173d983e71f95, 0xd7b158c982e93df1, 0x23e7f1698edb3c6f,
+    0xbaed721989cf4adb, 0xfe7835c1fce27b49, 0x13c45eb21ce489b5, 0x7d91ebc54ae8b923, 0xc1a3d72435dab68f,
+    0xaf9db31764adc5fb, 0x4fce295ba5d1f469, 0xa4b57d6cb3e614d5, 0x938d1bced1e92453, 0x673a58bedec942af,
+    0xb97af5243fbc612d, 0x87c26e432cbe5f79, 0xd47eb2654ab28de5, 0x4d3a5b2879c5ad63, 0xac2ed4f875c69abf,
+    0x56e32b7985b9ca3d, 0x73ca694dc3bde8a9, 0x92c687a1f5d32a17, 0x9def8a7214d52983, 0xf829ab7541b736df,
+    0x3aec28f43fba465d, 0xad17b8265ead64c9, 0x82fb3d698cbf9437, 0xbf64dc7ed9c4b2a3, 0x1a39eb4fe9b7c321,
+    0x637dbe8fe497bf6d, 0x8f39c1a21478ced9, 0x1e9dc623239cfd47, 0x6e2d9b4875a12db3, 0xf2b68eca92b65c31,
+    0xdc1ae3287f964a8d, 0x759462bcbd7a58f9, 0xdac14b8fecad8967, 0x916b384fea8f97d3, 0x5b748da32ba3c751,
+    0x8bc7a4132785c4ad, 0x31ab7e465698e42b, 0x5f123c67648bf297, 0x19e3c87ba59d12f3, 0xc3fba89ed4b35271,
+    0x5fe1a6cbae734fbd, 0x52cf6ab1fd876e3b, 0x9e1647b21e596da7, 0xd937be243b7d9c15, 0x46da7bc5496fab81,
+    0xa53fd4c65762b8ed, 0xf3827e6ba674e85b, 0x94eda73cb358f6c7, 0xbce96d8fe49c1835, 0x7d9b2e51f28e36a1,
+    0x9683bf154392651f, 0x69b854a32f84637b, 0x648c97254d5682e7, 0xf7845cb98d7ba165, 0x926e43d8785c9fb1,
+    0x6243cfba975ead2f, 0x6f59432dc652ed8b, 0xa9b73fced354ebf7, 0xdecb19a324691c75, 0xcdb2f356546b3ad1,
+    0x2e76fd98716d394f, 0x4a8f67598f4157ab, 0x3a9bde5cbe548729, 0xf239c45dcd37a695, 0x1d97623edb49a5f1,
+    0x1e472c8fe84cb36f, 0x9618fd42174fc2db, 0x3cb159d65863f149, 0x5e48c91a986721b5, 0x1ae2738ba5694f13,
+    0xb8d2f31a914a3d7f, 0xaef743b98f2d4ceb, 0x1da7826ede317c59, 0x5e9f6a31fd238ac5, 0xd7a9f8521d27ba43,
+    0x5681fa943a28b79f, 0xed7b51a6583bc71d, 0x35bf8de9862fe579, 0xe751a86cb84316e5, 0x2389c15ed7482563,
+    0x69b4d71ed12843bf, 0xa31e579fef1b623d, 0x687e52c43f2e61a9, 0xc21af4654c218ef5, 0xe51238f76c14ae73,
+    0xd184ab9768159bcf, 0x71cedf2a9718cb4d, 0xc375b1a9851ceab9, 0x78f349edc51efa27, 0xca65d781f6142a93,
+    0x1794bcf3241537ef, 0x729bfd565219476d, 0xf51d2ec43efa65d9, 0x3bc69a176cfd9547, 0x6db49e787aef94b3,
+    0x865219bcbaf5c431, 0x45ba26ecb7f5c18d, 0xdf715abcb4d6cfe9, 0x81df5e7214dafe57, 0x82316c9545fd1ec3,
+    0xec26fa1986f25d41, 0xcfbe6d2871f34b9d, 0x1237f6898fe76a1b, 0x2dc7984a9deb6a87, 0x1869b53cbadc98e3,
+    0x249817cfe9dfb861, 0xc51f4ba218e2c5bd, 0x546df1c328d6e53b, 0x48cd76e545d8f3a7, 0x31f25cda97ec2415,
+    0xf27ca69ba5de4381, 0xd98f526ba3c251ed, 0xce4f9d7baec36f4b, 0x9eb83a51fdc56eb7, 0xb8fa4c321eca9d25,
+    0x67ce5d3438bdac91, 0x928be164368ea9fd, 0x5abf9e4657c2e96b, 0x26efcb8a95b4f8d7, 0xe1345cfdc6da1945,
+    0x7316b4afe4dc37b1, 0x3da7426fe1bd462f, 0x821be69432d1648b, 0xb5e4d6832eb483f7, 0x21e6c4854ec8a275,
+    0xd82f5ab76cb9a2d1, 0xa64e29d7678bae3f, 0x438f25c9857fce9b, 0x3ce5179dc6a3fd19, 0xc6f543d1f4b61d85,
+    0x64be5a2325a83be1, 0xd2eb1cf5429b3a5f, 0xdb57a4c6519e48cb, 0x9426e3f76fb17839, 0xcd3275698eb397a5,
+    0xe68fa92dcda8b713, 0x632dc78eda89b47f, 0x6b2457f1f67ac3eb, 0x5a96feb2178fe259, 0x21fd69c768a412c5,
+    0x8f6ebd7a97b85143, 0x6d9e23a762973e8f, 0xf48c3d1981794dfb, 0x3da64f7baf7e5d69, 0xec9af12dce718bd5,
+    0x8ebd6a71fd84ab53, 0x586af9421c65b8af, 0xfd8e3b943a69c82d, 0x928c5be4375ce689, 0xcfadb659847de6f5,
+    0x4386e57dc8a42673, 0x8b4a3f7cb28634cf, 0x46ab3c2fe189634d, 0xe239c78fef5c62b9, 0x9831d2f43f6e9127,
+    0x9a74d6854d61af83, 0x78daec354a539cdf, 0x1b2d97487946bc5d, 0x5abfd3c98647ebc9, 0x178f25aba65cfb37,
+    0x3a1bcf2ed56f1ba3, 0xd9a2fc51f6845a21, 0x159f4da21265487d, 0xefbc92a4314856e9, 0x876cb4e54f3c9657,
+    0xb3f72ae87d4e95c3, 0x1d953cabad72c541, 0xeb35f4dcba54c29d, 0xc6a2913ed957e21b, 0xb5d7243ed539ef67,
+    0xa5c7bf83275b1fd3, 0xa1dcb685476f3e51, 0xeb6c9ad873524cad, 0xbf71298a91456c2b, 0x71e4352baf286b97,
+    0xcfd5482bad2b89f3, 0x67c9341edc3eb971, 0x6b7efca1f931b6cd, 0xa8d39cb21a23e64b, 0x295ef6d43926f4b7,
+    0x6ad421c9894b1625, 0x3f7869eba75d3491, 0x71b8f4ca953e42fd, 0x39a17bced243716b, 0xe87529dcbe146fc7,
+    0xd7968541fd189e35, 0xd7a8f5243e2b9da1, 0x7f92be35492dab1f, 0x1fed4ab65921ea7b, 0x2839ebd76813f9e7,
+    0x4e3a2c9dc9281a65, 0x3b81fd5ed62a38c1, 0x43c75abed51c473f, 0x9ed7ba1fe21f459b, 0x1628b5d764238519,
+    0xf12da5432ef4a385, 0x4527c3965cf7a3e1, 0xfe149ba76ae9b15f, 0x4a5398e656e9cfab, 0xe784a1d986cfde29,
+    0x75ea1fcdc7f31e95, 0x92f8475ed5e63cf1, 0xc37de69214e83b6f, 0xe172d9b432fa49db, 0x8c592eb651fe6a49,
+    0xe634dfc76fe198b5, 0x3e8bd61a9de5b823, 0x915b423a9ad6b58f, 0xae75c34ba7d8c4fb, 0x842fc951f7dce369,
+    0x34a58fe217bef2d5, 0x7b3a6dc879e64253, 0xd2f4c73875d641af, 0x92e67d1873c85f1d, 0xf1b37c8981db5e79,
+    0xb5c836d98fad7ce5, 0x79234b1cbed1ac63, 0x52b3791fe8c3a9bf, 0x73548d921ab6c93d, 0x172f89c326c8e7a9,
+    0x8d9a3c7546bcf817, 0x32bd6f7a96cf1783, 0x58cfe36a96b235df, 0x6359ad4cb2c7645d, 0xa37962dfe1d863c9,
+    0x4259368fefbc9237, 0xae74d5132fbe91a3, 0x7a8bce143b819def, 0x361df4254a93be6d, 0xa14863754785ecd9,
+    0xea8f76c986a9fc47, 0xdc936a5ba69d1cb3, 0xd429b76ed6af4b31, 0x7eb82af1f3b2498d, 0x4f381eb212b457f9,
+    0x5286ecf431ca9867, 0xb624c3154f8b96d3, 0x6ad745287d9eb651, 0xf491de587b81c3ad, 0x897a6bfdca95e32b,
+    0xb719da8ed8a6f197, 0x145b7e9fe79a21f3, 0x496c1ae3279c3f61, 0x876db1c3247f3ebd, 0xb714235874926d3b,
+    0x31f4ab7981946ca7, 0xf2e3461baf789b15, 0x245bcd6a9e6cba81, 0x4e91362cb95ca7ed, 0xa9fce2b1fa81e75b,
+    0x5ab8cfd21a83f5c7, 0x673f4cb54ba91735, 0xc1385d27678b35a1, 0x726c31ea968c541f, 0x7e85a2dba38f527b,
+    0xb3271c9dc29381e7, 0x8f16bacdce769f45, 0xf69e8dc1fd579eb1, 0x1d59b6321d59ac2f, 0x896c21a3294edc8b,
+    0xa73d1e854951eaf7, 0x9dcbe73a9a841b75, 0x7ab846fcb86739d1, 0x37c68badc56a384f, 0x6d8ac54fe25d46ab,
+    0x4bc2e67fe15f7629, 0xe2fab6143172a495, 0xf73ec1243e56a4f1, 0x543f79a65d48b26f, 0x85df1a976a49c1db,
+    0x9af24bd8784cdf39, 0xe41f8b3dc9621fa5, 0xcb821f3ed9764e13, 0x6d781eafe5463c7f, 0xa8d17f9215384aeb,
+    0xfe71bd35423d6b59, 0x9eacd2b7613f79c5, 0xcd536b298f52b943, 0x52a347f98d24b69f, 0xc5f69d7bab38c61d,
+    0x6d932b1eda2be479, 0xa645fd1ed82cf3e5, 0x2e8f19365b712463, 0x6d1e5927683542bf, 0x9136fe8a9748613d,
+    0xd2c673b8732a5f89, 0xed5f247a912b7df5, 0x9c1e458bae1f9d73, 0x2d7983fcbd129acf, 0xd6b497f1fb15ca4d,
+    0xa64edf932c16e8b9, 0x3defcab54a1bf927, 0x5a9d8c476a2e1893, 0x12dfe65a982136ef, 0xeb1536acb813456d,
+    0x5f7b639dc31764d9, 0x2c76d3efe21b9347, 0x5d18a67edefc92b3, 0x37fe12954dfeb231, 0x1bdc93843ae1bf7d,
+    0x9c76e12548f3cde9, 0x6e87dfa549e6fd57, 0x316df28987f91dc3, 0x174ef62ba7fd3c41, 0xd67342ecb4ef3a9d,
+    0xc7a5b2efe4f3691b, 0x8b47da3212f46987, 0x2d8c6bf541f897e3, 0x914bfd654fecb761, 0x5dfbc3e659cea4bd,
+    0x1f384ed98ad1e43b, 0x127eaf5cb9d4f2a7, 0x14b8dc2edae92315, 0xcd7f5281f7eb4281, 0x39f6eab215ba3fcd,
+    0x1e94f2d323cf5e4b, 0x4d12fe8653e26db7, 0x54be2dc981e69c25, 0x12a846576fd7ab91, 0xebfd83a76cb9a8fd,
+    0xe479b52dc9aed86b, 0x8315bcefe9b1f6d7, 0xa654def32bd61845, 0x2c4e396549d836b1, 0xab4d682767ca452f,
+    0x4a37bfd874cd538b, 0x5d3276ca93be62f7, 0x16837a2dc2d3a175, 0x4eb2398cbea59fc1, 0x6eb7543fec97ad3f,
+    0xfbca37d21e78cd9b, 0xc1f986543a8dec19, 0x4e9a1f276ab21c85, 0x3db1ef4878b53ae1, 0xd1c7e53ba6b7395f,
+    0xfc89137ed3a947cb, 0x35e496bfe2bd6739, 0x1b3e29cfe1bf86a5, 0xdc549ab652c4b613, 0x927516b32e95b37f,
+    0x4f6c7e254d87c2eb, 0x5b826fe76c8be159, 0xb649da27687cefb5, 0xa37b219dc9a14f23, 0x1ab9452dc6943d8f,
+    0x13e4798fe3864cfb, 0xd7345c92138a5c69, 0x6bfca574328c7ad5, 0xac1b6327618f9a53, 0xcab39d765e62b7af,
+    0x14d2bf3a9e85c72d, 0x31db2a8cbc67e589, 0x49735bcdc97ae4f5, 0x5b4c8d91fa9e1573, 0x1be47593298143cf,
+    0xf1a3bd843895624d, 0x7c31f8d6548761b9, 0x25793f1a936a8f17, 0xead4218ba16c9e83, 0x4b6e5c987c4e8bdf,
+    0xa51934cbae62cb5d, 0xbf3c2691fb54eac9, 0xcb4fe1921c58fa37, 0x14962b754b6c19a3, 0xb5423fc76a7e4921,
+    0x23eac74ba981467d, 0x9d3ab6ecb47365e9, 0x614f589ed2689457, 0xb85aec9fe16a94c3, 0x9461debfef6db341,
+    0xe467df932e4fb19d, 0x2bc9e3143b42cef9, 0x1cad28465b34fe67, 0x294ef1387a581ed3, 0x439a1cdba96b3d51,
+    0x6c3e129a964e3bad, 0x1e34ad8fe7516a2b, 0x9e357db1f2436a97, 0xdb6e5392124698f3, 0x54fcb276524ab871,
+    0x4bf213954f2ba5cd, 0x4c7b13587c2fd54b, 0x1c943d8a9c42f3b7, 0xc79ad1bedc681425, 0xda27e81feb5a4391,
+    0x862413cfe73a41fd, 0xa378d6c2172d4f5b, 0x8b9714f545316ec7, 0xcdea7b1986249d35, 0x56da2f1982369ca1,
+    0xe3c6bfd87e28ba1f, 0xa3d781e98e1cd97b, 0xd593416cba1fd8e7, 0xe63d5ca1fc231965, 0xaf327ed54b2637c1,
+    0xfed4c1865a19463f, 0xd9e5bc67671c549b, 0x5a18e4cba62e7419, 0xb7162c8dc631a285, 0xf3e7a58dc435a2e1,
+    0x4b7c98fa9cd5ae4f, 0xa1d4273ed9f6ceab, 0xa8fed6c21bfaed29, 0x5b2cd47328edfc95, 0x1da69b4769e23bf1,
+    0xf2753ed878e43a6f, 0xf7b8d49a95f648db, 0x6e4a2bcdc3fb6849, 0x76ac32bdc2fd87b5, 0x2f3716aed1efa723,
+    0x18edf2c431e2b48f, 0x68fd91532ed5c3fb, 0x897b23c54cd8e269, 0x5342fbe769caf1d5, 0xf47e13da9ade2153,
+    0xfe456c7ba7c13e9f, 0xa63241fcb7c45e1d, 0x7e6dc2b1f3e65d79, 0x843dbcf213d97be5, 0x3b41f8c542ed9b63,
+    0x7efcb46541ce98bf, 0xf256bda76fb2c83d, 0x3a217c987dc4e6a9, 0x35f8671babc9f617, 0x9b76d14feadc1683,
+    0x952b7e6fe7ac24df, 0x9a45de1329c1635d, 0xfe62795437d462c9, 0x84bcfde765d89137, 0xb2435f6762ca8f93,
+    0x5bfe3947619a8cef, 0x37ba95f87e8fac6d, 0xa57691fbac82ebd9, 0xc5a2498feca5fb47, 0xbe987ad32dc81ab3,
+    0xdc94ea5659bc4a31, 0xa3e2f6b546ae378d, 0x4578f3b987b156f9, 0x91eb7d2cb4c39567, 0x6f9b837dc2b795d3,
+    0xa91e726fe2cab451, 0x9d7cba6fef7cb2ad, 0x32e7ba943e8fd12b, 0xafe97cb43c92ef87, 0xcfeb34165b961fe3,
+    0xfadb73c87ba93e61, 0xe27b538986793cbd, 0xde1749aba68e5c3b, 0xa37dc96fe4916ba7, 0xf2467ec1f3b49a15,
+    0x84bfac2323a6b981, 0xae351f743178a6ed, 0x315fedb43f7cd65b, 0xeaf85c265b6fe4c7, 0x4d8f2b3cbda41635,
+    0x98c2bd4edc9734a1, 0x4c1ba83eda89531f, 0x5432f8e1f68c517b, 0x3b9d46c2146c5fd7, 0xf12379a436819e45,
+    0x2ef5468763749db1, 0xb578d3198176ab2f, 0xe1c2d9676f47da8b, 0x6cbe85498c4bd9f7, 0x829576bdcb4ef975,
+    0x6c9a7481fb7438d1, 0x3bae9f721b86374f, 0xab4916f3296845ab, 0xa81423c5486c7529, 0x56d1f34ba46e8395,
+    0xe15a9bfcb572a3f1, 0x3c54b1edc274b16f, 0x86d9c53a9e35afcb, 0x73c654f1fc48de39, 0x3f897db21c3bfda5,
+    0xd5ea83765b6f2d13, 0xa389d2e76a523b7f, 0x367492b8783549eb, 0x57ebf89dc7386a59, 0xfdbc618ed43b78c5,
+    0xf7c3a94ed25ea843, 0xd264375fe241b59f, 0x257fcd843264c51d, 0xbecfa7954f26e379, 0xfd215e976c39f2e5,
+    0x1db725ca9c5d1263, 0x26f74da9894e31bf, 0x917238acb9435f2d, 0x4da237ced7245e89, 0x7c3196dfe4287cf5,
+    0xb31ef972152b9c73, 0x31e97fd5432d89cf, 0xd14fe3287231c94d, 0x2e6a9f476f13e7b9, 0x7c85236bad16f827,
+    0x75b324adcd2b1793, 0x578f619dc91b25ef, 0xca45372fe91f346d, 0xa1429b854a1263d9, 0x8f7de3b65a169247,
+    0x9dec5b68762891b3, 0xdae4b3c9853baf21, 0x6ae8dfc9821cae7d, 0xa1f69c376adfbce9, 0xf9a5326babe2fc57,
+    0x2cb6e15feaf61bc3, 0x147af5632cf93b41, 0x418a2f9327fb389d, 0x31c6bed547fe581b, 0xc27f8e5ba5f19687,
+    0xf3178c4ba5f496e3, 0xfb1673edc3f8b561, 0x16bfc23dc1f8a3bd, 0x3fca4edbafecd23b, 0x5e96d2432dcfe1a7,
+    0xc94adf187de63215, 0x812fb3e65bd63f71, 0xbef3a21658b73ecd, 0x1c683b2987ea5d4b, 0xb84e396a94de5cb7,
+    0x196a258ed6e19b25, 0xa95cb721f3e4ba91, 0xe4b9c5d212c5a7fd, 0x93876d5431e9d76b, 0xc869e1d43fabe5d7,
+    0x7b64e1a87cbef645, 0xfc953e8a9cd435b1, 0x26f1834cbac7542f, 0x17dac89fe7d9528b, 0x94e135cfe5cb61f7,
+    0x1b96cf4214bd8f65, 0x8febd96545b29ec1, 0x321d9e6762b4ac3f, 0xcab81ef761a5dc9b, 0x643b5e876fa8eb19,
+    0xebac23d87d9cfa85, 0x2f7c943dcbaf29e1, 0x8e2d47afeab2385f, 0xe31cd96219a546cb, 0x6cb94a2328ca7639,
+    0xd829b6a436bc84a5, 0x68af2dc986bea513, 0x384c1efa94a1b27f, 0x78c2f94ba294c1eb, 0xa5948f2cbe86df49,
+    0x1a9d5b2edc78feb5, 0xaf249dc54d9c1e23, 0xca981f243a7e2c8f, 0xb8ef275659824afb, 0xd5a7bc6878a45b69,
+    0x61b7594cb4a879d5, 0xdcba91fed48ca953, 0x398e16bdc27d96af, 0x47896ca1f391c62d, 0x829bcae321a3e489,
+    0x61fde5832d87e3f5, 0x1d5c2b876e9b1473, 0x42f5d3876a7b32cf, 0x5978cb2a9a8f514d, 0x872c4f5dc8725fa9,
+    0xfb61d72ed6958e17, 0x9bc82e51f4679d83, 0x1aed768213598adf, 0x9af71cb4326eba5d, 0x9dfb38c65261e8c9,
+    0x5d3fea298e64f937, 0xfb1634dcbe6718a3, 0xc48a391dcd7b4821, 0x1c3d845fea6c357d, 0x6f857d4ed86f54e9,
+    0xd1ca85f21b829357, 0xf7361e95487692c3, 0x4d7e3cf98679b241, 0x2d3164876249af8d, 0xce4fb3d8714cbdf9,
+    0x8d7219ebae41fd67, 0x267afe8cbe651cd3, 0x3bd642e1fd683c51, 0xb8dc6f421c4839ad, 0xc17fe9343a4d592b,
+    0xa8c4bf354a3f5897, 0xfa38e19ba85297f3, 0x14275cedc845b671, 0xf689a4ecb237a4cd, 0x7e84512fe15ad34b,
+    0xea24781dcf3de2b7, 0xd3569cb76f741325, 0xb9d3c2a87e564291, 0x173f85b65a263fed, 0xe37dfc687a294e5b,
+    0xe4d352ca982b5dc7, 0x82e945acb72f8c35, 0x3549bedfe6439ba1, 0x362de79fe435b91f, 0x13ebaf821326d87b,
+    0xb723ac65412ad6e7, 0x9273da654e1df765, 0x59f1e6da9e4236c1, 0xe8c2396bac16453f, 0xa13f4b8edc17539b,
+    0x1a6c875fea2b7319, 0xba276941f72d9185, 0x793dae24362e8fd1, 0x24e357865612ad4f, 0x92a4f5676314cdab,
+    0x241678598317ec29, 0xfa5d34e76de8fb95, 0x34e176c98bec2af1, 0xa7b6f5ecbade296f, 0x5d72b36fe9f247db,
+    0x8c1463d21bf56749, 0x7f865ad327f986b5, 0x1329f7d657fca623, 0xba4e968764eda38f, 0xcf5d18a984e1c2fb,
+    0x79da25bcb2f4e169, 0x79b251ea9db6efc5, 0x9346ca8fecda1f43, 0x4879fad21acb2d9f, 0xb7f9a3e439bf4c1d,
+    0x4bc823d54ae25c79, 0x1beda98768d47ae5, 0xa247d1ecb5e89a63, 0x5cd14e3983da97bf, 0xed82134ba2ceb73d,
+    0x26a7bdf1f2d1e5a9, 0x29ef57c432d4f517, 0x637d4e254fd91583, 0x9cd43ea65cb923df, 0xec91b2487abc425d,
+    0x93b6a27878bf51c9, 0xbe2d3a6cb9c38f27, 0x95c18b3ed6c58e93, 0xca31f8ded3a68bef, 0x8ab4f59213c9ab6d,
+    0x2816bce4328ecad9, 0xaef58c6762c1fa47, 0x526cb9f87fc519b3, 0xed17249baec84931, 0x7892edba9cba368d,
+    0x8f1ac24ed8ac45f9, 0xa5db143fe9bf8467, 0xa56ce41218b294d3, 0x42d81fa548c7b351, 0x1fb789c65497b1ad,
+    0x5ae9bc676389cf1b, 0xc9263ea7619cde87, 0x673c5a9baf921de3, 0xf74e92cdcea53d61, 0x24cbe871fc863abd,
+    0xac71f5821d895a3b, 0x9a876ce32b8d59a7, 0xdb9e436547af8915, 0x7c526f3a96a3b781, 0x3d9b6f5a9384a5ed,
+    0x9e3c2b6dc298d45b, 0x4dcb937ed18ae3c7, 0x671a395dce8df235, 0x41cfdb365f9243a1, 0x438b7ef54d96521f,
+    0xdf2e67a43c874f6b, 0xb167c8254a695ed7, 0xd782afcba97c8d45, 0x4938a7fba56f8cb1, 0xa17f963ed573ba2f,
+    0x39b6d781f264d98b, 0xe75f4c621256d8f7, 0x179c85d4316bf875, 0x9fb82a465f6e27d1, 0x96c258ba9d81364f,
+    0x745db13a9d7354ab, 0xf1426cdedc687429, 0x1b34ce9fea6b8295, 0x863eb4dfe76c92f1, 0x7fce6a92164d9e5f,
+    0xb8397c243452aecb, 0xe7ab2c587265ed39, 0x64ed3ca98147fca5, 0xe5963f4a9f6b2c13, 0x4537b62a9c4d2a7f,
+    0xa5cd429edc5148eb, 0x79df5861fc436859, 0x8f9bed721b3687c5, 0x18df5b43295ba743, 0xe9527836563ca49f,
+    0xb7fe36d9865fb41d, 0x5814fb6cb453e279, 0x496df73cb246f1e5, 0x1bd6f3aedf5a2163, 0x1c7264fedc392eaf,
+    0x6e7c98321b3c4e2d, 0x2b47c8f54c315d89, 0x86b439576a237bf5, 0xe263f7c98a269b73, 0x2743618ba52798cf,
+    0x96de785ba52cb84d, 0x82ab9f5dc32fd6b9, 0xa2e53c6fe143f627, 0xd2fa39e652471693, 0xd1f98ea65d1824ef,
+    0xc39d76a87e1b436d, 0x2d6eb9487b1e52d9, 0xd16b59fcbc329147, 0x369b8e5dc9148fa3, 0x7da8f94ed837ae21,
+    0xaed798c1f418ac7d, 0xb9ac8413241acbe9, 0xf2913675431feb57, 0xcfd45ba985241ac3, 0xf3241d798ef63a41,
+    0x2a1645b98cf6379d, 0x5b1cd9ea9cfa571b, 0x56e812bdcafd6587, 0xac64bf1dc7df85e3, 0xc197286329f3b461,
+    0x6ab12c9436f5a2bd, 0xe965a3c765f8d13b, 0xc83fbae652eadf97, 0x3f6baec871cbedf3, 0x6fc5d7abafd23e71,
+    0xc35678fa9ae43bcd, 0x84d5cb71fae75c4b, 0x4ecf9a321ce95ab7, 0x72dba95439ed8a25, 0xbc472e1546dfa891,
+    0xa2cb614875c2a6fd, 0x7fc325ea93e4d56b, 0x4c38faeba2c8e4d7, 0xf1c965adc1dbf345, 0x9173fcbedfce24b1,
+    0x4b8e92654ec1532f, 0x28fdc1a43ed4518b, 0x57d6ba843ab65fe7, 0x7e86d24549ca8e65, 0x7ab1392876ab8dc1,
+    0x65418d2985ae9b3f, 0xc3bead9fe4c2da9b, 0xc89f4a21f3c5ea19, 0xf7941ab212c7f985, 0xbd8f79a653cb28e1,
+    0xbd82c6354ead275f, 0xc731bda87ea145cb, 0x64a21cdbadc47539, 0xaf9d15cedbc783a5, 0x218b359fe8cba413,
+    0x2da8c76fe59ca17f, 0x6ea17452147e9fdb, 0x32e718d435a2de49, 0xc849ebf76294fdb5, 0x37c4ad1984b91d23,
+    0xc5efdb276e7a2b8f, 0x3e6d1af98c7d39fb, 0x2e36d4cfedb15a69, 0x4b8de2a1fba378d5, 0xaf169d821cb7a853,
+    0xefd8a9b3267895af, 0x9e18f3a5468cb52d, 0x6859cb27647fd389, 0xe16d952ba493e2f5, 0x642a1f8ed4b81273,
+    0x4a879b2cbe7831cf, 0x415a67cfec7a4f3d, 0xbc79a5421c6d4ea9, 0xdb12caf54c928d17, 0x8a2d54f65b749c83,
+    0x2f3d8ce5476589df, 0x687319eba468b95d, 0xeca9d16ba35bd7c9, 0xe6c7bfadc26fe837, 0x8ad6cf91f29417a3,
+    0x5d84f37653a84721, 0x6b8d91232f69347d, 0x61fd73254d6b53e9, 0x28cb419a9c6e8257, 0x64e2af7bab7291c3,
+    0xb1e32f8dc975af31, 0xa8ecf49dc645ae8d, 0xc289517fe347bcf9, 0xc1f756a2134bec67, 0x397482b5425efad3,
+    0x23ce7dba92843b51, 0x2e3714c87f4538ad, 0xcf2e734bae49582b, 0xa2d3b49cbd3c5697, 0x4576c81dca4d86f3,
+    0xc5fa6e41fa62b571, 0x5d4af6821854a3cd, 0x7cb2f3d43857d24b, 0xb2913d476549e1b7, 0x8cf461d9834bef15,
+    0xf5a6c83ba35e2f81, 0x723fcb4a9f423ced, 0x2796ce3dce264d5b, 0xca834bf1fd285bc7, 0x54ec9a321d2c8b35,
+    0xad1c6f754b3e89a1, 0xfb369a876942b81f, 0x2fb634ea9823d67b, 0x7a51c9fba426d5e7, 0xbc7a185dc32af465,
+    0x1c65e2afe34d25c1, 0xe89465bdcd1e243f, 0x9278a3c54f13529b, 0x3d5421865e367219, 0x946bc1254c198f75,
+    0xa8c63947692a8ed1, 0x7a523e19871d9c4f, 0xe23749ca9621dcab, 0xf8ac3b2ed614eb29, 0x463de7afe316fa95,
+    0xfb29a165453a29f1, 0x3d481296531c286f, 0xae8c34254cfe36db, 0x7cdf3a498df17649, 0x1e6df53a9cf384b5,
+    0xce784badcbf8a523, 0x7c268e5dc6e9a28f, 0x41526dced5eca1fb, 0x5f6b9ec214decf59, 0x3869bd7434d2fec5,
+    0xda8ef74985f71e43, 0xf538bec761e72c9f, 0x9d6714587fea4b1d, 0xc246a8e98cde4b79, 0xea6349cdcbd179e5,
+    0xadfb94c1fbe4a963, 0xc6d531e218d596bf, 0x41758d2327e9b63d, 0x83c9fed435ecd4a9, 0x48ea3db985cfe417,
+    0x37a8bf1cb6e51483, 0xa9752e6ba1c632df, 0xd816e5acbfc9415d, 0x9126478fedca4fb9, 0xcbd7a8321cbd6e27,
+    0xba3d6e854bc18d93, 0xfa971d8547b38aef, 0x31e98cb547c5ba6d, 0xbf5e1c3764b7c8d9, 0x73c1652ba3bce947,
+    0x2f19bcadc2aef7b3, 0xbf674ed1f2d54831, 0x9e1ba4f321c6358d, 0xf216b7e32eb854f9, 0x3fb162854ebc8367,
+    0x19ae34876bae82d3, 0xedc2978a9ac3b251, 0x6d382f4cb683af9d, 0x2a98357ed596ce1b, 0x86754391f3a9ed87,
+    0x6b3de9c2148afbe3, 0x1ab459c654af2c61, 0x1de398a761a239bd, 0xe9a763587fa6593b, 0x2538c1f76eb958a7,
+    0x931ba8dcbdac9815, 0xcb5617dedb9ea681, 0x28ca9f71f781a4ed, 0x6e15f8d21894d35b, 0x76a1ed243596e2c7,
+    0x2bef9d48769af135, 0x736148b9859d32a1, 0x1cb687f9817c2efd, 0xce3971abaf824e6b, 0x4936e17cbe845cd7,
+    0x9a628c51fd798c45, 0xd8e941a32d6c8ab1, 0xade2cb84386da92f, 0xc483a1654961d78b, 0x6d2e971a9583d6f7,
+    0x87a3f56cb398f675, 0x3f5a92cdc48a26d1, 0x57b2d86ed18c254f, 0x792c154ede6f43ab, 0x7de913c21f847329,
+    0x179a25e43e768195, 0xb132e7954b578fe1, 0xab42f937684a9d5f, 0xf53e1ac8764e9dcb, 0x3d18f67cb761ec39,
+    0x34b1a97ed463fba5, 0xe42765d1f5782b13, 0x51ef4ac2135a297f, 0xcb6d4ae5415c37eb, 0xac594df76e3f4759,
+    0x7cb38e5a9e4286c5, 0xa6b5d8ecbd57a643, 0x6158472dcb47a39f, 0x7be65c9fe85ab31d, 0x754dfce1f64ed179,
+    0x7916e2f32741efd5, 0x47b862d548761f53, 0xce651df873462daf, 0xe3c247b981594c2d, 0x164a23e87f2d4c89,
+    0xfde251ba9c2e6af5, 0x92613dafed429a73, 0xe9b86cdfea2497cf, 0x7cb698e21a28b74d, 0x7219fd84372ad5b9,
+    0xa456f1b7683de527, 0x859a3fbcb8621593, 0x47d3f28ba64523ef, 0x815e9a4dc138426d, 0x876a3f9dcf2a51d9,
+    0xca2e9d1fed1c6f37, 0x8b46ac732c1f7ea3, 0xc5ab26e76c34ad21, 0x2bafdc565914ab7d, 0x29857fa65716cae9,
+    0x357b2efa961bea57, 0xeac6f13ba51df8c3, 0x5b8c931fe7523941, 0xe3792a81f214369d, 0xab62ce154328561b,
+    0x7fa452632efa6487, 0xc1f85bd65cfb84e3, 0xd496b3f87bfea361, 0xceb5a63878f2a1bd, 0x843dbe5a97e4cf2b,
+    0x4de9af1cb4f5de97, 0x61a7db2cb4d8ecf3, 0x1fc8e32435fc2d71, 0xefb86c2543ef2acd, 0x6e219c7871f25a4b,
+    0x5a81d9376fe459b7, 0xf239d1587dea8925, 0x62a5ed798beca791, 0x98e6f37ba7bc95fd, 0x4fbc2ed1f8e1d46b,
+    0x78c564a218c4e3d7, 0xf2a15cd437d8f245, 0xb5cae21876ea23b1, 0xeb7f4dc985dc412f, 0xcb68fad981ce3f7b,
+    0x4592e87a9fb25de7, 0x5deaf3bcbec48d65, 0xdfce2871fad78bc1, 0xe6c9a47218cb9a3f, 0xf72e196326aec89b,
+    0x2f384e7657c2e819, 0xfbd27e4a96c3f785, 0xe451f3dba5c827e1, 0x1ba78d6cb3ca265f, 0xc3da148fe1ad34cb,
+    0xd837a9bedebf6439, 0x5b3c9d621fc382a5, 0xd172cea65ec7a213, 0x1598bda43ba79e6f, 0xdab9432546789edb,
+    0x1e4f6538768ecd49, 0xf2acd97ba691fcb5, 0xc78bd3efe7b61c23, 0xd7a8e32fe3b62a8f, 0x4ce517d212a938fb,
+    0xb296cef431bd4869, 0xadb718e43e9f67d5, 0xf37e62b98eb2a753, 0x6d7359a87c8594af, 0x86c27fbdca98b42d,
+    0x7e981bcfe67bd289, 0x75cbe94fe68cd1f5, 0xa438ce9659b42173, 0x918f256435842ebf, 0x1d49ba6762974e3d,
+    0xa96fbc5761784da9, 0x2d98be6a9f8d6c17, 0x8ade19fbad6f7b83, 0xb982e5adcb6298df, 0x368f94c1fa74b85d,
+    0x5f3a84121a57d6c9, 0x69af8c73298be637, 0x92ae14f5467df5a3, 0x7e58fb4cb8a34621, 0x6a2bd1ecb295437d,
+    0x2b65a9edc18752e9, 0x136d42cedf6b8157, 0x6943b21fed5c7fb3, 0x58e26fb32c6f9e31, 0x562be7343b52ac8d,
+    0x3a1256843854cbf9, 0x9e3cd5f65948eb67, 0x56f43279865af9d3, 0x198facbdc67e2a51, 0x98574a1fe46137ad,
+    0xfe6b95c1f184572b, 0x9f65871321486597, 0xa97e61232e4a85f3, 0xb8de6a976e5da471, 0x2b8adc976a4f92cd,
+    0xc78d63fa9a63d14b, 0xaf1d946cb834dfa7, 0x8ea941fdc748fe15, 0xd32bc6f1f65b2e81, 0x8ec4d652154c2bed,
+    0x5e749ac873614c5b, 0x17235df981435ac7, 0x17b63e2a9f278a35, 0x94b37c187e3b98a1, 0xf782e5da9b3ca71f,
+    0xb48237aed92fc57b, 0x7ebc4fa1f932d4e7, 0x48d73be21a27f365, 0x5c8a31d7685924c1, 0xa86cf729875b423f,
+    0xb283e419853e419b, 0xc48d21aba2315ef7, 0x15f9437cbf138e75, 0x46e9283cbe268cd1, 0x81ed3b5fec189b4f,
+    0x12aeb863281dc9ab, 0xfae29865481fda29, 0xc2d543b76a12f895, 0xe43f8c5ba93628f1, 0xa53e82bcb519276f,
+    0x4fb318edc41a35db, 0x6f32adbed21e6549, 0x253bc91dcdef73b5, 0xcfed6a521ef5a423, 0x8baf96743ce5a18f,
+    0x7fea35d438d69feb, 0xf4716d2547face59, 0xc1e6f7d876fbedc5, 0x651b783cb8f21d43, 0x456fe1cdc5e42b9f,
+    0xb35ea72fe3f74a1d, 0x6397ed4212fb4a79, 0x5d72c8e431fc68e5, 0x689bfdc54edf9863, 0x6a92bfc76cd295bf,
+    0x2acf63e98ae6b53d, 0x98bd2f6cb8e7d3a9, 0xc94a15fdc8dbe317, 0x921ac5dfe6cdf183, 0x38e7241547c231df,
+    0xbe928a6326c53f4d, 0x49c1238652d64eb9, 0xec7516a981ea6d27, 0x1b4a6e976fbd7c93, 0x85cbd4976bad79ef,
+    0xb56e341feac2b96d, 0x49e2d531f8b4c7d9, 0x6cef9b821ac9e847, 0xb1af8e2327caf6b3, 0x5fd2e68768ce2731,
+    0x54d8679a96c1348d, 0x43af127ba2c453f9, 0xb74c689dc1d98267, 0x6b85f9cdcfba81d3, 0x2d43798fedac9f41,
+    0x473a69c21b7f8e9d, 0xd12836e54a93cd1b, 0xabdf721439a4ec87, 0xfc4e5d765697fae3, 0x482bdcfa97ac2b61,
+    0xfe6718aba49e28bd, 0x24de683fe4c1583b, 0xf4a267e1f1c356a7, 0xe1a537c432c89715, 0x5fbae2c43f9ba581,
+    0xbe91d6754c7b93ed, 0x2f6195476a8fc25b, 0x125d3f798a93e1c7, 0x972b3a4cb896ef25, 0xa6351b4ed6a82f91,
+    0xca7812bfe4792cfd, 0xf6bc49e2148e3d6b, 0xe93bfd7543915bd7, 0x67145e9871a38b45, 0x2feab4d65f7689b1,
+    0x7194b6587d69a82f, 0xb9153f7a9a5dc68b, 0x638d241cb96ec5f7, 0x691845bfea92f475, 0xfdbca5943a9725d1,
+    0x7f2b39165789234f, 0xf89aeb17657c42ab, 0x78a52deba48e6129, 0x65f813acb2917f85, 0x83acd92baf648de1,
+    0x7f83254cbd469c5f, 0xd6c5a721fd479acb, 0xf8dce1b21a5cdb39, 0xe25f67d3284fe9a5, 0xde9f7bc87b852a13,
+    0xa1865f9ba965287f, 0xed4732fba45836eb, 0x941fc78ed27c4659, 0xc678325ed16e74c5, 0xa5b7c31fef71a543,
+    0x147bf9321e54a29f, 0x14c297e54e57b21d, 0xabe84cd54b38cf69, 0xb2a64597683aced5, 0x526b8d7a984efd53,
+    0x39f21eacb7532caf, 0x93526cbfe7564b2d, 0x6935f7b1f2374b89, 0x4cb75fe2123b69f5, 0xc9ab4126514e8973,
+    0x3b978a265e3196cf, 0x7a3c51698e23b64d, 0xb263c4e98c26d4b9, 0x96e174adcb3ae427, 0x4b3d6a2ed84cf293,
+    0x3fc9ea2dc74d12ef, 0x29cbf8632953416d, 0x6d251cb436254fc9, 0xe54836f984296e37, 0x7c14d539812b7da3,
+    0x85d746f98f3e9c21, 0xbcf3d56a9e21ba7d, 0x16dcaf9edb13c8e9, 0x73f8e261fb16e957, 0xb2d9ae432a19f7c3,
+    0xf92a6dc76a3d2841, 0xde28bc67671f259d, 0xd932f71ba823651b, 0x1afe34cdc4156387, 0x1b93ce6dc41982e3,
+    0x37cab29dcefba261, 0x28fc46adc9eb8fad, 0xcafb176219dfae2b, 0xd2783fc43af2ed97, 0xef1bc68548d5ebf3,
+    0x9d13482768f92c71, 0xf17dae5875fa29cd, 0x2a4e6f8ba5fe394b, 0xf924713ed3f158b7, 0x2db56e1fe1f49825,
+    0x23f17de432f7a691, 0x867e4f132ec894fd, 0xc1968b454aedc36b, 0x975a18d659bfc2d7, 0x8c16742a9ad3f145,
+    0xc4721e5dc9e732b1, 0x9e7385dcb6c83e1f, 0x76dba281f4da3e7b, 0xaefc517213bd4ce7, 0x9d7f8eb543e18c65,
+    0xbe52643762e48ac1, 0x32a597465ec6a93f, 0xfcd31a765ed8c79b, 0x4ce23fd98abcd719, 0xf6e9754dc9bfe685,
+    0xcfb7e691f9c426e1, 0x98f57b6219c7245f, 0x16bed52326d843cb, 0x6375fbe875dc6239, 0xa4f67d1983ce71a5,
+    0x6b2f87ea93b28ef1, 0xa2d876c98ea39d6f, 0xfa34c21bae859cdb, 0x48eac5d1fba8dc49, 0xde8b65c2198ceab5,
+    0xaef1b825489efa23, 0xb1e37d9657b3298f, 0x3d187ec986a537fb, 0x38d4f9ecb3ca4769, 0x4abc638dc2ab76d5,
+    0x934d587ed1be9653, 0xa78b62fede8193af, 0x1b8cd5321f95b32d, 0x725de1b43ea6d189, 0x2a8657343a78cfe5,
+    0x3f4d51c6598bfe63, 0xe81c7649867e1dbf, 0xbfe6415cb7924c3d, 0xa15d97bfe3854ca9, 0x36c5abf1f3a96b17,
+    0xe3fad492129c7a83, 0x76823cd4316c87df, 0x84f3d6b54f81b75d, 0x3584b9f76e73d5c9, 0xd963c2fbac98e537,
+    0xa385947dcb79f4a3, 0x9ce642dfea9d3521, 0xdb2ce96fe68f327d, 0xfd2ca753278351e9, 0xc71edab323956f47,
+    0x81a953b652687eb3, 0xd1c3ea49827b9d31, 0x486e21c76f4e9b8d, 0xea8341698d51caf9, 0x3127f9cedc53ea67,
+    0x4b8e915fea56f8d3, 0xd3e587243c7b2951, 0x6aef8574385c26ad, 0x9e34bc56587f462b, 0x346e59dcb5826497,
+    0xe8a1964cb27684f3, 0x8b3f4d7ed269a371, 0x17e2bdfcbf4a91cd, 0x5ce1d38fec4daf3b, 0xac251b632c41dea7,
+    0xfec361b43b64fd15, 0x6291ad376b572d81, 0xdae9682767482aed, 0xf36429ea974d3a5b, 0x86a49efcb53f49c7,
+    0xde357b1fe4628935, 0xfb7e3d61f24597a1, 0xf7eb62843248a61f, 0x1bd732f43f2ac47b, 0x1cae49365b2dc3e7,
+    0xfc65491a9c41f265, 0x2f5d8a1bab5623c1, 0xb79af14dca58413f, 0x7b5186fed6293f8b, 0x9562e8dfe52b4df7,
+    0xa8c97342142f6d75, 0x8932e6c765438bd1, 0x59b673a871259a4f, 0x8d759ea65f16c8ab, 0x196edba87e1bd829,
+    0x6329874bab1de795, 0xf8491caedb4327f1, 0x71932aefea14256f, 0x9f71d5a3291734db, 0x21df59e6581b6349,
+    0xebaf7169861d72b5, 0xe4c5f16ba64f9123, 0x1e3a597ba3129e7f, 0x12c9ba787cf39deb, 0x41cadefbabf6cd59,
+    0xd4271c5ed9f8ebc5, 0x64b3c18219ecfb43, 0x6f89be3437de1a9f, 0xb389d1f768f3491d, 0x46dc2e5ba6f54879,
+    0xde26398ba3f967e5, 0x51a9768cb2fc9763, 0xec6247dba1ed84bf, 0x245713adcfe1b43d, 0xdf6e89521fe4d2a9,
+    0x248fa9b54cd8e217, 0xac836b154ac9ef73, 0xc84faeb657ba1ecf, 0x15fce74987bf2e4d, 0x4ef7a2dba6e24db9,
+    0x3d71548ed4e56c27, 0x5bdf6321f2e87b93, 0x9bf41dc212ca78ef, 0x69fc83b431cea86d, 0xba63c8254fb1c6d9,
+    0xd27e4cb98dc3e647, 0xa7148cd98ac7f5b3, 0x71489ecdcadb2631, 0x4985236fe7bc238d, 0xf2679aced6be42f9,
+    0xe9751c2329d38167, 0x4c5d92e324b57fc3, 0x429bd8c763c89e41, 0x7ef2c58651ba8c9d, 0x6f81a4d76f8eac1b,
+    0xef16728a9da1eb87, 0xc49e7fbdcba4f9e3, 0xe2a56df1fbc82a61, 0x98fb3ec218a927bd, 0xc5a27fb328ad473b,
+    0xf57c816436bf45a7, 0xde9243fba7c39615, 0xf67138dcb3c6a481, 0xda5ef31cb1a792ed, 0xfa78c63edf8ac15b,
+    0x718d6bcfea6dcfb7, 0x67c98de43c91fe25, 0x6c3d47f54ca52e91, 0xa678493549862bfd, 0xebf4d91657893c6b,
+    0x98142e3a958c4ad7, 0x3f548b9dc39f7a45, 0x7db253cfe4a398b1, 0x1e9b3a5fe195a72f, 0xc5af61e32197c58b,
+    0xc85d1ef32e6ac4f7, 0xc6d9f8454c8de375, 0x61327da98c9324d1, 0xe8fa6c1bab96324f, 0x54196f8ed98741ab,
+    0xad6435ced67a5f19, 0x3a68c5e1f37c6e85, 0x791524f3246f7ce1, 0x8a73c29543729b5f, 0xe183caf65164a9cb,
+    0xbe16a4576f57da39, 0xd13c95e87d4be8a5, 0x9375c84bab6df813, 0x42ba638edb81267f, 0x5a3dce21f97435eb,
+    0xab98fd621b786459, 0x54e2a893286a73c5, 0xf38eb4a9867d9243, 0xf41deb58735e819f, 0x716df45981529efb,
+    0x3684e9cbaf34ce69, 0xa8c7d3ebab37ecd5, 0x3285c91feb4afc53, 0x28519ae3294d1baf, 0xa5bf98765b614a2d,
+    0xeb4cf9376b534a89, 0xc8e6291ba93768f5, 0xe85f2abdc54b9873, 0x19e5d63ba23b85cf, 0x6f943b7dc13fa54d,
+    0xba9d854fef42d3b9, 0xc9ae57421f46e327, 0xf3e912c65d48f193, 0xa162cd576b4a21ef, 0xeb95a148793c2f5d,
+    0xe32749cba8314ec9, 0x4a6fc25dc9246d37, 0x43895a7fe5267ca3, 0xae7f9b41f54a9b21, 0x7c3e4a62132ca97d,
+    0x47eb3a15412fb7e9, 0xd4c5b1876f12e857, 0xcf1ba6598d15f6c3, 0x8eab359cbd3a2741, 0xa926e37dca1b249d,
+    0xfc935dbed92e541b, 0x836dae21fa316287, 0xe9468cb5492581e3, 0x264fe97546279f51, 0xb1ef3c9653178ead,
+    0x564f2ce8731cad2b, 0x584aed965bfedc97, 0x8cbfa7498bd1eaf3, 0x37a4fd9edcf52b71, 0x4dc3a8bfe9f628cd,
+    0xc8a1e5f219fa384b, 0xce47fb2328fd46b7, 0x7a321de546ef8725, 0xfac4edb986f3a591, 0x175d68a982e593fd,
+    0x5ea91d2ba1f8c26b, 0xd1e89b7a9feac1d7, 0xd1567a2feabcdf35, 0x4a3961c54cd32fa1, 0xa37819f54ac53d1f,
+    0x9e83f2a549e63d7b, 0x2ed5fb4656d94be7, 0x276c154a94ed7b65, 0x267f5e1ba4df79c1, 0xe4f76a8dc4d2a83f,
+    0x6e92bd31f1e4c69b, 0x7cf19a3432e8d619, 0x2f8a4d632fcbe485, 0xb945a7f65bacf4e1, 0xc6a327198bc1235f,
+    0x31647ca989d542cb, 0x968e32bdcad86139, 0x2647a3fed4ca6f95, 0x7d581acfe4ab7df1, 0x496f3c5213ae8c6f,
+    0x6cef79a543c29adb, 0xf51c62b761c5db49, 0x72936ad54fa7e9b5, 0xe5293c687dabf923, 0x2fbe154a9bad178f,
+    0x12a9745ed9a136fb, 0x874cd931fac34569, 0xd9eb783219b874d5, 0x6e21f7d327cb9453, 0xc892d546549c82af,
+    0xba34ec18749fa12d, 0xa4b1732981a2cf79, 0x546cd7ba9f84cde5, 0x1792db6cbc98fd63, 0xa846be7fea791cbf,
+    0x3df719c21a8e2b3d, 0xf8ca63e43c814ba9, 0x58bd2ce659b46a17, 0xd4f8a23ba5b67983, 0xd931c6fba37986df,
+    0xfe871d9cb28ca65d, 0xbd5c9f4ed17fb4c9, 0x2c7f64dedf92e437, 0xa13b57e21e86f2a3, 0x48a25c676e9a3421,
+    0xd17fae465c8b317d, 0xd584ab36586c3fd9, 0x1386297cba916e47, 0xc9e2b47dc6847db3, 0x5d3e8a4fe5879c31,
+    0x83759e61f2579a8d, 0x9651cbe2125cb8f9, 0x7a52d834315fd967, 0xf7a9d3265e62f7d3, 0x4a98fe6bae972851,
+    0x21e4598a9c6825ad, 0x21c76d3eda7c452b, 0xbc42783eda6e5397, 0x7b8395afe97182f3, 0xa52b7d643985a271,
+    0x76f2581323458fbd, 0x64ea81276258ae3b, 0x163fdca7614bcda7, 0xc48f25e98d4fec15, 0x3b895a7cbe642c81,
+    0x45c6faedcb4529ed, 0xb8cea9d1fc48395b, 0x73ce5bf21a3b48c7, 0x94651e832a4e7835, 0x4a65cd28785296a1,
+    0x6f15cb3a9764a51f, 0x614e3a2ba246c37b, 0x274b35ecb149c2e7, 0xe84dbf3cbf3ce165, 0xc98a76bdca3defb1,
+    0x456891b21c543e2f, 0x13678bc54c253e8b, 0x2b9fa7865a284cf7, 0x7e8c6429892b6c75, 0x71d93e6a963e7ad1,
+    0x85c1ab6dc631a94f, 0x3b285a1fe423c7ab, 0x56297d41f136d729, 0xb283a174312ae695, 0x4dfa2e754d2be5f1,
+    0xfd3a64787c2e146f, 0x53cb17e98c1243db, 0x51eba2fcbc176249, 0xc68fb37eda2971b5, 0x395cab7ed72b8f13,
+    0xcd12589fe41c8d7f, 0x5fe7a9d435219ceb, 0x4dfc5e276413dc59, 0x52e6cf187216eac5, 0x42a3fcd76de8fa43,
+    0xa4158f276ceb189f, 0x37645f1a9afe381d, 0x28f3c64edbf14679, 0xa6c7315ed9f376e5, 0xd14678521af89563,
+    0xd1b572c325e983bf, 0xf5916a4765fca23d, 0x4e28c6a763efc1a9, 0xafd2851981d2cef5, 0xe49b5c8a9dc5fe73,
+    0xc731e48a9ab71dcf, 0x3df9b541f9ea2c4d, 0x94df856218de3cb9, 0xd8ae9b154ae16b27, 0x137c92e658e47a93,
+    0xda6913e764c587ef, 0x47b2c6a983e9a76d, 0x2d8cb31982ecb5d9, 0xba15834cb1cfd547, 0xba84c37edec2f4b3,
+    0xa6bf97354fd82531, 0x43abf1254ec9328d, 0x89b541c65acb41f9, 0xafdcb62769bd4f57, 0x58ec6d1a98b17ec3,
+    0x625e4abcb7c59d41, 0x859bc6afe3c58b9d, 0xde6ac391f3d8ca1b, 0x3b15a94212bcda87, 0x74c69eb541afd8e3,
+    0x7b63eca87fc42961, 0x92dfe3687ea526bd, 0x7ed84b198dc9463b, 0x1f4a8d9ed9bc54a7, 0xb16d42ced9be8415,
+    0x8d5cbe41f7c2a381, 0x4efd21b326a491ed, 0x1a6e2bd32396af4b, 0x924a81754298ceb7, 0xa1b27e98719bed25,
+    0xa4932ce76d7efc91, 0x7519ef4a9c832afd, 0xa79d518fed953a6b, 0x946328c1fba849d7, 0x78f41be21bac7945,
+    0xaf2b3854369e87b1, 0xdcf594865791a62f, 0xac15f6287593c48b, 0x7d31ac4ba296c3f7, 0x32519f6dc19ae275,
+    0xe625f47bae7bf2d1, 0x159c47dedc8e214f, 0x6cd917321d723f9b, 0x7a328ed43c865e19, 0x93e7f2143b796d85,
+    0x7da14836586a7be1, 0x7d12ceba946d8a5f, 0x4f5da19ed461a8cb, 0xe476a9cfe274d839, 0xcab624f1f186e7a5,
+    0x3f724ed5428af713, 0xd31c5bf43e6c157f, 0x45d8e2165c6f24eb, 0x48c9316bad826359, 0xfd53a2cbab8672c5,
+    0x3b518cfedb7a9143, 0x67af8c4dc54a7e8f, 0x291d568fe34c8dfb, 0x9461f7d32451cd69, 0x1c74b2354263ebd5,
+    0x52b8c6398167fb53, 0x19d5cb676e4819af, 0xd54e7c898e5c392d, 0x8af3d57cbc4f3789, 0x28fa39bedb4267f5,
+    0x7b5da2e1fb459673, 0x7f583612193784cf, 0x9f528bd3275ba34d, 0x94d65b17654ec2b9, 0xa469ed5ba563e127,
+    0x45376c2ba154ef83, 0x2cefd95a9c361edf, 0xd94a672cbc392e5d, 0xd8ba2561fa2b3dc9, 0x41b6ea521b2f5c37,
+    0xe1a54bc65c427ba3, 0xe741ba687b469a21, 0x5c82eb3a9526a87d, 0xceb16d59842ab6e9, 0x89631eacb32ed657,
+    0x45fb7c1ed241f5c3, 0x3418c5bfef372641, 0x2caed7654f17239d, 0xba4986f76e2a531b, 0x549cf3876c2d5187,
+    0xaedb4918791e6fd3, 0xafe3b41cba239e51, 0xf62b8e9cb6148cad, 0x5192ecdfe517ac2b, 0xd25498f1f31adb97,
+    0x95af2c13241cd9f3, 0x174cf6a985432a71, 0x4b1fd8a65ef327cd, 0xe7d2f1698df6374b, 0x2e746c398cf945b7,
+    0x275a1decbafc8625, 0x34be856dc7fe8491, 0x7a8e6bfdc6e192fd, 0xa19b27f327f4c16b, 0xedc89af323e5bfc7,
+    0xf18eb2d762f9de35, 0xa65d924762ebfda1, 0x73a6c5b87dbe2c1f, 0x825d4f9a9de23c7b, 0x67a93f8dcbd54ae7,
+    0xb9e86471fbe97a65, 0x5b4f782329eb78c1, 0x64de1fc326cd973f, 0xf97edbc546e1c59b, 0xbdfae85986e4d519,
+    0x5d3e7c9ba2d7e385, 0x15fea47ba2c9f3e1, 0x2c1f956baebc125f, 0xbd94562fedaf31cb, 0x546ac9f21dc35f29,
+    0x8147c9f32bc46e95, 0x3bcfe2d549b87cf1, 0x7bde493545ca8b6f, 0x24dcb1f764ae89db, 0x1f648a2cb5c1da49,
+    0x4fa3dbced2c3e8b5, 0x1b92e57fe1c7f823, 0x268ec19432ca168f, 0xc8a69d243e9c25fb, 0x4cd83e265dbf3469,
+    0xa67f8e398cb273d5, 0x4ac87f1babc79253, 0x128efa7dc6b781af, 0xcf1e847dc58a9f1d, 0xaf956d31f38dbe79,
+    0xa5db16232491dce5, 0x54b9d28652a4fc63, 0x7581ed9652961abf, 0x1a2fe4c76f892a3d, 0xc86a94376e7d38a9,
+    0xe2b4df3cbcaf5917, 0x2c8b7d9fecb29783, 0x2a3bc98fe79485df, 0xf73cd8a21798a45d, 0xca728513257ab3c9,
+    0x3e4c86a7659ed237, 0xac1457698592f1a3, 0xc51b793dc5b74321, 0xd23a8e1bae872f6d, 0xf5d3e9bcbc683ed9,
+    0x2475ad31fb8c5d47, 0x3bcea4921a7f6cb3, 0x8aec97465c849b31, 0x1b5c6de43764a98d, 0x21ca5d698456b7f9,
+    0x6814fd5ba35bd867, 0xe87a52cba27ce6d3, 0x71da8e6fe4a32751, 0x1d29be5fef7524ad, 0xbc1d64f21f78542b,
+    0x723cb5d43e6b5297, 0x813c5de65b6c71f3, 0xbcda72f87a5e8f61, 0x3b9c426a97528ebd, 0x614bfa8dc765ad3b,
+    0x57e9634fe346dca7, 0xd2af6c31f36aeb15, 0xb4cf8de3235dfa81, 0xc43728d6536128ed, 0xe6fbc2a87f64385b,
+    0xce163b9a9e3846c7, 0x2645ca7bad4b8735, 0x6e4acf5dcb4d85a1, 0x347a68bdc85e941f, 0xeb25c4f1f853c27b,
+    0xa1297fc32845c1e7, 0x6ef5a9132638df45, 0x58f3e6176349feb1, 0xa35c4f69835c1d2f, 0x9b65e8da9f413d8b,
+    0xfa187d3bad234bf7, 0x4c2657dfed286b75, 0x79fb46a1fb3a79d1, 0x85173ea21a2c984f, 0xcb293564372f96ab,
+    0x4f126e587843d629, 0xc65edf4ba726e495, 0x4a513ecba538e4f1, 0xe435f92dc24b136f, 0x3c4f2e9baf1e32db,
+    0xd42be891fe326149, 0x425c9ba32d136fa5, 0x93a821f65c278e13, 0xc2f9d7154a198c7f, 0xef17c256561c8aeb,
+    0xb64e1af9861fcb59, 0xdf14596cb612e9c5, 0xbac5867ed516f943, 0xd8c9127fe328179f, 0xcedf1486542b371d,
+    0x24d517e32efd3579, 0x369e82f43bdf64e5, 0x6d5f34898cf29463, 0x174da6c879e582bf, 0x1dfeba5cb7f8a13d,
+    0xb68e729dc4eabf89, 0x9c13fdeba3ecbdf5, 0xca78d12325e1fd73, 0x147398c653e41bcf, 0x8da4691761f72b4d,
+    0x2db873565fe83ab9, 0x61bf4ec98ced5a27, 0xc571ae2babdf6893, 0xa745639cb9c286ef, 0xcfb87ad1f8e4a56d,
+    0xb7ce14f216e7b4d9, 0xc621da5326ebd347, 0x41e689a765cde2b3, 0x6afe4d9ba7e52431, 0x65dea4cba2e5318d,
+    0xc623e5f98db63fe9, 0xf461dbacbdca4e57, 0x296bdc81f9ab6dc3, 0xaf21b4632abf8c41, 0x2cad153437c28a9d,
+    0xa1b68e4547d5c91b, 0x3af5c27654c6d987, 0x21e6c78984bad7e3, 0x397aec4ba3bdf761, 0x619a738fe3c125bd,
+    0xca2be46fefc6453b, 0xde95a7c21fc853a7, 0x94fcd3754ecb8315, 0xda985f265cbd9281, 0xec29b185468e7fcd,
+    0xc2d816498792ae4b, 0x136c592ba594cdb7, 0xc752163ed4a8ec25, 0x3e7a5d4fe38afb91, 0x6a72ce83238c19fd,
+    0x87eb41d652c1396b, 0x5ea83b165fa348d7, 0xbd3a82576eb97845, 0x45ea96d87d9a86b1, 0x1b67ae5cba8c952f,
+    0xf8c2b97ed67fa38b, 0x39a6b52fe693c2f7, 0xa5746ce328a6e175, 0x53afe2843487efc1, 0x9268bce7648a1e3f,
+    0x9c4ed267617d2e9b, 0x2ec8a15baf825d19, 0x6a18324cbe936c85, 0xc84d9b1edc867ae1, 0xa416357feb6a895f,
+    0x1879ec32185d97cb, 0x2caf1d83286fc739, 0xa4bfd8e54782e6a5, 0xe389adfba597f613, 0x9a72de8cb389147f,
+    0xf9b1e36dc17a23eb, 0xf46592bdcf7e4259, 0xa9ecdb21fe8271c5, 0x719e6a821d758f23, 0x168fe4732b457d8f,
+    0x9ea2567439478cfb, 0xea14cb36574dbc69, 0xaf2534e9864fcad5, 0xc3e841bdc672fa53, 0x8f2d94ced36518af,
+    0x47289ca1f169382d, 0x15c9f8b3215c3689, 0x6dc75e832e3d46f5, 0x71856fb98e619573, 0xdbf1c3687b5483cf,
+    0x273de61a9b57a24d, 0x943cf7ded748c1b9, 0xcd6fa28ed64bcf17, 0xc41ea9bdc54fde83, 0x816df45326531cdf,
+    0x43ac9bf873462c5d, 0xed5a16b761473bc9, 0x8df27ec98f2c5b37, 0xa83c2f798d2e69a3, 0x52a678fdcd53a921,
+    0x154d9c3feb23a67d, 0xc4a75d61f826b5e9, 0x15c96da2192ad457, 0x387acfb6572be4c3, 0x837dec69875ef341,
+    0x12a75c6ba654329d, 0x746ac23dc347521b, 0x143d52fcbe194f67, 0x1a8eb94cbc1a6ed3, 0x92cd5781fb2e8d51,
+    0x6f98ae343c218bad, 0xc92e74565914ca2b, 0xefc837454815da97, 0x4f35bd787619d8f3, 0x2ad7ec9ba52cf871,
+    0x841e7f5ba42f16cd, 0x54cb63dfe512364b, 0x1cb247dedef354b7, 0x1b3c45f21ef98425, 0x2f6eb7354dfb8391,
+    0x92f8a61549eb81fd, 0x83db2a7547de9f5b, 0x3b7a45e986f2bec7, 0x9d2ec17ba7f6ed35, 0x1432d6fcb4e7fca1,
+    0xf24183aed4ea2b1f, 0xb9ea645213fe2a7b, 0xbc8213f652f149e7, 0xb17493e54fe37965, 0xc543a9765de687c1,
+    0x96f2c4a87bda963f, 0x3bac7ef987eda49b, 0x4d956a2cb7dfc419, 0x38d2ab61f7d3e285, 0xe9b3c51437c6f2e1,
+    0xfb9714e546d9215f, 0x352df9b653d92fab, 0x54c7ed2871cd4e29, 0x8c5416e98fc16d95, 0x435d6b1a9dc47bf1,
+    0x5b38a76edbc58a6f, 0xb25ed8a1f6c798db, 0xfa1875c217bdc849, 0x125ecbf326afd7b5, 0xde2b91a768c4f723,
+    0x683be49a94c6158f, 0xce8539ba93c824fb, 0x635842fcb1dc4369, 0x8eab657cbfae62d5, 0xb876dfa1fec29153,
+    0x78a34e921ca37e9f, 0x936f8ba43ba69e1d, 0xcb97268436a8bd79, 0x48dfe215468acbe5, 0x8da4eb79859feb63,
+    0xba38c14dc5a319bf, 0x68dc953fe4b6293d, 0x8b643721f1c837a9, 0x91a6f25432bc5817, 0x28fb5c132fae7683,
+    0xa4d38c165c9184df, 0xf7c426987c94a35d, 0x6ec2d3587a86b2c9, 0x7945e3cdc89ad137, 0xf3a125cdc57bdf93,
+    0xe6af825ba36bdcef, 0x1fa5468215932e6d, 0x2c4e6b9542853cd9, 0xc53e628761a95c47, 0x97a2bc865f7c6ab3,
+    0x728c1efa9d7e8a31, 0xa64d951cbc61a78d, 0x2f48c95eda73b6f9, 0x8f79ed41fa98d567, 0xf6c839121879e5d3,
+    0x2675be94378cf451, 0x1acd3287657f13ad, 0xf21485dba694532b, 0x6feb482dc2a65197, 0xf8d25cabad586fe3,
+    0x3958f26dcd5b8e61, 0x8f59e671f94e7cbd, 0x59271ba32d61ac3b, 0x715ace432953dba7, 0xb718dc654967ea15,
+    0xe13265f8765af981, 0x81eb624a945b17ed, 0x4e18c92dc36f275b, 0xad6c1e2fe18245c7, 0x9617b42fef478635,
+    0xd68e24b32f5984a1, 0xbd37ce154d5b931f, 0xfa2cd9e65c4ea17b, 0x4fbd89376941bfd7, 0x543a9ecba963de45,
+    0xe16df59ba746fdb1, 0x957a24ded6591c2f, 0x3fa84591f34d2c8b, 0x143f9562124e3af7, 0x8dc6f2e981426a75,
+    0x9b4563c76f3578d1, 0x4a85b3c76d28974f, 0x3d4e62187d2c95ab, 0xf147da3cba3ec529, 0x97dc3f4eda41e395,
+    0x2c8b469ed845e3f1, 0x372519c43948126f, 0x27ade846564931db, 0xcdb1a238752c4f39, 0x431bc7f9812f4ea5,
+    0x25d39e7baf248d13, 0xc49e125bad148b7f, 0x5df32c8edc1689eb, 0x759aeb31f81bca59, 0x9c1f2d53291ed8c5,
+    0xf1d56e376a21f843, 0xec7935487824169f, 0x687c45fba728361d, 0x6a179e2dc51b3479, 0x1ebf329cb21c63e5,
+    0x2d34a19cbdfe8263, 0xabc2751edce281bf, 0xb9e63f721be49f2d, 0xc8a749132af5be89, 0x89c7a1b437e8bcf5,
+    0x2d8a94b656fbec73, 0x46291b5764bde9cf, 0x3791ab2cb6f32a4d, 0x937f6bded2f538b9, 0x4c73e9dfe1fa5927,
+    0x27c4fbd321fc6793, 0xcf71ed632dbc75ef, 0x12aecf465ce1a46d, 0xa4c2f1576ae4b3d9, 0x728bf14a9ae8d247,
+    0x795e6dfba7d9e1b3, 0x542e8a1ba6cbef21, 0xc3f428adc4be1f7d, 0x46783a1215c23de9, 0x76e59b1432e64d57,
+    0x4d78c32651e86bc3, 0x896f3b276fdc8b41, 0x8a342cf65cbe789d, 0xe248179a9ad2c81b, 0x1b3d82afeac3d687,
+    0xd5692431f8b7d6e3, 0xdecf7b4328caf561, 0x31e28ab436ac14bd, 0x7945c3b876cf243b, 0xd841e67a94d352a7,
+    0xb2ae41fcb3d78215, 0x5f73ea8baeb98f71, 0x61e289fbab897ecd, 0xd5863271fa8e9d4b, 0x7b8ec5132a91dcb7,
+    0x7359a8d439a4eb25, 0xec397b2547b6fa91, 0x18c639b765a918fd, 0x9287e53a94ad286b, 0xb57942dcb2af36d7,
+    0x7315c49fe1c28745, 0xbc726e3fefa685b1, 0xdbf798621ea8942f, 0x6389c7f43e7ca28b, 0xc423a1e54a8db1f7,
+    0x95f672187a91df65, 0xce3dfb4a9784fec1, 0x915d84bcb6971d3f, 0xdc172aefe4782d9b, 0x4a2985c1f38d4c19,
+    0xc6d7b812129f4b85, 0xcd87be9652a379e1, 0xbd2681f43e74985f, 0x1a9c2e654e5796cb, 0xc6731f898d7bc639,
+    0x16afd94cb97ed4a5, 0x6cfb425eda92f513, 0xca1974efe895137f, 0x71cbd8f2168732eb, 0x5c8d7f64368b4159,
+    0xebd53127627c4fb5, 0x194ce86a918f7e23, 0x47df5cba9e527c8f, 0xe98c5b7a9d548afb, 0x4692eb8fed47cb69,
+    0x5b6e8f21f84ac9d5, 0x9fe1d8b21a6de953, 0xa8d1efb5496217af, 0x4b8a19d76985372d, 0x268df13cb4673589,
+    0xa512fb9cb27a64f5, 0x35ae469dc16d8473, 0xaed7963bad4e72cf, 0x6da5bf81fe63a14d, 0xf9c6be521d34bfa9,
+    0x5a7c83b43b48ce17, 0xb28c1756594aed83, 0x2fc87456563beadf, 0xe35a86fba8612b5d, 0xa67c958ed6543ac9,
+    0x75286c9fe2485a37, 0xfd2a63e1f14b68a3, 0x693eb8f5435d9821, 0x3a2871f43e2f957d, 0xc23d8a676d32b4e9,
+    0xc21e95fa9c26d357, 0x7de3951a9a48e2c3, 0xc7685b3dc95bf241, 0x69a54f3dc74e219d, 0x3c52419ed6413ef9,
+    0x6d957e4218234e67, 0x418ab35654276cd3, 0xb914f5a8723a8c51, 0xdceb37865f1c79ad, 0x4962f5b87d1fa92b,
+    0xb43625acbc12d897, 0x4296cbedca15d7f3, 0x79e4c1bfea29f671, 0x95aefc64382a15cd, 0xeca158f7681e254b,
+    0x3bdf641a982153b7, 0x2b8da35cb7168325, 0x7c9b1a6dc4378291, 0x786b5a398bc67fed, 0xb2fd4e598cfa9e5b,
+    0x423ba7fcb8feadc7, 0x825eadc32af1ec35, 0x8c27bfd438e4fba1, 0xe712bc8658e72a1f, 0x3f514ae765fa297b,
+    0x2dc51b9a94fc38e7, 0x58b1374cb2ef4865, 0x2c8461fed2f386c1, 0x879142cdced6953f, 0x94e1c3721fe7a39b,
+    0x496dcbf54debc319, 0xfb82d6454aced185, 0xba94f8e768b2efd1, 0xe59b48da98c51e4f, 0x5b4831ca95d62eab,
+    0x5fe4682dc5ea4d29, 0x934825c1f2ed4c95, 0x4da7526323ce6af1, 0xfad49b7541d2896f, 0xe637ac243fc497db,
+    0x974a52c65ed8c749, 0x2f49536879cad6b5, 0x1cf3259ba9bde623, 0xb14a8c7ed9c2148f, 0xb79864afe7c523fb,
+    0x945d6f1217d84269, 0xb398a6c434ca61d5, 0xb642ca9762bc7f43, 0x2f1bdc4651ae6d9f, 0x24e9d3187fa39c1d,
+    0x3d586c298ea4bc79, 0x54b96d8edb97cae5, 0xe7c56421f89bea63, 0xe359a4f2168ce7bf, 0x29da31b659b1283d,
+    0x7e2918c657c436a9, 0xac12f3eba4c95617, 0x39a72f8ba2cb7583, 0x3d96a48ba19b73df, 0x98aef16cbe8f925d,
+    0x3b92f761fe83b1c9, 0xb68547321d95cf27, 0xa9e1c5232b87de93, 0x1523ab743768dbef, 0xd97234a6578e1c6d,
+    0x1cfa3e2ba6813bd9, 0xfdab435ed6a35b47, 0x46beda2fe2a769b3, 0xb8d729a1f2ab8931, 0xb8147ad3217c968d,
+    0x8fe42a132d6ea5f9, 0x73dfe9465e92d467, 0x79a5c1387b86e4d3, 0xced6247bab89f351, 0xe2f745cdc87b12ad,
+    0x1bca492ed78e412b, 0xb79e2c1fe5914f87, 0xfa97c54215846de3, 0xcbf697a543978d61, 0xa2d3c6e541587abd,
+    0xf29a45c76f5d9a3b, 0x914cb3a76d4fc9a7, 0xed76935cbc73e915, 0xa2d1b98edb65f781, 0x6c7859e1f95816ed,
+    0xc19fe8a2197c265b, 0x92f56de3286e34c7, 0x65a7e1cba7918435, 0xf132be5cb47583a1, 0xd5a286ecb367921f,
+    0xa9c7defbae389f6b, 0x74913cba9c3baed7, 0x384697dfea3fcd45, 0xb8fdec732a53fcb1, 0x27bcd8e54a561b2f,
+    0x7c93fa2659472a8b, 0x462abce9864b39f7, 0x84b7d29cb63e4975, 0xa51cfb9dc45287d1, 0xc5bd326ed153964f,
+    0x9b5e12afef2694ab, 0x7d8c56a21f3ac429, 0x71b9f3c54e3cd295, 0x65fda8376a4ed2f1, 0x51fe74ca9b54216f,
+    0x365c1e2a98352fcb, 0xbc4861fdc7284e39, 0x5e8a7d4fe62b4da5, 0xe742f891f54e7c13, 0xbe519fc324318a7f,
+    0x8ceab796512398eb, 0xc743a2e54f16c859, 0x3eb285176e19d7c5, 0xd5b4387a9b1ce743, 0xc94157dba81de49f,
+    0xbc6938efea24351d, 0xb9864ef1fa164379, 0xfe9b5d14381962e5, 0x984fad26572c8163, 0xce48a9b6531c6eaf,
+    0x42c3618984319e2d, 0xa42196e76ef2bd89, 0xca4fb2e98ae4cbf5, 0x69a45cedcaf8eb73, 0xd93b412cb6d9e8cf,
+    0x7cde29b328fe194d, 0x491f673548f137b9, 0x4de3916769f45827, 0x47e3fa2ba4f87693, 0xdf17236982d974ef,
+    0x5afd23cba1fc936d, 0x178b46e98ecfa2d9, 0xd7382ae1fce3d147, 0xd8feb6121bc5dfa3, 0x61297b854ac8fe21,
+    0xa83df1e548ca1e7d, 0x1f34ad8656bd2ce9, 0xf52a8e4ba8e14c57, 0x1d92b87cb5e46ac3, 0x12bc548ed3e78a41,
+    0x49a3f651f1ea879d, 0x65bea3f432eda71b, 0x1f586c232ebfc587, 0x6ecadf376cb2d5e3, 0xd6c5ef798bc7f461,
+    0xfb1976c879c813bd, 0xcf263a1ba8dc423b, 0x62b183ded6ce41a7, 0x3518cabed5b16ef3, 0x16495c2325c48e71,
+    0x32c689f432a57bcd, 0x8ebadc1651d89c4b, 0xe87b23454f8dcab7, 0x359a1e787c9fda25, 0x3412eacbacb3f891,
+    0x5492acbdc9a517fd, 0x468fcb51f8c9276b, 0x14b9cd3218ab35d7, 0x519b4d7328be7645, 0x2a1d749876c284b1,
+    0xce6b324984b5932f, 0x5643f1da92c6a18b, 0x17e4bd5a9d68afe7, 0x5f874c1bad8bce65, 0xa7b9321cb97fedc1,
+    0x9df6ea232b941c3f, 0xa6f721c43a852c9b, 0x287b45f657a84b19, 0x97bcef28769c4a85, 0xa8f1372ba49d68e1,
+    0xe432815dc3a1975f, 0xc128e39fe18395cb, 0x26cab37fef87c539, 0x871feca21f79d3a5, 0x18a43d265d8ce413,
+    0xac926b354a6de17f, 0x9ec6b3787a8431eb, 0x749fa62cba863f49, 0x652e783dc6784eb5, 0x8a7d2b3fe58b7d23,
+    0x3c5648bfe25d6b8f, 0xd216ac73236189fb, 0x714ae8654173ca69, 0x32598e143f46c8d5, 0x637fe4287d6ae853,
+    0x6f13e2b8794be5af, 0x1aefd87cba7f162d, 0x2aed796feb723489, 0xa731849fe98763f5, 0xb519a642196a8273,
+    0xcd35e214345a71cf, 0xbf92eca7625c8f3d, 0xb5acef387251bea9, 0x1e8b3f4a9f54cd17, 0x82e36a4bad46ec83,
+    0xb94a6e8cba37e9df, 0xb5ed28c1f94c1a5d, 0x498a3c121a4f28c9, 0x76bd41c54b625937, 0xe348dc79894567a3,
+    0xa4f8d69cb65a9721, 0xd12c6e4ba23b947d, 0xe9f6837cb14da3e9, 0xc6428a9dcf41d257, 0xf5de78b1fd45e1c3,
+    0x4fa6cb932c47ef31, 0x839ad4154b391f8d, 0x725f1d36583b2df9, 0x72f546c9892f3d67, 0x6a92d45ba8426bd3,
+    0x91d73f6ed7368b51, 0x5e276bcfe32678ad, 0x6bc4e571f13ca82b, 0xf3b6ec84312ec697, 0x542d18a65e21d6f3,
+    0x716c5de98d24f571, 0xda64f1798b2714cd, 0x7912edfa9c1a234b, 0x73a914cdc91d42b7, 0x954cfa7ed93f7125,
+    0x1e48956fe6237f81, 0xca1e8f4325147ced, 0x7ef8c34543179d5b, 0xb91dce465219abc7, 0x4e826f376efcdb35,
+    0xe98fdc176bdfe9a1, 0xde59a68babe4291f, 0xa31b256edaf5287b, 0xbad5137ed8f936e7, 0xe6d4a5c219fc4765,
+    0xbe2d375436fe75c1, 0xea74d92876e1943f, 0x2673ef4873f4a29b, 0xf158349ba3f7c219, 0x678ecb398ed9cf75,
+    0xa4821e3989baced1, 0x7483912cb8adec4f, 0xce785d1219e32dab, 0xfea261c43ae64c29, 0xaf21c37437e84b95,
+    0xa2d4e95875db69f1, 0x2c79d58a93cd786f, 0x164c3e5ba3e196db, 0x6f34bdaed1e3c649, 0x7136ba9fefc7d4b5,
+    0x1c679f421fcae523, 0x7bfac3543cabe28f, 0xb147fed659ae12fb, 0xe8254c198bd34169, 0xdbe31f7a98b64fc5,
+    0x51ef489cb6c97e43, 0x8ad63cbed3ba6c9f, 0xced6fb41f3ae8b1d, 0x9f16d8b323d1cb79, 0x714e92b541b3c9e5,
+    0xd3f78ac54fb7e963, 0xad3cb2654c98e6bf, 0xce1f32d98bac173d, 0x249631adc8bf25a9, 0x752a6b8feac36517,
+    0xcda92b61f9c67483, 0x758c349215a872df, 0xad831f6434ab915d, 0xb639f2a5427d8fb9, 0x6f73ace983a1ce27,
+    0x7e64b3a87f84ed93, 0x5cfeb1d98b75daef, 0x369e1b8fec891b6d, 0xf58e2cb1f87c2ad9, 0x3cbd1f721b9f3a47,
+    0xf74b231549a268b3, 0x3f19d4a657b69831, 0x684e5c1763a7958d, 0x758b6ce9827ba4f9, 0x6af7328cb19ec367,
+    0x6a5184ecbf81e2d3, 0x97b61defed96f251, 0xf5179b243e8721ad, 0x841329f54c793f1b, 0xa986df154a6c3e87,
+    0xec2a18b7687f5ce3, 0xf5d8a69cb7938c61, 0xcf3e172dc36479bd, 0xe8bca1dfe267a93b, 0x4c3b7ea1f15bc8a7,
+    0x6d5c7e94327ed815, 0xbf83a9e54e72f681, 0xf4a96c276c7415ed, 0x342edf6a9d78245b, 0xc493d71a9b6a43c7,
+    0x9782f3edca8d7235, 0x4f1973ded86f72a1, 0xb2937ecdc4527efd, 0x7bae54d213549e6b, 0x8b327c943246acd7,
+    0x17fa9468716adc45, 0x4a93d8b76f4deab1, 0xd139f5ea9d631a2f, 0x6925a81dcd54298b, 0xd238671edb4638f7,
+    0x6f3d5ea1fa3b4875, 0x28ec1a93294c76d1, 0x9e2b64c3273e854f, 0xaf693c48765293ab, 0x967e4adba456c329,
+    0xadf45b3cb248d195, 0x3c4e2a598d39cfe1, 0xb597d26a9a2bed5f, 0xc58afe61fa412ecb, 0xf175be621c254d39,
+    0x5c62a8d43b274ca5, 0xe2cbdf47694a7b13, 0xd52c3819852c697f, 0x28d1c7ea942f87eb, 0x732c5b6ed432c759,
+    0x78952defe124d6c5, 0xfd61324edf19e643, 0x582a6f432d1ae39f, 0x38a59fb76c3e241d, 0xba24cf798d314279,
+    0x5c8ef26a9b2461e5, 0x8529a14cba187f53, 0xb3f547acb5186daf, 0x362a85efe51b8c2d, 0x8c249a6fe31fac89,
+    0xa561e9343412caf5, 0x849b1d276215ea73, 0x657abe143bd5e7cf, 0x1fb3c6276cfa184d, 0x4a6f23b87afd26b9,
+    0xae36849cbaef4627, 0x5f9acd1edaf27593, 0xb5e23a1dc6d573ef, 0x38af7c9215f8926d, 0xcd93fa1434fba1d9,
+    0xc4b91a5652edbf37, 0x6c21e49872f1dea3, 0x4a6317f98ec5fd21, 0x1eb9365a9be61c7d, 0x87e96f3dcad82be9,
+    0x6d39b2f1f9ed3b57, 0xdc1fb67218df59c3, 0xc8952f365ae38941, 0x97beac2435e4869d, 0x19d3c7f874e8a61b,
+    0x4527bd9a92ebc487, 0x278cf4da91bdc4e3, 0x34d1b52cbec2f361, 0xd9b28f51fec512bd, 0x1a4578b32ed8413b,
+    0xcaf896d32bca3f97, 0xf21bce3548ab5df3, 0x4738951658bf6d71, 0xd8351a7985b27acd, 0x9a58214dc3d59a4b,
+    0x687c1bdfe2d6c9b7, 0x359eaf21f1cbd925, 0x3f6a98c432bde791, 0xa74281654ea216fd, 0x519c4f787ec4256b,
+    0x4b3c6fa76cb834d7, 0xb1985e6a9acb7345, 0xaec6b94dc8ad73b1, 0xf9c147adc6ae812f, 0xc73de8afe4a29f7b,
+    0xf3a18b921394ade7, 0x795f36b432a8cd65, 0xfc9421365289ebc1, 0xc7b594e65d7cea3f, 0x12ca9d587e812a9b,
+    0xfba4183dcdb54a19, 0x1784ed5fecb74985, 0xc49fe871f89a67e1, 0x4d1b9cf2179c865f, 0x6b5298d3257f84cb,
+    0xd39f724876a2c439, 0x1f4dc8698396d2a5, 0x425719fcb4a9e213, 0x4b75ca398c59de6f, 0x4cbd326a9a6c1fdb,
+    0xe324a7c1fc813e49, 0x16c5abe21c834db5, 0x1ec769854b987c23, 0xab86517437596a8f, 0x2ca631b7645c78fb,
+    0xc762839ba35fb869, 0x1f962e8cb382c7d5, 0x738cda5ed196e753, 0xcef97badcd57e4af, 0x28c3b9f43f7b152d,
+    0x12bd98e54d6e2389, 0xac71be287c8162f5, 0xc61978abac958173, 0x613984ca98456ebf, 0xe8b9a56cb6598e3d,
+    0x52e67a8fe34c8da9, 0x4a7d1bcfe35fbc17, 0x61bf79d21462eb83, 0xb98aec343154e8df, 0x3c4d95176f48195d,
+    0x1465b2e76e4b27c9, 0x482671cbac5e4837, 0x2b16483edc5176a3, 0xeb4c987feb759621, 0x23968741f846937d,
+    0xae5897321648a2e9, 0xcfb2d634364dc157, 0x4a21b5f7624ecfb3, 0xe478dc3a9264fe31, 0xb6d2cf8a9f351e8d,
+    0x6d457c3bad372cf9, 0x2854db3fed2b3c67, 0xb67d3891f92e5ad3, 0xfe32d6b43c428a51, 0xca2b4315492387ad,
+    0xd923b8765836a72b, 0x526b8139842ac597, 0xe295c7ba942bc5f3, 0x145d8b7cb23fe471, 0xfa56913cbf2413cd,
+    0x6afdbc71fe17324b, 0xe79318d43e2941b7, 0x7bd18fa54c2b6f15, 0xf4be3cd65a2d6e81, 0xa94d3f1768217bed,
+    0x8d3a59eba7139c5b, 0x84c29d6ed415bac7, 0xa1c7e35fe419da35, 0x92f647d1f32ce8a1, 0xe7a38fc5432de71f,
+    0x4ae1fc354ef1267b, 0x6ae59cf76cf435e7, 0xd53b7f198cf97465, 0x16b7843989fa74c1, 0x425f8d7ba7ec823f,
+    0xf1ae654dc5ef819b, 0xc72ae53dc4d2aef7, 0xc47df5a213f4ce75, 0x6f1283a543f7ecd1, 0x25f791b651d9eb4f,
+    0xae8b7d565fde1cab, 0x617ac3598de14b29, 0x29e487acbce34a95, 0xf6512a8dcad768f1, 0xbe5a378fe5da876f,
+    0x73e59fa216ec85db, 0x7c452ad326dfb549, 0xaf475c2876e2d3b5, 0xcd12e84a95d7e423, 0x9452efca92c7e18f,
+    0xb46287c98eca21fb, 0xda1f428bacbd2f59, 0x8673d251fab14ec5, 0x187f3e521bc57d43, 0x9f28d75328c56b9f,
+    0x4bfe837546c98a1d, 0x9fac842654cdba79, 0x5e67bcf873afb8e5, 0x5feb34acb4c2e863, 0xb926ca8dc1a4e5bf,
+    0x692bda4fefb9163d, 0x9a3854d21fbc24a9, 0x3f56dae43dbe5417, 0x1fc6dea76dc17283, 0x5e6da42769a471df,
+    0x4576e32a97a68f4d, 0x7ebc45fdc4a78eb9, 0x38bd567fe49cbd27, 0x7d1583bfe28fdc93, 0x58fb6a921382d9ef,
+    0xf41c792542b51a6d, 0x192f7bc54fa728d9, 0xb4cf52e76eac3947, 0x6521fd398c9e57b3, 0x724ad8bedcb29731,
+    0x78ca429fe7a3948d, 0x12956ecfe586a3f9, 0xb18dac32159ac267, 0xace82675458bc1d3, 0xa1bcf537638edf41,
+    0x95d4fa3872831f9d, 0x94b3c2ea9f863e1b, 0xe58f971cbe693d87, 0x7f4256cedc7a5be3, 0x7ca83fb1fa8e7b61,
+    0xd9467ea32a6178bd, 0x6e4b59a32974a83b, 0x136ab2943485c6a7, 0x6e1f729a948ad715, 0x71e68f3ba37ce581,
+    0xc4b896ea916cf3ed, 0x15c7a6fedf84235b, 0x94c3a871fe8642c7, 0xeca9df532e8a7135, 0x8bcfd6743c5b6f91,
+    0x5136fed4384b6cfd, 0x6597324878519d6b, 0x47bfe93a9653abd7, 0xbe6571fdc367db45, 0x538d149ed358e9b1,
+    0x856c27ded15be82f, 0x6d239a74325f178b, 0xd1a8f9754e5236f7, 0xc8d4176a9e384675, 0xda1357498c4975d1,
+    0xd93e765a9a5b834f, 0xa879516dc74e82ab, 0xc47abedfe863c129, 0x4b71da5fe643cf85, 0xbe81a4732546cde1,
+    0x89f4d3754238ec5f, 0xfd13e497624a1dcb, 0x16fab5e87e4f2c39, 0x4b968fca9e324ba5, 0xe1bf75adcd467a13,
+    0x2ad8c54edb29687f, 0xd9f6c7b1f72a86eb, 0xc93adbf2182eb659, 0x5639dfc76831d4c5, 0x8b94236a9826e543,
+    0xd521abf98436e29f, 0x39e1268cb45a231d, 0x8eb9a56cbf2d3179, 0xa8271efbab1e3fd5, 0xd59e7831fc127e53,
+    0x7dfec8232b146caf, 0xbf9236a54a178b2d, 0x38d19c25461cab89, 0xb54c6a18761db9f5, 0x64af5e8cb621e973,
+    0xe941fd2ba413e6cf, 0x794a25efe328174d, 0x695fb72edef825b9, 0xf7ea1d421efc4527, 0xafcb72632cfe6493,
+    0x582e9ab65ad172ef, 0x693f1b287af4916d, 0xe5f4796876e58fc9, 0xaf34751ba5f9be37, 0xc38f6d9a94fbcda3,
+    0x1235d7fcb4dfec21, 0xae89465324f31b7d, 0x2f8eb61541f52ae9, 0x9c7f6e454fe93a57, 0xe8fadc676deb58c3,
+    0x7c4db5fa9bde7841, 0x48f3a2bcbae1859d, 0x639f8baed8e4a51b, 0xbc6749a1f5e6c387, 0x98561df216d9c2e3,
+    0xe91648a545dce261, 0xdba82f15429cefad, 0xf3bdea6981d43f2b, 0xf2c13b498fc53e97, 0x5ef78d3a9db85cf3,
+    0xc34e1dbfeadb6c71, 0xc84a3fb1f7ae69cd, 0x495bc26328d1a94b, 0xc891b5a326d3c8b7, 0xab34197546c7d825,
+    0x3b6dfc2874cae691, 0x975613d8729ae4fd, 0xa834fc6ba2cf146b, 0xebc2873dcfb243d7, 0x9ac6b851fec87245,
+    0x97b6e2343ec972b1, 0xa9728c543b9a7e1f, 0xb37216a4369d8e7b, 0x57982c465691ace7, 0x691e4fca97a3dc65,
+    0xedb71a2cb496eac1, 0x84cef9adc2a8e93f, 0xc8eb5931f2ad189b, 0xe8bd3c6542bf3819, 0xec2165b43fb24785,
+    0x79ed31c54da576e1, 0xe84a56176ca9845f, 0xbd38e9f7697a83cb, 0xa348ce1dc78eb239, 0xda61bc5fe792d1a5,
+    0x87b4c13ed584cef1, 0xe97d4f521385ed6f, 0xe2689b4543781edb, 0x9b28f517618c2d49, 0xc48af3b76e7f3cb5,
+    0x8652edabae947b23, 0xf3942dbcbc74698f, 0xdfbc539eda5687fb, 0xe43d9571f85cb769, 0x34f7db92187eb6d5,
+    0x8af9c4e54891e653, 0xfca431976574e3af, 0x3c8124fba598142d, 0x4895fc6dc17b3289, 0x18dfc73bae7c41f5,
+    0x761a43ecbc7e5f63, 0x8529de1fea526dbf, 0xe37b64f21b658c3d, 0x2e6714a32b468ca9, 0x1ceb7685485acb17,
+    0xf37c1458765eda83, 0x3c1f627a9451e7df, 0x1542eafdc374185d, 0xc17529bfe15726c9, 0xa34be96fef5b4637,
+    0x5b17a6d21f4d65a3, 0xdc8714a54d6f8521, 0xa846b3976c53927d, 0x3c9eda487b45a1e9, 0x13a7f92ba938bf47,
+    0x167c45aba649ceb3, 0x9a1edb3cb65ced31, 0xba952ef1f4521c8d, 0x6fe154b213542bf9, 0xf872315651483b67,
+    0x549a61f76f2a59d3, 0x86ce72398e3d7951, 0x1b632a498b2f76ad, 0x53af1b8edc43a62b, 0x396cebdfea25c497,
+    0xbe2a936fe728c4f3, 0xcea96d83284be371, 0xc4da98b5453bf1cd, 0xef614d8a9762314b, 0x1d8e645a91243fa7,
+    0x4a8162dbaf286e15, 0x7e43a6bcbe2a6d81, 0xab7f1e4dc91b6aed, 0x5c196edfe91f8a5b, 0x86ae35743a12b9c7,
+    0x36981c254a16d935, 0x9f72ed565628e7a1, 0xefd71549852ae61f, 0x56e82a3ba42e157b, 0x5f328c6dc52134e7,
+    0x3ba8c57dcef27365, 0x13acbedfedf673c1, 0x42a867132ce9813f, 0x9e68c15329ea7f8b, 0x325fbae436ec9df7,
+    0xbcf65d3768f1cd75, 0xafc2176986f4ebd1, 0x2341ef8a93d6ea4f, 0xc93a145ed3f819ab, 0x98735eafe1fd3a29,
+    0xc18b4e9321ef3895, 0xc2bd91854ed367f1, 0x7d95ae343cd4856f, 0xe78c9fd65ae784db, 0xda56432878ecb349,
+    0x5d1cf2ea97dec2b5, 0x3e796cadc8d4e123, 0xef8ab69dc4b3de7f, 0xe79612f324c61feb, 0x1c8d9a6543da2e59,
+    0x6b2a8f5761eb3dc5, 0x5db632c87ebf6c43, 0xb541cd787dc26a9f, 0x3da617ebabc5891d, 0x542c1b6fead6b879,
+    0x9a47b6c1f6cab7e5, 0x7c86e3b218bed763, 0x21bef36436a1e4bf, 0xa4286d1987c6153d, 0x5eb1827984d723a9,
+    0x857463dba2db5317, 0x465e83fbafbd6183, 0x3e95716a9a8d5ecf, 0xd6347ef1fba28e4d, 0x57b319d21ca48db9,
+    0xfcde3a1439a8bc27, 0x3a97c415468adb93, 0x483c95d6547bc8ef, 0x1f365c4ba5b2196d, 0x3f8cb79dc3b427d9,
+    0x618cad7fe1c93847, 0x53964a7fef9a56b3, 0xd5f9eb832fad8631, 0xbcf5d2132c9f738d, 0xf1abd9565c83a2f9,
+    0x14637ef98ba5c167, 0x35427e9a9687bfc3, 0x92b71e4cb68ade41, 0x4d857e1ba36bfc9d, 0x95abc381f5923d1b,
+    0x4f96c1d212a43c87, 0xd749bef541975ae3, 0x479ba2f54f8b7a61, 0xea41c8b54e5c67bd, 0x8e35a2d98c6f973b,
+    0x5984cb3edb82c5a7, 0x9278eb6fea97d615, 0xca6b3571f679e481, 0x5ebfd4821569f2ed, 0xf3d1c9e5468e125b,
+    0xf4dbae29859241c7, 0xcf81275ba1946f25, 0xca62d18baf576e91, 0xd92fe16a9c486bfd, 0xe7a2416fea4d8c6b,
+    0x2b513a8fe84f9ad7, 0x38f5d4c21b72da45, 0xe2a768f43965e8b1, 0xb3e7ad854658e72f, 0x41d27b3a945c168b,
+    0xc64529fba36d25f7, 0xda61347ed2916475, 0xc891f27dcf6574d1, 0x3b47625fed57824f, 0xe219dcb32e4981ab,
+    0x1b92fa843b4caf19, 0xbc17e395493fbe85, 0x4d51c3687853dce1, 0x27d3f8ea9734eb5f, 0x3d8b26fed5471acb,
+    0xa3e725cfe45c2b39, 0x3fc576a1f14e39a5, 0x5a23c17654627913, 0x9c4abf654e23867f, 0xe74f1a854d2685eb,
+    0xfba96dc87d2ab459, 0xc85423f9892db3c5, 0x4a76f89cb95fd243, 0x2acf148dc743e19f, 0x2f6b7c31f857321d,
+    0x3fea148215382f69, 0x539b1f47642a3ed5, 0xa5c67849812e6d53, 0x4269ea187e216baf, 0x42e8cb1a9e148a2d,
+    0x361a298dcd15ba89, 0x543b69aeda19b8f5, 0xf9ba47c1f91cd873, 0x9a5dec13271ed5cf, 0xf2917b387923164d,
+    0x63db2879871624b9, 0x7632dabcb61a5427, 0xe69df8bcb41c6293, 0xb12cf5798cdb61ef, 0x4d258f9a9ace7f5d,
+    0xf13b862edaf28ec9, 0x4a18fec21af5bd37, 0xdf4ea1c328f7dca3, 0x9248afb657faeb21, 0x4efd289654ecf97d,
+    0xa8f73e5ba5f128e9, 0xb8a75efdc2f43957, 0xda4819bed1f857c3, 0x1625d3bedfeb8741, 0x85fedab21fec749d,
+    0xe189fc743cdf941b, 0x984ed3a65be3c287, 0x94e173c879d6c1e3, 0x185bcd9a97c8df51, 0xb2fe7c1874b8fead,
+    0x58f42c6ba5cd1e2b, 0x9f65ed31f4e13d97, 0xcba34e7212d45bf3, 0x78143a6542e86b71, 0x81cd2ae43fb968cd,
+    0x57cdaf865ecd984b, 0xacf193e659cfa6b7, 0x7d1a2ebcbac3d725, 0x7adfb61ed8c6e591, 0x96a3428dc5a7e3fd,
+    0x4cb2f97327dc136b, 0xbd86391545be32d7, 0x3f9b6e8a96d27145, 0x2eb3dc8982c46fa1, 0x7a3b26498ea67d1f,
+    0x3e6fb2d76ea98d7b, 0x9b67812eda8c9be7, 0x86a514dfe89fcb65, 0xc76b15a328a3e9c1, 0x4786fdb327a5e83f,
+    0x4e892f3545c8179b, 0x13b5da6985bc3719, 0xf863271ba2be3685, 0x75fa8cbdc3b275e1, 0xafc3429dcea4835f,
+    0x2dc9f4b1fe9682cb, 0x5cd689e32e8ab139, 0xa51f24832a7cbf95, 0x4cf81695487ebdf1, 0x8fe97ad65782ec6f,
+    0x962fe85a96851cdb, 0x8fa5d1ced5a82c49, 0x3ce9765fe28c3ab5, 0xd479a5e1f19e6a23, 0x615f9ca432a1678f,
+    0xe6d158432e7386fb, 0x59cf7bd43e87b569, 0xeb3f89676c79b4d5, 0xc1e32fda9a8cd453, 0x82c34f6a976ed2af,
+    0x478a329fe895132d, 0xe897a5c1f5a63189, 0xb51af38214783fe5, 0x19fd8c35428b5e63, 0xdaceb985416d5cbf,
+    0xa5fd41387f618b3d, 0xb4d79e687e538ba9, 0xf3684aecbd56ca17, 0x9d2ab57feb5ad983, 0xeda1bc6fe74ac6df,
+    0x437ebd92184ef65d, 0x7bd19425487325c9, 0x294c761ba6984537, 0x536d291cb27964a3, 0x312ea46cb37c8421,
+    0x75ad498baf4e817d, 0xe87a329cbc418fd9, 0x5e3b8f71fc53be47, 0xd6a843521a46cdb3, 0xbead28354a59ec31,
+    0x27439c85463bfa8d, 0x962bec18764e1af9, 0x5b43a9edc8523a67, 0xf395b2edc24658d3, 0x7156da3fe24a7851,
+    0x4cdbe31fef2b75ad, 0x1dfb93421f3e952b, 0x415ce7265e41c397, 0xa2543d687b45c2f3, 0x64938fca9b48e271,
+    0x1ea6bf398627efbd, 0xf67c89aba74c1f3b, 0x138945adc53f2ea7, 0xdb23f781f7436d15, 0xc496fad324356c81,
+    0xc91e6fa5412769ed, 0xadebc1354f1c895b, 0x34c5b8765d1ea8c7, 0x4ea79c1bac21d835, 0x16253c8dcb24e6a1,
+    0x56ae128dc927e51f, 0x698c5db1f82a147b, 0x7a436915481c23e7, 0x39e4db78781f4265, 0xdb69f45a963472c1,
+    0x7df36c9a93157e2f, 0x86baf2d76df57e8b, 0xe4b9af576be89cf7, 0xde14385ba9fdbc75, 0xb3768efcb7efcad1,
+    0x85b76ce218d2e94f, 0xd659ac7437f518ab, 0x2a43df8656fa3829, 0xdbca564984fc3795, 0x618db54a93ed56f1,
+    0x47519e6cb2e1846f, 0x9c31d52bafe483db, 0xdcf73b61fde7b249, 0xa267f5432de9c1b5, 0xda2b7c3549dbcf13,
+    0x657213e436aecd7f, 0x59d36a8767c31deb, 0x1498d67ba7e62d59, 0xf9ed784ba4e83bc5, 0x67c28f1ed2ec6b43,
+    0x12c378dfe1cd589f, 0xe8a64dc543e2981d, 0xb1529fc32fd3b679, 0xe1a983643dc7b6e5, 0x5c39bf787bcad563,
+    0xfa25e6b7679ad3bf, 0x35f17dea97aef23d, 0x736debcfe7d432a9, 0x43fba2d1f6d85217, 0xb4cd5e3214c95f73,
+    0x683517c432a95dcf, 0x2c58af1651ae7c4d, 0x2c7589a65fa18cb9, 0x2cad36198ea4cb27, 0x3862ab798cb6da93,
+    0xf39b162cb698c7ef, 0x81a4e65fe59bf76d, 0x15fbe82327af16d9, 0xcd49bf8659c23647, 0x8b4f61d984c765b3,
+    0x38c9b5ea94ca8531, 0x4c1fb2da91ab728d, 0xf5ac768bae7d81f9, 0x768ebafdcd91bf57, 0x8bfa7e91fa84bec3,
+    0x5d78b2632b97ed41, 0x4851e7d32867fb9d, 0x1c79b8a6578d2c1b, 0xc1e35827659f2b87, 0x3962deacb6a259e3,
+    0x5c72861ed3b57961, 0xb7ca619fe19876bd, 0x8cd7e52fef7c963b, 0x169834521f6eb4a7, 0x4c532a976e92d415,
+    0x8b9f3ae76c95e381, 0xb4c518365976f1ed, 0x5e9c8abdc98a215b, 0x592efa1ba56c2fb7, 0xc74f8e3dc68f4e25,
+    0x897fabc1f4836d91, 0xbc3fe54212746afd, 0xc968752431578a6b, 0xd9e327f43f4ba9d7, 0xb6df91487d6ec945,
+    0xf8bc764a9c62e7b1, 0x5f2e3a6cba74e62f, 0x4358edcfea67158b, 0x28a4de5fe86a24f7, 0xe165a3b2198d4375,
+    0x68f7de45457f63d1, 0xcdb52f8a9573814f, 0x4836c1b981547f9b, 0xfd685b498f47ae19, 0xf4b6d9ea9e3abd85,
+    0x172f58eba94dcbe1, 0xc51d7b8ed941ea5f, 0x8b27f5932a5419cb, 0xced4b7154b572a39, 0xa2c5b4f7674b38a5,
+    0xc497a26ba75d6813, 0xf5d786cba23e657f, 0x546ec7fdc15284eb, 0x563dab4edf26b359, 0x9c2d6eb1fe38b2c5,
+    0x7f685ca32e5bd143, 0xa68e91f4392bce8f, 0x85e1dc9769421efb, 0x327cfbd98a342e69, 0x25e46dcba8273cd5,
+    0x7f81943ed72a6c53, 0xacb9f13ed32c59af, 0xad7b8e9fe13f792d, 0x6e9a7d454132b789, 0x3de789243e14b7f5,
+    0x941a3cb65e19d673, 0xedcf14a76a19d4cf, 0xefd6bc39891cf34d, 0xb5928f7eda4123b9, 0x245d916fea165327,
+    0x6b32c951f7286193, 0xdb7cf2e324185edf, 0x47ac8e15431b7e5d, 0x1f289436521f7dc9, 0xe4cb95a76ef1bc37,
+    0xc94b1fe87cf4dba3, 0x9743bfea9bf7ea21, 0x7ef189dcb6e9f87d, 0x47c5a6ded6fc17e9, 0x58cfd74219ef2857,
+    0x93ac71d548f256c3, 0x765928fa95f78641, 0x89cbd61762f8739d, 0xd853164982fc931b, 0x41e35d7a9fdeb187,
+    0x69b8d45a9ac1bfd3, 0x37ba9541fac4de51, 0xa19edbf218b5fcad, 0x78e9163548e91d2b, 0xb96a4f3546ed2c97,
+    0x4b6ed52876ce4af3, 0xd12b478cb5e36a71, 0x35861faba2e467cd, 0x791c2daed1e8974b, 0x134c6bafefdca5b7,
+    0xed3179621fbec625, 0x2e1a3f865dc2e491, 0xe3a71cb659a4e2fd, 0x2ac159787ad8126b, 0x354c671a98ca31d7,
+    0x75f9241ba7bc4f35, 0x53fe468dc4bf5ea1, 0x46951bafe4b37c1f, 0xb89317e212d48c7b, 0xa92f516431c69ae7,
+    0x326f7ab43f9bca65, 0xd513ef265b9ed8c1, 0xaf2b4d698ba1e73f, 0xab89126edac4169b, 0x2365bacfeac83619,
+    0x5cbf87a1f7cb3485, 0xd647c8f327ac64e1, 0xdb5781f434ae725f, 0x36f945e764a381cb, 0x793514c871b5af29,
+    0x3f4182976f87be95, 0x8ac562498d79bcf1, 0x3f7cda9ba97cdb6f, 0x3b4ce861f9821adb, 0xbe5a8f421ca52b49,
+    0xb269ca1328a739b5, 0xf182ecd657ab6923, 0xf4d93c58739c568f, 0xfe46bc2a928e75fb, 0x31f74b6ed1a2b469,
+    0x81b4673dcf86b3d5, 0x239c7b51fe89d253, 0x5ac71de32c69d1af, 0xf89bec54396bef1d, 0x9af1e4865b812f79,
+    0x5bd627e879843de5, 0x86214d7cb7985d63, 0x9e4ac2fdc3685abf, 0xa15d3ebfe26c7a3d, 0xd756cb3fe15f78a9,
+    0x8cba39e54283c917, 0x28eb91c32f65d783, 0xfe1acb843b47c5df, 0xbed19c287b6af45d, 0x71e5fc898a6e14c9,
+    0x79b136aedb915437, 0x79e5ca6fe98562a3, 0x472dc3f1f6798321, 0x537ecfb213497f6d, 0x9ce31b54324b7ed9,
+    0x9e3af147615fad47, 0x1e632bd87f52dcb3, 0x76f2345a9d56eb31, 0x8d6179ebab36f98d, 0x92d6b48eda4b18f9,
+    0xc62b79f1fa4e2967, 0xc2187e632a6157d3, 0xec591bf43a648751, 0x4e6dc5f9853674ad, 0xdf685319835a942b,
+    0x43a2e7dba14db297, 0x7815394a9d4eb1f3, 0x31e74b5cbc43df61, 0x89237fedc924febd, 0x4b1a72832c481e3b,
+    0xf21c8375493b2da7, 0x4f965b38793e4c15, 0xae2f854ba9426b81, 0x4c31d86ba52368ed, 0xc6a927ded326985b,
+    0x17da4b2fe129a6c7, 0xce7439afef1dc735, 0xfb615de43e2fd5a1, 0x62d439576c23e41f, 0x3c2f67b98d26137b,
+    0x6be3f2a98b1932e7, 0x384d167cba2c4165, 0x465ed79ba72d5fb1, 0x97126efdc6317d2f, 0x5dbc7a61f4137d8b,
+    0x8edc19b323159bf7, 0x42e698d54219cb75, 0xa416f2c54efac9d1, 0x179cfae65aecd84f, 0x84eac1598cf217ab,
+    0x78a259edcbf53729, 0x2481a69edaf83695, 0x4ac8f5ded7ea65f1, 0x64cedf9215ec736f, 0x8a9c3f7434ef72db,
+    0x2931c4b875f3b149, 0xac2df6b871e4bfa5, 0x371ecdb87fd8ce13, 0x84632b576ab9dc7f, 0x26e14bc9879cfaeb,
+    0x3274ecd1fae12c59, 0x6ced581219e43ac5, 0xfe1498c329e86a43, 0x73cd2af434da579f, 0x8a1f42b764ec871d,
+    0xd47efbc982dfa579, 0x9264d8eba1d2b4e5, 0xa85b7decbfc7d463, 0x5b6418efeca7d2bf, 0x2cf6e8132cbaf13d,
+    0x678cdb354bce21a9, 0xd9e1c2f769b13ef5, 0xdc35648989c45e73, 0xbd53ca1984a65bcf, 0x5764daeba3c97b4d,
+    0x1be6c57fe2cd7ab9, 0xa9cebd1fe1cfba27, 0xa12b369541c2d893, 0x87ab2cd32d94c6ef, 0xa286bf743ca8f56d,
+    0xe45ad8276cab15d9, 0x6f185c2a9abe2547, 0x58439daed9c164b3, 0x5e1639cfe9c68431, 0xd2af3b51f4b6718d,
+    0xb7aef45213a87fe9, 0x7b9d85f4329cae57, 0x38eadbc6518fadc3, 0xb319e2a87f93ec41, 0x328c6eb76c74fa9d,
+    0xc7846b3dcd982a1b, 0xe68acd3feb9c2a87, 0x5d846a21f79d48e3, 0xe82f79d43ab27861, 0x1d59ef23269375bd,
+    0x9d652bc764a7953b, 0x91fd64b76289b3a7, 0xc537f6eba29dc315, 0x5afe732bae7fd281, 0x861fbc7a9a62efcd,
+    0xbd56798fec861f4b, 0xd8f13a621c682eb7, 0xa1e5b6843a8b4d25, 0x328c7f65487e5c91, 0x1a24d7c9857169fd,
+    0xb14ae56dc473896b, 0xc915b6edc265a8d7, 0x5eac317fe17ac845, 0xa1e54b3fef5cd6b1, 0x354bc8e21c6ed52f,
+    0x8f7ad4165e73148b, 0xfe8c5b365c8623f7, 0x618fc7da9c8a4275, 0x5263148ba97b62d1, 0x6c1492aba75c6e3f,
+    0xdb7921fed4517e9b, 0x3564bda1f364ad19, 0xcb6794321246bc85, 0x6b98ef354258cae1, 0xcb47e8f54e3bd95f,
+    0x7a8513f65a3ef7cb, 0xf2b196dcbd642839, 0xf6c8271edc4637a5, 0x984e2a6feb5a6713, 0x26598adfe83b647f,
+    0x98a4d3c2164d73eb, 0xb41c29e54761b259, 0xe53c48698364b1c5, 0xc17e523a9157cf23, 0x23ed18576e27cd8f,
+    0xe19f3c487a29ecfb, 0xa271e39dcb3f1d69, 0x4fec76a1fa423bd5, 0x4c58bd321c276b53, 0xd2e967b4392758af,
+    0x19fc8726563b782d, 0xf941b3c8742ea689, 0x1adc2f4ba431b6f5, 0xc95632bdc124d573, 0xd685e49bae16d3cf,
+    0x3e24c7dfec19f24d, 0x7c1a2d354e3d12b9, 0x2d495a676c3f4127, 0x7164c3f87b125f83, 0x5e1b462878145cdf,
+    0x9268c3aba6187c5d, 0x1ba8f95ed41a7bc9, 0xc52396ded41eab37, 0xbaf9ed21f421d9a3, 0xa35e1f276435e921,
+    0x7bacf8432ce4f67d, 0x3ac6d8e54cf816e9, 0xefcd46398bfc2657, 0x3bad6e2989fe45c3, 0xe812b7adcaf28541,
+    0x6893f17dc6f4729d, 0x9e4d765fe5f7921b, 0xc76efdb213e9af67, 0x6dce97f542fbaed3, 0x4965bde762efcd51,
+    0x4ab5dc765ec2fbad, 0xe37d8ca98de61c2b, 0x4ade735bace82b97, 0xc8167e9dc8db49f3, 0xac624fe1f8de5971,
+    0xd7baf84328e176cd, 0x159f48d327e3964b, 0xf3e485a653e6a4b7, 0x3fd84ac983eac425, 0xb52afd6982ecd391,
+    0x2a1936587b9ec1fd, 0xb1af596dced4216b, 0x7e2dc34feab52fc7, 0x315af7621bc94e35, 0xb2a8fc6438cb5da1,
+    0x1ba483e547ad6b1f, 0x6e43db1765d18a7b, 0x278ecba984c3a9e7, 0x4a31fb7cb2d7c965, 0xe85a193fe2b9d7c1,
+    0xb79163fdce9bd63f, 0x6b91c8e21d8ef49b, 0x1d6c82a76ec43519, 0x9451deb76dc74385, 0x7ba6ef187ab963e1,
+    0x74d15b2a98ab715f, 0x472d96ba948d6fab, 0x2a635bded5b1ae29, 0x6cebf591f2a3bd95, 0xe7db1c532396cbf1,
+    0x6a593f143198da6f, 0x78cd36943e6af8db, 0x354c6de76d8f1a49, 0xbe71958a9da238b5, 0xd72c8f1edcb76823,
+    0x294fca8ed7a9658f, 0x72165abfe58a74fb, 0xe96d4782158ea369, 0x6843b7254691b2d5, 0xd528b73984a6d153,
+    0xc5e196d76175ce9f, 0xe4d293f87c68fe1d, 0x43e5f62bad6c1e79, 0x3d8f9b6cba7f2ce5, 0x4cb52a71fb925c63,
+    0xe9a6d3c21a7459bf, 0x21fe48c32a68793d, 0x5216e974345c87a9, 0x95f4267a946eb817, 0x2649853cb491d683,
+    0x3fd1e5cba173c4df, 0x7eb23afcbe67f35d, 0xea53c781fe6a13c9, 0x58b6ad721e8d4237, 0x79ad2be54c7f51a3,
+    0x72839c4549625def, 0xb4635d2989547e6d, 0xae823f5ba5467cd9, 0xbf9281ced35bac47, 0x71b584fed25ecab3,
+    0xf93862d1f472ea31, 0xd6a8c4f32153f78d, 0x2b8371943e4617f9, 0x17db52965e4b2867, 0x6f543d198b5c46d3,
+    0x76d4e1abab4f7651, 0x79e5b31dc95273ad, 0x29d6145fe856932b, 0xedc273a1f548b197, 0xc9da54721549afe3,
+    0x95e4dac6534dce61, 0x1fdec2976241fcbd, 0xbe4172c98f451d3b, 0x4132756a9e362ca7, 0xe296f17dcd3a4b15,
+    0xb95c813feb3d5a81, 0x9653c4edc82f57ed, 0xe691c8321a32975b, 0x8ab75e143824a5c7, 0xd768f3298729c635,
+    0xcb5fd149853bd4a1, 0xdc7e953a924cd31f, 0x42f958bdcf43127b, 0x87ce516dcd2531e7, 0xc71b634fec183f45,
+    0x6bd953e43c295eb1, 0xbde72435491b6c2f, 0x16f3e475471f6c8b, 0xd368415986129af7, 0x7ea5b1fcb614ca75,
+    0xd21fbe7cb427c8d1, 0x25a7893dc21ad74f, 0xf8c73d9a9decf5ab, 0x7fa386b43def1629, 0x32d64fa76df23495,
+    0xa92d8b165be764f1, 0xe3859da65ae9726f, 0xf8ba617986fa71db, 0x3f719a8ba5ed8f39, 0xca31475dc4f1bea5,
+    0x617539afe4f5cd13, 0x841c96b212e5db7f, 0xc7f52bd431d7f9eb, 0x76892f354fed1b59, 0x6814eba76bdf29c5,
+    0xac9fd81bace26943, 0x8ba1465cbad4569f, 0x96ebfa1dc7e9861d, 0xec52fad1f5eca479, 0xb3546ac216cda3e5,
+    0x58ab192657e1d263, 0x5b4c3d2763c4d1bf, 0x46dbfc9871b6ef2d, 0xc52eab476eca1f89, 0xf4c16b598cab2df5,
+    0x1a2b956dcabf4d73, 0x8453b21fe8b25acf, 0x8cb631e219c57a4d, 0xb87e94c325d678b9, 0xe783fa9545dcb927,
+    0xd691e4f764bec793, 0xfc23751983a1c5ef, 0x34d7caeba1b3f46d, 0x6c7e41adcfb714d9, 0x9acd36f1fecb2347,
+    0x7984b1521ead52b3, 0xc1578ad65cbf7231, 0x4fce2b9549a26f7d, 0x79d518e656a47de9, 0xf51de46a94b8ad57,
+    0xc5d218fed489abc3, 0xe763bfcdc39edb41, 0x4d65b82fe2a1f89d, 0x21ea3cb543c5291b, 0x256ea9b43fb62987,
+    0x23b1fd865d9a47e3, 0xf85ac7b98cad5761, 0xc2e1b398798f64bd, 0x8cd563aed8a2943b, 0x25bcd89fe695b2a7,
+    0x85b72da1f6a9c215, 0xb271ca83248acf71, 0xb72ae954326abecd, 0x69eacb3873921e4b, 0x2b3c4e576f842db7,
+    0x483ce26bae984c25, 0x83bf215dcd7a5b91, 0x4216e5bdc96b58fd, 0xe1c4a98fe95f786b, 0x8d6b91721982a6d7,
+    0x1548c9732896c745, 0xf9c264176478d5b1, 0x746f18b9837ad42f, 0x15293d4a916df28b, 0xfb3729acbe8132f7,
+    0x1b47853ede964175, 0xe8651a7feb675fc1, 0xfb541a821b596d3f, 0x74e1cfa3284c6d9b, 0xb271def5475f8c19,
+    0x85dce26a9762cb85, 0xf46d7eaba465c9e1, 0x4ef6a83cb247d85f, 0xf439b2ded149f6cb, 0x14f79daedf5e1739,
+    0x15b26df32f7136a5, 0x968bf1a54e857613, 0xdae573865c48637f, 0xefd8bc176a4972eb, 0x3fed578cb84da159,
+    0xe6ac7d3ba63e9fb5, 0x84fcd96ed764ce23, 0x5138942fe234dc8f, 0x91b8acd21236eafb, 0xbf94ec16524b1c69,
+    0x9345fa876f3e2ad5, 0x5d13e8ca9e416a53, 0xbdc542ea9c2357af, 0xef17359dcb36872d, 0xbd798eafe72ba589,
+    0x73d94c5fe72ca4f5, 0x485396a2182fc473, 0x254b38f65643d2cf, 0x6b7c81f98536f14d, 0x4ce8576ba34821b9,
+    0x5ec7f36a9e2b3f17, 0x1ace536bac1d4e83, 0x54b9683dca215bdf, 0xcf6e95a1fa137b5d, 0xe96182c32b157ac9,
+    0xfa287b354819ba37, 0xea824796561dc8a3, 0xeb18f27a963fd821, 0x54a1c63ba412f57d, 0xa98c231dc32615e9,
+    0xa94e532dcef92457, 0x4893e7cfedfa54c3, 0xce69bad32cfd7341, 0xc5ae1f343aef619d, 0x618aebd548d27ef9,
+    0xeb1a357658f4ae67, 0x78351a6985f7acd3, 0x831246da94fadc51, 0x7c2ab6e982fce9ad, 0xcb5496dfe4f31a2b,
+    0xedcf9b2431f42a97, 0xc67b12d32ed748f3, 0x6a21f7c54deb5871, 0xcfe73ab549eb65cd, 0x71e2acb879df854b,
+    0x57291badc8e2a3b7, 0xa972534ed8e7c325, 0xfca4db21f5e8d291, 0x81ac436213a8bfed, 0xa82735e432acfe5b,
+    0xdb2c914763d12ec7, 0xafc453d98fc64d35, 0x453b67f98ed75ca1, 0x7e3af5898bc96a1f, 0x8e7b46dfe8cd697b,
+    0x1c2a764ed5bf98e7, 0x9d3b71e219d2c865, 0xe283cb7437b5d6c1, 0x6d9415a764b8d53f, 0xcd6395f762caf39b,
+    0xe4a1268ba3ce2419, 0x413657fcbfc14285, 0x5a19843dcdb562e1, 0x4a58c3fedba76e4f, 0xa7edf4c21c986eab,
+    0x2df7c8e437ac8d29, 0xc3d295f4368fac95, 0x1c6df5e87693caf1, 0x4a735ed983a4d96f, 0xe3d41a9ba296f7db,
+    0x129d875fe2bc1849, 0x6f9a84cedf9e27b5, 0xd761ba454fb16723, 0x1e6275c32da3648f, 0x6adc49754c9673fb,
+    0x431f52d65c8ba269, 0xd953b2fa978ca1d5, 0xcf47ed8ba68ebf43, 0x8739f2acb472cd9f, 0x479d1abfe385fc1d,
+    0x2f76854323a81d79, 0xc4623e85418a2be5, 0x8bfd21e65f8e4b63, 0xf24c19a76d7158bf, 0x8f5a7cdbac94783d,
+    0x28ba943edc7586a9, 0xc81a9b7fe98ab617, 0x5ba26491f67dc583, 0x376845f2156eb3df, 0xc693e8454683f25d,
+    0xeb3d9f68748612c9, 0x2da46b8cb29a4137, 0x82653ed98e6b4f93, 0xc67da8f98a5b4cef, 0x913a762feb517c6d,
+    0xfd97c8e1fa537bd9, 0xc86497f21c56ab47, 0x7e2a16932758c9b3, 0x9482c7a6576cd931, 0x4c1ebf78734fe68d,
+    0xa765e42cb47316f9, 0x139bd8aed1982567, 0x8ba914cdcf6945d3, 0x32f49c71fe6c7451, 0xb314cef21c4e62ad,
+    0xb759d1a65d63912b, 0x78b13d465b43af87, 0xd159e6387846ade3, 0x4c815afba749cd61, 0xed683af98439eabd,
+    0x6984f32dc24efa3b, 0x3a5f9671f1532ba7, 0x9713abd432674a15, 0xbcf87da54f3a5981, 0x63c2a8f54c2a56ed,
+    0xa5d2b9487c2e865b, 0xb27189ca9b31a4c7, 0xabfd198eda26c435, 0xe43a586fe847d3a1, 0xd1cb647fe649d21f,
+    0x53ed1872142aef6b, 0xaf1527b6543e1fd7, 0xd3c14eba91623e45, 0x8f1edb598f265db1, 0x2edf3c9a9d186b2f,
+    0x68efb24a9d1c6a8b, 0x37be649dca1d89f7, 0x472a5c91fa21c975, 0xd283ecb43924c7d1, 0x261daf943817d64f,
+    0x3a92e4f76518f4ab, 0xa294653ba63d1529, 0xfd39e72cb41f2395, 0x5ec7186bade263f1, 0x6fa1948cbce4716f,
+    0x6c3289ded9e56fcb, 0xc48e56f21bfa8e39, 0x12b958c327fc9da5, 0xbe4c1a3657efbc13, 0xb462cf3765e2da7f,
+    0xd46ace7873d4f8eb, 0x2f893a1dc3f81a59, 0xb97d132ed1fb28c5, 0x951bf6edcfde5843, 0x2d7896a32ed1659f,
+    0x783fd1e43ce4851d, 0x8d6b12454ce6a379, 0x8f3e2ba768d9a2e5, 0x569f148a98edc163, 0x971b53c8749dbeaf,
+    0x7e2a69cba5b3fe2d, 0xfd37e641f3d51e89, 0x8416f7d213d82cf5, 0x725eaf4651eb4c73, 0x3f78c5643ead49cf,
+    0x1c56ed876ec1794d, 0x2681d5476cd387b9, 0x3b67894dcad6b827, 0x8b9e1d6fe7dac693, 0x8d3cab1ed59ab4ef,
+    0xcf8d14b215afe36d, 0x379feda656c413d9, 0x57329eba95d83247, 0xbc1385e982d951b3, 0x75b236e98eab6f21,
+    0xc2bd38498b9c5e7d, 0x169b8dcedba17ce9, 0xca3542f1f9b3ac57, 0xa89b1f521896bac3, 0x96f3a5d437b9da41,
+    0xfec5a1d4348be79d, 0x45cf2867649ef71b, 0x416e8b9cb4c32687, 0x42e86f5dc1b746e3, 0x8613c2bedfba7561,
+    0xe983a7b1fe8a63bd, 0x8e9fb5d21d9e823b, 0x3ed8ca754d92b1a7, 0x4d8ef2a65984aef3, 0x982d5a465896ce71,
+    0x8d74ca598467ebcd, 0x1d542b6a937afc4b, 0x2f7a456ed38f1cb7, 0x8f724ea1f1a34b25, 0xbec9538432b65a91,
+    0xb9f6ad732e6857fd, 0xa9cb2d643e5c876b, 0x1ba9f6854b6e95d7, 0xd987341bab91c645, 0x957146edc985d4b1,
+    0xc87539adc687d32f, 0x7c2893dfe469f18b, 0x6a9fd5e4358c21f7, 0x238bae45438e2f65, 0x5de937b872835ec1,
+    0xeba4fc198e756c3f, 0x4acfb5798e476c9b, 0x4c2f731bad5c8b19, 0x78c5a1ded94eba85, 0xcf247da1f962c8e1,
+    0xb64e89d21963d75f, 0x194c28a32746f5cb, 0xa5d461f9857b1639, 0x652c918a937d24a5, 0x75f293ecb28f6513,
+    0xd679ab8cbe53627f, 0xabc5e39dcd4571eb, 0xae9743dfec378f49, 0x7ebf15d21c3a9eb5, 0x96bfe375495ebd23,
+    0x45fad2865741db8f, 0x92a17bf87643e9fb, 0x96eb821dc5471b69, 0x4a8f371dc34a29d5, 0x348e5dcfe16d4953,
+    0x3612e5fdcd2e46af, 0x16ad38b21f43862d, 0x986ce3b43e25a489, 0x84aef9576c28a3f5, 0xcb7a52398a4bc273,
+    0x6eb41759873db1cf, 0x6952cafba741ef3d, 0xa9c7361ed6341fa9, 0xa952dc81f5483e17, 0xa71c98f2152a4d83,
+    0x95bced46512b4adf, 0xa9876d254e1f6a5d, 0x1e2648d76e1278c9, 0xd7892fabad15b937, 0xf781624edb18c7a3,
+    0x2813bdefe93bd721, 0x5834a7e1f61ce47d, 0xafcd4596583214e9, 0x3f2a16d989162357, 0xf2156c4a961852c3,
+    0xfe25319ba53b7241, 0x98ed26476cea5f8d, 0xf9a5c2e87aec6df9, 0x4ef8cb6dcbf1ad67, 0x5b23a19fe8f4abd3,
+    0xae2cfb4329f7db51, 0x16e2d4a325f7e8ad, 0x8f6dc74545ecf82b, 0xaf849be764ef1897, 0x957cd46ba5e247f3,
+    0xca789f3dc2f85671, 0xca4ed81bafe864cd, 0x5ab4dce1fdec834b, 0xb97af5821cde92b7, 0x2c1d94876be3c125,
+    0x543da21659d4cf81, 0x82a9467546a5bced, 0x396fecd874c8fd5b, 0xc391e48a94eb1dc7, 0x1d5fb23cb4df2c35,
+    0x59c4eb21f2e35ba1, 0x3dab2ec432d5691f, 0x74b26a132fd9687b, 0x97c6deb43dcb96e7, 0xd7ce14954aceb765,
+    0xc6bfd8e989b2d5c1, 0x7fd468aba8b5d43f, 0x8b6ad73ed5c6f29b, 0x3946cf71f6db2319, 0x58eb4d6326cd3185,
+    0xbea371f653ae4fd1, 0xae6c372871b26d4f, 0xe4bdc8265f946dab, 0x2f6815e76eb78c29, 0xa5dc4b787d8cab95,
+    0x79f1e48dc78db9f1, 0x3b61d92fe7a1d86f, 0x6384f7a21793f6db, 0x9cea15f436c81749, 0xb4a1c72874ca26b5,
+    0xd25f63ea94bd5623, 0xfd7542ca91ae538f, 0x5e89ad1bae9372fb, 0x9b3a215edeb5a169, 0xe9ba823feb879fc5,
+    0x95befcd21c8abe43, 0xb54f1a73276dbc9f, 0x47da25f65782fb1d, 0xa47fc1b986a41c79, 0xfe4b251cb4972ae5,
+    0xa96825bed29b4a63, 0xb2c1976ed18c47bf, 0x987cfe4dce8f673d, 0xbe63d1c21f7285a9, 0xa7312e543e96b517,
+    0x48ad9cf65d79c483, 0x1d35ba465869b2df, 0xd4e765ca987ce15d, 0xdfc8b64ed78321c9, 0x8673a14ed6953f27,
+    0x724a5fd1f2874e93, 0xc4e5376212684bef, 0x8efd6a14317c5b6d, 0x7359db643e4f6ad9, 0xfa5ebc698e62ba47,
+    0x4e5d873a9d65c8b3, 0x16a5493dcb69d831, 0x17bca6fdc74ae58d, 0x61fba3ced65ce4f9, 0xa261fc943a912467,
+    0x2ae591f3278654d3, 0x2513ed4ba4897351, 0xe8af3c69825961ad, 0x87d2af598e4c7f1b, 0x6849172bac3f9e87,
+    0x56bc328edb52ace3, 0x7e5fda41fa45dc61, 0x65af1cd21836e9bd, 0x621fc953274af93b, 0xd31fc826564e19a7,
+    0x891764bcb8724915, 0x95ab72cdc3645781, 0x289765ecb13765ed, 0x13fc698edf2a845b, 0xd84cfae1fe2d93c7,
+    0x637f85a21d4fb235, 0xbe2f68376c54d2a1, 0x1c9eb4f65824befd, 0x38bd5a765827fe6b, 0x1d28cb9a963a1ed7,
+    0x726abe4cb73e2d45, 0xb7e68acfe6425cb1, 0x9e2d751fe1346a2f, 0x7ec98af43125698b, 0xf695a8c43e1a98f7,
+    0xec7f49854e1db875, 0xc5e61a487a2fb6d1, 0x516328ba9a12d54f, 0x2a65834dc815f3ab, 0x36adbc8fe83a1429,
+    0x8ea4c261f71c3295, 0x8124abf5473d52f1, 0xe539db7874216e5f, 0x3da127f872136ecb, 0xf85946b76ef58d39,
+    0x5fe86ba76df79ca5, 0x3eb24da989facb13, 0x2d7369cba6edc97f, 0xf593a84dc6d1f7eb, 0x1f2e8ba32af41859,
+    0x78c5263436f827c5, 0xd517af2986fb5743, 0x2eac93f872ec549f, 0xdb459c8a92ef741d, 0xe41b5a7cbfe3a279,
+    0x12f945bcbcd6a1e5, 0xc5ae47bfead8bf53, 0xb341d7e217c8bdaf, 0x618c759437abec2d, 0x149cdb3657e21d89,
+    0xf157e4b987d42bf5, 0x921a8e6ba5e84b73, 0xed43182ba2d948cf, 0xa9748b3cb1ec684d, 0xb4dc56fedecf76b9,
+    0x156b3d821fd3b627, 0xbd9127a32ed6c593, 0x1bdac42549a7b3ef, 0x3ab95ec658bae26d, 0xfd2a19c876acf1d9,
+    0x26183cfdc9d23147, 0x83467a9ed6c54fa3, 0x8ac67f91f4c86e21, 0xfca6d7e212b95c7d, 0xcdb9875431ac6be9,
+    0xdcf321743eaf9b57, 0x1bc596376ea2b9c3, 0x7635fbe98cb6d941, 0x8b4716acb8a7e69d, 0x46d89baed79af61b,
+    0xf43c6de1f6be1587, 0x4d18b7e328b145e3, 0x896e71b438c57461, 0xfbc9314653a762bd, 0xae9c725872ca813b,
+    0x24a815b65e6c8f97, 0x8cd247598b7e9df3, 0xe37bd54feb93cd71, 0xaeb75261f874eacd, 0xafec59621987fa4b,
+    0xb27f9a84368c1ab7, 0x5f4e2a67679e3a25, 0xda8c534ba6b25891, 0x83ad5e2ba29356fd, 0xd28b6faed1a7856b,
+    0x42c5863dcf6a94d7, 0xbc429831fe8db345, 0xc46a28b32d7fc3b1, 0x1a87fed65b84d12f, 0xe251da943964ef7b,
+    0xc2eb731659681fe7, 0x35ac196ba78b2e65, 0xecaf821ba57e4dc1, 0xc857946ed4816b3f, 0xeb6c2d31f1736a9b,
+    0x153fd72432768a19, 0xdf8941732f4ab985, 0x4b3819654d5cb7e1, 0xf5437d287a4ec65f, 0x71a648b98962f4cb,
+    0x6cd3b7aedb871539, 0x9eb7563fe87923a5, 0xe49357d1f78c6413, 0x4d7c2be3246d517f, 0x72ba831543516fdb,
+    0xf14375b871638e49, 0xfbd6a4c87f369db5, 0xadce38798e59bc23, 0xe1a943c8793bca8f, 0x9d74f2cba73ed8fb,
+    0x7f854a21fb531a69, 0xad5f6be21a4628d5, 0x91db86e3296a4853, 0x61e35a78763b45af, 0x395d287a934e752d,
+    0x524879fdc251a389, 0x7569dbacbe34a2f5, 0x234b1adede48c173, 0xcdf29abed927aebf, 0xdc3691b2192ace3d,
+    0x13dc6b54372efda9, 0xc6f732598a543d17, 0x2a8fce9ba9264c83, 0x8d39ac6ba52749df, 0xe438a1cdc32b695d,
+    0xc1fbd32ed12e67c9, 0xc978e4afef21b837, 0xbea5cf632f14c6a3, 0xf2571ae65e38d621, 0xf139cd265b19e37d,
+    0xae195bc7681bf2e9, 0xa317fe5cba3f1257, 0x6ba2583ed92451c3, 0xc289fb1ed8276f31, 0xb329a571f3175e8d,
+    0x5fa19be3231a6cf9, 0x843172f5421e9c67, 0xb6c92f154cef9ad3, 0x2fd5e7987cf3da51, 0x1fcbeda769f4e7ad,
+    0x56f1e87ba9e8f72b, 0x7cf81b6ed8fc1697, 0xa8f7491dc7ed26f3, 0xc1af23e439f26571, 0xd1c2569325f463cd,
+    0xce8df5a763f7824b, 0x8f254b9762fa91b7, 0xa6ef57c87edcaf15, 0x7ed4bf587acfbe81, 0x8cb13efa98a2cbed,
+    0x78194bcfe8d4fc5b, 0x628ae1d329e81bc7, 0xdc23a71548ec2b35, 0xcb53d41656de49a1, 0xd325741a95d2681f,
+    0x13a452dba2e3867b, 0x8feb156cb1d695e7, 0x79ec423dcfdab465, 0xf6a3ced1feadb4c1, 0x1d6f97521baec23f,
+    0x39f12d854ac3f19b, 0xf8c642376bd73219, 0xdf1ba89768c92f75, 0xeba82f4986ba4ed1, 0xb59e346a93ad5c4f,
+    0x48169bdfe3d16cab, 0x28bed751f1d48b29, 0xfbae2c1321d6ba95, 0x36f1c9543ea9b8f1, 0x1235daf43d9bc76f,
+    0xf69b2cd5498fe5db, 0xc382915babc31649, 0x2358fcded9c724b5, 0x6abdc15fe8ca6523, 0x31dc2a6fe4ab528f,
+    0x72c81fb3249d61fb, 0xa23ecd1543b18f59, 0x6e3bd54761a39ec5, 0x3c5b9ed76f97bd43, 0xb4ec29a65d67cb9f,
+    0xf341d6c9897bea1d, 0x9c6a57bdc86efa79, 0x32fd4751f8a329e5, 0xb814af721ab74963, 0x728d1ca3259846bf,
+    0x9845b376549b763d, 0x56491837628e74a9, 0xb59837fdc3a2b417, 0xf2a4861cbf95c283, 0x986f1c5bac76b1df,
+    0x835d216fea68cf4d, 0x8fcd9ae2185afeb9, 0x3f7a12e54a8f1e27, 0xc9825fb76a824d93, 0x1347b5f986754aef,
+    0xb273d6ecb3785a6d, 0x241bf79dc25b68d9, 0xd65b87aed16ea947, 0x2ea375cfef61c7b3, 0x7e281f632f85d731,
+    0x6cf2a5732c56e48d, 0x9fd714c54b58e3f9, 0x61c4d9fa9b8d1367, 0xe734afdba97f42d3, 0x623c457eda947251,
+    0x541bfecdc3645f9d, 0x7bda32e1f3587e1b, 0xd75afce2124b9d87, 0x3cb42675415d9be3, 0x46d9baf87f52db61,
+    0x4195e6a76c43e8bd, 0xbf91e53a9c46f83b, 0xd5c3b14edc4b18a7, 0x5bd4e73fea6d3815, 0x51389d4fe95f4681,
+    0x6184caf2185264ed, 0x62f1be732746835b, 0xd64a85c7634892c7, 0xf847ec3a926cb135, 0x239ea4d87e3dbf91,
+    0xfb63ed298a31bcfd, 0x7e53416dca23fd6b, 0x2ca87351fa361cd7, 0xcbe437621b3a2c45, 0xb8a72356583d4ab1,
+    0x3e561c47673e592f, 0xe7c5d49ba532678b, 0xa695f14cb32496f7, 0x9b483a2ed129b675, 0x7598326dcf2ab5d1,
+    0xcd94e17feb1dc34f, 0x4a68d9c54d31f2ab, 0x2c4976187d461329, 0x5e2a73687c283195, 0xdf54be6878294fe1,
+    0x6c38452a971b4d5f, 0xb6e2893a941f5dcb, 0x542ab63fe5128c39, 0x29d375e1f2149ba5, 0x7f2b48a65428ca13,
+    0x7ba46e832de9c87f, 0x85f9d27439fad6eb, 0x7e1c38a54adef659, 0xe18cb9fa9af326c5, 0x2a94c86dcaf85643,
+    0xf61274bdc6e8539f, 0x953be7afe5fb731d, 0xfe9dac8324fe8179, 0x7fd4a1c543e19fd5, 0xe2b5da9871f4be53,
+    0xd2ca7f854ed5bcaf, 0x39eb4f176ac8eb2d, 0x21f3e5d767dcfb89, 0x63f9148cb8ce1af5, 0xb2fd69c1f9e24a73,
+    0x5bdae64218d547cf, 0x9fbe124325e9674d, 0xc8af246543ec75b9, 0xbf57361983dea527, 0x32da19eba2e1c493,
+    0xe4d3c6798da4b2ef, 0xda563f4bacb7e16d, 0x3d7218fed8a7efc9, 0xa26bf8932abc1f37, 0x2da483f548bf2ea3,
+    0x9fb34ae879c46d21, 0x452a671986c45b7d, 0xa34f126983c76ae9, 0x4e39a8dcb2dc9a57, 0x689a7c2ed1bea8c3,
+    0x1c78ad5fefb2d841, 0x571a96f21fa3e59d, 0x6a823f743da7f51b, 0xf415dce65dcb1487, 0x6cb4a9d879ac24e3,
+    0xe615d3cba9bf5361, 0x49187afdc7a361bd, 0xb859367ed4a57f2b, 0x4857b9e1f2b68e97, 0x7346fd92128a9cf3,
+    0xcf9174d5429ebc71, 0xbe3941654f71e9cd, 0xd61589a76d83f94b, 0x6d84ec398da619b7, 0xf6db7a4edcab3925,
+    0xb6ae839fe8ad4791, 0x7869b35dc68e45fd, 0xb61fe54217a2846b, 0x276c9f4324a593d7, 0x23b6f4e873a9b245,
+    0xb4cda598738ac2b1, 0xac2e94587d6cbe1f, 0xd421e89a9c61fe7b, 0xba93145dcb841de7, 0x5f29be81fb982d65,
+    0xdc6e8a432a794bc1, 0xe5a12d93287c5a3f, 0x5fe129d4346f589b, 0x8f27965cb573a819, 0x372b149dc294b785,
+    0x4b831cadc278b6e1, 0x913fbaecbe6ac45f, 0x67b89231fa5de3cb, 0x934feb765e821439, 0x134d9ef54d8632a5,
+    0x2dc75af87c896213, 0x7c14fb6878594e6f, 0x16cb58f9864a5edb, 0x25471afcb35f7d49, 0xc216b7efe3629cb5,
+    0x5f46b2a1f176cb23, 0x4d18fc532146c98f, 0x681f2c732e39d7fb, 0x32eb98f54c3df769, 0x2756c3ba9c6127d5,
+    0x916258dcbc864753, 0x49a5327dc93754af, 0xa582c49fe85a742d, 0xc8fa9d71f54d7289, 0x9cef1a63264e91f5,
+    0x6f13adb87452bf63, 0x2a6598b76134adbf, 0x2a1f4de76f27ec3d, 0x2c4f15376d28fca9, 0x81e5cafbab4e2c17,
+    0xd47136cfec514b83, 0x57d8c91fe92348df, 0x3b46eac21a27685d, 0x9a3f2d84352a76c9, 0x7fb68249852da637,
+    0x4d57f829842fb5a3, 0x1e847f5cb364d521, 0xc57a68ebaf15e27d, 0xfe3bd89cbc27f1e9, 0x3d84a291fd3c2157,
+    0x9be1d2754a1d2fb3, 0xdf39c2487b426e31, 0xed349b6769135c8d, 0xa428d73987156bf9, 0x15294a8dc41a9b67,
+    0x14b7938cb41ca9d3, 0x275819ced32fc951, 0xd8697aecbcf1e6ad, 0x8d9b1f621de4f62b, 0xf7b1c2a43df81597,
+    0xfdb32c576bea25f3, 0xf67c42898afd5471, 0x76e34bc987ef52cd, 0x5f964a1dc7f3814b, 0x62fab19dc3e48fa7,
+    0x2ba6cf7ed3f8ae15, 0x58427fc323fabd81, 0xeaf5128431fcbaed, 0x6f2dab454ed1fa5b, 0x49f52a676de41ac7,
+    0x542b87fa9ce82a35, 0xce86f29dc9eb48a1, 0x41a587fcb8dc571f, 0x8d54be6fe4df657b, 0x45fa138216d294e7,
+    0x9cb7eaf324e7b365, 0xa6bc3f5764e8b3c1, 0xdbc2f53872dac13f, 0x3aebc5965e9cdf8b, 0xe2d16f9a9cb21ef7,
+    0x86fb9c5edbc42e75, 0x7cdafb41f9b74cd1, 0x834fec6218c95b4f, 0xeb4c2da326cd59ab, 0x7129be4545cf7a29,
+    0x5fc71a9874d2b895, 0xc51de42a93c5b7f1, 0xefd1a35ba1b8c56f, 0x31daf28baf89e4db, 0x8cb3ae5fecadf349,
+    0x864bfec54ec123b5, 0x5f9e7c465dc76423, 0x3b671e454ab7518f, 0x67abd49546985feb, 0xf42ed15984ac7e59,
+    0x3df2a8cba39f8dc5, 0x9413257fe5a2bc43, 0x8ec24d6fe184ca9f, 0xc695d2f432a7e91d, 0x8ad4fe732e6bf879,
+    0xc81b49654c9d18e5, 0x15e73d6a9db14863, 0xcf85ad698a9345bf, 0xa8965f3dc9a8753d, 0x2c41ebdfe58b73a9,
+    0x8a93c261f59da317, 0x8241b563259fb183, 0xd47863154372aecf, 0x9fa486576185ce4d, 0x924d17f54e56fdb9,
+    0xbf638d5a9e8b1d27, 0x275f34cbab7e2c93, 0x8b92c7fdca7149ef, 0x9ea4bc61fa83596d, 0x9dfe4a121a8567d9,
+    0x5962d483256ba847, 0x3fe7d846547da6b3, 0x815c39fa948fc631, 0x63ae824ba172e38d, 0xc7da95fbad65e2f9,
+    0xb56834cede8a1267, 0xbd256e71fc7b41d3, 0x56827ef32b7d5f41, 0x382f6ad43a615e9d, 0xd415b3e659647d1b,
+    0x15c3fa2ba6459c87, 0x5df84b2cb4589ae3, 0x7318e2fcb35dca61, 0x8461a2dba14fc7bd, 0xd72c358ede52f73b,
+    0xa297ecd32f4516a7, 0x41b2e9754e6a3715, 0xfc1e7a687d6c4581, 0x9bd37ef8794c53ed, 0xc123be4dca61825b,
+    0x7ac21f3ed85491c7, 0xc7d8591ed647af25, 0xba329e71f348be91, 0xf854aeb21239abfd, 0xd7e4f9a5413fec6b,
+    0xf15b4d376f431bd7, 0xd9c184ea9e372b45, 0xfc4e365bad3849b1, 0x1c3b257dca3b582f, 0x5241387ed92e568b,
+    0x38dc945fe83195f7, 0xfe457d921923b475, 0xf4d327e65637b4d1, 0xa1e624387539c24f, 0x7e256ac8723ce1ab,
+    0x9af35ed87c2def19, 0x5e746a2cbd132f85, 0x9ec163fdcb264de1, 0xda96735fea184c5f, 0x5746f91328195acb,
+    0x9d4ec325481e7b39, 0x9568a1d76721b9a5, 0x8ad42f3ba725c913, 0x427f85aba315c67f, 0x8e91f4aba218d5eb,
+    0x96ca832badebf459, 0x689df45edbfe14c5, 0x5dfa87232df16543, 0xa3d76c943be4529f, 0x83d4cf165af8721d,
+    0xf97c481545ea7f69, 0x65e439c874fb8ed5, 0xdbc1926a94efad53, 0xf53821ca93e2cbaf, 0xc2b5437dc1f5ea2d,
+    0x671fb5a321e6fa89, 0x8fb13d943edb19f5, 0xac479e165cde2973, 0xb5173c687ad146cf, 0xb25948da9ae3764d,
+    0x912b4cedc8e674b9, 0x9cb46a5ed6eba427, 0x298e73b1f5edb293, 0x6a2fcb7324bda1ef, 0x3df62b9543b2cf5d,
+    0xb19e8f4651b4fec9, 0x942aeb176fc91e37, 0x5ca72e987ecb2da3, 0xe7395dfa9abe5c21, 0x382156afe9c15a7d,
+    0xcdae62f1f7c368e9, 0xab6fde8218d6a957, 0x46ecb8a325d9a7c3, 0x89df3a4765bdc741, 0xc695e32762afc49d,
+    0x3ec57f6a92c3f41b, 0x42fe7a5cbfc61387, 0xf4e35a1dcdb942e3, 0x4e62bd81fdbc5261, 0x367b8912198c4fad,
+    0x9f1cb62549a17e2b, 0x8be9f43546b38d97, 0xa1bd4f9875a69bf3, 0xe6adb4f984a9cb71, 0xb17d238a927ab8cd,
+    0xcf6a187dc19fe84b, 0x9c65e48fefa318b7, 0xda1cf3621fb73825, 0xdca81e543eba4691, 0xa7d98be43b8a54fd,
+    0xcd4832565a9e736b, 0xd8234a5cb8a192d7, 0x4fb712ced8a6b145, 0x6d92f71ed486bfa1, 0xeb5ad71fe378bd1f,
+    0xafb157e2126aed7b, 0x6928bea4316dfbe7, 0xc7b615d87f932c65, 0x716342587e864ac1, 0x4e6d581bac78593f,
+    0xc3a415deda6c579b, 0xbf34a95eda6e8719, 0x5cef8621f791b685, 0xca8547132784b5e1, 0x4d1cf9732487c35f,
+    0x4e3d98765368e2cb, 0x36127f89827cf139, 0xfeb3927a9e7f21a5, 0x69a2f87bac734ef1, 0x1fe6a58dcb754d6f,
+    0xa96b7ef1f9475cdb, 0xa9cf84721a5b7c49, 0x16ecaf83274e8ab5, 0xca39e8b76871ca23, 0xb491623a9453c78f,
+    0x92f3657a9245d6fb, 0xa28b67cdc14af569, 0xa46e528cbf4c16d5, 0x1d84796fed7f2653, 0xc4713df21d6253af,
+    0x1978b3c54c56732d, 0xa95f27b65c4a7189, 0xcf4b8617673a8fe5, 0xd36c425a974dae63, 0x8d5bc12a9541acbf,
+    0x347a51fdc254eb3d, 0x58e3d16fe135fba9, 0x4932e785435a2b17, 0x5f3b28e65f4d2a83, 0x37db19265b2e37df,
+    0xbc784d9a9c32675d, 0x187f49abab2475c9, 0xdfc1374edb29a537, 0x2a49c15fe72cb4a3, 0x97baed31f75ec421,
+    0xae72b8343642e17d, 0x92bd5ec65423efd9, 0x359edb4a92381f47, 0x42fa9ce87f192eb3, 0xb251d7ea9e2c5d31,
+    0xe659d74a9a1f4b8d, 0xd4198bcedb126af9, 0x5bcdf421fb149a67, 0x8c1e62432917a8d3, 0x6b12fa85472bc851,
+    0xfbc4a3d7641ec5ad, 0x78c2e63a9631f52b, 0xc342168dc3251497, 0x619c235bade724f3, 0x4165b2cdcdfa5371,
+    0xd6eb574fe9fa51cd, 0x84e9756219ed6f3b, 0x53ce189439f18ea7, 0x863214d768f4ad15, 0x1f47dce875f6bc81,
+    0x4eb3a21763f7b9ed, 0xb5ce731982fce95b, 0xf1a587cba1def8c7, 0x43f682aedfe42935, 0x8216bc432fe647a1,
+    0x1fbea9c43cd9561f, 0xe3af27543aec647b, 0x7d4b8c5659cd83e7, 0x48ce23aba9e1b265, 0x94a53f2ba7e5b2c1,
+    0x4158f9aba4c6be2f, 0x37d59ec1f2c7de8b, 0x3984cb7212baecf7, 0x142d9c7542cf1d75, 0x4da518e76fc34bd1,
+    0xd625ab187dc65a4f, 0x58a3fd176cd758ab, 0xa2f7b36cbadc7829, 0x38647f2ed6cea795, 0x43cd178fe7c2b6f1,
+    0x15c64ae217b3c46f, 0x6a42918324a6e3db, 0x284ade9763caf249, 0xe178acb983cd12b5, 0x9d537e6a9ebf5123,
+    0xb76f431a9ca24e7f, 0xc4b1698dca945deb, 0x5d7486e1fab87d59, 0xc6934fd2179a8bc5, 0x6e481ad3279eab43,
+    0x671f4e3545a1c89f, 0xadb4321875a4e81d, 0x47d58a9ba2b5f679, 0x18e3f5adc2ba17e5, 0x1b8265adcfad2763,
+    0x26cf715edc8e34bf, 0xf6a57b321ea2743d, 0x9f612b743db572a9, 0x41a532765cb9a217, 0x5db7af26568baf73,
+    0xa271dcb8746b9dcf, 0x839c215ba581ec4d, 0x9f532b4ed273fcb9, 0x639fdec1f3a81c27, 0x6c3784e5418a2b93,
+    0x1ab946c32d6b38ef, 0xf9b5cea43c7f486d, 0x5aed37265c8276d9, 0x7a8bf23cbc95a647, 0xda45b67ed978a5b3,
+    0xe498216fe78bc531, 0x52f9eca1f46ec28d, 0x7caeb1343572e1f9, 0xc841d72984a52167, 0xb5c129e761872fc3,
+    0xfe531ac98f7a5e41, 0xd2e6b9f87e5b4c9d, 0x57c1b23a9a5f6c1b, 0x7492c56fec529b87, 0x327fc4d1f865a9e3,
+    0xe6fb71a32a58c961, 0x45978a132549c6bd, 0x3617fed8745de63b, 0x52e7ba3cb48215a7, 0xce32b95dc2973615,
+    0x9fce165dcf695481, 0x3abf856cbc4952ed, 0x4bf2de61fc4d715b, 0x5d7e96421a3e6fb7, 0xe14987354b63ae25,
+    0xb65ecf876845bd91, 0xb7fac3987536bafd, 0xbcd1e8398439ea6b, 0x9d6e8a5ba23cf9d7, 0xebd731cfe3712a45,
+    0x5b37148fef3548b1, 0x71965fe21e38572f, 0xa2639c843e2a658b, 0xdf7acb265b2c84f7, 0x8f21bae98b2fa375,
+    0x5a98ed2ba954b3d1, 0x9814625cb836c14f, 0x932468edc426df9b, 0x465d1f7ed43afe19, 0xd6f574a3243d1e85,
+    0x57db1ca873524ce1, 0xbfd125487e134b5f, 0x41932a587e1659cb, 0x61e84c298d1b7a39, 0x6348ba1dcb1d98a5,
+    0xbd6f5a1ed92fb813, 0x9a1e76cfe812c57f, 0xd269e4832715d4eb, 0xbe3f46854618f359, 0xa57b43f9862b13c5,
+    0x567ea28ba61e5243, 0xc62de5187cde419f, 0xde1af8b98ad25efb, 0x194ec6bdcbf47e69, 0x1c4d582fe9f78cd5,
+    0x98f175d218fbac53, 0x4615cda325edb9af, 0x3471a95656f1e92d, 0x649cb1d764e3f789, 0x3572cd6ba3e718f5,
+    0x7cabe8fdc1fb2873, 0x71d8564a9edb35cf, 0xb3ce158febcf654d, 0xf731dc821de273b9, 0x6dca4fb54ce6a327,
+    0xa195dfb65ae8b193, 0x8b6a9ce545b89edf, 0xce759ad874acbe5d, 0x5ec6fb4984b1fdc9, 0xa6b2873dc4e51d37,
+    0xc4a567b1f1e72ca3, 0x9ef7438543ea5b21, 0xea9c4b232fbc497d, 0x169cfab43cbf57e9, 0xd4e1a8976cd2a857,
+    0x365c87f989d5a6c3, 0xfe4d896cb8d9c641, 0x47cb319fe5bac39d, 0xfec52b81f5ade31b, 0xed71fbc546d31287,
+    0x6c3f45e875c641e3, 0x5b64dfe872c84f51, 0xa48c5d965f984ead, 0x3d16cef87e9c6d2b, 0xc27d43598baf6c97,
+    0x91a6cb8ed8b29af3, 0x5ae24b81f8b5ca71, 0x759e8b121596b7cd, 0x7c826ed3259ae74b, 0xac4b9d35439df5b7,
+    0x963712aba6c13725, 0x3168d92cb2c64591, 0x3ca8d2ebae9753fd, 0x7caf4b9ede9a726b, 0xce56f4b1fb9c81d7,
+    0xe3b78a121b8e9f35, 0x6fab93754983bea1, 0x9c23d8f54785bc1f, 0xd28c1b965486ec7b, 0x47cd15e98369fae7,
+    0x4621ce7dc39e1b65, 0x5192a4efe3a249c1, 0xc2f154aede94583f, 0x6f3459121f87569b, 0x3fa27b143e7b8619,
+    0x21caf9643c7da485, 0x8165d927697fa4e1, 0xc796d24ba983c25f, 0x7d6594cba675e1cb, 0xb3a45e2dc467ef29,
+    0x6a85b91fe37b1f95, 0x7f6ad283247c3df1, 0xe4152b9652814c6f, 0x42c31ab54f635adb, 0x35dfac798e567b49,
+    0x24d7a1587d4a89b5, 0x4b56e31dca6db923, 0x2948e5fdc74eb68f, 0x4c963e2fe762d5fb, 0x4e3c86d21875f469,
+    0x328a5674367914d5, 0x689137fa968c2453, 0x3bce1d79816d42af, 0x18942c3baf63712d, 0x25e1f89cbd436f79,
+    0xf5e6291dcb368de5, 0xa2d64371fb49ad63, 0x7dfe4382173c9abf, 0xb85ad2e3274fca3d, 0xb5c8d9a65642f8a9,
+    0xaf59eb2cb8562a17, 0x126bafcdc45a2983, 0x4ead35fcb14a36df, 0xf2d61aecbf2e465d, 0xebf837c1fe3174c9,
+    0x58df3ca21e25a437, 0x195fe8d65d47b2a3, 0xd6327c587b5ac321, 0x2e5374f6572abf6d, 0x6fad32e8752fced9,
+    0xcf21867dc8531e47, 0x16dc857fe5462db3, 0xb86e2d31f2495c31, 0xcfb825a4312b4a8d, 0x7cf1d9543e1d58f9,
+    0xaced7f865e21a967, 0x34827be98c14a7d3, 0x2e34fd5bab28c751, 0x16f3de8cb718c4ad, 0xb8f35a1ed71ce42b,
+    0xc483df1ed51ef297, 0xa86421e7681542f3, 0x512d94ca96385271, 0xda14e95762174fbd, 0x2a4853e65df96e3b,
+    0xdb72c4165bfc6da7, 0x751fcbd98aef9c15, 0x1d8739aed9f3cb81, 0x426cf3edc6f4b8ed, 0xf9da65b216f7e85b,
+    0x6ba7cfe324eaf6c7, 0xb79df53876fe1835, 0x15683dca95f246a1, 0x2a859d7ba2e4651f, 0xcfe7389bafe8637b,
+    0x1a286becbcda82e7, 0x6fa9ce41fbeda165, 0x62b87c1328ce9fb1, 0xfb1a4dc548c3bd2f, 0x76e2cfa436c4ed8b,
+    0xeb85c27654c6ebf7, 0x5bfe368a94eb1c75, 0x87532bca94ce3ad1, 0x14b2795dc2d1594f, 0xe839a1bfefd357ab,
+    0x38baf4c21fd68729, 0x617b94d32edba695, 0x9143a8b549bca5f1, 0x389baed658aeb36f, 0x317efba987a3e2db,
+    0xe6d749acb7c6f149, 0x2dce641fe6d921b5, 0x7e81d59fe5cb4f13, 0xdfb7531212ac3d7f, 0xbf92481542a15ceb,
+    0x6c327d954fb37c59, 0x6ad3f7e54eb68ac5, 0xb6d25ec87dc9ba43, 0x6e8a273ba68cb79f, 0x4bd2561cb69fc71d,
+    0xb967adcfe6b2f579, 0xf72d4cb328b716e5, 0x31be627547ca2563, 0x6d59a4c7629a43bf, 0x8235db4981ae623d,
+    0x574acf698fb271a9, 0xc965a78bac938ef5, 0x647cf35edc96ae73, 0x925eb63fe8679bcf, 0x5edab462187acb4d,
+    0xef29c863256feab9, 0x941abed768a41b27, 0x64eab7c985b62a93, 0x4f6193eba29837ef, 0xa6e53fcdc19b476d,
+    0xfa5238dcbf7e65d9, 0x3ecbfd21fe91a547, 0xc84197d21e85a4b3, 0x3b9852f65d98c431, 0xc6a127d54a69c18d,
+    0x7fc9b3d5465acfe9, 0x7b2e64ca946dfe57, 0x8d2974acb6842ec3, 0x6c23578fe3975d41, 0xc84693b1f1674b9d,
+    0x25dcb7f4327c6a1b, 0x86712c432f4e6a87, 0x195fcb865d61a8e3, 0xc81523ba9d74c861, 0xfe6b2c898946c5bd,
+    0x2c19b8edc869e53b, 0xa1c5f4ded65cf3a7, 0x8295ecdfe78f2415, 0xe496b81327945381, 0xe174fc65437651ed,
+    0xa147d9e871586f4b, 0x32b7fe165f3a6eb7, 0x1a87de298c4e9d25, 0x74ea5d3bad52bc91, 0x42ef8b7dc843b9fd,
+    0x59f37ea1f835e96b, 0xba68d5f21639f8d7, 0xb29fd614386d1945, 0x6edbf319865f37b1, 0x2746c91ba473562f,
+    0x7b31648dc135648b, 0xb375e16cbe2983f7, 0x21a7935ede3ca275, 0x8fb3ae91fb4ea2d1, 0xc1768b232a41be3f,
+    0xc473d9f54823de9b, 0x5fa4ceb65836fd19, 0xe3f815ba973a1d85, 0x9c46b2fa964c3be1, 0xb2f8a71cb42e3a5f,
+    0x9c7eb56fe13258cb, 0xdce6528fef157839, 0xd47f98a32f1897a5, 0x83f21ea65e2cb713, 0xf3ab29565a1db47f,
+    0x75cb26f87921d3eb, 0x4ef8b36cba14f259, 0xfb3d48aed93812c5, 0xdb27189fe82b5143, 0xdfb7695ed41b3e8f,
+    0x4ebd2913231e4dfb, 0x8af39c4653127d69, 0x1dfa8b454ef38bd5, 0xed3698176df7ab53, 0xa9cd2b3659e7b8af,
+    0xc3247d1a97fbc82d, 0x8bea971cb5dfe689, 0x5416972ed8e317f5, 0x1a48d3f219f82673, 0x624cf9b325e834cf,
+    0x1fda6c5872fb634d, 0xf739cb4871fe62b9, 0x93bd7e2a9fe3a127, 0xc875d1fa9cd4af83, 0xda78439ba8b59cdf,
+    0x493fae61f7e8bc5d, 0x1ab96d4216daebc9, 0xe5b41fd326cefb37, 0x2dcfe4a767e42ba3, 0x4b83f2ea96e75a21,
+    0xaf24c5eba2e9487d, 0x92d7a31ba1db56e9, 0xaf364d8cbfce9657, 0x769c2381fed1a5c3, 0x47dc89e32ed6c541,
+    0xfead8b643ab6c29d, 0x857e32c658c9e21b, 0xc382e4f545abef67, 0x8a16b54986ae1fd3, 0xab19273cb7c34e51,
+    0xb13ed56fe2b54cad, 0xa6b89f31f1d86c2b, 0xa712596321dc6b97, 0xd98741b32ead89f3, 0xe1cf9a865eb2c971,
+    0x38a52c965a93b6cd, 0x7ad5f12989a7e64b, 0xfc8561edc6a9f4b7, 0x83ba591fe8bd1625, 0x3a46cdefe6bf3491,
+    0x5cdf714216a352fd, 0x67e8fab543c5716b, 0x6714fc3541a86fc7, 0x259ce1b76f8b9e35, 0x2e1b58476c7e9da1,
+    0x5f791e2a9a82cb1f, 0x42bf31ced983ea7b, 0x623791ded685f9e7, 0x21869d43289b1a65, 0xb4ce1795469d38c1,
+    0x6514d927659e473f, 0x48e35f7983a2659b, 0xb7296a4dc2b68519, 0xfb3572edcf79a385, 0x9e6b538dcd7ba3e1,
+    0x14b2dc3fea7db15f, 0x915adf732961dfab, 0xa97cf8243a74fe29, 0x17ae9f854a871e95, 0x6bcade7986793cf1,
+    0x2361ef5a947c3b6f, 0x8475ae2ba26f49db, 0x7ab5286fe1827a49, 0x9c8d512fef6498b5, 0x5d4ec1621f69b823,
+    0xf2e98b732d4ab58f, 0xa52f9834395dc4fb, 0x613c28b98b71f369, 0x71b68dfcba8613d5, 0x9c14ab7eda894253,
+    0xcb6d3f9ed56941af, 0xa6b71cdfe36b5f1d, 0x7d6415b2124f5e79, 0xabf9473541628ce5, 0x5bd7fc387f45ac63,
+    0x2ad85ec65d36a9bf, 0x345ced987b4ac93d, 0x69531dfcb83de7a9, 0xbe9741afeb632917, 0xdab73e51fa652783,
+    0x58dfeb42184735df, 0xc1729eb3273a645d, 0xb546c1e8724d63c9, 0x64ea3c2ba15f9237, 0xc6734dba9f54b1a3,
+    0xeba13f298b249def, 0x7ae29f4dca27be6d, 0x4eb63751f728ecd9, 0xeb4a87c2192dfc47, 0xe2cd4ab769512cb3,
+    0x3e867dc989465b31, 0x49d7e83ba526498d, 0x23ab564cb32a57f9, 0x2fa7c49dc12d9867, 0x2754debcbe1f96d3,
+    0x8ef72631fe23c651, 0xdfb6ca532e15c3ad, 0x47be29365c18e32b, 0xf1c32da65a2bf197, 0x3f82adc9894d21f3,
+    0xe4ab921cb9324f61, 0x7136258ba6134ebd, 0xad89c5efe4176d3b, 0x84ab79d1f2196ca7, 0xdb7c9e15432d9b15,
+    0x8cba6f543dfeba81, 0x1a96bce54af1b7ed, 0x1ebd28476af3e75b, 0x542876b989e6f5c7, 0xb84a6c9dc9fb1735,
+    0x2b15e96dc7fd35a1, 0x2961eb7dc6de541f, 0x48d1e69215f3627b, 0x3a7148d543f581e7, 0xed91fb3761e89f45,
+    0xc2b1da865fda9eb1, 0xe2d6483769bdac2f, 0x264cfad879d1ec8b, 0xe5d8a91cb8c3eaf7, 0x95b38741f9e81b75,
+    0xb9d467c327ea39d1, 0x2c91ba6326dc384f, 0xf23a5b1653df46ab, 0x1d87afeba4e38629, 0x3f1bed7cb1e6a495,
+    0xf6d32c5a9ec8a4f1, 0xf85b72ea9dcab26f, 0x4dc5b921f89ec1db, 0xb964ac132ab1ef39, 0xdbf65c7439c41fa5,
+    0x58fb4d1769c84e13, 0xfa815c9765b93c7f, 0x3ae927d8739c4aeb, 0xe948215ba2cf6b59, 0x13d6b29fe1d289c5,
+    0xc78a51bfefc6b943, 0x4b58de121ea7b69f, 0x2c91d6743e9ac61d, 0xae96d7843bade479, 0xe65f1c798ab214e5,
+    0xb14a96dcbac72463, 0x4a7e1c6dc6a742bf, 0x26d98a5fe5ba613d, 0xab85d69fe2ac5f89, 0xc8b7e692129e7df5,
+    0x7f1ce3d651b2ad73, 0x9c35a8d43e749acf, 0x5134e7b65e87ca4d, 0xa4e831265c6ae8b9, 0xf6b8395cba8df927,
+    0x2318a74feab12893, 0x789324ced79436ef, 0xf89ca56217a8456d, 0x869f57a3238a64d9, 0x18f2539762ad9347,
+    0x641feb38718f92b3, 0x6d4e531baf95c231, 0x1e93bd6a9c64bf7d, 0x785b314cba56cde9, 0x7bed465fe96afd57,
+    0x8594c613297e1dc3, 0x48fcb6d76a925c41, 0x4fc2185656734a9d, 0xafc92d1ba487691b, 0x4361978dc25b6987,
+    0x8457a36cb16c97e3, 0x49376abdce5fb761, 0x27cfba61fe62c4bd, 0xd8fa53421d76e43b, 0x32f815c43c58f2a7,
+    0x15dca4287b8c2315, 0x1893bf5a9a7e4281, 0x947b538a97614fcd, 0x4e61b2adc5736e4b, 0x1378de5fe2456db7,
+    0xa46dfc91f16a9c25, 0xb689f3a4325dab91, 0x9ceab1232c3ea8fd, 0x23a879d65d42e86b, 0xfd3467a98b34f6d7,
+    0x2f7a56bcbc6a1845, 0x5d49316ed95c36b1, 0x195f2c3dc86d452f, 0x9ae72c81f751638b, 0xd978efa2165482f7,
+    0x1268de976348a175, 0xe9d83c1762489fc1, 0x48b1cd676e2bad3f, 0xc18e56476a2fcd9b, 0x172e539bab43fc19,
+    0x6a4289cfeb361c85, 0xecd48b31f9483ae1, 0xf43ac972182b395f, 0xcb76fd14362e47cb, 0x9d271aeba6418739,
+    0xa419fbecb42396a5, 0x13c46afdc248b613, 0x1a6d2f4bae19b37f, 0xed49176a9d1ac2eb, 0xf613275edb2fe159,
+    0x9dc582476d3421c5, 0x6548acf76b174f23, 0x57a94f1659173d8f, 0xb16df24876194cfb, 0x52f6a3dba41e5c69,
+    0xbe548f2dc4218ad5, 0xbd5e82cfe214ba53, 0xa2563e8dcde4b7af, 0x5638fac21ef8c72d, 0x7adf69232cfbe589,
+    0xd27abef439dce4f5, 0x782c1f3a9bf12573, 0x1bec7d3a98e543cf, 0xea67128cb7f8624d, 0x2a68395ed4fa61b9,
+    0xd9f218aed3ec8f17, 0x85ce9ab212df9e83, 0x7fe9b86541e29bdf, 0x1e28f5b43fe4cb5d, 0x1dfeb8354bd6eac9,
+    0x25f189c769dbfa37, 0x62f1d38cb8de19a3, 0x7531a8bedae35921, 0xecd49761f8e3467d, 0xb4da857214d765e9,
+    0x16ab92f323eb9457, 0x5d86bc4762ed94c3, 0xad416c5982dfb341, 0x7314ed687fb3c19d, 0xa9b471587ba4cef9,
+    0xfcb9681dcab8fe67, 0x5984c761f8ba1ed3, 0xa7b415f329be3d51, 0xad916f5437c14bad, 0x9e75a8f657d46a2b,
+    0x51d2bea983d56a97, 0x65cdeb7872ca98f3, 0x5d69ca2ba2cdb871, 0x1d26fc9a9e8fa5cd, 0x637dcf21fda2e54b,
+    0xf84d7e521da5f3b7, 0xf4d1b2e76dca1425, 0x4a86be576abc4391, 0xefb9cad7679c41fd, 0x3f6d482a97a16f5b,
+    0x756942bcb4a36ec7, 0x17e6dc5fe2b79d35, 0xd6549381f2b89ca1, 0xd6ef5314328cba1f, 0x96bd5ac32e6fd97b,
+    0xfc83e9154c92f8e7, 0x6c8751298db71965, 0x452c3a198ba937c1, 0xeb82759dc89b463f, 0x162397bed68e549b,
+    0xb7a69581f6b28419, 0xd34e6a5216b4a285, 0x9c75e4265497a2e1, 0x49c8df165178ae4f, 0x63d24c154f59ceab,
+    0xb4391a687b6fed29, 0x2ae785dcbc831d95, 0x23157c8eda863bf1, 0x5eb83acfe9783a6f, 0x9e415f32176a48db,
+    0x5dfbe8a3257e6849, 0xb8d431f7648197b5, 0xf48ae12ba495b723, 0x75e8f2cba176b48f, 0x921d8efa9e58c3fb,
+    0x914af56cbd5ce269, 0xc7143aedca6ef1d5, 0x8b2cea932d964153, 0xf4728be32a653e9f, 0x138a2f9549685e1d,
+    0x16cfa5d9864b5d79, 0x8d32576a934d7be5, 0x2f78196ed471ab63, 0x569cd3aed153a8bf, 0x1cd482efef46c83d,
+    0xd685c3a21f38e6a9, 0x78261bf43d4cf617, 0x472de5187c5f1683, 0x61782db98a6234df, 0x5e6b87dcba47635d,
+    0x2b76938ed74862c9, 0x95a628efe65c9137, 0xb926e53fe24d8f93, 0x27698d5323419cef, 0x2c4713f65143bc6d,
+    0x4d9b62154f25ebd9, 0x694f5d376d29fb47, 0xb4f712598c4d1ab3, 0x8473cfedcb5f4a31, 0xd649c58fea32478d,
+    0xbdc965efe82456f9, 0x583de6c2182a9567, 0x6b283415462b95d3, 0xe43cbaf9863eb451, 0xc341dbf98341c2ad,
+    0xfcd1937a9f35e12b, 0x941ae85bac15ef87, 0x4123c75dcb291fe3, 0xe496a7f1fa2c3e61, 0xcb791d63281f3cbd,
+    0x4bc25d1659126c3b, 0x4587e9a658146ba7, 0x9efb3dacb6289a15, 0xa1e724cba42cb981, 0x32dc179a921ca6ed,
+    0x8bd7e39a9cefd65b, 0x7bd1f8cedbe2f4c7, 0x6a71dfc32df81635, 0xa3fe49165cf934a1, 0x4e9c3df769eb531f,
+    0xec49b81768fe517b, 0x74b8395a95e16fd7, 0xf41ed62cb6f39e45, 0x1a82c5bdc3f69db1, 0x1ba6c59ed1e8ab2f,
+    0x9ce7b42321fcda8b, 0x4ce726932cbed9f7, 0xd6ba13476de31a75, 0xbd6912e87be638d1, 0xfc2de4198ad9374f,
+    0x5c8f927a97ec45ab, 0x13efb65dc6de7529, 0x4c6bd791f6e1a395, 0x67b2a9d326d5a3f1, 0x8de647a543d7b16f,
+    0xfc98a14541d7afcb, 0xb8ae45165fabde39, 0x561e39f76b9efda5, 0xca6e4f2babc54d13, 0x89a4c5ded9c53b7f,
+    0xb9f3d581f6c749eb, 0xf14a68c217dc6a59, 0x96e2d45324be78c5, 0xc7d5e63876d1b843, 0x1fd9263872c3b59f,
+    0x3159d28a92b7c51d, 0x3615ea298fbae379, 0x75c84a3bac9bf2e5, 0x354a27cfecbf1263, 0xbf7c46232ca341bf,
+    0xe5c9783439a65f2d, 0x28de57f436b75e89, 0xbf6e5ca7649a7cf5, 0x5ca46ef984ae9c73, 0xfb671a3cb381a9cf,
+    0x375e491fe1a3c94d, 0xdbf2c45edf85e7b9, 0xa4bf93d21e9af827, 0x87f49e354ead1793, 0xda3691754a8d25ef,
+    0xedbfca398ba2546d, 0x9b1725acb8a563d9, 0x67f5a23ed6ba9247, 0x2d56a79fe58c91b3, 0x6e95d23fe48daf21,
+    0xd1fa68c32381be7d, 0x3c1eb9a54173dce9, 0x1cafe2943e86fc57, 0xc859ba176e791bc3, 0x9e85fdca9c8d3b41,
+    0x5ed9146cba6f389d, 0x9c3b721fea93681b, 0xe95b4271f5a49687, 0x5fa3d8e2157896e3, 0x673921d4348cb561,
+    0xd3e1a7f6526ea3bd, 0x528ecd7a9481e23b, 0x2c14367a9e64f1a7, 0xf7ea856dce893215, 0x3849a2bedc6a3f71,
+    0x5d684cb1f85a3ecd, 0x9daecf72196f5d4b, 0x32e8a19439526cb7, 0x2786acd548769b25, 0x3c21edf98457ba91,
+    0x725cb6e98249a7fd, 0x9c53fd7ba14ed76b, 0xf6159b4cbe41f5d7, 0xd53efb61fe861745, 0x7e8a14232e6835b1,
+    0x1a35c6e43c6a542f, 0x1db259476a4d528b, 0x842e31a9894e61f7, 0x361f49dcb8429f65, 0xe7365fbcb6459ec1,
+    0xac7f956ed247ac3f, 0xad8f25e1f138dc9b, 0x6857ec34324deb19, 0xfe254ac76f421b85, 0x163ecbf87d4539e1,
+    0xe6b29c4a9c27385f, 0x13b6fd798a2946cb, 0x678945adca2d7639, 0xa6d2549ed72f84a5, 0x6a5ebf21f864b513,
+    0xe4bdfc321635b27f, 0x9b7853e65437c1eb, 0xce3a2b87612adf49, 0xb1659ea76d1cfeb5, 0x9a3d8f6bad514e23,
+    0x3f78e6dbab143c8f, 0xda21486ed9164afb, 0x8392f651f81a5b69, 0xd8c14953281c79d5, 0xd2ec14f5471fa953,
+    0x974fabc87512b6af, 0xe4f8179a9415c62d, 0xae36581cb217e489, 0xa38154798cd9e3f5, 0xda674becbcfd1473,
+    0x9e357bdcb9de32cf, 0xf816bea32bf3614d, 0xd5c6a9e328e45fa9, 0x3b76a24546f98e17, 0xb823f4e765fb9d83,
+    0x1c5df6e763ec8adf, 0x62e748ba93f1ca5d, 0x7fb4918cb1f3e8c9, 0x4b8a1f5dced6f937, 0x8d4e29f32feb18a3,
+    0xce8912d65ced4821, 0x4fa63c754acf357d, 0x43aecfb87ad264e9, 0x759d42bcbae69357, 0xe95dab4cb6e892c3,
+    0x1d3b5f6ed6ecb241, 0x239651dfe2bcaf8d, 0xfb148d2323b1cdf9, 0xde9ab26541c3fd67, 0x83b45d965fb71cd3,
+    0x931dcfa87eda3c51, 0x2b6e94a768bc39ad, 0xd8e1f47ba8cf592b, 0x7bae9c1fead26897, 0x47dbac6fe6c597f3,
+    0xf5d72eb325d9b671, 0x2c84167323b9a4cd, 0x1593fa2762aed34b, 0x1fb4d8c983c1f2b7, 0xe5129adbafc71325,
+    0x5746de3cbec84291, 0x427e1b5cba983fed, 0x532f6c71f89c4e5b, 0x4a1c7392189f5dc7, 0xc71a92b548b29c35,
+    0x1a23fbc546c59ba1, 0x314b852764a7b91f, 0x3829af17629ad87b, 0x8a64f39ba19cd6e7, 0x63c4f87edfb21865,
+    0xe93c47b1fea536c1, 0x715ed9c21da8453f, 0xb68925c32d8a539b, 0xf3a498d65bad7319, 0xb91da54767af9185,
+    0xf798564ba6839fd1, 0x9a45d2ecb385ad4f, 0x56c1824fe276cdab, 0xed52ac61f17aec29, 0x5e927d63217dfb95,
+    0x8452f7b65e823af1, 0x735acfe65d84396f, 0x7e8fb3565c8647db, 0x36ae24cbac8b6749, 0x9385a2edc97d86b5,
+    0x9b5f826ed78fa623, 0x98e356bfe572b38f, 0xbd3e7cf21475c2fb, 0x6ecf2b354378e169, 0x47fadc154169efc5,
+    0x2ae637d98e7d1f43, 0xfd5143a98c613d9f, 0x28d4e53bab745c1d, 0xd957c24feb465c79, 0xf4c62d31f8497ae5,
+    0x35af16b2185d9a63, 0x495eda23254e97bf, 0xf176ebc98562c73d, 0xa7f648198264e5a9, 0xeaf8d26cb269f517,
+    0x192ef67cbf6c1583, 0x327ef69bab5c23df, 0x37c92ab1fc71625d, 0x9d5afe832d5461c9, 0x8fa596743b468f27,
+    0xd4531b86574a8e93, 0x4e836127653a8bef, 0x5d74bef9843fab6d, 0x59af48dcb342ead9, 0x734dfb9ed135fa47,
+    0xde854bafef4819b3, 0x425fd6732f5c4931, 0x7d91e6354c2e368d, 0xb26f9dc87c3165f9, 0x935c8d2bac239467,
+    0xba8129fcba2794d3, 0xb14c2f9ed84ab351, 0x945387dfe53cb1ad, 0x4f1d8c6ed43ecf1b, 0x457e6b121432fe87,
+    0x2ae5f9d872461de3, 0x42abc3e87f293d61, 0x2f436cb76e193abd, 0x2c581de98c1e5a3b, 0xc3a2f97edc2169a7,
+    0x42196b3feb24a915, 0xcdfb8391f926b781, 0xbe1675a32618a5ed, 0xa5d73fb4361cd45b, 0xb3fc9187641fe3c7,
+    0xd9f5138cb7261435, 0x9e754f1a9ef643a1, 0x8c1967dbace8521f, 0x1eb6c8fdcae94f6b, 0x1ebf7c4dc8fb5ed7,
+    0x9a76f3b219ef8d45, 0xcbed364547f39cb1, 0xcbf9e16546e5ba2f, 0x9813cde653f6d98b, 0xe42d863762ead8f7,
+    0xc53df7eba1edf875, 0x8615749cbfe237d1, 0x2cd46b9fecd5364f, 0x9c816a321de754ab, 0xb1a93c243ceb7429,
+    0x29dce6454aed8295, 0x1ec58d6767ce92f1, 0xd5ce68a986c2ae5f, 0x5c3248f983d4aecb, 0x3e6f427cb2c7ed39,
+    0x6e9bdc1fe1d9fca5, 0xb9745a8654de2c13, 0xaf2349d54ec13a7f, 0x47b281a65dc348eb, 0x248ca6b54cd76859,
+    0x8d1ab43769da87c5, 0x4db3f75cb8cda743, 0x41b8593dc5bea49f, 0x42d3be81f6b3c41d, 0xf48ebc5214c5e279,
+    0x17f4bcd543b8f1e5, 0xce47381984dc2163, 0xae3d5c765d8c2eaf, 0xe1ac36598ca15e2d, 0x58ac3e1bacb35d89,
+    0x1fbd65ced9a67bf5, 0x3d2ca4b1f6ca9b73, 0x7dbe3482157b98cf, 0xeb492a13259fb84d, 0xec5347a654a2e6b9,
+    0x892b63da93b5f627, 0x14bde3fcb2ca1693, 0xd7f65c9a9d8a24ef, 0x2d73954cbc9e436d, 0xb4d675c1fca162d9,
+    0x14c628932db59147, 0xef6acb432b968fa3, 0x23ef75465789ae21, 0x3b79ae26546bac7d, 0x594f2c68736fcbe9,
+    0x25184b7dc392fb57, 0xbd7e62afe2961ac3, 0xa635e84fef893a41, 0x9e5c4da21f6b379d, 0x37f8ca543d8e571b,
+    0x4d9b1a854da19587, 0xdea354187b8495e3, 0x68bea2fdca98b461, 0xa9e8426dc568a2bd, 0x917ea3bfe57cd13b,
+    0x1425a7bdc25edf97, 0xb176a98325841ef3, 0xd7e82f9652963e71, 0x7ea84cd54f573bcd, 0x743fdbc87e6a5c4b,
+    0x45d8b6c98c4e5ab7, 0x3c864b5edc719a25, 0x39584c6fea64b891, 0x32157abfe745a6fd, 0x3f4cb9121749d56b,
+    0xe4d2c963235be4d7, 0xc13b5e49827ef345, 0x36784e2ba28534b1, 0xe36a8f9bae67532f, 0xab56231dce49518b,
+    0x43f569bdcb3a5fe7, 0x5972cd31fa3d8e65, 0x5367efc43a529dc1, 0x6728a5c32854ab3f, 0x694ea7b54635da9b,
+    0xde43a5c87548ea19, 0xc49fad2ba23cf985, 0xd5f9763cb35f28e1, 0xe19f54adce42375f, 0xe8a92d51fe2645cb,
+    0x53c4f1821e2a7539, 0xef1c2b854d2c83a5, 0xae4cd2787b5ea413, 0x7b362d898942b17f, 0xd6341e798623afdb,
+    0xf5397b6cb526de49, 0xb74f5a1dc328fdb5, 0x94287c51f45c1d23, 0x98fcd2a5413e2b8f, 0x9b1d72865e1249fb,
+    0x3d4f62587e145a69, 0x149b56376c1978d5, 0x9c1d8e5a9b1ca853, 0x39da281cb71d95af, 0x743e1d9fe831c52d,
+    0x8d2a5be1f614e389, 0x91623b743617e2f5, 0x75e8fab9864b1273, 0x1dc479a8742b31cf, 0x6fadeb176bec4f3d,
+    0xc31eba687cf15ea9, 0x2ad4587babf48d17, 0x3f8417dedaf69c83, 0x3ba74cfdc5e789df, 0x8fe1ab6216fcb95d,
+    0xdf29ea5324efd7c9, 0xfa54bd6765e2f837, 0xefd2c15a94f617a3, 0xe38d791cb3fa4721, 0x4c35172a9feb347d,
+    0x765def1babcd53e9, 0xb8acd321fce19257, 0xdb2ae7832be591c3, 0xd27a638549d7af31, 0xf5c3728435c7ae8d,
+    0x2ae754c654dabcf9, 0xce8462b983bfec67, 0xe3c8f7dba5e41bd3, 0x7da31c4ed2e73b51, 0x8364951fefc738ad,
+    0x18da97b21fdc582b, 0xfbc65e232dce5697, 0xe3bcd7865bc196f3, 0xeaf84d598ad4b571, 0x8c2e567987b6a3cd,
+    0xe743195ba6c9d24b, 0x21b8c49ed4ace1b7, 0x2716a5edc3adef15, 0x7ab6145325c43f81, 0x8dfb7ce541a53ced,
+    0xd28157a43fa84d5b, 0xf1e9b8754e9a5bc7, 0x9672c5d87cae8b35, 0x34162b9ed8c2b9a1, 0xf5a1482ed7a4b81f,
+    0xfd537e61f4a5d67b, 0xac318d4214a9d5e7, 0xda7b4c2323acf465, 0x7be562c874af25c1, 0xd4619c3a91b2543f,
+    0x473258b98fa6529b, 0x428c673dceba7219, 0xf794c83edc9b8f75, 0x46935d21f97c8ed1, 0xb14265a32981ac4f,
+    0xa7f5bc432673dcab, 0x3bd178254586eb29, 0x91b4fed76378fa95, 0x179dfc6ba48c29f1, 0x648adefcb19e286f,
+    0xac9827bdcf8246db, 0x3dca8951fea57649, 0xdce73f521e7984b5, 0x6bd481954d8ca523, 0x6d2c9af5496da28f,
+    0x19ce5d376872c1fb, 0x3c54e72ba673df59, 0xc5d7e98ba376fec5, 0xa56b394ed58a1e43, 0xaec8763fe16b2c9f,
+    0xf26139b4327f4b1d, 0x65b97c343f625b79, 0x8cab9ef43d6479e5, 0x97f62cb87d58a963, 0x192e7568784a96bf,
+    0x9ef36adba85eb63d, 0x397bda1ed761e4a9, 0xaed83c1fe685f417, 0x59842f6326791483, 0xafbd2476546932df,
+    0x71d3ea89827c415d, 0xfebc92876d3e4fb9, 0xc398ad6bad538e27, 0xb41375acbc458d93, 0x3f82ebcdc9368aef,
+    0x9bd32ac1f739ba6d, 0x1538dca2163ec8d9, 0xe25378a43851f947, 0x64759bda976518b3, 0x3eb8fadcb5694831,
+    0xd2514a6cb14a358d, 0x48e6d23bae2c54f9, 0xe5c6487dcd2f8367, 0xa2b63591fc5492d3, 0xfd8197543d47b251,
+    0x695db1243826af9d, 0xd4a12ef65739ce1b, 0xe934d8b7652ced87, 0xa6e352dba7521ce3, 0x57123c9ed7453c61,
+    0x2b89e51fe12639bd, 0x6c358dbfef1a593b, 0xea4d19732f1d58a7, 0x718d42654d2f9815, 0x6974def87d23b681,
+    0xb9ac62787915a4ed, 0x54cd721ba918d35b, 0x24e681fcb61ae2c7, 0xae54c2fdc72df135, 0x3c62baf1f75342a1,
+    0x6f485c9325143efd, 0x13e9dab652174e6b, 0xd982a6c43ef85cd7, 0x5ced4f876dfb8c45, 0x2bd8514769fe8ab1,
+    0xfd398e6ba8e1b92f, 0x362e915dc6f3d78b, 0xacb3568dc4e5d6f7, 0x1da3485214eaf675, 0x9b283c7545fc26d1,
+    0x75a326b873de254f, 0xc7a5e42981f253ab, 0x3e4f2dcbafe67329, 0xf6a218ecbdea8195, 0x8fd3417cb9ca8fe1,
+    0xac1873bfe7bc9d5f, 0x12e84d6327e1adcb, 0x41f976c327d4ec39, 0x6d3f78e434d6fba5, 0x436e5c8986ea2b13,
+    0x6e8a5f7983dc297f, 0xfe9d68ca91cf37eb, 0xfb5ca74dcfd26759, 0x5dfc3e91fed486c5, 0x396e7c121ed9a643,
+    0x2cd1e76328cba39f, 0x3c59b21658aeb31d, 0xb41f8c6768c2e179, 0xb6235c4986a3efd5, 0x93758dacb6c81f53,
+    0xe91cf2bdc3b82daf, 0x94576ea1f1ab4c2d, 0x49a8dcf321bf4c89, 0x5b3621943eb27af5, 0x3f169ac54ec59a73,
+    0x6f2a3bd54ba697cf, 0xbe59c2f7689ab74d, 0xc54319dba68ed5b9, 0x7d9fcb1ed8b1f527, 0x9b8f4761f7c61593,
+    0xa7d586b215a723ef, 0xf4cdae5653ba426d, 0xb3e9154762ac51d9, 0x23e58fc65d9e6f37, 0xd214fab87d928ea3,
+    0x2b637facbc96ad21, 0x3926e14fe986ab7d, 0xef65c791f568cae9, 0x31e7a5d2168dea57, 0xcbfd45e657a219c3,
+    0x728a14c987b63941, 0xa45e1b7982a7369d, 0xea75196dc29a561b, 0xa95df71cbf9d6487, 0xdfe6a59cbc7f84e3,
+    0x938c2a71fd94b361, 0x41f625b32c75a1bd, 0xd751af843967cf2b, 0x7cba9284365ade97, 0x2d963e18756becf3,
+    0x9542df3cb6923d71, 0x721d893cb2743acd, 0xa59b734fe1875a4b, 0x52436e7fef4a59b7, 0x9867d4121f6d8925,
+    0x2c9de7843d5fa791, 0xf9ce13d54b62a5fd, 0x7c4f1ba98a75d46b, 0x972ed5aba958e3d7, 0x65ef941dc87bf245,
+    0x96bfa32ed67e23b1, 0xd38ba27fe683512f, 0x98cb413212634f7b, 0x17c53f8431465de7, 0x34e97bd54f3a8d65,
+    0xc2f3b8176e4d8bc1, 0x4f5e72c87b4e9a3f, 0x51f2ebadca42d89b, 0x37641c9eda45e819, 0x6438e9cfe639f785,
+    0x83fb6ed4385b27e1, 0x7c5623d4374d265f, 0xea51c6d9836154cb, 0x925d7f4cb1657439, 0x3586b1dcbf3782a5,
+    0x9183b42dce5ba213, 0xf4a5138dca2b9e6f, 0x3715fcadc72f9edb, 0x8f316e521a32ed49, 0x85becd143824fcb5,
+    0x1a45c6d878591c23, 0x3d9fac78753b2a8f, 0x4b7f295a942d38fb, 0x9fdb2a5ed2315869, 0x21796f3dcf1387d5,
+    0xa38f75c1fe18a753, 0x5947a6f32d1894af, 0xd45f3c265a1cb42d, 0x17a58ed65a1fd289, 0xd42635c98923e1f5,
+    0x9e47fabdca482173, 0x83d1792ba5172ebf, 0x18462f3dc51a4e3d, 0x36e9ba81f21e4da9, 0x3f17e45654328c17,
+    0xdf29cea54ef29b83, 0xdb8526a43be498df, 0xf1e74b354af7b85d, 0x4c28a79657fad6c9, 0xf45632cba8fde637,
+    0x6fb9875ed8f216a3, 0x54d8e16fe8f74621, 0xab61cd7215f8437d, 0xc1329ed543fa52e9, 0x5ef89a1762fd8157,
+    0xa7b3e4965dce7fb3, 0xc7853f198cd4ae31, 0xdba5c37879e4ac8d, 0xe8af72dba7d6cbf9, 0x42d7f891f5daeb67,
+    0x8a735fb216bcf9d3, 0x591a4cb768e23a51, 0xe2d95af765e437ad, 0xd179462a93e8572b, 0x14f62e3ba1eb6597,
+    0x4b38f9da9ebc85f3, 0x86514a2cbdcfa471, 0x5e46cd91f9b3a2cd, 0x9ab7d6c32ac6d14b, 0x5c7b96f328b6dfa7,
+    0x92d6f7b547bafe15, 0x526e4bf876bd2e81, 0xcbd6248985a13bed, 0x9d65a12ba2d34c5b, 0xdb7e182fe1d65ac7,
+    0x8d9746bfefcb8a35, 0xd8cf46932fbd98a1, 0x78bd19e43c9ea71f, 0xfce268354ca2d57b, 0x18ce6a5769a5d4e7,
+    0xa5f3428ba8b9f365, 0xd3589aced7ab24c1, 0x936cb5edc6ad423f, 0x5c94e371f4c2519b, 0xad487fe212a35ef7,
+    0xbd1568c431b68e75, 0x87c619a54f798cd1, 0x5ef837965d7c9b4f, 0xd7c1f836586fc9ab, 0x1a47932dcb83ea29,
+    0x5123d87ed7a4f895, 0x58d91c7fe6a928f1, 0xacf41b82159b276f, 0xc69f1483248e35db, 0xec7fa61983b17549,
+    0x29d3458a91a483b5, 0x8ad1f35cbf98a423, 0x6542739cbd69a18f, 0x38afe12dc85a9feb, 0xa14659fed86fce59,
+    0xe97d46a21972fdc5, 0x7e38f4d65a971d43, 0x846a9d1545672b9f, 0xfba78549857b4a1d, 0x4b65817cb26e4a79,
+    0x782b314dc29178e5, 0x3f7c584edf74a863, 0x19b8de2fed4695bf, 0xea87dc521e69b53d, 0xa5b81de32b5cd3a9,
+    0x3f7a85965a6fe317, 0x6e17f49bab951283, 0x3ed2679ba87631df, 0xbf871e6cb5683f4d, 0x123ba95ed25a4eb9,
+    0xb7f23861f15e6d27, 0x1d7e23b542618c93, 0x54d128f32d4389ef, 0xe1d7acb54e35b96d, 0x47dac8e65b38c7d9,
+    0x738e59ca9a3ce847, 0xaed8347ba84ef6b3, 0x1894e76fea854731, 0x5e6d7a31f756348d, 0x584bfd92164853f9,
+    0x8c4d9756534c8267, 0x2e3d41b8725e81d3, 0x16ab23f98e52af41, 0xeda2f5787c23ae9d, 0x1762fc5a9a36cd1b,
+    0xfd2549aeda29ec87, 0x6d497f1ed72bfae3, 0x861cd324394f2b61, 0x91af72e6574238bd, 0x75b846da9726583b,
+    0x5318e97cb32956a7, 0xf396b12cb23c9715, 0x756fa8bcbf2ea581, 0xfe8db27cbc21a3ed, 0x5e687f31fc14d25b,
+    0x95e2c8d43b26e1c7, 0x6ef893754a19ef25, 0x4c1fd257683c2f91, 0x321ef5a8761e2cfd, 0x4fe39d1ba7124d6b,
+    0xa2f6ec7dc3145bd7, 0xeadc684fe2198b45, 0xa34f16cedefa89b1, 0xcb394ea21deca82f, 0xdef74c632aefc68b,
+    0x23afc9d54ae2d5f7, 0x7b1a32e98ae6f475, 0xa26cd8fba8f925d1, 0x2154dfcba7eb234f, 0x384c175dc5fe42ab,
+    0x924b863fe5f37129, 0xe1347c6212e37f85, 0x631bae4542f68de1, 0x56bf73c43ed89c5f, 0x1db92cf548ed9acb,
+    0x54938b2768cfdb39, 0x1f7a849cb8d2f9a5, 0x47c15baed9e72a13, 0xe35dab9fe5d9287f, 0xe63f9cb215da36eb,
+    0x7f6e4b1323de4659, 0xfdea527873e184c5, 0x7f241eda91e6a543, 0x471be5687ec6a29f, 0xc7dbe1398ec9b21d,
+    0x857f19bed8abcf69, 0x418b923cb79fced5, 0xf75d92a32ac41e53, 0x7f6ae28437b52caf, 0xa9e2341656c84b2d,
+    0x1c9ad85763dc4b89, 0x8c315b4982bd69f5, 0x8bc35f9dc2d1a973, 0x39b28f7cbea396cf, 0xb7e62841fea7b64d,
+    0x351a9b421ea8d4b9, 0x7dfe63943bace427, 0x7835fb1658aef293, 0x4c92f57878a432ef, 0x56139d7ba8b7416d,
+    0x5e83a76cb3a74fc9, 0xb43c678ed2ab6e37, 0x3d4659a1f19e7da3, 0x2c37fd9654b3ac21, 0xe1569c832f83ba7d,
+    0xec197f643d75c8e9, 0xa4179e254c8ae957, 0xdcfbe217698bf7c3, 0xfa71c5edc9af2841, 0xb1a6237fe7a2359d,
+    0x568a4721f4a7651b, 0x8e5acd6214ba6387, 0xf57ad816549b82e3, 0x635794b8739ea261, 0x784cd1965e619fad,
+    0x1ce2b6d98d74ce2b, 0x8e3945abab65ed97, 0x12795acdc968ebf3, 0x472fa591f98d2c71, 0x6c4d7eb2176f29cd,
+    0x3ac579843782594b, 0xbd8a32c7639458b7, 0x32689a5cb37a9825, 0x387f2a6cb27ca691, 0x6273eb898e5c94fd,
+    0x297a465dce71d36b, 0x62be54a1fb64e2d7, 0xb14def832c78f145, 0xd584e3165c7a32b1, 0xbe8a4c26586b3e1f,
+    0x671ef459865f3e7b, 0x356fa89ba4625ce7, 0x14a5cb7ed2748c65, 0x64a23defe2578ac1, 0x2f489acede4ba93f,
+    0x5391a8b21f3ec79b, 0x124de3854d52e719, 0xc5a2b9687c43f685, 0x7f6c32ba9b5826e1, 0xdb8ea37cb96a245f,
+    0x76fae48ba75d43cb, 0x1843baced75f6239, 0xcf234e71f46381a5, 0xbf25841323458ef1, 0x6f9eb73541379d6f,
+    0x1e4783654f289cdb, 0xdf21bc376b2edc49, 0x32f186498c31fab5, 0xda32b87edc561b23, 0xfb7da96eda36298f,
+    0x926a748fe62937fb, 0xebfa5432182d4769, 0xed2f6394342f76d5, 0x1e57c6da9742a653, 0xe4b1fc39812593af,
+    0x94bd762a9f18b32d, 0x8dcf491bae2bd189, 0x247a38dba91bcfe5, 0x4ed672cfeb421f63, 0x71658fd439142dbf,
+    0xa8c9f4b659174c3d, 0x3efd94c656184ca9, 0x378164da952d6b17, 0x1b36527cb41f7a83, 0x342816bcb31297df,
+    0x89ac64fbaef3b75d, 0x9512d7afebf6d5c9, 0xb51c9e421cfae537, 0xcf84692329ecf4a3, 0x1356a7e87aef3521,
+    0xf86a15d989f3427d, 0xf5269d7ba7f651e9, 0xd3f8e41cb3e96f47, 0x1962e73dc2fa7eb3, 0xa8f7156dc2fe9d31,
+    0xcb3def6432f1ab8d, 0x6a9d5f432ed3caf9, 0x938df6143cd5ea67, 0x3981d4265ac9f8d3, 0xb5c48e198aed2951,
+    0x43b9e8fa97cf26ad, 0x376b5f4ed8e3562b, 0x5a76fed1f3e56497, 0x674f3ba215d984f3, 0xf5c1d9b654eca371,
+    0xb754f92652be91cd, 0x328a4ed76ea1cf3b, 0x6e354b876cb3dea7, 0xbe21c46a9ab7fd15, 0xde27149fe9ca2d81,
+    0x347a29b1f69b2aed, 0xcef3dba217cf3a5b, 0xd63abfc436d259c7, 0xce6ab71874d68935, 0x615efad763d897a1,
+    0x2c4f1de982cba61f, 0x5fd143698f9ec47b, 0xe9b87afcbca1d3e7, 0x3b4751dfecb4f265, 0xe92ba6454db823c1,
+    0x2de8caf659ba413f, 0x19fd6ec5469c3f8b, 0x6dc832a7659e4df7, 0x5147ce6ba4b28d75, 0x67fa324dc3a58bd1,
+    0x34a8cfbed1b79a4f, 0xa3b785efef69c8ab, 0x59decb121f7ed829, 0xe12cf3743da1f795, 0x1c9256476ca527f1,
+    0x7eb52af87ba8256f, 0xdc81349ba78934db, 0x7e6a52bdc7ad6349, 0xb3fda51ed49f72b5, 0x67ca9431f6b5a123,
+    0xd8179c5212849e7f, 0xf31659b431769deb, 0x73e9a5b43f6acd59, 0xb19d4fe54a6debc5, 0xd71ea26bad921c43,
+    0x2a319e5dcb742a9f, 0xcdb14a7fea87491d, 0x3e5c2d41f56b4879, 0x1ba5efd2148c67e5, 0x41bac893248f9763,
+    0x23eb1697637294bf, 0x714e628a9186b43d, 0xb68edfc98f57d2a9, 0x28fa37dbad6be217, 0xd62349acba5cef73,
+    0xb6da579ed9612ecf, 0x15f3c6421a753e4d, 0x59e18bd328564db9, 0xb621cea5485a6c27, 0x4d568219845d7b93,
+    0xf2ecb74a924d78ef, 0x926b71edc152b86d, 0xfe341a9cbf34c6d9, 0xb37c9461fd39e647, 0xe1d7a8c21d4af5b3,
+    0x4c3a79e65c7e2631, 0xc6a345e87b61438d, 0x65784f398a6452f9, 0x68e1f43dca498167, 0x37bd54fcb5497fc3,
+    0xbf1649ced35c9e41, 0x9c3bd18fe13f8c9d, 0x3da19cb54253dc1b, 0x2d3f59643f24eb87, 0x2c9eb7465c27f9e3,
+    0xe17b53698d4c2a61, 0x41cd6279893e27bd, 0xd5967c4eda41573b, 0x1c4358dfe92365a7, 0x86f92c31f7389615,
+    0x8b42c163263ba481, 0xa9d3c816543b92ed, 0x521b4398723fc15b, 0x9b584ce76e12dfb7, 0xd3b725ca9c16fe25,
+    0x9412bf3cbc382e91, 0x4c689ebdc8192bfd, 0x7fc3d8b1f81e3c6b, 0xce8b273439215ad7, 0x43e8f1d769138a45,
+    0x3126fd78752698b1, 0x23b4ed898419a72f, 0x463f7c5a921dc58b, 0xde25a7398bedc4f7, 0x28abe63cbce1f375,
+    0xb124ae7febf624d1, 0xa4189d521be8324f, 0xca3792b438f941ab, 0x42ce78b547ec5f19, 0xb3a179d874df6e85,
+    0x69b8ed4a95f38ce1, 0xa976345ba2e49b5f, 0x5af481ced1f6a9cb, 0x7eba163dcfebda39, 0x9dbc1e721fcde8a5,
+    0x8956ec176de42913, 0x74ed98a65bd4267f, 0x291f863769d735eb, 0x715a39eba8eb6459, 0x7c38451ba6ed73c5,
+    0xa267391dc6df9243, 0xb57a8e1fe4d3a19f, 0x874e63c212c49efb, 0x8d3a57c431d7ce69, 0x1d98e6743fa9ecd5,
+    0x2459ac176badfc53, 0xfd9cba4879c12baf, 0x972845dcb9c54a2d, 0x8a9e1c7fe7d64a89, 0x4e879cdfe4ca68f5,
+    0x15694ba215cd9873, 0x561892d323ae85cf, 0x79aecf1873c2b54d, 0x5c4b319871c5d3b9, 0xf253ea198fb9e327,
+    0xdc7bf2a98dabf193, 0xdb53a46cba9c21ef, 0xb38c4e6fe9a13f5d, 0xc45fad3218a34ec9, 0x45f97b2329b86d37,
+    0xc8b1fd6545b97ca3, 0xa325f7e875ad9b21, 0xa241d537628fa97d, 0x762359acb1a2c7e9, 0xbc82fa6dcfa4e857,
+    0x3ca1be2fed98f6c3, 0x2659b8d43eac2741, 0xea2dc9143b8e249d, 0x2c6934187ca2641b, 0x7e461cda9ab46287,
+    0xad569f3cb6a781e3, 0x2894671dc48a9f51, 0x6a7b423dc26b8ead, 0x38246c9fe17fad2b, 0x6fc958a43182ec97,
+    0x6b89a5e32d75eaf3, 0x8e43f9c65e892b71, 0xab3d87c65b6a28cd, 0x927d546a9a7e384b, 0x671d8abeda9156b7,
+    0x437a1bdfe8a49725, 0x5467e3a1f487a591, 0x9f13bc82146893fd, 0xc987dfe5437dc26b, 0x84adefb6526fc1d7,
+    0x1a823b598d72ef35, 0x6fc8d3ea9d762fa1, 0x85c69aebab683d1f, 0x16ab25cfe95a3d7b, 0xda48f761f85d4be7,
+    0xb796ad432a718b65, 0xc5d62974376489c1, 0x475b1f987456a83f, 0xebd9a7487248c69b, 0x8759312ba25cd619,
+    0x3ec8215bad3fe485, 0x35ba491dcd7425e1, 0x7c31894fec67235f, 0x3beda4c21d5842cb, 0xfc93e6854b5c6139,
+    0xce69d845483d6f95, 0x4bd915ea97528df1, 0x2ade78fba5439c6f, 0x2a37e5cdc2359adb, 0xe63487afe138db49,
+    0x6b598c1edf2ce9b5, 0x396afd421d4ef923, 0xc4b7f1365d43278f, 0xea3cf2b87c2536fb, 0xd6f73cb98c2a4569,
+    0xda63875ba92b74d5, 0x572864cdc82e9453, 0xac94d8bed64192af, 0xd7239a41f645b12d, 0xfa98d3621325cf79,
+    0x2d871b454128cde5, 0x421985765e1bfd63, 0x1a562f876a2e1cbf, 0x2b71ed3a9c124b3d, 0x67cd913edc154ba9,
+    0x32a8ed6feb296a17, 0x3b2ac4d1f61c7983, 0x9571cb43251c86df, 0x783914654721b65d, 0xcef791287513d4c9,
+    0x679f514ba218e437, 0x9d5f2b487de8f2a3, 0xec82761badfc3421, 0xfa7e26dcbafe317d, 0x56e1b27dc8e14fd9,
+    0x7b961ca21af36e47, 0x12bf6cd328f67db3, 0xba51ef4656fa9c31, 0xdc245fe653fc9a8d, 0x36d5ea9762deb8f9,
+    0xe72d541cb1f2e967, 0xd374cf9baec5f7d3, 0x932dcea1fdea2851, 0xe74913f21ceb25ad, 0xde1786c43ade452b,
+    0xb487fc265be16397, 0xce5d29b879d582f3, 0x3b18af7cb6e8a271, 0xdb5243ea93c78fbd, 0xc2f14b7a92dcae3b,
+    0x8174edcfe1bfcda7, 0x3c187a6542d3fc15, 0x74391d254fd62c81, 0x3a7eb8254cb729ed, 0x3ecf58a76adc395b,
+    0xf62bed4769be48c7, 0xf8c7263dcad19835, 0x368c24bfe7d496a1, 0x9decb75fe4c7a51f, 0xe6a7315214d9c37b,
+    0x972bf4a543abc2e7, 0x972f3be872bfe165, 0xc1bdf3698fb532c1, 0x7a52e1b98ca63e2f, 0x5d6f34ca9ca73e8b,
+    0x4b76fcaed89a4cf7, 0xeda743f1f8ae6c75, 0xf1bc9a7437b28ad1, 0x172d49e326b3a94f, 0xbe7938a54395c7ab,
+    0xad9f231763bad729, 0x6cd32ea981ace695, 0xc72b6d5a9c8de5f1, 0x4592ecfdcda3246f, 0xa829e631fc9643db,
+    0xe6a413521dba6249, 0x8eab26343a9c71b5, 0xa975d426579d8f13, 0x1a5db2f765819d7f, 0xf14d238984739ceb,
+    0x1b578adcb286dc59, 0x2ab7d98ed178eac5, 0xab8172fede7cfa43, 0xa9efcbd32d6e189f, 0x743f5d865e93481d,
+    0x95d7efb43da54679, 0x834e72954b8976e5, 0xe4b62a5cba8c9563, 0xed3c48aba56d83bf, 0x4ba9183fe681b23d,
+    0x8edfc761f374d1a9, 0xc3159d421276cef5, 0xbacf37454169fe73, 0xc6a4e2d54e5a1dcf, 0x51a329787b6f2c4d,
+    0xd32568a98d624cb9, 0x8f3dba2edc856b27, 0x837ce91feb587a93, 0xd368c14ed54a87ef, 0x1db86e32154ea76d,
+    0xe156d3f43461c5d9, 0xf9e47bca9283e547, 0xe6975fda9167f4b3, 0x5678d1ebaf7b2531, 0x4adf98cbae5c328d,
+    0xb7e23f4dcb5e41f9, 0xde21734feb426f57, 0xd5fae1821a457ec3, 0x8f6a91243a589d41, 0x7198afe5453a8b9d,
+    0xda6b3e28754eca1b, 0x6593adbcb341ea87, 0xba45196cb154f8e3, 0x3f416c7edf482961, 0xa45c9821fe3926bd,
+    0x5316e9821e2d463b, 0x612c7e343c2f54a7, 0xf2d5a1698c639415, 0x47d9618a9b46a381, 0xc1edaf8ba63791ed,
+    0xb73c289dc529af4b, 0x63a2d4eba32dceb7, 0x14ce7d9fe341fd25, 0xc2d1453763452d91, 0xeaf9c8654e162afd,
+    0xf94beda65e193a6b, 0x4631cf576b1c49d7, 0x54317debab1f7945, 0xb354f2aeda2397b1, 0x9352b76ed815a62f,
+    0x49378b51f517c48b, 0xc7be2983251ac3f7, 0x68afe957641de275, 0x94c368ea965423d1, 0xfae172d98de5314f,
+    0xb142f6787ce53f9b, 0x216d83cbabf85e19, 0x58bcf9edc9fb6d85, 0xb2fc816dc6fd7be1, 0x86dbca1327e19a5f,
+    0x54be1f8325f3a8cb, 0xbfdc24e654f6d839, 0x613b4a2762f9e7a5, 0x8d47326a92ecf713, 0xf7eb269a9dce157f,
+    0x2e761d4bacd234eb, 0xd472fc81fce76359, 0x618afc421be972c5, 0x1984a7c65aec9143, 0xef9d25c435bc7e8f,
+    0x3d54ba8765c19dfb, 0x4265b18984e3cd69, 0x18d39f5a92c6ebd5, 0x7b352e1dc1d9fb53, 0x6215d8aedebc19af,
+    0x5d7f4bc21ebf392d, 0xf9ae37143ed24789, 0x3bdcef843bc467f5, 0xb2d4e3865bda9673, 0xfd15239876ba84cf,
+    0x1bdf268a96bea34d, 0x47b385cfe5c1d2b9, 0x3fd746e1f4c5e127, 0xd916ef8212b6ef83, 0xca64be9542a81edf,
+    0x1e27c6f54f9b2e5d, 0xd5a874f65b8f3dc9, 0xc956482a9db26c37, 0x69cd83aed9c57ba3, 0x96714a3fe7c89a21,
+    0x5c84bad1f49ba87d, 0x1fe63b42148db6e9, 0xfe25bd1434b1e657, 0x376d45a872a4f5c3, 0x231e47dba3c92641,
+    0x54c29b787f8a239d, 0x943e65fbae9d531b, 0x19a3f78edcaf5187, 0x692843efea927fd3, 0x54fa86932ba69e51,
+    0x29cedb4325768cad, 0x321dabf54579ac2b, 0xdf128ea6536edb97, 0x764e2dcba481e9f3, 0x136b45ded3b52a71,
+    0x7fbda9ecbf8627cd, 0xfd8293e1fe8a374b, 0xd9f184621e8d45b7, 0xd6b93ac43c9f8625, 0xf18432976c83a491,
+    0xbe18da27687592fd, 0x21574f8ba578c16b, 0xade623fba359bfc7, 0xd2e359bcb27cde35, 0xd69bc571f4832ea1,
+    0x6f182cb542853c1f, 0xa59264d32f563c7b, 0x798f3c143d594ae7, 0x237c16898c4d7a65, 0x124f8b6a9a5f78c1,
+    0xe917864dc962a73f, 0xa26b43efe764c59b, 0x2e95a4f1f468d519, 0x713aec42146be385, 0x352d9ef6546cf3e1,
+    0x2e187fda9481325f, 0x315cf2b98f6541cb, 0x54da637bad475f29, 0x786fba2cbc3a6e95, 0x3d692fced94b7cf1,
+    0xa642b58ed73e8b6f, 0xc8ef5d321742a9db, 0xed8b12a32735da49, 0x1854bcf76437e8b5, 0x817f2bda945bf823,
+    0xa742163ba24d168f, 0x65a8c19bae4135fb, 0x347d2a6ede235469, 0xba5c3f41fc2873d5, 0x591ec7b21d4b9253,
+    0x7ab69ce5493c81af, 0x3184e9a6573e9f1d, 0x86fbd2a98632ce79, 0x8f7e952a9624dce5, 0xa7e8f25cb428fc63,
+    0x76c1adfed2391abf, 0x3c9a14fdcf1e2a3d, 0xd8e967243f2148a9, 0xbf235d765e246917, 0x95ea3df65d169783,
+    0x5cb96fd76a1985df, 0x495c817a981ca45d, 0x8a42df7ba61fb3c9, 0x456f97aed814e237, 0x763cbe2fe526f1a3,
+    0xd948be17675a4321, 0xea7324c6531a2f6d, 0x23b84a154cfb3ed9, 0xae6f94b76bef5d47, 0xe5c3abf98af27cb3,
+    0x48316fbdcaf69b31, 0xae7354fdc5f6a98d, 0xf4ad518ed4eab7f9, 0x1543a8d214fed867, 0x2d6c9ea545e1f6d3,
+    0xc851e92a94f62751, 0xde6cb8a981f724ad, 0x325bfc498fea542b, 0x14e3f6cbaced5297, 0x687943dcbace71f3,
+    0x986bd43fead39f61, 0x6df41ec217c48ebd, 0xf615429326e7ad3b, 0xd8532af434e9dca7, 0x4eb9f63874cdeb15,
+    0x13a8c4dba5e32b81, 0x879d641ba1c428ed, 0x54b178cdcfd7385b, 0x7ac6e481feda46c7, 0xe5387a921ecd8735,
+    0xb9ead5c43bcf85a1, 0xc1e8a9b769c3a41f, 0x3c458bd768d5c27b, 0x2643897a95b8c1e7, 0x2b961dfa93badf45,
+    0x9428dafba39cfeb1, 0x354c1e6fe4b13d2f, 0x268e4da321c43d8b, 0xb24d15832ea64bf7, 0xa5cd2f643eca6b75,
+    0x952143b65bac79d1, 0x452d689767ae984f, 0xd9fa16ced792c6ab, 0x7d3c468fe7b5d629, 0x9e26db81f3b8e495,
+    0xd8ce6143259ae4f1, 0x493fb2d654ad136f, 0x6e7c4b3873a142db, 0xb3612f898fb56149, 0x6d8cf1a98d976fa5,
+    0x613e28bcbc9a8e13, 0x928dc17ed96b8c7f, 0x6c2f198ed56f8aeb, 0x4cbe7a121782db59, 0x67af15e32684e9c5,
+    0x59e42b1765a8f943, 0x1d62f947638b179f, 0xd92ef15ba29e371d, 0x13b58e6dcfa14579, 0x27bf415dcd9374e5,
+    0xfbc64721fda89463, 0x3f6147b21c6982bf, 0x6c7d3a95497ca13d, 0x96c37ed4365ebf89, 0x2f8b1e798672cdf5,
+    0x3f2861cba485fd73, 0x983e5c7ba3671bcf, 0xacb9e35fe17a2b4d, 0x53841f9edf5e3ab9, 0x63c5df143f816a27,
+    0xb9e578132e647893, 0xc9163b543b4586ef, 0x7a3bc4587b49a56d, 0x87f6c349875cb4d9, 0x4f638edcb86fd347,
+    0x531b6a8ed674f2b3, 0x4f8ab231f6982431, 0x81c927b32469318d, 0x93f6a7b5415a3fe9, 0xf9ad32e76f3d4e57,
+    0x57ad82f98e517dc3, 0xe28a756bad659c41, 0x92a413edcb358a9d, 0x1857c42fe748c91b, 0x5f6e9421f53cd987,
+    0x5341bc82164fd7e3, 0xe3df8b4659742861, 0x8c12d659834625bd, 0xf73d915ba169453b, 0x57b48fea9f2c53a7,
+    0x4817e2dcbd4e8315, 0xd238951fed53a281, 0x7b6cda9fe9238fcd, 0xc597e3621926ae4b, 0xcf16b2543628cdb7,
+    0x65a2d987673bec25, 0xa15be248753efb91, 0x68e1c93ba54329fd, 0xb45d689ed125396b, 0xf75b1e6dcf1948d7,
+    0x3a46cf81fe1c7845, 0xd6375be43d2e86b1, 0x64a298376c31a52f, 0x6b419c276a14c38b, 0x213eca598916c2f7,
+    0xbd73e69cb82ae175, 0x71b5d84a952aefc1, 0xe1b5d62cb52d1e3f, 0xe8d9f371f4123e9b, 0x946ef8d543265d19,
+    0x4ac5b6832ef76c85, 0xefb748354cf97ae1, 0x2e9a76c54aec895f, 0x8fb3e12656ef97cb, 0x21baed8cb8f2d739,
+    0x1c8be4fdc7f4e6a5, 0x2c6b7d5ed5e9f613, 0xa2671c5325eb147f, 0x9b35f21654fd23eb, 0xecb8a32983f16259,
+    0xdcabe2698fe471c5, 0xc6bf5e1a9cd78f23, 0x8a34f1c76ac97d8f, 0x2dfb491a96da8cfb, 0x7deb3a9fe5dfbc69,
+    0x5dc8f13217c2ead5, 0xefb459c327d6fa53, 0x59a7dc8654d718af, 0xa95fec1874eb382d, 0x3cae298ba1de3689,
+    0xc4fae57baec176f5, 0x958c3b7dced49573, 0x2d35ba6feab683cf, 0xb751e3a21bc9a24d, 0xfc687b2437adc1b9,
+    0x1f843a6546aecf17, 0x3cf9ad6876b2fe83, 0x6a51c34984a51cdf, 0x6e3279cba3b82c5d, 0x9c5a371fe1da3bc9,
+    0xa8c6db7edfae5b37, 0x7a6d1e532fc179a3, 0xd42c1ea54ec5a921, 0xb1273fe43cb5a67d, 0xb9d6238547a8b5e9,
+    0x89ce56ba98acd457, 0x6a54e1fba69fe4c3, 0xe192d7afe8c62541, 0xad6be971f4b6329d, 0xa8739dc434c9521b,
+    0x58e9af6431ab4f67, 0x4ecd31754f8c6ed3, 0xc52b6a187ea29d51, 0x564fbdc76c738bad, 0xd73c21aed986ca2b,
+    0x57c8a6efe568da97, 0xca93412fe57bd8f3, 0xe76cbd83259ef871, 0x1c72b965459326cd, 0x64fb25c982a7364b,
+    0x7e2dc83981a954b7, 0x2148a95baf9c8425, 0xd789b64cbd7e8391, 0xbac3746dcb7291fd, 0x23a98befe973af5b,
+    0x79d6a4521965bec7, 0xd4f965e32879ed35, 0xeb831c95456bfca1, 0x86b3fd79857e2b1f, 0xf631ba9dc4823a7b,
+    0x9ec4b18dc18549e7, 0x14c65d8edf4a7965, 0x738f2d41fe5b87c1, 0xcbf891d21c5d963f, 0xbea2d1c43d61c49b,
+    0x158e94676b75d419, 0x14c5362a9a67e285, 0x9a23587ba769f2e1, 0x1e6ba34cb67c215f, 0x1792f45dc35e2fab,
+    0x5ea4df61f1735e29, 0xb61279e321746d95, 0xa7f1d8343e487bf1, 0x63b41c954d3b8a6f, 0x7e48acf65a3e98db,
+    0x8cd4fe9bab51d849, 0x97f28e4dc943e7b5, 0xd85afb9ed958f723, 0x8e1c29bfe64a158f, 0x47f91ea2165c24fb,
+    0x7d4bcf58725f4369, 0x54be82ca916372d5, 0xf5c8412baf479153, 0x57cbda898c267e9f, 0xc45213798b3a9e1d,
+    0x4871a2fdc82ebd79, 0xdf32a581f831dbe5, 0xdca41eb21924fb63, 0x82aed375473619bf, 0xe46b9538764a293d,
+    0x16bdfea9842d37a9, 0xa16e758cb23f5817, 0x4b2ea81dcf129683, 0x4b1893dcbc1584df, 0xf7d836c1fc18a35d,
+    0xf9d172b43d1ab2c9, 0x8bc19f465a2ed137, 0x394f85676821ef93, 0x4c3f587987241def, 0x4936c2fba5172e6d,
+    0x51bf867cb4183cd9, 0x4269b3afe21d5c47, 0x81534cfdcdfe6ab3, 0xc146f8254ef29a31, 0xc654efd32cf3a78d,
+    0xe8592ad43ae5b6f9, 0xfde3178549fad567, 0x2f4a8c1987fbe5d3, 0x5ca4d19ba7def451, 0x4c583b6dc6f423ad,
+    0x576b3dafe4f7532b, 0x1f48a65323fa5197, 0xdc38e67541da6fe3, 0x38af42654fcd8e61, 0xfa8d5e165ae18cbd,
+    0x94e6dab879e4ac3b, 0x7cd36efa98e5dba7, 0x915ab74dc7d9ea15, 0x7b8693afe5dcf981, 0x1bc8a92325bf17ed,
+    0x631a982546e2375b, 0x7e83cd5982e645c7, 0x478cbf6a91ea8635, 0x2c9ba5d87fdc84a1, 0x5fd74ab98cbd931f,
+    0x82153e4fead2c17b, 0x39a4586fe8a3bfd7, 0xe1c6d9f219b7de45, 0xf5eba67436a8fdb1, 0xfd49eab656ab1c2f,
+    0x5f4ab28764af2c8b, 0xd65fceba93c24af7, 0xf1b4e39dc1d46a75, 0x25c7634dcfb978d1, 0xe7c18a6fedab974f,
+    0x58af97621d8e95ab, 0x92ebc3f54cb1d529, 0x82cd5fa76ab4e395, 0x8f169eb768a7e3f1, 0xe24931da97ba126f,
+    0xedc4562ba59c31db, 0xfb65e48dc2ae4f39, 0xb42d6f71f1b26ea5, 0x98df427542b68d13, 0x16825fe32e968b7f,
+    0xb7f1e9843d6a89eb, 0xab7c9fe54b7eca59, 0x7e4cadf87a91e8c5, 0x16f57cadc9a5f843, 0x34b56c8ed5a7169f,
+    0x87cab5d1f59a361d, 0xde34cab215ad3479, 0xe7d164c5429f63e5, 0x1be6573981b49263, 0x43ab5cd76e7581bf,
+    0x4daef3198c679f2d, 0x4fd123b87c5abe89, 0x397ace6ba86dbcf5, 0x68ae91cfe981fc73, 0xf8adc94328741acf,
+    0x51bd986436872a4d, 0xa8237146546a38b9, 0x2a14df6ba38d5927, 0x1765bd9cb18f6793, 0x74c6f23bad6285ef,
+    0xfab6512dce75a46d, 0x43de65a1fc57b3d9, 0xd47a3c921c6bd247, 0xf24d97e5496de1b3, 0x7e8f21d98b954231,
+    0xf68912da98642f7d, 0x6a7f134ba4563de9, 0x1e95a37dc26a4d57, 0x63a59d7fe15d6bc3, 0x4bc8a6fede5f8b41,
+    0x39165ba21f42a89d, 0x276c53943e45c81b, 0x132bead54c39d687, 0xbf2564a8794ad6e3, 0xe3968a1ba94df561,
+    0x3e5c1f8dc86124bd, 0xcd285a7fe876543b, 0xe5f239c1f34852a7, 0x9b21ad64346b8215, 0x2c4f9be6524c8f71,
+    0x3eac69b54b2f7ecd, 0x37fac4d87e32ad4b, 0xe74d1fc98a24dcb7, 0xb4f628cdca38eb25, 0x7da9b83ed73bfa91,
+    0xa27316cfe63c18fd, 0x4d591fb32941386b, 0xa4193bc6582346d7, 0x723f81dba3298745, 0x452df73a923a85b1,
+    0xad85f2c98e1c942f, 0x4d925c3a9d1fa28b, 0x4f12b39edb23c1f7, 0x9d2417afea14df65, 0xd1fe52c43927fec1,
+    0x34e2c7b6582a1d3f, 0xac7f5216561e2d9b, 0x1e526c7ba7325c19, 0x26ac3fbdc4136b85, 0x7e3cb9fdc32679e1,
+    0x243e879cbde7985f, 0x1d94b8cfedfa96cb, 0x5a9cbd321bfec639, 0xc5893de43bf1e4a5, 0x4b69dec87ae6f513,
+    0xe9c2db4769e8137f, 0x6a2e8d1986f932eb, 0xbda935ecb6fd4159, 0xa4f286dba2de4fb5, 0xc534df8ed1f48e23,
+    0x458fcd7321e47c8f, 0xa9b8f6232ed68afb, 0xcbfa61343deacb69, 0xe6c48da548bec9d5, 0xdf8eb4798ad1f953,
+    0xfa3b846cb8d417af, 0x731af8edc6e8372d, 0x5b36a491f4eb3589, 0xac34f67213dc64f5, 0x91dab5e652df8473,
+    0x6cd39e8761d382cf, 0xb13f65e87fc6a14d, 0xd98214c65dc6bfa9, 0x1c47dea989bace17, 0x7f462eacb7aced83,
+    0x572bc34fe7a21bdf, 0xe6793f8218c42b5d, 0x7126a5b325d63ac9, 0x8fd6912764db5a37, 0xe5941fa872cd68a3,
+    0x152e376ba3cf9821, 0x16d8fb7a9fb2a57d, 0x859741fdcda5b4e9, 0x967b83c1fcb9d357, 0x9c6b14521b9ae2c3,
+    0x745c82a659adf241, 0xae6b53d768b2319d, 0x7a6db59876a43ef9, 0x9f3a785ba3b84e67, 0xea72485cb2a96cd3,
+    0x368bc9dfe2ad8c51, 0x8732e95dce6f79ad, 0xc84b53d21f83c92b, 0xd52aeb832ea4d897, 0x97e4a3f54b98d7f3,
+    0xbf84dac65a9bf671, 0xcfd2e9ba978e15cd, 0x6a51cd4ed8a1354b, 0x9e6b713fe6a453b7, 0x34c89f51f4b98325,
+    0x973cfd6434ab8291, 0xd5ca7834316a7fed, 0x5b619e343d6f9e5b, 0x8b9e2ad65e62bdc7, 0x9456df8a9b86ec35,
+    0x8c37e14dc967fba1, 0x1f7c385ed87b2a1f, 0x9f7c6421f56e297b, 0x95dfec23269148e7, 0x579bdc2324a37865,
+    0x95cbea76539786c1, 0x3b1f2cd9817a953f, 0xbf53a6e87f5da39b, 0xd2fa791bad6fc319, 0xf6493dbedc73e185,
+    0xeb7561fdc965efd1, 0x8b9e7a132a681e4f, 0x3f8bc62437592eab, 0xa5b1c286576e4d29, 0x392a578ba4716c95,
+    0xd345719cb3647af1, 0x2a5b6e8dc145896f, 0x914fbcadcf3897db, 0x246ed371fe3dc749, 0xad65b7321c3fd6b5,
+    0x239dacb65c74f623, 0x47c5b6987b56148f, 0x21e54af8795823fb, 0xaf14627cb85c4269, 0x83e5671cb74e61d5,
+    0x4957a31ed5618f43, 0xbc5a346fe1437d9f, 0x63b219c432469c1d, 0xac68bf543f28bc79, 0x2cf3d1e54d2bcae5,
+    0xa1c69e487b2fea63, 0x6e9432ca9a4318bf, 0x78ca942dca46283d, 0x7b8526efe72836a9, 0xa3d78bc1f83c5617,
+    0x6ef95372162e7583, 0x5d84a9b7654183df, 0x6f7b4c898134a25d, 0x7a2316b87f26b1c9, 0x1f5823798d19cf27,
+    0xa83c7e598a1bde93, 0x3e6b81da971cdbef, 0xfc72a541f9132c6d, 0x1e4f586328153bd9, 0x5c21e6f438195b47,
+    0xeacb5d28751c69b3, 0x48759aeba52e8931, 0x917fdb5cb321a68d, 0x6fd8cb598de2b5f9, 0xb86af12cbcf5d467,
+    0x8e2f135dcaf8e4d3, 0x4fce28b32aebf351, 0xd9c1864548fe12ad, 0xe57ba6c879f3512b, 0xd83e216a96e34f87,
+    0x19378dca94f76de3, 0x91b6ad8cb3fa8d61, 0xd47cf69a91fc7abd, 0xe7496f2dcedf9a3b, 0x6b9e57421fe2d9a7,
+    0xc7ebad643cd6e915, 0x2346fc154bd9f781, 0xd73bf5e658ca16ed, 0x78164efa98de265b, 0x3d5a84bcb8e154c7,
+    0xa79f584ed7e68435, 0x5e96a2c1f4e783a1, 0x8e16b92434da921f, 0xea2db6c431dc9f6b, 0xefc6a7243c9faed7,
+    0x2b1ac7e87cb2ed45, 0x7d93e6f879a5fcb1, 0xf65c271ba9c81b2f, 0x41d657afe6dc2a8b, 0xb3e729dfe5bd39f7,
+    0x8be9612328d16975, 0xe2af597435c487d1, 0x39e2bc1652c7964f, 0xf4e3dab761d894ab, 0x9d1ec6387fadc429,
+    0x73d58e498cafd295, 0x17eac6fdcba4e2f1, 0xe3154cbfeab7216f, 0x74fd531218972fcb, 0xc516298327ab4e39,
+    0x98b6cfa4369e4da5, 0xe5fc67da96b28c13, 0x41857fba92b38a7f, 0x452fe7cdc1a598eb, 0xa7dc2b6edf7ac859,
+    0x78fd3b61fe8bd7c5, 0x1d74c8521c9fe743, 0x487adfc54ca3159f, 0xf2ae43876ba7351d, 0x3ec9b51768ba4379,
+    0x1432958ba79b62e5, 0xbe213c8dc5ae8163, 0xa826bc5dc3817eaf, 0xda2be471f1849e2d, 0xe521dc432175bd89,
+    0x27e8a6432e68cbf5, 0x7afd46854d6ceb73, 0x719c6325495de8cf, 0x517692abab83294d, 0x62459dfeda8537b9,
+    0xb487a1efe69a5827, 0xc4823a71f48c7693, 0xf137a6e2136c74ef, 0x2e9bdca65481a36d, 0x92ec6d476174b2d9,
+    0x8235ef7a9f68d147, 0x5dfc41a87c58dfa3, 0x162e39da9a6bfe21, 0xd382491cb95f1e7d, 0x24be8a31f8623ce9,
+    0x3a78e1c21a864c57, 0x27ec5f6327586ac3, 0xeb5c2138756c8a41, 0x12f94ed7624e879d, 0x92ac764ba362c71b,
+    0xa57f81ecbf43d587, 0xf278d65cbc47d5e3, 0x83e16dafec5af461, 0x4dbe58232a5c13bd, 0xe9dbca565a6f423b,
+    0x18a6bef98b6351a7, 0xe936254a98456ef3, 0x37b84e5cb5498e71, 0x4f21ac9ba2397bcd, 0x1c79abfed13e9c4b,
+    0xeda4287fef31dab7, 0xf4c76ea21f34ea25, 0x9be13ad54d36f891, 0x79ef43a65b3917fd, 0x8de251f98a3d276b,
+    0x39ef76dba92f35d7, 0x7b62c98eda328645, 0x82746b1fe73684b1, 0x89cbe3afe548932f, 0x9e872fc3243ca18b,
+    0x79138bc5412cafe7, 0xfea5cb787f21de65, 0xe62cf3187b24fdc1, 0x9516f3ba9b271c3f, 0x3bca871eda182c9b,
+    0x2be5dc6fe82d4b19, 0xea78d39fe71f4a85, 0x4682b9c5492378e1, 0x83fc79d43614975f, 0x15c963d7631795cb,
+    0x68ae5419821bc539, 0x24dab3987efcd3a5, 0x1f3db8ca9bdfe413, 0xf1e2398dcbe4127f, 0x64c871bed9f631eb,
+    0x6bf513721ae83f49, 0xf59c2bd327fa4eb5, 0x9c48271656fe7d23, 0xe4b586d764e17b8f, 0xbcf1642872e389fb,
+    0x4ab892fcb1f5ca69, 0x4d17236bafe9c8d5, 0x39ef54a1fbdce853, 0x9345dbc219bde5af, 0xbfcd53e65be4362d,
+    0x3eb128c65be63489, 0xeac7f9d878d963f5, 0x1468ca2ba6ec8273, 0xefd826ba94bd71cf, 0x3f16952cb4c19f3d,
+    0x678e43a1f1d3bea9, 0x273eba5432e6cd17, 0x1ebc29832fb9ec83, 0xac71fbe43b8ae9df, 0x1a34d9b769bf1a5d,
+    0xcea1b7487ad238c9, 0xf39a1e5dcad65937, 0xe5c12a4fe5d967a3, 0xe8579bf1f5dc9721, 0xca9fe1d213be947d,
+    0xb82d497654c1b3e9, 0xcf1d274981c4d257, 0x2e54f6376fa7e1c3, 0x4fd6ca987ca9ef31, 0x6de9f2a87a9b1f8d,
+    0xe67213acb78e2df9, 0x8b3aecd1f9b24d67, 0xd37149f218a56bd3, 0x581ba62436c98b51, 0x4d9c2635439b78ad,
+    0x438fa6c7639ea82b, 0x9c5724dba2b1d697, 0x3275fc4bae94d6f3, 0x6724ec5dcda8f571, 0xd4a36bf1fb8914cd,
+    0x1ae694b21c9d234b, 0x3bea16d43a9f42b7, 0x7e9fba287ab48125, 0xf84d521a96a57f81, 0xcb6e9d5a93867ced,
+    0x65f8342dc27a9d5b, 0x71b84f9ed16eabc7, 0xaf21bd6edf81eb35, 0xfe928a532e74f9a1, 0x8a71c2f54d87291f,
+    0x4fd2ec954d6a287b, 0x48d7e5265a8c36e7, 0x3e57ab2cba9f4765, 0x9f341c6ed79385c1, 0xcf8a213ed586943f,
+    0xb74ca5d1f367a29b, 0xadf859e4347bc219, 0x98dfc7a4316dcf75, 0x384dc9a65c62fed1, 0x268bfc198c751d4f,
+    0x12ba7cd98c562dab, 0x9312b7cedb6a4c29, 0xb423e56fe86d4b95, 0xc91b37ded75e69f1, 0x3c5197821752986f,
+    0xf265b143235496db, 0x4bae67187258c649, 0x4c576bf9816ad4b5, 0x1c7b94fa9f6de523, 0xd79bef3cbd62138f,
+    0x184d573edc6532fb, 0x7de8fc21fc584169, 0x7b8a59e21a394fc5, 0xe98f41d3295c7e43, 0xed73c165453e6c9f,
+    0x1de8cb5986539b1d, 0x92da516ba234cb79, 0x3f94e17cb137c9e5, 0x123c5afdcf2be963, 0x532db89eda2ce6bf,
+    0xea327fc54e51273d, 0x4c69dfb76d2435a9, 0xf68d23a98c396517, 0x6dec957a9a2b7483, 0x6c58731a963b72df,
+    0xb619785cb63f915d, 0x7a5cd42ed432afb9, 0xa8fc3eb1f135ce27, 0xcd4193a54127ed93, 0xcd8279643c18daef,
+    0xec1347a65c2e1b6d, 0xf1eb59c87c213ad9, 0xb38915fcbc135a47, 0x754d896eda1768b3, 0xdae2495fe72b9831,
+    0x4ef2a371f41c958d, 0xca815743251ea4f9, 0x63fca8798512d367, 0x58b367298416e2d3, 0xb5e3cf287de8f251,
+    0xafd453b87cf921ad, 0xfc1e672989ec3f1b, 0xe581673cb9df3e87, 0x7fc4d2bed8f26ce3, 0xec9f482329f58c61,
+    0x7c842b6324f679bd, 0x1d7bc24654fca93b, 0xe4cb21d652fec8a7, 0x3945cfeba3f2e815, 0x82a5fe7baed4f681,
+    0xad85217babc715ed, 0xe96fb2d1fcea245b, 0xb9d4ca121aed43c7, 0xe138ad454adf7235, 0xc8d19e5769e482a1,
+    0xc9eda25765b47efd, 0xca34765983d79e6b, 0xa46c7fb982e9acd7, 0xf83ae1dba1bedc45, 0xda4f86cedec2fab1,
+    0xf5b62d743ec51a2f, 0x9b8d5ce43ed6298b, 0x91cd7e454bca38f7, 0x98cf31b76acd4875, 0x25c9e74a98bf76d1,
+    0x2f498b7cb7c2954f, 0x653b2edfe4d593ab, 0xc8a79d21f4d8c329, 0x8f6d5a4323cbd195, 0x2fe348c5429bcfe1,
+    0xf45239d76da21e5f, 0xaf389ec76d942ecb, 0x528a7fe98cb74d39, 0xcb59817ed8b94ca5, 0x1d26c75fe8ad7b13,
+    0x38bc192ed4ae697f, 0xb3c41f9215a297eb, 0x941b8cd323b4c759, 0x98e146c542a8d6c5, 0xbfa587d981abe643,
+    0xf35b86c76d7ce39f, 0x52fa3e9cbea2341d, 0xd3bc89efedb54279, 0x478c6f21fba861e5, 0xba6ef4821b9a7f53,
+    0x25dba813257b6daf, 0xa6cf3e75457f8c2d, 0x148fcdb76472bc89, 0x9c1623ea9284caf5, 0xc632b91dc198ea73,
+    0xea85296bad59e7cf, 0x9f68e721fc7e184d, 0x5a27ecf32e8136b9, 0x861fe2a43da45627, 0x83e7fbd54ca87593,
+    0x379d5c16586973ef, 0xc936d71ba57c926d, 0xd9bf13acb46fa1d9, 0x39c76d4ed482cf37, 0x7f5439c1f175dea3,
+    0xc1e89a754378fd21, 0xf8d72a543f5a1c7d, 0xa947ef654c5d2be9, 0x23e4157a9d814b57, 0x1f564d9bab7469c3,
+    0x2839bd7edb678941, 0x3c7651dfe54a869d, 0xc498aef1f45da61b, 0x65e31942135fc487, 0xa46d39276572d4e3,
+    0xc5bd681a9287f361, 0xf72145687f5812bd, 0x741d9eba9e6c413b, 0x6974f3dbab4d3f97, 0x71b36f8dca516df3,
+    0xf8e9b361fa548d71, 0x1ab6354218357acd, 0x19b45e6326389a4b, 0x18e7ca36543dc9b7, 0xc285d769834fd925,
+    0xa64d51ecb253f791, 0xf463182bae3516fd, 0x52bf7dcede39256b, 0xf43ed521fc2b34d7, 0xe738acd21c2e7345,
+    0xc29a6eb76c5283b1, 0xd73915f87a45912f, 0xa736f1b986259f7b, 0x5bfc874a9428ade7, 0x58671daba32bcd65,
+    0x4a8f53cba23febc1, 0x4fac31dede241b3f, 0xefcd95143f152a9b, 0xc731b5f65e284a19, 0xdab142576d1c4985,
+    0x6f5824398a2d67e1, 0xa5ef324cba21965f, 0x9cb5127ed71394cb, 0xb3879cdfe617c439, 0x74de8531f419d2a5,
+    0x7ec4f8a6564ce213, 0xd679e8a5421cde6f, 0x82d5ebf65ce12fdb, 0x95b634787cf53e49, 0xe5df21398af74db5,
+    0x6279fbecb9fa7c23, 0xab3e749cb5ec6a8f, 0x4a5c178dc4de78fb, 0xd84b675215f2c869, 0x287941d323f4c7d5,
+    0x2fe9164762f9e753, 0xc84f269761d9e4af, 0x74afdeb98fce152d, 0x4396fd5cbde14389, 0x1a57f2cdcbd462f5,
+    0x492568c1fbe98173, 0xe98caf3217c86ebf, 0x62c5daf326cb8e3d, 0xfd7a258434cf8da9, 0x3d7821f985e3dc17,
+    0x9578e62a92d5eb83, 0x45f3726a91b6e8df, 0x8e7931fbafcb195d, 0x5f2eb3c1fdbe27c9, 0xb4629fc32ed15837,
+    0x485c6ae32cd476a3, 0xf81d3ec65bd89621, 0x27bdcf9656ca937d, 0x769d31e875bca2e9, 0x6d5347aba4bfc157,
+    0xbcf6387dc4a2dfb3, 0x3189a4bed2b6fe31, 0x219f78c432b71e8d, 0xe83219f43e8a2cf9, 0xbdf621e54dae3c67,
+    0x7c3d9f187cb16ad3, 0x824b795a9bc48a51, 0x8c6f4e1dc6b587ad, 0x521b3c8fe5c9a72b, 0xb9efa5c1f3adc597,
+    0x867f4ca2149ec5f3, 0x8f413a5765b3f471, 0x145cea6872a613cd, 0xbcf179e87fa9324b, 0x86fad2b98e9c41b7,
+    0xe425fa9bab9d6f15, 0xc97df45edba27e81, 0xd5eca841f6837bed, 0xa4ebc7f217869c5b, 0x8f12d7b32468bac7,
+    0x4a296fd7648cda35, 0x64ba9d57637fe8a1, 0x8f94de5cb3a4281f, 0x5cbe6a9dcf95267b, 0xe894c35dcd8935e7,
+    0x7839ac41fd9c7465, 0x1a2745b32b8e74c1, 0xc152b7965b81923f, 0x19f38c465874a19b, 0x351c62d98465aef7,
+    0xf5923a8ba369ce75, 0x3db97e1a936aecd1, 0x296ef14ba16deb4f, 0x4295e16fef632cab, 0x6b9348721f764b29,
+    0x5f2a7c632e684a95, 0x43e71fa54c5b68f1, 0xce82f1465a4d876f, 0xcf9275dba86195db, 0x5df7832ed873c549,
+    0x8da4329fe467d3b5, 0xab75e2d1f57ae423, 0xbef61423235be18f, 0x21794ea6536e21fb, 0xa197b2487e623f59,
+    0xe3486a198d364ec5, 0x19fd5e3bac597d43, 0x8527ae6dc83a6b9f, 0xbf2ce69dc74e8a1d, 0x65ce74f1f641ca79,
+    0x8ba7c6d21743c8e5, 0xa81feb732547e863, 0x81d963f76238e5bf, 0x6e389bfa925c163d, 0x258ad7c98e3f24a9,
+    0x16aef28dce536417, 0x458d123fed467283, 0xacdb719fea3871df, 0xf95cb762192a8f4d, 0xf39ec1d4362d8eb9,
+    0x6fc9b2176841cd27, 0xd3ea58498624ec93, 0x36b4da898325d9ef, 0x2a13e6fdc2391a6d, 0x15eaf38cbf1c28d9,
+    0x6ce8b21fed1f3947, 0x376ebf254e1267b3, 0xab29d7165d269731, 0xb943d8565b17948d, 0x6c51d487671ba3f9,
+    0xc68df1eba81ec267, 0x19d8e46cb742e1d3, 0x925c78bdc625ef41, 0xed46a23fe3261f9d, 0xadf13e8654293e1b,
+    0x5ab8de932efb3d87, 0x471ac6e54afd5be3, 0xc4b321e87cf28b61, 0xa12be8d769f378bd, 0x4128ce9dc7f6a83b,
+    0xa3cb589ed4f9c6a7, 0x481b2dcfe4fcd715, 0x1f725ca324dfe581, 0x5ca6e3b765f314ed, 0x71cd653981f7235b,
+    0x4af58c176fe942c7, 0xe94287da9dec7135, 0x2cd387a98acd6f91, 0xa62f314ba8b17cfd, 0x4a5dbce1f7e39d6b,
+    0x46cbda5216e5abd7, 0xdc14b87326e9db45, 0xa274e53654dce9b1, 0xb24d15e763bde82f, 0xe3fa61dba1e3278b,
+    0xe76fd9cbaec536f7, 0x7af6423dceda4675, 0x756cfd41facb75d1, 0x6b8451d21abd834f, 0x4bca7e3548d192ab,
+    0x24ef951768d5c129, 0xf3c5921874b6cf85, 0x5b6fe39874a8cde1, 0x76534189829aec5f, 0x3d61c2aba29f1dcb,
+    0xe762bcafefb24c39, 0xce471d621fc64ba5, 0x842a6b354ec97a13, 0x3cb62e743cab687f, 0x28f1c6b5479d86eb,
+    0x2c65713ba8b1c659, 0xa93b5f2cb7a3d4c5, 0xd9c71f8ed6b8e543, 0x39f542ded3a8e29f, 0x18bf64c545ac231d,
+    0x4afb95d652bf3179, 0xe293dfa76e924fd5, 0x12ca58b98da67e53, 0xfedb15a65b876caf, 0x7b4e138dc97a8b2d,
+    0x9542763ed56eab89, 0xed56934fe681c9f5, 0x4be8f5c216a4e973, 0xa62719d32385e6cf, 0xa824f137639a174d,
+    0xa93fdc58718d25b9, 0xf2ec914bae9f4527, 0xb4a2cf7dcea27493, 0x5469bc2dcb8572ef, 0x7f3ced41fb78916d,
+    0xb9fdac72175a8fc9, 0x86417db3286dbe37, 0x14729fa65671eda3, 0xf59428da9685fc21, 0x3eac581ba3861b7d,
+    0x1beafc7dc1682ae9, 0x92c8f34dcf6d3a57, 0xb5638c7fed6f58c3, 0xd5ec84a32e739841, 0xde2897132c64859d,
+    0xf3e28d154c68a51b, 0x1b89c427695bc387, 0xc8ef64ba976dc2e3, 0x1ac6752dc783f261, 0x2175ad4fe47521bd,
+    0xb81e6c7fe1673f2b, 0xd47ce1a3215a3e97, 0x96d217832e4b5cf3, 0x537e18d65d4f6c71, 0xb58ed1676b4279cd,
+    0xf7c52d498c35a94b, 0xc1ab859ed936c8b7, 0x64e8b7afe74bd825, 0x5f7b8421f54de691, 0x86db1ef4376215fd,
+    0xc1fb82598375246b, 0xf359b6da915843d7, 0x42d3819a9f3b7245, 0x741f923a9e4d72b1, 0x75283c6a9a3d7e1f,
+    0x853f947eda329e7b, 0xd72369c1f824ace7, 0x1495eda21928dc65, 0xc2b371854639eac1, 0xd831be27652ce93f,
+    0x6f1c8d5ba541289b, 0x453a96edc2354819, 0x961a34cdcf194785, 0x267a3cedcd2a76e1, 0x49786ecfeb1c845f,
+    0x98cd2ba32a1f83cb, 0xaebd63276b14c239, 0xbefc45987926d1a5, 0x46f3ebc98627cef1, 0x2fc1b7d98419ed6f,
+    0x74fceb1a942c1edb, 0x41a857efe5213d49, 0x4d52796edef24cb5, 0x6e1f43921ef67b23, 0x8c9b6d532ce7698f,
+    0xc1357f9439ea87fb, 0x32e176b548feb769, 0xed396c2a98f1c6d5, 0xba5d281cb8f4e653, 0x6d1795bcb4d6e3af,
+    0xe5c49a8fe5fa142d, 0x1986fab214fd3289, 0xab9c2df762de41f5, 0x4ce9a2365ed27f63, 0xa41537d65ac46dbf,
+    0xc9218b576ae78c3d, 0x16f493e876eb8ca9, 0x693facdba6decb17, 0x97c5fe31f6d1ea83, 0x5e6f9ba215b3e7df,
+    0xfca3197434e7185d, 0xb94f37e653ea26c9, 0x4895de6a91ed4637, 0x3168dc498ecf65a3, 0x547f29acbed49521,
+    0x239c486febc5927d, 0x49c5fea1f8c7a1e9, 0xb178d43218cabf47, 0xb4aef293269dceb3, 0xb913ef2767b2fd31,
+    0xe16972c875b41c8d, 0xd7e8c31983c62bf9, 0x5c1276edc1da3b67, 0xb5a9382cbfac59d3, 0x2dc1e43fedbf7951,
+    0x4953bda21eb286ad, 0x39f876c43dc5a62b, 0xb5687df43ab8c497, 0xf456cba7679ac4f3, 0xdce5478a96ade371,
+    0x9847adbcb6a312cd, 0x58c7dbafe5c6314b, 0x1dc739bfe1b63fa7, 0x65dfeab432ba6e15, 0xc2b589343f9c6d81,
+    0x7b18e6a43b7f6aed, 0x93f461276d829a5b, 0xe2c581476a84b9c7, 0xf42a1b8dc7a8d935, 0xdb4a7f5ed58be7a1,
+    0xdc378f2ed48ce61f, 0xdec6213436a1257b, 0xe2f3548762a534e7, 0xab5e613981b97365, 0x2a5f1c476f8a73c1,
+    0xe76d3c9a9d7c813f, 0xd8e354ba9a5e7f8b, 0x1845ca7dc962adf7, 0x68b35921f984cd75, 0x6291ade32867ebd1,
+    0x4516d2c32569ea4f, 0xa9c8e456546e19ab, 0x6d15924cb5814a29, 0x5eba168dc1a34895, 0xe458a6bcbe5867f1,
+    0xa43987edcd4a856f, 0xb8cae391fa5c84db, 0x471a58c21c6fb349, 0xc1fe28d54a73d2b5, 0x6b2e4f176a87e123,
+    0x8e6d2a798546de7f, 0xa6c3285984591feb, 0x12a7ed5cb36d2e59, 0x3657d4efe2714dc5, 0x5827ec4fef657c43,
+    0x4ac8ed721e356a9f, 0xc385f2943e4a891d, 0xda21ce954c3db879, 0xf123bc67693fb7e5, 0xed15238cba52e763,
+    0x857132fba735e4bf, 0x813ab47fe769153d, 0xa72e89f1f45c23a9, 0x24ad1653246e5317, 0x67d4c32a94627183,
+    0x125dfa965d236ecf, 0x3947dc187c268e4d, 0xf1a623576c278db9, 0x3285a79ba93dbc27, 0x97f51e6dc72fdb93,
+    0x9753b1adc632d8ef, 0xd8a69fe32835196d, 0xcf32de65453827d9, 0xcf6e412a952c3847, 0xd97524ba912e56b3,
+    0x739b285cbf429631, 0xeb49fd2cbe14938d, 0x3a18c2bedc16a2f9, 0xc9d35621fb2ac167, 0xc64b12d3281abfc3,
+    0x289adcf6582fde41, 0x35e49bc767231e9d, 0x23e1974a97263d1b, 0x321645fcb4193c87, 0xa961538dc21b5ae3,
+    0x72e954acbefd7a61, 0x795c6f1dcaef67bd, 0x5637e9c21df2a73b, 0xd5ea49232bf4c5a7, 0x18462a954af9d615,
+    0x4fe283d767fbe481, 0xeb2c765875cbf2ed, 0x4c9753bdc7f1325b, 0x49fbd86ed3f541c7, 0x71459fded1e86f25,
+    0x7e3a259432fa6e91, 0x29ce86432eca6bfd, 0xe753af643adf8c6b, 0xc15db43659e2bad7, 0xb6cd8a1989e6da45,
+    0xe7d8314ba6d7e8b1, 0x19fb27acb5cae72f, 0x64397ac1f4de168b, 0xfe854ca326d135f7, 0x3bf21ae982e36475,
+    0x8a3dcb5762e874d1, 0xf32be5976eca824f, 0x45cd8be76ecd81ab, 0x1f36952878beaf19, 0xa3c1f64ed9b2ce85,
+    0x5ea26fc1f7a5dce1, 0xd1abe53216a7eb5f, 0x2ab89c3435d91acb, 0xc596fb2765ce2b39, 0xa4f51db983d149a5,
+    0x89d6751cb2d57913, 0xf53416dbaeb5867f, 0x91a6e53dcda985eb, 0xfda98541fcadb459, 0xd15bc4e21a9fb3c5,
+    0x8e32d9176ab5e243, 0xedf8134547a5e19f, 0x76f81a4987b9321d, 0xe2174dc984ab2f69, 0x68492f3ba29c3ed5,
+    0x58e3627fe2b17d53, 0x2fab38dede836baf, 0xdcb43ae21f968a2d, 0x784fc9b32e67ba89, 0xae57cd243a7cb8f5,
+    0x83c59a465a9fd873, 0x79d462ba9782e5cf, 0x9acf412dc8a7164d, 0xa78961bfe5a824b9, 0x5ad29471f3ac5427,
+    0xafb7ec1214ae6293, 0x93fd7546539271ef, 0xbfc629454e738f5d, 0xbcf78a154d658ec9, 0xdc248f698c69bd37,
+    0x21edcb5a986bdca3, 0x9c5a213dc87feb21, 0x24c973f1f6831a7d, 0x37d81e42167528e9, 0x5f1cea43248a3957,
+    0x1ecd4897628b57c3, 0x842cd16ba29e8741, 0x8d6e419baf61849d, 0x542381fdce75a41b, 0xa92d635fed56c287,
+    0xa3ebf891fa69c1e3, 0x8d5a27e3296bdf51, 0xfe897413264cfead, 0xb4ea2fd768743e2b, 0x862e74cba4653d97,
+    0x5c78fd1ba2685bf3, 0x71cf54bed25c6b71, 0x37ace64baf3e68cd, 0x8a5ec6f1fe51a84b, 0x136584721e43c6b7,
+    0x2a19edb43c48d725, 0xcb5d46376b4ae591, 0xadef3697674ae3fd, 0x4d1a2e9ba85f136b, 0x59e1b87dc86342d7,
+    0x54ac836fe3687145, 0x879a6e4fe2486fa1, 0xead26cf4324a7d1f, 0xe9d365b43f2e8d7b, 0xaf21d4565d31abe7,
+    0xe8a6cd798c23db65, 0xb31dc6798a36e9c1, 0x5af748ecb729e83f, 0xb35c1e4fe63d179b, 0xb285916fe64f3719,
+    0xd94581b219324685, 0x16c4a7e9843675e1, 0x473ecbf87129835f, 0xc6b419376f1a82cb, 0xf64c32798d2eb139,
+    0xa6279f5bab21cf95, 0x18d2546cb924cdf1, 0x94625d1ed815ec6f, 0x3d9bf81437281cdb, 0x851b37c6571d2c49,
+    0x2a76d938761f3ab5, 0xb37129dcb6147a23, 0x2364d7ecb214678f, 0xc3426d8a9de586fb, 0xa937e2fdcdfab569,
+    0x16ce79dfe9fcb4d5, 0xa56b84121aefd453, 0x62bdcf8548d3e2af, 0x4fabde9769f7132d, 0x2d3ac4f876fa3189,
+    0x46258d1984da3fe5, 0xaed8562ba2fd5e63, 0x51de97cba2e16cbf, 0x9c71643dcfe48b3d, 0xb41f97d21fe58ba9,
+    0x85e61bf43de9ca17, 0x97fea3654aecd983, 0x1cd7a96547aec6df, 0x8914fdcba9e3175d, 0xa62b5fdcb7e625c9,
+    0xc1ab987ed6ea4537, 0x9d5e7421f2ec64a3, 0x837de6b435de8421, 0x83cd4ef653e2917d, 0xc67f28154eb38fd9,
+    0x85fb1dc65dc6be47, 0xdb6c4f2769a8cdb3, 0x9238ebca98abec31, 0x28d594fcb59efa8d, 0x9d246cafe6c32af9,
+    0x1dec5ba218d53a67, 0xd47821c324c958d3, 0xce19368763dc7851, 0xdb391ef761be75ad, 0x8c53d2b98fc1a52b,
+    0xaed568fbaeb4c397, 0x436a295edba7c2f3, 0xbd98fe51f9bae271, 0x41ae67f21679efbd, 0xaf4ce3d5479e1f3b,
+    0xc8935e4656b23ea7, 0x5e4d271a94b76d15, 0xd1af459ba3b96c81, 0x41f2ba7cb18a69ed, 0x684a5ebdcf7e895b,
+    0xb8c962a1fe91b8c7, 0xa7456ed21ea4d835, 0x15796cb43c97e6a1, 0x7638a4b54a89e51f, 0xc86fe537689d147b,
+    0x852e794ba69f23e7, 0xcf38a4ded8b37265, 0x86e3da7fe4a672c1, 0x752d3fced1987e2f, 0xc48adf23216a7e8b,
+    0x14b6eaf32e5d9cf7, 0xc17f3ea54e81dc75, 0xa91426e76b74ead1, 0x38dbe7a98a76e94f, 0x38f9214ed76918ab,
+    0x5bc2374fe67d3829, 0x6ba53c2fe48f3795, 0x7148bea3259376f1, 0xfc2a75843295846f, 0x2a473b56516783db,
+    0x9d2c34b87f6cb249, 0xc1d475398d6ec1b5, 0x64afc83bab72df13, 0xf1936bdcb953ed7f, 0x32ca9f61f8561deb,
+    0xc7bd9a62186a2d59, 0xca2d9e63276d3bc5, 0xb3d64f89857f6b43, 0x461d23eba352689f, 0xa463bd8cb265981d,
+    0xf8ec73adcf38b679, 0x85e637cdcd3ab6e5, 0x289cdaf1fb4ed563, 0x1f82cda32a51e3bf, 0x7ea398c65b76143d,
+    0x4b5e1c276b5732a9, 0x847321fba96b5217, 0x1da27e3ba64c5f73, 0x7461c2fa923e5dcf, 0x27eb4dcfe1528c4d,
+    0x624d937fef248cb9, 0x7cda8b621f38cb27, 0xacb1e7354e2bda93, 0x1b6fd495492bc7ef, 0x21efb68a9b42186d,
+    0xfe8965bcba3426d9, 0x51496bceda293647, 0x7e51689fe72a65b3, 0xcd7b3691f64d8531, 0x6579eb12143f728d,
+    0x6a31be476243a1f9, 0x2ace89476e14bf57, 0xe4c9f6876d17bec3, 0xb34d2a598b2aed41, 0xce34df59871cfb9d,
+    0x6c87529fe9423c1b, 0x4fdc5731f9143b87, 0x4c7f5d23281759e3, 0xf8de3495452b7961, 0xf7d4c896531c76bd,
+    0x25873a49821f963b, 0xfe87cd498ef1c4a7, 0x2e5fca8bacf6d415, 0x62ea9c4dcbf7e381, 0x23491d5cb7c8f1ed,
+    0x6a852c9439fd215b, 0x23bf68c436de2fb7, 0xca3fd4b878f36e25, 0x42317af984f56d91, 0x4c5fba1982e76afd,
+    0x58c6941a91fc8a6b, 0xf6bc5d898fcea9d7, 0x35e47961fce1d945, 0xa851f2632cd4e7b1, 0x9df351b43ac7e62f,
+    0x84a7cdb549ea158b, 0xe18c5ba768dc24f7, 0x34198edba8df4375, 0x4e3ad98cb6e473d1, 0x3a9f74edc3d6814f,
+    0x32d8b16fe1d67f9b, 0xe59218f432dbae19, 0x49ed5fc32faebd85, 0x9d312e565ca2dbe1, 0x6f1e953769b3ea5f,
+    0xaf97624878d619cb, 0x1369a5edc7db2a39, 0xc3691defe6cd38a5, 0xbd86a5cfe5cf6813, 0x3d94e57214c2857f,
+    0xbad65ce432c584eb, 0xbed4a26761d8b359, 0x5a4e18976f9ab2c5, 0x57be6d498caed143, 0x265937e87a91de8f,
+    0xc251ba7dc8941efb, 0x2e43dc71f8b72e69, 0xb461a85217a93cd5, 0x8c9ef15327ad6c53, 0xe69ab835438e59af,
+    0xbf14d6c874b3892d, 0x1f26358ba1c4b789, 0xa8e394fbae98b7f5, 0xbcf4a56dce9bd673, 0x452a968fe97bd4cf,
+    0x9357fca43ca2154d, 0x971d2bc54ca523b9, 0xc6b2fea76ab95327, 0x2df5376987ab6193, 0x43a5f2e9837a5edf,
+    0xfe76a91ba28f7e5d, 0x4a2ce63fe1728dc9, 0xb5694d8fef85bc37, 0x15836af21f67dba3, 0xefb948654d7bea21,
+    0x9ae36f843a5cf87d, 0x6152c8a76b8127e9, 0x694f7c5dcba43857, 0x42a17f6ed79856c3, 0x1348d92fe59b8641,
+    0x364b7cd1f26c739d, 0x6db18ac3247f931b, 0xbfad47965293c187, 0xacd126b54e65bfd3, 0xd79a1b287c68de51,
+    0xc5498bf76948fcad, 0xc6a8e51ba96e1d2b, 0x4c26819fea613c97, 0xe4531c6fe8745af3, 0xa2748e1329586a71,
+    0x785e91f3234967cd, 0x9fd13ba7625d974b, 0x6a1f2839814fa5b7, 0x159e8c3baf73d625, 0xdb18f63cbd56e491,
+    0xae7d964cba47e2fd, 0xeaf438d1fa5c126b, 0xf4e128632a5e31d7, 0xd98fbe454a716f35, 0xf5ca9e1878546ea1,
+    0x195f6d7a95467c1f, 0xac74965ba2398c7b, 0x5eb4691cb13c9ae7, 0x92a16e4cbe2fca65, 0x4abd2ef1fd43e8c1,
+    0xae4bc9f21c25e73f, 0xf27da3454d38169b, 0x296fc4b87b4c3619, 0x16fd859a9a2e3485, 0x897ef42cb95274e1,
+    0xafc168edc734825f, 0x86a729cfe43681cb, 0xbc5d642fe138af29, 0x651b7834312cbe95, 0x892fcde54d2ebcf1,
+    0x35a427c65c12eb6f, 0x2e9534f87c251adb, 0x92ea465bac182b49, 0x1a264c3ed81c39b5, 0x34718dbed81e6923,
+    0x6d9ca21fe521768f, 0x1e7ac653261385fb, 0xd8be39265317b469, 0xd15ba9f87219b3d5, 0x126ab7e87efbd253,
+    0xf342915769ecd1af, 0x1a3dc28babf4312d, 0xf3e6857dcae42f79, 0x8ca5fe2dc8f73de5, 0xf8b567e218fa5d63,
+    0x8179fb4324ec5abf, 0x5f9d3ea654ef7a3d, 0x86e194c763f2b8a9, 0x27634d5ba2f5c917, 0xc261af7bafe9d783,
+    0x1275dac98ab9c5df, 0xc64951bfe9bcf45d, 0xcfb538143be124c9, 0x692b4ec32be65437, 0xd947fca659e862a3,
+    0x8c7146ba97eb8321, 0x78e31c4983cb7f6d, 0xe87ab2d982bf7ed9, 0x86917a2dc1e2bd47, 0x54b271dfefa5dcb3,
+    0xab4d82132fc8eb31, 0x94d165232cbaf98d, 0x9c2631854abd18f9, 0xe7f245a98bd13967, 0x5df7692ba9c457d3,
+    0x82e37f4dc6d98751, 0xca84d51fe3c974ad, 0x478feb21f3cd942b, 0x4e5d7af213cfb297, 0x4b61a29762b4c1f3,
+    0x49a3ebf54ea5df61, 0x7ab4d9854a86febd, 0x5bd64f187c9a1e3b, 0x2b7eda5cb89e2da7, 0x25e7693fe9b26c15,
+    0xf932ca51f7c46b81, 0xba387e4214a568ed, 0xca16e97323ca985b, 0x9cb17ed5429da6c7, 0xd258c41981afc735,
+    0xf8257a398f93e5a1, 0x1afd786bac96e41f, 0x3b6ec29feda9137b, 0x9452f7b1fa9b32e7, 0x5b2694d32bae4165,
+    0xbc2d136548926fb1, 0xd2e3cfb656947d2f, 0x15eaf49763957d8b, 0x82dfac9ba2689bf7, 0x2fa6754ba18dcb75,
+    0xc1239d6bae6fc9d1, 0x6a142c8edc72e84f, 0xef986c232e8517ab, 0x63f897e54d8a3729, 0x39bad4854b8c3695,
+    0x9fc25678798d65f1, 0x7a269d1cb791836f, 0x4f7b2a9dc57482db, 0xdb4e9c7fe387b149, 0x5c48379fe168bfa5,
+    0x826df435427bce13, 0x956d2fa32b4edc7f, 0x85b219d65d631ceb, 0x1d84b7f98d762c59, 0x124f763a9b683ac5,
+    0x8149d2bed97c6a43, 0xbe45182dc64d579f, 0x3bd9a581f562971d, 0x1ecad7921463b579, 0x573ec6b43267b4e5,
+    0xc852e7f9817ad463, 0x14bda6276e4ad2bf, 0x6cd4e2b98b5ef13d, 0x46935fadcd6431a9, 0xba1f23cdca463ef5,
+    0xc42379f1fa495e73, 0x69bda14217395bcf, 0xc6f1bd83263e7b4d, 0xe5a3c8b765418ab9, 0xd7f582ba9354ca27,
+    0xa3b92fdcb146d893, 0x6b7df8ea9d28c6ef, 0x95d46e8bac2bf56d, 0xe379c48feb3f15d9, 0xba1475f21d623547,
+    0xfc5138a65c2764b3, 0xe163d5487b5a8431, 0x73f256ba963b718d, 0xdce371f9842c7fe9, 0xc3e87bfdc431be57,
+    0x24ba638fe124bdc3, 0xc28f947edf27ec41, 0xc2dba5932e17fa9d, 0xedb237165e3d2a1b, 0xa3d1bf265c1f2a87,
+    0x53e829ba9b1258e3, 0x4c8179bdcb257861, 0xb1ae873dc61875bd, 0x8267dcbfe61c953b, 0x6e2cb8d1f41eb3a7,
+    0xb1cae4676742d315, 0x9fe5bd187435e281, 0xedca75b43ab4efcd, 0xe4983d676ce81f4b, 0xe34c8fb769fa2eb7,
+    0xd729c53ba9fe4d25, 0x7145ac6ed8f26c91, 0x98c571bdc5e369fd, 0x469e5cf214f5896b, 0x8bad914323f9a8d7,
+    0x6319b4f762fdc845, 0xfe95dac872efd6b1, 0x6cb4d1a98dc3e52f, 0xc24983ebade6148b, 0x1587ab9dcbd923f7,
+    0xae86bf41faec4275, 0x89d1356439ce62d1, 0x3149feb548c17e3f, 0x917f34c545d37e9b, 0xb5e392c874e6ad19,
+    0x4facb2d872e9bc85, 0xfa43b15982dbcae1, 0x4f36a2598caed95f, 0x3df47251fed318cb, 0xc5b3d7f21ed62839,
+    0xf91b47a32cd937a5, 0xf9c318565adc6713, 0x921f5d7658bd647f, 0xd1feb38a96c183eb, 0x7abe153dc6d4b259,
+    0x8917a45fe3d7b1c5, 0xbd98ce1fe1b9cf23, 0x1586b9e3219acd8f, 0xf5eb8ca32a7decfb, 0xc153bf265eb32d69,
+    0xf7d62e987ca63bd5, 0xb576d4898ac96b53, 0xe83ba42dc69b58af, 0xbce56a4dc5ae782d, 0x73bf4c61f4c1b689,
+    0xa758c9b214a3b6f5, 0xf93b617542b8d573, 0x81db3f465198d3cf, 0xae4cb5376e8bf24d, 0xfd4691587d8f12b9,
+    0x7682ea9dcdb45127, 0xa9143c8edba65f83, 0xd6b47cefe6875cdf, 0x9e3c5f82168a7c5d, 0x57ebd193246e7bc9,
+    0xd2a4e5176591cb37, 0x6fbc71287284d9a3, 0x4f2d8a5cb3a7e921, 0xacd4517bae59f67d, 0xed5723fcbd7c16e9,
+    0x93b25d8fec9f2657, 0xa8eb39721d9265c3, 0x39cde7f43ca78541, 0x2bf479354a68729d, 0x53217cb9867c921b,
+    0x24bfed6a935daf67, 0x3c49256ba471bed3, 0x19b438edc284ed51, 0x35a2eb1dce45fbad, 0x8271cef43f691c2b,
+    0x23b8cf143e5d2b97, 0xcbf493165b6e49f3, 0xe689573bac836971, 0x7cd845eba95476cd, 0xdfa9b65ed758964b,
+    0xb8251c4fe35ca4b7, 0x7e4a39d1f37ec425, 0x3c914ab54572e391, 0xdb845ec65264e1fd, 0x61b532c87f58216b,
+    0x514cbef76d492fc7, 0x72c69d8a9b6c4e35, 0xedb1af3cb94f5da1, 0x52ab184ed9537b1f, 0x8a2bf7c1f6348a7b,
+    0xfe3d8c121536a9e7, 0x9fe1d873243bc965, 0x251e3f97634ed7c1, 0x19fe86ca9251e63f, 0xf435218baf34159b,
+    0x39b81fadce483519, 0x2a85139fed2b4385, 0xa8476c91fa4c63e1, 0xe8d2a1632a3e715f, 0x79642f8548327fab,
+    0x95c8ebf76735ae29, 0xcadb61498427bd95, 0x51dae7c98439cbf1, 0xc5781d3a912cda6f, 0x982a5cfdcf3219db,
+    0xe384f6a1fe152a49, 0x72f5a6b32e1738b5, 0xdfbe27465d1b6823, 0x3a2671854a1c658f, 0xa5ec6f37681e74fb,
+    0x6f14985dc812b369, 0xa816befdc716b2d5, 0xe3c97b1fe629d153, 0xa619f53ed218ce9f, 0xbc283da5432bfe1d,
+    0x35afe6143cdf1e79, 0xb28d1ec76bf23ce5, 0x3578c4e98bf75c63, 0x62184ce768e759bf, 0x97523fcba6fb793d,
+    0xb86c57fdc4fe87a9, 0x8a6e592fe5f2c817, 0x13ed46b215f4d683, 0x679a135432e6c4df, 0xd4fc19e761e9f35d,
+    0x963aceb76fed13c9, 0xfb619d7a9cdf4237, 0x8d3ae67cbce461a3, 0x1c9835aba8b45def, 0x9bc6fe71f5c87e6d,
+    0x18fe5c3215ea7cd9, 0x54bce86325deac47, 0x5fe2cd6765e1dab3, 0x3fd7e8a984d5ea31, 0x95d6c7ba91c5f78d,
+    0xdab31ce98eca17f9, 0x684ad97cbecd2867, 0x84da932feabf46d3, 0x1afe8d932cd38651, 0xfc4ae19329c573ad,
+    0xacdb825657d8932b, 0x9db64f5765dcb197, 0xbead3468749cafe3, 0xa1dfe59ba4b2de61, 0xf5e4c96ba193fcbd,
+    0xcb35782fefa71d3b, 0x78f643c21fb92ca7, 0xbf9ae8543ead4b15, 0x9da47b154cbf5a81, 0x1a924bc659a267ed,
+    0xa1793ecba8c4975b, 0x986b23ced4b8a5c7, 0x64a27c1fe4abc635, 0x9bcdf641f39ed4a1, 0xc6b3e24545a2e31f,
+    0x93e8a2d763c5127b, 0xce1f83765fa831e7, 0x4b7321c87d9a3f45, 0x13ef5b987a8c5eb1, 0x29d6814ba98e6c2f,
+    0xc4bd9a5fe6927c8b, 0x3d4768afe5849af7, 0x74ef93c21498ca75, 0x6d28ae74347ac8d1, 0x52137ad6528cd74f,
+    0xacd71529839216ab, 0x71b34d6cbfa53629, 0x7b23a86dcea83495, 0xca7f821edc8a64f1, 0x246ca97fea8c726f,
+    0x56ac4b93296f71db, 0xe936fcb54872af39, 0x863ead943674bea5, 0x341b6dea9578cd13, 0xb5e163898259db7f,
+    0xc8147de9815cf9eb, 0x1cdb325edf712b59, 0xeb28c7a1fe7439c5, 0x368dacf21e786943, 0x5614d2b32c4a569f,
+    0xcb712d454a5c861d, 0xfe135dc7685fa479, 0x7c5da98ba872b3e5, 0x85bf916dc587d263, 0xc98e531dc357d1bf,
+    0x81b9a56dc159ef2d, 0xd32b6914325d1f89, 0x3af872454e613df5, 0x814eb6398e645d73, 0x6b92c1487b365acf,
+    0xc7b18f598b397a4d, 0x9268c45dc63d78b9, 0xa71dc84ed64fb927, 0xb846fdc1f652d793, 0xe35871621634c5ef,
+    0x7e41a2865238f46d, 0xc1d3eb68725b14d9, 0x7e26859a9f5e2347, 0x64589acbae5162b3, 0x7683acbdcd568231,
+    0x4e83f15dca256f7d, 0x57ab3f81f6287de9, 0x1bf9a4e2182cad57, 0x8b1dca95462fabc3, 0x2d57ba498753eb41,
+    0xfb7513c87324f89d, 0x53af412dc348291b, 0x34fe172cbf1c2987, 0xb327f1ecbc1d47e3, 0x285937c1fd328761,
+    0xd74b51832c1374bd, 0x1dce7f965c17943b, 0x3fea21965819b2a7, 0x3d71b68a983dc215, 0x2e7dc8fa952ecf71,
+    0xc7ebd24a9412fecd, 0x8f1a794ed3261e4b, 0x41c9387dcef62db7, 0x1f4b58c21efa4c25, 0x95f2d7a43cfd5b91,
+    0xc85ab26439ce58fd, 0xbe5c82465af2986b, 0xc458e63a98f4a6d7, 0x37d92e8cb6f9c745, 0xcb78216dc4fad5b1,
+    0xa149563cb3ecd42f, 0xcdf6a37545f2138b, 0x62cd41a761e532f7, 0x296ce4d76fe94175, 0xfd6253476bd95fc1,
+    0xca3f649879cb6d3f, 0xf52478a987cf6d9b, 0x9d1b657ed7e3ac19, 0xc39a6421f6e4cb85, 0xbe85dc7325d7c9e1,
+    0xa76d89e323cad85f, 0xe1afd9c542adf6cb, 0xf456a93ba4e12739, 0xf231598a9fd436a5, 0x135aebfcbed97613,
+    0xb138a69edbca637f, 0x985cdf61f8ac72eb, 0x1ba4c9f328cfa159, 0xb138e76437c2afb5, 0x5cad743657b6ce23,
+    0x2f8e9a5653a6dc8f, 0xefd943c76298eafb, 0x13c2789ba2be1c69, 0x32915b4dcfb13ad5, 0x586b4d91fec46a53,
+    0xb78d41321db657af, 0x8b2cfe343cba872d, 0x8ce5f9d437bda589, 0xa438fe57679ea4f5, 0x5416ca7ba8b2d473,
+    0x216d3f8ba495d2cf, 0xe53497fdc3a8f14d, 0x689cdb41f3ac21b9, 0xc3e46d2542ad3f17, 0x1e3a74254fa15e83,
+    0x93871fe54c835bdf, 0x239b48754c967b5d, 0xd9b127c65b687ac9, 0xc52aefbdc68dba37, 0xa653db8ed57fc8a3,
+    0x96b8a271f6a4e821, 0x47d1a8321394f57d, 0xb41d978543a815e9, 0xed624b5981ac2457, 0xa2e965487f8e54c3,
+    0x475d829cbea28341, 0xea71925cbc84719d, 0x6f24b1edca657ef9, 0x4daecf61f859ae67, 0x6a473f52176bacd3,
+    0x15d378a4367fdc51, 0x952f3b465462f9ad, 0x31cbd84a94861a2b, 0x2ea8945dc1682a97, 0xe8d42a6bae6b48f3,
+    0x6fa71c9dcd6e5871, 0xe5264bc1fb6175cd, 0x75adcfb21d73954b, 0xe61248b32c56a3b7, 0x26ba89c7697ac325,
+    0xc38d4e59876cd291, 0x91b54cd8734cbfed, 0x5f2ab47dc4731f5b, 0xf5b14d2ed1652ec7, 0xc43b657fef694d35,
+    0x7dcbe8132f4b5ca1, 0x21da5f743c4d6a1f, 0x4ade5f165d41897b, 0x3c8195f76b43a8e7, 0x6439dabcba37c865,
+    0x42db37acb749d6c1, 0x5c8a3e9dc64bd53f, 0xb9a845fed24ef39b, 0x784c9f2326753419, 0x92168f5a91674285,
+    0xb327f1d87f4962e1, 0xd4c7f3687c2a6e4f, 0xa67d13f8792d6eab, 0xa4f91e2dcb41ad29, 0x178ce42fe823bc95,
+    0x9ebd12afe736caf1, 0xda74e9321528d96f, 0x3fc68274342af7db, 0xd4ae6538753f1849, 0xa72d413ba14237b5,
+    0xd9fe73bcbf186723, 0xef918dbcbd19648f, 0x3869d24edc1a73fb, 0x946fd8e1fb1ea269, 0xadb928154a32b1d5,
+    0xfa4652176915cf43, 0xacf91d454615cd9f, 0xbd4e57f87528fc1d, 0xca274d6ba42c1d79, 0x15cd684ba31f2be5,
+    0x931c5fbdcef15b63, 0xa489f1bedce358bf, 0xce1b6d421cf6783d, 0xe5198f632cfb86a9, 0xb7d4c1e549fdb617,
+    0xabf4853767efc583, 0xc315db2986e2c3df, 0xf8d31c9ba4e6f25d, 0x7a86f43ed4f812c9, 0x38c9de1fe2fc4137,
+    0xb789ce1321ed4f93, 0xd68971543db15cef, 0xd76a18954be37c6d, 0x19b42fd54ae57bd9, 0x59c1be2768e9ab47,
+    0x427f8ba986edc9b3, 0xf245a8bcb6cfd931, 0x496d1a8fe4c2f68d, 0x7f64a5c324d516f9, 0xf2e37d6543ea2567,
+    0x93ab1dc871eb45d3, 0xed1b27c98fce7451, 0x718ced598ec172ad, 0x4d7182fbacd5912b, 0x6718943ed9c5af87,
+    0x4ea682c1f6b8ade3, 0xc69f2ab327abcd61, 0x8bfe5163248feabd, 0xc59dba6876d41c3b, 0xe37cd81983d52ba7,
+    0x491d2f6cb2d94a15, 0x82a9f54bafbc5981, 0xe7c14d9bab9c56ed, 0x289ae5f1fdc1965b, 0xcbd45a321db3a4c7,
+    0xd47126832ab8c435, 0xef31a72657b9d3a1, 0x5eb9f428769bd21f, 0x46f29c38738def6b, 0x53a4e1dcb4a32fd7,
+    0x1d5fc7aed1b73e45, 0xab463d2fef985db1, 0xa9cd48321e8a6b2f, 0xce5ad9232d7e6a8b, 0x9c6f84754c81a9f7,
+    0x5df1b6276ba3c975, 0x381e9c5ba896c7d1, 0xd654ab8cb589d64f, 0xb87d5a1ed37cf4ab, 0xa473e1bfe4af1529,
+    0xd6efcb1216b24395, 0x943bfe1652a763f1, 0xc2af81354e89716f, 0x4f3a86154d596fcb, 0x5cfe13687b6d8e39,
+    0x814cb23dc971bda5, 0xd8c7b14fe985dc13, 0xb512a96fe465da7f, 0x9e1f65c21457f8eb, 0x6ec1f284347d1a59,
+    0xe412afc7637f28c5, 0x3d84916cb1a26843, 0x75c413abae74659f, 0x352bd19cbe69851d, 0x3854ecdfed5ca379,
+    0x85fc49e1f96da2e5, 0xbef243c54b82d163, 0x27db48132753ceaf, 0xae3f28754756fe2d, 0xef235a18745a1e89,
+    0x821bf9da936b2cf5, 0xa7b369ecb16f4c73, 0x28be6a3cbe4259cf, 0x6afd4981fe35794d, 0x71a538e21e3687b9,
+    0xb9ad1e843d4cb827, 0xdfe4ca965a4ec693, 0x25a346c87851c4ef, 0x1e3782aba854f36d, 0x584327fdc65713d9,
+    0xe2d58bafe56b3247, 0x79a32ec1f26d51b3, 0x87b924a5435e6f21, 0x798bde654f326e7d, 0x539271465d247ce9,
+    0x6f34ae876d28ac57, 0x4e56c2a87829bac3, 0x9421b76cb83eda41, 0x891bceadc631f79d, 0x23b7d6a1f745281b,
+    0xc3a8b16215392687, 0x6a73fdb8752a46e3, 0x7bd8634a923d7561, 0x614fe2c87e1f63bd, 0xcf936aebae14923b,
+    0x6a1e7c5dcd25b1a7, 0xe57a98cdc917aef3, 0xc5f6db71f82ace71, 0x81e24593261aebcd, 0x43e981b768321d4b,
+    0x1dc8a5b986142cb7, 0x3184acfba6184b25, 0x4cf6798dc32b5a91, 0xf8c4a7598cea57fd, 0x7d9ce82bacfe876b,
+    0x469d8cefebf1a5d7, 0x9ba678f21bf3c645, 0x37e812f439f7d4b1, 0xce5fda3657e9d32f, 0x534adf1765ecf18b,
+    0x54ecf68a95de21f7, 0xd9b16f7cb4e23f65, 0x4adf92ecb2f65ec1, 0x2b7d43ecbed86c3f, 0x451dbaf21fea6c9b,
+    0x296aed743cde8b19, 0x49d631754be1ca85, 0xea5d426769d4c8e1, 0xb2614dfa98c6d75f, 0x3d2974ba94d8f5cb,
+    0xa8fce41dc5ed1639, 0xd7e45bcfe3df24a5, 0x4d8ac7f326e47513, 0x7fb3c24541d5627f, 0x7b98acd54fc871eb,
+    0x543f78e65dcb8f49, 0x46ecdf1768ad9eb5, 0xfed6854ba9b1cd23, 0xfa945e2dc6a3db8f, 0x61735daed4a5e9fb,
+    0xc1be865325da1b69, 0x25ae189434bc29d5, 0xa17bd54872cf4953, 0xa2db48c981c256af, 0xfb86539a9fb5862d,
+    0x7a8b342cbec7a489, 0x61a9f82edc9ba3f5, 0x2d7ef681f9aec273, 0xf96ec1743892d1cf, 0x74ceb1832794ef3d,
+    0xc2eb78d545b61fa9, 0x67345a8985ba3e17, 0x84f75dba92ac4d83, 0x9f51372a918e4adf, 0x369fae5dcf927a5d,
+    0xc4d53f21fea478c9, 0xe9af68321ea8b937, 0x54fceb832d8bc7a3, 0xb2197ac65a9ed721, 0x81dbc3976891f47d,
+    0x6f3e17acb7a514e9, 0xdacfb15ed6b92357, 0x58192a4fe49a52c3, 0xe943c561f3ad7241, 0x2a4c8563217e5f8d,
+    0x653ebd843e627df9, 0xbc25aed43e84ad67, 0xa587cf165c67abd3, 0xab1d27e9897adb51, 0x8be96d4a965ce8ad,
+    0xa89d241fe783192b, 0x35d2afb1f5a42897, 0xbe6749d2159847f3, 0x4d3caef5439b5671, 0xb19afde6517b64cd,
+    0xcad317287e6f834b, 0xe18754da9e63a2b7, 0xafde27bcbd87c125, 0x4f78591eda57cf81, 0x5c9287b1f648bced,
+    0xbf1e49a2174cfd5b, 0x8749cfa548612dc7, 0xbf149e7a97864c35, 0x5cd12b7a93675ba1, 0x6314f97cb25a691f,
+    0xa27ce8dbaf3d687b, 0x3425871cbc3f96e7, 0x53cbf2a1fd42c765, 0x8afe1b232b46d5c1, 0xb7fc2d932a58d43f,
+    0x8a4b1e36574af29b, 0x14d23faba86e2319, 0xe9764b3dc9724185, 0x2394ad1cb3645fd1, 0x982a5fcdc1376d4f,
+    0x1c784defef286dab, 0x14839ad21f3d8c29, 0x1f628ac43d2fab95, 0x4a5ec1d76b43c9f1, 0xc2d6f1987a24d86f,
+    0x5634c2ea9827f6db, 0xfa49c27ed83c1749, 0xdb134a8ed73e26b5, 0xc8d79fa1f8517623, 0x57c8df321524638f,
+    0x917ef826513672fb, 0xb3572ae65f2ba169, 0xc4e5d8276d1b9fc5, 0x1cfe7a398a1fbe43, 0x9145f36ba812dc9f,
+    0x3258ecfdc825fb1d, 0x85fc23a1f6281c79, 0x8b761d94371b2ae5, 0x2ec398d6571e4a63, 0x85e12ac9842157bf,
+    0xa1893efba214873d, 0x5b219f487ef485a9, 0x25791c4badf9b517, 0xa871fd9edafbc483, 0xf92745aba7ecb2df,
+    0x32fead9439e2f15d, 0xb24f136548f521c9, 0xbf32ed4656e83f27, 0x5312b9c875fa4e93, 0x75394c1872da4bef,
+    0x923c67ea91ef5b6d, 0x9d6ba75cbfe27ad9, 0xc2986751fde5ba47, 0x9b43a8f21de7c8b3, 0x3ca479d54aebd831,
+    0x1b3ae6c437bce58d, 0x32ba176878d215f9, 0x67289bacb9e52467, 0xf8167dbcb6e854d3, 0xd947352ed4eb7351,
+    0x7a5b8fe1f2ec61ad, 0xe35916f432ce7f1b, 0x6395d1b43fc2ae87, 0xae83d6954db5ace3, 0xf12b5d365ab8dc61,
+    0x32e18c5656a8e9bd, 0xe3fdcb4986adf93b, 0x32abc57fe6d129a7, 0xd76843e1f7d64915, 0x6e7a2f5324d95781,
+    0xf19a357432b965ed, 0xe9586af761cd845b, 0x57fe91c65eaf93c7, 0xefd7893a9eb4c235, 0x5481cefa9cb6d2a1,
+    0x39f28edba786befd, 0x5846ac1ed589fe6b, 0xda7518f3269c1ed7, 0xad4fe68768b13d45, 0xcd3926b876a45cb1,
+    0xebf6712983b76a2f, 0xdcfa765871ca698b, 0x39c7e5abae6c98f7, 0xa7136e9dcd9fb875, 0x72635de1fb93c6d1,
+    0xf5d684e21b96d54f, 0x9dfe15a32987f3ab, 0x8b34165768ac1429, 0xe3d475c987ae3295, 0x5fdab28cb7a362f1,
+    0xf296b1dcb2936e5f, 0xad1658bed1856ecb, 0x1bd538cfef6a8d39, 0x49b7f5321f6d9ca5, 0x3621cbe54d7fcb13,
+    0x3b7a28d54b62d97f, 0xcf8a2b365964f7eb, 0xc7b589fdcb7a1859, 0xf54b628ed68b27c5, 0x2bf64d5ed69e5743,
+    0x89a2c47fe381649f, 0x7db21e932395841d, 0xcf9b1d254186a279, 0x8f73b1954f69a1e5, 0xd2e75bc87d6cbf53,
+    0xf26a83c7684ebdaf, 0xce5987dba963fc2d, 0x64db87afea651d89, 0x4ec579bfe7682bf5, 0x3edf4a72186c4b73,
+    0x681a9b43235d48cf, 0x952cd84a9361784d, 0x19ac4e3ba15386b9, 0x4f53a9ebaf48b627, 0xb2ae381cbe4ac593,
+    0x56b72c8dc94ab3ef, 0x7f3429edc94fe26d, 0xc5269e143b6412d9, 0xe3254cf65b683147, 0xcb93e61767584fa3,
+    0x7516c8ea975b6e21, 0x71ed5c3a923e5c7d, 0xeb237fcdc2417be9, 0x6dab317edf23ab57, 0x2b6d37f1fe26b9c3,
+    0x46fb8ca32e3ad941, 0xf18725b43a2be69d, 0x95ca8246593ef61b, 0xad597cfbab432587, 0xfd914b5cb92745e3,
+    0xba287c6ed83a7461, 0x78bd19efe43a62bd, 0x2d5ef941f24e813b, 0x1d3798654231af97, 0x4f38a2165e14adf3,
+    0x1b9da4565e26cd71, 0xe458bd265917eacd, 0xa2b1cf78781cfa4b, 0xfe76b21dc82f1ab7, 0xd3e879bfe9134a25,
+    0xfa4d8321f7265891, 0xc478b1d3241856fd, 0x2843a975431c856b, 0x9d43e2c7621e94d7, 0xc2d7e6487defb345,
+    0xfe6a3b198cf4d3b1, 0x68bd7f4a9ae6d12f, 0x124f8a6ba8d6ef7b, 0x184fc7adc6da1fe7, 0x3f5bc9e218fd2e65,
+    0xf93a427547f25dc1, 0x41b9736875e46b3f, 0xef9d5b1872f56a9b, 0xb429ea1872fb8a19, 0xea5df1787fedb985,
+    0xfd6bc71a9acfb7e1, 0xb863c1afeac2d65f, 0xa8ed53b219d5f4cb, 0x731f42854bea1539, 0xcb6519d768ec23a5,
+    0xde3c65fa98de6413, 0x67e389cba5d2617f, 0x9dec54fa92c36fdb, 0x3e789cbdc1d68e49, 0xc98d614fefc89db5,
+    0xa31498d21fadbc23, 0xd65c87a32b9eca8f, 0x28f3d9b549a2e8fb, 0x7b3192c87bd51a69, 0xc5817fdba7c928d5,
+    0x6827153cb7dc4853, 0xba2f61cdc3bd45af, 0xef4a8c31f4c1852d, 0xdfa693c212d4a389, 0x61e3248541c7a2f5,
+    0xfdc8abe65fbac173, 0xf468b3a54c79aebf, 0x9f4a3c57698fce3d, 0x2c4af9bdc8b31ea9, 0x27645bcfe9b63d17,
+    0x58694ae1f6b94c83, 0xde5bc372158a49df, 0xc176bf8323ae695d, 0x541d3c7653b187c9, 0xb3e29d5a91c4b837,
+    0xa527f6d98f97c6a3, 0x64d2537cbe9ad621, 0xb2136e7dca8be37d, 0x9576e4cdc87df2e9, 0x1b346f721cb43257,
+    0x29e1f3a549a751c3, 0x9f42de8657a96f31, 0x1d6a4f87637a5e8d, 0xba46c5f9827d6cf9, 0x61bd9f4ed291ac67,
+    0x7598f1adcf74bad3, 0x738a9fb1fe87da51, 0x7a93b5421c58e7ad, 0x5fb8c2a43a6cf72b, 0xbad94e354b8f1697,
+    0x47a5ebf98a9246f3, 0xc5fa3b2dc9a86571, 0x142afd9cb47863cd, 0x87e6d9bfe37c824b, 0xa3b9ed61f26e91b7,
+    0xd436ab254382bf15, 0xf1b9c5a43f64ce81, 0x8a31fb943a45cbed, 0x46df1ae76a48fc5b, 0x786d41b9895d1bc7,
+    0x921c5aedc97f2b35, 0x6a1328dfe87359a1, 0xdae8147fe475681f, 0xd7b34a821349867b, 0xd6f1a394324b95e7,
+    0x81f5c7b9817eb465, 0xfb725ea98f62d4c1, 0xfc4239ba9c65d23f, 0x179cf6dbac46f19b, 0xe627b94fec6b3219,
+    0x6a47219fe94c2f75, 0xebdfc2a3285f4ed1, 0xb9dea6c438526c4f, 0x54eba9c875346cab, 0x389d7c6ba3478b29,
+    0x6e41fb59813cba95, 0x91e6b3fa9e3db8f1, 0x25e8b36cbc31d76f, 0x543897afea23f5db, 0xa416f8c32d381649,
+    0x694ec3276c3a24b5, 0x2ef41bc98a4d6523, 0xcb2f763a973e528f, 0xdc62a14ba64371fb, 0xb8c197edc3248f59,
+    0x5471baded1279ec5, 0xb286e97fef1abd43, 0x918cfb632e1dcb9f, 0x8cb2fed65c32fa1d, 0x6f924ec76d241b79,
+    0xab4c17298b1729e5, 0x13e98afdca1b4963, 0x19f2354ba71c46bf, 0xab4fe93dc51f763d, 0x67ad48e1f51284a9,
+    0x3db6c1f43526b417, 0x2a684ec76419c283, 0xe13d76c54ce8b1df, 0xbd87ce1659eacf4d, 0xe15b829657cdfeb9,
+    0xe5ad47bcbaf43e27, 0x963e218dc8f64d93, 0x73248c5dc5d74aef, 0x79cfba3214fb5a6d, 0x689b741323fe68d9,
+    0xadc36f4763f1b947, 0x518da37981f4c7b3, 0x7cbd9e5a9fe8d731, 0xebf927487bc9e48d, 0x2f9736cba8cbe3f9,
+    0xb1295a7feadf1367, 0xf3c4eb521ae452d3, 0xb42e93d54ae87251, 0x1eb2a57434c75f9d, 0xd42683b764da7e1b,
+    0xb5d29cf762ce9d87, 0xb76f1d5a92d1abe3, 0xfc826d5bafc4db61, 0x43da7281fca5e8bd, 0xe7f14b821dc9f83b,
+    0x5c932ae43bcd18a7, 0x4d12b3e76acf3815, 0x69e5dc8a9ad35681, 0xeb3df74a97b564ed, 0x398ab7fdc4d9835b,
+    0x2843a7bfe3db92c7, 0x68ce3fb1f2ceb135, 0xeb7691a543b2cf91, 0xfea854732e83bcfd, 0x3f8b69543c95fd6b,
+    0x4bed75265ba91cd7, 0xa87cfeb989ad2c45, 0x6e437afdc79f4ab1, 0xc326a7bed7b3692f, 0xe3c62b91f3c4678b,
+    0x3a49efd213b896f7, 0xdf351eb432acb675, 0x5a81f947629eb5d1, 0xf95ca3287e91d34f, 0x4d6f59387d84f2ab,
+    0xcf84753dcdb81329, 0x21d9754fecab3195, 0x1724b6ded78b4fe1, 0x96abfd32178e4d5f, 0x9ea8f35435826dcb,
+    0x856a193764a58c39, 0xc2ead16762879ba5, 0x51f943ea928bca13, 0x9578fc6a9e5dc87f, 0x83a42e6bac71f6eb,
+    0x648a5391fda41759, 0xafc5e9821d9826c5, 0x18d9e6232c9b5643, 0xb36c9745487c539f, 0x291c465a968f731d,
+    0x7c9158adc583a179, 0x4b79af8cb2749fd5, 0x64bf291ed178be53, 0xa4dc287ede48bcaf, 0xd17385421f5ceb2d,
+    0xd3a2b1454e621c89, 0x62fb45976c742af5, 0xd124653a9c684a73, 0xf1ec958ba85947cf, 0xf612da7cb85c674d,
+    0xdb6cf31ed34f75b9, 0x8dacf431f483b527, 0x97a6d4321276c493, 0x1db2e3c54157b2ef, 0x8324ca165f4ae16d,
+    0x7af289365a3befc9, 0x539214cbac612f37, 0x539b142dcb654ea3, 0x5dca786fea586d21, 0x4a5c3b71f6395b7d,
+    0x45adb762153c6ae9, 0x98ea7c53243f9a57, 0x3457a9b87452b8c3, 0x9764ac2ba256d841, 0x4126a8798f27e59d,
+    0x162c537a9d3af51b, 0xfc792b6edc3e1487, 0xb8fd3c51fb6154e3, 0xca1754632c457361, 0x9ed64285493761bd,
+    0x81ec7d5656397f2b, 0x34a2b6d7642c8e97, 0x827b56f9842e9cf3, 0x357298bcb243dc71, 0xf68e7dcbaf14e9cd,
+    0x18db3a2fed17f94b, 0x376a5d843e2c19b7, 0xa49123b76c1e3925, 0x3cfad1798c325791, 0x713e6859891365fd,
+    0x2b1683cdc917846b, 0x92af174dc51a93d7, 0x56bed32fe61db245, 0xa846c25fe43fc2b1, 0x21cea7465423ce1f,
+    0xd68fc2a32cd3fe7b, 0xd48b1a954bf61de7, 0xed5f34c87bfa2d65, 0x936b2fd878fd4bc1, 0x2d8ec73a97de5a3f,
+    0xfc9a268ed5f2689b, 0xe417689fe4f5a819, 0xcdf34e9213f9b785, 0x68b24d1543fab6e1, 0x63f4bd9761edc45f,
+    0x15b3ac476ed1f3cb, 0x947f53abade61439, 0xbf57439cbce832a5, 0x4783a65edaeb6213, 0x3d721f5ed7cb4e6f,
+    0xc1bfa67216af5edb, 0x8cd9157436e28d49, 0x53b6f89763e49cb5, 0x739db65874e8cb23, 0x3d89b1a761dac98f,
+    0xc315d2476e9cd7fb, 0xe7a6cf1dced21869, 0xc3ae65f1fbc427d5, 0xa7e985b21cd94753, 0x8e75b16328c954af,
+    0x259cfdb658bc742d, 0xda8135f765cf7289, 0xd8bc362a96c3a1f5, 0x4c975f3ba2c5bf63, 0xf361ae8dc196adbf,
+    0x3175d69cbf89ec3d, 0x67a951d21e7dfca9, 0xdb5123a65eb23c17, 0x4eba5c376dc54b83, 0xcd27f93659a648df,
+    0x49f2678a97ba685d, 0x149fe82cb4ad76c9, 0x4295d31ed4bfa637, 0xb86d3e91f4b2c5a3, 0x8f1b6c7434b7d521,
+    0x1da9f4c541a8e27d, 0x7f3cbad54d7af1e9, 0x4871e3a98dae2157, 0x241d38f98c914fb3, 0x417bfa9dcba56e31,
+    0xd6235b8fe7965c8d, 0x2aebc51fe4786bf9, 0xd958f6b2148d9b67, 0x9b286fe3247fa9d3, 0x4f2b1ce874a3d951,
+    0x67acbd387184e6ad, 0xfce9b32a9e78f62b, 0x4a7b5dfcbe8c1597, 0x32e4fc7dcb8d25f3, 0x34ca2651fca26471,
+    0xf418a6721a8462cd, 0x82fdaec43a97814b, 0x1ef857b434598fa7, 0xd8b7f329847cae15, 0xfb54e36a936fbd81,
+    0x59f426ea9162caed, 0xbc2f617dce64fa5b, 0xdc4ab391fe581ac7, 0x5fc94e621e7c2a35, 0x269f1ac43c6e48a1,
+    0x1a83d4c65b82671f, 0xcb32f97a9a63857b, 0x6b895fecb85694e7, 0x43f59c2ed47ab365, 0x38c759afe46db3c1,
+    0x8ba329ded26ec13f, 0xdc8bef943152ef8b, 0x27ca9b543d451ef7, 0xadb28f376d492e75, 0xc2faed987b5a4cd1,
+    0x32b6fe19893d5b4f, 0xd27869ced84169ab, 0xad9b68efe7548a29, 0x7bd9c241f436b895, 0xbf5d8e432549b7f1,
+    0x86abfec5423bc56f, 0xae6d3917613fe4db, 0xa564728baf631549, 0x6c21ed5bae4723b5, 0x3e79f14dcd5a6423,
+    0x734ab12eda3b518f, 0xc19a325ed72c5feb, 0x7f1ce9832a318e59, 0x8d37e69547239dc5, 0xce2317498627bc43,
+    0x5fbe2c176327ca9f, 0x32b4a179823be91d, 0xa591fdcbad1ef879, 0x5f9c641dcd1328e5, 0x32ab97c1fd174863,
+    0x2d7e48c32c1845bf, 0x73fd6ca54a1b753d, 0xd9a43c26581e73a9, 0x12f89c7ba942b317, 0xf869da2cb725c183,
+    0xe13bc96a9315aecf, 0x27f93b5cb218ce4d, 0x3712fa4bace8fdb9, 0x21ab9d343cfe1d27, 0x958baf365df14c93,
+    0x3972f4565ad349ef, 0x7ae96b354af7596d, 0x5fb4812985fa67d9, 0xaebd6f3cb5fda847, 0x95a3e1cdc4efa6b3,
+    0xda192c3fe5f4d631, 0x4c6f59d212f5e38d, 0x3bdf81c541d7e2f9, 0x8aecd7b65fec1267, 0xe57213d87bce41d3,
+    0x6ed8cb2a9bd26f41, 0x9c34fadba8c35e9d, 0xca514ebdc8e67d1b, 0x6c37bd41f4ea9c87, 0x61c73be215dc9ae3,
+    0xa89fb6d434dfca61, 0xcaf5912653c2e7bd, 0x41bef2c981d5f73b, 0x61274b598fd916a7, 0x14a9285baedc3715,
+    0x9318ab6edbce4581, 0xfd4ca821f9b163ed, 0x5ecb3fa21ad4825b, 0xebd9c73438d691c7, 0xbef8461546c9af25,
+    0x816dae9764acbe91, 0x31e54fc7628eabfd, 0x5fb23dea91a2fc6b, 0xe158973dcfa51bd7, 0x9a467fd1fec92b45,
+    0xc75a9e432eac49b1, 0x978e5d243bad582f, 0x8de794b54ac1768b, 0x2b9c1ed768b395f7, 0x87aef16ba6c8b475,
+    0x45ea862dc5a9b4d1, 0xf9d57a3ed39bc24f, 0xd23ba87ed28fe1ab, 0xa1863ef764c53129, 0x69ed3ac43ea62f85,
+    0xbe18a9d65c984de1, 0xfab682376b8a4c5f, 0x18a32467687e5acb, 0xf98b5d7ed7a18b39, 0x68392e1fe683b9a5,
+    0x9385fed1f5a7c913, 0xb1485c721389c67f, 0x65e72bc4327ad5eb, 0xdc29e457618ef459, 0xac3b78e98f9324c5,
+    0xbe5a48fcbea86543, 0x2896ae3cbc78529f, 0x275eb4cfea8b721d, 0xa38c419fe85d7f69, 0x617b84f328719ed5,
+    0xb7a841232784bd53, 0xfac832654365cbaf, 0x7f6d9a487368ea2d, 0xeac621d8715cfa89, 0x86593febad6e19f5,
+    0xdb1a458ede824973, 0xe2d85cbfeb7546cf, 0x6a4981521c59764d, 0x2b5ca4932a5c74b9, 0xef4591a6596ea427,
+    0xcd13486ba871c293, 0xc3ed592a9564b1ef, 0x3a71824ba246cf5d, 0x79fe261cb147fec9, 0x6cd35f2edf5c1e37,
+    0x195bcef21e5f2da3, 0xd4853ab65e746c21, 0xfadc94276c345a7d, 0x45c9bd765b3768e9, 0x652b471cb83ca957,
+    0xa8475b3cb64ea7c3, 0x7ecda34fe862d741, 0x9d23ac51f253e49d, 0x94bdc6232357f41b, 0x8de52647625b1387,
+    0xf76d53987f5c42e3, 0xc1f9de7a9d4f5261, 0xaf426de98b325fad, 0x9ce3856dca357e2b, 0x21735d6fea268d97,
+    0x73dca65fe62a9bf3, 0x526b1c43263ecb71, 0xa8d136b54531e8cd, 0xa73d5b487523f84b, 0x86ec724ba23618b7,
+    0x283df71baf1b3825, 0xb64d28acbe2d4691, 0x2e71354cba1e54fd, 0xf26c7481fc12836b, 0x3c26dbf43b1592d7,
+    0x2d49a3e76a29b145, 0x741829c65629bfa1, 0x3d942578752cbd1f, 0xe634259a9421fd7b, 0xe2bf473cb3241ce7,
+    0x5481a3fcbef72c65, 0x5dca396fedf84ac1, 0xfb93a6421ceb593f, 0xf7a4bc132afe579b, 0x5739ce165bf2a719,
+    0x3bd4967879f3b685, 0xb7fed21a96f7b5e1, 0x87d2c1fba4e9c35f, 0x248e96da93fae2cb, 0xbae87c4dc2def139,
+    0x3e5f1bd762f431a5, 0x53879ad43dc64ef1, 0xae2d71843bc84d6f, 0x67afec8548e95cdb, 0xbe12df4768de7c49,
+    0xcf9274edc7e19ab5, 0x6972f4aed7e5ca23, 0x2ad97e8fe3d5c78f, 0xbd658c7213c8d6fb, 0x8ed5f37432dcf569,
+    0x2abc5d9872cf16d5, 0x4f9ed17a9fd24653, 0x168ba5d98dc653af, 0x6912df7babc9732d, 0xda4e73cfeadc7189,
+    0xb35d768ed6ac8fe5, 0xb4e6ad1328c1be63, 0x428efcd32593acbf, 0xf2417ac654a6eb3d, 0x758db4f652c7fba9,
+    0x3f8e65ca93cd2b17, 0x7e235c6a9ebf2a83, 0x7be68afcbca247df, 0xbde5f871fcb4675d, 0xac7396b21db875c9,
+    0x7bd6184329bca537, 0xad4fe8b6579eb4a3, 0xe6fb53ca98b3d421, 0x46f5d23a95a4e17d, 0xa159324ba285efd9,
+    0xac9361ded2ba1f47, 0xa1bd9f6edf8c2eb3, 0xc2e579432e9f5d31, 0x87f359a43e925b8d, 0x3ef9d5143c846af9,
+    0x28be4c654cb89a67, 0xc1b68d3a967ba8d3, 0xdf52796cb69ec851, 0xf295ac7dc481e5ad, 0x74269b1fe394f52b,
+    0xdb9a218323b81497, 0xd16a9f37619a24f3, 0xac149e376f9d5371, 0x3e564fa76b7f51cd, 0xe8d7412a9c827f3b,
+    0xb469ef2dcb648ea7, 0xc75689dfe978ad15, 0xbcd3f591f56abc81, 0x97c38fe2145cb9ed, 0xde29a6f43471f95b,
+    0x38e452b7638419c7, 0x167d24bcb1a82935, 0x5896412a9f6b47a1, 0xcad14e3bad7c561f, 0x21cab9dedc5f647b,
+    0x4926dfa1fb6293e7, 0x59e4bfc21c87b265, 0x8f7634b54968b2c1, 0xb9d4a8654659be2f, 0x51ba4d97634cde8b,
+    0xc2e1d4fba4621df7, 0xf326478dc1842d75, 0x386c7aedcf574bd1, 0xe3c4db7fed395a4f, 0x43dabc721e3d58ab,
+    0xdf67ec343c4f7829, 0xef84a5276c42b795, 0xe62543198945b6f1, 0xc3a156fba738c46f, 0x8d9e465ba549e3db,
+    0x491b25cdc35df249, 0x3cb9ef81f47132b5, 0x5fb49e2654876123, 0x921c6d543d264e7f, 0x4edc28a54c285deb,
+    0x85bc9f176b2c7d59, 0xa12be458792f8bc5, 0xb27a1d6ed952cb43, 0xf31a2b9ed624c89f, 0x4c9ed8a1f537e81d,
+    0xbe541ad2142bf679, 0xbf35ae87643d17e5, 0x689f12eba2514763, 0xb471dcf98e1354bf, 0x56d7e21bae18743d,
+    0xa87f542dcd1b72a9, 0x13587c2feb3da217, 0x74f8a51ed81eaf73, 0xac8e67543712adcf, 0xfe5239643715ec4d,
+    0xb39a17865416fcb9, 0x4f73d91a953b1c27, 0x5af2186ba41e2b93, 0x7bfa5c487bcd38ef, 0x7d4ef13cbcf2586d,
+    0x25d4e7afebf476d9, 0x9b1584321cf9a647, 0x215a4d8328fca5b3, 0xc1ab562768fec531, 0xd1c3b46876f1e28d,
+    0xdb46cf8985d4e1f9, 0x574c983dc4f92167, 0x2eab5fdcb1e92fc3, 0xb461a8ecbfdc5e41, 0x7a9fd8521ebf4c9d,
+    0x1d7b23f54de37c1b, 0xac5782b43ce49b87, 0xd8a794e658d7a9e3, 0x5bac324987ebc961, 0xf273d1b984aec6bd,
+    0xe96ab1cdc5d1f63b, 0x62ce48d1f3e415a7, 0x74862c1324e93615, 0xe5fb46c762eb5481, 0x24fcb1954fab52ed,
+    0xa35c91676dcf715b, 0x568c9de76ac28fb7, 0x69f2b8ecb9c6ae25, 0xa5362b8fe6c7bd91, 0x87d51a9fe498bafd,
+    0xdc9ef682149dea6b, 0xa367dfb545c21ad7, 0x84b735a983d62a45, 0x5cb94e1a92d748b1, 0x8a7462b98eba572f,
+    0xd962fe7a9ead658b, 0x76b91c8dcbae84f7, 0x8b47efd1fac2b375, 0x81eb9f5329a6b3d1, 0xa17dc6f437a8c14f,
+    0xa6d791c43478df9b, 0x892b5c17648cfe19, 0xf56ce1dba4b12e85, 0xe532761cb2a54ce1, 0x43f72a8dce974b5f,
+    0xcd52f891fe7859cb, 0xfe5746321e8d7a39, 0xcb816d732c7f98a5, 0xc91f6a876ba4c813, 0xfd6e32a76894c57f,
+    0xfedc976a9587d4eb, 0xabc93efdc48bf359, 0x9b25a47ed49e13c5, 0x7e25d831f5b16243, 0xa53296d432a4519f,
+    0xc5b8d4932d765efb, 0xad1b82e43d5a7e69, 0x3adceb254a6b8cd5, 0xe32a7d49897fac53, 0x2f3ea7dcb762c9af,
+    0xc6ba518dc675e92d, 0xab91268fe356f789, 0x6952b1c3247b18f5, 0x32759e86549e2873, 0xd79e32b8728145cf,
+    0xe957f26a9f83754d, 0xe23cf86bae5673b9, 0xf796543dcd6ba327, 0xc1b94d5fea6db193, 0xf97a65dcb64c9edf,
+    0x5e34cf821862ce5d, 0x47af58c32654fdc9, 0x4fce5a8985691d37, 0xebcad749846b2ca3, 0xd82c531ba37e5b21,
+    0xd813a59cbf41597d, 0x8c12965dcd4367e9, 0x8c75d3e1fd36a857, 0x7d4b1a921d49a6c3, 0xbf2ca8343a5dc641,
+    0xbf9d5326574fc39d, 0x7c3189da9864f31b, 0x32b58a7dc9561287, 0x7a92468dc56941e3, 0xc2a6d47ed26b4f51,
+    0x482615ecbf2c4ead, 0xbcd861e43f417d2b, 0x6b8e42c54e238c97, 0xea479bd65c269af3, 0x186b4e976b39ca71,
+    0xcfb2d419862ab7cd, 0x437a562ba62fe74b, 0xb517c36fe84316b7, 0x3b9cf5d1f6483725, 0xf8e29473263a4591,
+    0xab231e97612a53fd, 0xfa531d965f1e726b, 0xe5df46b98e3291d7, 0xfeb6c41a9c14af35, 0x9b7326adc926bea1,
+    0x53c1df7ed728bc1f, 0xce87f6d1f51aec7b, 0x7c1d8923251dfae7, 0x69275c1878132b65, 0x15d4f8a9852649c1,
+    0xf26ac3eba219583f, 0x74cb9da87efa569b, 0xcd26f14bacfd8619, 0x7ab59e8dcbefa485, 0xcf359d2ed9f3b4e1,
+    0xda8613c219e6c25f, 0xf6ed7b3436f7e1cb, 0xb146aed545daef29, 0xa3524db874ed1f95, 0xc4d7381a95e24df1,
+    0x8d96ef5ba1e34c6f, 0xb6dce25a9fe65adb, 0x932f6ce1fdea7b49, 0xa36c4e721ced89b5, 0xaeb62d354adfb923,
+    0x47adbfc549d2c68f, 0xf12ed98767c4d5fb, 0x5f2e9a1ba5d8f469, 0x456c712ba6eb14d5, 0xcfa91e4dc6de2453,
+    0x95a231cfe3d152af, 0x8b49a7d543e5712d, 0x8761cd432ec56f79, 0x59bca2143cb98de5, 0x4dae18f659bcad63,
+    0xa734d296568e9abf, 0x9c5f614a97b2ea3d, 0xd4f35caed5c4f8a9, 0xdb8c3fe1f5d92a17, 0x8b19d3a215dc2983,
+    0xcb7fd24542ac36df, 0x8ec32da982c1765d, 0xe61583276fb374c9, 0x8d4ef63a9ec8a437, 0xef14c5a98dc9b2a3,
+    0x3cb5496fe9adc321, 0x1459ae7dc58ebf6d, 0x684d1c921682fed9, 0x3ba87f2438b61e47, 0x6e35c41765a82db3,
+    0x8a4bd6f984ab5c31, 0x9ce12df8719e4a8d, 0xad46182cbea168f9, 0x416b359edeb3a967, 0xbe9fda61fc96a7d3,
+    0x582e94732d9ac751, 0x8ce6b413287bc4ad, 0xd4f389a6578fe42b, 0x17e38d6ba8b41397, 0x82d1549cb6a742f3,
+    0x12fa358ed4ba5271, 0xb45f6cadc1794fbd, 0x4e18625dcf7d6e3b, 0x21f59de32f618da7, 0xcb361ea43e84ac15,
+    0x3d2e84754d76cb81, 0x36fb4e154957b8ed, 0x9bd73c1a976ce85b, 0x71526d4ba45ef6c7, 0x173269afe7a42835,
+    0x8da57b61f39746a1, 0xf64715a32389651f, 0x14e867b5418c637b, 0xce624af54f5d82e7, 0x51fc89da9e82b165,
+    0x437abce98c64afb1, 0x3659a42ba956bd2f, 0x8ec936bdc647ed8b, 0x3fdb98aed54aebf7, 0x7ad8b253286f1c75,
+    0x3efd14b656734ad1, 0x5d3fb1698276594f, 0x9eb6c75a914857ab, 0x475fe9dbaf4c8729, 0xaf5834bcbd3ea695,
+    0xabc345dedc62b5f1, 0x746218dfea54c36f, 0xc6f1e4921946e2db, 0xa3b79524385af149, 0xd215e648786d21b5,
+    0x59bef43a976e4f13, 0x12635c8ba3524d7f, 0xc83fd41ba1345ceb, 0x914cfbdedf287c59, 0xfab749c1fe2b8ac5,
+    0x84adc9e21d2eba43, 0x4b1ac6f54b31c79f, 0xe2385d176a34e71d, 0x3421dc898a26f579, 0x9d1485acb83a16e5,
+    0xb98fae1dc84d2563, 0x687cae3dc52e43bf, 0xd73852e1f154723d, 0x3ab14725423571a9, 0x85fa72643d178ef5,
+    0xc721a8365d1bae73, 0x5942dec6581d9bcf, 0x6aef2d798921eb4d, 0x65cbe23dc713fab9, 0x341db69fe9381b27,
+    0xdf872ac1f61b2a93, 0x1629ebc3251b37ef, 0xf4827da6531f476d, 0x5cad4e79831275d9, 0xeab584398ef3a547,
+    0x6f4da7198df7a4b3, 0x1482d75a9bfac431, 0x2f564ceba7fbc18d, 0x178c359ba5bdcfe9, 0x587fa64329e31f57,
+    0xc38db61547f62ec3, 0xa63d2b1876f95d41, 0xd2ac1b8762fa4b9d, 0xa42c571982fe6a1b, 0x42f587acbfe19a87,
+    0x67825fecbcd4a8e3, 0xa2c3fb41fbe7c861, 0x68e31da219e8c5bd, 0x52b4f18328dce53b, 0x214b9dc546cef3a7,
+    0x1dec829ba9e63415, 0x97528a4cb6e75381, 0x3e7f8c2ba3c851ed, 0x69fe358dc1da6f4b, 0xfae189cdcfad6eb7,
+    0x17c9f8b43fc1ad25, 0x3b7cd2a43ed4bc91, 0xc682fa5438a5b9fd, 0xd7a68ce547c8e96b, 0xad16843765abf8d7,
+    0x2b54186cb7cf1945, 0x3da562cfe6d347b1, 0xa3c1948fe3c7562f, 0x9cea1b3212d9648b, 0x6c4937a541cb83f7,
+    0xb19cf3a54fbea275, 0xfb1536e87ea3b2d1, 0xe4d961787a94be3f, 0x1a8d73eba785de9b, 0xf2b1e83dc6a8fd19,
+    0xdc6f7981f6ac1d85, 0xf6d518e3269f3be1, 0xd527381436b24a5f, 0x1fe43d2762a458cb, 0xe2953d4761ca7839,
+    0x3f4cb1676f8c97a5, 0x38d5ef2bad9eb713, 0x42f8ac5edb91c47f, 0x39c7eb81f984d3eb, 0x9d64e8a21ba7f259,
+    0xec932d15489a12c5, 0x24cf59d878ad5143, 0x9cefa647647d3e8f, 0x9b84e13a93825dfb, 0xcfb5e62dc1a47d69,
+    0x673b5afdcf678bd5, 0xd3ca6521fe7cab53, 0x4ac8e5921c5db8af, 0x14f732d54b71e82d, 0xea2f71354b73f689,
+    0xc53ad1676a9817f5, 0x85a6c43dc89b2673, 0x8a37cd9ba57b34cf, 0x85f42a6dc28f634d, 0xa67c9351f18372b9,
+    0xe91c2d654396a127, 0xced271f32e57af83, 0x58e916a43b489cdf, 0x4acf6597694ebc5d, 0xf2cd4be87851fbc9,
+    0xcf597a2eda851c37, 0x9b58ae7fe8672ba3, 0x9b32f841f67b5a21, 0x3e9d14a2135c487d, 0x3c5a8db4324f56e9,
+    0xc3b482ea9182a657, 0xae74b5f98f46a5c3, 0x152ca86bae69c541, 0xd3285f498b4ac29d, 0x269317bdc95de21b,
+    0x7dec96b1fb632187, 0x53bc1ed219652fd3, 0xc653a89439684e51, 0x36defcb765384cad, 0x5de473c9834d6c2b,
+    0x543a62eba13f6b97, 0x8a96173cbe42a9f3, 0xa7bd654ede35c971, 0xe93a8dc1fa27b6cd, 0x9d4bfca21c2ae64b,
+    0x1e5b7f64392df4b7, 0xc5d3b74a9b713625, 0x7a8f925cba365491, 0xae9d63fba63752fd, 0x3b74698ed43a716b,
+    0xc368af2ed12b6fc7, 0x5c84ea9dcd1f9e35, 0x78ba1ed54f23bda1, 0xce8a4f654d25cb1f, 0x7c8613454c16ea7b,
+    0xfec9d176581af9e7, 0x156f932cb92e1a65, 0xa763d41ed93248c1, 0xa73f58ded814573f, 0x8aefc621f317659b,
+    0xf3e8c594342b8519, 0x15e82b97621da385, 0xed421a765cfda3e1, 0xcf1ed9287be2c15f, 0xf59e8c4768e3dfab,
+    0x8dc2713ba8d6fe29, 0xcf47698dc7fa1e95, 0x3674cfaed6eb3cf1, 0xeb5937a215de3b6f, 0x5c82e3b434f259db,
+    0x3bcd2ef762f57a49, 0x2da681f761f798b5, 0x7dce39b87fecb823, 0xcbdf64587acdb58f, 0x153cf62ba9c1d4fb,
+    0x4b257d3fead4f369, 0x15c8bea32ae813d5, 0x6fa34cb769eb4253, 0x35a497d656dc41af, 0xadc254f874be5f1d,
+    0x5368d14ba3d26e79, 0xf1ca73eba1d48ce5, 0x8f43a2dcbfd8ac63, 0x12738abfedc8a9bf, 0xdb7f6e921baec93d,
+    0x8e7cafd43bc1f7a9, 0xa6ce12576bd52917, 0x2af8d1676ad92783, 0x318c4b7986b935df, 0x17d695aba3bc645d,
+    0xb8d495aed2bf63c9, 0xe5a3b2f1f1d4a237, 0xb8da4ec542d6b1a3, 0xef7958232c869def, 0xe9f572643c89be6d,
+    0x21a6bde5487becd9, 0x34689cea9ab21d47, 0x5fa124ded8a52cb3, 0xb3a512efe7c85b31, 0x9738cb21f3ba498d,
+    0xd8f5a73213ac57f9, 0x2fbec68432bf9867, 0xa92dbf4871b2a6d3, 0xe8643d198fa7c651, 0xcf85ea976e87c3ad,
+    0x294c3eda9c8ae32b, 0x8ac2f96dca8df197, 0x2bd9e53fe9a241f3, 0x1546e8a329a54f61, 0x52fab7e325864ebd,
+    0x25ba7f1654896d3b, 0x9cd5b176528d6ca7, 0xf2a1dc8ba28f9b15, 0x1628597cbf73ca81, 0x5e31cdabac64b7ed,
+    0xc8a2d761fc68e75b, 0x7914c6b21b6af5c7, 0x1d2ca6754b9e1735, 0x613a7e587b9245a1, 0xa846e37ba895641f,
+    0x36f54b2dc498627b, 0x452f8b6dc36a81e7, 0x279f38ded17c9f45, 0x1f87625dcd5f9eb1, 0xef134ba21e63bc2f,
+    0x96ae5f432d54ec8b, 0x3265bd943b46eaf7, 0x7be2fa698a6c1b75, 0x36982dfba86e39d1, 0x46c5a79dc971584f,
+    0x94a75d2fe47356ab, 0xd29f85b1f3578629, 0x6e7a9182126ba495, 0xdce19876526ca4f1, 0xf8253ae65d4eb26f,
+    0x2e197a687c53e1db, 0x4b56f8c98b45ef39, 0x49f135adcb481fa5, 0x9d58c6bed96b4e13, 0x47c986bfe64d3c7f,
+    0xb5f982a327415aeb, 0x12f895e326437b59, 0xc7a93128723689c5, 0x47efc859815ab943, 0xda6249387e2cb69f,
+    0x24edb98a9b3fc61d, 0x538cad9edc32f479, 0x57eb6da1fb3714e5, 0x56f91ac21c5a2463, 0xfe48c1d6583a42bf,
+    0xa1679cb8784e613d, 0x4816c9fba5316f89, 0xd34fa1cba4238df5, 0xe2b47a3dc126ad73, 0xfedb8a1cbe179acf,
+    0xf4a53eb1fe1bca4d, 0xd578f1b32c1fe8b9, 0xd34f9a876d341a27, 0xd7ec93587c162893, 0xdc26a498791836ef,
+    0x8694a52ba81b456d, 0xa17f24ecb51e64d9, 0x81abc94fe621a347, 0x4ad257b1f415a2b3, 0xa3dce2f76548c231,
+    0xcb21a4d32ce6bf7d, 0xc9e58b143af8cde9, 0x9fa862b549ecfd57, 0x14cb358989f12dc3, 0x74a523fcb9f65c41,
+    0x4839fe2dc5f64a9d, 0x679d821fe4fa691b, 0x84e69d5213fd6987, 0xbfe943c542df97e3, 0x83e76c4982f3c761,
+    0xe486cba76fe5c4bd, 0x32a564b87cd8e43b, 0x8eb263a989dbf2a7, 0xa1963e2dcade2315, 0x874ce6b1fae35281,
+    0xd3746e9217b34fcd, 0x849b216325d76e4b, 0x2de319c543e96db7, 0x43c9e67873ed9c25, 0xe75d24a872dfab91,
+    0xcb7459687ea2b8fd, 0xe834d52badc4e86b, 0x65d8249feab8f6d7, 0x8f6d9e732bdc1845, 0x9d84cfa549ce36b1,
+    0x5413fbe879c1652f, 0x46187fca97d4638b, 0xe3a461cba4c682f7, 0xfc8b12edc3dba175, 0x436985ded2ab9fc1,
+    0xb7145e8cbc8ead3f, 0x8ed94b321f82ed9b, 0xd32bfe743da5fc19, 0x78396c454db91c85, 0x13968b27689b3ae1,
+    0x473fb5e987ad395f, 0x86a4cb3ed6a157cb, 0xa67ec83fe5c48739, 0xd8b46e71f2c796a5, 0x9e48bc2324cab613,
+    0x47813ad5419cb37f, 0x41d9ce654d7fc2eb, 0x4b2561387da3f159, 0x6c23defa9da721c5, 0xfba4967dcba94f23,
+    0x8794c1adc67a3d8f, 0x7d19eb6fe57d4cfb, 0x5d48fba325a17c69, 0xaf86ebc324938ad5, 0xf432c5e76297ba53,
+    0x98bec3765168b7af, 0xed762ba98f6bc72d, 0x73c4582bac6fe589, 0xf321d9bedc9316f5, 0xd6e28f51fca82573,
+    0xf483c6a21a7843cf, 0xf51ca8e4398b624d, 0x36f4a815457e61b9, 0x758fdceba5829f17, 0xfe53d1acb274ae83,
+    0x71a64deba1659bdf, 0xd852c97baf48cb5d, 0x9854bda1fd4beac9, 0xcb3a8d921c5efa37, 0x814ed3f65d7429a3,
+    0xf8943bd76c875921, 0x7e6f54a98a59467d, 0xfc43a98ba74b65e9, 0xe73acb6dc36e9457, 0xe57923cfe571a4c3,
+    0x569c3db1f286c341, 0xcb7368143256c19d, 0x78fd5be32d37cef9, 0xca2e74154c3bfe67, 0x5694fed87a5f1ed3,
+    0x5d423f7bab734d51, 0x63528bedc8354bad, 0x831e296fe7486a2b, 0x8249ac31f43c6a97, 0x8cf7e192154d98f3,
+    0xb4cda8f76452c871, 0xb4165c287143b5cd, 0x67b125d98f27e54b, 0x35c7e2b98d29f3b7, 0x27ab3f5cbc6d1425,
+    0x48b7fd9edb5f4391, 0x625831afe94351fd, 0xa4d6589219246f5b, 0x98dfe67435286ec7, 0x71b5acd8762b9d35,
+    0x491cdf38743e9ca1, 0xecbf42da9342ca1f, 0xd8e9f32baf13e97b, 0x742afd3cbc15f8e7, 0xa36957b1fd2b1965,
+    0xf46e3ba54b2d37c1, 0xeafbdc565a1e463f, 0x152fc3e87a12649b, 0xa3519efcba268419, 0x5694831dc619a285,
+    0xa2f9c63dc53ba2e1, 0xe137bf6cb21cae4f, 0xb347ecf989dfceab, 0x9d54e7f21ce3fd29, 0x6d8129343cf61d95,
+    0x9d81c5365ae83bf1, 0xac2571e658eb3a6f, 0xe371269876fe48db, 0xa735c4edc6f17849, 0x5ad641bed4f397b5,
+    0x9b41d53fe4f8b723, 0x15bc47e212e9b48f, 0x8e2cb96541eac3fb, 0xd17bc4654dcfe269, 0xbaf24e598ce412d5,
+    0x95821d6bace84153, 0xe6d31a9ba8c73e9f, 0xaf2e451cb7ca5e1d, 0x526cd7a1f4ce5d79, 0xae64b59326d18be5,
+    0x6be5da8325e4ab63, 0x62ef3c1542d5a8bf, 0xd65f89b761e9c83d, 0xd9fab1365fbce6a9, 0xcdf4e67a9cbef617,
+    0x2cd341bfecd42683, 0xeba867cfe9b634df, 0x937cdf521ac9635d, 0xdeb5271437db62c9, 0xcfab2d4656ce9137,
+    0xe29a7b6875c1af93, 0xf3c416a872a39cef, 0x85192f6a91a5bc6d, 0x76d132cbaf87ebd9, 0x162e8acfed9cfb47,
+    0x8c1a42e32d9f1ab3, 0xe32f8b476dc45a31, 0x1b9c25e43ab5478d, 0x4dfae86547b856f9, 0x81c62a5ba4bc9567,
+    0x9f46b17cb4ae95d3, 0x3ed81b5fe6b2c451, 0xcb89f7a1f194c2ad, 0xa143fe8543a7e12b, 0x4c529df32d69ef87,
+    0x81b7e3265c8b1fe3, 0x1bfc34787b9f3e61, 0x97bf46c879824cbd, 0x5971b64ed8956c3b, 0x31c5d4efe4986ba7,
+    0xae6b9341f48c9a15, 0x567f1493247eb981, 0x9e2f67d54381b6ed, 0x7319bc587193e65b, 0xea259b765e86f4c7,
+    0x7a4dce9bae9b1635, 0xf1be2dacbc8d34a1, 0xaf4ec98dca8e531f, 0x86e935a1fa93617b, 0x6ab8ec1219846fd7,
+    0x9e65da7326789e45, 0xbea542c6546a9db1, 0x461297b8736dab2f, 0x23dbf7ea9261ea8b, 0x819f3a4bad53e9f7,
+    0xcb98f23ede681a75, 0x9f6ad871fc6a38d1, 0x39d8e5121b6c374f, 0x4be75613296f45ab, 0xe13fd6c76b738529,
+    0x4f726eacb876a395, 0x51b8e26cb568a3f1, 0x384e72bdc35ab16f, 0x38c5fbea914dafcb, 0x5b93f74dcd51fe39,
+    0xfd496a132f641ea5, 0x32ead1b65e684d13, 0x92ae1f765c493b7f, 0x1de63af7683c49eb, 0x32fe817cb83f6a59,
+    0xf41a3c5ed74298c5, 0xdbca649fe756b843, 0xce4b367fe237b59f, 0x71bfea23234ac51d, 0x384951c6514de379,
+    0x74e1cd898f6213e5, 0xe1f9a43bae574263, 0x96d7f3ea9c3741bf, 0x7613f4bcba395f2d, 0xcb3d15aed72c5e89,
+    0x28a1bdced62e7cf5, 0x7c891de21842ac73, 0xf287cb343524a9cf, 0xd1a394b76327c94d, 0xb6c419a7612ae7b9,
+    0xe7d3bc6a9e1df827, 0xc928fe5dce412793, 0x7a9286bdcb1435ef, 0x6e5a2391fb18546d, 0xc918b4a32b1a63d9,
+    0x1ab4f2365a1d9247, 0xf81cabe7672f91b3, 0x8cbde6fa9734bf21, 0xe5f869da9314be7d, 0xc49fd57ba216dce9,
+    0x4da61f8bade9fc57, 0x629c387feafd1bc3, 0xde5948232cef3b41, 0xdb7e3ac43bf2489d, 0xc2637fb54af5681b,
+    0x248fec1545fa9687, 0xdab865e985fb96e3, 0x147c93eba4feb561, 0x387ef95ba4f1c3bd, 0x53dfba8ed1f5e23b,
+    0x78ef3d9432e6f1a7, 0x9d5ca8676feb3215, 0x57a24ce65bdc3f71, 0x39742cb658af3ecd, 0x764ae31989e26d4b,
+    0x2f86397ba8e46cb7, 0x2fda57ced6e89b25, 0x5ca47eb1f4ecba91, 0x4ed19b8213bca7fd, 0x923e8d1543d1e76b,
+    0x8c512bf761c3f5d7, 0x83fae2c98fd91745, 0xf6147be98eda35b1, 0x3f9164ea9abc542f, 0x28c753ded9cf528b,
+    0x35e47bcfe9c381f7, 0x9aec137218c49f65, 0xf2319b5435b79ec1, 0x479ca52654b9ac3f, 0xe8a1c426528edc9b,
+    0xadf72e3983c2fb19, 0x89e361cbafc41b85, 0x9f81b24dcdb739e1, 0x391b854fecba385f, 0xfb1cad721a9d46cb,
+    0xd5a14e932abf7639, 0x6cbe14f768c294a5, 0x725619fa98c7b513, 0x32f674ca94a8b27f, 0x92e34a5ba389c1eb,
+    0xbf47358cb18cdf49, 0xabc4d7fede921fb5, 0x34bf68a21fa64e23, 0x59b278d32d963c8f, 0x978bc3543c784afb,
+    0x84f3d7b54a8d5b69, 0xe258ac9ba68f79d5, 0x82cf4d9ed7a2b953, 0x54fbc1aed384b6af, 0x7e32fa91f398c62d,
+    0x4f618d72127be489, 0xda7cb945418ce3f5, 0xa34621b98fa12473, 0xed34b2587d8542cf, 0x965d3aebac98614d,
+    0xf892a16dcb685fa9, 0x946ad5bed96c8e17, 0x58169cafe56f9d83, 0xa6cef3b215629adf, 0x281564a32374ca5d,
+    0x684afc154256e8c9, 0x68d4c579816bf937, 0x63e28f9a9f6e18a3, 0x3a2c86edce935821, 0x426d9cbfec83457d,
+    0xca4b9361fb5764e9, 0x5e8f43a21c6b9357, 0x3dc6e285486d92c3, 0x83c69f47687fb241, 0x9bd32e487452bf8d,
+    0xc3758ef98254cdf9, 0x8bf2791cb148fd67, 0x46e21b8cbf5a1cd3, 0x6ce9ab41fd6e3c51, 0x17f6ad432e5149ad,
+    0x7153ce243d54692b, 0x8a1496b54c356897, 0xfb4dec97684a97f3, 0x21356eaba84db671, 0x179f548a953fa4cd,
+    0x684bf3aed562e34b, 0xad9254efe145f2b7, 0x8e1abc97647a1325, 0xf162e5376f5c4291, 0x32718ed65a2b3fed,
+    0x1857e4a98c316e5b, 0x8f2de57a9a236dc7, 0x5cd31b4eda279c35, 0xcb879eafe6389ba1, 0x6843b1cfe53cb91f,
+    0x18ac9e52142fd87b, 0x251d7b965432f6e7, 0x81a9e4fba2371865, 0x63a58df98f2936c1, 0xe8724dca9d1b453f,
+    0xe8a7d26bac1e539b, 0xcb36a27fec428319, 0xd54be321fb24a185, 0x63b2597438269fd1, 0xcf8769243618ad4f,
+    0x5a71ec265419cdab, 0x79bf3618741fec29, 0xf481795cb4231c95, 0x73ce952a9de53af1, 0x7b3f89ecbce7396f,
+    0xc36d572feaf947db, 0x6de8a3b21bfd6749, 0x5d69c17329ef86b5, 0x9df231c879f4b623, 0xdce6a71876e5b38f,
+    0x37c8b5e984e7c2fb, 0x673d512ba3fbe169, 0x3e29816a91dbefc5, 0x758913fdced12f43, 0xc5af19621ec43d9f,
+    0x8baf35643be75c1d, 0x9c1dbe243bea5c79, 0xe21cfa4548dc7ae5, 0x6e175cb987df9a63, 0x7fc3861a95d2a7bf,
+    0x574bf28cb4e5c73d, 0x4536ea91f2d7e5a9, 0x7164eb9323dbf517, 0x986b1e4762de1583, 0xe42619576eb143df,
+    0xb4e3fca98ec4625d, 0xa14fd8398bd761c9, 0x374e82fcb9ca8f27, 0x32b9f1ced6bc8e93, 0xf854c27dc49d8bef,
+    0xf5e174b215a2cb6d, 0x762cf95323b4ead9, 0x3ae5d24652c8fa47, 0x7b543ca872dc19b3, 0x67f832198fbe4931,
+    0x2f518d3baeb1468d, 0x9c7b856edcb365f9, 0xf5bde291fbc89467, 0x4ec7965218ba94d3, 0x17cbf3d548adb351,
+    0x8cdb9265458fb1ad, 0x46b1a2587593df1b, 0xfd47359a92a4fe87, 0x3afe2d4cb2a81de3, 0xc9f27b1dcf9b3d61,
+    0x4d65ec21fc7e3abd, 0x15bcd9432e916a3b, 0xa95f1dc32db369a7, 0x67cd19354cb7a915, 0x37f41b26569ab781,
+    0xaef5bc19847ba5ed, 0x6fcd328ba38fd45b, 0x52f7c9aed492f3c7, 0x48abf3d1f2b81435, 0xec8b531652b943a1,
+    0x169ed3454e8b521f, 0x9651db343c7d4f6b, 0x918dc5365b816ed7, 0xd1e849cbab839d45, 0x9af34c5ed8769cb1,
+    0x4f8b769ed568ba2f, 0xd6c472a1f35cd98b, 0xb17def92135ed8f7, 0x4cde635764a31975, 0x7d35a419829637d1,
+    0x3e4f12898e79364f, 0x4fea76298e6c54ab, 0x89e4afbcbc6e7429, 0xc27361bfec71a295, 0x9264b5cfe975a2f1,
+    0xfc347d121846ae5f, 0xe5fd18c32547aecb, 0xfeb2c837645bed39, 0x6392e148724efca5, 0xf94be16cb2854c13,
+    0xeb3d897cbe453a7f, 0xeb76f1adcd3748eb, 0xbc83f6a1fd3c6859, 0x7f9856e21b3e87c5, 0x9a218b565c61b743,
+    0xd91e5cf76853b49f, 0x186ec5fa9857c41d, 0xb6d2ea4cb54ae279, 0x215af43ba34bf1e5, 0x178f9d5ed47f2163,
+    0xe1256a7dcd423eaf, 0x47c3b6121f365e2d, 0x317cb2e43e275d89, 0xd1974e354c2a7bf5, 0xf58dbc276a2e9b73,
+    0xcb5f14ea9731a8cf, 0x92735afcb723c84d, 0x2af915bed425e6b9, 0xd186574fe43af627, 0x2f7cb4e3254d1693,
+    0x534eb627613d24ef, 0xa2cb35798f12536d, 0x7d1e8bc98e1562d9, 0x268b53acbd2a9147, 0xea351c9dc91b8fa3,
+    0x943875adc83dae21, 0x68294531f621bc7d, 0x6d8a94532613dbe9, 0xcd62a1743416fb57, 0xa657123875291ac3,
+    0xce974b8a952d3a41, 0x2e3d98176cfe379d, 0xf1e25adbadf2671b, 0x792146fedcf39587, 0xa761bd8edaf795e3,
+    0x7189f6d329fab461, 0xc6d9513436fca2bd, 0x8b24a57656efd13b, 0x53d69a8764d2ef97, 0x6712e94a94d61ef3,
+    0x7a1836dcb2f93e71, 0xa817e3d98fe93bcd, 0xa4657db1fade5c4b, 0xf142d8932de16ab7, 0xbe983fd43ce49a25,
+    0xc3486d254ae6b891, 0xc13742e545c8a6fd, 0x1dfae2c984ecd56b, 0x39bd5e8a93bfe4d7, 0xd142537ed7e31645,
+    0xf69e3db1f2e734b1, 0xc98431e541d9532f, 0xdb1ce2f43fdc518b, 0xbc9df2143bac5fe7, 0x14ef52a87bc19e65,
+    0xfc6a52e878b49dc1, 0xc2df869a97c6ab3f, 0xb9845c7fe4c7da9b, 0xd3584b91f4bcea19, 0xf68ae59213bef985,
+    0xad48263765c438e1, 0x5213a7b981c6375f, 0xe8ba62d76fa845cb, 0xd3cae2f98ebc7539, 0x58fb6d7a9cbe83a5,
+    0xc9b34e1feac2b413, 0x4a7b59dfe8a4b17f, 0x64b58df21685afdb, 0xfb491da325a8de49, 0x72dac645438afdb5,
+    0x7ea3b4d985af1d23, 0x58cf2d3a91a23b8f, 0x65e392cbae8549fb, 0xb243cd5edeb85a69, 0xd5b6fa81fc9b78d5,
+    0x49f7e3121c9ea853, 0xfc6193843981b5af, 0x52913ad76894c52d, 0x1f2ac9e875a6e389, 0xe36d159ba489e2f5,
+    0x57c4f89dc5ad1273, 0x25bf6dacb28e31cf, 0x64ae8b5dce825f3d, 0x1ea947521f745ea9, 0xc8e7ab543e698d17,
+    0xd8c3be754d6b9c83, 0xc317ed85475c89df, 0x143cf82ba871c95d, 0x4376598cb563e7c9, 0x8391bc6ed496f837,
+    0xbd62ea31f48b17a3, 0x2c7d3594359d4721, 0x4713a5c6518f347d, 0x8b4ca1f65f7263e9, 0x736ce9dbae869257,
+    0x72d54f9bad6891c3, 0x1e4c267dc96baf31, 0x73eb2d9cb64cae8d, 0xa19edb2fe651dcf9, 0xb8f549321853fc67,
+    0x6c28b31545671bd3, 0x5c6b13d9847a3b51, 0x1be45d98715c38ad, 0x7dc26bfa9e4f582b, 0xef5ba17dce428697,
+    0x617fb59edc4596f3, 0x7ec94fd1fc49b571, 0x387b9d421849a3cd, 0xd6f3ac94385ed24b, 0x419cfd376852f1b7,
+    0xa41e8d6cb9873125, 0xaf76e51cb4573f81, 0x74d15f9ba1483ced, 0x3562e19baf2c4d5b, 0xe532b86fed2f5bc7,
+    0x8b3a9f621e429b35, 0x136d2ba54d35b9a1, 0x41b85da65a37b81f, 0xb8eaf7d6582ad67b, 0x5d42e9fa962cd5e7,
+    0x14ba258ed9421765, 0xad132b7fe74635c1, 0x25d749cfe128543f, 0xd2c64e35413a529b, 0x7f1cdb465f3d7219,
+    0x3829eb454c1e8f75, 0x2b1769a87b239ed1, 0xcf7ab6e98915ac4f, 0x7f95bdea9716dcab, 0xa721c9fed61aeb29,
+    0xbd8e293fe41dfa95, 0xb19af3e6574239f1, 0x753619b87514386f, 0x3ba86f19821746db, 0xd3c9fa865efa7649,
+    0x3b9a15f87dfc84b5, 0x189b5eca9bfea523, 0x5e13fb7dc9e1b28f, 0x2d3c165ed7e4c1fb, 0xf843e5d217e6df59,
+    0xaeb6c91324d8fec5, 0xab47edc876fc1e43, 0x5a31f62763de2c9f, 0xe3189f7a92f35b1d, 0x4397ed8bafe45b79,
+    0x19382abcbcd879e5, 0xb98ac651fbeca963, 0x61bf38e218cd96bf, 0x4e1a9d6549e1c63d, 0xd8c7e1f657d3e4a9,
+    0xe6bf387a96d8f417, 0xef41a28ba6eb1483, 0x78b1f6da94cb32df, 0x62f831acb2cf415d, 0x2f91ac5edec25fb9,
+    0x46c8fa321fc58e27, 0x8e4c19232ec78d93, 0x5372a61437b98aef, 0xcd12f345479eba6d, 0x62eb4fa876b1e8d9,
+    0x8e94f3bcb6c3f947, 0x48c619bfe5d718b3, 0xe52ab731f5db4831, 0x9fb4cd7212bc358d, 0x765b21d431be54f9,
+    0x392bfac65fc29367, 0xa7c3e9f87eb692d3, 0x586473c98dc9b251, 0x7f5d3a9cb678af9d, 0x9467fe5ba68dce1b,
+    0xb8d9563fe5a1fd87, 0x76f2be4327a51ce3, 0xf4b1e3c545b83c61, 0x973bf4d652a839bd, 0xc392b7e871ad593b,
+    0xd9c8e6276e9f58a7, 0xabe876fdceb3a815, 0x6921374feda5b681, 0xd427a851f987a4ed, 0x81d3c642198ad35b,
+    0xac3e5164368de2c7, 0xf3685d1989b41235, 0xf9b8d41a97b642a1, 0x923648ca92863efd, 0xf42951edc1894e6b,
+    0xe1d876cbaf6b5cd7, 0x7c591e8fed7f8c45, 0x879edab32e739ab1, 0x98abedf43c75b92f, 0x61a829743a56d78b,
+    0x1823a4e5485ad6f7, 0xc9ad128ba48df675, 0xca3b154dc79236d1, 0x16cd32aed296354f, 0xf46ce271f18753ab,
+    0x821c4735418b7329, 0xd581bcf43f6d8195, 0xe362f9454b5d8fe1, 0xda59f6487b62ad5f, 0xf7da29c87854adcb,
+    0x752bfaecb857ec39, 0x8593b6ded649fba5, 0xc98eab31f67e2b13, 0xb46c7ad32561397f, 0x814532b6526347eb,
+    0x843fd65ba1486759, 0x91f56a787f3a86c5, 0x249b61fa9e5da643, 0x8e45d1798b4ea39f, 0x8c9a172fea64c31d,
+    0xc54dae81fa45e179, 0xc84716a21837efd5, 0xf21ba865486b1f53, 0x4c635a87654c2daf, 0xb754e8da94615c2d,
+    0x4ed6915cb1435c89, 0x5deb42fcbe267af5, 0xf92c8d3ede2b9a73, 0xd1a492bfea2b97cf, 0x8a1439521a2fb74d,
+    0x8f692ea54a32e5b9, 0xe57b6f898a36f527, 0x9b6fa32cb84a1593, 0xe762f59a964a23ef, 0x3597b18cb53e426d,
+    0xde2418afe34261d9, 0x54fc962ede148f37, 0xab24cf932f168ea3, 0xdeca32465e39ad21, 0xcbed3125491cab7d,
+    0x9ec13f26571fcae9, 0x4fd7a35cb912fa57, 0x691348ced82619c3, 0x1c28abefe72a3941, 0x2594fc61f41b369d,
+    0x6875d124342e561b, 0xf5d642a763219487, 0x1baf2e976df294e3, 0xcda35e798df7b361, 0xf24165b769f7a1bd,
+    0x6eb3a18987e9cf2b, 0x8479da3ba5fcde97, 0x3957e1cdc7e21df3, 0x156e4d8328f53d71, 0x7d4c2b6324f63acd,
+    0xb15d4e9762f95a4b, 0xac24ef9761fd59b7, 0xace954287edf8925, 0x4dc3a6ebade3b791, 0x26f17dbcb9c4a5fd,
+    0xd73e28f1f9e8d46b, 0xad56f7b218cae3d7, 0x57f192d438cdf245, 0xe6f732d878e243b1, 0xc238f4ea97d6512f,
+    0x8ef46dca92d64f7b, 0x1f593d4ba1c95de7, 0x19d8624bafbc8d65, 0xc28ad47fedaf8bc1, 0xe58364d21dc2ba3f,
+    0xe29657d32ac4d89b, 0xe3f4cda54ac7e819, 0x24cade7546cbf785, 0x4691c73a96bd27e1, 0x268b37acb7c1365f,
+    0xdc752b6fe2d354cb, 0xa4cfd821f1d87439, 0x9f2c61b431db82a5, 0x5834edc65fbda213, 0xfdce63543b8d9e6f,
+    0xd9c517365982aedb, 0xb9af75e878a5ed49, 0x274f61dba697fcb5, 0xc39e785fe7ab1c23, 0x234bc16fe49d2a8f,
+    0x925abcf325a148fb, 0xdeca714542c35869, 0x6841eaf541b687d5, 0xe3c4bf176f9ba753, 0x961fea576d7c94af,
+    0x28bcf36a9a8fb42d, 0xadf3b85edba3e289, 0xbd2c517ed896e1f5, 0xcadf416549ba2173, 0x9d56a13435792ebf,
+    0xdb298537658c4e3d, 0xbd5e37f873815da9, 0xde8b1f3cb2a48c17, 0xb8ae6f7dcf769b83, 0x27b1a53cbc5798df,
+    0x2f8547c1fa6cb85d, 0x3c19f7621a5fd6c9, 0x2ce431f54b92f637, 0xe47b12d65b9716a3, 0x9a518d7cb89a4621,
+    0x8657fd1ba58b437d, 0xf8e76a2cb37d52e9, 0x2cba857fe3a29157, 0xb4d1a97ede648fb3, 0x9bdfe2632f67ae31,
+    0xb6e4f7532e47ac8d, 0xafe2d964384acbf9, 0x5a8c4976594feb67, 0xf4a615bcb9741ad3, 0x34a169ded9873a51,
+    0x59db3c4fe45837ad, 0xad5c3761f36c572b, 0xdcbe57a2124e6597, 0x48bed217627195f3, 0x3ea54b898f65b471,
+    0xba6239487e46a2cd, 0xaf1268798c59d14b, 0x41b7862a983bdfa7, 0x16a5d2bcb84dfe15, 0xf9b384a1f9643e81,
+    0xb4e6fc7217453bed, 0x91d48cf326384c5b, 0x1fd59e37623b5ac7, 0x815b4fea914e8a35, 0x849e51da9f42b8a1,
+    0x9e18435bad34b71f, 0x2b9e573fec26d57b, 0xdf564e71fa29d4e7, 0xbc1375e21a2cf365, 0x8c3f1927695f24c1,
+    0x6317ab298964523f, 0x95e1af7ba736519b, 0x1c8f746ba3285ef7, 0xc2b45e1dc12b8e75, 0x4a51736baf2e8cd1,
+    0x64eb3a8fed21ab4f, 0x6ea9c7b32e13d9ab, 0x9f61c4854c16ea29, 0x4867cbf54b1af895, 0xcb56f748793c28f1,
+    0xf2a3e89ba81e276f, 0x125ce4adc71245db, 0xcd1ab86fe3167549, 0x2fbe86d1f21983b5, 0xc8da21f7651ca423,
+    0xb6f831c43deca18f, 0x691ca5e438cd9feb, 0x1fd632876af2de59, 0x7cde461878e4fdc5, 0x1987afecb8f91d43,
+    0xec3496adc5ea2b9f, 0x392feb5dc5fe4a1d, 0x91ecf42324f15a79, 0x28b43df542f378e5, 0xd8c3e45651f7a863,
+    0x9e1f8ab54ed895bf, 0xe472c6987aecb53d, 0xe56b9d4878cfd3a9, 0xa371864dcad4f317, 0x58fdac71fae71283,
+    0x4ea1cf7327c831df, 0xd1e8cb9326ca3f4d, 0x89e14d2653cd4eb9, 0xdf418c6a94e18d27, 0x4e8a1d7ba1e48c93,
+    0xbac5fd487db589ef, 0x7e4a316baec8b96d, 0x6be923c1f8abc7d9, 0x75b18da21abfe847, 0x2c89b5f65ad417b3,
+    0xe9b15c376ad84731, 0x5e9fd4a876c9348d, 0x1482a3b984cb53f9, 0x62e1385cb3ce8267, 0x95cba76fe4c291d3,
+    0x8c469d5edeb5af41, 0x37a496b21f85ae9d, 0xda59c8143e98cd1b, 0x8c93b1d43a9bec87, 0xe3a81dc6578dfae3,
+    0xc472ae9ba9c43b61, 0x38e5cb7dc6a538bd, 0x6ed8a95fe4c9583b, 0xa564e7d1f2bc56a7, 0xdaf7821323be9715,
+    0x1562dce763c2b581, 0xf41daeb65f84a3ed, 0x1385ce676e97d25b, 0xbc31a2976b89e1c7, 0xa139edfba98bef25,
+    0x26e7193dc78e2f91, 0x7d94c3efe6823cfd, 0xc314f76217954d6b, 0x619e4c2323985bd7, 0xc6ad2537629c8b45,
+    0xc8ad1947627e89b1, 0x792681fa9e71b82f, 0xa7c4e38bae73d68b, 0x6874bfedcb86d5f7, 0xab16958feb8af475,
+    0x52e8ac743a8c25d1, 0xed2f9416598e234f, 0xacd845b7678352ab, 0xea4965bcb5a67129, 0xe5263a9cb2697f85,
+    0x271f48dcb26a8de1, 0xc67d58abae4d9c5f, 0x8f729c51fe51dacb, 0x5d1f78621d64eb39, 0x5fbd18a32c46f9a5,
+    0x9f435ca76c7b2a13, 0x21845df7695c287f, 0xbd4f168a975f36eb, 0x8fb7324ed4827659, 0x7198dabfe27684c5,
+    0x63f2e8a1f179a543, 0xf6b85e74315ba29f, 0x87fade154f5eb21d, 0xb82a9c565c41df69, 0xaf13e9c87a43fed5,
+    0xf68c7edbab681e53, 0xed76a54cb7482caf, 0x7d945abfe75c4b2d, 0xdb432a5fe53f4b89, 0x8fd96542164279f5,
+    0x1c825be76245a973, 0x97b48af6513796cf, 0x5127be687f2ab64d, 0x3b71d2c87c2ed4b9, 0x2be37a6cbc51f427,
+    0x7db9253fec561493, 0x4d38af7ed94732ef, 0x5b7c2943293a416d, 0x2f9e7da4362b4fc9, 0x52f8e1c9852f6e37,
+    0xfb97523a95428da3, 0x65f1b9ecb346ac21, 0xb4e2c36a9f16ba7d, 0x4d71fa6cbd1ac8e9, 0x4f673e21fb1de957,
+    0xa498fc765d4218c3, 0x72a319687c263841, 0x38c5dab76a17359d, 0x32d7198a982a651b, 0x19a63fecb51d6387,
+    0xa8db625cb51f82e3, 0x82bc451fe534b261, 0xf29a873cbce39fad, 0x8e31fba21df6ce2b, 0x7a8c45e32bf8ed97,
+    0x674ca1f548daebf3, 0xbedc8f6769ef2c71, 0x4d13fc7987f239cd, 0x7ae8c54dc7f6594b, 0x49c8db1ed3f958b7,
+    0x2b4cd36fe3fc9825, 0xb8162ce323fea691, 0xe2d418c652e1a4fd, 0xfe9347265fe4d36b, 0xb2efc7a65bc6e2d7,
+    0x8c2deab98bdaf145, 0x81f5643ba9ed32b1, 0xcd178a4ba7bd3e1f, 0x6bda8f91f6d24e7b, 0x8ce3d4f216d45ce7,
+    0x67fd2a8323e98c65, 0x1da2cb9653eb8ac1, 0xbed925a761cda93f, 0x15a29ce76fc1d79b, 0xd2ea351badc4e719,
+    0x1f938a2edbc7f685, 0x963e7a41f9ca26e1, 0xe14a9bf219bc245f, 0xd9f5718327af43cb, 0xe6ca59b768d47239,
+    0x34c21dba94d681a5, 0x1459cbfa93b78ef1, 0x1c7f2ea981ba9d6f, 0x31cb87598f7e9cdb, 0xdc5b7a91fda1ec49,
+    0xbf57eca21d93fab5, 0x5bd7e3a65dc81b23, 0xfe732ba547ba298f, 0x1ed7fcb6569c37fb, 0xd2ae486ba5bf4769,
+    0x5bc28fedc4b286d5, 0x751b842fe2c7a653, 0x547de9bfe1b793af, 0x8dfa7465419ab32d, 0x6519ab743f7ed189,
+    0xed36c7154b81dfe5, 0x87fda5398ca51f63, 0xefcdb7a879862dbf, 0x8f9431bcb7894c3d, 0xc3478d1fe57d4ca9,
+    0xeb314a6fe49f6b17, 0x1934d86215b29a83, 0x8b5ea364328497df, 0xd3e486b54198b75d, 0xe62cdb754f6ad5c9,
+    0x46e891ca9c8de537, 0x269ce1adcd9215a3, 0x31cb764feca74521, 0x96a4ceb1fa98427d, 0xdb547683287a51e9,
+    0x72b6de43258c6f47, 0x7a5c9246546f7eb3, 0x862ec45a9584ad31, 0xdc267fba9164ab8d, 0x34f76ec98e46caf9,
+    0xf18bc92dcd4bea67, 0xb971d38fea5cf8d3, 0xa19d2e354d823951, 0x5a7b1ed32b7436ad, 0xad798c354a78562b,
+    0x238c7edba85b6497, 0xf396d5aba56c84f3, 0x8fec523dc46fa371, 0x47a23c6fe263a1cd, 0x2f6c957ede45cf3b,
+    0x9f1bcea21f36dea7, 0xcdb597f43c4afd15, 0x82b15ea76b5e2d81, 0x4396ace879513aed, 0x3ec7a28dc9634a5b,
+    0xac827d1ed83659c7, 0x7dc1a6bfe64b8935, 0x597c8231f34d97a1, 0x24dcf863234ea61f, 0x198dafc76152d47b,
+    0x5fd8e1a76f25d3e7, 0xd8e12a498d39f265, 0x318cde6a9d5b23c1, 0xfd42573cba5d413f, 0x3bf4279ed9314f8b,
+    0xca431d6fe8235df7, 0x1d56f4e219268d75, 0xd1a8496545398bd1, 0xd6b82397632c9a4f, 0x5dc316a7612fc8ab,
+    0xce96da3baf13e829, 0xf7b69a1cbd14f795, 0x8d61af2edc3927f1, 0x8d5e436fea1b256f, 0xda5e96b3291e34db,
+    0xc95a13676b217349, 0xe14cf938791482b5, 0x4fba7e6cb748a123, 0x714e8a9ba3189e7f, 0x4bce6a29821a9deb,
+    0x7fbd16e98bfecd59, 0xfb41957edae1fbc5, 0x2c16dfe32df61c43, 0x8a7953143be62a9f, 0x1e5492d658fa491d,
+    0x8c7aefd656fd4879, 0xf61d3c2a94df67e5, 0x3248a5fdc5f2a763, 0x8c9e621dc2e594bf, 0x79a18b6fe1f8b43d,
+    0xdfa2cbe431fbd2a9, 0xe926bcf54fcde217, 0xef146d787de42183, 0x142f3ac769b42ecf, 0xcf4e3b6989c73e4d,
+    0x18473a5ba6e84db9, 0x954d873cb5ed6c27, 0x1925ec8fe4df7b93, 0x6ace835214c298ef, 0x5da1b82432e4b86d,
+    0x812f9c6541e7c6d9, 0xa32c58965fcbe647, 0x29af46d87cadf5b3, 0xb274f3ecbcd24631, 0x9edba26feac5438d,
+    0xdeb2945fe8c752f9, 0x7cba198329db8167, 0x98d5f76325ab7fc3, 0xf3da9be765bf9e41, 0x3562d8a763b2ac9d,
+    0xc78d6fb982a5dc1b, 0x8c42563a9fa6eb87, 0xfa5d13bcbc8af9e3, 0x38fb4571fcbe2a61, 0x2ba5d6432ca137bd,
+    0x825f61a32ac4573b, 0x1fe76b9439c865a7, 0xc726b84987cb9615, 0x9174c32a95bda481, 0x4f975d1ba38f92ed,
+    0x978346bfe2a3d15b, 0x93cf4e1dce84dfb7, 0x76a413521d98fe25, 0x6fae48354d8b2e91, 0x748d9f15497c2bfd,
+    0xfc36e4d87a914c6b, 0xf683517cb8935ad7, 0xc817b9fed6b78a45, 0xce2b481fe47a98b1, 0x6bc21d9fe38ca72f,
+    0x4763ab12127fc58b, 0x9cf412e65192d4f7, 0x2e7ab3c54e96f375, 0xa3fdc4b87e8924d1, 0x16eb487a9c8b324f,
+    0x293cb58dc97e41ab, 0x38479dfeda826f19, 0x9f3b4cd1f6937e85, 0x628bed9325768ce1, 0xbfae845323689b5f,
+    0xa8ce4d65425da9cb, 0x374fdea8716fda39, 0xb8ed4f2a9e62f8a5, 0x476b83fdce872913, 0x76c592dedc59267f,
+    0xf5b498a1f96a35eb, 0x439f57c21b7e6459, 0x1289c3b54a7183c5, 0x1c64f5987986a243, 0xb8e62ac98456a19f,
+    0xc7fea56982479efb, 0x73c415fba14bce69, 0xb7d5f36a9b3fecd5, 0x28fe6941fe741d53, 0xcf8645a21d452baf,
+    0x6c93fe743c584a2d, 0xced527165b3c4a89, 0xcd35b628793d68f5, 0x31a7bc9dc951a873, 0x97ea631cb64395cf,
+    0x546c9abfe237b54d, 0xfd584a61f148d3b9, 0xb6af3e45415ce327, 0x3a9edb865d4ef193, 0xc4d7ef987c5431ef,
+    0xe674dca98b263f5d, 0xd21f8bc98a274ec9, 0x84fae69dc92b6d37, 0xcafd5b9ed62e7ca3, 0x8f5a9ce1f753ab21,
+    0x5ab3dc821523b97d, 0xaeb724f54325c7e9, 0x851bc497612ae857, 0xa4271e687e1bf6c3, 0x5dca219bad3f2741,
+    0xb12493ecbc12349d, 0x14c72dafec27641b, 0x7e82fb41fb1a6287, 0x28ad6395492b81e3, 0x8e1739b5472d9f51,
+    0x51f4bc6765219ead, 0x2decbf398514cd2b, 0xf981a53ba215ec97, 0xf65bd3298cd7eaf3, 0x4fd638ebadfc2b71,
+    0x38bef54cb9fe28cd, 0xc94d7af32cf1584b, 0x29b5c8d32af356b7, 0xbc1fe9354af89725, 0xd5fb96a876fba591,
+    0x17b53fd874eb93fd, 0x58793e2a93efc26b, 0x193f574cb2f3e1d7, 0x9e28a7bcbdc6ef35, 0xe98d61343ed82fa1,
+    0xf6c14a254bca3d1f, 0xa8947dc549ce3d7b, 0x45f38bd769d15be7, 0x91a26c7ba9e38b65, 0xa5fb916cb5e689c1,
+    0xf156974dc4d9a83f, 0xc32d8b41f2edc69b, 0x8b6dc4f323cfd619, 0x94bc2e6761d2f485, 0x498b25a76fc725e1,
+    0xc27b19387dc9235f, 0x4e2af93879da42cb, 0x83e2ab6cbace6139, 0x14dba69ed8c17f95, 0x5c7b6d8fe6b48df1,
+    0xdf8ab37214b59c6f, 0x8fdc157323c79adb, 0x5bcfd83652acdb49, 0x4316bac761afe9b5, 0x671b853a9fc51a23,
+    0x2f864acbadb5278f, 0x41df3b7edca836fb, 0xcf743b81fabc4569, 0x579a8ce219ae74d5, 0x398bc1e769c1a453,
+    0x8472fb1656b492af, 0x2be7d4c985a7b12d, 0x46a2c9e762a8cf79, 0x6952f3ca918acde5, 0x56da1e7bac8efd63,
+    0x81756b2fed832cbf, 0xfbc463d21e964b3d, 0xadbe72832d874ba9, 0x3a296d454b9c6a17, 0xc258937656ae7983,
+    0x83625c1ba58196df, 0x78bc1f3dc493b65d, 0x85daeb9fe286d4c9, 0x6e45afc1f19ae437, 0x1d8e6f75418cf2a3,
+    0xe1bd9c376e9f3421, 0xd68a4b276e93417d, 0x81f539676b754fd9, 0x8d9ac71bab896e47, 0xeba4728dc86a7db3,
+    0x47298fced67e9c31, 0x9acf73d1f461ba8d, 0x5d617ae21463c8f9, 0xe2f6b1843285e967, 0x25c8abe65169f7d3,
+    0xd6fb854a9f7d2851, 0x24cdeab98c6f25ad, 0x5ca4e89dcd83652b, 0xd3871aefec856397, 0xd82a694fea6982f3,
+    0x81e9c7a4396ca271, 0xe4bc1873254c8fbd, 0x4c372ed87561ce3b, 0xf5267b498253eda7, 0xe5864dcba267fc15,
+    0x1b3d4eacbf5a2c81, 0x16c4e58bac4b29ed, 0x8cd943afec4f395b, 0xc7a843f21d4258c7, 0xc852a4632c469835,
+    0xefb519865b4896a1, 0xd4bf1ac9874ba51f, 0xdfe9287a954ec37b, 0x39278d6cb451d2e7, 0x3fb9c14ed274f165,
+    0x67dce29fef5832c1, 0x589ae7b21d493e2f, 0x87d41a354d2c3e8b, 0x4823c1f65a2e4cf7, 0x38d6491a9b328c75,
+    0xd3b9872cb9358ad1, 0x4568b73dc627a94f, 0x56e9ca1fe429c7ab, 0x69d3c281f43ed729, 0x652de9732431f695,
+    0x74d68f19834526f1, 0x7e9da2c87e18246f, 0x4653f7987e1943db, 0xdc92ae3bac1d6249, 0x2eb786cdca2f71b5,
+    0x8f1a65beda249f13, 0xb81674dfe6149d7f, 0x7bd52f4325169ceb, 0xf7a592d4341adc59, 0x612859d7631deac5,
+    0x1276ea4ba6521b43, 0x326fbdc87de3289f, 0x5d8e74fbacf6481d, 0xb96cda1edcfa4679, 0x13fb2d8ed9fb76e5,
+    0x34b5a6821afe9563, 0xda36c4f547e193bf, 0xad4e63b767f5b23d, 0xfad749e874f6d1a9, 0xa19dfbc872d8cef5,
+    0x68314b5a91dbfe73, 0x17d8acf98bae1dcf, 0xc872d4f1fbe23c4d, 0x6139ad721de54cb9, 0x1635b2c43ce96b27,
+    0x691478f548ec7a93, 0xd369b21545bc87ef, 0x562ec1fa95e1b76d, 0x451da9fba4e3c5d9, 0x76cb4eadc2d8e547,
+    0x85abc9dfe1d9f4b3, 0x193fa5d764ed2531, 0xb48df1a54ebf328d, 0x58a13f476dc351f9, 0xc3fe7d598bc46f57,
+    0x34fac29769b87ec3, 0x56e9da2ba7cb9d41, 0x83b2196dc4ae8b9d, 0xd42c8791f5c2da1b, 0xbcf49e7214c3ea87,
+    0x3c1af78542b6f8e3, 0xbf4c57a873db2961, 0xbd1e53c65f9c26bd, 0xa65c87f98daf463b, 0x6e5fd1acbdc264a7,
+    0xa98c172febc79415, 0xc7298bf1f7c9a381, 0x89fc5713268a91ed, 0x68a547b3258daf4b, 0x5efb28965491deb7,
+    0x762b34a983a4fd25, 0xd7ec513ba3b72d91, 0xf8b694ea9e782afd, 0x3cb2951dce8d3a6b, 0xda7194efeb8f49d7,
+    0x6cde34521db28945, 0x56a237843ca597b1, 0x9b4f6ea54798a62f, 0x948cbad7657ac48b, 0x12be348a948dc3f7,
+    0xe5f9782dc4a1f275, 0xc4596eafe4a623d1, 0x935b17fede98314f, 0x8fbc63921e683f9b, 0x125a3cd43d7c5e19,
+    0x3871f2a43b7f6d85, 0x6afb9c276a738be1, 0x41583facb8749a5f, 0xda762b1ed456a8cb, 0x89631dafe46bd839,
+    0xd94a7251f26de7a5, 0xd4fb185656a42813, 0xc16ae2376194257f, 0xb713e2465f6734eb, 0xd4a628f98e7b6359,
+    0xe16c7b5a9b6d72c5, 0x2b6cf31dcb7f9143, 0xec61f78dc7529e8f, 0x6247ebdfe6549dfb, 0x3d1a58621547cd69,
+    0xe6c4b1f32349ebd5, 0xc1d26a48726dfb53, 0xf24c7ae9836129af, 0x7263afcbaf65492d, 0x935e78bdce364789,
+    0x3c7ab81edc3a67f5, 0x4e6ca731fb4d9673, 0xbd41acf2193e84cf, 0xc73b51d65962b34d, 0x92a8bf376745d2b9,
+    0x498c76fba659e127, 0x7481d5ea924aef83, 0x23d95b1a924b1edf, 0x459d61ecbf413e5d, 0xa5d879b1fe234dc9,
+    0x714563d21e286c37, 0xfd1978654d297ba3, 0xc453a6876b4d9a21, 0xedf2b9c6562fa87d, 0x1ed3cafba732c6e9,
+    0x2ca8e96dc824e657, 0x5dc1862ed428f5c3, 0xb2ad68e1f35c2641, 0xec982a76514e239d, 0x75b9fe187f42631b,
+    0x2e4d371a9e246187, 0xae6152398b167fd3, 0xde6b17398b2a9e51, 0xd342678a961b8cad, 0x39527cded61fac2b,
+    0x4f62bae1f512eb97, 0xfe8d25932615e9f3, 0x469b5e3765392a71, 0x8ec315d7631a27cd, 0x65c1e9d76efd374b,
+    0x7c34be898cef45b7, 0xe28465bcbcf39625, 0x7b82c14edbf6a491, 0x143279bdc6e792fd, 0x9f8167c327fac16b,
+    0xa6b4fec324edbfc7, 0xde17b53876d1fe35, 0x1af8745984f52ea1, 0x53749cda92e73c1f, 0xf637b5198fe93c7b,
+    0x2d78c5ba9bdc4ae7, 0x97836d1febdf7a65, 0xb621a4e32be398c1, 0x4ef965d329d5a73f, 0x6e852b1436e7c59b,
+    0x1b26f9a876ebd519, 0x31e9cf4a94cde385, 0x65da91ecb6d324e1, 0xf389167dc1d6325f, 0x1c8d72afefd741cb,
+    0xcdb9ea721eca5f29, 0x259ba7c32dbc6e95, 0x29f1c76549ae7cf1, 0xde47c9a658c29b6f, 0x2d14f6b876c4a9db,
+    0x9b4ad53cb5c7da49, 0x5186cb4ed3cae8b5, 0x45a987dfe4bdf823, 0x38269af434c1268f, 0x3fae154761c435fb,
+    0x369187c43fc85469, 0xcfeb21876eba73d5, 0xb7fe26498cbd9253, 0x371f859cb79e81af, 0x81a7c6edc793af1d,
+    0x5fe3d6a1f5a4ce79, 0x9f1d48c21497dce5, 0xf597ce63249afc63, 0x94b3dae6538d1abf, 0x84aefd2982b14a3d,
+    0xb539c2d87fb348a9, 0x9cae826dceb86917, 0x6b57dacfedab9783, 0x4bc6e5afe97b85df, 0x6caeb9f2198fa45d,
+    0xcb4326d54782d3c9, 0x4d75e21658a6e237, 0xcb5123687598f1a3, 0xd34be81cb6ac4321, 0x9c6f238ba18c2f6d,
+    0xb7234aecbf714ed9, 0xd3f7a581fe936d47, 0x86f75b121e867cb3, 0x1ae94d354d7a9b31, 0x81dace34375ca98d,
+    0x8bc36da5465eb7f9, 0xd5e13b9cb592e867, 0x1362aefcb485f6d3, 0x3bc128efe49a2751, 0x92e4d531f17b24ad,
+    0x367b5c14318e542b, 0x8c3ab1454f816297, 0xb48c6a176d7581f3, 0xab16de398c579f61, 0xb4ced15769478ebd,
+    0xd468512a975cad3b, 0x139bfd5cb54fdca7, 0x4eb8759fe673fb15, 0xdca5fb3435762b81, 0xe6bd3fa5435728ed,
+    0xef5c6a78716c385b, 0x3deab2698f3e46c7, 0x4b91afdcbe619735, 0x16254a7dcd6495a1, 0x79c542aedb57a41f,
+    0xf47936a1f849c27b, 0x6ab98e13284bc1e7, 0xfbce9783273edf45, 0x8721b36987642fb1, 0xcd6b587a94563d2f,
+    0xdc9e376ba1473d8b, 0xd5b31cfa9e2a4bf7, 0x4637a12dcd2e6b75, 0x9b6fa341fc4289d1, 0x6da5e8921c23a84f,
+    0xdf38e5643925c6ab, 0x937f2e46583ad629, 0xf432bc69872ce495, 0xec79634a963de4f1, 0xe97f2a6dc754236f,
+    0x53e2bd6fe13642db, 0x257e416fef2a6149, 0x24cae8b32e1b6fa5, 0x8d9b7e365c2d8e13, 0x8ce7bfa65b219c7f,
+    0xad1b9c3768139aeb, 0xf75ca4eba816db59, 0x341e28acb618e9c5, 0x7d45f6bed61cf943, 0xc3a65fbed42e179f,
+    0xf54e9d765623471d, 0x138db24982164579, 0xfeb8c6143df874e5, 0x6732eab87dfb9463, 0x31a6d5e769ec82bf,
+    0xb973e84a98efa13d, 0x79ea845cb6e2cf89, 0xfab2319cb6e4cdf5, 0x4e16bc7215e8fd73, 0x5bacf1d434e91bcf,
+    0xf12e43c763fe2b4d, 0xcf573ba872f14ab9, 0xfeb8d15a9fe46a27, 0x2d5eb74cbde67893, 0xb2f387acbac986ef,
+    0x27c49d51f8eca56d, 0x4c63db8217cfb4d9, 0x528ed7b659d2e347, 0xc8b493e657d6f2b3, 0x4f1c762a97ea2431,
+    0xb86135ca94eb318d, 0x14afe86981bc3fe9, 0xa8271d3cbfc16e57, 0x872e9d61feb47dc3, 0xa415cb732ed79c41,
+    0x1c2f9b532bc78a9d, 0x8127ce3547adc91b, 0xde97caf545bfd987, 0x41e6b28a96b2f7e3, 0x74268f9dc5d72861,
+    0x38e6c25fe3c825bd, 0xd72b8c51f1dc453b, 0x2cea8b6321ce53a7, 0x8bc4d6576fc29315, 0xa8b356e76ec5a281,
+    0x93dc1a854a958fcd, 0xcfb369a76798ae4b, 0xc346e57a958acdb7, 0xe4a78fdcb69fec25, 0x4d529831f6b42c91,
+    0x147cb6a214a529fd, 0xdcb23e7542c8396b, 0xfd92ce3651ab48d7, 0x1d5a6fb76fae7845, 0x8cfd27398ea296b1,
+    0xe9ba675cbc94a52f, 0x13576c4fea96c38b, 0x873ce49fe689c2f7, 0x12ef6743289ce175, 0xf96ed374357defc1,
+    0xe2dca3f876942e3f, 0x1a29b3e872853e9b, 0x187f6b9cb2a85d19, 0x527489ebaf7b6c85, 0xea17296cbc6d7ae1,
+    0x75bcde6fec71a95f, 0x63f194a21d63a7cb, 0xef658a932b86d739, 0xebf612743879e6a5, 0xd1bf675a978cf613,
+    0x761f538ba58e147f, 0x719b52cdc58243eb, 0x29d36abfe1a76259, 0x6a75189fef6971c5, 0x9864d7321e6b8f23,
+    0xb982e5a32b4c7d8f, 0x1d8b34e54a519cfb, 0xdf36abc87a53dc69, 0x6e53db9a9846ead5, 0x86a1e23dc769fa53,
+    0xca2b437ed45c18af, 0x142c65efe46f382d, 0x95a6ebf213724689, 0x1fb7c954318476f5, 0xdb96eac76f4a9573,
+    0x96a4d8f76d4a83cf, 0x5c437eb98b5ea24d, 0xe52fb71dca52d1b9, 0xfe6a572dc954df17, 0xca5349fed746fe83,
+    0x78d4afc326481cdf, 0xe5236d84364b2c5d, 0x2f94dec7624f3bc9, 0x8c3549aba1526b37, 0x2a48b76cbf2579a3,
+    0x6941fe5dce48a921, 0xe8ac139fec2ba67d, 0x49d72c61f82db5e9, 0x1cfd28432b31e457, 0x4f91eb676925f4c3,
+    0x3ae7f2698a692541, 0x1d3758e9864a329d, 0x1d498ceba64d521b, 0x98a6fe3cb12e4f67, 0xf1574e9cbf127ed3,
+    0xf47b52a1fe269d51, 0x1524cae32e168bad, 0x6df2e3b54d19ca2b, 0x423d6ac5481eda97, 0x36fb52787921e8f3,
+    0xe295a78dca352971, 0x47e62d5cb51726cd, 0x786ea5dfe51a364b, 0xbfe25931f21d54b7, 0x46e812b7631f8425,
+    0xe7b3a8c65ef2a391, 0x1d5af8765be491fd, 0xcafb4e8549e6af5b, 0x937eda4656f8bec7, 0xdec92b3a97fbed35,
+    0x87e2fd1a95defca1, 0x13486afed6e43b1f, 0x863d1a7214f53a7b, 0xe3689f1432f849e7, 0x4ea13f9541fc7965,
+    0x9fa5c4365fde87c1, 0x5bc681a98cd1a63f, 0x571a84d98ae3c49b, 0xa53461cdcae7d419, 0xad823651f7dae285,
+    0x35e9f1a437cbf2e1, 0x92be364547ce215f, 0xa9b658d765d23fab, 0x85b17ad983d65e29, 0x24916d3ba1e86d95,
+    0x4e83a7198eca7bf1, 0x8e9b5f6a9cbd8a6f, 0xfce6d421f9c1a8db, 0xdf841b321bc3d849, 0x6d9bc85329c6e7b5,
+    0xfea52c7658caf723, 0xf2ba4d6876bc158f, 0xe7264ad985ae24fb, 0xe351cb7dc4d25369, 0x7e49a6dfe1c672d5,
+    0x47db562fefca9153, 0xd51f83e21d8a7e9f, 0x91f8ce543b8c9e1d, 0xde8b72154ba1cd79, 0x9c42a1f76893dbe5,
+    0x76ec231a98a7fb63, 0x5812f7edc5a819bf, 0x368bd25fe5ac293d, 0x12ac78bfe2bf37a9, 0x6fc1b58324c36817,
+    0x97dfc4e541c59683, 0x185f7db43e9784df, 0x5e81bd676e8ba35d, 0xca8ef2376a7eb2c9, 0x4693fc5dcba2e137,
+    0x5f79683dc784ef93, 0x12bf53adc5861def, 0x1495edf215892e6d, 0xeb178643247b3cd9, 0x49dea837629f5c47,
+    0xc14f2e6981927ab3, 0x41372f6cbf869a31, 0xa53ef46cbe56a78d, 0xf2b93d4edc5ab6f9, 0xc87de351fa8ed567,
+    0x897f56e32a81f5d3, 0x46dc1b354ba72651, 0xd147fab6568723ad, 0x56298c3a968a532b, 0x514efdbcb38d5197,
+    0x74dce86ba17d6fe3, 0xe4f97acdcf739e61, 0x3d58bf91fe548cbd, 0x9ab5f6d21e57ac3b, 0x15874df32c49dba7,
+    0x46f279c5496dea15, 0x9c5836fa9b732a81, 0xfc91a42ba86427ed, 0xa5cd864ed468375b, 0x3ecd486fe26a45c7,
+    0x2dea48c1f17d8635, 0x5b61de84326f84a1, 0xc28e4bd65e64a31f, 0x95e364c76e45c17b, 0xac357d965a36bfd7,
+    0xd51be3f9893ade45, 0xb3f7ce8a974cfdb1, 0xa4c8d12ed8613c2f, 0xf3ce2a81f6543c8b, 0xbef5689215364af7,
+    0xbec46ad5423b6a75, 0xad541e67624c78d1, 0x9dac3eb76d2e974f, 0xdb1c42e98e32c5ab, 0x3a98521cbc36d529,
+    0xa3c726dedb28e395, 0x42689f1ed84ae3f1, 0xdf5ce874394d126f, 0x194bf327685241db, 0x642acef987245f39,
+    0x8cb369ea93276ea5, 0x5da89fecb24a8d13, 0x1ef8b6ca9e1c8b7f, 0x2357afebac1f89eb, 0x7b68afc1fc12da59,
+    0xd6a1b5232b14e8c5, 0xf74923b65b19f843, 0xd549ab16582b169f, 0x4e1f5d7a982e361d, 0xcb37f12dc8215479,
+    0xa4b36f8dc61473e5, 0xdb94e12fe4189263, 0x8a56329dcde781bf, 0xcdbe48a21cea9f2d, 0xf29e7b632afdbe89,
+    0x61b32df549e1dcf5, 0x3589cf1769e4fc73, 0x1d457a6987e61acf, 0x8e4d971cb6f92a4d, 0x196273cdc4fd38b9,
+    0x671b9fded3ef5927, 0xa57d4b3214f28793, 0xc57f1db431d485ef, 0xb57ec6843fe8a46d, 0x2dca18565ceab3d9,
+    0x7c6da8598aced247, 0x8e3419cba9d2f1b3, 0x1b86d2aedae74231, 0x9a762b1fe5c62f7d, 0x6be8fa3215c83de9,
+    0xf85297c323ec4d57, 0xc31f845652df6bc3, 0x4ca86b3982e39b41, 0x9c124f676fc4a89d, 0xf254c87a9ed7c81b,
+    0x347e5acfeacbd687, 0x3c92a8f1f8acd6e3, 0x67a3dbe54bd32761, 0x1869ca3438c524bd, 0xbc38f52767d8543b,
+    0x8172b6d984db52a7, 0x97d64c1ba4cd8215, 0x84df912ba2be8f71, 0xa4cf7e9baf928ecd, 0x59b724f1fe95ad4b,
+    0xbed35a621e96dcb7, 0x139cab543c9aeb25, 0xf74182d5478dfa91, 0x9cb4e62767a128fd, 0x9c73fdeba7c4386b,
+    0x3b92657dc3b846d7, 0xe129c68fe2cb8745, 0xfe678921f2ad85b1, 0x2ef736c431ae942f, 0xc89e2af54f93c28b,
+    0x1f84ade54d95c1f7, 0x1c6da8b54b98df65, 0xae51fbc76879fec1, 0x9a25d14ba78c1d3f, 0x32dc514fe6813d9b,
+    0x32fad461f6a45c19, 0x7a18f45213a76b85, 0x7c9ea135438a79e1, 0x1cd7f895417c985f, 0xa9d6c1354e5f96cb,
+    0xd7c2145bae82d639, 0xfd269a8cbc86e4a5, 0x98d3c27edb89f513, 0xd6abc83fe98b137f, 0xa9458ed2187d32eb,
+    0x136bc98548a26159, 0x4f1e5ac874836fb5, 0x56fdec4ba4978e23, 0x762af34ba1597c8f, 0x9feadb287e4c8afb,
+    0xfec6382bad4fcb69, 0xc7643d91fb62e9d5, 0x796ca3421c76f953, 0xa85736143b5817af, 0x978ac2b6596b372d,
+    0x54a1237ba76e3589, 0x29457a8cb68174f5, 0xb34d69aed2859473, 0x643fb21ed15682cf, 0x1bc526afef59a14d,
+    0xb87dc1621e3cbfa9, 0xbecfd2a43b4fce17, 0x93d2ecb76b52fd83, 0x351d6ca879451bdf, 0x61d8493ba9482b5d,
+    0x1d25c3fed64b3ac9, 0xdfa4572ed64e5a37, 0x3b2ce9d1f45178a3, 0x17c523e43465a821, 0xeac28d454136a57d,
+    0xa92c7e465f28b4e9, 0x31bf5e498e2cd357, 0xbdfe3c798a4fe2c3, 0x1b7d62aedc762341, 0x92a41cdfea46319d,
+    0x93bdf26ed6273ef9, 0xb64c71a2182b4e67, 0x8ab7cf65452e6cd3, 0xb46e37d986429c51, 0x4e57db28712389ad,
+    0x8acb7ef98f16c92b, 0x8a76391cbe1ad897, 0x9251fa6dca1bd7f3, 0x6dca312eda2ef671, 0x8de17ac54a1325cd,
+    0x2d5c4b176a17354b, 0x41f9a5c7681953b7, 0xdc34786ba71c8325, 0x4d983a1cb53e8291, 0xec75d2aba3218fed,
+    0x49782e5a9df2ae5b, 0xae937c1feaf4bdc7, 0xdcaf89121bf8ec35, 0xb61c8ef438e9fba1, 0xa3b5e49658ed2a1f,
+    0xbc3829a768f1397b, 0xca3d21fba6f348e7, 0x72f3a61dc3f97865, 0x93d6cfaed3fa86c1, 0x368b4f7ed1ec953f,
+    0x162c8d5321efa39b, 0x3f41e7565fe4d319, 0x39bdac154cd6e185, 0xb7835c2659b7efd1, 0x2e15f37878ca1e4f,
+    0x248ef5b986cd2eab, 0x3156849dc7e15d29, 0x9dbe4861f4e36c95, 0xdf6b952324d67af1, 0xe9f5b7c432da896f,
+    0x4cd9f23541ec97db, 0xf13a45c65ebfc749, 0x7c218f498dc2e6b5, 0xc512863babc7f623, 0x76f2d34edac9148f,
+    0x2367b9dfe7ca23fb, 0x7b859ed218ce4269, 0x3f64b87548c271d5, 0x145d62f876c58f43, 0xa234b19762b57d9f,
+    0xbd6fe57872b89c1d, 0xe6fc93476f8dbc79, 0x3fed29ba9b8fcae5, 0xe974b36fecb2fa63, 0x196f8da32ca518bf,
+    0xb31a29d54ab9283d, 0x4cbd3a7547bc36a9, 0x9f546eda98be5617, 0xf6975b2cb6c19583, 0x65b19d2cb2a483df,
+    0xec71683fe1b7a25d, 0x58c3617fef78b1c9, 0xb1c453f21e8bcf27, 0x5e9ba7832b7fde93, 0xe8b5fcd65a831cef,
+    0x2a14cb687a952c6d, 0x67a95f1ba6873bd9, 0x58d71c2ed69c5b47, 0x37f9548ed48e69b3, 0x64c3b2d1f5b2a931,
+    0x3b4d67821293a68d, 0xc2ade7843186b5f9, 0x7a12f6e43f8ad467, 0x583de4976c7be4d3, 0x128f394a9b8ef351,
+    0xf3e54c2dcb8432ad, 0xce6914bfea97512b, 0x13ad748fe5694f87, 0x465bf832157a6de3, 0x8a3d17c4347e8d61,
+    0x71d85a2653618abd, 0xa241c3798174ca3b, 0x2bf4ced98f45d9a7, 0x75a1fb6cbd6ae915, 0x6f93d8aedb5cf781,
+    0x9b87265dc95f16ed, 0xe4538af21c82365b, 0x26fe7ba32a8654c7, 0x6e42fd87697a8435, 0x864d792a956c83a1,
+    0x7219f4cba46d921f, 0x368e4f5dc251af6b, 0x2ae1854baf43bed7, 0x6e9fb581fc37ed45, 0x5648cf132d48fcb1,
+    0x16f4b2354a5c1b2f, 0xce1237d6594f2a8b, 0x7fe5ba298a5249f7, 0xc2ea498dca346975, 0xf125a89dc54987d1,
+    0x7abc4fded23b964f, 0x4bec2d61f13e94ab, 0xa1f49cb65361d429, 0xfea248b76f34e295, 0xd56289176c47e2f1,
+    0x3de4f5a98c4a216f, 0x64279f58783a2fcb, 0x9d4ae72cb82f4e39, 0xa3dc21efe8326da5, 0xaf342dc1f7468c13,
+    0xbf84e79214268a7f, 0xf4dc67e5432a98eb, 0xca621be7612ec859, 0x1bca83498f21e7c5, 0x184756cbad15f743,
+    0xd587b31cbc27159f, 0x48eb5d3feb2a351d, 0x46f3bc21fa1d4379, 0xdb23f854391f62e5, 0x47bce2a87a249163,
+    0x2c9d5b1765147eaf, 0xc6e8ad1984179e2d, 0xf3c1ea78721abd89, 0x7e2b9d387deacbf5, 0xc42397ea9adfeb73,
+    0x3a2b9fcedae319cf, 0xc1e48b321bf6294d, 0xde7c6a932af837b9, 0xdb3c7f6549fc5827, 0x2683ac4985fe7693,
+    0x3129b57a95d184ef, 0x341f28acb2f4a36d, 0x14fc538dc1f6b2d9, 0xc57af4bdcfead147, 0xde415c821ecbdfa3,
+    0x693271d54abdfe21, 0xbd4fe7965ac32e7d, 0x69d8cbf768d53ce9, 0xde4825cba8e94c57, 0x164f35da95eb6ac3,
+    0xa27f15edc5de8a41, 0x2a34e981f3e1a79d, 0x659ade7323e4c71b, 0x5ceab9f431e6d587, 0xf32417b54fb9d5e3,
+    0x64937cd87dbcf461, 0x6be571d879af13bd, 0x23f1eb5dcad4523b, 0x8516b2efe9d651a7, 0x13f2b6ded5b86ef3,
+    0xc8eb47d325cb8e71, 0x97ae8cb3239e7bcd, 0xde629f3763d1ac4b, 0x856c2b9761c3dab7, 0xfaec1d698fb7ea25,
+    0xe15caf287dbaf891, 0x54afc7bdca9b17fd, 0xd359ce7fe9af276b, 0x7a4b31621ab245d7, 0x8142ba632ac78645,
+    0x73f284b656c984b1, 0x2f3a659875ab932f, 0x9db3ca28739ea18b, 0xac43f18ba291bfe7, 0x8ebd4afcbf93de65,
+    0x8c3b57efeb86fdc1, 0x12a85f432d891c3f, 0x3ae8bc143a7d2c9b, 0xebf12d865a8f4b19, 0xa1f45d6879b26a85,
+    0x6dea15bcb6a578e1, 0x52e8f97dc3a8975f, 0xa957b3cfe27a95cb, 0x658cba31f18ec539, 0x284a91f54291e3a5,
+    0xaf4eb7565e96f413, 0x54f2da165d98127f, 0xab318e576c7931eb, 0xdb548a298a7c3f49, 0x19f6435ba87f4eb5,
+    0x712e38cfe7948d23, 0xab763d5fe3647b8f, 0x9c5eadb2135689fb, 0x6f95a134325bca69, 0x7a3f6125416ec8d5,
+    0x14f5c86a9e71f853, 0x5fd8461a9d7416af, 0xb495d13cbc78362d, 0x613724efec6b3489, 0x61275aefe97c63f5,
+    0xf489c7d21a6f8273, 0xe7b162a5476381cf, 0x14a35c2874659f3d, 0x27deac487246bea9, 0x5b96d72a925acd17,
+    0x1c967d8a9f4dec83, 0xaf26d5bcbc521adf, 0x9bcfe871fc642a5d, 0xa594df721d4638c9, 0x8dba27632c4b5937,
+    0x3f748ec6594d67a3, 0x3d1c7f2ba85f9721, 0xe9b17d3cb652a47d, 0x3b5e467dc245b3e9, 0xe918637fe149d257,
+    0x9b8a4fcedf4ae1c3, 0x2951fdc32d4cef31, 0x8f742a965c412f8d, 0x5b3e9f176b243df9, 0x51793f4a9b284d67,
+    0x29fad6eba8296bd3, 0x654723edc73d8b51, 0x7c28693dc42f78ad, 0x657fd921f543c82b, 0xba134fe21324d697,
+    0xa73cf1865128d6f3, 0x5f614eb76e2bf571, 0x51fc32787b2e14cd, 0x51e326cbad21534b, 0x713cb28edc1452b7,
+    0x7eb146afeb398125, 0xa287b53fe62a7f81, 0xec5b4f93251a7ced, 0x3a8d2e64341f9d5b, 0x8d2b5c476412dbc7,
+    0xdb51694a9216eb35, 0x91cd7fe87de6f9a1, 0x814356798cea291f, 0xf54b97cdcafd287b, 0x3987b5cdc9df36e7,
+    0xb3e865421bf28765, 0x6318eb9439f685c1, 0xc4eab82656e8943f, 0xef2d59a764fca29b, 0x8d34b1a984fec219,
+    0x5c6a98fba2e1df75, 0x917862ba9cb4fed1, 0x2e7ac9bfebc71d4f, 0x591c7de21ce82dab, 0xb8c659e43aed4c29,
+    0x713bced438df4b95, 0x854f2b6768d379f1, 0x34158a7ba5d4986f, 0xd41728cba3e796db, 0xb8c936ded2ebc649,
+    0xd2453981f1ced4b5, 0x2bc8de9764d1f523, 0x3d81ba654ec5138f, 0x7a2845965dc732fb, 0xc43deb287cdb4169,
+    0xa236bcd878ab4fc5, 0xc3eaf18ba8bf7e43, 0x1327a8fed5b27c9f, 0xacb792e1f4c59b1d, 0xba79361213d6cb79,
+    0x89c36a5432bac9e5, 0x3fe29c5651bde963, 0x159d4b676ea217bf, 0xb397c85a9eb5273d, 0x13e5ad6cbdc735a9,
+    0x197543dfeacb6517, 0x7a2e4381f9bd7483, 0x73fcd892169e72df, 0xa4d8691547b3a15d, 0x8bf7e9a65384afb9,
+    0xeac9354763a8ce27, 0xb962dc48718aed93, 0x3b2a71487c6bdaef, 0x3c4e72adce912b6d, 0xb5347891fc843ad9,
+    0x584f79621db85a47, 0x612acdb32c9a68b3, 0x752a3e8657ad9831, 0xe6c83297647f958d, 0xd17e5a2ba582b4f9,
+    0x2793b8cdc2a5d367, 0x2b4c5e7dc198e2d3, 0x74c1d65ede8bf251, 0xb3caf7243f7e21ad, 0xc45de2365d824f1b,
+    0xca182fb65c934e87, 0xf8b1da365a876ce3, 0x1e7f856cb97a8c61, 0x94a52d6ba45c79bd, 0x7982b5ced46fa93b,
+    0x2d35fa61f362d8a7, 0xcd685e432396e815, 0x92b167a54279f681, 0x28793bf54f6a15ed, 0xbcd837498d7e245b,
+    0x43c9156bad8153c7, 0xfb13942edc968235, 0x4cd297afeb6782a1, 0x3e1ca7fdc5487efd, 0xd7a16be2154c9e6b,
+    0xb175e9c3234facd7, 0xac3b4ef98372ec45, 0x514ad6898265fab1, 0x8c61294a9e581a2f, 0x869d27abae4c298b,
+    0x924cfe3dcb4d38f7, 0x267c4bf1fc416875, 0x4f1de6832b5486d1, 0xd8c1ebf32a37954f, 0x5f1b74d6564893ab,
+    0xf5a23d79865dc329, 0x7df3186ba34fd195, 0x4d3fec1ba253dfe1, 0xe9d71a2cbd361e5f, 0x3e268b71fd372ecb,
+    0xfcadb6921e2b4d39, 0xe5938bf43b2e4ca5, 0x4fc51eb87c528b13, 0xa2954f376a23897f, 0xfe395c1ba62597eb,
+    0xf8214b3ed42ac759, 0x16ae524fe32bd6c5, 0xa325df9ed12fe643, 0xae8d52976253149f, 0x28694fa76f27341d,
+    0x635b9ce76e1a4279, 0x72b138a98c2b61e5, 0x1bf248da9a1d7f53, 0xe9b21dfcb8217daf, 0x415cdb7fe7149c2d,
+    0x4769d521f415bc89, 0xa9cb61e32418caf5, 0xb59d43c6541cea73, 0xd43b5a26521de7cf, 0xb12f35e87ef1284d,
+    0xfda214798df436b9, 0xb837254cbcf95627, 0x7b25adcedafb7593, 0x784932fdc6db73ef, 0xa6d3cf9217ef926d,
+    0x4a7c968546f3b1d9, 0xb4cd1af764e5cf37, 0xb8d953a762f7dea3, 0x2d147f8983eafd21, 0xf72183498fbe1c7d,
+    0xfca8293bacd13be9, 0x9f85ace1fce34b57, 0x5d1b9c321be769c3, 0x1c729eb43aeb8941, 0xe1c3f85435ec869d,
+    0x9631e45875dfa61b, 0xfd65c41ba5e2d487, 0x9eca867ba2c6d4e3, 0x7be91f3dc2d9f361, 0x2ad9534fefca12bd,
+    0x25f6ed432fce413b, 0x7f286bc43dc14f97, 0x5bfde3765ab46df3, 0x41fb92865ac68d71, 0x3b426fc765b87acd,
+    0xe51bca2985cd9a4b, 0x7ac19f4ed3afc9b7, 0x6ce58271f4c3e925, 0xa9452ec323c5f791, 0xdc62e34542b816fd,
+    0x84be6d954fac256b, 0xfb6d4ce76cae34d7, 0x1358d26badc18345, 0xc2d6bf9edac583b1, 0x5a7d9b4ed8b7912f,
+    0x4ce173afe4a89f7b, 0xc7a49f52148bade7, 0x7d8e69f3239fcd65, 0x2e1f85476493fbc1, 0xeb2f53a982a61b3f,
+    0x49cdf3a76f872a9b, 0xfe69547cbe8c4a19, 0x1a67bd2edcae4985, 0xc53498e1fba287e1, 0xa17e93521ba3965f,
+    0xfe24a973278694cb, 0xa84d35b6568ac439, 0x32ed9618748cd2a5, 0x7d46ce2ba59fe213, 0xfcb92e4dc3a4217f,
+    0x82c1e3fbae752fdb, 0xef829d61fd783e49, 0xb7a98f321e7a4db5, 0x491f2c854b8e7c23, 0x892b7df54b617a8f,
+    0x1fd3ecb6576398fb, 0xfda3514cb475c869, 0x38712dacb369c7d5, 0xf12b469ed28ce753, 0x7fa346bdc16de4af,
+    0xe628fd976194352d, 0xbef1a2d32f764389, 0xb9726c454d7962f5, 0x8f6dce2a9d6c8173, 0x6a9527d8784c6ebf,
+    0xfbe38a7cb8619e3d, 0x3b76529fe653bda9, 0xb4ce9a61f456dc17, 0x3ca876f21459eb83, 0x6189b3d4324ae8df,
+    0xc35defa8726f195d, 0xbea365d98f5237c9, 0xfb6e7d9cbe465837, 0xb27e56adcd4976a3, 0xd5a768efeb5c9621,
+    0x76d2c3f1f84e937d, 0x7a5893c43851b2e9, 0x813b29f43964d157, 0x15e3a9f87546dfb3, 0xea7df8598459fe31,
+    0x5be24c9a924b1e8d, 0xde263c198d3e2cf9, 0x89a5d12ede324c67, 0x5a67c8f1fc256ad3, 0xb9a426132d398a51,
+    0xea7fc214392b87ad, 0xecb9a576583ea72b, 0x5932ef7ba831d597, 0xf2e7196ba724d5f3, 0xba2c364dc538f471,
+    0x7165e3afe24913cd, 0xb456c3efef1d324b, 0xe25a39f43e2f41b7, 0x3bd894176d237f15, 0x96e84c276c257e81,
+    0x8a7d94f659167bed, 0x578bc6d9871a9c5b, 0x49231c5a951ebac7, 0xf1784baed721ea35, 0x6a287b1fe524f8a1,
+    0x27c386b54537281f, 0x5d231c76531a267b, 0x47e3ac154dfb35e7, 0x5b2eca698cfe7465, 0xb836495a9bf284c1,
+    0xaed2853cbae5923f, 0x724b356ed7f6a19b, 0x93cf51edc4d8aef7, 0xe5b93f7214fbce75, 0xc91fa53434bfecd1,
+    0x9c41fd7875e31c4f, 0x579fd1a871f52cab, 0xac6e54287fe84b29, 0xbc8457698dec4a95, 0xeb18f4acbacd68f1,
+    0xc31ad5bfead1976f, 0x4c9d7b3218e395db, 0x49f7d1b328e7c549, 0x6d379ba546e9d3b5, 0xa67d3bf986dce423,
+    0x1a534b7873bde18f, 0x27ed956ba2d431fb, 0xbdaf368cbec63f59, 0x5d4f27c1fdb84ec5, 0xb3e14fa21ecb7d43,
+    0x8f5a27e328ad6b9f, 0x9821b5a658c29a1d, 0x925e71b656d3ca79, 0xd12c549a94b6c8e5, 0x269a4f5cb4cae863,
+    0xf5c36a2dc29ae5bf, 0x14bdea5fe2bf163d, 0x7a9f5e8651d234a9, 0xfeb67d543fc86417, 0xa7c259f65eca7283,
+    0xe5ca7df65b9a71df, 0xfc123b47679c8f4d, 0x29a568bdc681aeb9, 0xad95283fe6a4cd27, 0x3b65fa81f4a6ec93,
+    0xc7643ae21387d9ef, 0xceb3f1a5439c1a6d, 0xf9d7c3b651af28d9, 0xa3615f798fb25947, 0x79e1c5fa9ea567b3,
+    0x58f3b49dcdba9731, 0x1e36a85fea7b948d, 0x5143692fe67da3f9, 0x3cb12ef439a1d267, 0x6e32d9154795e1d3,
+    0x8163de576597ef41, 0xe685cb1763781f9d, 0x97cf31da928c3e1b, 0x96271aebae6f3d87, 0x479ab1cdcd826be3,
+    0x8bfae561fd958b61, 0xf39b84721c5678bd, 0xce741bd3296ca83b, 0x983b2154385ec6a7, 0x875da42ba892e715,
+    0x7512683cb694f581, 0xaf7de82cb38714ed, 0xca4b895fe18a235b, 0x5c1d62bfef6d42c7, 0xfed514732e8f7135,
+    0xfe8c63d54d637f91, 0x85d29ea43a547cfd, 0x9f2e1bd65a479d6b, 0xd817fe598649abd7, 0x85de961ba76edb45,
+    0x7bc683aed562f9b1, 0x9c1edb6fe475192f, 0x6eb51d821356278b, 0xb7f9d1a5415a36f7, 0xb45c13298f3d4675,
+    0xaed82f698c4f75d1, 0x47a6528bac62934f, 0x6bd4a35edc4592ab, 0x52849cdfea58c129, 0x872cde1fe63acf85,
+    0x548abe73264bcde1, 0xb41736a547621d5f, 0x19fed7a873542dcb, 0xd8425f6ba1574c39, 0x6184fda98f294ba5,
+    0xb6a3194cbe4d7a13, 0xc3674fedcb2e687f, 0x5b8a2c61fa3296eb, 0x6dca7be21b24c659, 0x7c1b6fe43928d4c5,
+    0x63f41e78782be543, 0xa91dcb48753ce29f, 0x41db5e9cb762431d, 0xf95428ced2354179, 0x37629f4cbe174fd5,
+    0xed5a89b1fd1a7e53, 0xc8fd49e32d1b6caf, 0xbe81a4954a1f8b2d, 0x5b14e2f65a12cb89, 0x1c563d487814c9f5,
+    0x84bdf16cb618e973, 0x89dacf2ba419e6cf, 0xe56baf7dc52e174d, 0x83564da1f42135b9, 0xef78b54983146527,
+    0x7a5f2ce32ef67493, 0x18ecaf354bd872ef, 0xcd71ea365afb916d, 0x83419fd656ed8fc9, 0x7648ad9ba8f1ce37,
+    0x279feabcb6f4eda3, 0x9a8fb36ed5e7fc21, 0xf7c4268324f91b7d, 0x9dbfa2c543fc2ae9, 0x5e19328761ef3a57,
+    0x93e26da87fe268c3, 0x65a7124bade69841, 0xd6e1c75babe7859d, 0xf5dc679ed8eca51b, 0x43b2cf91f6dec387,
+    0x81a934b548c1d2e3, 0x93748c1548d5f261, 0xc4f159d765e721bd, 0x3a2f97c874d93f2b, 0xa4731f5981dc3e97,
+    0xba8e1d498dae5cf3, 0x95bd6e4cbed38c71, 0x2af86751fab479cd, 0xbfac58321cd7a94b, 0xf8756b9326dac8b7,
+    0xc38b764547bed825, 0x265bc3d987c2f691, 0x48c325ea96b415fd, 0x51b632adc3d8246b, 0xe569483fe1ca43d7,
+    0x74b9e2afefbd7245, 0xe8a625b43eaf72b1, 0x193cde854ca38e1f, 0xc375fba43ca49e7b, 0x9f8a7ec54896ace7,
+    0x76fb2419879adc65, 0x8dce643a958deac1, 0xa6783fbed6b21a3f, 0xba6c4fe1f3c4289b, 0x16e5f84323c74819,
+    0x85ebd63431cb4785, 0xcfe986754f9c76e1, 0xed86b4c76c9e845f, 0x4cdae2187d8293cb, 0xf1bad54edba6c239,
+    0x67dae39fe798d1a5, 0x54c6ba8ed579cef1, 0x45f63712147bed6f, 0xc6349da545812edb, 0xb16e57a872a53d49,
+    0xb4a5f1c981974cb5, 0xc36d7e2a9f8a7b23, 0x3f5c98dbad5c698f, 0x347e5bfdca5e87fb, 0x74cd2b51fb82c769,
+    0x9fb4a7d21a84c6d5, 0xc72684a32a89e653, 0xd1632e854569e3af, 0x9ce3f87a968e142d, 0x18c3a62dc5a14289,
+    0x43bac81dc29461f5, 0x8ce6253dce587f63, 0xd5873e9fec486dbf, 0x851e7b321e5b8c3d, 0x1697e5d32b4f8ca9,
+    0x9a78cb365a63db17, 0xaf1d57287965ea83, 0x6f7d231a9546e7df, 0x3542e86dc46b185d, 0x372f58aed35e26c9,
+    0xf7895ad1f2915637, 0xba96dcf3218475a3, 0x769f41b54f689521, 0x58c19e465e4a927d, 0xdc21b6376b4ca1e9,
+    0xf5478da9893ebf47, 0xed9cf27ba852deb3, 0xe321645dc856fd31, 0xdc967251f5471c8d, 0x1f6ce472154a2bf9,
+    0x1fb278a6524e3b67, 0x1d4bacf9825169d3, 0x741298cbaf348951, 0xe18537ba9e2586ad, 0x25af341dcd39a62b,
+    0xe34a798fea2dc497, 0xa73d691ed82ec4f3, 0x216489a32a54f371, 0xfa528176584612cd, 0x5cf374b98759314b,
+    0xb7e53df9842b3fa7, 0xfc21987ba23d6e15, 0x8b4f5aecbf327d81, 0x567ed1acbc137aed, 0x2b3ea651fd169a5b,
+    0x5419bd832d18b9c7, 0x284e3ca54a1cd935, 0xc1839476582fe7a1, 0x83e6afdba934271f, 0x1af642cdc816257b,
+    0x9fe4c57dc51934e7, 0xb16cd2efe21c7365, 0xef5a3d4cbefd73c1, 0x81d297a32cde813f, 0xf3c2e8743ce29f8b,
+    0xc17d3fb439e4adf7, 0x9be386c549f8cd75, 0xead36c9876f9ebd1, 0xac1d7f5985dcea4f, 0x5d9f327ed5f129ab,
+    0xa2895b6fe3f54a29, 0xb1e7349212f74895, 0xcd3a6e4542ea67f1, 0x3c5d2f943edc856f, 0x453291865acf84db,
+    0xed4256c98be2c349, 0x3f61c97ba9e6d2b5, 0x95cf387dc8d9e123, 0x5437a8fdc4b9de7f, 0x249f751325ac1feb,
+    0xb9f3cae546d13e59, 0x93a2ce6872e34dc5, 0xc1f869ba91e87c43, 0x859af3165ec86a9f, 0x4b19eca87ebc891d,
+    0xb2a1d75edacfb879, 0x542bd8c1f9b2c7e5, 0x3d14e6521ac5e763, 0x4ebc2d9326a7e4bf, 0x43bf2ed767cb153d,
+    0xe61f43c875ce23a9, 0x8ae6714cb5d26317, 0x24e83c5dc2d57183, 0x4d315cabad956ecf, 0x5a7bc381fca98e4d,
+    0x17854e321e7c8db9, 0xbe836fc43a9fbc27, 0xd32fb1e658a2eb93, 0xae2b97865694d8ef, 0xa74158fba5b8196d,
+    0xc619485dc4ab27d9, 0xd76a42ced2be3847, 0xbc6f94a1f2c176b3, 0x3eba274542c59631, 0x2b59d6732fa6938d,
+    0xa2c974f54d78a2f9, 0xf89c51b65b9dc167, 0x8cbad937687ebfc3, 0x52b97a8cb893fe41, 0x498efbcdc6851e9d,
+    0x6d72fe51f5983d1b, 0x5813e642149b3c87, 0xf6bd7825428d5ae3, 0x23dfa9b873b28a61, 0xfb142ce65f6387bd,
+    0x57132bca9e86a73b, 0x6b4d785cbd69c5a7, 0x83abe92fea8cd615, 0x46813daed97fe481, 0xf6157293298413ed,
+    0x463da1e54897325b, 0xf624a317658941c7, 0x96715d2a938b6f25, 0xe4df2a3ba27d6e91, 0x24386cda9e517bfd,
+    0xc93f82dede539c6b, 0xd832f9a1fc45bad7, 0x7b38df621c69da45, 0xbec61a54395ce8b1, 0x67b84d95485de72f,
+    0xe14698cba973268b, 0x8452fdecb48635f7, 0x23a98c4ed28a6475, 0x4b9dec5fe26b74d1, 0x26bfc4edce5d824f,
+    0xab6f8c343f5291ab, 0xfa392c743d54bf19, 0xfa6d43854b36ce85, 0xea1d6f376948dce1, 0x3d8b6f29873aeb5f,
+    0x248e5b1a964f1acb, 0x6c329abfe7624b39, 0x85493e21f23649a5, 0x1659c2f3245a7913, 0xfbe3c695413b867f,
+    0xad68b9f54f2d85eb, 0xfb618e598e31c459, 0xcf1d894a9b24d3c5, 0x53481b7dcb58e243, 0x597a326dc738e19f,
+    0x7658a391f85c321d, 0xcd64f372173e2f69, 0x8a31de2767324ed5, 0x47bf52ca94267d53, 0xb5736d4981276baf,
+    0xd62ac5787f1b8a2d, 0x2cfdb6a87d1eba89, 0x56f2d13edb21c8f5, 0xca876351fb14e873, 0x42ef7ac32916e5cf,
+    0x8b3fd5c6592a164d, 0x6549def7671d24b9, 0x2cd1f47ba81f5427, 0xba234f1dc6147293, 0xe1d4f95cb32571ef,
+    0x4629f3cbace68f5d, 0x25bf7c4edbf78ec9, 0x3cd7f8121afcbd37, 0xd81564e328efdca3, 0x2ad59ef769e4fb21,
+    0x23c5daf768f51a7d, 0x9e6f158ba5f728e9, 0xfe18da9cb4fc3957, 0x489372bcb2fe57c3, 0xad586b3fe3f29741,
+    0x5dcb76a321f3849d, 0xd1ba92643fe7a41b, 0x3bdc41a54deac287, 0x1d284ec769dbc1e3, 0x459b7c1878bedf51,
+    0xeb16f47a97c31fad, 0x9468751dc7d63e2b, 0xecf69d81f4e83d97, 0x3fead5c214da5bf3, 0x9df2b8a543de6b71,
+    0xadb4f8e652e178cd, 0x5ea149276fd3a84b, 0x5e348ac98ed5c6b7, 0x1564cf7a9bcad725, 0x3c9d45bed8bce591,
+    0x63a19d8cb69ce3fd, 0x7c5dfb8219d4236b, 0x6a8e97d438c642d7, 0xacd8b2f986da7145, 0x467b9d2873cb6fa1,
+    0x3bf65d4982ac7d1f, 0x34ad2b898fa19d7b, 0x5fb28a3dcd93abe7, 0xa64f8ce1fca7db65, 0x71ab56e32ba8e9c1,
+    0x2eda4fb3279be83f, 0x84ec392546af179b, 0xac734e9ba8c34719, 0xa21d765cb3c74685, 0x79efa56dc3b975e1,
+    0x629583ced1ab835f, 0x92b15cdedf7e82cb, 0xe7c198a54fa2c139, 0x268dcbf32d83cf95, 0xc6a28d354a86cdf1,
+    0xe78dcb954978ec6f, 0x54d3b129867a1cdb, 0x3b5f1decb68f2c49, 0x7c8246dfe6924ab5, 0x6da74eb1f4b67a23,
+    0xb48739c212a9678f, 0x527139a4317a86fb, 0xb15a93f43f7eb569, 0x42af73187e81c4d5, 0xc79351ebac96e453,
+    0x65328eacb976e2af, 0x39d8216fe98a132d, 0x864f3d21f67d3189, 0x89f6cdb2167d3fe5, 0xb968dea545927e63,
+    0xb8c491d652746cbf, 0x985436da91678b3d, 0x1d6452c76f4c8ba9, 0x479158da9d5eca17, 0x248c9f5edc61e983,
+    0x93c8be7dc953e6df, 0x4a952e832b68175d, 0x63dec714386a25c9, 0x81a9b547698d4537, 0x437d621a957f64a3,
+    0x5f13697dc6859421, 0xb14a5e8dc265917d, 0x832b4facbe368fd9, 0x6ef3b921fd3abe47, 0x485da7621a4ecdb3,
+    0x3d54f1a65b62fc31, 0x2c34e9b76a541b8d, 0x524976d878462af9, 0x28c64e9dc84b3a67, 0xb567f4dcb64c58d3,
+    0x3b785d2ed34f7851, 0xda986c21f14285ad, 0x61a78ce43146a52b, 0x698ade154f28c397, 0xeb423c876d4ac2f3,
+    0x53dfec898b4de271, 0x275cd6fa9a5321cd, 0x2875a91dc9452f3b, 0xca8f54ded8263ea7, 0xa69fdc51f73a6d15,
+    0x5a27e163253d6c81, 0xd71a3f65432f69ed, 0x2eb39d587132a95b, 0x45dabfc76f14b8c7, 0xacde971bae19d835,
+    0x59c734ea9c2be6a1, 0x783f52bcb92ce51f, 0x6c584b31fa31247b, 0x47dc9bf32a1543e7, 0x98edf4354a197265,
+    0x6bd2ae39863a72c1, 0xc51a8649841b7e2f, 0x6bc8f39a921f7e8b, 0x46c1e7598de1acf7, 0x8439e1ababf3dc75,
+    0xc378542dc9f6ead1, 0x78cb4d321ad8e94f, 0xda61ef2437fd18ab, 0x47ea1c2657ef3829, 0xc1e8452ba8f24795,
+    0x795a238ba4e576f1, 0x139deabcb2e9846f, 0x3642e9adc1fa83db, 0x753cb8fdcfdeb249, 0x25e9fab43fe2d1b5,
+    0xb8afce754bc5df13, 0x1e5b62f439b5ed7f, 0xb32d75c657c81deb, 0x1d3e2a5987ec2d59, 0xcd45e9ba96df3bc5,
+    0x549a8bced6e27b43, 0x9bd2a34fe2d4689f, 0x8fe1574323e7981d, 0xa67f31b431ecb679, 0x718fd3643fadb6e5,
+    0xd3f276498dc1e563, 0x417cb3d879a4e3bf, 0xb5a4931cbac8143d, 0xa74d29efe7db32a9, 0xdcf75361f8cd5217,
+    0x3ad76ec216be5f73, 0x2791e58434a26dcf, 0xadb6839762b58c4d, 0xd1cb297651d68cb9, 0x1df4c3e76f9acb27,
+    0x96ea17d87c8eda93, 0x5a19f6bcba91d7ef, 0x94d7ce61fab4186d, 0x7bfd4e321ab726d9, 0x82e59fc329cb3647,
+    0x73adb89547ad65b3, 0x413fdc9a96bf8531, 0xe98c1f6ba4b3928d, 0x53ea876dc2b5a1f9, 0x835269adce98bf57,
+    0x7bdf9ae1fd79bec3, 0x5a4c78132b8ced41, 0x26d17ab54b821c9d, 0xc38f94d76a953c1b, 0xe345c1d659a63b87,
+    0x67b4e2fcb68a59e3, 0x19a8e7cdc4ad7961, 0x7a29e4fdc28f76bd, 0x36cbfe71f192a63b, 0x964c5ba32195c4a7,
+    0x36f79a843f89d415, 0x129a5e365d7be381, 0x4c51e8a6596bf1ed, 0x63e829abac92315b, 0x6aef43cdc9843fb7,
+    0xdf7946aed7986e25, 0xfb946731f47a6d91, 0xe3c19f52135b6afd, 0xd39ef614325f8a6b, 0xb85724f65162b9d7,
+    0x3e6cd4a98f76d945, 0x235e6c4a9d58e7b1, 0xed1c382a9b5ae62f, 0x315bcd8eda6e158b, 0xa53bd72fea8134f7,
+    0x348d5ac21b946375, 0x9e2afb15496873d1, 0x24f3b1e8756a814f, 0xc9fa6b17624c7f9b, 0x8e17d329825fae19,
+    0xa295167baf42cd85, 0xf4e8cd2bac45dbe1, 0xab54736edb37ea5f, 0xdabe7c932d4a19cb, 0xca2b41d54b5e2a39,
+    0xaf1c4b987b6148a5, 0xba58e43cba657813, 0x84dbe3acb436857f, 0x1623cb8dc23984eb, 0xceb5871fe14db359,
+    0x86bc37aede3fb2c5, 0xa59d81c32f65e143, 0x261e83b43b24de8f, 0xa24fb5d65a371efb, 0x79dca3487a3b2e69,
+    0xc74153ba982e3cd5, 0xc87234fed9417c53, 0x45bf9a1ed52369af, 0x763d9b21f436892d, 0xb58fe742132ab789,
+    0xb8da9e65412cb7f5, 0x2537abd65e1fd673, 0x51247bf87b12e4cf, 0x96a5f7ebac27154d, 0xc86f4d2edc1823b9,
+    0x341e69afea1c5327, 0xc53ead71f82e6193, 0x26f3a85437216edf, 0x4f39a1d546138e5d, 0xd825a19763158dc9,
+    0x21ca87398219bc37, 0x6ecf84176ef9dba3, 0x82b31c598bfdea21, 0xef36a85dcbf2197d, 0x28bd415edaf427e9,
+    0x3fca91621bf93857, 0x24db6ae328fa56c3, 0x45e2bac657fd8641, 0x2acd64b764ef739d, 0x4bcd259a95f4a31b,
+    0x98ab54ecb2f5c187, 0x5b31f7ea9ec7bfd3, 0x2965be81fbcade51, 0x13f4dbe2189bfcad, 0xdbf843165ae13d2b,
+    0x7a58e2c65ae43c97, 0xfa312eb768d75af3, 0x521cf96a95eb6a71, 0x97ce132a93eb67cd, 0xae5fbc4dc2df974b,
+    0xf8c3e921f1e2c5b7, 0x679f1e2431e7d625, 0xf25679843fc8e491, 0x3cb7d1e54ba9e2fd, 0xb7dac9e87ace126b,
+    0xc2fe184a9ac241d7, 0xb3d7941cb9c46f35, 0x86a49dbed5c76ea1, 0x5d1ba27fe4b97c1f, 0x68ac319213ad8c7b,
+    0x9c7deb6432bf9ae7, 0x613d5ac871c2da65, 0xdbf168476fa5e8c1, 0xd51e62976ca8e73f, 0x8b5d7ec98dac169b,
+    0x4d789a2edabe3619, 0xc7bad241fac16485, 0xcf5d87e329b574e1, 0x68791f2436b7825f, 0xa98ecd3654a981cb,
+    0x184db3e7638caf29, 0x214b73f8718fbe95, 0xeb8915fa9e83dcf1, 0x27698e4bac84eb6f, 0xfb865a41fc871adb,
+    0x371e85f21d8c2b49, 0x9a7ce1b32a8e39b5, 0xd8e453276ab17923, 0xf175c4ba95a3768f, 0x3f675d4ba39685fb,
+    0xfa48d96ed28ab469, 0x49518b3fe18cb3d5, 0xac726fedce8fd253, 0x7cf8ab932d73e1af, 0x4a152f765e97312d,
+    0xb1d49e354c682f79, 0xb3d2e157697a3de5, 0x9d6f7caba98e5d63, 0x9721c53dc5716abf, 0x37e819dfe5748a3d,
+    0x5c92f4d1f265b8a9, 0x8edca9f3236ac917, 0x96fcd4b5416cd783, 0x5ea298d43b4ec5df, 0x3f9524ba9e83165d,
+    0x295a684bad7624c9, 0xb6f23dcedc8a5437, 0x78bc645fe97c62a3, 0x694fc3e1f97e8321, 0xedf689c327518f6d,
+    0x82dab76324538ed9, 0xd2b48ea98256bd47, 0xf3e16bc87158dcb3, 0x6abc21d98f5ceb31, 0xd97a14387b3ef98d,
+    0x34a759fedc5328f9, 0xc67e4b51fc453967, 0x8c5734b21b4957d3, 0x9d1528343a4c8751, 0xc5ba3296563e74ad,
+    0xd284165a9761a42b, 0x6a387b9cb354c297, 0x95ab16fcb257c1f3, 0x9fa1b32cbe39df61, 0x71eb4c6dca29febd,
+    0xe7d581b32c4f1e3b, 0xb1f4ca265c423da7, 0xc652d7498b376c15, 0x9d5a74187a396b81, 0xf573b4da952a68ed,
+    0x2b3ec74dc42e985b, 0x5794c21fe431b6c7, 0xae4fdb91f124d735, 0x2d4a39654237e5a1, 0xec4312b65d29e41f,
+    0x6ef2cb476e2d137b, 0x6c8bfd298b1f32e7, 0x83b6d59cbc237165, 0x1fac835dc9256fb1, 0x2746e83dc6187d2f,
+    0x8a4f72b1f41a7d8b, 0x5e74b8c3241d9bf7, 0x521ad8476421db75, 0xf9e6b5187324e9d1, 0x6d82ae176cd5e84f,
+    0xf6b38da76df817ab, 0x28fe6a3babfc3729, 0x7e632f5dcafe3695, 0xd429758ed9e275f1, 0x4b8dac5219e4836f,
+    0x76ad93b435f682db, 0xedc5a41765fab149, 0xfce9315762ecbfa5, 0xf5bc18d982dfce13, 0x8376adc98db2ec7f,
+    0x3b19f7da9ad51ceb, 0xb4693ea1fbe82c59, 0x3eadb86219eb3ac5, 0xd79cb48329de6a43, 0xce413a9548d1679f,
+    0x184f63e986e4971d, 0x431acf2ba3e6b579, 0xd75824eba2d9b4e5, 0x48dba21cb1ecd463, 0x6e4c5a9bac9ed2bf,
+    0xf8b4c7254fc5123d, 0x28cd73954ed631a9, 0x6ea3f8454ab83ef5, 0x46591f8769cb5e73, 0x97ac25d8769d5bcf,
+    0xfd58a71ba6c18b4d, 0x5a8b312fe4d38ab9, 0x5fbad7c1f3d6ca27, 0xa35b76f212cad893, 0x61f27dc4319ac6ef,
+    0x75216c843c9ef56d, 0xb4d6a2787eb325d9, 0x3178f92badc83547, 0xa3b6d85edac964b3, 0xab49125fe9bc8431,
+    0xfd58cab1f5ae718d, 0xfe82d94325a18fe9, 0x6ce87d1324a3be57, 0x392ac7465296bdc3, 0x3ef94d2872a9ec41,
+    0xdbea49565e6bfa9d, 0x6d594eba9d8f2a1b, 0x4789615fedb23a87, 0x259ecbd1fba658e3, 0x56718ed32cba7861,
+    0xfae5dc23268a75bd, 0xdf8716c5468e953b, 0x5af37d898591c3a7, 0x9846f15cb4a6d315, 0xfe64238dc3a7e281,
+    0x162c47ba9b57efcd, 0x98bea67fed7c1f4b, 0x43a86d121c6f2eb7, 0x7c1e9ab54c936d25, 0x27eaf3154b856c91,
+    0x4acf23d5485769fd, 0x7f32d19ba45c896b, 0xfa23b67cb35ea8d7, 0x23514e8fe391d845, 0x48b9efc1f284e6b1,
+    0x7a396d143187e52f, 0xf2b387a43f6a148b, 0x83495da65d6c23f7, 0x1943d85a9c8f4275, 0x3d9c4afbab8472d1,
+    0xdf79e65cb9657e3f, 0x1f5adc9ed5467e9b, 0xe53a76b1f45bad19, 0x874cf532134ebc85, 0x9e7da1c65462dae1,
+    0x456ef3987163e95f, 0x1ab723e87f4618cb, 0x39de2a6bae5b2839, 0xea73d69cbc4d37a5, 0xa2d3fb1edb5f6713,
+    0x51a2c86fea52847f, 0x3475bc92194583eb, 0xadfe37b43748b259, 0xaf53c198764ab1c5, 0x83251ef9845dcf23,
+    0x8c56b92a9241ed8f, 0x89fb2d3a9e341dfb, 0x268f4eadce372d69, 0xdeab2471fc293bd5, 0xd6751a421c2d6b53,
+    0x39b7ca24392e58af, 0x1bcef8276a43982d, 0x487af23ba724b689, 0x6e4c35dba428b6f5, 0xe5f3a9cdc42bd573,
+    0x57e2689ba12bd3cf, 0x67d89aefef52134d, 0xcbef34254f1532b9, 0x32e8abd76e395127, 0x5daec9b76c1a5f83,
+    0xa1cd23f7681a5cdf, 0xe67243ca981f7c5d, 0x319ab82ed6128bc9, 0x93c4eb2fe615cb37, 0xf76b4281f417d9a3,
+    0xd47f21c5453be921, 0x317b8e25421cf67d, 0x7ae149654cdf16e9, 0xfe279c4a9df23657, 0xe9b4c28a9bf765c3,
+    0xf27cab5dcbfa8541, 0xa72f589dc6fb729d, 0xac1bf9ded6fe921b, 0x51ed9a7325e1bf67, 0x2f7581a325f4bed3,
+    0xc24165d763f7ed51, 0xa82543f651e7fbad, 0x21b475387fed1c2b, 0x1542ae698cdf2b97, 0x68ce972dcbd259f3,
+    0xd259b361fbe56971, 0x7fa6dc1219e876cd, 0x5b8247f327ec964b, 0x2395dbc435dea4b7, 0x2143e8ba97e1d425,
+    0xe487c26ba4d5e391, 0x982146fa92b6e1fd, 0x6bea128dcfda216b, 0x9513482fedab2fc7, 0xed783c521cbf4e35,
+    0x96bfe7d54bc36da1, 0xc8b3f26549c57b1f, 0xd9e68ba545d68a7b, 0xb9254de764cba9e7, 0x87fe5a1ba3bec965,
+    0xc574d12ed4b2e7c1, 0x1a2cf69ed1b4e63f, 0xf63dba8432d7159b, 0x6cf4ed954fcb3519, 0xbfae6c476ebd4385,
+    0xef3b16487baf63e1, 0x64cfb82a9ab3815f, 0xe15bac9dc6947fab, 0xbc7965aed5b7ae29, 0xd936e281f38abd95,
+    0x9574bdc3248dcbf1, 0xd437cfe54391ea6f, 0x934a8ed762a419db, 0x2413ed976fb72a49, 0xba39d7f87e9a38b5,
+    0x7db64a5cbcad6823, 0xbf41978dca9e658f, 0x8baed29fe79284fb, 0x9761e5d218a5b369, 0xcb561ea43698b2d5,
+    0x67bca3f8769bd153, 0x4afdb256526bce9f, 0xe156df2ba4932f1d, 0x3b569e8cbf842e79, 0x7b6342acbd873ce5,
+    0xda7435b1fd8a5c63, 0x38be94d21a6c59bf, 0x1fa968d32a6f793d, 0x1a472df54862b7a9, 0xdea4615ba695c817,
+    0x5aeb37dcb479d683, 0x4c3a69dba269c4df, 0x251f7b3cb17cf35d, 0x62341d5fef7123c9, 0xbc5ea3d21f965237,
+    0xfa2e1cd54e7861a3, 0xcd89f3b43a485def, 0x51e8ab26594b7e6d, 0xf5eb6d19864f7cd9, 0x9842f6ded862bc47,
+    0x1cd2658fe465dab3, 0x63df8a41f468ea31, 0xea761952124af78d, 0xa8b269d5425d17f9, 0xe3bc94fa9f513867,
+    0xf8c956ea9e7456d3, 0xd437815cbd498651, 0x752eac3dcb4973ad, 0x1a5b26cfe85d932b, 0xab82617fe64fb197,
+    0xde6458321752bfe3, 0x753918b43745de61, 0x23f478e65236fcbd, 0x4da123b9825a1d3b, 0x8743ba198f3e2ca7,
+    0x576fbcedce426b15, 0x7d3ba84fed346a81, 0x2c7bf341fa2567ed, 0x37b915421c2a975b, 0x2d9efa84382da5c7,
+    0xa4e7bf28782fc635, 0x24c7deba9753e4a1, 0x8f65a94ba546e31f, 0xf5b83aced349127b, 0x892c13bdcf2b31e7,
+    0x9671582fec1d3f45, 0x83ef9bc54d326eb1, 0xed47a9f65b147c2f, 0xc32b86754a157c8b, 0x875c23b656189af7,
+    0x4bf1d65a961dca75, 0x7d82f91ba52fc8d1, 0xc839147dc512e74f, 0xdc732581f32516ab, 0x9c473156541a3629,
+    0xdeca58232efb3495, 0xde7125365bec64f1, 0xbe3781f65ade726f, 0x3ce569d879f381db, 0x46d1ebacb7e5af39,
+    0x5824c3adc4f7bea5, 0x24d9e5afe5facd13, 0x16ed35b213ecdb7f, 0x9547821654f21aeb, 0xb3419ac871f42b59,
+    0xcae528d76fe739c5, 0x1a27e4698deb6943, 0x1cfe48b98adc569f, 0x54d3be8cb9cf861d, 0x268573f1f8e2b479,
+    0x5a73c8b218d6b3e5, 0xe47fd16547e9d263, 0x27d3ecb654c9d1bf, 0x4563bf2763abef2d, 0x692de45ba3d12f89,
+    0x9e12bd3a9eb43df5, 0xad43f76cbec85d73, 0xb582a47fe9b85acf, 0x96e5cdf219bc7a4d, 0x2469e1c326cf78b9,
+    0x7b24c5f658d3c927, 0x6f42a75986c5d793, 0xa7eb534983a7c5ef, 0x6cd3579a92baf46d, 0x947cafedc2be14d9,
+    0xe3d9c61fefc15347, 0xf9d7be621fc562b3, 0xa4bf93d65ec98231, 0x83a2cb643ba96f7d, 0xb6e4f2d5468b7de9,
+    0xc1f8bd79869fad57, 0x16e84cfba692dbc3, 0xcbdfa98ed5a6eb41, 0xd5e92b1fe2a6f89d, 0x6d8fb71434ac291b,
+    0xe9f1827541be2987, 0xc1edf2876fa157e3, 0x357b6c4a9eb48761, 0x543e87a98c9674bd, 0xb9d654fedc8a943b,
+    0x268d7e5fe68db2a7, 0xca82d31fe79fc215, 0x15f68b932693df71, 0x6719cd432374fecd, 0x264af3e763981e4b,
+    0xb4e8c217618a2db7, 0x6b542f1a9f8e4c25, 0x8bca476dce826b91, 0x6a3fc4edcb7368fd, 0x7e4d6c31fc75986b,
+    0xa6d3ef421b59a6d7, 0xec651d93298dc745, 0xa1efc3d5467fd5b1, 0xc68fbe7a9683e42f, 0x5f16327dc496138b,
+    0x3589cabdc18932f7, 0x1598b76edf8c4175, 0x7914acbfeb6d5fc1, 0xfea871c32c617d3f, 0x7eb581a32c537d9b,
+    0xe1b79d454b56ac19, 0xe23db4976749cb85, 0xead8f579865bc9e1, 0x65f4a3eba34ed85f, 0xde29546fe46317cb,
+    0xf56be281f1862739, 0x49871c53217936a5, 0xf9c8bd454f5c7613, 0x879defb65c4d637f, 0x4d69c7287c5182eb,
+    0x1fd729cbac64b159, 0x16fc7abdc836afb5, 0xf75b9cded759ce23, 0x6518c3bfe43adc8f, 0x87bae142143deafb,
+    0x3bf156c874532c69, 0x7ed8153981463ad5, 0x743b52898f296a53, 0x6128bfa98d2b57af, 0x241fd7abab3e872d,
+    0x5843dbcfec31b589, 0x68345c2fe923b4f5, 0xcbf419d21a28d473, 0xb1392ae54638d2cf, 0x7b513ef8763bf14d,
+    0xd5c86149854f21b9, 0xf3615e8cb2534f17, 0x9362d71cbf165e83, 0x9e453adbac175bdf, 0x72c4f631fc1a7b5d,
+    0x625aefd32b1e7ac9, 0x5ed17f465b21ca37, 0xa28c56976914d8a3, 0xec6ad7fba937e821, 0xad58279ba419f57d,
+    0x2ed8795cb42c15e9, 0x42bd6c7ed31f2457, 0x86492d5edef164c3, 0xa291e6832ef68341, 0x8d5671e43cf6719d,
+    0x12dfa5b43ad87ef9, 0xfe17d26548fcae67, 0xad52796876efacd3, 0x6f9842cba7f3ec51, 0xb49f723cb3e4f9ad,
+    0xe8957b2fe4f81a2b, 0x9f67a5c213fc2a97, 0x197cfe2651ed48f3, 0xd8974bf65fe26871, 0xe56d39f76be375cd,
+    0xbeda84398ce7954b, 0x189b6cedc8e9a3b7, 0xe597628cb8edc325, 0xea83cd1fe6cfd291, 0x6fde839215a2cfed,
+    0xa8cd3b5434d61f5b, 0xd3e912b653d82ec7, 0x8673fcb981eb4d35, 0xfcba13487fbe5ca1, 0x3d25798a9dc27a1f,
+    0x3d27ac8fecd3897b, 0x59a274e1f9c5a8e7, 0x76e8d15219dac865, 0xdab526e437abd6c1, 0xa2c1fe8546aed53f,
+    0x365a27c986d3149b, 0xb68f5d2cb5d73419, 0x369f8bcdc1da4285, 0x496f218dcfab62e1, 0x6afcb39edb9c6e4f,
+    0xb79c2a832d917eab, 0xefda7c343cb4ad29, 0xb1afe32438a6bc95, 0xe42b1cf65698caf1, 0x2b945378748bd96f,
+    0x7921485a938ef7db, 0x248dc63fe5c32849, 0x7982c451f1c637b5, 0x6ab3f4c541ca6723, 0xe57fb4832e9b648f,
+    0xb4c91ad54c8d73fb, 0x6b3fd2987da1b269, 0x436a85e98a94b1d5, 0xe419af7cb897cf43, 0x8417bf2cb467cd9f,
+    0x36a5eb1fe47afc1d, 0xe46129f3248f1d79, 0xfa2635b764923be5, 0x2a6153c981a75b63, 0x31f9d8254e6758bf,
+    0xc4f612ba9e6b783d, 0x7aefdb8cbc5e86a9, 0xad948e1feb92c617, 0xd54b3fa1fa94d583, 0x786c9be21876c3df,
+    0x126b37a43679f25d, 0x46d193e7657d12c9, 0x94352adba59f4137, 0xb46de38cb1825f93, 0x985e32da9d645cef,
+    0x19a685dcbe487c6d, 0x426fa791fc4a7bd9, 0x38b75de21c5eab47, 0xcf2a6e854a61d9b3, 0x4f3eb1d76a75e931,
+    0x27eb934a9745f68d, 0x35a9b87cb45a16f9, 0xa38e12bdc38d2567, 0xb39ea47dc17f45d3, 0x5d2ae36fef738451,
+    0xbf14dae21f4572ad, 0x16372eb54e58912b, 0xa6fdb8254c3baf87, 0xb91ad627684cade3, 0x4289ef5ba952ed61,
+    0x38f297da9643fabd, 0x168ac39fe6571c3b, 0x38674dc1f3492ba7, 0x8714eb53236d4a15, 0x254fead7624f5981,
+    0x4f23b1865f3276ed, 0xf67bd1398e24965b, 0x8b9425da9d28a4c7, 0x7c964a2eda2bc435, 0xe83f426dc84ed3a1,
+    0x48df315ed853e21f, 0x26371c943945217b, 0xc8794ea545362fd7, 0xae3d86f9862a3e45, 0x37c625e9823c5db1,
+    0xe37a81698d1e6b2f, 0x4be1356dce127a8b, 0x76a38bcedc14a9f7, 0xc7e25381fb18c975, 0xb9a3d6e4392ac7d1,
+    0x63ca5284381cd64f, 0xf1b7dce8783215ab, 0xe8d96b7cb8163529, 0x28c7fa1dc6184395, 0x56e4827dc42a63f1,
+    0x2ce8167badeb716f, 0x376e5a2ba9ed6fcb, 0xefb591832cf1ae39, 0x672b19f329f3bda5, 0x9d34ca8659f7dc13,
+    0xd83c1fe545e8da7f, 0xaf8291c764daf8eb, 0xe185bd4cb4ef1a59, 0x463b82ded4f238c5, 0x47d3a19fe1f76843,
+    0x6be2c19321e8659f, 0xe5968b743feb851d, 0xec73d9f54cdea379, 0xb15a79e87ad1b2e5, 0x486c9b7a9ae5d163,
+    0xf6b7843986b5ceaf, 0x675fc28ba5b8fe2d, 0xcfa5d741f4dc1e89, 0x36715ef214be2cf5, 0xe2dfca4764e25c73,
+    0x962c54b761d459cf, 0x2f5d89365fc8794d, 0x5c8d2a765edc87b9, 0xb12df68a9aceb827, 0x42d5e87feac1d693,
+    0x8b5f6a4ed7a3c4ef, 0xa1c87de218b7f36d, 0x21bc973546ca13d9, 0x6478d32986cd3247, 0x2f7ab84984cf51b3,
+    0xcf341d6ba3c47f21, 0x9e43dc2a9fa46e7d, 0x69b4721cbda67ce9, 0x49db2e61fd9bac57, 0x14c8a6b2198ebac3,
+    0xa38e47b659b2ea41, 0xcba7836546a3f79d, 0xe16c39fa96c7281b, 0x71a356cba4cb2687, 0x1274d36cb2ac46e3,
+    0x93af52ced2bf7561, 0x72ae369fef9273bd, 0x9ef5d8a21fa6923b, 0xc9b58a243e98b1a7, 0x8927a3654b79aef3,
+    0xda519b86598dce71, 0xb5631d298671fbcd, 0x7b1f58cdc7951d4b, 0x58d7ba3fe4962cb7, 0xfadc32b1f39a4b25,
+    0xe8215da3238d5a91, 0xe568c924318e57fd, 0xf231e8754f82976b, 0xf5a219e76e84a5d7, 0x91a2fc7bad89c645,
+    0x7ca9583dc97ad4b1, 0x26a851dcb87cd32f, 0x98a65f21f793128b, 0x2e58cd13289531f7, 0x9ed2514324983f65,
+    0xeaf9182763795ec1, 0xb168e7f9817b6c3f, 0x479235e87e4f6c9b, 0x4e2b69cdce63ab19, 0x49a6cb1fed64ca85,
+    0x2e896431fa57c8e1, 0x563d9c82194ad75f, 0x49128cd3274df5cb, 0x5e9d1bf87a812639, 0xe8bdf79cb78634a5,
+    0x45c629edc4897513, 0xef1ca2bdc15a627f, 0x42acf7dbaf4c71eb, 0x92f831aedc3e8f49, 0x74d1f3e21d42aeb5,
+    0x7afd1b454b56cd23, 0xb781efd54936db8f, 0xac735be65638e9fb, 0x25f79acba74e1b69, 0x2b8c614dc76139d5,
+    0x1ed4b57fe2746953, 0x6ba289efe13756af, 0x18edc254314a862d, 0x325f87643f2da489, 0x6bfc8d176c2ea3f5,
+    0x74be6d9a9c54d273, 0x1aef54c98935d1cf, 0xd9f6278ba827ef3d, 0x375961fed63b1fa9, 0x6eb38fc1f64d3e17,
+    0xed69f84327415d83, 0x4c6829e764235adf, 0xf7d1cea981267a5d, 0xb574f9a65f1a78c9, 0x28e7ab198e1db937,
+    0x8fb2d91a9b1fc7a3, 0xb4c2635edb34e721, 0x25637a4fe915f47d, 0x21d6aef43a2814e9, 0xb6598237691c2357,
+    0x854f7269871e52c3, 0x9fe5316cb7538241, 0x1cad294ba2136f8d, 0x124a63798ce47df9, 0x23b86dfcbcf8ad67,
+    0x3764ec2fe8f9abd3, 0xf9deb85329fedb51, 0x56db1fc437e1f8ad, 0x86a49e3768f5192b, 0xde5a164ba5f62897,
+    0xc1f4de5a95ea47f3, 0x5adeb8fcb3fd5671, 0xdfa97e5ba1ef64cd, 0x163d2bfedfe2934b, 0xab859c421fe5a2b7,
+    0xbf7194c54de9c125, 0xaf8d13e549dacf81, 0xb4f7ae35469abced, 0xf8b75c1a98d21e5b, 0x4a817fdba6e42dc7,
+    0xd34b1f9ed6e84c35, 0x9a65d871f3e95ba1, 0x8fb1d9c323dc691f, 0xf32e78c431df687b, 0x4926df354fc2a6e7,
+    0x624e8af98ed4c765, 0xa63bf2c87ab8d5c1, 0x2158396a98bad43f, 0x2ae5781dc6adf29b, 0xa582f4b1f8d24319,
+    0x156fd78329d64185, 0xa9bc152434b75fd1, 0x7928eaf652b96d4f, 0x1a759836519c6dab, 0x1b5e2fc76eaf8c29,
+    0xa153df898ea2cb95, 0x84df613edba5c9f1, 0x741b56cfe9a7d86f, 0xf175b9c21789f6db, 0xd71b9f6438be1749,
+    0x6a72391878c136b5, 0x4ec1da7ba8c57623, 0x53ad826ba2b7638f, 0xea1fc45dc1a972fb, 0xafbe153dcf8da169,
+    0x9361fd8edb7e9fc5, 0x385a4ef21d92ce43, 0x7e9b2fa32a74dc9f, 0x1963b7a54987fb1d, 0xe14fd5c6568b1c79,
+    0xde9645fa968d2ae5, 0xa7f5314ed7b15a63, 0x34f278ded29357bf, 0xd2cb76a1f1a6873d, 0x4ea26873217b85a9,
+    0xc2ae9b543f8db517, 0xf5a432865d7fc483, 0x4d9e5af76a73c2df, 0x58e7243a9a86f15d, 0x3b6471aeda7821c9,
+    0xb1c3d74ed68b3f27, 0xd42c7631f57d4e93, 0x1c8bf6a324715bef, 0xa9f38e1542837b6d, 0x3294a8d541657ad9,
+    0xf21d59b76f59ba47, 0x42f79bd87e5dc8b3, 0x67c235fbab6fd831, 0x58a7326dca62f58d, 0x9da825efea7615f9,
+    0x53f1bac21b8a2467, 0x7efc4b53287b54d3, 0xc53f264a968e7351, 0x1e39fcba946271ad, 0xa236f5eba2648f1b,
+    0xb2e1695cbf35ae87, 0xdb1f9a7cbd48ace3, 0xdb3982a1fa4bdc61, 0x19b6edf2183fe9bd, 0xf12e5dc65c641a3b,
+    0x6b254d376b4529a7, 0xa7169bfcb86a4915, 0x5db78aecb64c5781, 0x41ade65ba23c65ed, 0x7d5e3a6fe261945b,
+    0xe7463a8fef24a3c7, 0xc61b37a21f48c235, 0x5ca2d4865e49d2a1, 0x2c7d16454829befd, 0x4e531cd6582dfe6b,
+    0xac21547ba9432ed7, 0x4569afbdc9273d45, 0x51aeb96fe6385cb1, 0xb27854cfe43b6a2f, 0x5e3cdf62132e698b,
+    0xe82497c65231a8f7, 0x61c83fe76f13c875, 0xedb548f98e27c6d1, 0x4571ad898b19d54f, 0xd6f9823a981cf3ab,
+    0xb27d5a3eda3f1429, 0x4a758fd1fa134295, 0xf7b1cd85493762f1, 0xde8169a434186e5f, 0x4a18c9d653196ecb,
+    0x1e97a568721e8d39, 0x651c9a276def9ca5, 0x2cfd439a9cf4db13, 0x65ed9a2cbae4d97f, 0xb8f93ecdc8d6f7eb,
+    0x4cf67a132afc1859, 0x9ac53fe438fe27c5, 0x3e84d52989f16743, 0xdfa2c58985e3649f, 0x26de134ba3f7841d,
+    0xba2f186dc1fba279, 0xd165efba9fdca1e5, 0x9d5842cedacebf53, 0xc937da4219b2cdaf, 0x96b85ca439b5fc2d,
+    0x4c6392a54ae71d89, 0xab81c5f767da2bf5, 0x2b65ec8a96de4b73, 0x2e75d89ba4d158cf, 0xb65f84edc2e3784d,
+    0xf328a7e1f1e586b9, 0x5d7963b431eab627, 0xd69217c32fbdc593, 0xd314c9b54a9db3ef, 0x16b453287ab3f26d,
+    0x2c35ed898ac612d9, 0x8f5e367dc9da3147, 0x63185d7ed6cb4fa3, 0x3ba895e1f5bd6e21, 0x64d7eaf324b16c7d,
+    0x46d9af3542c37be9, 0x264b3df541d6ab57, 0x917b32865fa8b9c3, 0x63d97eb87eacd941, 0xc32a74b87a8fe69d,
+    0x841c59dfeac4271b, 0xb2975c41fac62587, 0xd57ec38218b945e3, 0x372abd8438bc7461, 0x84ef93c6549e62bd,
+    0x153cd6b985c2913b, 0xf26b81a981b3af97, 0x4ec1629a9e86adf3, 0x2976fd3cbe89cd71, 0x4532d7b1f869eacd,
+    0xe5afb962197efa4b, 0x2ce981754c932ab7, 0x4398cfe769b74a25, 0x2c5aef6876ba5891, 0xf23e6d7a938a56fd,
+    0x386c1b4dc29e856b, 0x94c56dbfe291a4d7, 0xd65e172fef96c345, 0xcb8d24532f87d3b1, 0x9f2d6eb54c79d12f,
+    0x5a1d3fb4395aef7b, 0xe591bda6596d1fe7, 0xe321549cba923e65, 0xef9682dcb7865dc1, 0x4d8b379ed4786b3f,
+    0x3db974a1f25c6a9b, 0xc86f2da3236e8a19, 0xec7fb4254271c985, 0xf85e2b165f64c7e1, 0x16b5ea498c47d65f,
+    0x76b294d87a58f4cb, 0x6523b71dcb7d1539, 0xf68594ced97f23a5, 0x4de568b1fa957413, 0x84cd2b932985617f,
+    0x7d416ac323476fdb, 0x281659e7625b8e49, 0xc65ba9f8714e9db5, 0xeb14876a9f61dc23, 0xe26b3d7a9c43da8f,
+    0x6a815efdca35e8fb, 0x64cf8951fc4b1a69, 0x69dfe3b21a4c28d5, 0xb67fa4932a6f4853, 0x6d2f3e58784265af,
+    0x6843e79ba746852d, 0x591e7fcdc247a389, 0xc8f61a5dc14ba2f5, 0xdb5391fcbf4ec173, 0x4798623eda31cebf,
+    0x96da7fc21b24fe3d, 0xd8231ef54c361ea9, 0x5ef8b3976b4a3d17, 0x7dcae298792d4c83, 0x34fc87a9862e49df,
+    0x1eb4529dc632795d, 0xb3e79a5fe32487c9, 0x7bf4e961f129b837, 0xb7ae6895412bc6a3, 0xf79e35465f3ed621,
+    0xc3df5b276c21f37d, 0xe67813f98c2513e9, 0xf5b3986cbc193257, 0xb5c49f2ed92a51c3, 0x46bc789ed82c6f31,
+    0x3c41f87dc41f5e8d, 0x2938db1435127cf9, 0xdf178eb65314ac67, 0x2a6d39576217bad3, 0x942dcef76ef9da51,
+    0x7d8b2af659fbe7ad, 0x5fd63b7989def72b, 0xb5cd874edbf32697, 0xa5bf943ed9e746f3, 0x6572eb9329fa6571,
+    0xea5dc6f325fa63cd, 0x562ef9b765fe824b, 0x6a41fd2984f2a1b7, 0x24593b8a92e4bf15, 0x715ed4fa9fd6ce81,
+    0x6c8d2e1989a7cbed, 0x73689ecfe8dafc5b, 0xbd7916c329df1bc7, 0xea91c5b76ae24b35, 0xd1b3e94548e659a1,
+    0x2143d9a875d9681f, 0x69c1fd4a93ec867b, 0x98e274fba2cd95e7, 0x6a5fbd1ed2e1c465, 0x1b34cadfefb5d4c1,
+    0x4b3f8ea21eb7d23f, 0xea87b3d43dc8f19b, 0xd9c12f376bcd3219, 0x492c51f769be2f75, 0x658c9e3a98b35ed1,
+    0x539a24dba7b56c4f, 0x84936b1fe3d76cab, 0x64fe9b31f3dc8b29, 0xd7a3c61212ceba95, 0x4b2c8a3653b2c8f1,
+    0xce3fa2954ea3d76f, 0x71b928d54c96f5db, 0x617af4b98dcb1649, 0xf8c17badc9ad24b5, 0x4329a68ed9bf6523,
+    0x8bc267efe7b3628f, 0xdce16b8326a571fb, 0x75a6d8c323b78f59, 0x8fe9c275428a9ec5, 0x41ca93b8719ebd43,
+    0x1ea65b976e71db9f, 0x9b127e5a9c84fa1d, 0x75b6193feda61b79, 0x9e5c3a21fb8a29e5, 0xc4f3b5721bad4963,
+    0xdeb79853278e46bf, 0x291c857657a2863d, 0x4269731873b584a9, 0x6cf89e2dc3a9b417, 0x7a52964ed19bc283,
+    0x4e27516a9e6cb1df, 0xb14e738dcb71ef4d, 0xcadf2e532d741fb9, 0x7f2c49d54c983e27, 0xfbac89165b7a4d93,
+    0x7c2ad946576b4aef, 0x98d5743a947f5a6d, 0xf2a4b9edc46278d9, 0x8516d4bfe285b947, 0xda7c9e51f168c7b3,
+    0xf16aced5428bd731, 0xfe1627a32f5ce48d, 0x24cb61f76d7214f9, 0x2735961bad952367, 0x921d74ebab7852d3,
+    0x3ac54dfeda8b7251, 0xb7514fedc64b5f9d, 0x86425dfed45f7e1b, 0xa87534e21452ad87, 0x6c1eb2354265abe3,
+    0xf9bad3c87258db61, 0xf1eba2465f39e8bd, 0x3b6f25487c4df83b, 0x7e6af9cdcd5128a7, 0x985deabfec764815,
+    0x27d9e6f1fb495681, 0x61b4f392183964ed, 0x179fe4c3274d835b, 0x6a3e18b7654f92c7, 0xed13a97ba674c135,
+    0x2f9e3d5ba245cf91, 0xdb6ac3198e26bcfd, 0x92fc61dbac29fd6b, 0x6279a3b1fa3e1cd7, 0xbf1cea532d613c45,
+    0xd29ceb376c345ab1, 0xae2487565a37692f, 0xc4d5f69a952a678b, 0x9f5ac37ba42c96f7, 0x51ac46edc32fb675,
+    0x475db6efe243c5d1, 0x63c274adce16d34f, 0x72e1f5343e17f2ab, 0xa3914be76e4c1329, 0xa3bd51687c2e3195,
+    0x45be28c98a325fe1, 0x5623cf8ba9136d5f, 0x9f3d261ba7156dcb, 0x7acb35dfe51a8c39, 0xdf79c8a1f31d9ba5,
+    0x9cf82315452fca13, 0xbf3752e65312d87f, 0x1c82e4654cd3f6eb, 0x93615ad76df81759, 0x8cb31e698bfa26c5,
+    0x72be159cbafd5643, 0x45a81e9cb7de539f, 0xc7a3659fe7f4831d, 0x19d2bca326f5a179, 0x21687be323e79fd5,
+    0x891fb4a762fabe53, 0xeaf5274651edbcaf, 0x74e9b2687ec1fb2d, 0x7a1845cbade41c89, 0x9e51c8bdcbd72af5,
+    0x5e8cfd41f9eb4a73, 0x6e93a71218db47cf, 0xb468c7a328cf674d, 0x37edb68546e285b9, 0x35612f7a94e6b527,
+    0x6f7c132ba2e8c493, 0x5f3b46c981c9b2ef, 0xe795c46a9face16d, 0x25b63a41fec321d9, 0x45e619b21dc52f37,
+    0xd15297b32bc74ea3, 0x395c7ed659ca6d21, 0xde42876546ac5b7d, 0xac15ef6874bf6ae9, 0xae25b31dc4d2ba57,
+    0xb913627fe2d5b8c3, 0x4edf6321f2c9d841, 0x8bfdc5a321bae59d, 0x81672df43e9df51b, 0x3bdfa1576ec12487,
+    0xc62f73498cb654e3, 0xdcae594babc97361, 0x6ba815edc7a961bd, 0x51c68d3ed59c7f2b, 0x4d7ca51ed3af8e97,
+    0xfec3b9421592acf3, 0xb934dca543a5dc71, 0xfe3684b54186e9cd, 0x7fe3ca165e7af94b, 0x816d4e376d8e19b7,
+    0xb4ca526dcdb14925, 0xc847a1bfecb45791, 0xb94527afe89765fd, 0x15ef3b82179a846b, 0xa874dce3258c93d7,
+    0x5f92ea48769fb245, 0xfa4cb1d98594d2b1, 0xefc748da9285ce1f, 0x934e15da9d56fe7b, 0x29bea38cbc6a1de7,
+    0x5d7863b1fb8e2d65, 0xa1bd76543d825bc1, 0x6cf89d132b846a3f, 0xd7329fc43a75689b, 0x23cb56a8756ba819,
+    0xae47d35ba36db785, 0x9658c2aba37fb6e1, 0xa6b3c7edc182d45f, 0x19c2754ede65f3cb, 0xcab8f1d32f7a1439,
+    0x24fb93a54e7c32a5, 0xaf7cb2487c8e6213, 0x3a21d5798a715e6f, 0xc867f5ba98536edb, 0x7239ef8dc7568d49,
+    0xe4761a8fe3489cb5, 0x7bf64a51f46dcb23, 0x4dfb63e2124ec98f, 0xc2f79d454152e7fb, 0x361a9de87f451869,
+    0x25d67ef98e4927d5, 0x2a3fc18bad6c4753, 0xa42f5e8cb93d54af, 0x12e547bfea61842d, 0xcb829561f754a289,
+    0x2af78e632847a1f5, 0xac7d49532549bf63, 0x21da39565239adbf, 0xe7159af8714fec3d, 0x73cad1898f431da9,
+    0x14697dfcbe463c17, 0x3815964fed294b83, 0xcbe4573fe92a48df, 0x7b934d821a2e685d, 0x2376ba454a3186c9,
+    0xf1a857e98924b637, 0x9de78bca9627c5a3, 0xf64e8bdcb64ad521, 0x965a2ceba13be27d, 0x84fc13ebac2df1e9,
+    0x25e6da81fe243157, 0x5ea264d32d164fb3, 0xf1d57be65c296e31, 0x1bed2985491a5c8d, 0xd453f716571d6bf9,
+    0xb917326dc821ab67, 0xb8e793adc614b9d3, 0xb61e934fe427d951, 0xfa275e61f218e6ad, 0xea7b2c35431cf62b,
+    0x1a6d82c43dfe1597, 0xce9743f87ce145f3, 0x94e3bf1a9cf56471, 0x6edf532989f762cd, 0x435716adc7fa814b,
+    0x1a3847bcb4ec8fa7, 0x3e4ab65dc4dfae15, 0x27ecd4a325f3cd81, 0xe793fbd432f4caed, 0x1379e42541e7fa5b,
+    0x38fdca965feb1ac7, 0xf8a725c98cde2a35, 0x716f8e4cbce258a1, 0x34591a8dcad4671f, 0x2a9b5341f9e6857b,
+    0x7d8a694216da94e7, 0x9a26b74327edb365, 0x86fabd3765dfb3c1, 0x361d785985c4d13f, 0xcdea465871c4ef8b,
+    0x7f9348da9db81ef7, 0xf7e1a25badcb2e75, 0x2ec58671f9ae4cd1, 0x698a24732ac16b4f, 0x7f6d49e328d369ab,
+    0x9462c1f547d68a29, 0xb5e3129764dab895, 0x17ae3fd984acb7f1, 0xeb392c8a92aec56f, 0xa53c728dc1a2f4db,
+    0x84a7526fefc71549, 0x45d7a8b21fc923b5, 0x349b28165ebc6423, 0x218ed3f54bad518f, 0xc81aef4658916feb,
+    0x98fc354ba7b38e59, 0x9e37b21cb4a69dc5, 0xb8d2691fe5a9bc43, 0xb14a386fe27bca9f, 0x85d9fac3238fe91d,
+    0xfd714a2652c31a79, 0x2917e8d54fa628e5, 0x69c71d287eba4863, 0x4c37a1587c8a45bf, 0xbe65391cba9e753d,
+    0x92d6514fe7b183a9, 0x3874e691f8a5b317, 0xf4e1b97326a7c183, 0xb7f45e932367aecf, 0x9b5a7e16527ace4d,
+    0x9274c8b6516efdb9, 0x785ace3baf943d27, 0x7deab31cbe864c93, 0x5af8cb4dcb6749ef, 0x95bcd861fa7b596d,
+    0xfe6d71c21a5e67d9, 0xa135dfb43a91b847, 0xdce7b4265784c6b3, 0xa5197ceba598d631, 0xca89e52ba269e38d,
+    0x971845aba16be2f9, 0x9a85723dce8f1267, 0x26a93451fe8451d3, 0x4f759cb32d876f41, 0x8a71c2b32b475e9d,
+    0x9486b135495a7d1b, 0xaf487396564e9c87, 0x31d68f2a9761bae3, 0xb148265dc574da61, 0xb8ec569dc245e7bd,
+    0x68423cdfe159f73b, 0xc73589b4325d16a7, 0x1d298fe54e6f3715, 0x4c613bda9e736581, 0xaf8315b98b4563ed,
+    0x168749fbac49825b, 0x641f9a2ed84b91c7, 0xf3e59b7dc74daf25, 0xdf564721f652ce91, 0x61b537f21543cbfd,
+    0xcd9ba8e54235fc6b, 0x1ca3d42762491bd7, 0xad586fc98f3d2b45, 0x3bc5da898d3f49b1, 0xd53ba12cbc43682f,
+    0xa96542dfec24768b, 0x5d7a3c1fea2895f7, 0x7b5e3862192cb475, 0x8bd91276573eb4d1, 0xaeb538798751d24f,
+    0x1b86cfd98534f1ab, 0x8a42e7bdc4583129, 0x892a37bcbe1a2f85, 0xe791f23bac2b4de1, 0xb93f285eda1e4c5f,
+    0x291d56e43d126acb, 0x3a8ed9f54c158b39, 0xfd69cb854817b9a5, 0xbe2c17a9872bc913, 0xe58fdcba941dc67f,
+    0x1a429fcba421f5eb, 0x45cd821fe3241659, 0x6df873aedef724c5, 0xa6b9d8f21efa6543, 0x2e7ba3943ceb529f,
+    0xe4c2bfa65afe721d, 0xdf5942165ae18f69, 0xef3b84c987f39ed5, 0xa45c3d6ba6f7bd53, 0x751d9b2a93e7cbaf,
+    0x43e1289dc3fbea2d, 0xa946cbd212defa89, 0x1fb9463761e329f5, 0x329185765fe64973, 0xcbd724a65bd846cf,
+    0x7fc5a3898aeb764d, 0x1e48f23ba8de74b9, 0x469857ced9e1b427, 0x78d39a51f7e5c293, 0xa4b98cd325c6b1ef,
+    0xe869ca2323b8cf5d, 0xc18ed64542bafec9, 0xe35ad6b982cf1e37, 0xed2583f98fc24da3, 0xae85962baed76c21,
+    0xd527146febc85a7d, 0x39ca46b1f7cb68e9, 0x364eb98218cea957, 0x832d96a548d1b7c3, 0x3b81c62768c5d741,
+    0xa36b549873b6e49d, 0x625a4df983c9f41b, 0x7b26fe5cb2cd1387, 0x93764bacbdaf42e3, 0xb27d8e91fec47261,
+    0xaf4b93c21c945fad, 0xd298c6543ca87e2b, 0x6319aef436ab8d97, 0x2f53e986568d9bf3, 0x493b875a96a2db71,
+    0x62f4359ba493e8cd, 0x7c216baed2a6f84b, 0x3e795b61f2ca18b7, 0xec7423f541bd3825, 0x9de8b2643eaf4691,
+    0xf3d2e5865c9264fd, 0xcf3215d87da5836b, 0xd8bfc2a76ba892d7, 0x524c687ed89cb145, 0x6451f2bdc57dbfa1,
+    0xc72b135fe582cd1f, 0x89543c121483fd7b, 0xdf18c7e543961ce7, 0x6b57c498719a2c65, 0x59c36ab76f7d4ac1,
+    0x3146bd798c7e593f, 0x1a437fedcd82679b, 0x165297efec85a719, 0x59f8ea41fa79b685, 0x2ab618e3287ab5e1,
+    0x2fa85bd3267dc35f, 0x2a89c5f76571f2cb, 0xed375b2cb5a61239, 0x28693a7dc29831a5, 0x1af8ed9bad694ef1,
+    0x64a8925bac5b4d6f, 0x4d5a3e1fe94f5cdb, 0x3feb18621d628c49, 0x8e94bfd32c649ab5, 0xcf758b165968ca23,
+    0x4326ae87654ac78f, 0x8b16fca9834cd6fb, 0x54b9837ed4821769, 0x21b68e5fe18426d5, 0x8396dbafef794653,
+    0x1759ce821e4953af, 0xb9adf7c54e5c732d, 0x5da183b65c4f7189, 0xdb76c3287a429fe5, 0xa1764f9ba945be63,
+    0xe639b85a9536acbf, 0x2e41985dc549eb3d, 0x3eda1c4fe23dfba9, 0x28b41fa545623b17, 0xc5372db871654a83,
+    0x89f217d65e2647df, 0x67d2fec98e2a675d, 0x8bd324f98b2d75c9, 0x8f1e27bdcb2fa537, 0xd719a63fe952c4a3,
+    0xfe53c861f957d421, 0x194de5f32638e17d, 0xd2a6be143428efd9, 0x3e257db9853d1f47, 0xf2b5c7ea92514eb3,
+    0x8ca321fbaf256d31, 0x6152f8abae165b8d, 0xa132869edc186af9, 0xcb6957a1fb1d9a67, 0x19528bf3291fa8d3,
+    0xa5efc9676a23d851, 0xe1f546d76714e5ad, 0xdec65fba9618f52b, 0x45ad86ecb52c1497, 0xb2a5864cb51d24f3,
+    0xb81fd9ecbdef5371, 0xa472db3febf361cd, 0xf8a7d5321ce57f3b, 0x964ae8f32bf68ea7, 0xad1be69548fbad15,
+    0x27431eb656febc81, 0x3db96fa875f1c9ed, 0xda859f1ba4e3f95b, 0x15863d7ed3f619c7, 0x549ebc1fe1fb2935,
+    0xc6e3a2d432fd47a1, 0xa6df23543dce561f, 0x48732bf65de2847b, 0x95142db76bd593e7, 0xab7513298ae9b265,
+    0xcd15264a97eab2c1, 0x4f37169a95acbe2f, 0x95caf26ed4c1fe8b, 0x65f2e7c325c41df7, 0xca13826543e82d75,
+    0x95dea16762e94bd1, 0x86c23e176ebc5a4f, 0x1382e9576dcf58ab, 0x3a9721fcbcd3a829, 0xcbda659fead4b795,
+    0x1b37564fe7c8b6f1, 0x6eb183a217bac46f, 0x2b9c57e3259ce3db, 0x72e14c6987d21349, 0xb9f68c2a94d632b5,
+    0x172d3b5cb4d96123, 0xe7bc2ad98da94e7f, 0x3d75c46a9c8a5deb, 0x612793dfebaf7d59, 0x7bae5d421da29bc5,
+    0x4d18a96329a6cb43, 0xeb1a57f435a6c89f, 0x61925837659ae81d, 0xa5fe17c983adf679, 0xf7a1e85dc4b127e5,
+    0x425e6cdfe1c54763, 0x91876acede9754bf, 0x538ca6b21f9a743d, 0x6fb7c1843e8d72a9, 0x29543de65c9fa217,
+    0xa4efc2d76a92bf73, 0xa6f571c98674adcf, 0x538fdaeba587ec4d, 0x589f4dced368fcb9, 0x8fe29451f49e1c27,
+    0xfbe1a72325a14b93, 0x2983d416519348ef, 0x1653b8243f97586d, 0xb19d3e654e5a76d9, 0xceb9d81a9c8da647,
+    0x57c13e2dc97fa5b3, 0x2a46ec3fea94d531, 0xda673bc1f675e28d, 0x47fd65832567e1f9, 0x8a796125459c2167,
+    0x96b5a387647d2fc3, 0x5379df4ba3926e41, 0xb5a342d98f635c9d, 0x7a5ef24bae567c1b, 0x6491ce3fed4a9b87,
+    0x97f64581f85ca9e3, 0x2cba86d32a5fc961, 0x6b37d8c43852e6bd, 0xd2be6f754875f63b, 0x6974f1ecb46915a7,
+    0x3f2596dcb48c3615, 0xb7e943fdc27e5481, 0x5d62183cbf5162ed, 0x974eb5f1fe64815b, 0x6a9fbe421d358fb7,
+    0xae951db43c49ae25, 0xc27a4de6584cbd91, 0xdb7c2896563ebafd, 0xc7246b3a9742fa6b, 0xc562bfedc6451ad7,
+    0x713cad2fe3692a45, 0xf2ae8351f25c48b1, 0xed251b64314d572f, 0x823a7fc54f31758b, 0x81ba6e276d2394f7,
+    0x29dc831a9d28b375, 0xbe21cda98a49b3d1, 0x314ed6cba83bc14f, 0x6e3897aba52edf9b, 0x3192547fe7542f19,
+    0xc71fe5b217362e85, 0x5e6b39d765384ce1, 0xf6ac27e8712a4b5f, 0xdaf49ec76f1e59cb, 0x65971a3cbe218a39,
+    0x8ac9b74dcd13b8a5, 0xe72dac6feb27c813, 0x93b4c61fe819c57f, 0xa76ecd43271ad4eb, 0x16eca4d5471ef359,
+    0x21cd46fa981423c5, 0xd48eb19cb7186243, 0xe2384a6cb328519f, 0x4e97cb587cd85efb, 0x9378ec1babfc7e69,
+    0x1b698afcb9ef8cd5, 0x67dc58a21af2bc53, 0x4f68e51327e4c9af, 0x38127ed546f7e92d, 0xbc72e19654ebf789,
+    0x5316482a94ed18f5, 0x7ab36efdc5f14873, 0x59832f7cb1e345cf, 0xc7b25fadcfe8754d, 0xf69ba7821fea73b9,
+    0xeb974a854ceda327, 0xf73d98465adfb193, 0x7cb93fa657b2aedf, 0x25e4687987b4ce5d, 0x1354c67984b6fdc9,
+    0x25e69f7dc5eb1d37, 0x849653a1f4de2ca3, 0xa93de84545e36b21, 0x6c843e9541e3597d, 0x72a861c43fc567e9,
+    0x2478eb354edba857, 0xfa97324879bda6c3, 0xced26faba9bfc641, 0xec516fadc7b2e39d, 0x8a316cefe7c6f31b,
+    0x9cbe7d1436da1287, 0xbce7a31656cb41e3, 0xe1b934f873bd4f51, 0xef5d74c872b15ead, 0xd48c1f798fa47d2b,
+    0x68c72edbaeb58c97, 0xc4763f9edcb89af3, 0x83cf5421f89dca71, 0x86ab54c2168fb7cd, 0x3bc91da438a2f74b,
+    0x1c7efa2548c516b7, 0x4c17b53a96ca3725, 0x8152d3fba3bc4591, 0x3e15f26ba19c53fd, 0xf2d9145edfa1826b,
+    0xd4ae3261fea491d7, 0x79cd8ab21d97af35, 0xe8fb19343c78bea1, 0x148bfda5487abc1f, 0x13298765456fec7b,
+    0xd4e8f63ba6931be7, 0x65143dbed4a72b65, 0x8924de6fe3a849c1, 0x8c53d1efe19b583f, 0xfe87c2d3218e569b,
+    0x91a3b6f54f82a619, 0x2c4f5e376e93b485, 0xfecd32476c87b4e1, 0x3cd4eb898a79c25f, 0x3574b2fa976ae1cb,
+    0x23b71e8cb56def29, 0xe283c45fe6832f95, 0xe716daf325864df1, 0xb1c38e7432784c6f, 0x4279ace541695adb,
+    0x5b9d6c476f5e7b49, 0x3a71e5898e61a9b5, 0x85d193fcbd75c923, 0xc134d9aeda45c68f, 0x5974b16fe748d5fb,
+    0x8a13b742185cf469, 0x351cbae4387f14d5, 0x2e9f631ba8926453, 0xe182356a937652af, 0x96354edcb369712d,
+    0x7263c8ebae3b6f79, 0x7836941bab3c8de5, 0xc73426b1fc51bd63, 0x1dfea4b21943cabf, 0x2d1879a32946ea3d,
+    0x936edb454637f8a9, 0x3f4698da985d2a17, 0x4fb683dcb65f2983, 0xf978db2cb35246df, 0x5b9d138fe134765d,
+    0x3e5a679fef2874c9, 0xa3c5eb821f2ca437, 0x3cf9a8165d4eb2a3, 0x4e21d8798c64d321, 0xf96234187923cf6d,
+    0xaf325ed98725fed9, 0x3bf2794dc83a1e47, 0x6917c52fe64c2db3, 0x3129a4efe64f5c31, 0x8f49c3b214325a8d,
+    0x34192ad6512468f9, 0xd82af3654f18a967, 0x35d9b1476e1ba7d3, 0x4958173a9b2ec751, 0xe521a6dcb921e4ad,
+    0x7a56bfced915f42b, 0x24a3dc81fa281397, 0x2c97f156581a42f3, 0xca6db897683d5271, 0x8b12e4c7631e4fbd,
+    0xd86f572a94127e3b, 0xe85c2fb76ef38da7, 0x2d59c37a9df7ac15, 0x57b6348edaf9cb81, 0x194e826dc6fab8ed,
+    0x618ac3b217dfe85b, 0x26b1af3549f318c7, 0xc4685ba769f72835, 0x8431af2985f946a1, 0xd568c7ea93eb651f,
+    0xf83d792ba1fe637b, 0x847516ecbfd192e7, 0x68329be1fde4b165, 0xbac875f32cd6afb1, 0x658c732439c8bd2f,
+    0xecb152f436caed8b, 0xe7346b8545adebf7, 0x5172c68ba8e32c75, 0x928fdb6cb5e64ad1, 0xc45b7e9dc2d8594f,
+    0x74f6b851f1ec57ab, 0x7bfe216431de8729, 0xfcbe26143fd1b695, 0x34cb61876dc4b5f1, 0x842cda165ab7c36f,
+    0x241be3f767a8e2db, 0xd7f469cba7bcf149, 0x83419faed7cf21b5, 0x237e51bfe7c45f13, 0x7de6a59213b54d7f,
+    0x7af1d89432a75ceb, 0x1a29ed8541db7c59, 0x39bef4c54f9e8ac5, 0x237eabf98eb1ca43, 0x4d6f17a98ba3c79f,
+    0xc2e97b8dc9a6e71d, 0xa5e698cfe6baf579, 0xc982e16328ac16e5, 0x4872b9c548bf2563, 0xdbfc5a3876a253bf,
+    0x6f73b5ca94b6723d, 0xb26d5f3cb2c871a9, 0x2f1d346a9d7a8ef5, 0x1432e97cbc8dae73, 0x3a8d196fe971abcf,
+    0x9df865c21a83eb4d, 0xba2d5c432875fab9, 0x3fbc1e56589a1b27, 0x2b7efca8768d2a93, 0xebd7f56a948d37ef,
+    0x12fb3cadc3a2576d, 0x25db8acfe1a475d9, 0x1d2ba93fef89a547, 0x1ba94f521f7ca4b3, 0xe139f2465d8ec431,
+    0xe25748965b72e18d, 0x431a87965863dfe9, 0x926bd85cba981f57, 0xb4f5769cb6792ec3, 0x26c5879fe68c5d41,
+    0xced8526fe26f4b9d, 0x864eb72324837a1b, 0x5821e36431649a87, 0xde69ac354f57a8e3, 0xa9e6b2387e5bc861,
+    0xde59b648794ec5bd, 0xca51342dca71f53b, 0x421573cfeb8514a7, 0xdc76af41fa893415, 0xdc5f9143297b5381,
+    0x5f67a1b4346b51ed, 0xc37fb648725e6f4b, 0xd3425e8a91528eb7, 0x7d839e1a9f46ad25, 0x982143ebae47bc91,
+    0x5297b8adca38b9fd, 0x8d54bec1f83de96b, 0xbde6c8143b5219d7, 0xcbf397843b762945, 0xde2416f7695847b1,
+    0x9b42dfea974a562f, 0xd948627ba23d648b, 0xeb2f7d3cb14e83f7, 0xab8fd71edf43b275, 0x97f4eb51fe46b2d1,
+    0x36db54721c27be3f, 0xcf659eb43a28de9b, 0x57fb8da6583cfd19, 0x786492ea9a412d85, 0x3c41e89ba8354be1,
+    0xe32b415dc6274a5f, 0x1a382c9fe32958cb, 0x7ed49ba1f12d7839, 0xba8f91d4312f97a5, 0x82f9e6d76f24c713,
+    0xd4f6a2376d15c47f, 0xb219e3576a17d3eb, 0x6a25c7398a1bf259, 0x489b2a1cb93e12c5, 0xe16d8cbfea526143,
+    0xa8739dfed6134e8f, 0x4829ec5324165dfb, 0xbc2ea9d5431a7d69, 0xc2b6e1d7621c8bd5, 0x5268a1c76dfeab53,
+    0x3d69b5176be1c8af, 0x69b5f12a9af4e82d, 0x5f36b1edcae5f689, 0xb7a48c3ed8ea17f5, 0xf56d183219fd2673,
+    0xe59cbd6326de34cf, 0xa8ce1d4986f2734d, 0xc7d6fb2983f572b9, 0xde92b1fcb3f9a127, 0x2c65a3d87edbaf83,
+    0xd416f2b878ab9cdf, 0x3c5b74f1f9b1ec5d, 0x641e8cd218d3fbc9, 0x9f7416254ae81c37, 0xe5cd12b657e92ba3,
+    0xaf1e548987ed5a21, 0xb37e86da93cf487d, 0x821d9a6cb3d276e9, 0xb186724ed1e4a657, 0x615c2bdfefd8a5c3,
+    0x716aef932fdbc541, 0x8fb9e5c43baec29d, 0x2dc4a8f76ac3f21b, 0xd654128a9bd52187, 0xd4fe68ca98b72fd3,
+    0x35eb167cb7ca4e51, 0x716d95efe39b4cad, 0xa584e12fe3af6c2b, 0xea65cb4213d28b97, 0x94b8c31541c5a9f3,
+    0xb81cad754fb8c971, 0x423187654e89b6cd, 0x542acfe87a9de64b, 0x4586c1fedac215b7, 0x51b6374feac73625,
+    0x3c2ebd91f7c85491, 0xdebc95a216a952fd, 0x39fc87a434ad716b, 0x28f3adb5429e6fc7, 0xbe452f6981b2ae35,
+    0xf9ea53187f85bda1, 0x6539d14a9d87cb1f, 0x5fa6b48edc69ea7b, 0xb697d35ed86cf9e7, 0x86e2db943cb12a65,
+    0xd5936ec439a548c1, 0x98adce1546a8573f, 0x7259aef8738a659b, 0x9e7d658cb3ad8519, 0xc43f159dc19fa385,
+    0x5b48e27dcf84b3e1, 0x29e375bfed86c15f, 0x451ad9321c56dfab, 0x9adf5b143b6afe29, 0x246c98754a7d1e95,
+    0xf23e576879824cf1, 0x5da974cba7834b6f, 0x95b81f7dc37659db, 0x35d2be4fe26b7a49, 0xd76ec821f16d98b5,
+    0x61d2f785417fb823, 0xfcb867e43e62c58f, 0x7d31e2943c65d4fb, 0xcd3265e87c58f369, 0x2e9c713a9a7b13d5,
+    0x2358ba1dca8e4253, 0x7a21d94ed87251af, 0xc369eb2fe5746f1d, 0x4198f37213456e79, 0xa8db613432498ce5,
+    0x62d317e8715dac63, 0xcf4b81d65d3ea9bf, 0x3b5cfea98c52e93d, 0xe763df9cbc34f7a9, 0x7c29843fec5a2917,
+    0x98dac621fa5c2783, 0xa3db1e52184c35df, 0x9165a7d43961745d, 0x8cfa6279865473c9, 0x84b6219cb458a237,
+    0x3a249bcdc259b1a3, 0x9ed2a1387c2a9def, 0x19b63f2a9a2fbe6d, 0x51e2d3cfea32fcd9, 0xd29178432c361d47,
+    0xde5f8c965a482cb3, 0x36c21db8794c5b31, 0x742ea318762e498d, 0xf5a86d9cb53167f9, 0x374f29bed423a867,
+    0x361de24fe127a6d3, 0xd8a12b9fef2ac651, 0xcbd945732f1bc3ad, 0xbad894f65c1fe32b, 0x561a3ec98d341297,
+    0x127f6c3a9b2741f3, 0xf57bda2cba294f61, 0x9fa5736ba6194ebd, 0xb75389fdc51e6d3b, 0xf3ed5741f4218ca7,
+    0xd27e95843624ab15, 0x839d2ea65326ca81, 0xda3921e43cf6b7ed, 0xfde891354cfae75b, 0xa83b21c769edf5c7,
+    0x694cb52dcbf12735, 0x23c8b1ded9f645a1, 0x6ab198ced7e8641f, 0x3b84975215fa627b, 0x37bad82434fc81e7,
+    0xf46e18b762de9f45, 0xb26dc71872f3aeb1, 0x759bcf387ed5bc2f, 0xcae4b3687ad6ec8b, 0x26fea83cb8c9eaf7,
+    0x692dc871f9de1b75, 0x25a768343ae249d1, 0x8b6cea5329d3584f, 0xb87fad3434e756ab, 0xefa7c31874eb8629,
+    0x4d7136f982eda495, 0xfd674b3a92cea4f1, 0x4a8c2e7baeb3c26f, 0x5d6e4b31fca5e1db, 0xe5a437f21cb7ef39,
+    0x29fcad1439cb1fa5, 0xda31b8f769bd4e13, 0x15cfea4768b14c7f, 0xc71fe65986c35aeb, 0x6e42a3bdc3d67b59,
+    0xb7a24c5fe2da89c5, 0x735e2af1f1cdb943, 0xe9a8b45321aeb69f, 0x8d26c1954fa3e61d, 0xa735f9143db5f479,
+    0x4729e3a87cb914e5, 0xd94ef18a9abc2463, 0x38de217ba79d42bf, 0xba57d92fe8b2713d, 0xbe83c12fe4b36f89,
+    0x6ca478f213a68df5, 0x8e42abf542b9ad73, 0xdfb4ae35417b9acf, 0x7c8e95265e7fca4d, 0x45f29d676d72f8b9,
+    0xf2a8ec1dcdb61a27, 0x31728c9fecba2893, 0xc94fa37ed78a36ef, 0x87e356a2189e456d, 0xd2753bc436a174d9,
+    0x82fcb46986b5a347, 0x43c752b98497a2b3, 0xef53bd9cb49ac231, 0xc13eda898e5abf7d, 0xa2ebc7d98a5fcde9,
+    0xadc73e61fc931e57, 0x796a84f21b862dc3, 0x69bc1f343b895c41, 0xbfdae924376b4a9d, 0x6eb58219857e691b,
+    0x8f41ac7dc461a987, 0x7ba65c3dc284a7e3, 0x2a41dbcfe298c761, 0x9a2468efef58c4bd, 0x1d58cfb21f6ce43b,
+    0x6ebd17843c5ef2a7, 0xe521c3498d964315, 0x278ca5fbac975281, 0x9c36b58a98574fcd, 0x8653c17dc75a6e4b,
+    0x173e4cfdc34e6db7, 0xefbc2361f471ac25, 0xab6c2d432364cb91, 0x312d7ea43145b8fd, 0xc6b2d4f54f39e86b,
+    0xe2f5bd865c3bf6d7, 0x5fd4736bac6f1845, 0x9dc5431edc7346b1, 0xf1dc897eda47652f, 0xab932df1f749638b,
+    0xe6a47312164b82f7, 0x6ac982d4364ea175, 0x5c1ed4787452afc1, 0x75af4b198154bd3f, 0x3fdeca787f25ed9b,
+    0x68dfc31bad38fc19, 0xd62a8c7feb3d1c85, 0x7c6ad21ed94f3ae1, 0xc378ba421b32495f, 0x95e87134392457cb,
+    0x7a594c36562a8739, 0x6e3a1bf9842c96a5, 0x81479d5ba54eb613, 0x8e41972cb241c37f, 0xc4e128dbaf14d2eb,
+    0x8d6317bfed27f159, 0xd26794c54e3a21c5, 0x89a621e76b1c4f23, 0xb5ea3916591e3d8f, 0x3a6fdb9878125cfb,
+    0x36ed5a7cb8147c69, 0xa48716edc4178ad5, 0x4b6d91afe41cba53, 0x42b159dfe21db7af, 0xa92f74c65431e72d,
+    0x82fe1ab43de2f589, 0xcb9f42154ce716f5, 0x3be68f298cfa2573, 0xfe7b236878ea43cf, 0xd3726f1ba8fe624d,
+    0xa4f29c5ed6f271b9, 0xad76829ed5e49f17, 0x54ec6d7214f6ae83, 0xad8271c432e79bdf, 0xef71cb3541facb5d,
+    0x4df2a7354dbfeac9, 0x6bcf4e7a9de41b37, 0x24a65b1cbce629a3, 0xd82a7b6edbea5921, 0xb32958c1f8eb467d,
+    0x61fc8b4217cd65e9, 0xe1d8236438e1a457, 0x6a5f791876e5a4c3, 0xd8e5726a95e8c341, 0x1c69a72872e8c19d,
+    0x5829f3b76d8acef9, 0x16bc3e4a9badfe67, 0x2437dab1fab42ed3, 0x1dfb92732bc74d51, 0xde9854f328c74bad,
+    0x2cfd9e3547dc6a2b, 0xd3b54c1654ce6a97, 0x2435b18a95c1a8f3, 0x7be6d2acb3d4c871, 0x9c4638bfe1a6b5cd,
+    0xafb5982edfa9e54b, 0xbd4587c21e9cf3b7, 0x5182f3c76dbf1425, 0x642dc1b87dc45391, 0x4791d56879a651fd,
+    0xed3268ca97a86f5b, 0xead9428cb49a6ec7, 0x3e821bfdc4ae9d35, 0x2c3648a1f492bca1, 0xf74b68c32394ca1f,
+    0x9825fbc431a5e97b, 0x8fbd9ec43d69f8e7, 0xf9c12ad87ead1965, 0x8e4d1a798b9f37c1, 0xe87f46cdcba2563f,
+    0xe7692adfe8a5649b, 0x2d8f43a1f6ba8419, 0x1c67aed2169ca285, 0x84bcaf15458da2e1, 0x9e26c5876381be4f,
+    0xb1548da76173deab, 0x7d4c5e298e76fd29, 0xf467e1acbe7a1d95, 0x8a6b3d1eda7c3bf1, 0x271cfa9ed97e3a6f,
+    0x6dc9b7521a7258db, 0x9a2eb7632ba57849, 0xb62385d4346897b5, 0x4c713e6a958cb723, 0xd59e6fca926db48f,
+    0xd4e93c8ba271d3fb, 0xe2a69b7dce74f269, 0xea76df51fe7812d5, 0xb65e78d32e8b4153, 0x5e21b4c32a5b3e9f,
+    0xcb634285496f5e1d, 0x5763cd498a526d79, 0xe287cadba7648be5, 0xf95a6b7ed458ab63, 0x1ab96fced249a8bf,
+    0xb823f761f15ec83d, 0xf6c93ae43251f6a9, 0xf87e29154f652817, 0x51d32c487e592683, 0x4d9bcfa87b5934df,
+    0x289e1b6a9a4c635d, 0x8b5da91cb84f62c9, 0x8a3b496fe964a137, 0x58a69befe645af93, 0x3e679a5214369cef,
+    0x2cfe49754239bc6d, 0xb5471fd6513cebd9, 0x76198b4a9f521c47, 0x35b9d28a9e452ab3, 0xe52968bdcd485a31,
+    0x24c37d5feb2a478d, 0x1e4a96cfe82c56f9, 0xab41fe721a2f9567, 0x32b45a976842a5d3, 0xb8d751ca9837c451,
+    0xc71f32698437c2ad, 0xef4c186a934ae12b, 0x7b524cda9d1cef87, 0xa3e95fbcbc412fe3, 0x37e86451fc254e61,
+    0x61e8d2c32a164cbd, 0x71d9b4f54a196c3b, 0x7b423ea5481d6ba7, 0xe4cdb259872f9a15, 0x6bf381ecb623c981,
+    0xaec1947ba314b6ed, 0xf9286daed218e65b, 0x2bed81fcbde9f4c7, 0xa75e24d32efd1635, 0x41725cb65cef34a1,
+    0x934cab287be4631f, 0x7d342fc98af5617b, 0x16eb4f7a95e86fd7, 0x1cf9e24ba6fb9e45, 0x8ed54c6ba4fe9db1,
+    0xc47f5dbed4e1cb2f, 0xc3615ab212f3ea8b, 0xe95b3d1431d5e9f7, 0x84a619754feb1a75, 0xd1f6c8b76bec38d1,
+    0x17e68cb98ace374f, 0x1f8245adc9e265ab, 0x6482cd1edae68529, 0x75b84291f6e8a395, 0xc7b89d2326dba3f1,
+    0xf2b9185434cdb16f, 0x52c937f653a1dfcb, 0xc924365871c4fe39, 0x8c47f5198fc71ea5, 0x69e37d2a9eca4d13,
+    0x5739b8ded9ac3b7f, 0xcba3497ed7af49eb, 0xafc439821bd27a59, 0xb851796327d498c5, 0xda317c4656d9b843,
+    0xfd4bec3763cab59f, 0x6c824ab983aec51d, 0xf73a952cb2c1f379, 0xb6412e8dcfb613e5, 0x5628bda1fec94263,
+    0x764129532da941bf, 0x2ec86a543a9b5f2d, 0x1def68b437af5e89, 0x941c825767a28cf5, 0x49b8c17a96b5ac73,
+    0xe9a27f8cb386a9cf, 0xeba1723fe28ac94d, 0x58a34691f18de7b9, 0x47cebf2654c31927, 0x93817ae54fb52793,
+    0x736e9b254c9735ef, 0x4f7ceb287c9a546d, 0xb137e9287a8c63d9, 0xfba8761dc8af9247, 0x273e658fe794a1b3,
+    0x657c4a2fe596bf21, 0x8ebd63a21386be7d, 0x69dbfae43268dce9, 0x4b7f13e5418dfc57, 0xa9e123687f812bc3,
+    0xf9ea31dbae965b41, 0x24e8fb3cbc76489d, 0xc2ed18afec7a681b, 0xe6da2c91fa5d9687, 0xe8c1f632187f96e3,
+    0x9ef614354893c561, 0x21ba4c376475c3bd, 0x8fc36d2a9478e23b, 0xef9c6b5a926bf1a7, 0xd9b7642cbf8e3215,
+    0xcb36714dcd824f71, 0xb6437d51fa634ecd, 0x419a38521c576d4b, 0x8b4f6ea32a496cb7, 0x87deba65486d9b25,
+    0xc1b26ed8765fba91, 0x9cb58f4a9452b7fd, 0x61495ebdc254e76b, 0x2a6b54cdc148f5d7, 0xe94c73dfef6c1745,
+    0x168752b32f6e35b1, 0x751ced265d71642f, 0x54c729d87d54628b, 0xf8467c5a9b4681f7, 0x89ad62bcb83a9f65,
+    0xa6d3e84ba64b9ec1, 0x1e94b5dcb54eac3f, 0x43dc5791f342ec9b, 0x9d6fc4732345fb19, 0xcaf6d13762491b85,
+    0xe5d4fb376f4b39e1, 0x9adc3fe87c2d385f, 0xd97c1bfa9d3156cb, 0xdac84f2edc248639, 0xc34261dfeb2794a5,
+    0x8ebfc4d1f84ab513, 0xfe3154b2163cb27f, 0x7fed8c45453fc1eb, 0xfb31da787532ef49, 0x2b36ec5a92361fb5,
+    0xde72581baf194e23, 0x93c874fa9d1a3c8f, 0xf2a57e9dc91d4afb, 0x48f3ad61fc217b69, 0x85fc6e932b1389d5,
+    0xa76fe8d54a17b953, 0xd9216fb54518b6af, 0xb517ec39851bc62d, 0x734265fba31fe489, 0x6a39285dc62314f5,
+    0x73c5496dcef62473, 0x2719a5fedbe742cf, 0xad8f69132cfa614d, 0xeadc642328ec5fa9, 0x92d3c1e549df8e17,
+    0x24d1c3b767f2ad83, 0xfe49512875e49adf, 0xcf957b1a93f7ca5d, 0xf76da48cb2fae8c9, 0xb59fc8adc1edf937,
+    0x2183cd7654f128a3, 0xaf41dec54fe65821, 0x652d19b43ce8457d, 0xedcf73b65bda64e9, 0xf1bc5ed98aed9357,
+    0xd186aceba7df92c3, 0x8d51f2bed8e5c241, 0xc6592a1fe3c4bf8d, 0x13be79f213b6cdf9, 0x1d2f873432cafd67,
+    0xc856a39762be1cd3, 0xa56f2db98fd24c51, 0x47d615c87ec349ad, 0x1765facbacd7692b, 0xc831e7bfeadb6897,
+    0xd17b465fe6bc97f3, 0x87ad651328cfb671, 0xbde1c8f436a2b4cd, 0x9edc563875c6e34b, 0x2fad68e763c8f2b7,
+    0xd426c18ba4dc1325, 0xf3d2e58bafbe4291, 0x9157436bab914fed, 0x84f6c921fca36e5b, 0x3519bdc21ba56dc7,
+    0xfc1eab4328ba9c35, 0xfb2c1375468d9ba1, 0x4cda3e57658eb91f, 0xc7df258a94a2e87b, 0x1db26a5cb2a4f6e7,
+    0x6e94cdbfe2ca1865, 0x2d3b846fef9b36c1, 0xf6c149e21e9d453f, 0x2983f4e54ea1639b, 0xa41d26b76db58319,
+    0x59b241f76cb7a185, 0x7913f4dba6789fd1, 0x6547928a957bad4f, 0x5f82e91a936fcdab, 0x7c9ab1efe483fc29,
+    0x67cd129323a61c95, 0x293e871652983af1, 0x84b7d9654e7b396f, 0xbd9f73465c6e47db, 0x2ba875fcbda18749,
+    0xbc7185fedc8396b5, 0xeb2d981fea98b623, 0x3bd2475fe569b38f, 0x465791a2156ac2fb, 0x7689fbd4347fe169,
+    0xfdb215c9869421d5, 0xaf6e7c5ba1972f43, 0x8152bc798e573d9f, 0x4bd5f96a9e6a5c1d, 0x1c6a89fedb4e5c79,
+    0x592e8bd1fb618ae5, 0xb7e8f9c21c74ba63, 0x2d1ea4c32845a7bf, 0x1872efc54659c73d, 0x3f56ca48734ce5a9,
+    0xa9e4637ba36ef517, 0xbd7a493ed1942583, 0x9af1d83cbe5643df, 0xc64b5971fe49625d, 0xbf4e5a832e4b61c9,
+    0x7cbd9e343b4d8f27, 0x6394cbe76b51ae93, 0x38692dc767439bef, 0xc721b3fa9735cb6d, 0x1ad3f64cb437ead9,
+    0x5b97ac2ed23cfa47, 0x47b8e9cfe25f19b3, 0xfc5ad49762745931, 0xf63e57843f25468d, 0xc1a43f754d2865f9,
+    0x5f832b198d2c9467, 0x875a23c98a2e94d3, 0x3869f47eda62c351, 0xc9627d5fe734c1ad, 0x91746ecfe536df1b,
+    0x75e834c21429fe87, 0x39bf8457654b1de3, 0xd2bf5439824f3d61, 0x17925c687f124abd, 0xe78f314a9e156a3b,
+    0xc1b98e3dcd1869a7, 0xc1d8679feb2ca915, 0x472de3b1f92eb781, 0x7a35e8d43821b5ed, 0xac8615f76813e45b,
+    0x67231e498516f3c7, 0x9a83f7cba72b1435, 0x5bd931ecb52d43a1, 0x32be681a9ced521f, 0x3a564e7bace15f6b,
+    0xf46c39edcaf36ed7, 0xa359e6b21bf79d45, 0x8e2bcf5437f89cb1, 0x4dca12b546ecba2f, 0xd9187ae654efd98b,
+    0x831b6cda94d2e8f7, 0xb932578dc3f61975, 0xef4192adc2f937d1, 0x387fa6edcedb364f, 0x5b48e6c21fde54ab,
+    0xe2adb3165de18429, 0xe258b9476ce4a295, 0xfead54b769d7a2f1, 0x4dca215876c8ae5f, 0x4156f39874d9aecb,
+    0xfda8394ba4bfed39, 0xed8c26b1f4e31da5, 0xe7ca86f325e74c13, 0x37642ae541d83a7f, 0x6dc85b143fca48eb,
+    0x621e4bc54dce6859, 0xea3582698bd197c5, 0xb1832f9dcad5b743, 0xac3815fed7c6b49f, 0x32f678c1f6b9c41d,
+    0x3617b9a215bce279, 0x5fa8916434adf1e5, 0x439b26fa97d54163, 0xc1edb29871b53eaf, 0x6fd2ca487fa85e2d,
+    0x45916be87eab5d89, 0x2af4635dca9d7bf5, 0x6875a941f9c1ab73, 0x8fcb14721793a8cf, 0x6ea84fd327a6c84d,
+    0x5cafbd9434a8e6b9, 0x63bfc2a984acf627, 0x2df41c3ba4bf1693, 0xafbd683cb1a234ef, 0xc7694f8dcfa7536d,
+    0xfa8743b1fea862d9, 0xd5f864732eac9147, 0x7dafc2b32b7d8fa3, 0x2bf9d4376a93be21, 0x93d741565683bc7d,
+    0x3d2b8a498475dbe9, 0x6f2549bdc389fb57, 0xd38a46bfe48d1ac3, 0xa5132dcfe29f3a41, 0x89e732a431a2479d,
+    0xadec63143f95671b, 0x1587ab943e6a9587, 0xbe681c476c7b95e3, 0xb4ced5fa9a8eb461, 0x8adfe94ba871c2bd,
+    0xa2598b6ed785e13b, 0xcdab984ed365ef97, 0x5d8c2fa325791ef3, 0x174b8526548c3e71, 0x51cbf9d6516f3bcd,
+    0x14856f398f726c4b, 0xd692347a9e546ab7, 0x3e94817dcd689a25, 0x38d476bfea5cb891, 0xde1ab39fe74ca6fd,
+    0xbf9d58e32971e56b, 0xa8194e732863f4d7, 0x9cf87daba7891645, 0xb13e27ca957a34b1, 0x95617feba17c532f,
+    0xc1da394bae4f518b, 0xef5a637cbc426fe7, 0x5d23b4f1fc349e65, 0x4d9b5f632b479dc1, 0xa15e27f32849ab3f,
+    0xaf13b485463eda9b, 0xd62317e98752fa19, 0x543681cdc7641a85, 0x35219badc45738e1, 0xc4986bfed14a375f,
+    0x7e2ca31fef2d45cb, 0x98354ca21e2f7539, 0xcb39f4d76e4293a5, 0x6c8fb4598d57b413, 0xc3586de76a38b17f,
+    0x37146fb87628afdb, 0x9e65184ba62cde49, 0x956b73ded7421eb5, 0x92e43871f7564d23, 0xc47ab13214263b8f,
+    0xe3a957f6512849fb, 0x7bfe84354f1d5a69, 0xa6c9ef576c1f78d5, 0x89fd564bad12b853, 0x1764589dc914b5af,
+    0x89b6d35fe918c52d, 0xf3adb671f61be389, 0x7e5c61b4371ce2f5, 0x517af4d989514273, 0xdf8a56e9862541cf,
+    0x4df586ba92175f3d, 0xbda2c8376df75ea9, 0x2df35b9a9cfb8d17, 0x281347acbafe9c83, 0x3c7a942dc7e1a9df,
+    0xebf9d61218f3c95d, 0xe895a1b326f5e7c9, 0xb2e9843545eaf837, 0x482c5ab985fd17a3, 0x14fc5e2ba5ef4721,
+    0xe921a8bcb1f2547d, 0x9b641e3cbfd563e9, 0xd35e97b1fdea9257, 0xe796dca32deb91c3, 0xf64b397549cdaf31,
+    0x4ca9fd6547c1be8d, 0x87f143c656b3dcf9, 0x5c87623a94d5fc67, 0x73184cdba5e91bd3, 0x2a4583fdc4ed3b51,
+    0x94257e6fe1cf38ad, 0xe328d96541e3682b, 0x4d9c7f532fd48697, 0xa1e2cd754dc896f3, 0x821d93f76adcb571,
+    0xdb59c127679ea3cd, 0x87c24a1ba8c1e24b, 0x92a376bed6c4f1b7, 0xe632c7a1f7d93125, 0x259d846325ca3f81,
+    0xd86c1ba5429a3ced, 0x518f4d3761af4d5b, 0xd7e94cb65fa26bc7, 0x3eb6a4298ec69b35, 0xa81e67498dc7b9a1,
+    0xc7941d6ed79ab81f, 0xf8ade641f59ed67b, 0x6ef47a9328a1f5e7, 0xbd1e389439c41765, 0x56bd13e876b835c1,
+    0x63a5be4982ba543f, 0xbe537f1981ad529b, 0x4ed356fcbeaf7219, 0x63c2f79dcda29f75, 0x2dbaf491fb859ed1,
+    0x4e871c521b87ac4f, 0xa68921532768dcab, 0xf1d3bc65467deb29, 0x2fa5ec6987a21b95, 0x3918debcb6a539f1,
+    0xe7915a2dc2a7386f, 0x7d3c4e2fe18946db, 0xe9873d2fef8d7649, 0x19fab8621e7f84b5, 0x319a4e276e94b523,
+    0x7b9831c54c75b28f, 0xfcbd39e65967c1fb, 0xfe3a5219876adf59, 0xf6932dea946bfec5, 0x4d82519ed7912e43,
+    0x25a1863fe2743c9f, 0x26b8e7f323875b1d, 0x697f8234316a5b79, 0x1c6e5b943f4c79e5, 0x7edb4c987d5fa963,
+    0x5ebad1698c52a6bf, 0xad654f3cba75c63d, 0x56a1389ed857e4a9, 0x1db289efe86bf417, 0xbcfae653297e1483,
+    0xec217586567142df, 0xfc95742a9384615d, 0xb4e8df5981465fb9, 0x87f9cd2a9f4a8e27, 0x3c4ae52bae4c8d93,
+    0x3165defcb93d8aef, 0x287a9531f942ca6d, 0xd485f3921a34e8d9, 0xb85247d32a38f947, 0xa86b5c97675c18b3,
+    0x6781dc9ba76e4831, 0xd7682f1cb361458d, 0x9ea86b7dc15364f9, 0x891cab4edf289367, 0x758cef21fe4a92d3,
+    0x86b7f3243e4db251, 0xd7259bc4382eaf9d, 0x643a8de76943de1b, 0xe8dcbf576924fd87, 0x9e4ac1fba7481ce3,
+    0xa8bd1c6ed74b3c61, 0x5916a2fdc42e39bd, 0x9e8cab21f241693b, 0xdbf3ac15412368a7, 0x2bfad8454f27a815,
+    0x13f74ac65e2ab681, 0x1dca34e7691ba4ed, 0x128c64e9891fd35b, 0x614852dcb913f2c7, 0x5e41a83fea481235,
+    0x6f528341f73942a1, 0x9bec5a7325193efd, 0x34c52bf6531d4e6b, 0xf74ed5a983216cd7, 0x26fd4b787ef29c45,
+    0x7cf9a6487df59ab1, 0x1c645f398ae7b92f, 0xfb543a8dc6fad78b, 0x98e7fb2cb5ecd6f7, 0x652913e43af21875,
+    0x246d1e9548f536d1, 0x743ab51876e8354f, 0x6453ed9872f953ab, 0x8725d63ba1fd7329, 0xcde7539baedf8195,
+    0xa913864babc39fe1, 0x823a7cefe9c4ad5f, 0xac65431218e6adcb, 0xf91deab327daec39, 0xb79a683436cdfba5,
+    0xcde168fa98e24b13, 0x24cfe9aba5d4397f, 0x9a8e273ba2d647eb, 0xd3f4ba1ed1eb6759, 0x731eac5fefbd86c5,
+    0x5bd63e121ecfa643, 0x71a2e8454dc2b39f, 0x5c4723165ab6c31d, 0x5c4d3e165ac8e179, 0x5e49d7b876a9efd5,
+    0x3e5c186ba7bd1f53, 0xe425739dc5b13daf, 0x28bd5a61f3b45c2d, 0xda74619212d65c89, 0x97ed658431c97af5,
+    0xde2867454fbd9a73, 0x9c8e2bf54b8e97cf, 0xf5813c298ba2c74d, 0xe9baf58dc8a4e5b9, 0x248c96fed8b9f527,
+    0xcb87e391f7bc1593, 0x6fe4cab2169c23ef, 0xd4c7efb547b1526d, 0xd9237a6873b461d9, 0xc8f246ba91b68f37,
+    0x5286c4376f798ea3, 0x3461ecfa9e8cad21, 0x2e67ba9dc96fab7d, 0x2ae74891f872dae9, 0x9bcea6421b94fa57,
+    0x21f8ec6547a819c3, 0x6ab951c767ac3941, 0x2175aef8748e369d, 0xc278451dc4a2761b, 0xb1923a7ed1b39487,
+    0x382cf54dcf8794e3, 0xe7c485a1fe8ab361, 0xbac1d2532e6ca1bd, 0x26cbdf54396ecf2b, 0x9dac73b54a62fe97,
+    0x659cefd879861df3, 0x1f29deacb6893d71, 0x5e9af48cb4693acd, 0x567491ced27e5a4b, 0xc498ebd1f28169b7,
+    0xef3a87c43184a925, 0x59fdce243f56b791, 0xb3578fd43c48a5fd, 0xf2795d187a5cd46b, 0x53c1dea9895fe3d7,
+    0x2615cdbedb961345, 0x2a18cd3fe98743b1, 0x3e2c56dfe679512f, 0xd174ba32135a4f7b, 0x5afbde74324c5de7,
+    0x5d8ae7c982719d65, 0x146d9e587f549bc1, 0xbef531498d46ba3f, 0x89dfc21bac37d89b, 0x1b63cf8eda4ce819,
+    0xca5f314ed93ef785, 0xb6c58f732a6437e1, 0xf9e4a6c32947365f, 0x2bc1ea78763854cb, 0x23fdec9ba25c7439,
+    0x739bf5dcb14e82a5, 0x329fab1dcf64b213, 0x9e76f1bcbc23ae6f, 0xc28d3f91f925aedb, 0x6da14fc21b28ed49,
+    0xa23c8e94382afcb5, 0x7d561e98795f1c23, 0x29fcb4ea97423a8f, 0x3cef274ba62548fb, 0xd937c14ed32a5869,
+    0x261953cfe12b87d5, 0x75a9b86edf1ea753, 0x86e3c7543e21b4af, 0x25b8c9e76e15c42d, 0xfc527db65c16e289,
+    0x2fd5c4a87a29e1f5, 0x8ad96f5cba4d2173, 0xec2574ba961d2ebf, 0xaf163e2dc7125e3d, 0x76c482d1f3145da9,
+    0x8a156de434298c17, 0x93edb146521c9b83, 0xd619fa843ceb98df, 0x21c876a54aefb85d, 0x75c13de87af2e6c9,
+    0x1586baecbae5f637, 0x28ba4c9ed8f916a3, 0xd27c483fe8fc4621, 0xe4f13ac216fe437d, 0xca7b321545f162e9,
+    0x82dc463983f49157, 0x6b74931871e68fb3, 0xc6f731e87fd9ae31, 0xb36def8769ebac8d, 0xfe5c8bd987aecbf9,
+    0xbd94ce6fe9d2fb67, 0xfa8db95329e61ad3, 0xbef8347548e93a51, 0x7acd243545eb37ad, 0x187e5bc984de572b,
+    0x2a4d96ecb3e18597, 0x1e6b32dcb1d495f3, 0xcf98ea6dcfd8b471, 0xd9428a51feb8a2cd, 0x2784bec32eacd14b,
+    0xd526bf83289edfa7, 0x5abfd2e87ac42f15, 0x23579ae879c63e81, 0xfa5ec76985a73bed, 0x4159d6ea93da4c5b,
+    0x3bfad81ed2be5ac7, 0x3df8bce1f2d19a35, 0x3c1a87b432d4b8a1, 0x879e52d43ea6b71f, 0x78bd36243ea9d57b,
+    0x318e24765a9bd4e7, 0xc72db1a989aef365, 0xdb98cf4ed9b534c1, 0xa782356ed8b7523f, 0xf74d3861f4c8519b,
+    0xe8b6a342139a5ef7, 0x1e6c72f432ad8e75, 0x63a41fe763a29cd1, 0x831b2ad76e83ab4f, 0x68951dc76e75d9ab,
+    0xa61be3dcbc78ea29, 0xa1236c9eda7cf895, 0x16cd783ed79e28f1, 0xf1c57a8219a2376f, 0x48b615a3279645db,
+    0xf83be95763ba7549, 0xe26179c8729c83b5, 0xb38e167cb19ea423, 0x7c8ef34bae72b18f, 0x57be986a9c63afeb,
+    0x3c4fe721fb76de59, 0xbed574c21a68fdc5, 0x4b9efd865a8c1d43, 0xc63ef195476e2b9f, 0x187c4f6a97835a1d,
+    0xf715b62dc3845a79, 0xefb85a1dc26978e5, 0x54832b7fe17ca863, 0xc7564b9dce4d95bf, 0xb9782f532f71c53d,
+    0x564197232d64e3a9, 0xdbc3a1565c68f317, 0x7468cfda9c7b1283, 0x9d6ce75a986b31df, 0x1835d94ba76e3f4d,
+    0x5749268ed4625eb9, 0xefd72a81f3658d27, 0x64b87d9212578c93, 0x69ad1ce4314a89ef, 0xc394b2f54f3eb96d,
+    0x51a8d6b76c41e7d9, 0xe1dc84abac53f847, 0xc6a2b84edc5817b3, 0xc48b53efea6b4731, 0xeb462591f75c348d,
+    0x7b91ef42174e53f9, 0x83b4cf9548539267, 0xdabf1429845691d3, 0x9bc1d86a9258af41, 0x6d9483e76f28ae9d,
+    0x472bce898a3ecd1b, 0xba5f3c2edb31fc87, 0x6c78ed91fa451be3, 0xe5c476a32c483b61, 0xc82ab645472938bd,
+    0xe4d21637672d583b, 0xc17524ba942f56a7, 0xc812b45dc643a715, 0x7d391f5ed236b581, 0x9e5471bcbf17a3ed,
+    0x9fb572d1fe1ad25b, 0xabde61743b2de1c7, 0xbe2586d98d642135, 0x349762a87b253f91, 0xf3bce46878163cfd,
+    0x7f1a2dcba7194d6b, 0xed2a36fba41c5bd7, 0x21a856bed31f8b45, 0xd69cb571f423a9b1, 0x46b31d754315b82f,
+    0xa7564d932ef5d68b, 0x1db295843be9d5f7, 0xd3ac24f76aecf475, 0x5aeb438989ef25d1, 0x1365f42cb9e2534f,
+    0x2f5c684ed7f652ab, 0x61db583fe5fa7129, 0xade96b8213eb7f85, 0xca4f7d6543fc8de1, 0xb43928e762e1ac5f,
+    0xf927ba565fe3dacb, 0xcd7125687cd6eb39, 0x9e3dfcb87bd8f9a5, 0x9376facdc9ed2a13, 0x5cad2b8ed6ce287f,
+    0xdf8719e218d246eb, 0x249e1fc328e47659, 0x6cb23fe763e984c5, 0xd723468982eca543, 0x29abdec871cda29f,
+    0x216e478a9fb3c21d, 0xf6d3e41bacb3df69, 0x67423eadc9a6fed5, 0x4ed5fc632bca1e53, 0x1c93f284379b2caf,
+    0x978bf4a657af4b2d, 0x5e39d21876d25b89, 0xfa318c6ba3c479f5, 0xc19f3ebdc2d8a973, 0xd2b9f61ed1ba96cf,
+    0xaf76298dcf9eb64d, 0xe718ac632fa1e4b9, 0xe29bf8a43db5f427, 0xcd5681276dc81493, 0x19d6e52768a932ef,
+    0x16b4729a98ac416d, 0x61f4e7aba58e4fc9, 0x354f7d8ed5b28e37, 0x4685b9f1f2b58da3, 0xba98251434b8ac21,
+    0xb2173ef43189ba7d, 0xb9c537d43f6dc8e9, 0xc89a64e76da1f957, 0xfb5c2d9a9da518c3, 0xacf1749edcb93841,
+    0xec31d96fe78a359d, 0xea583261f79d651b, 0xf649e5c215af6387, 0x8eb32cf656a492e3, 0xd54863c984a7b261,
+    0x59a2d87651769fad, 0xb1ca37587f69ce2b, 0x184a63598b5ced97, 0xfcd796aedb821cf3, 0xe693c2a1fb953c71,
+    0x3ba15e621a7639cd, 0x67541fc3287a594b, 0x5e1ca264346d58b7, 0x6ade1c9ba47f9825, 0x721349fdc483b691,
+    0xb368a5ecb175a4fd, 0x46fc5b3dcf58d36b, 0xb893adc1fc5ae2d7, 0x7265d1c32c7df145, 0xa1fbe9476d8342b1,
+    0xb39ae8576a754e1f, 0xfc5e78a989564e7b, 0xc7fa941ba6495ce7, 0xbf2e384cb34d8c65, 0x18f2ab9ed35f8ac1,
+    0x4281a5efe162b93f, 0x5ba21d732154d79b, 0xb8cf95143f48e719, 0x3894a7e54d3bf685, 0xf4c582d98b5d26e1,
+    0x9e68f71bab71345f, 0x769bd82ed96453cb, 0x9e6824cfea587239, 0x7b2df841f64b81a5, 0x8bcfe2d3254b8ef1,
+    0x14d73fc5423e9d6f, 0xefc15db76142acdb, 0x1aed25b87f25ec49, 0x58d671e98d27fab5, 0xfd35ec2bad5c1b23,
+    0x7e458fbdca3d298f, 0xb8d2a15fe93147fb, 0x54cb8f621b235769, 0xe19b26c4392786d5, 0x64712bf9872ba653,
+    0x39b7fdc8742c93af, 0x315d2e7a914fb32d, 0x7498e5acbf23e189, 0xc3d159abab14dfe5, 0x5bd4a18fec291f63,
+    0x7f1c53643a192dbf, 0x5ef21386591e4c3d, 0xdc42b65768215ca9, 0x8f6d193ba9248b17, 0x8ef5396dc5169a83,
+    0xf396248cb31897df, 0xc5da724fe21cb75d, 0x913c2eababfed5c9, 0x56c217832de1f537, 0xa7c6e4354df615a3,
+    0x57c34f987cf94521, 0x159f346769fa427d, 0xc6feb38987fc51e9, 0xe4d6932ba5de6f47, 0x132576fdc5f28eb3,
+    0xd5ae716fe4f6ad31, 0x7164ce5212f6ab8d, 0x3d6759b431e8caf9, 0xd79bfc243fcdea67, 0xd25ac6387ce219d3,
+    0x8f1d946bace63951, 0x31d7268cb9e736ad, 0x84b261fed8ea562b, 0xd6a3b541f5ed6497, 0x96c1e74216ce84f3,
+    0xedf2c13656e4b371, 0x4c132bf763e5a1cd, 0x9236f1e761d7cf3b, 0x238574c65fb9dea7, 0x8cf51e498bacfd15,
+    0x146d25bfebc23d81, 0xfcde3851f8b43aed, 0x8fa16b4219d74a5b, 0x61f5ea8326da59c7, 0x6d892b3546cd8935,
+    0x6b3cad2764cf97a1, 0x9cd7f28a94c3b61f, 0x4e2f985ba1c5d47b, 0x4dfeb23cbfa8d3e7, 0x9d73c12fedabf265,
+    0xb21e78454dae23c1, 0xbd1952e76cb2513f, 0xf18e2a3659a34f8b, 0xa23be6f548a65df7, 0x43527e9a94ba8d75,
+    0x84cfe3dba49c8bd1, 0x1a956b8dc28e9a4f, 0x6937ed41f192d8ab, 0xa6b1e3c431b5e829, 0x62ed45732ea8f795,
+    0x5e8c9f165d9b27f1, 0x21f94ce87b9d256f, 0x3eb278a98a9154db, 0xf5ca13dedab57349, 0x235e6b8fe6a782b5,
+    0x6a295731f69ba123, 0xb5468ef2136b9e7f, 0x1dc8e5a4326f9deb, 0xd2c9be176182ed59, 0x8f2da5476e74fbc5,
+    0x3d4172cbae891c43, 0xfe4cba798c6b2a9f, 0x2c4159edca7e491d, 0xface5821fba15879, 0x3f7195621a9387e5,
+    0x9d1ec8232598a763, 0x18423ed6536894bf, 0x82561739827cb43d, 0xb87fad49816fd2a9, 0xfd4a563cbe84f217,
+    0x97ab2c1ede972183, 0x97f34c1eda572ecf, 0xf4bd57921b6a3e4d, 0x64cb7ef3285e4db9, 0xea72f1c65a618c27,
+    0x97d25f6ba7648b93, 0xdf37918ba34598ef, 0x2f98b3adc249b86d, 0xa81d726fe14bc6d9, 0x73e2891dcd3fe647,
+    0x6798fa232f7416b3, 0x8f123ea65e784631, 0x5369ab476c59438d, 0x9fd723b87a4b52f9, 0xe249f61cba4e8167,
+    0x5d376f9cb7518fc3, 0x56a4c93ed765ae41, 0x64d58e21f235ac9d, 0xc986d7132348dc1b, 0xea4f81d5413ceb87,
+    0x5b9ade265c2df9e3, 0xc16e35ba9e543a61, 0x9bef132a9c2537bd, 0x2a7df31edc29573b, 0xc2735b9fe92c65a7,
+    0x49e6b8c1f83e9615, 0xa2967cb43952b481, 0x5a748ce65634a2ed, 0x387a54298437d15b, 0xaed192676128dfb7,
+    0x2eb863f98d1bfe25, 0x945238abac3f2e91, 0x4e8bfa2dca123bfd, 0x63d7a4e1fa154c6b, 0xba4f8c732b185ad7,
+    0x5be3af74391c8a45, 0xef2c8596562e98b1, 0x9ef5cb3a9631b72f, 0x27e9158ba413d58b, 0x9a78fd3cb216d4f7,
+    0xebf5617cbde9f375, 0x62e874cfecfb24d1, 0xe6dacb921bed324f, 0x94dc16e54cf251ab, 0x7b3d12565ae46f19,
+    0xa1b2e38549f67e85, 0x6bca517875f98ce1, 0xa8f74b6983ec9b5f, 0xc8fd4e7982efa9cb, 0xd18239bed1f2ea39,
+    0x2ca54f8321e4f8a5, 0x7f41d3a65fea2913, 0x1634bec54cdb267f, 0x4df3cbe769cd35eb, 0x1cf9578babe17459,
+    0x9137efacb9e483c5, 0x1dc934bed7e8a243, 0x5c697e4fe4d8a19f, 0xabdc651213ca9efb, 0xeb36f28432bfce69,
+    0x6de235a761b2fcd5, 0x18b47ad98fc71d53, 0xc4e3ad976dc72baf, 0x6cde4f8989cb4a2d, 0x54b3a97ed7ce4a89,
+    0x4ab3c15fe9c178f5, 0xedca143219d4a873, 0x2187daf324b695cf, 0x68ba1c4763c9b54d, 0xca83f94762acd3b9,
+    0xd6f872ba91bfe327, 0xd5b261ecbfc51293, 0xdb728e3cbca631ef, 0xa896d32feba83f5d, 0x41d5e8c21b8a4ec9,
+    0x841f57b329ae6d37, 0xaf37db1657b18ca3, 0x3ac6e57987c5ab21, 0xc15e8da983a5b97d, 0x42e635dcb2a8c7e9,
+    0x73a9fdced1ace857, 0x275b49acbd8ef6c3, 0x1c742df32fb53741, 0xc2ab6d732ea6349d, 0x3142dfc65da9641b,
+    0xf973ad265bac6287, 0x83a2fe5ba79d81e3, 0x986e312dc792af51, 0x5fae348dc4739ead, 0x849c3e61f386cd2b,
+    0x71ef3ac21268ec97, 0x89a31d65417beaf3, 0x1f73bc865e8f2b71, 0x1c3298476e7238cd, 0xde6f513bad96584b,
+    0xa13b8fdedc8956b7, 0x9dbe563fea8c9725, 0xc8b9e651f67ea591, 0xa1c457632671a3fd, 0x19ed67543584d26b,
+    0x5b7f98165386e1d7, 0xe2d641c98179ef35, 0xa78cdf398e6c2fa1, 0x8b2e476a9b6e3d1f, 0xd23e5c8fec624d7b,
+    0xa37edc21fa645be7, 0xa4ef85721c498b65, 0xd62a1e94375b89c1, 0x4936d1b5465da83f, 0x52b3a6f98451d69b,
+    0x27afb8ecb374e619, 0x84eca5fdc167f485, 0xa7c6e23dcf6a25e1, 0xa719e2cfed6c235f, 0x5b1349821d5f42cb,
+    0x573c42b65d647139, 0x9de258476b347f95, 0x9f163be769478df1, 0xd6b7ae29853a9c6f, 0xf3daeb79843e9adb,
+    0x4d592a7ed351eb49, 0x6278195fe143f9b5, 0xf58931b654681a23, 0x32d6bc154e3a278f, 0x1dba5e365d2c36fb,
+    0x1c42ef598c2f4569, 0xc795a38bab3284d5, 0x3784acdedb27a453, 0xfa85321ed63792af, 0x7ea26541f64ab12d,
+    0x1385c692142dcf79, 0xe1caf3976431fde5, 0xefc4652a92451e63, 0xbf415ae87e162cbf, 0xc72416f98e194b3d,
+    0xade832798c1d4ba9, 0xf532174edb2f6a17, 0xf364ab81fb12a983, 0xeb168c23281496df, 0xfa7816c43718b65d,
+    0x31d5cb87651ad4c9, 0xd8c562ea951de437, 0x9a7fc1edc65214a3, 0xa7d35b2cbef65421, 0x28d541bcbcf6417d,
+    0x2b349a8dcae74fd9, 0xfb6e49c21afb6e47, 0xe78d1c9328fe7db3, 0x9fecd51768f2ac31, 0xa94dc6b765f3ba8d,
+    0xa2be671873e5c8f9, 0xd1b8572cb2fae967, 0x9c246faba1ebf7d3, 0xae45c81dcedf2851, 0xe5b837c21fe235ad,
+    0x67fcbea43de7652b, 0xfcb326e54cea6397, 0xf43cb6a769db82f3, 0x7c563d2a98dea271, 0xd7e534a985c19fbd,
+    0xe289cf5ba5d4ce3b, 0x796f2dc1f2c5eda7, 0xb1ad472323d9fc15, 0x3ade1cb653ed2c81, 0xdfe7ab454caf29ed,
+    0xba5793f87ed2495b, 0x48ce261a9bd458c7, 0xe9f5843dcbda9835, 0x1c98a6bfe7dc96a1, 0x5374e2afe6bda51f,
+    0x4cafd86326c1d37b, 0xf61238a435b4d2e7, 0xa4b9de7873c8f165, 0x523bde7984da32c1, 0xebf72ca87d9b3e2f,
+    0x34f1c2687c9f3e8b, 0x4b1a637edba25cf7, 0x7564ef31fab48c75, 0x7b9ce48329b78ad1, 0x7a25bf83268ba94f,
+    0x1cf87a54348ec7ab, 0x784ef3c985b1e729, 0x1d76e2fba2b3f695, 0xe72fb95dc3b826f1, 0xa15e982dce9a246f,
+    0xc427a5f1fe8c43db, 0xf98a15421daf6249, 0x3f28a6454da381b5, 0xf4831ed65ba69f13, 0x1f89724545869d7f,
+    0x36f47d5874689ceb, 0xc7f1659ba37edc59, 0x2346b9ded381fac5, 0x84f6cbe1f2a61b43, 0x7fc152b431a6289f,
+    0xd15c8e343f7a481d, 0xe2c5b3d43e8d4679, 0xea1bc9d54b8f76e5, 0xf578a12cbc92a563, 0x8b3e426dc87593bf,
+    0xba9dc43fe678b23d, 0x8e6fa471f46bd1a9, 0xbd493a82136bcef5, 0x462d8ac765921f73, 0x2a5fde1761742dcf,
+    0x75f281d98f673c4d, 0x725d4e387e584cb9, 0x9cea3d1bac5d6b27, 0x1567fd4edb5f7a93, 0x3ba91c2ed85297ef,
+    0x4f518be21954b76d, 0x84bacf532647c5d9, 0xa5d174c9836be547, 0x8ef167c9826df4b3, 0xe6fc732dc6924531,
+    0xb17a426cbf65428d, 0x14c5ba7dcd4751f9, 0x5a9de31fec3a6f57, 0x6de493a21a4b7ec3, 0x5287d1b43a5f9d41,
+    0xf9de53765742ab9d, 0xb512d4a98745da1b, 0x829d541cb436ea87, 0xd852a4ecb24af8e3, 0x7ad4b12ed35e2961,
+    0xc685374fef4136bd, 0x9c1b37f21f24563b, 0xd8315ae43e2864a7, 0x13fac4287d3b9415, 0xe217b5687b4da381,
+    0x8534acb9873f91ed, 0x345ade2ba732cf4b, 0x1b7ace3dc524deb7, 0xc59b24dfe438fd25, 0xdac852e4354b2d91,
+    0x3d28bf96513c2afd, 0xfd9be5c87f214a6b, 0x251ce3d98e1359d7, 0x5e943fdcbd178945, 0x56d9bf2edc2a97b1,
+    0xb76fc45ed81ca62f, 0x5649eb2fe61fc48b, 0x24a8bde54812d3f7, 0x63ac12454816f275, 0xf735d6e9864923d1,
+    0x35e7bf9a952b314f, 0x3f129bd76dec3f9b, 0xa32f5e498bdf5e19, 0x658eb13dcbf27d85, 0x4ba1523ed9f58be1,
+    0x7afd81b218e79a5f, 0x427fedb325f9a8cb, 0xb7fca29545fed839, 0x625e374984e1f7a5, 0x6b5189acb5f62813,
+    0x723645bcb1e8257f, 0xa34dc71bafd934eb, 0x2ecfb461fced6359, 0xb7d345e21bdf72c5, 0x9bc346276ce5a143,
+    0x137d6ef437c49e8f, 0xbf6318c545c69dfb, 0x71feb3a874eacd69, 0xc6f4e75983acebd5, 0x67fd1b2ed6e21c53,
+    0x7c8e5d6fe1d429af, 0x9abe618431e7492d, 0xc87eda232fdb4789, 0x1e25b8d43dbc67f5, 0x984ed5365bcf9673,
+    0x2d5317a878b294cf, 0x85f7c16ba8c6b34d, 0x1638bd4fe5c7d2b9, 0x4ab328f1f5cbe127, 0x9fe6731214acef83,
+    0xa5edf23654a12edf, 0xe4dc932871b43e5d, 0x15be79f65fa64dc9, 0xf35e6ac98eba6c37, 0xd2a34c898c9d7ba3,
+    0xa74c913ed8bf9a21, 0x438d5ea1f6a2b87d, 0x9d4ebf7217a4c6e9, 0x91da25e324b9e657, 0x342d1897649af5c3,
+    0x52b1c79a95be2641, 0xda7e6f4ba2b1439d, 0x52b76afdcfa5631b, 0x7dc1928edeb96187, 0x5361bc4feb897fd3,
+    0xc1d5e9832b8c9e51, 0x6a5db823276f8cad, 0xa2f578c65783dc2b, 0x2c5681b76584eb97, 0x92adc47ba487e9f3,
+    0x3d298b7ed49c2a71, 0x8fe41a6cb18e27cd, 0x841dcbafef91574b, 0x3ae4bf621f9365b7, 0xa23bf5e43ea89625,
+    0x3452adb65d7ba491, 0x82dbf546586b92fd, 0x985c47fa987fc16b, 0x2c8491eba562dfc7, 0x79e1c34dc486fe35,
+    0x568fbd91f4782ea1, 0x158294e3247a3c1f, 0xd8243be5416e3c7b, 0xa94f8c254f615ae7, 0x3de62c5a9e738a65,
+    0x71f859abad5698c1, 0xc8496e2dcb59a73f, 0x45a1e26fe74dc59b, 0x2946ed5fe76fd519, 0x46b9e1521972f385,
+    0x298f1db6568724e1, 0x73c1de498479325f, 0x68ebfda9826a41cb, 0xd753cf198e4d5f29, 0xf78a49ecbd417e95,
+    0xa87df69edb548cf1, 0x14c2a8efea359b6f, 0xcd7139f21837a9db, 0x2ae89c63273cda49, 0x4a12f395463fe8b5,
+    0x6f38b4dcb8751923, 0x3df26a4cb345268f, 0x285baf7dc14835fb, 0xd2954caedf2c5469, 0x678abd21fc2e73d5,
+    0xe21ad6354e61a253, 0x193fcd765c3491af, 0x3f952cd65936af1d, 0x7895b4265628ce79, 0xf7a1ed49862adce5,
+    0x8da7913ba52efc63, 0x8b96f41ed5432abf, 0xa57e3b21f1264a3d, 0x5ed7c3a4312748a9, 0xe63db4f54f2c6917,
+    0x524df9e65d1e9783, 0xade7f5387b2195df, 0x5b8376ca9a13b45d, 0x38eb4facb816d3c9, 0x9a3c7bfed81ae237,
+    0x6e58a4bfe62cf1a3, 0xecd8f527685f4321, 0x7e32154875123f6d, 0x2deca47872154ed9, 0x8df17b465ef86d47,
+    0x35149c876df97cb3, 0xd71532698afd9b31, 0x265a79dcb6efa98d, 0xf65ca34ed6e2c7f9, 0x987cf4a219f4e867,
+    0xf24bc59325e8f6d3, 0x37bce58986fc2751, 0x4f1d9a2873fe24ad, 0x2e35fa7ba3f1642b, 0x9174df3cbfe46297,
+    0xa96fe73cbcd781f3, 0x4785639febda9f61, 0x7b4f91d217ca8ebd, 0x85da67c327cfad3b, 0xbadf2e4546d2eca7,
+    0xe7b318d987d6fb15, 0x6593dc1ba5e92b81, 0x385f7cea93ca28ed, 0x962b718dc1de385b, 0x7b4c2aefefd156c7,
+    0xd7a3f9821fd49735, 0x7185cf643ed795a1, 0xf215ae365bc9a41f, 0xc82943d658adc27b, 0x21b6cf4986afc1e7,
+    0x2a5391fba7b2ef45, 0xc6a74d3ed5c62fb1, 0xb6d7a35fe4b83d2f, 0xdfc9748212ca3d8b, 0x25c1398431ad4bf7,
+    0xa6423b754fc18b75, 0x5f23d9a76eb489d1, 0x975d16b87cb6a84f, 0xf42d7cbed798c6ab, 0xa75db28fe7acd629,
+    0x5dc6f79ed6afe495, 0x2eda136438b425f1, 0x3be7a84545b7236f, 0xe43815d763a842db, 0x2c6e817982bc6149,
+    0x746ab5387e8d6fa5, 0x38271ebcbda29e13, 0x53b821aedb839c7f, 0x7af6ec51f8759aeb, 0x3ea64f721a78db59,
+    0xdc798f43267be9c5, 0xdc45b3e6568ef943, 0xc87abe4985a3279f, 0x6ae981fcb3a6471d, 0xa4fb1c9ed1ba4579,
+    0x296758fdcf8b74e5, 0x7f2db891fd8e9463, 0x68ab13f43d7192bf, 0x768cda154c85b13d, 0xe8f621a43a65cf89,
+    0xaf91d8354768cdf5, 0x2ebd864a956bfd73, 0x84b137ea946e1bcf, 0xdba7c83fe5823b4d, 0x3de6c721f1754ab9,
+    0xb29f836431896a27, 0x478a96532f5c7893, 0xc8d571343b4c86ef, 0x28c356f98c71b56d, 0xdec578198a63c4d9,
+    0x9c81ba7dca68e347, 0x786f43ded769f2b3, 0x236f4c51f78d2431, 0xfc7e1a93256f318d, 0xfb57cda653624fe9,
+    0x82cd764a91846e57, 0x1fb23a576f487dc3, 0x3d4e68598e5b9c41, 0xdf46e9b87b3e8a9d, 0xa824e51fea52d91b,
+    0x8a5b7f91fa43e987, 0x148c9e721946f7e3, 0xf16ae975495b2861, 0x2f5179a8764c25bd, 0x28439eba926f453b,
+    0x3c65be1dc15263a7, 0xf53a14edcf479315, 0x64928f1ede49a281, 0x587b1c2fea298fcd, 0x631f75c2192dae4b,
+    0xda7ec4f54931edb7, 0xf5713ce87934fc25, 0xd2c9543ba8472c91, 0x89c4613ba53829fd, 0x965ac78dc42d396b,
+    0xa6b7e18dc12f48d7, 0x98cb374fef129845, 0x8c5f96143f2596b1, 0x63f17c454d18a52f, 0x93fcba265d1ac38b,
+    0x49bf18d7691dc2f7, 0x71d54a8cba32f175, 0x5634c1edc94632d1, 0x5f94362dc6172e3f, 0x67f3bed1f4183e9b,
+    0xcedb2f74342c5d19, 0xfd728395421f6c85, 0x2b5719365df28ae1, 0x41be98f76ce3a95f, 0x435f8ec769f5a7cb,
+    0x92864fecb8fad739, 0xe316589cb7fce6a5, 0xe4fb729dc7def613, 0x18ab5d4218e3247f, 0xa41c769325f643eb,
+    0x62d79cf873fa6259, 0x84f21ba982fb71c5, 0xe3174af87ecd8f23, 0x7af961d87bc19d8f, 0xf1dc38aba8d39cfb,
+    0xf9eb2d51f8e5dc69, 0xf53b9dc217c8ead5, 0x4cd87bf327dcfa53, 0x4e67df8545ce18af, 0x89cf537a96e3482d,
+    0x14b389acb2e54689, 0xb6f571dcb1d976f5, 0xf1973a5cbfdc9573, 0x23eb78cfebad83cf, 0xb561edf43ec1b24d,
+    0x2d7a1f843ac4d1b9, 0x9adb26f549b6df17, 0x7b13aec656b9fe83, 0xb371fde8759a1cdf, 0xdb64795a94af2c5d,
+    0xebd62c4fe3d24bc9, 0xe5c84761f1d56b37, 0xdfa985e321d879a3, 0xc23fb6d54fbca921, 0x71b2d9e43c9ea67d,
+    0xdfe463576ba1c5e9, 0x94c5326a9ab3e457, 0xd8625f3cb8a7f4c3, 0x8ce9374fe8cb2541, 0xa569e421f5ac329d,
+    0x7ab251e436af521b, 0x2fcbea8543b25f67, 0x81b9a5f761a57ed3, 0x5dc6ab476fa89d51, 0x279153b65e698bad,
+    0xd572f3b9897eca2b, 0x75b43f1edb81ea97, 0x41b763ded794e8f3, 0x326d85e43ab82971, 0x3b61cd94358926cd,
+    0xa4b63e18759d364b, 0x3b8a2e19829f54b7, 0x7e65382dc1b39425, 0x984fa36dcf86a391, 0xdfa6958cbc6791fd,
+    0xca3b4d9fec69af5b, 0x57e46b32195dbec7, 0xa9b7e2854a81fd35, 0x9d125ce769852da1, 0x715b46fa96873b1f,
+    0xf516e4bdc4693a7b, 0x1d7a5e2cb26c49e7, 0x4d56f98ed18f7965, 0xb183d2efef6397c1, 0x1e8ac9621e75a63f,
+    0xd5bf9c432e57c49b, 0xc294d5165c6bd419, 0x57962a487a6de285, 0x3f41e7bcba8423e1, 0x8291fc6dc986315f,
+    0x4a8bf56ed4563fab, 0xc5f7ba61f36a5e29, 0xfe63da92124c6d95, 0x36af4eb5425e7bf1, 0x34ab85965e429a6f,
+    0xfe549c676e34a8db, 0xf847231bac37d849, 0x53a896bdc93ae7b5, 0x7f64ac3dc95df723, 0x3dae5c1fe961258f,
+    0xe139f4c2186534fb, 0x6dc9be5327485369, 0x2ad7e649834a72d5, 0xd3fc84eba26d9153, 0xc3bdeaf76c2d7e9f,
+    0xc13b2e4a9c43ae1d, 0x1e6ca92feb24cd79, 0xef5c3ba1f927dbe5, 0x51693b82192afb63, 0xfe173d65473d19bf,
+    0x2dac47187851493d, 0x1e873dacb62347a9, 0x6efca28dc4396817, 0xbd62c13ed12b9683, 0x8137249bae1b84df,
+    0xdc1ea25fec1fa35d, 0x94ad32854e13d2c9, 0xd7a43e565c26e137, 0x7b9de2565a17ef93, 0x429b3df767291def,
+    0x8b9c47da971c2e6d, 0x1edf28acb6214cd9, 0x6bd47cafe5136c47, 0xa65482f1f2167ab3, 0xacde7b96542b9a31,
+    0xd7a86e932efba78d, 0x82d759643aedb6f9, 0x4e316ac98bf1e567, 0x58af746989e4f5d3, 0xb1cf695dcaf92651,
+    0xb7c86a4dc6f923ad, 0x52376e9fe6fd532b, 0x9a26d58324ef5197, 0xb4caf8d654d27fe3, 0xe1c97fb872f59e61,
+    0xe92bc3d54fe68cbd, 0xdecb26476de9ac3b, 0x4b539a8768cedba7, 0x7a2fb6edc9d2fa15, 0x875cb9f1f9e52a81,
+    0xa5bdf37218c627ed, 0x6d5f928326ea375b, 0xdea1642763ed45c7, 0xbf1784ea92df8635, 0x4521f9dcb2e394a1,
+    0xe4635fda9ec6a31f, 0x5f68c12baed8c17b, 0x94be315fe8a9bfd7, 0x1638ecf219acde45, 0xdf58b74659c32eb1,
+    0xeb9f4ca768b53c2f, 0x36fa7e1875d63c8b, 0xa7e3d82983c94af7, 0x93af854cb2cd6a75, 0x41fb862dc2bf78d1,
+    0xd942c87edeb2a74f, 0x17f4ed321f94c5ab, 0x16fe82343eb8d529, 0x419237f54cabe395, 0x14326af7689ce3f1,
+    0x5d1ac2eba9b1326f, 0x87a36b5dc7a541db, 0x4cd3527ed4b75f39, 0x98cb46e1f2b96ea5, 0x4fceb81324ac8d13,
+    0xcabf3d74319e8b7f, 0xeabf29d54f72a9eb, 0xa265cf176e84da59, 0x6e3fa9d76b97e8c5, 0x5c37e81dca9bf843,
+    0x2c17935dc78d169f, 0x758ba9d1f8a2461d, 0x8d7ce43218b35479, 0x1a4bde7324a873e5, 0xceda25f874ab9263,
+    0x49a1df37627c81bf, 0x31a752687c6e9f2d, 0x62813a4bad62ce89, 0xabe495dcba74dcf5, 0x2cd1a65fea68fc73,
+    0x8f69724328691acf, 0xf675e284387e2a4d, 0x795a3c26567148b9, 0x5d236becb5a46927, 0xabf4e82dc2a68793,
+    0x3578196cb16985ef, 0x23b7af8cbf5ca46d, 0x82d143afec5fb3d9, 0xf95463b21d83e247, 0x3b8d7fa54c76f1b3,
+    0xd1a26f787c8a4231, 0x938a2d67685a2f7d, 0xe2f86719865c3de9, 0x8c3196bdc4816d57, 0x1b5d74cfe2647bc3,
+    0x257b9461f2679b41, 0x29578be32147a89d, 0x892671e43f4dc81b, 0x6d178b254c3fd687, 0xf1835ba98b52f6e3,
+    0xd176952cbc582761, 0x743b561dc95824bd, 0x1cd493efe86c543b, 0x9e7f3281f64e52a7, 0x67dab21548739215,
+    0xef8cb15763549f71, 0x43be296761358ecd, 0xdca9f4376f28ad4b, 0x685b3d476e2adcb7, 0x7f1eb24a9a3feb25,
+    0x235eb76fec542b91, 0x945cde6fe93528fd, 0x5f36a7821a29386b, 0x91532cb4382b46d7, 0xf7d9146a962e8745,
+    0xcf185a6ba64295b1, 0xb89e35dcb135a42f, 0x87d12c3baf16c28b, 0x23a981bcbd29c1f7, 0xc51e784fea1bdf65,
+    0x92a8b7f4392dfec1, 0x9ba48d276a142d3f, 0xae9261c768153d9b, 0x413f95eba7285c19, 0x5437a2cba41c6b85,
+    0x1b3895fcb42d79e1, 0xb7dcf19ed321a85f, 0x78fb359edef2a6cb, 0xd9fb31721ef5d639, 0xf14ae9d32cf8e4a5,
+    0xc5a291476aebf513, 0xbe96123769ed137f, 0xf8e2bc9a98f142eb, 0xe6419badc8f46159, 0x59ef7badc3e76fb5,
+    0xb1647faed4fa8e23, 0xafb7de3212eb7c8f, 0xaf9c3e7431de8afb, 0xdbc617854fe2db69, 0x9b2df5c76bc4e9d5,
+    0xa162c4587bd8f953, 0x326e47ca98db17af, 0xb9de4a2cb8ce372d, 0xdfe84c61f7e14589, 0x8b5e19d218d374f5,
+    0xfb9d4ae325e89473, 0x41572ea653d982cf, 0x12afbe4872eca14d, 0xef9d42b65d8ebfa9, 0x85feb7ca9cb3de17,
+    0x78419b2dcab5fd83, 0x27e8b61fe8a71bdf, 0xb431edf218ca2b5d, 0x67cd821326be3ac9, 0x8eb3215658d16a37,
+    0x7d9c31fa95d478a3, 0x4fdb9e2cb4d7a821, 0x7ed5261cb1c9a57d, 0x256f87cbaf8cb4e9, 0x576923afecafd357,
+    0xe69f85421da4f2c3, 0xe9c813d76dc82341, 0xd249b7365ab8319d, 0x8f2be796568a3ef9, 0x21935cea95ad4e67,
+    0xe93fa72cb5a17cd3, 0x59c3e84fe3b49c51, 0x6ae4bdc1f1b589ad, 0x289d156431a8c92b, 0x25cd89f32f6cd897,
+    0x4e3978f54b8ed7f3, 0xed84b93a9db42871, 0x37efb2598a9625cd, 0xbfa1c5ded8a9354b, 0x8c792d5fe69c53b7,
+    0x9ab72c81f6ae8325, 0xb4fa23e546b3a291, 0x487bdfa542738fed, 0x37c619b54186ae5b, 0xc8ab49754f58bdc7,
+    0xd75e26b98d7bec35, 0x1d7ec8a9896efba1, 0x71d38a6edb843a1f, 0xc3869d41fa85397b, 0x76f4b8121a6948e7,
+    0xde2695f3249c7865, 0xadc82e76547e86c1, 0x7fb3694a9481a53f, 0xf3a71c6ba174c39b, 0x2f5d47acbf67d319,
+    0x28567fadcd6ae185, 0xbe3746adc95aefd1, 0xa79f14532a6d1e4f, 0xc914ad7549623eab, 0xda7e62854a765d29,
+    0x8ae13f6ba7486c95, 0xe5d7186a945b7af1, 0xb578492cb24d896f, 0x1e2a678fe251a7db, 0xb2da839fef53d749,
+    0x91bc8a621f37e6b5, 0x314a7cb54d5af623, 0x3ec698f76b5c148f, 0x14cdbe78795e23fb, 0x82f73abdcb735269,
+    0x6bcf925dc94671d5, 0x4f937bced6598f43, 0xd174ac8fe23a7d9f, 0xb524ef83234e9c1d, 0xe12958365241dc79,
+    0x8634e1f76f23dae5, 0xfa6de5398d27fa63, 0xf256da987c3918bf, 0xf13d4aecba4c283d, 0x3298715ed82f36a9,
+    0xec67a8b1fa438617, 0x68dec7f21a269583, 0x9126d4e5452783df, 0x4d5193a8743ba25d, 0x4e67cd98723eb1c9,
+    0x48db6c3a9e31df27, 0x1cf6e23bac14fe93, 0xb345f78cba261cef, 0xd65e7a31fa192c6d, 0xfb56ecd3281c3bd9,
+    0xa62f3de4391f5b47, 0x9a1b6237681279b3, 0x7b64d35cb726a931, 0x34d6be7cb317a68d, 0x12e37bcdc21ab5f9,
+    0xae4876cbaefcd467, 0x91a3be6cbacfe4d3, 0xab3dc8743df62451, 0xc92a36d54bf632ad, 0x4859da276af9512b,
+    0x3ec9ad4656eb4f87, 0x8bd6c7f985fc6de3, 0x7516f2acb5f29d61, 0x8be1436dc2f38abd, 0x342cde7fe1f6ca3b,
+    0x4d2a58e321f8d9a7, 0xfb1c72643fdce915, 0xb7cf3e654bcef781, 0xfa9d64387ac326ed, 0xcd8b326a9ae7365b,
+    0x5df1983cb8e954c7, 0x6b2f153ed7ec8435, 0x4c7e83d1f5de83a1, 0x1fe9ba8546d3a21f, 0x3b89a24542d3af6b,
+    0xb847ad1541c5bed7, 0x19a2f5676fb9ed45, 0xa1893eb76d9afcb1, 0x4f8ab36989ae1b2f, 0x3a698e4fe9d23a8b,
+    0xd29e8bafe8c549f7, 0xb9a5def218da6975, 0x8c39d2f435cb87d1, 0xa1b5c34653bd964f, 0xeb925ad873d1c4ab,
+    0x4c6ed13ba1c5d429, 0xf12d37cbafb7e295, 0xef2bda3cbca9e2f1, 0x19d4ea7febac216f, 0x6a8c1392198e2fcb,
+    0x7db498654ab25e39, 0xcda6759438b46da5, 0xa6b5e73876b98c13, 0xb14253f7639b8a7f, 0xdf28e35ba27d98eb,
+    0x8ae6d5cfe2b1d859, 0xcb31765edf93e7c5, 0x89576ac21ea8f743, 0xd95ce3a43d8a159f, 0xa31682576b9c351d,
+    0x59fb1c676baf4379, 0x2351764cb9a372e5, 0x73c29f4ed8b79163, 0x2cf857edc3867eaf, 0xdbc5e491f37a9e2d,
+    0x48516ca2126ebd89, 0x7429e8354281dbf5, 0x23754ae65e84fb73, 0xa78192e65d7619cf, 0x618bd5a98c7a294d,
+    0xa32f5bedca6d37b9, 0x4d85a1feda9f5827, 0xfad69c21f7a28693, 0x34b8e6c2167584ef, 0x45de79632478a36d,
+    0xd587bf46536ab2d9, 0x5842d67a928ed147, 0x36fe54a98d61efa3, 0x68a5fb1cbd863f21, 0x26b39f5dcb562e7d,
+    0xd5b8a9c1fa583ce9, 0xe38d5f421a6d4c57, 0x7e25b1d3285f6ac3, 0x583dab2768739a41, 0x37d25ce98354a79d,
+    0xea2fd9cba358c71b, 0x67b9caedc14bd587, 0xfe92a36baf4cd5e3, 0x5be396d1fe832561, 0xf3478db21e6523bd,
+    0xfb691e354d68523b, 0x63ace1276c4b51a7, 0x24f96c18784b6ef3, 0x7f92153ba64f8e71, 0x7edc816ba5428bcd,
+    0xb342c58fe235ac4b, 0x45f7abe1f136dab7, 0x56c7d914314bea25, 0x67c213d54e3df891, 0xe3b42d676c4127fd,
+    0xeb52378a9d24376b, 0x9a1f25ebab2845d7, 0x2bd3615eda2b8645, 0xcae8573fe73d84b1, 0xcd756a4ed64e932f,
+    0x2f67da132643c18b, 0x1ef79a865324bfe7, 0x457cdb687128de65, 0x9feac4676e29fdc1, 0x18cd2bf98b2d1c3f,
+    0xdfea892bad213c9b, 0x43d981bfec245b19, 0x9cabf671fb176a85, 0xd2c37584392a78e1, 0x71f6a9e4361c975f,
+    0x5abd6387641f95cb, 0x178f3c4ba612d539, 0x859ae42cb216e3a5, 0xad3482ebade8f413, 0x14879bdcbcea127f,
+    0xba5871ded9fc31eb, 0xf3e98c721ade3f49, 0x9d2c7bf439f26eb5, 0xc312f57659f68d23, 0xacd2817654e67b8f,
+    0x49fb362763ea89fb, 0x841ecf7982feca69, 0x43e17abcb2f1e8d5, 0x1fbe79cdced4f853, 0x8e1c97b32ed716af,
+    0xb17d3ac54cea362d, 0xf952eab65bed3489, 0x2396ace879ce63f5, 0x7584b1ecbae49273, 0xf67482aba6d581cf,
+    0xb1936d5cb4c79f3d, 0xeb2dc531f2d8bea9, 0x4217fe8323becd17, 0xed7345b652d1fc83, 0x7e91b5c65eb41adf,
+    0x1edc43876ec72a5d, 0x9bc8e1676bda38c9, 0x9681f3ecbacd5937, 0xfd18536ed8cf67a3, 0xa7e43291f8d4a721,
+    0xd378b5f216c5a47d, 0x246c8b5324c7b3e9, 0x43d5681763cbd257, 0x6cefa3d872ade1c3, 0xf7ad84cbafc53241,
+    0x2351496a9ca42f8d, 0x8f6453adcba63df9, 0xa8469be1f9ba4d67, 0x314e7852189c6bd3, 0xcde7628437af8b51,
+    0x42adb98545b298ad, 0x935d61b874a5c82b, 0x75891faba2b8d697, 0xd647af8cb19ad6f3, 0xfe3a78bcbe9df571,
+    0xba25ce41fe9124cd, 0x8b5ad3721ea6534b, 0x876ef5143da852b7, 0xdc6a8f276cab8125, 0xe514f9a6569c7f81,
+    0x25f4a6e9846f7ced, 0x8ba5921dc482ad5b, 0x68b419cfe284dbc7, 0xe8c93d71f198eb35, 0x5f2d7e64327bf9a1,
+    0x1e982b754e7d291f, 0x8249c3a65e91387b, 0x1d3f87a98c9346e7, 0x8b46d15cbca98765, 0xd17465bed97a85c1,
+    0x34c728bed67c943f, 0x567d4c1fe46fa29b, 0xd297eb643684d219, 0x36c5adf43284df75, 0xf4dc78265267fed1,
+    0xa59147f87e6a1d4f, 0x492fc3e87c5e2dab, 0x2631d87cbd715c29, 0xd392e16fec736b95, 0xd1e3a84fea5679f1,
+    0xe1536472174a986f, 0xe9a72613254c96db, 0x4e6da2b8735fc649, 0x8be352ca9372e4b5, 0x413d267cb187f523,
+    0xa42e67dcbe59138f, 0x5617b94dcd5a32fb, 0x748ad2e1fc5e4169, 0xae8d6b432b416fc5, 0x581c7af32b658e43,
+    0x8d372cf548357c9f, 0xc5f196e876489b1d, 0xb73dace9843dcb79, 0xfeac41dba23fc9e5, 0xf2c6d85ed152f963,
+    0x3874d1fede3517bf, 0x6eacb4821f49273d, 0x374fcd654e2c35a9, 0xcd7845f98c3e6517, 0xc14d96abac519483,
+    0x914e723ba93482df, 0x7bf8431dc837a15d, 0xdf789aced427afb9, 0x89fdea71f43bce27, 0xe167c382142fed93,
+    0x48d95a3762431bef, 0x645e27a87f152b6d, 0x54eab1876e173ad9, 0x19274f3a9d1c5a47, 0xb587a36dca1e68b3,
+    0x54a26ebfeb42a831, 0xa653b2d1f713a58d, 0xcaf1bd232716b4f9, 0xe9142b65451ad367, 0x97e6d128751be2d3,
+    0x94e3517a943ef251, 0x528fdae98ef231ad, 0x28673fda9ce54f1b, 0x76589cbdcbf64e87, 0x5163a9fed8f96ce3,
+    0x8f5b146329fd8c61, 0x5bcd1f8325ef79bd, 0x7c4b582656f2c93b, 0x651a942763f4d8a7, 0x8296175ba3f9e815,
+    0xd36c127ba2ebf681, 0x4f67231a9fbc15ed, 0xfcb8d341fde1345b, 0x9fa5dc721de453c7, 0xf24a3de54ce98235,
+    0x4c2815f659eb82a1, 0xb126a4c545ba7efd, 0xa4dfb35874cf9e6b, 0x47193bfa94e2bcd7, 0x2596edbcb2d6ec45,
+    0x8c49263fe2d7fab1, 0xbac471d543db1a2f, 0xa6e239543fce298b, 0xb23ef9a65dc148f7, 0x249e683a9cd36875,
+    0xb85cf37a9ac786d1, 0xe794db8cb7ca954f, 0xa827c9efe5cd93ab, 0xd369218fe5bfc329, 0xe896ad5326c3e195,
+    0x84abfc9543a5dfe1, 0x3294156762b81e5f, 0x43ec71a65f892ecb, 0x4a75be287cae4d39, 0xec58139a9db16ca5,
+    0x8dc2739feac58b13, 0x479bc36fe6b5897f, 0xcf1e36a215a897eb, 0xd8ac596324adc759, 0xf23bcd85439fd6c5,
+    0x6ed3c85a95b2f643, 0x93e821fba2b6149f, 0x56fe174cbfa9341d, 0xb8af536edeac4279, 0xb37dfc51fb9d61e5,
+    0x548967c32ca18f53, 0xd529c6f329837daf, 0x619ac3f547869c2d, 0x3c4ed9b65467bc89, 0x4256fb79837bcaf5,
+    0xbe8592dcb28fea73, 0xbd519f8ed29318cf, 0x3c74e12fef96284d, 0x841e6b321f7836b9, 0x678d5ae43e9c5627,
+    0xa4ed38654c8e7593, 0x39ec8f576a7183ef, 0x4ea5b1dcb984a26d, 0x6ef2b7cdc576b1d9, 0x89badf3ed469cf37,
+    0x824dfa91f26bdea3, 0xc7de9ab4347efd21, 0x43cfed9651832c7d, 0xe97a86254f653be9, 0xfe7d43a98e694b57,
+    0xab524f898d5b69c3, 0x6e5271fdcb6e8941, 0x93a8e76fe851a69d, 0xa952e7d1f874c61b, 0x79e316421956d487,
+    0x58fec2a32569d4e3, 0x8d6f4129847cf361, 0x2cf5a479836f12bd, 0x35d81e2baf74513b, 0x1532784cbd354f97,
+    0x72a8493dcb486df3, 0xa59f4761fa4b8d71, 0x3417c862183e7acd, 0x87a6cde43851ca4b, 0x17e8cda65643d9b7,
+    0xf95713dba647e925, 0x15743d2cb34af791, 0xe691a42ba24b16fd, 0x17b94cadce3f256b, 0x87f942c1fe3254d7,
+    0x63eacf421e278345, 0xc3417db65d4983b1, 0xf613c4976a4b912f, 0x3df54276562d9f7b, 0x2bc9635a9631bde7,
+    0x7dfea58cb723ed65, 0xdb85a64ed436fbc1, 0xc49618efe2491b3f, 0xfc782b45413d2a9b, 0x7c1be2465e2f4a19,
+    0x457fdb987e126985, 0x98fec3ba9c2587e1, 0xe23f168bab18965f, 0x4168faced71a94cb, 0xf2bc63ded71ec439,
+    0xe48ba391f731e2a5, 0xdc2a1e865846f213, 0x1df9c5e76538217f, 0x32f965b763182fdb, 0x98bf34e76dfb3e49,
+    0xc7a5f9687afe4db5, 0xafed317babf18c23, 0x53e87c2dc9e37a8f, 0xa257d18ed6e598fb, 0x5efb1ad215fac869,
+    0xeba25c8324fbc7d5, 0x458b269764dfe753, 0x5fed812984e315af, 0x39725dfba1f7352d, 0x6f4e5a9cbfea4389,
+    0xd4ea7c2bacdb62f5, 0xcf59ab21fbde8173, 0xdeab976329c17ebf, 0x45d9cfa328c49e3d, 0xf7e965d436e5bda9,
+    0xc24156a765e9dc17, 0x1362cab874dceb83, 0xc7b3421872ace8df, 0xe4a271cdc1e3295d, 0x932e648fefd537c9,
+    0xa859e7f21fda5837, 0xb6a12df32edc76a3, 0x714bc3965bce9621, 0x815da43769c1a37d, 0x37ea24d987c4b2e9,
+    0x19e456acb6c8d157, 0x967825fdc4a8dfb3, 0x261b35ced4abfe31, 0xaef9dc1323af1e8d, 0xf9e4b31651b23cf9,
+    0x7ac93e643fb54c67, 0xd25cb1e65eb86ad3, 0x3f42bec87dbc8a51, 0x42b9fd6cb69e87ad, 0x7e395dbfe8a1c72b,
+    0x8b3a67d1f6b3d597, 0x8e5b4da216a7d5f3, 0x59ae31c435baf471, 0x4da12e57649b13cd, 0x6285341981af324b,
+    0x2671c3da9fa351b7, 0xa68f741cbda67f15, 0x1629f8dedca97e81, 0x7dcfb961f8697bed, 0xe718fd62187e9c5b,
+    0x1cd976543681dac7, 0x341edcf76794ea35, 0x526abf387496f8a1, 0xdf27b34cb49a281f, 0x69b7e24dc19d267b,
+    0x193f24dcbd8f35e7, 0xf6eb82c1fea28465, 0xc6fb72d32e9684c1, 0xe7fd21354c78923f, 0x9cb8a275486ca19b,
+    0x8ad692f5465caef7, 0x412f936ba681de75, 0x83c6af7ba574fcd1, 0x3d8b26aed3871c4f, 0x35b48f21f1682cab,
+    0xae5f7384317d4b29, 0xaf9714532e6f4a95, 0x2139ad465d6378f1, 0x7c64bf398c54976f, 0x56423da98a4795db,
+    0x6fab2c1ed86bc549, 0xa7152e4dc76ed3b5, 0x5a26e31fe781f423, 0x9b672c143675128f, 0xaf47e286546731fb,
+    0x2c3e95f8716a3f59, 0x497c1eb87f3b4ec5, 0x69e5183a9c5f7d43, 0xd1c7a68bac427b9f, 0x8365bcdfeb459a1d,
+    0x3f2ac5e1f836ca79, 0x735ef1c2173ac8e5, 0xc7d51693274de863, 0x81a3c7f9875216bf, 0xd69ec72ba475263d,
+    0x526eaf1dc15734a9, 0x7a1b5f8dcf3b6417, 0x8967abedce4d7283, 0x74c9a28dca3e71df, 0xe1ac4d921b329f4d,
+    0xe2bcf9743824aeb9, 0xfdbe59165938cd27, 0x36f54b18762aec93, 0x235cea78742bd9ef, 0xbc15396dc5412a6d,
+    0x64c5deafe12438d9, 0x52cde73fef185947, 0xa8d9bf232f1a67b3, 0x28d143b65e2d9731, 0x48ac59d65b1f948d,
+    0x6ea5fcb87a12b3f9, 0xd342961cba15d267, 0x5ea6df9cb728e1d3, 0x93a84e5dc62aef41, 0x617ec53fe42c1f9d,
+    0x5b8dec9656324e1b, 0x5d6e4ab762134d87, 0xf67ae8354df56be3, 0x1a78d5b65df98b61, 0x1ed7952659fa78bd,
+    0xf2945cda97fea83b, 0xa4b5e31dc8f1d6a7, 0xd7294c5ed8f4e715, 0xa6b9d27326e7f581, 0xd9f85b6435f914ed,
+    0x5cf4d69874fd235b, 0xce78436981ef42c7, 0x6e18357bafe48135, 0xe36a891bacd57f91, 0x4eac815ba9b67cfd,
+    0x2d978fb1f7ea9d6b, 0xb13af78216ceabd7, 0xeb7d65f438d1eb45, 0x41cda9e656d4f9b1, 0x1c4db3f985d7192f,
+    0x42eb67da93ea278b, 0x925e3a7ba1dc36f7, 0x23bdf9acbecf4675, 0xd5e9f7a1fec385d1, 0x891afb521dc6934f,
+    0x73ebc5943cd792ab, 0x84ab159658dbc129, 0x4e89fbc546adcf85, 0x162ab84986a2fde1, 0xa76d931ba6b41d5f,
+    0x8a4b961fe3a62dcb, 0x32694d81f1da4c39, 0x4216d8b321cd4ba5, 0x4e6dc8354ebf7a13, 0x6e9473c54db2987f,
+    0xd3a5ce265ca496eb, 0x95fbc3e87ab8c659, 0x2fa6937cb79ad4c5, 0x5abe627dc7ade543, 0x27d6315fe6b2139f,
+    0x2e8cda6327b6431d, 0x2bd85f3653c84179, 0x683bda1761a94fd5, 0x64cf1e876f9c7e53, 0xf3ebc9d65b7e6caf,
+    0x64fd8ecbac839b2d, 0xcba9d58fea74cb89, 0x42b8571fe687c9f5, 0xa96dbe12168be973, 0xf5469183247be6cf,
+    0x372efd1986a1274d, 0x76523ca982a435b9, 0x2b859a6dc1b96527, 0x7314e95dcf8b7493, 0xecfa95dbac6b72ef,
+    0xa365e7bfeb7f916d, 0xe538ca921b62afc9, 0xab29df732a85ce37, 0x1eda76b54867eda3, 0x812d3fc9867afc21,
+    0x9382b1fa946e1b7d, 0x627eb13dc4713ae9, 0x5e9cb6dfe1934a57, 0x1be5a97fef5768c3, 0x9fdcae632f6b9841,
+    0x2574bd832e4c859d, 0x69a174354c6fa51b, 0x246b1c8a9b62d387, 0x71a563eba976d2e3, 0xc87b534dc879f261,
+    0x7ebad84fe56a21bd, 0xd79653bfe46d3f2b, 0xad8f791323614e97, 0x2953c7d651746cf3, 0xf142ea765f468c71,
+    0x7acd1b465e3879cd, 0x34f2ade87c3da94b, 0x71ae654ba93fc8b7, 0x2dc76b9eda63e825, 0xc8163e5fe845f691,
+    0x5ea812d3274815fd, 0xe968f2b4375c246b, 0x543bc1e9825e43d7, 0x48b659acb3718245, 0xc3457dfbaf4582b1,
+    0x6f15ec7bac368e1f, 0xd5417c3edc289e7b, 0xbea4cfd1f82bace7, 0xd48b3a52192fdc65, 0x589e2bf65843fac1,
+    0x16ce749878461a3f, 0x45e9df6ba537289b, 0xb9de243cb53c4819, 0x2781f46dc12e4785, 0x4eb23cadcf3286e1,
+    0x657c49dfed13945f, 0xf7d6c2532e1693cb, 0x8ca41b965d1ac239, 0xab89c637692cd1a5, 0x13e6f297672dcef1,
+    0xa483279ba8231e6f, 0x4c8e5f2ba6152edb, 0x917d3cefe5183d49, 0xed23f491f21a4cb5, 0x7d4193c6541e7b23,
+    0x654a81f32cde698f, 0x1baf23654ce297fb, 0x7bea48565bf4c769, 0xa347bdc879f8c6d5, 0xf528a31ba8fbe653,
+    0x8375461a95dce3af, 0xa3d5b18fe7f1342d, 0x9bafe43216f54289, 0x78f61a3543e861f5, 0x3ce128a651ea7f63,
+    0x7f69bc254eca6dbf, 0x4c2ed3b76abf8c3d, 0xbd431cf878e2bca9, 0xfe76513dc9e5db17, 0x4b68e371f6d7ea83,
+    0x35a976b215b9e7df, 0x6afb31d436ce185d, 0xf2154eb875e136c9, 0x972de15ba2e45637, 0xe6a437bcb1e875a3,
+    0x32c91edbafdb9521, 0x8c1a4efbaebc927d, 0xb4d7865ed8bfa1e9, 0x45cab1f21ab2cf47, 0xe9d78a6328a5deb3,
+    0xdb7283c657b8fd31, 0x15d692c765ba1c8d, 0x2d9e4f7874ad2bf9, 0x412fb95dc3d14b67, 0xb6ea8d5fe1c469d3,
+    0xd2517e9fefc78951, 0x84c9a1621fb986ad, 0x2cb5e8a43e9da62b, 0x3d9fe6c43bafc497, 0xdb92f47879a2d4f3,
+    0x126af94ba9b6f371, 0xa6e1b53cb6a812cd, 0x6ce25adfe6ac314b, 0xd41e7b5fe29d3fa7, 0x78d6f29434b27e15,
+    0xc4a7b5d652b47d81, 0x85ec7b243f857aed, 0x487c3fa54e789a5b, 0x8d5493265a6db9c7, 0x4fe2387cba8fd935,
+    0x2c8d563ed893f7a1, 0xe2bc619fe8a6271f, 0xf931a6c216a9257b, 0x745a1dc3259b34e7, 0x2a4c1f3982ae7365,
+    0x96f78d5a94a283c1, 0xd4fe683bae85913f, 0x187e5dcbad659f8b, 0xb584319dcb58adf7, 0xdb249351f96bcd75,
+    0x82c1e753286febd1, 0x7f3b284659831b4f, 0xd72ea9c5467529ab, 0x98b5e64cb5784a29, 0xfa671d9cb27c4895,
+    0xb27fa59cb28d67f1, 0x8e62459dce71956f, 0x3b9cde61fe6394db, 0x9a8fb3e21e67c349, 0x6fc72a843c69d2b5,
+    0x5ce2d8a76a7ce123, 0x52e89fb6564cde7f, 0x825f967a97632feb, 0x425fe6bdc4763e59, 0x16edb53fe2684dc5,
+    0x526a98c1f16b7c43, 0xb948ced3214d6a9f, 0x8f4be3754f52a91d, 0x2a1bf5365e43c879, 0xf73d1ac98b36c7e5,
+    0x23f48d5a9b4ae763, 0xe17d358a973ae4bf, 0xf5ace14dc86f153d, 0xa9fcde71f76243a9, 0x96f41e7329586317,
+    0x1cd6a2f7645a7183, 0x192b8ac651396ecf, 0x2fa965b76f2c8e4d, 0xcef24d587e31adb9, 0x5dfac4ebab34dc27,
+    0x73a1584eda26eb93, 0x78e3b69dc627d8ef, 0x192dfae3283c196d, 0xcfb92d15463f27d9, 0x51a6dc3ba9325847,
+    0x87d63ceba42576b3, 0x71b248edc24a9631, 0x6e1f89cbaf1b938d, 0x784153ecbc1da2f9, 0x9eb2c841fc32d167,
+    0xdc6fe2b32a14dfc3, 0x19bf7e865a27fe41, 0xdeb534a657281e9d, 0xe68ac729872c3d1b, 0x1caf345ba51f3c87,
+    0xc172b9fdc5126ae3, 0xea6327dfe3258a61, 0x1452f38dcef587bd, 0xd1a754f21ef9a73b, 0x9a8b4e732bfdc5a7,
+    0x62193fe54aefd615, 0x574d3ab87ae3f481, 0x9f2671ea98f613ed, 0x5469c8edc7f9325b, 0x5a984cfed5fb41c7,
+    0x2bc1573dc3ed6f25, 0x62e3f5d434f27e91, 0x1a8b64f541e37bfd, 0xecfab2d43fe59c6b, 0x3eb12c654ce8bad7,
+    0x59732eb879ecda45, 0x8f52b16a97cfe8b1, 0x31cfe97dc9d4182f, 0x5b876f41f7e5268b, 0xc8ea7d4216d935f7,
+    0xe8b41ac323ec6475, 0x5381f4e763ce74d1, 0x3f5b184983d1924f, 0xace31b587fd491ab, 0x27af64598dc6bf19,
+    0x1f69d53edab9ce85, 0xc8ebf731f79adce1, 0x9763ab42179deb5f, 0x47bd813547d32acb, 0xf297138657d64b39,
+    0x267bedf873d849a5, 0x51c62edba4dc7913, 0xdf78e63ba1bd867f, 0x62eab8cdcfa195eb, 0x3b6f5ad1feb3c459,
+    0xcbf65a121ea7d3c5, 0x3ef17d565cbae243, 0x847e6d95478be19f, 0x69b7d1a878af321d, 0xa4687ecba7b23f69,
+    0x6394e87cb3a64ed5, 0x9436be5fe2b97d53, 0xa5ebc71fe1896baf, 0x9fd8a2b4319e8a2d, 0x6cd8f9343f71ca89,
+    0x3de489c54d93c8f5, 0x3c8dea965ca6e873, 0x3f4692d76978e5cf, 0xade4873cb89c164d, 0xb14dc72ed68f24b9,
+    0xf9b58741f8b36427, 0xec6158a215b67293, 0x97baf3c5439871ef, 0x23fe6ca5417a8f5d, 0xa8db46c54f5d8ec9,
+    0x79d4cb6a9e81cd37, 0xf174629a9b74eca3, 0x856a14ceda87fb21, 0xdf284961f8691a7d, 0x49efab32176c28e9,
+    0x25e976c3268f3957, 0x7b5826e9859267c3, 0x168edf5cb3a69741, 0xe62bfd4cb167849d, 0x3472fc6a9f6ca41b,
+    0xd2b3179cbd5ec287, 0xe294fcd1fb72d1e3, 0xe758b4632b74ef51, 0x8f6a2cb439561fad, 0x27be843658693e2b,
+    0x8c547bd9865c3d97, 0xe792c6ba946e5bf3, 0xa4f21b6ed4638b71, 0xd541ecafe15478cd, 0x28a47ebfef37a84b,
+    0x3c65a7e21f3ac6b7, 0xf751a9c43c4ed725, 0x4ae751b87c62f591, 0xed5346298a6514fd, 0xba52971dca58236b,
+    0x9b3526fdc85a42d7, 0xda196e2fe86d7145, 0xc63a825ed34e6fa1, 0x892ed7c324538d1f, 0x4e2358d651349d7b,
+    0xcb13ed454f26abe7, 0x7c6159387e2adb65, 0x5f6e94287a3de9c1, 0x683495fdcb52193f, 0x61394a5fea34279b,
+    0x6274cf91fa384719, 0x396451c2192b4685, 0x16d3ba85463c75e1, 0xb65f3478742e835f, 0xce635279814392cb,
+    0x27d86c5baf26c139, 0xd5819c6bad17cf95, 0x79a32efcba29cdf1, 0x173b892ed81bec6f, 0xa9c6d34549312cdb,
+    0xe4bc19276a153c49, 0x19456a3768174ab5, 0x3259edba961b7a23, 0xe65ac12ba31c678f, 0x65ae2fdba21e86fb,
+    0x38af561cbef1c569, 0x49ab821febf3c4d5, 0xabd98fe21cf8e453, 0xa8b6ecd439d8e2af, 0x9b8d53f769fc132d,
+    0xaf61943767ef3189, 0x85bc234a97d24fe5, 0x83f72decb4f57e63, 0x7dcf352ba2e76cbf, 0x2a486edfe1fa8b3d,
+    0x165afdc321fe8ba9, 0xf97aebc54fe2da17, 0xba8243565cd4e983, 0x8dfa61e549b5e6df, 0xf12bd3a989ea175d,
+    0x12de5c3ba7ed25c9, 0x3fbc962dc8df4537, 0xf438a921f6e274a3, 0xa86d2c7436e79421, 0x48ba76e543e8917d,
+    0x47c23a8541ca8fd9, 0x2b8e5d465fadbe47, 0xd2e795387ca1edb3, 0x2cd1768a9ab5fc31, 0x4c197adfe9c61b8d,
+    0x25eb6a9fe6c82af9, 0xce463fb218cd3a67, 0x9bf26da326bf58d3, 0x2d5164c876d39851, 0xec147a5872c485ad,
+    0x4ec19f6a91d8a52b, 0xfd8b36a98fabc397, 0x8f9ad15bab9dc2f3, 0x968c7d2fecb3f271, 0x269f58e43ba521cd,
+    0x67c2fab549a72f3b, 0x7fb124d546b93ea7, 0x1ac346d987ac6d15, 0x3fc58e9a94af6c81, 0xe9d4275cb3a279ed,
+    0xe1cd734fe1c4a95b, 0xe68a157fef96b8c7, 0x51a687921f9bd835, 0x8ec1f9a43c8de6a1, 0xdc2461987ca3261f,
+    0x41aeb2898ca5247b, 0xd361eabcb9a843e7, 0x47adb9fed8ab7265, 0x42dcb39fe59d72c1, 0x68cb32fdc38d7e2f,
+    0xe1f358d213729e8b, 0xac1b9f343184acf7, 0x6dc8e3543f68dc75, 0x54327cb65c69ead1, 0x59231ac87a6ce94f,
+    0x3dc985fedc7128ab, 0xe95b1c6feba54829, 0xe7bf8d61f6a84795, 0xba1e6253258a76f1, 0xc5916b23237c846f,
+    0xa975ebd6526f83db, 0x5e1f24cba183c249, 0x7864cd3a9f76d1b5, 0xfe34968bac68df13, 0x4a73d21cba49ed7f,
+    0xe3f69541f85c1deb, 0xfdbc85232b713d59, 0x75f96d1329734bc5, 0x415ab3e659687b43, 0x546eafd8734a689f,
+    0x73541caba35c981d, 0x241589edc14fb679, 0x4f8ea9bcbf42c6e5, 0xdf79ae51fd47e563, 0xc5d4a7b21c47e3bf,
+    0xf39ca7865c6b143d, 0xb31cea576b5e32a9, 0x2d84596bab836217, 0x96d52b3cb9546f73, 0xc5419a8ba4356dcf,
+    0x4bea235fe2398c4d, 0xa6c92741f13d8cb9, 0x36c92fa4314fcb27, 0x1e58c4765f42ea93, 0x28c45f765b24d7ef,
+    0x14f6a2b87c39186d, 0x27d3bf898a3b26d9, 0x5ea2943dca2e3647, 0xed3976afe94175b3, 0x536a89c1f8469531,
+    0xb36948d21536928d, 0xd2e813f65438a1f9, 0x12ca3867612cbf57, 0x24aecbf76d1fbec3, 0x6bf7135a9c23fd41,
+    0xa93ef21bab251c9d, 0x2b6de98fea283c1b, 0x9a642c31f91c3b87, 0xdf9a8763281d59e3, 0x2c1fdbe65a328961,
+    0x654c1738751386bd, 0x8fce746a9417a63b, 0x42f5d39cb219c4a7, 0x29f3ed1a9efbd415, 0x2a3f184babfde381,
+    0x92461fadcaf312ed, 0x679124832cf6315b, 0x5af2768329e63fb7, 0xa39487d548fa6e25, 0x9b6723e875fc6d91,
+    0x6d2a31e873ce6afd, 0x17be3cfdc3f29a6b, 0x5e8132fdc1f4b9d7, 0x5843e2adcfe8d945, 0x9b8ae1732fdae7b1,
+    0x9fe638c43abce62f, 0x915b42c76ce1258b, 0x7db534698ad534f7, 0xf8362bdcbae96375, 0xdb645a3cb6ea73d1,
+    0x318e29acb5dc814f, 0x734fdb2ed2ce7f9b, 0x6b814ea324d3be19, 0x6312f7b431e4cd85, 0x37b928454fa7dbe1,
+    0xc9b148754cb9ea5f, 0xacbe3fd768ae19cb, 0xfbc48a3dcbd14a39, 0xcab5431fe9d348a5, 0xcbd32f91f6d97813,
+    0x1c3d75b214ca857f, 0x6d1ab47323ac84eb, 0xe5c4f8d762cfb359, 0xabd3841981b3d2c5, 0x4f9183ca9fb7e143,
+    0x1d29c5f87b96de8f, 0x46bfea7dca891efb, 0x437b58d1f8ad2e69, 0x49b178d329a14cd5, 0x4a7fdb5329b47c53,
+    0xdbc9a57434b569af, 0xbc936af764ba892d, 0xef4cba2762adb789, 0xc8625fdba19eb7f5, 0xfe83c46dcfa2e673,
+    0xfa235c7edb85e4cf, 0xdb68a2432ea9154d, 0xac8f9b254d8c23b9, 0xc8513ab76bae5327, 0xdfc783698ab27193,
+    0x8c1d93ea95836edf, 0x49b67fecb3968e5d, 0x47e62c3fe2678dc9, 0x386adfb1f18dbc37, 0x7acf64e3217fdba3,
+    0x8fb1e2765e84fa21, 0x71bca6354e85197d, 0x5fb2dc365c6827e9, 0x19a25e7bab9c3857, 0xb4187efcb98e56c3,
+    0x162c534fe8a29641, 0x8eda34f1f574839d, 0x4fa259d32587a31b, 0xf4216ac5436ac187, 0xce395b86516abfd3,
+    0xf4c175287c6fde51, 0xf1a7be698c631ead, 0x82c19d5bac763d2b, 0xeb25483feb583c97, 0xcd5e74bfe86b5af3,
+    0xf7ac41e3295e6a71, 0xf6e8d374365187cd, 0xfb6ec4298563a74b, 0xc7d4eb9a9246c5b7, 0x54eb2d9cb17ad625,
+    0xa731d9ebaf5ce491, 0xdc1e43fa9a4ce2fd, 0x537bd8e1fd74326b, 0xe72186c32c5641d7, 0xaed6b9532b496f35,
+    0x843b9516584b6ea1, 0xd6738ae9864d7c1f, 0xcd83517ba5419c7b, 0xc9145a8dc243bae7, 0x1c7eb4dfe137da65,
+    0xb12df73edf39e8c1, 0xd581ab321d2be73f, 0x814fe9c54d3f169b, 0x18c6e5a98d534619, 0x651a87cbac276485,
+    0x5e8f1d9cba3974e1, 0xeb95764dc73b825f, 0x7f9ca84ed53e81cb, 0xe19bd52fe541bf29, 0xdac6e3421423ce95,
+    0xd24af5365236dcf1, 0x48c32ef54d18eb6f, 0xb3f629176e2c1adb, 0xa647b1f98c1f2b49, 0xcd163a5edc1249b5,
+    0xab52897feb167923, 0x78b21c4fe519768f, 0x85efad73261a85fb, 0xe27f5634351eb469, 0xc8d1f5a98621c3d5,
+    0x314d69aba416e253, 0xd2fc43e87cd5e1af, 0x47f6edabacf9312d, 0xbe68c34dcaeb2f79, 0x6f2d875cb8fc3de5,
+    0xbe29c8f32af17d63, 0xa2498dc327e36abf, 0xb41698d545f68a3d, 0x8b49235653f7b8a9, 0xefbca27983fdc917,
+    0x876f43dba1efd783, 0x56e91dba9cb2e5df, 0x8eb479a1fce7165d, 0x5813bfd21de824c9, 0xb1c594a32bec5437,
+    0xdf2eba7659de62a3, 0x6bfd8a398ae49321, 0xb97fd68a95c38f6d, 0x164a5efba3c58ed9, 0x2af837cdc2e9bd47,
+    0x3f8562a1f1eadcb3, 0x41ec36d542cfeb31, 0x7fbd82c54fc31a8d, 0x8a964e254dc528f9, 0xbe8a13465cda3967,
+    0x76eadcb989cb57d3, 0x3259b46cb9ce8751, 0x68e529bfe6c184ad, 0x6284d531f6d5a42b, 0x3f69d84214d6c297,
+    0xea9d158654b9c1f3, 0xf4219db652abdf61, 0x2376acb54a7cfebd, 0xb71d84e98da42e3b, 0x9b3ec46a9cb53da7,
+    0x6ad7e42feab96c15, 0x3476d9f1f7ac6b81, 0xd36a58b2159c68ed, 0x6517dba436c1a85b, 0x8a5b27f654a3b6c7,
+    0x5b98e6fa92b8d735, 0x7b53d8c982b9e5a1, 0x7e5bf1da9d8be41f, 0xa3fec65dcd9f137b, 0xa8c29b51fca342e7,
+    0x6149b5f32db87165, 0xd87f15343a986fb1, 0xa87ef9b5468a7d2f, 0x9458adf6546e7d8b, 0x25d7f48a9481abf7,
+    0xe1439badc293db75, 0x74ba285dc286e9d1, 0x2a5981fdcd69e84f, 0x7b856de32f6d17ab, 0x263f17a54d8f3729,
+    0xe4dfb3987da24695, 0xab72ec198b9675f1, 0x45931facba79836f, 0xfb38192dc56a82db, 0xf9da645ed57eb149,
+    0x4de2a7bfe371cfa5, 0xf45d1a732485de13, 0x8b971da43165ec7f, 0xda2c4fe54f581ceb, 0x1ab3dfe87e6d2c59,
+    0x458ef1d98b6f3ac5, 0x35bf162edc827a43, 0x29d3b76eda54679f, 0xe9d234c1f658971d, 0xc8536ad2164cb579,
+    0xeb692753236db4e5, 0xe87fc46a9581e463, 0x2d8b34598164e2bf, 0xfad835ebaf68123d, 0x4658ec3dce5b31a9,
+    0xf723eb8dca4b3ef5, 0x5f37d84eda4f5e73, 0xb4fe18c219426bcf, 0xebf1c69329358b4d, 0x61cfd87545368ab9,
+    0xb8247de9854bca27, 0x23ec17fba24ed893, 0x59467aeba241d6ef, 0x473956adcf34176d, 0x7a4596c1fe3725d9,
+    0xa3c47ef21e2b3547, 0x98eca5265c2d64b3, 0x943ecd187b5f8431, 0x76d4f9187a43918d, 0x7c2134eba6248fe9,
+    0x87a93f1dc428be57, 0xabd2468fe429bdc3, 0x563af4c1f23dec41, 0x85721cf653421b9d, 0xc3d865b76f253a1b,
+    0x8413dab65e163a87, 0xd7b3e1c87c1a58e3, 0x1de723fbab2d7861, 0x7f82c61ba81f75bd, 0x612d8c5fe812a53b,
+    0xf4867b31f615c3a7, 0x3f2e9d154729d315, 0xb61a9cd7653be281, 0x35ab2d16521aefcd, 0x9e5dc1a76cde1f4b,
+    0x78e514f98cf23eb7, 0xc3971f4babf76d25, 0x1f7598cedaf86c91, 0x45c71bfdc5ea69fd, 0x476e8b1215fe896b,
+    0x51872fc435f1b8d7, 0xdca4e5b876f3d845, 0x41673cd983f7e6b1, 0x36bcef8981d9e52f, 0x284fde9a9fed148b,
+    0xa67d389babce23f7, 0x6eda34b1fce36275, 0x391f52b43be672d1, 0xecd1a82329c87e3f, 0x1bc53ad435da7e9b,
+    0xb2ca98f765cead19, 0xc57b69ea94e1dc85, 0xcb3e145a93c4dae1, 0x269a48bcb1c6e95f, 0x8192ce4fefd918cb,
+    0x543d8a621fcd2839, 0xd186a4932dcf37a5, 0xe31c2a676cd48713, 0xc82e14976ac5847f, 0xb6279eca96c783eb,
+    0x92c4368ba6dcb259, 0xd5b1a46ed4aeb1c5, 0x67ab24dfe5b1df23, 0xf8e4cb9212a3ed8f, 0x67c18d4542a61dfb,
+    0xe9bfdc854fba2d69, 0x249e53a76e9c3bd5, 0x8267f4e98caf6b53, 0x3cbef4adc9b268af, 0x2794681fe7b5982d,
+    0x9264d7e1f4c7b689, 0x1b83c5e2149ab6f5, 0xde7c982324aed573, 0x28b961a76491e3cf, 0x375468ea92b6134d,
+    0x2e85c1d98fa732b9, 0x8645cf3dceab5127, 0xc32b5f1edb9c5f83, 0x4f97e5dcb87e5cdf, 0x4a6b1e821a928c5d,
+    0xbaf5614326748bc9, 0xf64e9da54598cb37, 0x23ca94b7647bd9a3, 0x95f867eba48de921, 0xe6534a2dc3a2187d,
+    0x5b81e9adcf8426e9, 0x6ecf7231fea93657, 0xfe1493521e8a65c3, 0xa5813de43c9d8541, 0xaec1bfd54a6f729d,
+    0x9d23e5187984a21b, 0x6dce84aba584bf67, 0x8a2764eba467bed3, 0xa36f879dc37aed51, 0x37b419efe15cfbad,
+    0x9de87a3654813c2b, 0xcf9a68532f643b97, 0x812ebf954d6759f3, 0x683a41798d5b6971, 0x5dfab349894b76cd,
+    0x84a1cfbdc85f964b, 0x8e7d293fe862c4b7, 0x349c72d1f687d425, 0x8b1c9f532568e391, 0xd139ac454359e1fd,
+    0x482a5b69837e216b, 0xc5ef23a98e513fc7, 0x4fa981dbad746e35, 0x29bd3e5cbc476da1, 0xcd18b34eda497b1f,
+    0x5b37cda1f63d8a7b, 0x5e9436d2163fa9e7, 0xca5721d43842d965, 0xf42e61a98645e7c1, 0x6d15893a9248e63f,
+    0x962da3eba24c159b, 0xdb48e69cbf4e3519, 0x2d4ac69ede416385, 0x3fc68e21fc4573e1, 0x14a2f8632c37815f,
+    0x7de9f86439287fab, 0x81ca3e96573cae29, 0x6ce54f38762fbd95, 0xe24c657a9643dbf1, 0x35d621fcb324ea6f,
+    0x91437c6fe23719db, 0xd534c98fef1c2a49, 0x5fd974c32f1e38b5, 0x645fd1876e417823, 0x6ef95db76c13758f,
+    0x9c3d7eb87a1684fb, 0x421a9b6dc81ab369, 0x4589e13ba71cb2d5, 0x4218a9fdc72fd153, 0x5914beadc412de9f,
+    0x6217ad3545362f1d, 0x7d4b8e9653182e79, 0xba17c9e54df93ce5, 0x21953ab87bfd5c63, 0xe61a49c768de59bf,
+    0xd32816fcbaf2893d, 0x4dc8b73ed6f4b7a9, 0x71b9e83fe5f9c817, 0x8fa64cd215fbd683, 0xedfc6b1323ebc4df,
+    0x3d6ec27986f2145d, 0xe742ad3981f523c9, 0x21a38e9bafe95237, 0x219865fa9deb61a3, 0x7d81632a98ba5def,
+    0xb928f14dc8bf7e6d, 0x54fa896217e28cd9, 0xac27689328e5bc47, 0xbf6814d545e7dab3, 0xa476cf2875dbea31,
+    0xc894a1e762bcf78d, 0xe58f241cb3d127f9, 0x83fc194dcfd43867, 0xcbfd9271fec856d3, 0x529a17c32edb8651,
+    0xd756ae8329bc73ad, 0x74abfc9658cf932b, 0xf2d5e8b768d3c197, 0x782cda1986a5bfe3, 0x8435d1fba4b8de61,
+    0x6ed4823ba298fcbd, 0xc68da251f2ae1d3b, 0x16afc93542d13ca7, 0xceda76143fc46b15, 0x7b2194854ec76a81,
+    0xda41fc754ba967ed, 0xd985c2e768ad975b, 0xd4e2a17cb69fa5c7, 0x83c5a47fe8b2d635, 0x7a4d82b1f5b6e4a1,
+    0x84ac1df325a8e31f, 0x53e879f654ac127b, 0xcb65184762ad31e7, 0xa58be6c98ea16f45, 0x67c28b198d946eb1,
+    0x7d4c631bab967c2f, 0x2e1a749fea697c8b, 0x871ba65fe56c9af7, 0x195d87b2168fca75, 0xf1c26ea54693e8d1,
+    0xe63bc8176395e74f, 0xb37d5a28739816ab, 0x9d47368cb1ac3629, 0x63b4ef7cbf8e3495, 0x3482eacdcd9274f1,
+    0x834129bfec94826f, 0xe978c4532c7681db, 0xc5841ad32b68af39, 0x1d8f2cb4376cbea5, 0x6f137b29867fcd13,
+    0x965bd48a9462eb7f, 0x5a2ce71dc3751aeb, 0x21b75cdfe1782b59, 0x576c49dfef6b39c5, 0xd5197c321f7e6943,
+    0xf68d32a43d51769f, 0x98f3bce65c74961d, 0x1db8e5298c56b479, 0xef93458ba869b3e5, 0xd37681fcb87cd263,
+    0xc965a24ba45ed1bf, 0xfae63791f685213d, 0x4fae967213652f89, 0x4cb91d6541683df5, 0x48b532676f4b5d73,
+    0x361d29c76b3d5acf, 0x3476fd9a9c518a4d, 0x38b7af1edc43a8b9, 0xc17d362fea46c927, 0xc6e84b91f64ad793,
+    0x9a51fe42163ac5ef, 0x849a12e3253ef46d, 0x1f2d53a9856324d9, 0xf4ad391cb1685347, 0xfca56d9baf4962b3,
+    0x4362951cbe5c8231, 0x37f24becba2c6f7d, 0x3f2c6481fa318de9, 0xcd594b821a23bd57, 0x8ab916454826dbc3,
+    0xbca628f76739eb41, 0xc6e8f197642bf89d, 0xd58c43fba54f291b, 0x6f529dced1423987, 0x45be6acdcf1657e3,
+    0x24cb7ea1fe2a8761, 0x84eb62532e1a74bd, 0x3dae21b65c1e943b, 0x81adb6476b31c2a7, 0xf3bd128a9a36d215,
+    0x6df83e5ba826df71, 0x658b3efa9417fecd, 0x1a689dfed52c1e4b, 0xb52c136fe31f2db7, 0xa1732cf874136c25,
+    0xb7238a643ef46b91, 0xedc9b3a43be568fd, 0x4e9d36154cfa986b, 0x3f7b81d658fca6d7, 0xf3569adba8efc745,
+    0x28f695bdc7f3e5b1, 0xefc2346dc5d6e42f, 0x52c4fde325f9138b, 0x14a28b7654eb32f7, 0x315d27e982fe4175,
+    0x1c3d4b987ed26fc1, 0x3c2afde98bc47d3f, 0x68f51b798ae57d9b, 0x596dfa2ed7e8ac19, 0xf2863d51f6edcb85,
+    0xf2758c1326bfc9e1, 0xba9f8e6436c2e85f, 0x4bdf962764e517cb, 0xc5fd1ae984ea2739, 0xd7eb123a91ec36a5,
+    0x241c57ebafce7613, 0x3972a6ecbdc1837f, 0x9ab7c581fac482eb, 0x1a2e64832cd7b159, 0x76fbe51327c8afb5,
+    0x38af497657abce23, 0x2487cd36549edc8f, 0x1af658d985a31cfb, 0x32de467cb3d52c69, 0xdea92b6fe1c83ad5,
+    0xdc2a973fefbc6a53, 0xbe7c38d21e9d57af, 0x3cd982e54eb1972d, 0xe31f87254dc3b589, 0xa2b985f769a7b4f5,
+    0x2349df6a98bad473, 0x7c312f8a958ad2cf, 0x34e6bf7cb59ef14d, 0x26c753e1f5c431b9, 0x54cbe71323b64f17,
+    0x21a67d8541b95e83, 0x637b12d43e795bdf, 0x6b73c9154c8e7b5d, 0x134fa9d76d718ac9, 0xd25167bedb94ca37,
+    0xd724158fe796d8a3, 0x23bcfa41f69ae821, 0xb1ef93d2148bf57d, 0xab9765e4348f15e9, 0xce879d6a96b23457,
+    0xd7251c6a91a764c3, 0x4873debcbf9a8341, 0xd1236f4bae6b719d, 0xbfde96acba5c7ef9, 0x42ba58e1fa81be67,
+    0x98173b421974bcd3, 0xa6ed9f743987ec51, 0xeb7f18643457f9ad, 0x8751fd29857d1a2b, 0xe37ab21cb36f2a97,
+    0x3cfb718dc19258f3, 0x64f923bedf956871, 0x65f7e281fe4875cd, 0xa368c9421e6c954b, 0x25e641a32c5ea3b7,
+    0xa2714c587b81d325, 0x1a7e24b98a75e291, 0x47d68ab98645cfed, 0xe263978dc4691f5b, 0x46f7c32ed35b2ec7,
+    0xb9d1e38fe17f4d35, 0xb8c69fe542736ca1, 0x9dc1e2543e457a1f, 0x4cab3f654e36897b, 0x4e9ab7c65c3ba8e7,
+    0xce518dfa9a3ec865, 0xf9e7db1cb952e6c1, 0x4e971c5dc864e53f, 0x9bc87641f657149b, 0x8d4acfe3276b3419,
+    0xe21a96f8736d4285, 0xd715ce29835f62e1, 0x2ebdc3198d327e4f, 0xfe2a5d398d247eab, 0x4b2d853cbc37ad29,
+    0xbc53a76fe82abc95, 0xc73be92fe73dcaf1, 0x4be981532831e96f, 0xf2458cd6573418db, 0xce869a1ba6372849,
+    0x92e3b48a942a37b5, 0xd6afe12cb14d6723, 0x8ea4f5cbad1e648f, 0x71bc2f4dcd1283fb, 0x3bc4de61fd15b269,
+    0xb1ec28d43c28b1d5, 0x54d7eaf6591acf43, 0xc4b6df95461bcd9f, 0xbf46317a98432e1d, 0xae71268cb6142d79,
+    0x9e1b763dc4173be5, 0xce81a42fe21a5b63, 0x386a4fcdcdea58bf, 0xe1fd8c921cfe783d, 0xdfce6a243df1b6a9,
+    0xd9823fb65bf4c617, 0x1a9365b76af7d583, 0x65f921b876e8c3df, 0x1d98b45a96ebf25d, 0x7de1825cb5ef12c9,
+    0x7a6c1b4fe6f45137, 0x87cf13e212e65f93, 0x9b62eaf431d75cef, 0xbe72f3943fea7c6d, 0x6c19d4354ace7bd9,
+    0x62d3fca98ae1cb47, 0xda4e82fba8e4d9b3, 0x2c7e158dc8d7e931, 0x62c3eb8fe4c9f68d, 0x5f74eb1325dc16f9,
+    0x35972fd434df2567, 0x43a8fdc984e265d3, 0xd64e137ba2e78451, 0x486d1bf76fc872ad, 0x348d6cf98edc912b,
+    0x7ba94c5dc9bdaf87, 0x6fad82b1f8a1bde3, 0x426c9df329b4ed61, 0x54f1c6932695fabd, 0x8e9cf21656d91c3b,
+    0x3adf8b9764cd2ba7, 0x3875f6da93cf4a15, 0x534cb68dc2d36981, 0x56d4f3ecbfa476ed, 0xba6c5e41fec8965b,
+    0xb1473fd21e9ba4c7, 0x2efba5732baec435, 0x925fd1b769b2e3a1, 0x1ac4953878a5e21f, 0x674d21fba6c8217b,
+    0x4b3561acb4a92fd7, 0xa534cfded2ac3e45, 0xa68b273fe29f5db1, 0x2c61a97541a37b2f, 0xb71de9532f947a8b,
+    0x5dce29843d86a9f7, 0x21ebd9354d8bc975, 0x9c5db367698ec7d1, 0x1df3526cb891e64f, 0x7a4bec1fe79415ab,
+    0x46e372c1f6b83529, 0x8eb53dc216ab4395, 0xef5ba496549c63f1, 0x3b92ae76529e716f, 0x5c3fb7d65e627fcb,
+    0xdb564f398d75ae39, 0xfc2457ba9c67bda5, 0x19c3628fe97adc13, 0xd8ec7a4fe65cda7f, 0x973cf2d4387219eb,
+    0xc6fd3e8437842a59, 0x9e83bd17649738c5, 0xc98fd61ba29b6843, 0x85fd493ba17c659f, 0x72acd34bae6f851d,
+    0x69f13cdede62b379, 0x2e986c31fc76b2e5, 0x4bf6a1c32c79d163, 0x4de597f32748ceaf, 0x92def4b5475bfe2d,
+    0xa59f742ba7612e89, 0xa5ced7fba6743cf5, 0x32bc4d1ed2685c73, 0x6975fabed14859cf, 0xe52c6dbfef3c794d,
+    0xced65f421e3f87b9, 0x841d7e954e53c827, 0x4ae712b87c45d693, 0xf648bd376937c4ef, 0x15ef639a984af36d,
+    0x34d82fbcb75e13d9, 0x3d296cafe9815247, 0xf5ce2961f47561b3, 0x2de7836434587f21, 0x68241b7541396e7d,
+    0x6398c7254f2b7ce9, 0x25f4ea676d2fac57, 0x43c8d5298b42dac3, 0x48f5b2adcb36ea41, 0x8ef526adc826f79d,
+    0xc7fe4a91f74c281b, 0x59c83462193e2687, 0x49ca25b8784156e3, 0x713af28ba7348561, 0xe96fcd3a912673bd,
+    0xd3f6e5198f1a923b, 0x14cb3d6a9e2db1a7, 0xaf65e4dcb91daef3, 0xc97a4e21fa23de71, 0xdec4bf632814fbcd,
+    0x9aed821659281d4b, 0xd7c8a456561a2cb7, 0x28fb5c4a971e4b25, 0x8b1c259dc5326a91, 0x8192ea4cb21367fd,
+    0xf3847b1dcef4976b, 0xb63a78dfecf8a5d7, 0x1cfa46521dfbc645, 0x293a6e8439fed4b1, 0x46fd398769d1e32f,
+    0xa591d43879f5128b, 0x3d7581aba6e831f7, 0x37d845fcb4ea3f65, 0x46ed925ba3fb5ec1, 0xf9123aecb1de6c3f,
+    0x26318da431f27c9b, 0xebd389f43fe5ab19, 0x87ebfa643de7ca85, 0xe9c317d659dac8e1, 0xead1b85768bcd75f,
+    0x26973d5ba8e216cb, 0xf154a92ed8e52639, 0xe3acb981f6e834a5, 0x417ea26326eb7513, 0xe6cf1ad543dc627f,
+    0x39f781c652cf71eb, 0xbf96ca476ec2af49, 0xca7f32e87dc4aeb5, 0x63e19c8a9ab8cd23, 0x364f15cdc6a9db8f,
+    0xc4a635bed58ce9fb, 0xe81536d438d12b69, 0xd128a47327c439d5, 0xa37fe91874d86953, 0x6b73fe9872c956af,
+    0x73b9d58a91bc862d, 0xc46329d87ebfa489, 0x84e97f6dcda2b3f5, 0xb8ae2951fcb6d273, 0x7bfc24632a97d1cf,
+    0xb14ed7c32789ef3d, 0xc43a1fb5468d1fa9, 0x2e6419ca98b24e17, 0xd94a26fba6b45d83, 0x8db9352cb2965adf,
+    0x8d523b6fe1b97a5d, 0x5b396dafef6d78c9, 0xa6457d121e8fb937, 0x7a4693e54e92d7a3, 0xba8517365ca6e721,
+    0xc428f7565a98f47d, 0x48f7623ba78b14e9, 0x86c9714dc8ae2357, 0x418ec3afe7a162c3, 0xe23b5641f5b68241,
+    0x17b8dea212956f8d, 0x271ed56431687df9, 0xe7d58a643f5cad67, 0x3719a5b65c6fabd3, 0xc4b965da9c83eb51,
+    0xa9db3f4cb964f8ad, 0x64d7ec2fea78192b, 0x8d75c391f56c2897, 0x9e47ab32168d47f3, 0xae967db545a28671,
+    0xb2f8ea17628374cd, 0x16e9245ba187934b, 0x25fbac798f59a2b7, 0xd7251a3bae7dc125, 0xd64b32fcba5ecf81,
+    0x7435aefcb852fced, 0xd96c14f32a761e5b, 0x526f917439582dc7, 0x6f82a4e7687b4c35, 0x2d78bc69846e5ba1,
+    0xf87dbe1cb462791f, 0xf19485ded153987b, 0x87f62e3dcf35a6e7, 0x4b7c36e1fe3ac765, 0xfe1ac5b32e4bd5c1,
+    0x5db712a32a5ed43f, 0x51b2afd87c64139b, 0x4629c7fbab674319, 0x43e5fabdc96a4185, 0x581926dcb64a5fd1,
+    0x348957dcb23c6d4f, 0x2397b8c1f2417dab, 0xb691dc743154ac29, 0xba3682743f26cb95, 0xf8152ae65d38c9f1,
+    0xe59c74265a2bd86f, 0x57f32ac8782ef6db, 0x1652cd9edb532749, 0x6824eb7fe92736b5, 0x658f3da1f84a7623,
+    0x36eab812152b638f, 0x8fe97246543d72fb, 0x8f2d67198342b169, 0x5312a7c87e13afc5, 0x7c3f68da9d17ce43,
+    0xce81a7f98a17dc9f, 0x51bf9c2dc82afb1d, 0x8146ac5fe82f1c79, 0xa1c9f46549123ae5, 0xa92d671549175a63,
+    0x84e25c67641857bf, 0x5f78642a941b873d, 0xd7265f1cb21e85a9, 0xd8e7519a9defb517, 0x27354e1cbcf2d483,
+    0xd6a1982cb9e5c2df, 0x8cf157632ae8f15d, 0x38ab2c1548fb21c9, 0x1e75932658ed3f27, 0x65ef7ad987f15e93,
+    0x6f587bc984d35bef, 0xdcfe519ba2f57b6d, 0x15746ecdc1f87ad9, 0x6eb4a53dcfedba47, 0xa47831e21edfc8b3,
+    0x3d9eb7165cd4e831, 0x72d1fa543ac4f58d, 0x52edc8176ad815f9, 0x4ead892ba9ec2467, 0x136c95fba7ce54d3,
+    0x64795bded7e28351, 0xf3c9e621f3e471ad, 0xaf816be323d68f1b, 0xf6972a1431d9ae87, 0xd8f4b9754f9bace3,
+    0xf415d7c65bafdc61, 0xe4c2b69768a2f9bd, 0xf86a91edc9d61a3b, 0xb2e4d81fe6d829a7, 0xbf394ac1f7dc4915,
+    0x17b468a326ce5781, 0xac1b8e6434b175ed, 0x54a1e96872d3945b, 0x81ad6c5981d6a3c7, 0xa28e41f98fbac235,
+    0x7cb48a198e9cd2a1, 0x7e91c26a987cbefd, 0x9873d5bfe9a31f6b, 0xc9dfe61219a52ed7, 0x926a4cd328b93d45,
+    0x1a82b395469a5cb1, 0xb17d5f38749d6a2f, 0x362ad9eba3c1798b, 0x5f7628adc1b3a8f7, 0x4c69372edfa6c875,
+    0x69d543e1fe89c6d1, 0x839f1ab21c8bd54f, 0x2a9b85f3297ef3ab, 0xb2d73c987cb53429, 0xe5d67c198ab74295,
+    0xde3f786cb7a962f1, 0x4a7d365cb38a6e5f, 0xc95372eba27d6ecb, 0xd52947e1f281ad39, 0x6e219fd32183bca5,
+    0x3f2189e54f87db13, 0xfd837ec43c58d97f, 0x1c46a2e5495af7eb, 0xec23a45bab7f1859, 0x6f74c21eda9237c5,
+    0x427e693fe9a86743, 0x19a65cefe378649f, 0xceb7f123257b841d, 0x91274865436ea279, 0xcf42e5187382b1e5,
+    0x4bdfc8798e74cf53, 0x917fbdc87b45cdaf, 0x9c324d7a9a58fc2d, 0x4a3c65dfea5c1d89, 0xcf7d5a9ed86e2bf5,
+    0x19863ce21a825b73, 0x8dc215a3276458cf, 0xe458f1276359784d, 0x23c56a98724c86b9, 0x521c973ba15eb627,
+    0xd89a276cbf61d593, 0x82a9135bab54c3ef, 0x54ea982feb47f26d, 0xc57b32e43c5a12d9, 0xbfd39a865b6d3147,
+    0x3ed4f287685e4fa3, 0x2a9783cba9647e21, 0x6f2d349ba5346c7d, 0xca513fbdc2367be9, 0x687b9dcfe13cab57,
+    0x9dab847edf2eb9c3, 0x8dc6e9343f52e941, 0xba214e954c23f69d, 0xc49fa8376d48271b, 0x379f5b2a9c3b2587,
+    0x3f1d495ba92c45e3, 0x8132e4bdc93f7461, 0xcd56b39fe64372bd, 0xa4e28f61f546913b, 0xc6149fe21326af97,
+    0x2f9d8c365129adf3, 0xe73fd8a65f2ecd71, 0xda34f1c76b21facd, 0xeb54693a9d251c4b, 0xa593cb6edc162ab7,
+    0x214c635fe91b4a25, 0x3fd6ceb1f72d5891, 0x14568923271e56fd, 0xd13a2c954712956b, 0x16dfe7598315a4d7,
+    0x8d74ef3ba219c345, 0x9176fcd87ef9d3b1, 0x8f1e5d498aebd12f, 0x93f561ea98cdef7b, 0xc9264bfdc9d32fe7,
+    0xd4e1acb21af73e65, 0x2d7bc81437f85dc1, 0xb7f9432545ea6b3f, 0x3fe487b653fe6a9b, 0x6f32cd5984f2ba19,
+    0x1926af8cb1f3c985, 0x643a5e7bafd6c7e1, 0x984d215febc9d65f, 0xd9a81b5219daf4cb, 0x3927afb54bdf1539,
+    0xcb43f5a87be243a5, 0x5d3fb2ea9ae87413, 0xf8a369dba5d9617f, 0x1af576e983c96fdb, 0x832d1f7cb2cd8e49,
+    0xb325a861f2e1adb5, 0x8bd1f74541e5dc23, 0x89de5b132eb5da8f, 0xa97e38f43ca7e8fb, 0xf8e31a565bcd1a69,
+    0xd416579879bf28d5, 0x4395bfcdcad26853, 0xf5a8d16ed7c465af, 0x483ad6f1f4c9852d, 0xa31e9f5214dca389,
+    0xca79e4b543bda2f5, 0x38bf572984c2d173, 0xb87efc465d83cebf, 0xe4956bc87b96fe3d, 0xf6dcb3487cb81ea9,
+    0xcbe35d2fe9ac3d17, 0x41ed972fe7af4c83, 0xa5d1e9b217a259df, 0x85c124f326b4795d, 0x64d2ef8543b687c9,
+    0x15f3ca2762acb837, 0xefc183d9819ec6a3, 0xb463251cbfa3e621, 0xd132567cbc94f37d, 0xb937ecf1fca713e9,
+    0x16cb35d21dab3257, 0x1dc68f354a9d51c3, 0x172fc8d6589e6f31, 0xf73496a875926e8d, 0x571c946ba3847cf9,
+    0x4f72d65ed298ac67, 0x9236a51fe179bad3, 0xbc97f2edcf7eda51, 0x9d481bf32e61f7ad, 0xf2e9adb54e95182b,
+    0x79da18b54da82697, 0x1f563a287b8a46f3, 0xf79b8d4cba9d6571, 0xed421fcba57f63cd, 0xa85b2c4fe683924b,
+    0xc5a74fd1f385a1b7, 0xe68f9d532378bf15, 0xe834bfc5426ace81, 0x97c52a343f4acbed, 0xd41efa798e721d5b,
+    0x4b8c62da9d642bc7, 0xf47985cedc784b35, 0x76bdae2fe86b59a1, 0x359cd6afe75c681f, 0xdca35962154f867b,
+    0xdb93e5143462a5e7, 0xc8bf597a9287c465, 0xe795b41a9268d4c1, 0xcae61f798e5ad23f, 0xcb4532f98c4df19b,
+    0x3a8b91cfed734219, 0x1827cb5feb643f75, 0xbfa648932a475ed1, 0x95a61e7328396c4f, 0x76ef2cb5453d6cab,
+    0x62ea7fc8754f8b29, 0x9fb7682cb342ca95, 0x89217ebcb245c8f1, 0x2e1f573cbe28d76f, 0x3bc7925fec29f5db,
+    0x45f178a32d3e1649, 0xa5cb6ed87d6134b5, 0x25798bca9c467523, 0xd7394f2a9a37628f, 0xa3dc294ba63971fb,
+    0xf67da41cb42c8f59, 0xe8da15fcb32f9ec5, 0xbd937fe1f152cd43, 0xeca3d1643124db9f, 0xe26d9b354e27fa1d,
+    0xc84712565e2c1b79, 0x9de45c687b1d29e5, 0x8295ae6cbc215963, 0x3ac85f9dc91356bf, 0x93a745dfe917863d,
+    0x897e3f51f51b84a9, 0xa3e2b164362db417, 0x52d8cf37651fc283, 0xe45a91387423c1df, 0xd1c324a76bc3ef4d,
+    0x3af2c4187ce61fb9, 0xc5e74b3a9bfa3e27, 0x15f64b2cb8fc4d93, 0xad1265fcb6cd4aef, 0x7b3ad51218f27a6d,
+    0x14adb9c325f478d9, 0x1a5fc39653f8b947, 0x1bef425762fac7b3, 0xf4e1dc9a92fed731, 0xde897f6a9ec1f48d,
+    0xd4fa317cbcd514f9, 0xfc56e9d1fce92367, 0xa43ed9c21bea52d3, 0x7c932d654aed7251, 0x8a73fd6436be5f9d,
+    0x1459ca3876d38e1b, 0xeb5182ca93e4ad87, 0xd164f73a92d7abe3, 0x67c5832dc2eadb61, 0x71ce289baf9ce8bd,
+    0xf496b8754fd2193b, 0x1679f8d43ed428a7, 0x92a63c476cd94815, 0x34fabe987adb5681, 0x7a52ecd987ab64ed,
+    0x63245e8ba6cf835b, 0x294b387fe5d3a2c7, 0xb7af29c1f4d7c135, 0x1582d7e323b7cf91, 0xb267edf43198bcfd,
+    0xd9fb6e543e8cfd6b, 0x9bea3fc76ea12cd7, 0x7b68ce1a9db63c45, 0xaf329cbed9c75ab1, 0xa9d5f8bed7ba692f,
+    0xd3465a81f4ad678b, 0x6f8914c214ae96f7, 0x89e3caf434b2c675, 0xc354b6f873a6c5d1, 0xca25e17871a8d34f,
+    0xad5839476e79f2ab, 0xe743891cbdae1329, 0x3a957d4fedb24195, 0xca3842deda945fe1, 0x46b7ca121a976d5f,
+    0x7ebd685325786dcb, 0xf38a76b5457d8c39, 0x45b92167637f9ba5, 0xe2159a4cb594da13, 0x241fa86cb194d87f,
+    0xef92753bad57f6eb, 0x58b94e71fe8c1759, 0xef3bda421d8e26c5, 0x329d78565da17643, 0x195af7d65b84639f,
+    0x26ef83c76a97831d, 0x3aeb491dc56ba179, 0xd26f5a9ba36b9fd5, 0x1579cbadc27fbe53, 0x5712de3fe162dcaf,
+    0xbf981c643175fb2d, 0xd2efb6143f571c89, 0x2e9df6b54d6b2af5, 0xd45cab898c6e4a73, 0xb5d2f1ca9a6157cf,
+    0x58eb7fadca63874d, 0x52a834bfe74685b9, 0xf6ae7821f46ab527, 0x1e56c972156dc493, 0xa86d4375435db2ef,
+    0x3267bd498273f16d, 0x5d283a198f5621d9, 0xe4a3f9cbad592f37, 0xd8e9315a9c5b4ea3, 0xb2a5167dca5e6d21,
+    0x23b75c91f9416b7d, 0x98d3c4a218437ae9, 0x519fed432836ba57, 0x692d5b176549b8c3, 0x2593dfba935cd841,
+    0x5473a689813fe59d, 0x78cfb35dcf54261b, 0xbd18cf4ede362487, 0x375d4261fc2954e3, 0x24ab65c32d4c7361,
+    0x14c8ea25493e61bd, 0xfdb3ce8769418f2b, 0x3b8f41d98623ae97, 0xbf16ec5a9526acf3, 0xeb9d348cb439dc71,
+    0xd215649cb12ae9cd, 0x784cb1edcd1ef94b, 0x63d491e54f1329b7, 0xa1985ef76e174925, 0xab98f5276d2a5791,
+    0xecf7d368791a65fd, 0x14f2de5ba91e846b, 0xfbe9c12dc821a3d7, 0x8259317fe816c245, 0x298c3471f537d2b1,
+    0xbda72e143428ce1f, 0xedf3a945421afe7b, 0x3efb19654bfc1de7, 0x1a4d82c98cf13d65, 0xf7ec42898af45bc1,
+    0xdf35724cb9e76a3f, 0x63c1549ed5fa689b, 0xa4976b1fe5fda819, 0x6aecf84214efb785, 0x84d17af545f3c6e1,
+    0x3ad692f872e6d45f, 0xe1d2a6c761e7f3cb, 0xa8b43f298fec1439, 0xde6154ca9cde32a5, 0xb6452cdedce47213,
+    0xc742d18ed9c35e6f, 0x14b9c7f218c56edb, 0x5f17928326ea8d49, 0x78fb193434ed9cb5, 0x912ab3c875dfcb23,
+    0x57bc31d873c2d98f, 0x1fe8d3ba91c4e7fb, 0x9e78413dcfda1869, 0x3f9a4751fecb27d5, 0xf768ebd21dce4753,
+    0xdcb196a43bc164af, 0xd4618b976ac5842d, 0xbf97841657d6a289, 0x7d8c5e3986c9a1f5, 0x9e164f8a94acbf63,
+    0x8f15b3ca928eadbf, 0xb562a48fe1a2fc3d, 0xc7fe329432c51da9, 0xbc19f8454fb93c17, 0x279b4e565eac4b83,
+    0x1e5294c65a9c48df, 0x831f4cba9ab1785d, 0xcda65b9ed7b386c9, 0x1587ed4fe5c8b637, 0x867c52f1f4b9c5a3,
+    0x3eb2596436acd521, 0xf3217d85439fe27d, 0x2c3f41e873b412e9, 0x54d21c9a9fb83157, 0x94b526f87d984fb3,
+    0x749daf1bac9b6e31, 0xbf8e5d7cb97e5c8d, 0x8ced3b6fe6817bf9, 0x7a3c98521893ab67, 0xf594cb832586b9d3,
+    0xcfe415b7648ad951, 0x58a2bd96527be6ad, 0x6cb89eda918ef62b, 0x1724ec6dcfa32597, 0x6e579fadcd9745f3,
+    0xbf7493c1fd9a6471, 0xc6a54de21b7a62cd, 0x26fba8c43a7e814b, 0x4fb163e548619fa7, 0xb45e31ca9784be15,
+    0xd4a6c28ba476cd81, 0xbf561dca9257caed, 0x83d27bfed16cfa5b, 0xcf35968ede5f1ac7, 0x3e9174b21f824a35,
+    0xe2da86743e7658a1, 0xd9847a154c59671f, 0xf24b5c976a4c857b, 0xda192e7ba85d94e7, 0x6d21f7bed981c365,
+    0xe345a9dfe675d3c1, 0x9742ab3fe467d13f, 0x4f359c821247ef8b, 0xfb34ca85425b1ef7, 0xed5c18f76d4f2e75,
+    0x41d68cf98e635cd1, 0x1b956cea9c356b4f, 0x6d5f317edc3769ab, 0xbd1785efe74c8a29, 0x9c4fdb21f63eb895,
+    0xb935f1a43852c7f1, 0x5891ceb32743d56f, 0xae71fb687236f4db, 0x36a2d51ba26b1549, 0x873bcd2a9f4d23b5,
+    0x928f514cbd5f6423, 0x3f594adedc43618f, 0x94db31fed9246feb, 0x618ae5721b278e59, 0xa7cb9184372a9dc5,
+    0xb6de3497672ebc43, 0x7231ace87531da9f, 0x9436c21ba534f91d, 0x4f67931ed2361a79, 0xe1b827cdcf1a28e5,
+    0x9e5c42f1fe1d4863, 0xfb6ce1532c1e45bf, 0x9e56cbf76c12853d, 0x96b12ec76c1583a9, 0xdf8ebc598a29b317,
+    0x1ac4f67ba72bc183, 0x4e8b6539841baecf, 0x195f64dcb521fe4d, 0x84fc5921f3241eb9, 0xc15f837654183d27,
+    0x1c4e97a32ef84c93, 0xb61e8fa43bda49ef, 0xc432ae854afe596d, 0x69da3f876af187d9, 0xc976febdc9f3b847,
+    0x4bc6a15ed5f7c6b3, 0xc6513ebfe5fad631, 0xd96a354214fbe38d, 0x46731f2543cde2f9, 0x1d2754ea91f43267,
+    0xf145ecd98fe751d3, 0x712ef8a98cd96f41, 0xe34561c878ca5e9d, 0x8231ad6ba8ce7d1b, 0xa7b62f31f6e1ac87,
+    0xb1f46dc217d4bae3, 0xcae762f435e7da61, 0xac4f9ed543c8e7bd, 0x1d4a6ef762dcf73b, 0x438d62ba92df16a7,
+    0x5a67e4dcbfd34715, 0x7384f62dced76581, 0xeb923ac1fab863ed, 0xb3fd5a121adc825b, 0x8a7ebc6438be91c7,
+    0x6f5e2c1768c1bf25, 0x2a15639876b4ce91, 0x9f62cba87395cbfd, 0xfc2391da92a8fc6b, 0xe6d9a15fe2ac1bd7,
+    0x2475ac9edeaf2b45, 0x154bcea32fc359b1, 0xa8f19b243db5682f, 0xe8dc6b343dc9768b, 0xb7a4f96548ab95f7,
+    0x24675c3a98aeb475, 0x18d7ea5cb7a2c4d1, 0x826e435dc6a5d24f, 0xe9a581bfe396f1ab, 0x6ce7d3f545cb3129,
+    0xfb438e9541ac2f85, 0x854a73d65c8f4de1, 0x34d97ba87d926c5f, 0xb461c3287d846acb, 0xb49c1a7edca78b39,
+    0x1a45793fe67cb9a5, 0x4ad7c531f68ec913, 0xa5d247632591d67f, 0xfe261b932483f5eb, 0xb6d7f93873b81659,
+    0xb54ae6f9819a24c5, 0x475e2fcbaf9d6543, 0x54f827abac7e529f, 0x9d1ab47fec94821d, 0x8375d4cfeb748f69,
+    0x9764d1c21a679ed5, 0x1a4b2673287abd53, 0x376ebc14345dcbaf, 0x12d4feb98571fa2d, 0x53f1b78dc3741b89,
+    0x694c1f8dc18729f5, 0xb5d96f8edf6b4973, 0x4698d7efed5b46cf, 0xf6a13d821c5f764d, 0xd826e7543d6284b9,
+    0xabf324865c86b427, 0xf2d517387a68c293, 0x67c5f8b98659b1ef, 0x231687ea934bcf5d, 0xfa95b1ced4621fc9,
+    0xe3d27691f1852e37, 0x75fd1cb321674da3, 0x17ce4b954f5a6c21, 0xdf1638254e3c5a7d, 0x5a7eb3865b3f68e9,
+    0x25f4ad9bac42b957, 0x752d684ed945b7c3, 0x54d3ce9fe859d741, 0x48a39f21f53ae49d, 0xc69fd573265df41b,
+    0x43257e9a95612387, 0x8f17c4ea917652e3, 0x97eafcdbaf497261, 0x61ced9287c285fad, 0x738f95da9a3c7e2b,
+    0x5bfe94adca2f8d97, 0xeba7825fe842abf3, 0x48f61ec32935db71, 0xc63917243526e8cd, 0xec485a17652af84b,
+    0x54cf92ba943e18b7, 0x735e1cbdc3614825, 0x38f247bdcf245691, 0x374ab96cbc1764fd, 0xda7e62c1fd1a836b,
+    0xc3bf29143b1c92d7, 0x4ed15cf76a2fb145, 0x29cb5a876823cfa1, 0x3f7e6ba98725cd1f, 0x98f65dea9416fd7b,
+    0x4f51d79cb42a1ce7, 0x597bc32ed31e2c65, 0xed251f6cbdef4ac1, 0x17b9ea821de2693f, 0x2b6fd1e32df4679b,
+    0xc6df4a154cf8a719, 0xbf8ead7549fcb685, 0xa1ef752987fdb5e1, 0x43f7ec9ba7e1d35f, 0x7c5df81ba5e4f2cb,
+    0x7d4c16afe5f81239, 0x185b9ad324fb31a5, 0x2fc1b53652db4ef1, 0xcd5be3a43cbe4d6f, 0xfe14c2d65ae26cdb,
+    0x67ef94a87be58c49, 0x3cba261dc8e79ab5, 0x4386c72ed7ebca23, 0x367e21cfe4bdc78f, 0x8e2bdaf325c1e6fb,
+    0xa1de5fb435e41769, 0xa2e95c4873e826d5, 0x16d5287a91eb4653, 0x9f3452a87ebc53af, 0x87b9635a9cbf732d,
+    0xd546c7afecd3a189, 0x81b54d6ed8b49fe5, 0x6e9b4f7219c8be63, 0x79fe16a32598acbf, 0xd983feb5459ceb3d,
+    0x6d3e1b5875d21ca9, 0x72891ceba4d53b17, 0xca53e98dc1d74a83, 0x645839ecbea947df, 0x3f68e291feac675d,
+    0x67f39ec21daf75c9, 0x8ed726354dc2b537, 0xf748b3e659b6c4a3, 0xd6179ce878b9d421, 0xade57b39859ae17d,
+    0x51eb3c49837befd9, 0x867d4b2ed5b12f47, 0xba476d51f1a54eb3, 0x71fc4da542b86d31, 0x48c1b5f32f795b8d,
+    0x3afde1743d7c6af9, 0x4918dc254c8f9a67, 0x52efad787a92b8d3, 0xf85ab72dc9a6d851, 0x5cafb13dc487e5ad,
+    0x5ec19d2fe48af52b, 0xaf62d1c325ae1497, 0x6bfa273876a154f3, 0xb86d145a92b56371, 0xa7b3c8e65f8761cd,
+    0x14e67c298d697f3b, 0x82ed491a9b5c8ea7, 0x8f35971dc97fad15, 0x698a45f1f973dc81, 0xd58be4121764c9ed,
+    0xd1b489232467f95b, 0x387fc1a6546b19c7, 0xa3fec72ba48e2935, 0xb9317a2dc39257a1, 0x2f7b1aecbe84761f,
+    0x83c72a9ede56847b, 0xe7539421fc5a93e7, 0x91b64d821c7db265, 0x7bd18ea5496fb2c1, 0xfda87b465863ce2f,
+    0x7ca4eb287654fe8b, 0x297a518ba4581df7, 0x8fa5b43dc36b2d75, 0x791fb35dc26e4bd1, 0xf876cd1ede516a4f,
+    0xb89d67121f4368ab, 0x9c6dbf843e46a829, 0x31e7a6b54d3ab795, 0x956f7de8794cb6f1, 0xdc1b826a983ec46f,
+    0x14dfe92ba752f3db, 0x1e973a5fe8671349, 0xd38eaf51f46932b5, 0x27c4ae65457c6123, 0x4b3d85c6513c4e7f,
+    0x9cf15ed65f316deb, 0x9eb76a287e238d59, 0xafced2498d269bc5, 0x863c195eda29cb43, 0x3c149d5ed62bc89f,
+    0xa95431cdc63fe81d, 0x9e28fab32a431879, 0x7f362da5483627e5, 0xbc16842a952a4763, 0x6f7adeb9812a54bf,
+    0xfbd3746a9f1e743d, 0x2964a5edce3182a9, 0x475e3dafed35b217, 0x13b57a9fea16bf73, 0x851d74f32817adcf,
+    0xe51afb94371aec4d, 0xc1bf3925451efcb9, 0x18ec493ba8143c27, 0xeb68573dc5164b93, 0x5f83e2bcb21748ef,
+    0xe173b94cbefa586d, 0x5619a37febfc76d9, 0x4378b9521cefa647, 0xaed27f454af2c5b3, 0x83ead2f76af7d531,
+    0xfde23ab656f7e28d, 0xcb3ad19875dae1f9, 0x8673ebfcb5fe2167, 0x14b9e27cb5e14fc3, 0x3df25aced2f56e41,
+    0x26d8954321f65c9d, 0xf6cd71543fe97c1b, 0xce153a243ced9b87, 0x28dbf3a658cfa9e3, 0x2ea76f498ae3d961,
+    0x874bce6a97c4e6bd, 0x79fa26edc5d8f63b, 0x3fa4bed1f4ec15a7, 0x17cab2f327de3615, 0x7b2da34875e26481,
+    0xf519bd7871c462ed, 0x253b48a76fd7815b, 0xa3cd87565dc98fb7, 0x678ad2e989bcae25, 0x46f8715dc7afbd91,
+    0x43e6a78fe692cafd, 0x5e9b834217c4fa6b, 0x9e367c2435c81ad7, 0x7bad62f876dc2a45, 0xb13a547873ce48b1,
+    0xa468537ba3c1672f, 0x56ac971bafc3758b, 0x319587fdcdb694f7, 0xfcab9741fdcab375, 0x8c9d54132a9cb3d1,
+    0x1df7a824389ec14f, 0xb67c3df54682ef9b, 0x81b7aef987b62f19, 0x897e3d6ba4b92e85, 0x61b2a38cb39a4ce1,
+    0xe64b2f5dc19d4b5f, 0xc3d7529fef8169cb, 0x38a9bd521fb48a39, 0xa78c56932e96b8a5, 0x8f14e7965d9ac813,
+    0x7a823ce5498bc57f, 0xdc21aef9867fd4eb, 0x697a3b4ed8b31459, 0xd6ca128fe6a723c5, 0x7a264531f5ba6243,
+    0xac5f78e3238b519f, 0x6b937cd4317c5efb, 0xe97d68f54f718e69, 0x16f5e9276e739cd5, 0x914d267a9d87bc53,
+    0x8e3427dcb857c9af, 0x489b3cedc76be92d, 0xf319bd4ed45ef789, 0x3ef657b2179328f5, 0xab15c97325a64873,
+    0xbace3417627845cf, 0x1b73ec6a918b754d, 0x3452fbd98f5e73b9, 0xa5973c8dce81b327, 0x3d7a819fed75c193,
+    0x574cb9fdc845aedf, 0xf7349b521948ce5d, 0xbc1725d3264afdc9, 0xafc219b6586f1d37, 0x6c851fba96724ca3,
+    0x96e8374dc4876b21, 0x24b6e75dc148597d, 0x963c8fedcf3b67e9, 0x6432ba51fd3ea857, 0x9adbce132e51b6c3,
+    0x1dbe26a43c75d641, 0x71ba93465a46e39d, 0x3e14a7f87859f31b, 0xe48f9d5cb95d1287, 0x69821a5cb76f41e3,
+    0xbd789c1ed4736f51, 0xfa5e6bd1f1345ead, 0x9e1cb5f431487d2b, 0x1ec283643f2b8c97, 0xc1d859465c2d9af3,
+    0x15f2a4c98c42da71, 0x2845ce398923e7cd, 0xf8239a1dc926f74b, 0x91c7845fe83a16b7, 0xce962531f84d3725,
+    0x462a5cb3273f4591, 0x6fa1c9d8754263fd, 0x976f854a9135826b, 0xa86cd5276f2891d7, 0x34256c898d1baf35,
+    0xfc571829892dbea1, 0xfb89376cb932dc1f, 0x461c9b3fe813fc7b, 0xeb83765439261be7, 0x1fc93d45481a2b65,
+    0xe2435cd8762d49c1, 0xe9d6317a941e583f, 0x497fac2dc312769b, 0x26815b3cbef4a619, 0x5bcf6e9dcdf7b485,
+    0xbd2a568edaf9b4e1, 0x5d49cea219ebc25f, 0x7af1b9e437dfe1cb, 0x36794a187af52139, 0xa246357987e62f95,
+    0x281d9e4a95e84df1, 0x785316fa92ea4c6f, 0x7f968dca91fe5adb, 0x4dcf782edfe18b49, 0xe4fb6d721fe3a9b5,
+    0xb328a7c54de7c923, 0xf7ed23843ad9c68f, 0xe34269d547cad5fb, 0xd8c2fe4987cef469, 0x927fa4bcb8e324d5,
+    0x264f7baed7e86453, 0xbda1456fe3d852af, 0xaef6812434eb712d, 0xd2b967c431cd6f79, 0x46cb73e54fb19de5,
+    0xfe6251b87ec4bd63, 0xc9816ba76895cabf, 0x4e7d6c5a97b8ea3d, 0x6f9a4c8ed5bcf8a9, 0xc5ad197fe6cf2a17,
+    0xf791653217d24983, 0xcbe912f323b546df, 0x6b1d384542c9765d, 0xdbe3ca4761db74c9, 0x5edfc7698fbea437,
+    0x9c457e3a9eb1c2a3, 0x3694a1dfecb6d321, 0x54a16c3fe895cf6d, 0xad38b7421687fed9, 0x137ceda438ac1e47,
+    0x24f8ac76569f2db3, 0x357ce81a97b46c31, 0xdef7b43a92b45a8d, 0x46a8bc2dc1b768f9, 0x892f143edf8ca967,
+    0xc8f95241fc8ea7d3, 0xf6acd9343ea2d751, 0xc46b85e32b83e4ad, 0x97f31bd65a97f42b, 0xea945dc768ab1397,
+    0x897fe64ba79c42f3, 0x235a7efdc6af5271, 0x51789b3dc3825fbd, 0x2ae897f1f1957e3b, 0xfe51278321968da7,
+    0x872519643f7bac15, 0xab4637d54d6ecb81, 0xbc138df65a61c8ed, 0x1f47c82a9a73f85b, 0x81a32d9eda9618c7,
+    0x96c2d58fe79b2835, 0xdb74c351f58d46a1, 0x19b25c83248e651f, 0xea24f5c65492837b, 0xc2d8fb47618592e7,
+    0xcf52dea98f79b165, 0x6f94dab87d59afb1, 0xf2a8c5e9895cbd2f, 0x4e26c8fdc951fd8b, 0xc9e865dfe9641cf7,
+    0x8a3de7621a682c75, 0x659b8ae437694ad1, 0xdaf46258736c594f, 0xefd18679824f57ab, 0x7b98c3adc163a729,
+    0x9b627e4dcf34b695, 0x482b56adcd48b5f1, 0x248651bfeb4ac36f, 0x7afd6892194ce2db, 0xe21f6c976c731249,
+    0x385e7ba98a7631b5, 0x34ce8a1ba9685f13, 0x78945afba5394d7f, 0x419ecf2a923a5ceb, 0x65c7f2bed13f7c59,
+    0x679e43cfef329ac5, 0x17d59c321f26ca43, 0x729c6e543d26c79f, 0x9f4be8a65b3ae71d, 0xec942b676a2df579,
+    0x86352a4cba4126e5, 0x59bf61aeda274563, 0x4d3c89fed62753bf, 0x58d2c931f54a723d, 0x5f2ab7c3243d71a9,
+    0x6cde84b5412d8ef5, 0x965b3e476f12be73, 0x3cfb48576d14abcf, 0x51a38cd98a17eb4d, 0x549b276dc718fab9,
+    0x84971f3ed93e1b27, 0x89d46731f8214a93, 0xaf916723281347ef, 0x1f8376943418576d, 0xd269fe37631a75d9,
+    0x615ef74a921da547, 0x356eb4287dfea4b3, 0x8f69ce1bacf2d431, 0x96b14dfcbaf4e18d, 0x6f73be8cb7c5dfe9,
+    0x57d1ca6329ea1f57, 0xf93b48a547fb2ec3, 0x28561f4767ef5d41, 0xc4fe5ad874f25b9d, 0x8b61f32a93f57a1b,
+    0xa86fc32dc1f69a87, 0xdc28ef6a9fdba8e3, 0x5479ea81fbdec861, 0x278aebd32ac1e5bd, 0x69b184e32ad4f53b,
+    0xe5f378265be814a7, 0x623a41f989eb3415, 0x4a72d53ba7ed5381, 0xe925df8a94bf51ed, 0x76eca94dc3d27f4b,
+    0xe8dfc621f1d48eb7, 0x8e7cf63431e8ad25, 0x8e62b9343fdabc91, 0x82e3dac43a8cb9fd, 0x5134d2865ac1f96b,
+    0xd6afe7198ac419d7, 0x85c316adcad82945, 0xcda1b2efe6da47b1, 0x4ebca5dfe4bc562f, 0xf54768d213cf648b,
+    0x7da13ec654c293f7, 0x27ef6d1981d6b275, 0xa96c14f76fa8b2d1, 0xfd15be976c89be3f, 0xab129e87687cde9b,
+    0xda67813edab32e19, 0x2743da51f9b42d85, 0x678eb2c328a74be1, 0xda9587e326b94a5f, 0xc16a2f85439d58cb,
+    0xd59e8ca762bf7839, 0x54c7638a91c2b7a5, 0x5314f9bcbfa6c713, 0x567efd4cbd98c47f, 0x2bc3d971fa79d3eb,
+    0xce37a8521b8df259, 0xdb8562376ba132c5, 0x8c2a75e98ab76143, 0xa261f97875964e8f, 0x1c35f24a93785dfb,
+    0x2743f5acb28c7d69, 0xf6827c1dc17f8bd5, 0x6d413acfef82cb53, 0x571bace21e64c8af, 0xf1c8e7643c67e82d,
+    0x16a9fed43c5bf689, 0x6eb8a5f76a8d17f5, 0x34b9c87dcba14673, 0x7a4ed32cb78354cf, 0xa6cb59dfe598734d,
+    0x28f7ae91f36a72b9, 0xe31d8cf4348da127, 0x378cbe15416eaf83, 0xfe6adc154e52acdf, 0x7924eab87b64ec5d,
+    0x6249dfc87a46fbc9, 0xbd97145eda6b1c37, 0xf46c983ed86e2ba3, 0x5872bd41f9836a21, 0xfe891b421963587d,
+    0x95a2cd43234576e9, 0xa68f42b9824ba657, 0x648153f9816da5c3, 0xbc74f83a9e6fc541, 0xe8c514fbac53e29d,
+    0xf7c48baedc56f21b, 0x2b5438a1fc5a2187, 0x4ce87912195a2fd3, 0x5ae82cf4396d4e51, 0xd23a6fb767415cad,
+    0x3b14e59a96547c2b, 0x1673bacdc2358b97, 0x582ec6adc148a9f3, 0xe2a6835cbf3dc971, 0x2c75d46fea2fb6cd,
+    0x396cdfa21d32f64b, 0xe6bf27c54d3615b7, 0x2deaf5198c4a3625, 0xc8bf43798a3c5491, 0xc6312f7a973c52fd,
+    0x932df58ed742816b, 0x4f57a8bed4238fc7, 0xc57ad491f127ae35, 0x86f97e154238bda1, 0x1c9847f54e2acb1f,
+    0x321a8f454c1fea7b, 0x42ed5f398c231ae7, 0xa34db61cbc172a65, 0xba4c719eda2948c1, 0x684d71aed81b573f,
+    0xb42d7f61f41e659b, 0xdc98e3654732a519, 0xde1a2c587614b385, 0x5f2486798427b3e1, 0x21ac3d576de8c15f,
+    0x95ec3bf659e8dfab, 0x9ad23c7878dcfe29, 0xbf5a324dcaf12e95, 0xb74c1dfed8e54cf1, 0xd5ea1f4218e74b6f,
+    0xc24d876324f859db, 0xd314e5a653fd7a49, 0x1ca2385762ef98b5, 0x8c6e7a3ba1f4c823, 0x92bd5e3a9ed4c58f,
+    0xcdef85ba9ac7d4fb, 0x84db361feadbf369, 0xaf2dbc632ace13d5, 0xbc7634f87be16253, 0xf852bcd768d451af,
+    0x42cfb61985c76f1d, 0xf5e48cd983da6e79, 0xbde7c91a92db8ce5, 0xf89ad2ecb1dfac63, 0x96f3bd2edea2c9bf,
+    0xec9846a21fb5e93d, 0xa52871432dc6f7a9, 0x49f51ba65bdc2917, 0xbd349e676ace2783, 0x1964bfda98b145df,
+    0x9abf1e5cb8c3745d, 0xda621c9fe4d673c9, 0x9e45a6c1f4dba237, 0x72b6a4e324cdb1a3, 0x2d9f8354318c9def,
+    0xa1496cb54f92ce6d, 0xfe45d1865b84fcd9, 0x62b5aed98cb91d47, 0x9c1d2a3ed89a2cb3, 0xf8db17aed8ae5b31,
+    0x6c4be281f6b1598d, 0x1cfbe63215b367f9, 0xcba6ef5323c5a867, 0xb9a8423652b9a6d3, 0x81fdb74982adc651,
+    0x5d96f3b76e7fc3ad, 0x17e2fc6bad94f32b, 0x64a2718fedb61297, 0x8e1a254feba941f3, 0x5f7e6c132a9b4f61,
+    0x78cb9243267c4ebd, 0x78dbce3656917d3b, 0x5e8d2c6764938ca7, 0x74213badc397ab15, 0x6d342caed279ca81,
+    0x7159efba9f5ab7ed, 0x795d14fedc6fe75b, 0xb2856ec32e9316c7, 0x9ba6cdf54da82735, 0x623fc9e76c8945a1,
+    0xc34162b8798b641f, 0x867da45ba58e627b, 0xa3e186cdc58291e7, 0x8fcdb17ed283af45, 0x49fbe381f276aeb1,
+    0x2537e8643168bc2f, 0x684daf232f4aec8b, 0xd5fb83143b4deaf7, 0x3db8129a9d832b75, 0x9e43cf7bab7649d1,
+    0x9f56478dca69584f, 0x413a7c8fe74c56ab, 0x3fce4961f45e8629, 0x1e4895632671b495, 0x3c245df76375b4f1,
+    0xd7f1c4b98157c26f, 0x8a946dc76f48e1db, 0x26fbe5487c4bef39, 0x6d12958a9b4e1fa5, 0xa5c1b7dedb745e13,
+    0x971d4b2fe9354c7f, 0x5dfa893218375aeb, 0x47cbaf13263c7b59, 0x8b4ae1d7643e89c5, 0x24edfc8ba561c943,
+    0x4721aceba143c69f, 0x6d92487baf37e61d, 0x518cb2adcd2af479, 0x9ad2b831fb3c14e5, 0x7e569bf21c5f2463,
+    0xd6e314876a4352bf, 0x248c5be98a46713d, 0x1fea946ba5276f89, 0xbd3c467a942a8df5, 0x75231b9cb42ead73,
+    0xd2a41f8ed231bacf, 0x6895a17dcf13ea4d, 0xd96bfa132e15f8b9, 0x34752df65e3b1a27, 0xcb6a25976c1d2893,
+    0x3b1ad6e8791d36ef, 0x36db791cba12756d, 0xb896ac3dc81574d9, 0x7a6298dfe619a347, 0x84976a31f51ca2b3,
+    0x4d8cf596564ec231, 0xb89534a65321cf7d, 0x7cbe8a154bc2fde9, 0xb658c3298cf61e57, 0x267beda87af82dc3,
+    0xf67241eba9fb5c41, 0xa1d594ecb6fe4a9d, 0x1792a3cfe6f2791b, 0x381eb95215f3a987, 0xc9f45bd324f6a7e3,
+    0x4b3ef8c653fac761, 0xd3c869a761fac4bd, 0xd2fec6787dcfe43b, 0x8461ab9cbde413a7, 0x5d3b86fedce84315,
+    0x85ad6fc1fbea5281, 0xba536ed217b94fcd, 0x71ad986327cd6e4b, 0x2137d96545e18db7, 0x17ae468986e4ac25,
+    0xfd614b2983e6cb91, 0x18563f9a91c7b8fd, 0x1975d23a9face86b, 0x3146e5fdcbaef6d7, 0xaf61b7921ed32845,
+    0x36bafde43cd746b1, 0x1c2d43854ac9652f, 0x54218fc657dc638b, 0x6ebc187a95bd82f7, 0x9fa5286dc6d2b175,
+    0xfc8a5d3ed3b4afc1, 0x45ab7c9fe1a6bd3f, 0x165d4b8321a7ed9b, 0x68efd5b43e8bfc19, 0x4ae9b8d54daf1c85,
+    0x6973b4f87cb34ae1, 0x4c3f2a798ab6495f, 0xc71b25ded6a857cb, 0x8e4da5cfe5bc8739, 0xab763291f3be96a5,
+    0xd76fba8547b2c613, 0xf3b74a9652a4c37f, 0xef8bd1765196d2eb, 0xcafe2b876e8af159, 0x2618d3598e9d21c5,
+    0xf4ed512bab9e4f23, 0x86c2ae5dca924d8f, 0xed1b548fe7845cfb, 0xd4bc156215a87c69, 0xb94f5cd3247b8ad5,
+    0x48e296a7648eba53, 0x63f2c8e76381c7af, 0x61ed9a2ba194e72d, 0x38a2967cbe76f589, 0xe7369a8dcd8a16f5,
+    0x49d638e1fc9d2573, 0x9b41a8c21a7e43cf, 0xebd93a165b93724d, 0x9d7ba4c54a8571b9, 0x27c6e98ba5689f17,
+    0xdc7b495a946bae83, 0x1b35ac79825c9bdf, 0x21f3cb9dc271eb5d, 0x254bd17ede53fac9, 0xf15a92632f681b37,
+    0xdf12ab354e6b29a3, 0xdbf3ac476c7d5921, 0x6718cd298a5f467d, 0x1a2653bcba6275e9, 0xfb82396ed986a457,
+    0xd571be2fe568a4c3, 0x43c95da1f57bc341, 0xd4bef813235ec19d, 0x3aec1d754251def9, 0x768f43e98e541f67,
+    0xf1d34c598c572ed3, 0xcf9b172a9c6a4d51, 0x38475f9a983c4bad, 0xa847f5bed84f6a2b, 0xb547d6f1f6428a97,
+    0x65e93cb21745a8f3, 0x7695fe343549c871, 0x84bf59676239b5cd, 0xc6e48db9813de54b, 0x7152fc4baf5214b7,
+    0x21b3a79dce673425, 0xd49b265fed485391, 0xa78d436fea3951fd, 0xcf5a1342192c6f5b, 0x218adc94382f6ec7,
+    0x4acd75987842ad35, 0xdea34b898635bca1, 0x2b6df13a9437ca1f, 0xaf13c48dc12ae97b, 0x6f9273cbad1cf8e7,
+    0x6a7cd941fe312965, 0x697a81b43e2547c1, 0x6a7c38254c18563f, 0xe23b71465c1a649b, 0xcad3b7f87a2d8419,
+    0xf46d3eacb71fa285, 0x3f1b95cdc734b2e1, 0x1548fbadc315be4f, 0x8baf97c1f216deab, 0x6a128935431afd29,
+    0x7b39d8a43efc1d95, 0x5c9fb1365ade3bf1, 0xd9ab56f87be24a6f, 0x31e24f5879f458db, 0xb58c27edc6fa7849,
+    0x4238f9ded4fc97b5, 0xac6bf58ed5feb723, 0x6ea51cd325e1c48f, 0x847eb9f652e4d3fb, 0x54acbe2651e7f269,
+    0x1692cba87fea12d5, 0x926c7fea9ced4153, 0x936b12a878bd3e9f, 0xae16589cb9c36e1d, 0x7df28e41f8e46d79,
+    0x13facd8216d78be5, 0xcf9651d325ecab63, 0x3c269ed543cda8bf, 0x94326c7874c1e83d, 0x4c15872981d3f6a9,
+    0x4eb8fa5cbfd92817, 0x4b325f9dcedb2683, 0xb587cd1fe9ab34df, 0x971fac621abf635d, 0x9ce62f154ad372c9,
+    0x9f7c152659d6a137, 0x56f49a1765c7af93, 0x45b8e2d763a89cef, 0x586347b9829ebc6d, 0x1b8af34dc2a1fbd9,
+    0x8ac37ebfefb51c47, 0x3f4e61821fc72ab3, 0xafb34c954ecb5a31, 0x5dce97f43bac478d, 0x63d19e8548ae56f9,
+    0x9f86531cb9c2a567, 0x691ea8fdc7b6a5d3, 0x43ad6e1fe6b9c451, 0xda576be1f389c2ad, 0x5eb9d364349de12b,
+    0xb2453f9764c32197, 0xdb3ac4276d952fe3, 0x7aef64c87da84e61, 0x6f4ae5276a784cbd, 0xf5a6921ba98d6c3b,
+    0x38abc5ded58f6ba7, 0xea8bfd21f793ba15, 0x1dcae5b326a5c981, 0x859e76232387b6ed, 0xec34f6b5428ae65b,
+    0x8b9fec37618df4c7, 0x91f8a4dcbfa12635, 0x251bac8dce9654a1, 0xd564cb8edc98631f, 0xf5a39781fc8a617b,
+    0x3fac6782195b6fd7, 0x5c8fd213287f9e45, 0xe7829fc65673adb1, 0x54261f898475cb2f, 0xd96cb32a9256ea8b,
+    0x65e241bcb15ae9f7, 0xf5c3649dcf6e1a75, 0xce893521fe7248d1, 0x9be87f421d83574f, 0x125ba9832d4765ab,
+    0xe6c3a2b54c6b8529, 0x7d45cf98786da395, 0x8b54d96a976ea3f1, 0x681bfdacb573c16f, 0xcae2783ba254dfcb,
+    0x8c34bf1ed157fe39, 0x73c95a14326b1ea5, 0x48a1dc365f6e4d13, 0xdb9c5f276d514b7f, 0xb1467fc87c4359eb,
+    0xf342196cbc367a59, 0xf7d642ced73a98c5, 0xe64d58bfe75db843, 0xd41cb9fed43eb59f, 0x795e6d232763e51d,
+    0xbdf935c76245f379, 0xfd456ba9826913e5, 0x2487f93a9f5c4263, 0x487ce5b98c3d41bf, 0x384fcd1bab416f2d,
+    0xbda62c4edb236e89, 0xa89d2b4fe9268cf5, 0xbc1a9e621829ac73, 0x61a5fe74352ba9cf, 0xa6f253b7652fc94d,
+    0xa217e3b98432f7b9, 0xe2b9154dc3461927, 0x1c4b728dcf1a2793, 0x1d5ba3ecbc1a35ef, 0x8764d531fb1e546d,
+    0xadeb71654c2173d9, 0x2df5a4e76c15a247, 0x2c1b56376927a1b3, 0x54f876e98739bf21, 0x21f843e9841abe7d,
+    0x26a3eb19831fdce9, 0x81dec4bfe4231d57, 0x1483b52edef52bc3, 0xe6f7d5432ef85b41, 0x8c1b56432cfa489d,
+    0xa72cfd354afd681b, 0x31def6754aef9687, 0xb29de15a98f2a6e3, 0xd79bf56cb8f7c561, 0x139fae5ba4f7c3bd,
+    0x25a9d8bed4fae23b, 0xc8b96f1323edf1a7, 0x47b8ca3986f34215, 0xbc432fd76ed54f71, 0x7123f5465ab64ecd,
+    0xbe65fd987ae96d4b, 0x8df7c61a98ed6cb7, 0x7526f13dc7df9b25, 0xf9b62831f6e3ca91, 0x5ba7cd6215c4b7fd,
+    0x6fe8cad323d8e76b, 0xd3a1e4b542caf5d7, 0x51267e9a92de1745, 0x234761ca9fd245b1, 0xa2179c8badc5642f,
+    0x7c64aebfecd7628b, 0xcb1698dfe9ca81f7, 0x59c3a8e218bc9f65, 0x1c867a9436af9ec1, 0x3fb28ce656a2bc3f,
+    0xb1e3c52763a4ec9b, 0x72cb4fd983c7fb19, 0xd769af2ba2dc1b85, 0xd14ef86cbfad39e1, 0xe42a3b1fedb1485f,
+    0x174d5ef21ea356cb, 0x1c2fab432dc78639, 0x7b926cd438cb94a5, 0x29b4dc5878adb513, 0x137f58c9859eb27f,
+    0xc8d5196ba593d1eb, 0xec2f968dc2a5ef49, 0xa654be1fe2a81fb5, 0xeb2cf97651ab4e23, 0x9d2c56732e7d3c8f,
+    0xd74a6e154d815afb, 0xae217b465da37b69, 0xce379b287ba689d5, 0x98ab4f3ed78ab953, 0x5917fc3ed47cb6af,
+    0x3eb752cfe48fc62d, 0x35dca47215a2f489, 0x85b3cfa763a714f5, 0x24d86c1981ba2473, 0x46aec2d76e7a42cf,
+    0x6edbf31a9c8e614d, 0x81b93eacbc716fa9, 0x92adf47edb849e17, 0x4728dba1f976ad83, 0x8e4f73b216579adf,
+    0xda8b46f3246bca5d, 0xe9862415435fe8c9, 0x4dfba96cb5941a37, 0x6e3a854dc19628a3, 0xfa1927bdcf7a5821,
+    0x6f32c51dce6b457d, 0xd7345c61fb5d64e9, 0x1825dc632d81a357, 0x73e1b2f54b75a2c3, 0x15cd3a976a78c241,
+    0xd94136276547bf8d, 0xc346fdb8734acdf9, 0x48d9761ba24efd67, 0x29cd7b8fe1742cd3, 0xd29a716fef674c51,
+    0x3c48aef21f3749ad, 0xfb73a1543e4c692b, 0x8c1f9db54c3e6897, 0xd5f462198b51a7f3, 0x985b164cba54c671,
+    0xe36594aba736b4cd, 0xb9ac612ed659e34b, 0xb5d3916fe34cf2b7, 0x7ef49d35467f1325, 0xd845c26983745291,
+    0xd2bc3e976c254fed, 0x3c542ed87d286e5b, 0x5c8e4bf98b2a6dc7, 0xf9386b2cba2e9c35, 0xa9c4583fe842cba1,
+    0xb6451ecfe734c91f, 0x84ba73621625e87b, 0xd2bca6543429f6e7, 0x8cb1467a943d1865, 0x4d2cfb6a924f36c1,
+    0x1764893bae12653f, 0x485b217dce15639b, 0x5e68bdcfed2a8319, 0xa2be67c1fb2ca185, 0xfd8a1634382c9fd1,
+    0x5f3c79465821bd4f, 0x1e248fc65613edab, 0xd275ceb98516fc29, 0x794ba85cb42a1c95, 0xd526b91cb42c3af1,
+    0xe81c925baced396f, 0xb8c7263fecf157db, 0x4ced39121df38749, 0x4671de232cf796b5, 0x4b82c39659fab623,
+    0xa25ec3d656ecb38f, 0x6cb37ea875dec2fb, 0xadfe713cb5e3f169, 0xa5e9684dc4f721d5, 0xa67183ded1e92f43,
+    0xce4f96b321ea3d9f, 0x87c216b43fbe5c1d, 0x8fe924654de16c79, 0xd6b918a76bd38ae5, 0xce12daf989e7ba63,
+    0x7c2f6e3a95d8a7bf, 0x1e4f6c8ba5ebc73d, 0x95186b7ed3cfe5a9, 0x7bafd35438e42617, 0x8a4e65c764e72583,
+    0x4d91f6e761c843df, 0xa13725b87fcb625d, 0x7e5cb4287dbe61c9, 0x87ad31cbabc19f27, 0x7a8cb51ed8c4ae93,
+    0xf649ca2ed6a59bef, 0xcbf4ad1215a8cb6d, 0x85e26143248bead9, 0xfc794d2653befa47, 0xd3ae58b985d429b3,
+    0xa9d263bcb2d75931, 0xc26e4a3bafb9468d, 0xb4fe592dcdab65f9, 0x479c36e1fcbe9467, 0x74be96832cb1a4d3,
+    0x6cb4f9754ab6c351, 0x2d4a39b54796c1ad, 0xd36efa576598df1b, 0xb16283c7639bfe87, 0x86c9f3aba49f1de3,
+    0x813d62afe2b34d61, 0xb26a843fef854abd, 0x7cfd39a21f986a3b, 0x25179fe32e8c69a7, 0xcf9471e54c8ea915,
+    0xe8a34c576ba2c781, 0x75128eda9783b5ed, 0x8ec61f4dc697e45b, 0x6951d7aed489f3c7, 0x94b6fd31f6ad1435,
+    0xc65e4bd3259f43a1, 0xf149a62873a4621f, 0xb58971c43e845f6b, 0xc9baf7354c586ed7, 0x31fde7298c7b9d45,
+    0xc453769ba86e9cb1, 0x7fd23c9ed871ca2f, 0x48fd27b1f563e98b, 0xa176e5c21465e8f7, 0x16fec9d4348b1975,
+    0x4f28ea97648c37d1, 0x72483f6a918e364f, 0x4387fcba9f7264ab, 0xcf27938dce768429, 0x6db5319fed68a295,
+    0x685b43cfe96ba2f1, 0x5971ca42184cae5f, 0xdbe7ac943751decb, 0xb3784ca65764fd39, 0x8c6b125a94671da5,
+    0x1829d5bcb57a4c13, 0xae4d361cb15c3a7f, 0x586ecf7bad3f48eb, 0xa7264bd1fe427859, 0x368efb521e3497c5,
+    0xb458daf32d59b743, 0x437d8cb6583ab49f, 0x2be975a8785ec41d, 0xd73b481cb851f279, 0x519f368dc87612e5,
+    0xa31b89efe5794163, 0xa7b648ced1483eaf, 0xf5872d14314b5e2d, 0x53978cd43e2f5d89, 0x62ab1e376d328bf5,
+    0x4a5d8e798d25ab73, 0xf9d172a87926a8cf, 0x381da7bcb72ac84d, 0x18b5274dc52de6b9, 0xdfab36e1f9531827,
+    0xb51c974218452693, 0x3b529fc7652734ef, 0x1dec58f9812a536d, 0xeb612af87f1c62d9, 0x5a3def2bad2f9147,
+    0xe47d8f2cbc129fa3, 0x45c6db2eda36be21, 0x2ae3b691f816bc7d, 0x91dc8e632618dbe9, 0x372d9184361dfb57,
+    0x2c86bd5987412ac3, 0xd397e52cb7265a41, 0xd369ae7cb216479d, 0x4af6edcbaef9671b, 0x51fed32cbdfc9587,
+    0xc4b3719dcafd95e3, 0xbeda92843bf2c461, 0x6b5ca89438f4c2bd, 0xadf2153658f7e13b, 0x5d48aec654d8ef97,
+    0x8ef41ac985db1ef3, 0xf874c25ba4df3e71, 0xa249c85ba1f24bcd, 0x17b9546edfe56c4b, 0x894af7321fe86ab7,
+    0x8e23a5643dec9a25, 0x7efa3d454adeb891, 0xe54387a658c1b6fd, 0xb218647a98d3e56b, 0x1d5a869ba5c6f4d7,
+    0x3cda89fed7eb1645, 0xac243861f5ed34b1, 0xad479e5214ce532f, 0x2e8c4a3652e3618b, 0xa7698fb43db46fe7,
+    0x3b1a6f254dc89e65, 0xe8f1a2b768ba9dc1, 0xa5b6def9879dab3f, 0xfb7263aed6c1ea9b, 0x3db15a7fe6c4fa19,
+    0x1c9584e326d71a85, 0x76e982b545ca38e1, 0x953b8dc762bc375f, 0xc29d374871af45cb, 0xae53d2cbafc28539,
+    0x4a659dfcbec693a5, 0xe7a4986fedc9b413, 0x2c754b3fe89ab17f, 0xce97b642167cafdb, 0x72cdaf1437a1fe49,
+    0xd324bf9767a41eb5, 0xb17dfc3a96b84d23, 0x3b1c957872a93b8f, 0x4a15f32ba18c49fb, 0x784351edce8f5a69,
+    0xcf83db91fea298d5, 0xbc981d321ea6b853, 0xc4bf57132c87b5af, 0x92eaf765498ac52d, 0xd7385cf6567de389,
+    0x8bf7a24cb8a213f5, 0xbf3cd95ed8b64273, 0x2b984c3ed39741cf, 0x648ea32fe1895f3d, 0xd2859cb3217c5ea9,
+    0x81a569243e6f8d17, 0x1e2b59765e72ac83, 0xba1429e65b64a9df, 0xb8d3e7298a67c95d, 0x8adef4bcb65ae7c9,
+    0xc56b4fadc56df837, 0xe4bf6a91f69127a3, 0x1d7a25c438a65721, 0x3d28fc643298547d, 0x895b4c76517a63e9,
+    0xc84d61a98f6d9257, 0xca4f2e398d6f91c3, 0x617954fbac74bf31, 0x52b9f38dc954be8d, 0xc59b17dfe746dcf9,
+    0xd65713b2184afc67, 0x63a4bd15476e1bd3, 0xcd2b74fa97824b51, 0x598c674a926348ad, 0xf21ceb8dc157682b,
+    0x5acb183dcf3b8697, 0x83a54d9cbd4c96f3, 0x51b6c74fec4fb571, 0x4763f1a21a52b3cd, 0x5861e2d43a56e24b,
+    0xfe83b5165948f1b7, 0xc324819ba97c3125, 0x968e27cba65d3f81, 0xd5afc63ba3514ced, 0x1bda56cfe1436d5b,
+    0x876dcabfef256bc7, 0xc61b75d21f2a9b35, 0x7398ea254e3db9a1, 0xd19f2a465a3eb81f, 0x81d3f2798a32e67b,
+    0x83297d6ba924f5e7, 0x896c7f3ed93a1765, 0x62e1c3dfe74b35c1, 0x48db67efe62d543f, 0x532f8cb43541629b,
+    0xbea27dc873458219, 0xb7f36c854e169f75, 0x2e31f9676c289ed1, 0x6f7bda18791bac4f, 0xba32e679871fdcab,
+    0xa81294ded813fb29, 0xe539a6d1f8261b95, 0x8fceb635472839f1, 0x7a2631b5451b386f, 0xbc21f468731e46db,
+    0x14bfe89cb3218649, 0x5ecd31498ef294b5, 0x3f8e2a4badf7b523, 0x651b279dcae7b28f, 0xda1836bed7e9c1fb,
+    0x956d4fb217ecdf59, 0xd1b62c9548e21fc5, 0x3f56cb1878f62e43, 0xce692f1874e63c9f, 0xe71bcd2983f95b1d,
+    0xa296ce3ba1fd5b79, 0x148acdebadcf79e5, 0x479cdbe1fde2b963, 0x9a75bc621cd4a6bf, 0x2547f9c32ae8c63d,
+    0xb9571fe437dbe4a9, 0xbf943e6768cdf417, 0x5e32ab1cb9e12483, 0xa645192ba6c542df, 0x467a5e3dc3e8615d,
+    0xabd819cfe1d85fb9, 0x51da762431dc8e27, 0x4d1fbe932ebf8d93, 0xbfca83754cb29aef, 0xe3d7fc8659b4ca6d,
+    0x1eb5928657b6e8d9, 0x7523ac4ba6cbf947, 0x92a3548ed6ce18b3, 0x9ca283e1f7d25831, 0xe915ab7216c3458d,
+    0x38bc9ae432c764f9, 0xe2d75fb651db9367, 0x4fc18b676fac92d3, 0x68c71d398dafb251, 0x59de76c87a82bf9d,
+    0x5c47912dc895de1b, 0xe58c7b9fe5a6fd87, 0x294efc83279a1ce3, 0xc28fe47547ae3c61, 0xe3d9b5c765a149bd,
+    0x2634dec982c4693b, 0x8f17d59cb1c568a7, 0xc72f398dcf9ba815, 0x9b36f45dce9db681, 0xeab2734dc97fa4ed,
+    0xf6945b321c92e35b, 0xf8391ca43a95f2c7, 0xe2b37c4879ba1235, 0x2fd4a5e9879c42a1, 0xa826be49847b3efd,
+    0x3bc9e41dc3915e6b, 0x19de578fe1936cd7, 0x4ba2c18fef879c45, 0xac27d8e32f689ab1, 0x6a5329c43d6cb92f,
+    0x51b3f6c43a5fd78b, 0x8edc71465a82e6f7, 0x489627adcba61875, 0x8cfb179dc78936d1, 0x9b87d16ed68b354f,
+    0x394752d1f27e53ab, 0xcb9a217545a18329, 0xe8d3f2976284a195, 0xb86df9c54d569fe1, 0xa1cd6b576c48ad5f,
+    0xf5dca1476849adcb, 0x531f726ba85fec39, 0xc61ad83fe9731ca5, 0xf3c47691f9874b13, 0xf71d68421658397f,
+    0x4e8c9ba3235a47eb, 0x1ed74f59824e6759, 0x87c461fba27196c5, 0xe57ad28baf75b643, 0x6975e8dbad46b39f,
+    0x8cbed47feb59c31d, 0xa7b39dc1fa4ce179, 0xbfc7e1a2183cefd5, 0xed4f8c276a742f53, 0xcb5e1d8767453daf,
+    0xe781269a96485c2d, 0x849c1a7ba23b5c89, 0x37d5f2ecb13d7af5, 0x4ab1578edf41ba73, 0xb49651afed23a7cf,
+    0xad4b7e521e26c74d, 0xec6182d43c28e5b9, 0xa4c963b76a3cf527, 0xb521cad98a4f1593, 0x4892f1dba85243ef,
+    0x9e38cf4dc837526d, 0xad572ebfe43861d9, 0xebd3729fe12b8f37, 0x62c8df95412d8ea3, 0xc9a854376f43bd21,
+    0x2c4bea365e13cb7d, 0x26ce1bd76b15dae9, 0xd834ce798b19fa57, 0x268fb94cb82d19c3, 0x5df7a4bed82f3941,
+    0x93c8dab1f712469d, 0x6fc8d7b43825761b, 0xcf2e93b6531a9487, 0x1fa9dc48721b94e3, 0xec5f94287efdb361,
+    0x2b3f4c1769efa1bd, 0xeb8d641989e3df2b, 0xf184d79cb8d4fe97, 0x9b45e13dc7e81df3, 0xd7cb465328fb3d71,
+    0xc765b8f325fe3acd, 0xe2f4571875f16a4b, 0xce1b3d5982f369b7, 0x658a13bcb1f7a925, 0x3a7df6598feab791,
+    0x83b1cd4989cba5fd, 0x6deb283fe9cfd46b, 0xe96a78f21ac2f3d7, 0x18eaf5976be81345, 0x3d9e5f4768e943b1,
+    0x5ec4dbf987db512f, 0x5e431b6983cd4f7b, 0x94327d6ba3c16de7, 0x5fab437dc1e39d65, 0xc179ebdfefd69bc1,
+    0xdf4e63721ec8ba3f, 0x941da8632eacd89b, 0x9e238cd54abfe819, 0x92315f687bd31985, 0x641fc8dba9c637e1,
+    0x9dfe3b2cb7c9365f, 0xceb47dafe3da54cb, 0xd32bec61f2ce7439, 0xe2865bf434d192a5, 0xbd9caf7874d6b213,
+    0xc39581243d95ae6f, 0xb418e9254c87aedb, 0xfa614e876a8bed49, 0x851bde9a978efcb5, 0x1d325cefe9b54c23,
+    0x4da2b61fe6b53a8f, 0x936ebf5215a748fb, 0x9b1728d323bc5869, 0x731ac6b542ae87d5, 0xfe192bca92c1b753,
+    0x9e3d71f87e83b4af, 0xed2596cbae97c42d, 0x675dc19edc7ae289, 0x25f1cbaed98be1f5, 0x81643d754baf2173,
+    0xb96ca13547823ebf, 0x4e916f3547965e3d, 0x42a6b3d763875da9, 0x24fdca5ba39b8c17, 0x4be9a6fdc17e9b83,
+    0x74fd196cbe61a8df, 0x38a4d9f1fe73c85d, 0x739d5e621d75e6c9, 0x1fe679432c8af637, 0xac2d51b65b8d16a3,
+    0x1f4d68e98a9f4621, 0x21fe3a6cb892537d, 0xe5142f9dc48562e9, 0xc816534fe38a9157, 0x4ec31d2fe16a8fb3,
+    0x23ae7b85427dae31, 0x92fad1743f51bc8d, 0x493d78654c53dbf9, 0xc3674f898c45fb67, 0xf3ea21798b691ad3,
+    0x53ef297dc97d3a51, 0x6328ce4dc65f37ad, 0x7cf98be1f583672b, 0xae19537213648597, 0xc3489f75426895f3,
+    0x2a5ce469826cb471, 0x2f1a56476f4ea2cd, 0x5fe73dba9d62e14b, 0x6c3df12a9b43efa7, 0x1a63fc5edb682f15,
+    0xbd985ae1f95a3e81, 0xd15f8a42174a3bed, 0xa4f12573273f4c5b, 0x76debc5985426ac7, 0x592b67acb2469a35,
+    0xe492568dc247b8a1, 0x1762fbda9e3ab71f, 0x3198ecabac2ed57b, 0x671d5c4edb31f4e7, 0xabd752c32d371465,
+    0x41a56e376b5834c1, 0x7152bc98794a523f, 0xe7abc689873d519b, 0x2c687d4a942d5ef7, 0x83ae2f9dc4329e75,
+    0x4a295d1fe2359cd1, 0xb4c9163ede17ab4f, 0x1a5728e32f18d9ab, 0x69fce7d54c1dea29, 0xfcebd5187d321a95,
+    0x6125deca9b2538f1, 0x2fe7451cba18376f, 0x8fc6219dc71945db, 0x89ab561fe61d7549, 0xe57b946fe41f83b5,
+    0xda164fc76715b423, 0x416a8b376325b18f, 0xdeba62843cd5afeb, 0x17a8eb254bf8de59, 0x35b9cf6768eafdc5,
+    0x723865cba9ef1d43, 0x72bc96adc7e23b9f, 0x43918cbfe7f65a1d, 0xbc5d9f7214f85a79, 0x6195cbe323fb78e5,
+    0x54b23e1652fea863, 0xebd7465872e1a5bf, 0x34b628798fe4c53d, 0xce251a798cd6e3a9, 0x7e69f34dcbdaf317,
+    0x6b29fdc1faed1283, 0x7d1a28c328be31df, 0xd3fe579438c25f4d, 0x6facd97436d45eb9, 0x3b51da8764e98d27,
+    0x6139eb7872eb8c93, 0xb32cf95871bc89ef, 0xf357e68bafb1c96d, 0x8379d5b1fcb3e7d9, 0xfa7de4821dc6f847,
+    0x1d298fa54cda17b3, 0xf9ebc3876acd4731, 0x9413dfe767bf348d, 0x569a742ba7c263f9, 0xb9358ecdc4d59267,
+    0x719d584fe4c891d3, 0x7ba14c8fe2cbaf41, 0x9be74d63218cae9d, 0xc48bf9654f92ed1b, 0xc34b19d54da3fc87,
+    0x2ef563976ca71be3, 0xcf3e4b1989ca3b61, 0xe65d48cba69c38bd, 0xb5234f8ed6af583b, 0x37b5eca1f4c286a7,
+    0x6b7a9c2324c6a715, 0xfbc2d3a543c9b581, 0x293cb8e65189a3ed, 0xe91cb6876f8ed25b, 0x46d821398d92f1c7,
+    0x356b974dcdb72135, 0x2ba5dc8edba73f91, 0x7d38c52fe6783cfd, 0x3ef4cb92178c4d6b, 0x612b47d3248f5bd7,
+    0xef471cd876a29b45, 0xd15a47f87385a9b1, 0x51ca4e9ba197b82f, 0x8b7294ca9f5ad68b, 0xc64157fbab6cd5f7,
+    0x7a42cde1fda21675, 0xd57692e32c9635d1, 0xda8769232b98534f, 0x32ad7915487952ab, 0x385df46ba68d7129,
+    0xac345deba36e7f85, 0x627fa83cb4739de1, 0x4b16c98ed174ac5f, 0x3681ca5fef46dacb, 0xc1b7f3621f5aeb39,
+    0x7c2b81f32c4df9a5, 0xaf36d1587d824a13, 0x9b52c7fa9b64387f, 0x34ad261ba95746eb, 0x9b54c8fed84b7659,
+    0xd893b6efe36d84c5, 0xd1724befe27fa543, 0xafb13de21463b29f, 0x5e1b29f65376c21d, 0x31a4f8e54e37df69,
+    0xe1593c676b39fed5, 0x7f8465ca9b6d1e53, 0xfd81456cb9513caf, 0x927ca1efe9645b2d, 0x9834adc1f7365b89,
+    0xb4f5c382163a79f5, 0xd1e4f5c3254da973, 0xf891a746523e96cf, 0xb243efca9152c64d, 0xac4e25198f25e4b9,
+    0x875d926cbd39f427, 0x1a2873efed5c1493, 0x1c67948ed94c32ef, 0x6351e7f43b42516d, 0x9db4a1c548235fc9,
+    0xf4379ba659268e37, 0xb794f1e875298da3, 0x1f34628a954dac21, 0x146e2dca912fba7d, 0xf27a9e8cbf12d8e9,
+    0xe1b6524fed14f957, 0xd6bea3254e2918c3, 0xef5db2c76d2c3841, 0x5c194a676a1e359d, 0xdb6f475a9a32751b,
+    0xb192fc4dca149387, 0x946f1c7dc61792e3, 0x78e9124fe53ab261, 0x84eb235fe21b9fad, 0x36928bc5431fce2b,
+    0xead5f1943ce1fd97, 0xa4b6edf76be51cf3, 0xc91623e76bf83c71, 0xc961da2767f839cd, 0xe9568d7ba7fd594b,
+    0x1e93cf4dc4ef58b7, 0x35cb6eafe6f3a825, 0xe2f456c324f5b691, 0x87f62ba432e7a4fd, 0x8d9f1ca651fad36b,
+    0x32d74ce65fbce2d7, 0x8ed6427bade31245, 0x38964e5bace642b1, 0x83d5a2fcb9c74e1f, 0xeb9d5261f6d94e7b,
+    0xe81f945216db5ce7, 0xcf1e78d324df8c65, 0x219bd3e765e39ac1, 0x5c46d3f872d5b93f, 0xd631eb5981e6d79b,
+    0xb41c6d798fcbe719, 0xc436e15bacbdf685, 0x23fa8b61fbc236e1, 0xf6ebc3521bc6345f, 0x7e5b6a4329d753cb,
+    0x3f2195e658db7239, 0x357e9f4876cd81a5, 0x3527ed4874ad8ef1, 0xe26bf43a93b2ad6f, 0xb2ed517fe194acdb,
+    0x964ab38edfa7ec49, 0xf85aec121e89fab5, 0xe782c5465dae1b23, 0x7b8ad5f65cb1398f, 0x32b56cf769a347fb,
+    0xd16fe24cbac85769, 0x48c265fdc4ba86d5, 0x482cb7dfe4bda653, 0xfb7a165ed28e93af, 0x143e5ac215a4c32d,
+    0x7db8493542b5e189, 0xa216e7343c87dfe5, 0x7fade1487d9b1f63, 0x8cd94bf7697c2dbf, 0xf8d3ae9cba915c3d,
+    0xae913d4fe7835ca9, 0xc8f5be31f5a68b17, 0xfe938472157b9a83, 0x159ac2d3236b97df, 0x1ce98ab5428fb75d,
+    0x365149e87182e5c9, 0x9f1a76cbae96f537, 0xb6c3e95dce8915a3, 0xea91852fed9c4521, 0x5ef8a971fa8e427d,
+    0x76d95a343b8261e9, 0x14d7a8c32a938f47, 0xe823461545768eb3, 0x27fcdeb98579ad31, 0x15bedac8725cab8d,
+    0x532befc9815ecaf9, 0xc56b74fdce52fa67, 0xe3a82fd1fe7619d3, 0xcb547a232e7a3951, 0xa7894ed32c5b36ad,
+    0x64f9e7b54a7e562b, 0x24de371bab618497, 0x8e716afcb87594f3, 0xc158a7fed568b371, 0x975c2b4fe358a1cd,
+    0x8eb562dfe15acf3b, 0xcb86df13214fdea7, 0x34c9de676f742e15, 0x69a543e87e563d81, 0xde468a576b473aed,
+    0x6a421ed9893c4a5b, 0xb459a73cb83e59c7, 0x5e3981dfe861a935, 0x63a78c91f654b7a1, 0x4f7d2a632547b61f,
+    0x17c4d2965239d47b, 0x62e9b5a7614bd3e7, 0x63aec4198d3ef265, 0x93c12fdbae6543c1, 0x58e7126cbc47513f,
+    0xf359d2beda274f8b, 0xdac9be5fe82a5df7, 0xf7d4e1a2192e8d75, 0x1495fb2657429bd1, 0xb762a4e87623ba4f,
+    0x716ebf487325d8ab, 0x78561eacb13ae829, 0x45789e1bae1cf795, 0x59fa1d8cbc3e27f1, 0xb5ae692fec12356f,
+    0x4c289ab32c1654db, 0x2dbeaf365c1a7349, 0x3ef85cb7691c82b5, 0x4591e86a984ea123, 0x728d1cea9521ae7f,
+    0xfc18db5a9413adeb, 0x872feb3dc216ed59, 0x62c3dafbade7fbc5, 0x26b471d32efb1c43, 0xb35d9a143bed2a9f,
+    0x25c3adb76bf2591d, 0x258469e76bf35879, 0x1fd9654ba9f687e5, 0xc3b826fdc5fba763, 0x721c6f4ba3ec94bf,
+    0x27c5b14dc2efb43d, 0x8f54d9c214f3e2a9, 0xeba581d653e6f217, 0x2ab8d1476fea2183, 0x5a349db65ab92ecf,
+    0x6bc743e879bc3e4d, 0x59f1328ba8e15db9, 0x4835fdced9e48c27, 0xf47528b1f5e68b93, 0x67149ad214c798ef,
+    0xfe15927323ecb86d, 0xc6b8a9e542bfc6d9, 0x16ed243a91d2f647, 0xc72b6d1a9fd716b3, 0x8fb25d3cbeda4631,
+    0x1a7e49bfeacb438d, 0x258a364fe8bd52f9, 0x896bd5f43bd29167, 0x514bd8a327b48fc3, 0x1248a5b656c7ae41,
+    0x1a2b395653b7ac9d, 0xcfad4568739adc1b, 0x2b5f318a91afeb87, 0x6a9b13edcfb41ae3, 0x5b7ea981fec73a61,
+    0x1a9d35c21ea837bd, 0x4a1d8ce32dac573b, 0x67fa3c8439be65a7, 0x7ea3641989c2a615, 0x8ed2146ba7c5b481,
+    0x1396a8fcb496a2ed, 0x165c3ebfe3a9d15b, 0x8b3a725fe18adfb7, 0x9ec2af34319dfe25, 0xb13ed8765fa43e91,
+    0xb4fa97e54c853bfd, 0xfbae35d65d984c6b, 0x35cbd1f7698b5ad7, 0x4eb8f96dc79e8a45, 0x451da68fe692a8b1,
+    0x9e315c4fe594b72f, 0x53a7f6e21396d58b, 0xdc7ef5343289d4f7, 0xce8b9a57619cf375, 0x1c3dbf587e8f24d1,
+    0x7e8f921bad93524f, 0x4821a76dcd8651ab, 0xa39db84edb786f19, 0x48a3ed91f96b7e85, 0xcfbd2193276d8ce1,
+    0xd35abc643671ab5f, 0x8c2b5f165463d9cb, 0x47b6a8398276ea39, 0x3274b6dcb169f8a5, 0xe1a376bcbf7d2913,
+    0x6d1795bcbc5e267f, 0xdfa38c61fc7245eb, 0xfe5ba6821d867459, 0xdef45a732b6983c5, 0xda9ce387697ca243,
+    0x413b5f98765da19f, 0xf7b243d98451aefb, 0xe81b465cb253de69, 0xe9d6a12cb146fcd5, 0xa675324fef6a1d53,
+    0x41d3fb521e4c2baf, 0xfb5193a43c5f4a2d, 0xe568b1276d425a89, 0x17db62fa9b3478f5, 0x5f2e184dcb49a873,
+    0x54f976ecb63a95cf, 0xa379f5cdc63eb54d, 0x5786ae21f451e3b9, 0xe419c7a21465f327, 0xb13ac25874681293,
+    0x46c3f2976d4931ef, 0x26bcaf587c2b3f5d, 0xd7e59ca87a2f4ec9, 0xfe4b962dcb428d37, 0xd69245afe9258ca3,
+    0xbc589a21f748ab21, 0x65b1df82152ab97d, 0x68cfb394342dc7e9, 0x719f8b2a9431f857, 0x8962defba24517c3,
+    0xa34d8becbf293741, 0x4d8e36acbe1a349d, 0x65872ecfec2d641b, 0xae83d9bfeb1f6287, 0x435fde165b2491e3,
+    0x1d36e7454926af51, 0x36ec284545169ead, 0xd93fc5187519cd2b, 0xbcefa489831dec97, 0x2b68ac5dc5421bf3,
+    0x269bacedcef43b71, 0x38bdea4febf538cd, 0x8f65a4c21df9584b, 0x4f75ac832afc56b7, 0xbe4c8af54afe9725,
+    0xbfdea43878f2b591, 0xf73ab68986e4a3fd, 0x794a28cba4f7d26b, 0x8d54932cb3f9e1d7, 0x456137cdc1dbef35,
+    0xf13a9db543de2fa1, 0x9b128fe65ec34d1f, 0xeba16c543ce54d7b, 0xb49fdca54ad85be7, 0x1dc3a29879ec8b65,
+    0x7d519ceba6de89c1, 0x8437acbdc6d1b83f, 0xb92c5de1f4e3d69b, 0xb9681f5324d7e619, 0x8b796df432daf485,
+    0xeb9a215873dc25e1, 0xd52eb7f87dbe235f, 0x6d14acf98ed352cb, 0x397de5acbcd67139, 0xb21d6a8edac87f95,
+    0xa8d2935fe6ba8df1, 0xeb31f68215ad9c6f, 0x9a2b7e643591cadb, 0xd59321b765c3eb49, 0x3f24679872c6f9b5,
+    0xbfec562a94db1a23, 0xd813642a9eac278f, 0x3fda785bac9e36fb, 0x52bafd71fdc27569, 0x8abd7fe21cb684d5,
+    0xbdf962132bc9a453, 0xeaf36b15468b92af, 0x23d764f8769eb12d, 0x51dec83984a1df79, 0x6a89573ba293fde5,
+    0xd2fb14ced2b81e63, 0x918ac72ede782cbf, 0x419d63b21f8c4b3d, 0x98fb15432d7f4ba9, 0x4d15abc65db38a17,
+    0x3dc281e76cb5a983, 0x17e29c5ba58796df, 0xa8e7246dc48ab65d, 0xbe3129dcb37ed4c9, 0x8de2b39fe5a1f437,
+    0x62c1a7d325b614a3, 0xb47f962873b95421, 0x4e21daf65f8a417d, 0xa42c53f65c6b4fd9, 0x1f5be94a9b8f6e47,
+    0x15abe73dca728db3, 0x34a9c7dfe986ac31, 0x93ad6451f456ba8d, 0xf13e94c2145ac8f9, 0x85fae193235de967,
+    0xc1f94758759218d3, 0x6b392dacb2a63851, 0xf2574e9a9f6735ad, 0xaceb685dce7a652b, 0xc19b3a4fec5d6397,
+    0x57ad12ceda6e82f3, 0xd19cf2543c84b271, 0x5b21c7f327549fbd, 0x8adf32754657ce3b, 0x6e93a2476349eda7,
+    0x398b27da936dfc15, 0x51a268ded4723c81, 0x7b83ad2cbf5439ed, 0x6fb25d41fe37495b, 0xd8e135b21e3a58c7,
+    0x47b9f6a32c4d9835, 0xdbfc19465b4f96a1, 0x817bfda98963b51f, 0x4ef853aba845d37b, 0x581bd4ecb548d2e7,
+    0x396ca21ed34bf165, 0xd697c841f46e32c1, 0x95be37c653614e2f, 0xce94f8b65f234e8b, 0x69b2de154d265cf7,
+    0x2318cef76d2a8c75, 0x96c214e8793c8ad1, 0xd651e4fcb72ea94f, 0xd8a7915fe632d7ab, 0x62d8eac1f635e729,
+    0xf9867de21428f695, 0x6c75fd38754b26f1, 0x5862f3d9813d246f, 0x2fcd65b98f2153db, 0x6fb4e2acbe157249,
+    0xcb1e372dcd2781b5, 0xd3a5f78edb2a9f13, 0xec45793fe61b9d7f, 0xae4dc7b3261f9ceb, 0xc47ea2d54712ec59,
+    0xc14bf2587614fac5, 0x1ac6ed8ba6291b43, 0xc87d1e6ba31b289f, 0x829c56fa9efc481d, 0x194b2e7cbcef4679,
+    0xcd51968edbf286e5, 0xbc5e7fd21cf7a563, 0x675fa8e328e793bf, 0x42157bc657fab23d, 0x2a639e4765fed1a9,
+    0x274f31a984c1def5, 0xa2579b3cb4e51f73, 0x8a3e26fba1e62dcf, 0x5f4d92acbfe93c4d, 0x743ce8921fed4cb9,
+    0xb67ed2143cdf6b27, 0x5931a4e65ce28a93, 0xf892cab658c497ef, 0x4d5cb32a95e8b76d, 0x6a1e2c4984eac5d9,
+    0x3289e17cb3cde547, 0x8dac7231f6e215b3, 0xfb921e6326e74531, 0xda7b5ce651e7428d, 0x4df6bc354eca51f9,
+    0x18234be54dbc6f57, 0xbd6f58c769af7ec3, 0x18b9a2ecb9c3ad41, 0xb71643cfe6c4ab9d, 0xe4abc281f5c7da1b,
+    0x7c8fdb4214cbea87, 0xb18c6d2324acf8e3, 0xbdea48c985d23961, 0xea5487b981c436bd, 0xc7e9341a9fc8563b,
+    0xbf52946a9ecb64a7, 0x2d84a19fecbd9415, 0xd5eb278fe9bfa381, 0x4a92ed832893a1ed, 0xed94b1a32795cf4b,
+    0x93fc5e643496deb7, 0x7c214be8749afd25, 0x61e2843984ae2d91, 0x853efb6cb2913afd, 0x2f5b849edf934a6b,
+    0xdcba2f41fea659d7, 0xe3d97cf21eab8945, 0x69d27a343c8d97b1, 0x6db91cf5498ea62f, 0x8a6def976792d48b,
+    0x8176c35ba695d3f7, 0xf2ec935dc4a9f275, 0xb431852fe59b23d1, 0x8b1a9ecfe29d314f, 0xbe97cd5432814f9b,
+    0x67cbe9143f846e19, 0x63bcd1e43e967d85, 0x985a3cf65c698be1, 0xc76a52d8786c9a5f, 0xb379f68a965fa8cb,
+    0x69458fbed672e839, 0x968e14afe384f7a5, 0x92a6c315469a2813, 0x4ce2bd75438b257f, 0x4ba9dc87617d34eb,
+    0x3f61a28baf817359, 0x379c418bae7482c5, 0x3ba7268dcd78a143, 0xe3716b8dca479e8f, 0x437e5bafe64a9dfb,
+    0x58e76a32174fcd69, 0x7ca3f6b43762fbd5, 0x83bde67a96871c53, 0x12d6f839835729af, 0x1395aedba16b492d,
+    0xae16d73cbf3e4789, 0x7c245e6dcd4187f5, 0xcb9fa2d1fd54a673, 0xeb795ac21b3694cf, 0x15bed6c32a59b34d,
+    0xebc98a36574cd2b9, 0x7eb4c85a985fe127, 0x957af62dc8752193, 0x6134d9eba3452edf, 0x931526adc1483e5d,
+    0x9d62e73fef2a4dc9, 0xdf47c8121f2e6c37, 0xa14d89565e418ba3, 0xb6329df87d45ba21, 0x96afd8176a25b87d,
+    0x91da7c6ba728c6e9, 0x5a8916dcb82ce657, 0x123fab9cb62ef5c3, 0x38f2e6a1f8753641, 0x1c5dbae21526439d,
+    0x231c57f87249631b, 0x275843965f2c6187, 0x4c1832a76b1c7fd3, 0xc182654a9c32ae51, 0x6d5e1bfcb8139cad,
+    0xa4e92c3fe816dc2b, 0x7ef9ad21f518eb97, 0xcedf2153261be9f3, 0x45fc38a6563f2a71, 0xa2e8fd59851237cd,
+    0xf719d6eba216574b, 0x9fd8346a9ef865b7, 0xc73ed25badfb9625, 0x7b82f41dcbfda491, 0xe924576cb7ce92fd,
+    0xba7c892329f3d16b, 0xaedf569326e4dfc7, 0x217bade546d8fe35, 0x59d2761875fb2ea1, 0xc6a1ef5984ed3c1f,
+    0xda52c36ba2f14c7b, 0xfa26751cbfd35ae7, 0xe7d8a541fde78a65, 0x6c98e7b32dea98c1, 0x7a6d4b5329dca73f,
+    0xc76f328437dfc59b, 0x3594bce878d3e519, 0xf82639dba7d6f385, 0x26d4175cb6d924e1, 0x5eb74a6dc4db325f,
+    0x39f7bda1f2de41cb, 0xed4fb72543d16f29, 0x6841b7e32fc37e95, 0x8913bfa54db68cf1, 0x1b963ad54ac89b6f,
+    0xb5d2c8f6568ca9db, 0xad675f8986bfda49, 0x5d9c32aed6c2f8b5, 0x483da7c1f6d71923, 0x49fbed6214c9268f,
+    0xd4b8ac9542ca35fb, 0xb35f7ae871ce5469, 0x2ba9ec587fb183d5, 0x45c3fd7a9ec6a253, 0xd35cb6198cb691af,
+    0x197f6c4dc798af1d, 0x726cf841f58bce79, 0x45ec7f92168fdce5, 0x7cdae23658b41d63, 0x5dbc42a764952abf,
+    0x431badf872b84a3d, 0xdea415f871bc48a9, 0xe4b5a87cbfae6917, 0x74f1892edeb1a783, 0x85392dbfeb8395df,
+    0xd543e6c21c97b45d, 0xb6e71f832a78d3c9, 0x5fa78b26589ce237, 0x3f7c5ed8768ef1a3, 0x58914f7dc8b65321,
+    0xbf4e325cb2953f6d, 0x3f7cb48dc1874ed9, 0x9bda2cefef8b6d47, 0x1845be621f6e7cb3, 0x38d4a2e65e82ab31,
+    0xac3deb154c63b98d, 0x493d2ac54a65c7f9, 0x1d5f37acb95ae867, 0xe32d57fba57bf6d3, 0x36a7152ed69f2751,
+    0xb9c56d81f58234ad, 0x18934e721397642b, 0x3c296eb5418a6297, 0x47213c865e6b81f3, 0xfead31287c5d9f61,
+    0x72a65be87a519ebd, 0x2da1e75ba964cd3b, 0xf89b32ced845eca7, 0xb4675d1fe769fb15, 0x8ea95134376d2b81,
+    0xe62f83d4345f28ed, 0x765b89ea9372485b, 0x2fa7e54ba18456c7, 0x1542ad9cbf4a9735, 0x534e6a1cbe4c95a1,
+    0xa39c467dcb5da41f, 0x429fb7d1fa51d27b, 0x6be21cf32a54d1e7, 0x81a795432937ef45, 0x58ea92b767592fb1,
+    0x436b7a59865b3d2f, 0x7e9cd41a924f3d8b, 0x28f53ebdc1425bf7, 0xdb28fc4edf248b75, 0xc5a6e371fe3789d1,
+    0x4e51c8621d2ba84f, 0x153e9624392ec6ab, 0xbad16cf87b41e629, 0xd7af4ce98a23f495, 0x7a2fb5dcb94825f1,
+    0xb47a8efdc74a236f, 0x728ec39fe53c42db, 0x92c63b5fe23f6149, 0x6bae731541327fa5, 0xc31e4db65f269e13,
+    0x47dcb8654d169c7f, 0xa59fc4265c189aeb, 0xad429b78781edb59, 0xe1d4958cb821f9c5, 0xa3db25cfe9261a43,
+    0xcd762e4fe516279f, 0xcb186234362a471d, 0x5b29ca17631d4579, 0x7a532619821f74e5, 0xfad34b198ef1a463,
+    0x61c425d87ce492bf, 0x96df845a9af7b13d, 0x4921bf7cb6e7cf89, 0xd1657e8cb6eacdf5, 0x37c418a216cefd73,
+    0x39c182e546e32bcf, 0x2acebf1875f63b4d, 0x9fbd12e762f74ab9, 0x8f42673a91fc6a27, 0xacd53f8bafde7893,
+    0x51846c9babc196ef, 0x75d2e381fae3b56d, 0x4e37c5821ae6c4d9, 0xc79a865329dae347, 0xd8e7215657dcf2b3,
+    0x347b1c2a98df2431, 0x28d13acba6e3418d, 0x964e1dfba2c54fe9, 0xa3f7851dc1d96e57, 0x68c32d7fefba7dc3,
+    0xab6d7f432fbe9c41, 0xda6b37843ec1ba9d, 0xbcda79865ac4d91b, 0xdb2983c54ac5e987, 0x3e5a8b4986b9f7e3,
+    0x34125eacb7cd2861, 0xce1f869dc4af25bd, 0xfd9ce281f4d2653b, 0xdc5397f212d563a7, 0xd62a148762da9315,
+    0xdc431a565fbca281, 0xef47b8354a7b8fcd, 0xf37e9a187a91ce4b, 0xc93781fba893edb7, 0x936cdb7ed8a7fc25,
+    0x59a27ef1f6ba2c91, 0xc8f9eb42158b29fd, 0xca275ef324af396b, 0x916d238763b258d7, 0x7d6934eba1c69845,
+    0xe764ac187fa896b1, 0xc1e5d78a9d8ba52f, 0x79cd623eda7ec38b, 0xe73bd95fea91d2f7, 0x27f1dc632ba4f175,
+    0xec329f7659a832d1, 0x9d1f2e5656892e3f, 0xbd8fa217647c3e9b, 0x6d9cf7aba38f5d19, 0x7ac651fed1a27c85,
+    0x9137a82dcf758ae1, 0xcdab853fed67a95f, 0xf3d4ec821e59a7cb, 0x19fa75832b6ed739, 0x794c32b54b81f6a5,
+    0x5d8673ba9ba62713, 0xb36842dcb698247f, 0x5e672b4dc57943eb, 0x12cd53bfe38d6259, 0x4c79615fe28f71c5,
+    0xb514cde651849f23, 0x54dbe9632e549d8f, 0xdebf63543d469cfb, 0x185dec765b4adc69, 0x5f3491e8784cead5,
+    0x82d3964eda821b53, 0x5cb6478ed76428af, 0x4bf839a1f567482d, 0xfc4ed8a2135b4689, 0xe57c8264324c76f5,
+    0xe48bd379816f9573, 0x5c2639a87e5293cf, 0x1decb32a9e56b24d, 0x4123d78bac47d1b9, 0x6428fbcdc94adf17,
+    0x43f29d6ed74cfe83, 0x27d9a5c438512cdf, 0x2f5c17d328643c5d, 0x5ad4f6c875364bc9, 0x7c5316fa924a6b37,
+    0xaf6b93dcb14d79a3, 0xb8126edcbe4fa921, 0x1c54f37dce32b67d, 0xab4c5691fb24c5e9, 0x63b8c4521c29e457,
+    0x9d3724e6592af4c3, 0x3ec481a98a6e2541, 0x5e61792ba851429d, 0xfeba78cdc845621b, 0x82c7fa6dc3285f67,
+    0x7f685b2dc1297ed3, 0xea4132dfef2c9d51, 0xf914b5832e1f8bad, 0xa9d534165e13da2b, 0xdc983eb65c14ea97,
+    0x5d4e13c76a17e8f3, 0xb39e471cba3c2971, 0x4d6571fba71e26cd, 0xd34e687fe821564b, 0x89bfa761f51364b7,
+    0xc127af3436189425, 0xa9b63dc7642ba391, 0xc186a2e54cea91fd, 0xc38167a549edaf5b, 0x56ba12e769f1dec7,
+    0xe6174a2ba9e4fd35, 0xfab4e27dc8f72da1, 0x2b3716aed6e93b1f, 0x8b537f1215fd3a7b, 0x64f8bde323df49e7,
+    0xf6d41c7873f28965, 0xad3ce1b982f597c1, 0x5cf724987ed8a63f, 0x6d73e5487deac49b, 0x9834b6fcbaced419,
+    0x597ca8efead1f285, 0xc29487e54ad623e1, 0x21af97d549d8315f, 0x6a2e87d545d83fab, 0x42f1ba7874dc5e29,
+    0x682ba5f982cf6d95, 0xd5f1649ba2d38bf1, 0xa854eb7cbec49a6f, 0xe6fb7dc1fec6a8db, 0xd918fba21ecbd849,
+    0x91274bc329ade7b5, 0xba1f54987bd41823, 0x49eba53879c4258f, 0xec435f6a96c734fb, 0x9f42ac8dc4db5369,
+    0x3d8ecb5fe3bc72d5, 0x9765e8dfe2cf9153, 0xd953c17431b28e9f, 0xbf5869743f95ae1d, 0x7196a5b43ea6cd79,
+    0x4918fb354a89dbe5, 0x6f397518789dfb63, 0xb698e4cdc7a129bf, 0xc739162fe7b5493d, 0x9e6c7421f3c647a9,
+    0xf28e746324cb6817, 0xb93dec6542bd9683, 0xc42ef836519e84df, 0x43597e187f92b35d, 0x4dc965787e85d2c9,
+    0x5d68f3bcbca9e137, 0x48b653adc87aef93, 0x21435a8dc67b1def, 0xda9bec4328913e6d, 0xe5ac289326834cd9,
+    0xbdc194a653a86c47, 0xa894136762897ab3, 0xb2de6a1cb28d9a31, 0x7142dfca9e5fa78d, 0x3a2e857cbd72c6f9,
+    0xc3467ea1fc94e567, 0x8e791fa21b78f5d3, 0xe81c72354b9c2651, 0x4d317eb6587e23ad, 0xe28f451ba891632b,
+    0xa94138fdc5a46197, 0xd13e9bfcb2867fe3, 0xc1459d3ed27a9e61, 0xa74bc15fef4a8cbd, 0x15f84b721e5fac3b,
+    0x7fd9ec343d52eba7, 0x8762ef354c76fa15, 0xbf463ae87c692a81, 0x7943ce6a985a27ed, 0xca63e9fdc86e375b,
+    0xd5a3914fe48165c7, 0xbd846971f2849635, 0xb2f48e73236794a1, 0x8a3fce965269a31f, 0xbd4527e65f4dc17b,
+    0xbf52dae65a3ebfd7, 0x37fc5dba9b62fe45, 0x24f7386dca562eb1, 0x1b3adcfed9583c2f, 0x7589bed1f64a3c8b,
+    0xca1d75f2163d4af7, 0xdc71b82436418a75, 0x425b3dc8735498d1, 0x5de2739a9136a74f, 0x56da12787f28c5ab,
+    0x18edc49bae3cd529, 0x7f96ab5dcb2fe395, 0x845a172feb6524f1, 0xdac19f421b47326f, 0x3dac2bf6593841db,
+    0x1c3845d7672b5f39, 0xc8f51a79842d6ea5, 0xb5783aecb6529d13, 0xb645a8edc1239b7f, 0xe7fb394dcf15a9eb,
+    0xa5346bc1fe18da59, 0xf6d1e2532d1be8c5, 0x1d2fc7a65b1ef843, 0xe2954c787b13269f, 0xd189ec5a9a27461d,
+    0x5a3842bdc81a5479, 0x4cb5e73dc61b73e5, 0x9c8b71aed51e9263, 0xdc29481fe43291bf, 0xa523b7465314af2d,
+    0xa841de232df4ce89, 0xd3bf18943ae7dcf5, 0xcabf543659eafc73, 0x95841f2767ed1acf, 0x8bda317cb8f13a4d,
+    0xba3f8c6ed6f348b9, 0xbd4a217fe4f86927, 0xb86da7c214fb8793, 0xcd9238e432db85ef, 0x8b3e1d9651efa46d,
+    0x1cfb26976fe2c3d9, 0xe3c59b8a9cd6e247, 0x2631bdfa9ad8f1b3, 0x943ba2fedaec4231, 0xbc61349fe6bc2f7d,
+    0xdfb28ea327c14de9, 0xbf7d18a328e36d57, 0x21d3895654e67bc3, 0xc4ef375873ea9b41, 0x6ca2ef9761eca89d,
+    0xe64f75187eafc81b, 0xb783ef4cbdc2e687, 0x826bf14edab5f6e3, 0x6d7ac3943cda2761, 0xe2c3571438ca24bd,
+    0x8ad3c46768ce543b, 0xd318546a98d162a7, 0xbe8a49dcb7d69215, 0x168347acb3c69f71, 0x83e95fbcb1a78ecd,
+    0x14c7eadfef8cad4b, 0x345cbe821e8fdcb7, 0x7dc9a1f54da3fb25, 0x239edaf65dc62b91, 0x1ade5c4659a728fd,
+    0xcf87512a97ac386b, 0xe479a5bcb5ae46d7, 0xa76e312fe6c19745, 0xd5234971f3c495b1, 0xe6f5913213b7a42f,
+    0x79ed483541a9c28b, 0x2fb8e4c54e8bc1f7, 0xcefdab454b8edf65, 0xbe1da3f98b942fc1, 0xf57394dcba962d3f,
+    0x61cb2a5fe6873d9b, 0x4c8723d1f68b5c19, 0x46ca1872149e6b85, 0xeb2f4ca545a289e1, 0xedf152b76293a85f,
+    0xcb9f34287185a6cb, 0xd728f1398f7ad639, 0x61bfd38a9d7ce4a5, 0xef96bc2dcb8ef513, 0x64bd729feb94237f,
+    0x8c9b45d21a8642eb, 0x7cb65e343b8a6159, 0xa1d58924347a6fb5, 0x5317c6ba957d8e23, 0x71ce8daba3619c8f,
+    0x719e63bdc1639afb, 0x8ea3479dcf45db69, 0xb9a82731fc48e9d5, 0x15ba87621d6cf953, 0xe1b39cf43b5e17af,
+    0xba892c576b83472d, 0x4de398fbab764589, 0xf3524bdcb86974f5, 0x1a467dbed56c9473, 0xe4f3627cb35d82cf,
+    0xcba29751f372b14d, 0xb5dfc7432153cfa9, 0x78ef2bd43f46de17, 0x853e9a265c49fd83, 0x2c5d4a87694a1bdf,
+    0x3fb1dec9894f2b5d, 0x81b7fd2ed8524ac9, 0xc9d7a15fe9456a37, 0x9e5ca4f1f54978a3, 0x65f1d2e4365ca821,
+    0xd72e9145423ea57d, 0x37d6ce187251c4e9, 0xb7e82d5a9f24e357, 0x138d2c4a9d47f2c3, 0x67f8214dcd6b2341,
+    0x412367afea4c319d, 0x52f91e7dc72d3ef9, 0x84e751921a325e67, 0xc1b79a4548257cd3, 0xdc29f5a876389c51,
+    0xd284ca67632b89ad, 0x2b3e6dc9813ec92b, 0x8e17f54cbf21e897, 0x19d7265cbc14e7f3, 0x7ebda621fd392871,
+    0xa298e1643b1925cd, 0xec2da3b76a1d354b, 0xe4b2d3c7691f53b7, 0x815d2abcba149325, 0x4afbe78dc736a291,
+    0xaf3e17cba3168fed, 0x79842dfed219ae5b, 0xc976248a9efabdc7, 0xcfe46a121bdfec35, 0xf1893c465df42ca1,
+    0x91afc8d65be63a1f, 0xa9387fc65af8397b, 0x4f1dc79a96fb48e7, 0xf5b376acb4fe7865, 0x6c59831ed5f296c1,
+    0x75a9fb3ed2e4a53f, 0xb8f35d4212f6c39b, 0xe2314cd652fad319, 0xed7ba2154fdce185, 0x4793fd8659acefd1,
+    0xa8374d698ac32e4f, 0x7492153a98d53eab, 0x9c34675dc7e85d29, 0x57426d91f4eb6c95, 0x1b85e7d325cd7af1,
+    0xfa12ec6434d1a96f, 0xe79fb1c652e3a7db, 0xa75becd981e6d749, 0x37bd1e687fc9e6b5, 0x2bf8ce9a9dbcf623,
+    0xb57fc4edcabe148f, 0x1ad4b53fe9c243fb, 0xf73d5ac21bd75269, 0xe8f2b1a438c971d5, 0xa4e89bd656cb8f43,
+    0x2cf9e81653ac7d9f, 0x52ed318984b2ac1d, 0x537c4edba1b3dc79, 0x4f23691cbf96dae5, 0xadc6b78fedb9fa63,
+    0xb951a2f32d9c18bf, 0x73b2df654baf283d, 0x754af8d65bc246a9, 0xb5214d3a9ac58617, 0xa28147ecb6ca9583,
+    0xa2e7b58cb49a83df, 0x5c2f9b4dc39ea25d, 0xce6b8751f3a2d1c9, 0xa6729db431a4df27, 0xe7294ad32d86fe93,
+    0x6f73cd954b781cef, 0xc73e24565a8b2c6d, 0x1fd2ab97687f3bd9, 0x6712bd3ed9a26b47, 0x2c36a8bfe6a579b3,
+    0xe2453c91f5b8a931, 0x9564abe2137ba68d, 0xdf5b81e4327db5f9, 0xf532e17982a1e467, 0x736de1f87e85f4d3,
+    0x97ab6d4cbea92451, 0x3e71db9cbc7932ad, 0xdc925a6fea8d512b, 0x13bf89aed96e4f87, 0x71c3e94219827de3,
+    0x862bcf3437859d61, 0x9f7dce2543568abd, 0xa1f4d7287269ca3b, 0x2dfca689815ed9a7, 0x61a9785cbe72f915,
+    0x165b9d4ede752981, 0x7c6f2d31fb5726ed, 0x5a48b9621d7a365b, 0xacd986f32a6d54c7, 0x9ec4b5d76a7f8435,
+    0xd84a352cb87493a1, 0x12f9436cb576a21f, 0xf82b579dc247af6b, 0xa624c79dc149bed7, 0x37f4e95cbf3ced45,
+    0xdf329cb54f632db1, 0xd4c7a1e54d653b2f, 0xb2d873965d463a8b, 0xea9f4b176b3a49f7, 0xfb5a948cba3d6975,
+    0x1758a93cb64f87d1, 0x345bcf8ed752a64f, 0xb9fd5841f235c4ab, 0x1945e3621358d429, 0xfd34eb67614be295,
+    0xab418fc76d4ce2f1, 0x3124e67a9d52316f, 0x43eba7f98a243fcb, 0x4a7c18bdcb275e39, 0xbc1da87fe8296da5,
+    0xc4ab8951f74d8c13, 0x746bde52152e8a7f, 0xad7c8b954532a8eb, 0x7c42d9687324d859, 0x8b41f67a9128e7c5,
+    0x43ec61da9e1bf743, 0x28f7ac3bac2d159f, 0x1ac5673fec32451d, 0x875d6a31fc145379, 0x1bfa7e943b1872e5,
+    0x7b8c1f465a2b9163, 0xc3e76ab5451b7eaf, 0xf2936e58751f9e2d, 0x812fd6eba412cd89, 0x89ae7f4ba214dbf5,
+    0x2c867a5bade6fb73, 0xbc7356fedbe819cf, 0xa149c5b21bfc294d, 0x54db2e132aef37b9, 0xbea1f7265bf36827,
+    0xace5dbf87af58693, 0x1ce3592a95d784ef, 0x987ced5a94fba36d, 0x6f7a52dba3feb2d9, 0x5b8fa97ed3f2e147,
+    0xd1e9a7c321d4efa3, 0x4acb18565ed83f21, 0x742b9f854bc92e7d, 0xa49fc17658db3ce9, 0xb837d24989df4c57,
+    0xdb8a195cb8e27ac3, 0x58c16fbed7e69a41, 0x427ba6d1f3e6a79d, 0xcdb9fa4324eac71b, 0xf876ec3432ced587,
+    0x3fed6a4872c1f5e3, 0xc4e81b2a9fd72561, 0x86b15fc98ec723bd, 0x89476b1a9cda523b, 0x7d1ce56fe9cd51a7,
+    0x5c9f2a3dc7ad6ef3, 0x94fcbd2328c39e71, 0x5eb9871325a48bcd, 0xc875941653d7ac4b, 0x45713b8652c9dab7,
+    0xdf2e473981bdea25, 0xa8ef57dcbfc32a91, 0x692481acbca427fd, 0x563bda41fdc8376b, 0x31e79cf21cba45d7,
+    0x6c2f57d32abd8645, 0x153fbde657af84b1, 0x731bafe987b4a32f, 0x567e249a94a5c18b, 0x72cad83ba296bfe7,
+    0x93fea85dc19ade65, 0x932c4e5bae7bfdc1, 0xf17ac9354e912c3f, 0x8ceda6732e843c9b, 0xfe4938b54da75b19,
+    0x2ae736f54c9b6a85, 0x9751ad4ba69c78e1, 0xef2975dcb48e975f, 0x37ad2e5fe482a5cb, 0x29d45ab1f2a6d539,
+    0x84ae15721298e3a5, 0x85ed6417629bf413, 0xf25ea7c65e8d127f, 0xcfa71de87d8241eb, 0xad61847bac835f49,
+    0xb4f2568dca876eb5, 0xba892d3fe97a8d23, 0x497ead5fe45c7b8f, 0x3f457192145e89fb, 0xa87fecb43472da69,
+    0x62d415a76274e8d5, 0xcd43718ba179f853, 0x6437b2c98e5b16af, 0x31e28f9bac7e362d, 0xe58a31dfed715489,
+    0xb348ea7feb8473f5, 0xfa493dc21c689273, 0xe532df84375981cf, 0xbc932685465b9f3d, 0x4a8e5b37634fbea9,
+    0xd37c82aba463ed17, 0x3d7165ecb165fc83, 0xf87264dcbe471adf, 0x7b6e59c1fe4b2a5d, 0xc597b3a21d4e38c9,
+    0x718baed54d516937, 0xfce298d76c5487a3, 0x3bdfe54a9b58a721, 0x8a6d9f3cb639a47d, 0x5cf2e86ba54cb3e9,
+    0xf96b1c4dc34fd257, 0x23e5976fe264f1c3, 0xa6493cd765783241, 0x1e3a4c754e372f8d, 0x24b518365c2a3df9,
+    0xe418c6798b2e4d67, 0xe31d427a9a417bd3, 0x54f1a6beda349b51, 0x3e2a69bfe62598ad, 0x6e5ac231f539c82b,
+    0x169d83b2142cd697, 0xd79e8326542ed6f3, 0x8937e1fba3542671, 0xb7c461398f1624cd, 0x93e4c58bae19534b,
+    0xfc3586dbad1c52b7, 0x538129dedb3e8125, 0x4357ea2fea329f81, 0xf8529e1327138ced, 0x15f83be43716ad5b,
+    0x31eb25965418dbc7, 0x623a4859841ceb35, 0x82b35ea9832ef9a1, 0x8361ca7bade2391f, 0x438c975dcdf4387b,
+    0x8c7a1f5edbf846e7, 0xeca63b721cfb8765, 0x52c918e439fd85c1, 0x75a12df657de943f, 0x7fe59b4876f3c29b,
+    0x5c7e12fba5f6d219, 0xd8e3c9aba2e8df75, 0xe4c56a8ba2c9fed1, 0x3ac5fd9baebc1d4f, 0x4b2d56e32fe13dab,
+    0x7dab61343de45c29, 0xd5a926743ce76b95, 0xf5c24ae658da79f1, 0xdb31c6f875dc986f, 0x381e742984cf96db,
+    0x1b4ce39dc5e2d649, 0x3f64b271f2d6e4b5, 0x5afb97c214d9f523, 0x947b8f2652db138f, 0xea57b2465ead32fb,
+    0x4682e5f98ed25169, 0xfc8b76598ab36fc5, 0xe746f58cbac78e43, 0x5f8a1dced5b87c9f, 0xf3b459d1f5ac9b1d,
+    0x7fa13db214afcb79, 0xb2cd6ef434b2d9e5, 0xb45319e872c5f963, 0x15aed64762c817bf, 0x857abed98fab273d,
+    0x2c158f398dbe35a9, 0x34b8c9dfedc28517, 0xa2cf9361fbc59483, 0xcde9fa1219a682df, 0xf1e5829437b9a15d,
+    0x27e5dcf4347cafb9, 0x59bef167649fce27, 0x6ba8213984a2fd93, 0x15f4792ba2951bef, 0x74b9ef3dcf982b6d,
+    0x64fdaeb1fe7b3ad9, 0xb14e6df21d9e5a47, 0x78ea3c154da178b3, 0xf3c659a76cb5a831, 0x16a7ed954796a58d,
+    0x91e4c38ba578b4f9, 0xd695a1fcb49cd367, 0x431d65acb48fe2d3, 0xa52bd731f4b62351, 0xd4ac1eb5429631ad,
+    0xd179f8c43e784f1b, 0x6dbefc843d6b4e87, 0x2c78efd65a7d6ce3, 0x64c91e8bab829c61, 0xa7c63e5dc76389bd,
+    0x32e8167fe576c93b, 0xc75d83b1f359d8a7, 0x8b97c2a3247ce815, 0xfc9db845437ef681, 0x2bfeda78718325ed,
+    0xf23c879a9f87345b, 0xfec413dbae6953c7, 0x812796bcbd7c8235, 0xd7b9481edb6e82a1, 0xe7432a8dc7518efd,
+    0x7fd843121853ae6b, 0x4fd2a6932645bcd7, 0x2379bce87369ec45, 0x5f31b748735cfab1, 0x53e297ba936e1a2f,
+    0x7b25a43dcf52398b, 0x3568fb7dcd3548f7, 0xe75468c1fd3a6875, 0xce28f1732c4b86d1, 0x4da6e9f32a3d954f,
+    0x23b86ad76851c3ab, 0x4fde231ba865d329, 0x78635adcb647e195, 0x846de32ba348dfe1, 0x9b7c463dc24b1e5f,
+    0x3678ecfbad3f2ecb, 0x537da4621f425d39, 0xa98fd2e43e246ca5, 0xed9f23b76d498b13, 0x384afcd65a2b897f,
+    0x2e837a59862d97eb, 0x4a13e9cdc831d759, 0x1a637b4ed723e6c5, 0x85763befe528f643, 0x67d54ce3253a149f,
+    0x456e9dc8725c341d, 0xe821da976e1f4279, 0xdcf8e45a9d2371e5, 0x9d184f3bac168f53, 0x827ab3fcb9167daf,
+    0x7c5e8bafe71a9c2d, 0xebc9da51f51ebc89, 0xea79f2143721daf5, 0xa398e4565614fa73, 0xf32b7ae8742618cf,
+    0xe83f7cba931a284d, 0x1c2f4ea87efc36b9, 0x15e2986bacfe5627, 0xb3d1527edcf18593, 0x94e8265dc9d483ef,
+    0x4eafb1d219f7a26d, 0x15e2b96436f8b1d9, 0xb948efa545ebcf37, 0x46f21dc764cfdea3, 0x8ca521dba6f53e21,
+    0x2e48f76ba1f52c7d, 0x6c1432abafd73be9, 0x5a6c9e81fdec4b57, 0x9c3eb5721bde69c3, 0xfe8c47a65ce2a941,
+    0xd9c4e3b548e3a69d, 0x3248e75658e7c61b, 0x8659e47a95ead487, 0xb29176fa95cbd4e3, 0x1fe7d86cb4cef361,
+    0x8ce5f631f1e432bd, 0x8293b4d542e7513b, 0x4d7285632ec84f97, 0x82c316954cba6df3, 0xef2d17965abe8d71,
+    0x15dae92767b18acd, 0xbd56c2fa97d3ca4b, 0x95d6be4fe4c5d9b7, 0x39867fd1f4cae925, 0xe76cb2f324bcf791,
+    0x48a67bd543ae16fd, 0x2bd74fc981d2356b, 0xad2eb6798fb654d7, 0x75e194ca9eca8345, 0xbd1ec84a9dac83b1,
+    0x26f154cdc8ad912f, 0x72c6ea8fe691af7b, 0xd6f79ba21693bde7, 0x8469cbe324a7ed65, 0xfa89b5165498fbc1,
+    0xeb6912f8749c1b3f, 0x451df728718f2a9b, 0xbca28e1dcfb35a19, 0x5978fb6edeb46985, 0xae6f5cb1fca987e1,
+    0xfec1b7a21c8b965f, 0xbe57d213287e94cb, 0x8261a43768a1d439, 0x6257b4a98794e2a5, 0xd2649b1cb6a8f213,
+    0x485263bdc49a217f, 0xef82a76dc17a2fdb, 0xe4596b1dcd7f3e49, 0x76ac1e821f826db5, 0x8b72fa354e968c23,
+    0x691783f43c567a8f, 0x4b2fcd35475a98fb, 0x697ef4aba75ec869, 0xf567badcb681e7d5, 0x1d32947ed694f753,
+    0x9c8d2b7fe38715af, 0x94c7b852148a352d, 0x35b4fed6517d4389, 0x2df86a754d7e62f5, 0xec97486bae849173,
+    0xb21ace898a547ebf, 0x7e526f8cba579e3d, 0x14d9a6cfe648bda9, 0xa7d6e591f65edc17, 0x8475e9132761fb83,
+    0xcad39b84356419df, 0xe52da4698367295d, 0xb2546c89815a37c9, 0xf2576e8baf4d5837, 0x7b2d1e9cbd4f76a3,
+    0x7ba6d89fed74a621, 0xf6bc5981fb45a37d, 0xf8d561e21a47b2e9, 0x8a9bc614394bd157, 0x7d9acfe6564cdfb3,
+    0xe2341dcba8742f31, 0x24a31deba3542e8d, 0xd345e89cb1463cf9, 0x9427ab6edf2a4c67, 0x69a8d251fe2c6ad3,
+    0xaed461732d3f8a51, 0x8efd7bc54c3297ad, 0xb4c59e376a35c72b, 0x94efd5276a28d597, 0x87b29e5a972ad5f3,
+    0x53e9f42cb63df471, 0x19c73befe65123cd, 0x7b648e91f136524b, 0x623fb145423851b7, 0xd96ef1754e2a7f15,
+    0xac53bef65d2c7e81, 0x539d2816591f7bed, 0x41d3ca298912ac5b, 0xeb64839cb814dac7, 0x95fb38ded718ea35,
+    0xd296135fe52bf8a1, 0x2d7f1e35463d281f, 0x65b347298521367b, 0x19d7236a921345e7, 0x7164be8a9ef78465,
+    0xda1c53487df984c1, 0x15ad2bf98aeb923f, 0x194638edc7fea19b, 0x82ca43bdc6d1bef7, 0x483659d218f3de75,
+    0x893275f435e6fcd1, 0x49f26d8765e91c4f, 0x8b3d5ce763fd2cab, 0x682d5b3981ef4b29, 0xbfe417dcbfe26a95,
+    0xadb9823cbcd578f1, 0x18c5d6efebd8976f, 0x8f9537a218ea95db, 0xa12ef48328dec549, 0x583e91c768d1e3b5,
+    0x6d1f728a98d6f423, 0x963ed72ba5d7128f, 0x2c63fe8ba4d931fb, 0xdf897a2cb1dc3f59, 0x9bd481acbdaf4ec5,
+    0xbae7cf121fc28d43, 0xa41f7d632dc47b9f, 0x17f8e3454bc79a1d, 0xfab687e546dbca79, 0x4ec295a876adc8e5,
+    0xbd4f9e1cb7c1f863, 0x35d8b9ced5c416bf, 0xd7953be1f4c8263d, 0xe8764df212db34a9, 0x2dcb138652cd6417,
+    0xd273e4a65ebf7283, 0x24f531a76ca381df, 0x65a27b987ba59f4d, 0x385c216dc786aeb9, 0x17bca32fe69acd27,
+    0x7a3598b1f58dec93, 0x728ef69436921aef, 0xc1ba593435b42a6d, 0x3ebfc8a652b638d9, 0xecb3f85981cb5947,
+    0x3268b4798f9d67b3, 0x4fa8d5ecbdaf9731, 0x1c3ba79fec92a48d, 0xd2a58e4fea85b3f9, 0x4fe75b621ba9d267,
+    0xbc8d2345478ae1d3, 0x58b917e6568cef41, 0x6dc9f35875812f9d, 0x518ca2dba3954e1b, 0xbc7e213dc1a64d87,
+    0xea7145bdcf796be3, 0x6ac425d1fe7d8b61, 0x1e7ad9c21c5f78bd, 0xc637dfa54d72c83b, 0xb2178df43b84d6a7,
+    0x3e95a8b76a89e715, 0x891a476ba67bf581, 0x6537fadba57c14ed, 0x6783b5cfe691435b, 0xe497cba1f19452c7,
+    0xeab6278542a98135, 0xf7239e143e5a7f91, 0x3d9ba7843b4a7cfd, 0x91be58a65a4f9d6b, 0xd51f4a398952cbd7,
+    0x743a6b2dc976eb45, 0x7586d2ced657f9b1, 0xd6b7e3afe56b192f, 0x3467bd92145e278b, 0x3159fad6538146f7,
+    0x92fed41ba1938675, 0xc418923a9f4785d1, 0x6d548ea98d5a934f, 0xf1eb62598c4d92ab, 0x1b9f2c4eda5fc129,
+    0x1ed2a8cfe942df85, 0x8c16a5732845fde1, 0x7eaf381437481d5f, 0x24819eb765492dcb, 0x2dea8619825e4c39,
+    0x2a56cf1dc2416ba5, 0x12af7c5dcf458a13, 0xcf615a7dcd25987f, 0x9a2f34d1fc2896eb, 0x5437ab821b2dc659,
+    0xd18ca7f4392fd4c5, 0xca41ef698a62f543, 0x6127e89ba846139f, 0x6df248bcb759431d, 0x632adf7ed53c4179,
+    0xb15e639cb12c4fd5, 0xc6db879edf218e53, 0xa48eb2d32e137caf, 0x286db7354e169b2d, 0x6a91f4254d17cb89,
+    0x9bea1237681bc9f5, 0xc78f941ba81fe973, 0x427b319cb82317cf, 0x542eabdfe816274d, 0x9fcba321f41835b9,
+    0x7dfc2654341c6527, 0xbf289c47621e7493, 0xb86e2c754bcd72ef, 0xdc5621487cf3a16d, 0x61283da768e4afc9,
+    0xeadc716ba9f8ce37, 0x7f35412cb6f9eda3, 0xae81fb5cb6edfc21, 0x135ec9d436f12b7d, 0x46da258325f43ae9,
+    0x42dc6be762f84a57, 0xf6a1934871fa68c3, 0xec35a2487fed9841, 0x6bd7c3f87bcf859d, 0x359cfb2edae3c51b,
+    0x7a3e84b1fae5d387, 0xbe3cd78219c8d2e3, 0x647e91d548dbf261, 0xef41dc5656ce21bd, 0x38bef27986d14f2b,
+    0x14297faba2d34e97, 0x6d4af78ba1d76cf3, 0x462f938cbfda8c71, 0x9e23c4f1feab79cd, 0xf845d9e21dcfa94b,
+    0x73a825143ac2d8b7, 0xbdac94854ac6e825, 0xfdbea71657c8f691, 0x16dbf48986ba15fd, 0x517d9feba5ce246b,
+    0xd75ce46fe4c153d7, 0xf43ce291f1d68245, 0x8fd6a2c543d782b1, 0xa6378ce43da98e1f, 0x13fc67943d8c9e7b,
+    0x7c9e8db5498face7, 0x2534e68989a2ec65, 0xdb2f765cb795fac1, 0x3f4d895ed6b81a3f, 0x6bfa4381f4ac289b,
+    0x2a49875325be4819, 0xb6d314e543c16785, 0xc256ea4872b486e1, 0x2b6fc9d76ea7945f, 0x15e264376e7893cb,
+    0xa96fe8dbab8dc239, 0x76c34bfdc98fd1a5, 0x2a6597edc783def1, 0x789eb5a328951e6f, 0x859bf3c435872edb,
+    0x19368be7658b3d49, 0xb97e6218728e4cb5, 0x75ba31fdc4a18b23, 0x4be53fdcbe63798f, 0x3fa6b5edcd6597fb,
+    0x4bae3891fd5ac769, 0x8a716d521a7bc6d5, 0x8de719232a8fe653, 0x546f1ce7698314af, 0x28e547fba897342d,
+    0x1265934dc57a4289, 0xb615a7fdc38b61f5, 0x7f29c6bdc18d7f63, 0x9aef824dce517dbf, 0x35b679e21f649c3d,
+    0x976a1c532e45bca9, 0xc86d31254c59db17, 0x95f481d7695cea83, 0x46ad27c9864ce7df, 0x1c8fb62dc973285d,
+    0x9c4d38afe47536c9, 0xa68c73d1f28a5637, 0x35879ad2126c75a3, 0x3581eac7637e9521, 0xf3d95e876f51a27d,
+    0xf1e934b87d54b1e9, 0x4c26b85a9b36cf47, 0x2956a74ba948deb3, 0x37e4cf2dc85bfd31, 0x26147a3fe64f1c8d,
+    0x4b7eac6217523bf9, 0x56facbe328354b67, 0xf52369e8724869d3, 0x3154c76ba24c8951, 0xc2361d587f2e86ad,
+    0x743e985bae41c62b, 0x73b81c6fec23d497, 0xc3475a6fea27d4f3, 0xf9bd45832b4af371, 0xf5128cb6584b12cd,
+    0xa352efb8785f314b, 0x73cfb29a96324fa7, 0xebf9d62cb4367e15, 0xc2b3648dc2397d81, 0x948a23fcbf197aed,
+    0xd8be9231fd1e9a5b, 0x31a72eb43e21d9c7, 0x3a2e46176c14e935, 0x89fdc2b65b26f7a1, 0x6d7cfe19893a271f,
+    0x16a24cdba81d257b, 0xf418d2ecb61f34e7, 0x946d73afe7128365, 0x59c3ab71f42683c1, 0x9c5231f65428913f,
+    0xc9a5dfb32de79f8b, 0x2fced96439ebadf7, 0xaf634b1549efcd75, 0x7926a5c878e3fbd1, 0x9cf8463ba8e61b4f,
+    0xa59d436ed5f729ab, 0x5d3cbaefe5fc4a29, 0xa91e785213fe4895, 0x2c9a753654e287f1, 0x5e6f37b871e3956f,
+    0xaebc31565fe694db, 0x3c624ef87deac349, 0x4e2cdfb989ecd2b5, 0xfb98573cb9cfe123, 0x4219c3bfe9d4218f,
+    0xe8153d7217c52feb, 0x64c9d5e326d83e59, 0xe49fa15763ea4dc5, 0xb18ea36982de7c43, 0xbd3268a982d17a9f,
+    0x1e38ab498fc4a91d, 0x49fbe17cbed5c879, 0x4f98ab71fab9c7e5, 0xc6df45921abce763, 0x94fcda13279de4bf,
+    0x7d52f1a879c4253d, 0xa641f28987d643a9, 0x4de825fcb5da6317, 0x5f6eb12cb4dc7183, 0xc15f3a6ba19b6ecf,
+    0x7125f3edcfa19e4d, 0xae5c6f921f83adb9, 0xda638fe43ea6dc27, 0xc9f23a454ca8eb93, 0x62c8d9f5467ad8ef,
+    0x48f75d1987af196d, 0x4eb7581dc6b237d9, 0x6d4a1e7fe3c65847, 0xc4f23961f2c976b3, 0x2edbf46324bc9631,
+    0x3a4dc61541ae938d, 0x452b3fa65e81b2f9, 0x874ab6198ea4d167, 0xacb716287a86dfc3, 0x649d38ecba89fe41,
+    0xc74a15fdc67b1e9d, 0x859be41fe68f3d1b, 0x83d4691216a24c87, 0xdec9b52324956ae3, 0xf38a24b653b98a61,
+    0x42b1af76516a87bd, 0x7ad4e2698f6ea73b, 0x8f5a637cbe81d5a7, 0x984237bedc94e615, 0x8352e1afeb97f481,
+    0xa5146dc32a7913ed, 0x1ceab675498d325b, 0xf3a71c26568f41c7, 0x98e1352ba6937f25, 0x96842e5cb3857e91,
+    0x43ec7d9ba1567bfd, 0x2c9b81aedf4a9c6b, 0x9c5b4631fc4ebad7, 0xa7f2b5132d71ea45, 0x7d1b56c43c64f8b1,
+    0x834f15b65b67182f, 0xf4d91e58795a268b, 0x345e29aba86c35f7, 0x5834f9cdc38f6475, 0x8a5642cfe57384d1,
+    0x2a947e5fe176924f, 0x6a951324325791ab, 0x3876a2d43e4abf19, 0x182bced54b3dce85, 0x1afc2eb87a52fce1,
+    0x49e61c7a9a641c5f, 0x76f84c1ed8462acb, 0x7cb5a91fe75a4b39, 0x39eca851f63d49a5, 0x672c59a3265f7913,
+    0x2b13e4d65342967f, 0x47fd15b8713495eb, 0xc6ab15987f28c459, 0xf316bce98e2ad3c5, 0xe2a3c81bab5de243,
+    0x5849b1aedb53129f, 0xb3c98a71fa56421d, 0x3a7d5e621a273f69, 0x725eb6d437294ed5, 0xc54b8e39862c7d53,
+    0x7c162d38732e6baf, 0x7e4a85fcb1439a2d, 0x24bef8acbf14ca89, 0xe8fa631cbd17c8f5, 0xc6b79e21fc1be873,
+    0x748f16e3291be5cf, 0x139ea7b87b31264d, 0xb27af4187a1534b9, 0x569a3e7cba196427, 0x9358f47dc61b7293,
+    0x9cd42feba42b71ef, 0x9de7123cb21e8f5d, 0x7eadf34cbdf1aec9, 0xa74bfce21ef4cd37, 0xa6fd78232bf6eca3,
+    0xb5f9de865ae9fb21, 0x9edf2c4658fc1a7d, 0x5c1e3d9876df28e9, 0x6735b9cdc8f24957, 0x196c8d3ed4f567c3,
+    0x9153a7dfe3fa9741, 0x5e47ca6212fb849d, 0xd1ae493652fea41b, 0x12c58b365fe1d287, 0xfac746587bc5d1e3,
+    0x71d6ca898ac7ef51, 0xe826c5fa97c81fad, 0xa976814ba7dc3e2b, 0xb67d4eafe5cf3d97, 0x65718a3217d26bf3,
+    0x92ec3a7434e58b71, 0x6731c9f542e678cd, 0x1ca4b8f761eca84b, 0x31a7b2e65faec6b7, 0x73a98cebadc1e725,
+    0xbac8756edbc4f591, 0x6c12e49fe9b714fd, 0xd7b51c6219da236b, 0x75f1d23438bc42d7, 0x8c326a9768cf7145,
+    0x2c3718d985c37fa1, 0x49fd5eba93b58d1f, 0x647f53dba1c69d7b, 0x36e81cbdcf89abe7, 0xd57e86a1fc9edb65,
+    0xce8762943da2f9c1, 0x12bc69354cb5193f, 0xb17d2fe54ac6279b, 0x86b94ce768cb4719, 0xa71e2c3ba7bd4685,
+    0x649bfd1cb4af75e1, 0xf514763ed4b2935f, 0xf34265b1f1a592cb, 0xabc3d81542b8c139, 0x2467fe932e7acf95,
+    0xbfc86d254a7bcdf1, 0xe4953d687b921d6f, 0x152b37d879842cdb, 0x6c71459ed8a73c49, 0x6c48a71fe6894ab5,
+    0x72d56cf1f59d7a23, 0xca9d7fe2139e678f, 0x1dc4f2a5438296fb, 0xd35a1e6871a4c569, 0x3b561a276f78c4d5,
+    0xd8926f7a9d8be453, 0x164d7f29896ce2af, 0x4972bc8feb91432d, 0x6b4d32c1fba54189, 0x5b69ae3219874fe5,
+    0xe2cf5673258a7e63, 0xc87be3f5435a6cbf, 0xa57e91d8726f8b3d, 0x72c485398162cba9, 0x26eb9d3cbf65da17,
+    0x92386fbdcd57e983, 0x37851cbdca49e6df, 0x67fd54b32b6e175d, 0x29a183654b7135c9, 0x6e83d1f98b946537,
+    0xeaf1bd4cb96874a3, 0x8ae39b2dc67b9421, 0x9a6b318cb35c917d, 0x48219dacb14e8fd9, 0x4ca7532edf52ce47,
+    0x7adb8cf21f45edb3, 0x1c962eb54d58fc31, 0x19a38f465c4a1b8d, 0xbf1dae47684d2af9, 0x734bf29dcb514a67,
+    0xb5c9726dc95468d3, 0x179dc62fe6479851, 0xc3b87541f23985ad, 0xc94b5e82134da52b, 0x48d3c526514fc397,
+    0xa9febd787e54d2f3, 0x5e4d3b1a9d46f271, 0xdbf8361a9b4821cd, 0x189fe42dc94a2f3b, 0x31589abdc82d3ea7,
+    0x8245a6f1f9427d15, 0xdf4c675329347c81, 0x135baed4342579ed, 0xf39148576328a95b, 0xc4936527612db8c7,
+    0x2639471a9e1fd835, 0x458b19ecbd23f6a1, 0xb237481edc37261f, 0xa826cfd1fc19247b, 0x46572fc32a1b43e7,
+    0x8df2ce754a1e7265, 0xa564d218794382c1, 0xf2dc6b9a96148e2f, 0xdf65493ba3159e8b, 0xab2f196cb218acf7,
+    0x2b639d8a9efadc75, 0xe43a219cb9fcead1, 0xca2b65e43ce21a4f, 0x576def843cf428ab, 0x9e58d7465bf74829,
+    0x1dfb629768fb4795, 0x597c23ea95ec76f1, 0x41f379aba3de846f, 0x378b965dc4f293db, 0x34b85aefe1f6c249,
+    0x5f73c1d432f8d1b5, 0xf3a9c2b54ecadf13, 0xe82d5a7439abed7f, 0x614dfe8769c12deb, 0xd64b8a198ae43d59,
+    0x4d987ceba8e74bc5, 0x5392781ed6ea7b43, 0xde86ca1fe3dc689f, 0x5e687f9324cf981d, 0xaf947e1543e2c679,
+    0x1bdf567871d4c6e5, 0x2a437db87fc9e563, 0x41c2de976ca9e3bf, 0xf67518ca9abe143d, 0x5467a81febd142a9,
+    0xb83529c1fad56217, 0x89df1c5219c86f73, 0xeb874a9324a86dcf, 0x298d375653ab8c4d, 0x31e9f8a652af8cb9,
+    0x85bd12ea91c3db27, 0xc4ae6bd98fb5ea93, 0x3af247cbab96d7ef, 0xaeb63751fcab186d, 0x61e4ac721bae26d9,
+    0x51d7ba343bc15647, 0xbf1a4e9769c475b3, 0x29f7ac5ba7c89531, 0x6f15c94874ba928d, 0xb8f34a9cb38ca1f9,
+    0x791a5ebdc19ebf57, 0x27896eacbf82dec3, 0x2d675c432e96fd41, 0x23b7f5d43e871c9d, 0xdc9a12465d8a3c1b,
+    0xb92814f65a9e3b87, 0x82ba9dfcb8a169e3, 0x273b4f9ed7b48961, 0xea67c43fe39586bd, 0xd2ba3c91f289a63b,
+    0xf8b46d12128dc4a7, 0x2db43ae7629fd415, 0xf1bd93676e94f381, 0xb6ec32f87c8612ed, 0xc578fe9bad89315b,
+    0x3fa5c64dc96a3fb7, 0xae43b69dc98d6e25, 0xdc2b9671f6827d91, 0x1ba3487215637afd, 0xf9a871b323759a6b,
+    0x9edb42754258b9d7, 0xa1248f39817cd945, 0xd3cbe2898d5fe7b1, 0x9a7b851cbd84172f, 0xc51ab32fed76258b,
+    0x4ace386feb6934f7, 0x4c81bd521b8c6375, 0x47e6d8c5496e73d1, 0xc1b39a576872914f, 0xdae9657874538f9b,
+    0x73d4286ba356be19, 0xe9d1837cb149cd85, 0x7c582eba9f4adbe1, 0xc6a839fdcb3dea5f, 0xb9e6d7321e5329cb,
+    0x6b5ce8a32d564a39, 0xe985d4f76c3948a5, 0xc53fd6ba9a5c7813, 0xcad459eba63d857f, 0xecf74a9dc65194eb,
+    0x589c61dfe264c359, 0xf49257a1f147d2c5, 0xe25f3486526ae143, 0x8af6c1943c2ade8f, 0x3d2b94f65a3d1efb,
+    0xa834c1298c423e69, 0xbe65134a9a264cd5, 0xa67123ceda297c53, 0x85a794ded52b69af, 0x3698b7f1f53e892d,
+    0x4dbc69232531c789, 0xe5a6b1976423c7f5, 0xd2eb741a9128e673, 0xb2c4de876d18e4cf, 0x2156e93a9e2c154d,
+    0xd73f1a4bac1f23b9, 0x16d592bfec146327, 0x49827ca1fb267193, 0xfa519cd328176edf, 0xcb12e6f4361a8e5d,
+    0x984df2c6541e8dc9, 0xb2487d5a9521dc37, 0xfd138e6a9214eba3, 0x37915fca9de6fa21, 0xd91e7a3cbcf8197d,
+    0x9657afbedafb27e9, 0x6d94fb321bfe3857, 0x3182aef54af176c3, 0xa1b463987af59641, 0x6423fac875f6839d,
+    0x32bcd5f985f9a31b, 0xf317d92ba3fdc187, 0xe56317fa91cebfd3, 0x9485e6fcbdc3fe51, 0xa2746b932fc51ead,
+    0x87a3cdb54ce83d2b, 0xdf918e254aeb3c97, 0x56ce412768cd5af3, 0x812f39acb9e28a71, 0xa3412e7ba5e387cd,
+    0x759a68ced3e6a74b, 0xd83a62f1f2e9c5b7, 0x89dbe57213ecd625, 0xe74dcf2652cfe491, 0x293468576eb413fd,
+    0xd8a75fb98ed7326b, 0x6e134b798bc941d7, 0x4562af1ba9cb6f35, 0xb7e38f5dc7bd6ea1, 0x49e2c76fe6b28c1f,
+    0xf1697cb215d39c7b, 0xde7461c323c5bae7, 0xadf89c2542c9da65, 0xbf9e5c3762abe8c1, 0x156df3a76c9de73f,
+    0xd2a5764baec3269b, 0xd7ca398fedc74619, 0x5df4b961fbca6485, 0x64dc1a5329ab74e1, 0xdc5fa6b437ad825f,
+    0x84ef752656a291cb, 0xe953f7b875a4bf29, 0xcb85736982a6ce95, 0x5f8d9a2ba298dcf1, 0xd743f52a9d7aeb6f,
+    0x9bd8265fec7f1adb, 0xe41dab621ea23b49, 0x716af9b32da649b5, 0x7f9b5c865cba7923, 0x6b1dc7a5459b768f,
+    0xcd57963a947d85fb, 0x47fab6ced5a1c469, 0x15a8b9dfe294c3d5, 0x3297cdf1f1a8e253, 0x17dba3e43278e1af,
+    0x243ec1f65f8c312d, 0xd74b89f54c6e2f79, 0xca3e5f287b824de5, 0x61735a9bab957d63, 0x5184e96dc8576abf,
+    0x84175d6fe56b8a3d, 0x8f75cb61f35eb8a9, 0x621a75f43582d917, 0xa827cd465294e783, 0xacb183754176e5df,
+    0xdea138698f7a165d, 0xeba128798e6d24c9, 0xb14a9fdcbc8f5437, 0xda7b81efec8472a3, 0x542ab391fb879321,
+    0xdc14a95219478f6d, 0xe76c58b3254a8ed9, 0x24c5af67635ebd47, 0xdc4275a98461ecb3, 0xfa9385eba275fb31,
+    0x3e7f4b2cbf461a8d, 0x5b81732dcd4a28f9, 0x729fd581fc4d3967, 0xc8af45b21b4f57d3, 0xa76412854c639751,
+    0x4a36c1e7693584ad, 0x958cef6a9758a42b, 0x4276e19ba54bc297, 0xc89d6a4ba45dc1f3, 0x3986fcadc352ef61,
+    0x28c14bedce341fbd, 0x458791d21f472e3b, 0xa263df454e293da7, 0x4591a3287b3d6c15, 0xc472d5987a3f6b81,
+    0x1f56e43ba93278ed, 0xd52a638ed724a85b, 0xe32846cfe428b6c7, 0x82b493d1f42bd735, 0x6c9b5e83243de5a1,
+    0x8deb4c198463251f, 0x17b6a5898f15237b, 0xfe6d7b1a9d1842e7, 0x27f836ebad2b7165, 0xe9185fcba92c6fb1,
+    0x1f68b75cb81e7d2f, 0xf482ba71f6129d8b, 0xe19f48732614abf7, 0x2c983da43418db75, 0x4d13f297642ae9d1,
+    0x1ed9b238721ce84f, 0x4bed1f576def17ab, 0xbfe168dcbdf34729, 0x15ca378edcf74695, 0x8149fa2edae975f1,
+    0x6381ab9219eb836f, 0xd39ea86436fe82db, 0xbde3465767f2c149, 0xa2c79ed874e3cfa5, 0xf61c934a94f7de13,
+    0x984e5dfa91d8ec7f, 0xd6c452398fda1ceb, 0x957468cfebdf2c59, 0xac58be921de24ac5, 0xe986bad32ce67a43,
+    0x57fec2943ad8679f, 0x9fbc134656eb971d, 0xe42a567984deb579, 0xa1d7564ba6d1c4e5, 0xe2416b8dc2d5e463,
+    0x59a8f24ed1c6e2bf, 0x91ce285654ea123d, 0x1983cd254fcd31a9, 0xb9328dc54bad3ef5, 0x754ebcf98bc26e73,
+    0x935ea2d878a46bcf, 0xa546e8fba6c78b4d, 0x1bdcea6fe4dc8ab9, 0x2b4fdec1f4beca27, 0x4cb75ae325c1e893,
+    0xfd79c4e542a3d6ef, 0x8d3ac7e652c8176d, 0x63584c276fba25d9, 0xdce4197a9ebd3547, 0xb654de3a9caf64b3,
+    0x7cd483efebc59431, 0x6a8e45b1f7b5918d, 0xf4d1ba5215a68fe9, 0x45912a63249abe57, 0x2c7351b6548ebdc3,
+    0x47aed53985a2fc41, 0xb3ca147982a41b9d, 0x3a615ebdcf973a1b, 0x9bc785fede9b3a87, 0x5c6e89d1fb9c58e3,
+    0x174582a32caf7861, 0x7c5981243a9285bd, 0x28e1d3c54896a53b, 0xb1d563976598c3a7, 0x685ca12ba69bd315,
+    0xed1ba65cb49de281, 0xa621f3edc49321ed, 0x6c9817aede852f4b, 0x874c9ba21f863eb7, 0xc5fb19343e8a6d25,
+    0xf3c926754b7d6c91, 0x3f8ad465485e69fd, 0x127fca8dc872a96b, 0xa3c564fdc564b8d7, 0x2ace3b7fe379d845,
+    0xb2c9f4d1f37ae6b1, 0x7bef5982137ce52f, 0x48ab9e576391248b, 0x91e5ac376e8543f7, 0xad5e217bae896275,
+    0xd76852fa9c6a72d1, 0x2cfa815ba95b7e3f, 0x6e38a4bdc64f7e9b, 0x6aef7951f763bd19, 0xd7f49a821764dc85,
+    0x7f9a8ed43457dae1, 0xa4d9b6c7624ae95f, 0xc14f7e28725e18cb, 0xbdf482ecbf614839, 0xc9a6f27dce6347a5,
+    0x9e472dcfed598713, 0x2978561feb3a847f, 0x4c76ad52194c83eb, 0x726ead84384fb259, 0xd15fe9287863d1c5,
+    0x37c914fa9756df23, 0xf39ec42a9236ed8f, 0x98da4c6ba2491dfb, 0x41b9a53cbf3e2d69, 0x8b75ed61fe314bd5,
+    0x6a3798d21e247b53, 0xb7f3e2c43c2568af, 0xe5d1f7365b3a982d, 0x85cb9a46572db689, 0x254bfe7a972eb6f5,
+    0x715fbe4dc842e573, 0xb3947efcb425e3cf, 0x257a36c1f259134d, 0x8f54a736514c32b9, 0xe34f91276f3e5127,
+    0x7965caf87d216f83, 0x74eb23187a136cdf, 0xf18d593a9a168c5d, 0x462b5f7ed6178bc9, 0x5bc3268fe61dcb37,
+    0x8bd5e64fe51fd9a3, 0x74d582c65734f921, 0x865b9fa76425187d, 0x471d3528731826e9, 0xae7c85398efb3657,
+    0x5e846f198bfd65c3, 0x8cde13ababef8541, 0xf9178e2dcaf3829d, 0xb23d147fe8f6a21b, 0xed17a36215e8bf67,
+    0xec18f26325f9bed3, 0x94bd1a6764fced51, 0x5fc3ad9874f21cad, 0x1c8db6fa91f53c2b, 0x9d7f123bafe63b97,
+    0x467d3fbcbcda59f3, 0x2fa79361fbed6971, 0xc9de715219bf76cd, 0xe7bf31a439e2a64b, 0x163cf8a438e5c4b7,
+    0xa3c5e71987e9d425, 0xae34df7985dbe391, 0x18edafc983abe1fd, 0x2dcf386ed4e2316b, 0x7bda8c1edeb43fc7,
+    0x413eab721fc86e35, 0x9e6bc1743ec96da1, 0x12a94f3549ac7b1f, 0xfa31749546cf8a7b, 0xbc4e561986c2b9e7,
+    0xaed4135cb7c4d965, 0x756d231ed4b8e7c1, 0xcaf21b5ed2bae63f, 0xcd2e41b323ce159b, 0xeb293d7873d24519,
+    0xe4dc7a187fc46385, 0x93ed54176db873e1, 0x91df65287cba815f, 0xfdc5678a968c7fab, 0xce13849dc68fae29,
+    0xdf6ba351f6a2cd95, 0xfabe47232695dbf1, 0x96218cf32397ea6f, 0x92fb85d6538a19db, 0xd739eb6871be2a49,
+    0x12c6847a9fa148b5, 0x5ab2f17dceb57823, 0x6b4a759edca6758f, 0xed37a85fea7984fb, 0x76485fd21a8db369,
+    0x3e62a174378fb2d5, 0x7e5d342878a4e153, 0x36d5b9f76374de9f, 0x26d31c5ba4982f1d, 0xb6c4e29dc18b2e79,
+    0xd73cf5ebaf7d3ce5, 0x5f6c38a1fe917c63, 0xbf4951c21d7369bf, 0xb84fec632c76893d, 0xd13e67843c58b7a9,
+    0xe95d1f36596dc817, 0x6357dc4ba57fd683, 0x4e8529aba572e4df, 0x72b3418fe397145d, 0x96348df1f17823c9,
+    0x2d671cf5419c5237, 0xbdc269a54f7e61a3, 0xb84ef3a54b516def, 0xc5214a687b538e6d, 0x39a74cf87a458cd9,
+    0x4ad2c1fed859bc47, 0x14b9edcfe65cdab3, 0xcab5983ed56fea31, 0x85f214732563198d, 0x61c72935436527f9,
+    0x87e5f3ba915a3867, 0x4cbd2e698f4b56d3, 0x21cf7e6bad4e8651, 0x1db576ecbc5183ad, 0x8a93e15fec65a32b,
+    0xbe576d91fa46c197, 0x61db7e421748bfe3, 0x71c65de4374bde61, 0x712b93e6543efcbd, 0x4ed86f1a95642d3b,
+    0xbe97f36cb1453ca7, 0x1f598bcdcf396b15, 0x53dab86ede3c6a81, 0x958d6741fa2c67ed, 0x7196e4f32d31a75b,
+    0xbc7e19854a23b5c7, 0x613fbd987a28d635, 0x34c6e1a98739e4a1, 0xe57463da964be31f, 0xc617a85dc54f127b,
+    0xb81d936ed25341e7, 0x4365fa7ede176f45, 0xa5fb8dc43f286eb1, 0xa3cd21f54d1a7c2f, 0x49816c354a1e7c8b,
+    0xa62845376921baf7, 0x3a79efdcb913da75, 0xe3f59b1cb726e8d1, 0x1ace4bfdc519e74f, 0x697df381f42d16ab,
+    0x7642e3d5451f3629, 0xda4c8be983126495, 0x1f9a53e76de574f1, 0xea5b18365ce7826f, 0x3b268d576af981db,
+    0x5234ac6987ecaf39, 0xd79b458a96dfbea5, 0x153427fdc7f4ed13, 0x584f3a1215d4eb7f, 0xefa2639434f71aeb,
+    0xfc512eb763fc2b59, 0xcde532f871fe39c5, 0x1657df4bafe17943, 0x7c65e3dbacd3769f, 0xbc96784dcbe7961d,
+    0x36db97a1f8eab479, 0x758dce6218dcb3e5, 0x4e9b2fa548cfd263, 0x9e5c381656c3e1bf, 0x24186d9a96e7213d,
+    0x26aedc7ba3d72f89, 0xd8f3be1a91ca3df5, 0xc28d579bafbe5d73, 0xa14edb8fedb16acf, 0xbc3685e21ec38a4d,
+    0x8416ec932cd5a8b9, 0x984cfb3548dac927, 0x17f8ac4656bcd793, 0xb2c6f958749dc5ef, 0x17ba24ecb7c3156d,
+    0x6d9bce2fe3c624d9, 0x3ce752a1f1da5347, 0xf2619bc541dc62b3, 0x1e3f4bc65fbe8231, 0xbd489f154ca18f7d,
+    0x721df5c65ba38de9, 0x42d65fe989a6bd57, 0xfc1ed56ba698dbc3, 0x6ac71b2ed69ceb41, 0x8e1b9f6dc37ef89d,
+    0x986db4c326c4391b, 0xce9b32f542c53987, 0xdeb69f8761b957e3, 0xe31485d65fac8761, 0x162ebdc76c8e74bd,
+    0x4b352e7dcd91a43b, 0x49a23defeb94c2a7, 0x8574ac31f9a8d215, 0x1287cbe32689df71, 0x8f97d1b32469fecd,
+    0x14b3dc67658f1e4b, 0x4c1bf7d984923db7, 0xd46b18acb1a76c25, 0x715c8b9dcf786b91, 0x857b9d2cbc5a68fd,
+    0x58cb3ea1fc5e986b, 0x79d4e8a32c81b6d7, 0xcf15a4932b93d745, 0x471c26a54987e5b1, 0x8eb64f798679e42f,
+    0xa4d27fcba57d138b, 0x937ab82cb48e32f7, 0xbad7521fe2a36175, 0x4f67a89ede756fc1, 0x9e1846d21e587d3f,
+    0xe27a94b32e4a7d9b, 0x2e63a9454b5eac19, 0xbc5fe4287a61db85, 0x1375aceba864d9e1, 0x5f216b7cb746e85f,
+    0xebc324afe45917cb, 0x4823a6b1f46d2739, 0x89b34a62127f36a5, 0x6f4d3be872948613, 0x4a5693276e45837f,
+    0x6f3ac2176d4782eb, 0x8d1fb3598d4cb159, 0x5f2c3b6a983dafb5, 0xc92a7fbdc961de23, 0x9f18524ed643ec8f,
+    0xb179c46327461cfb, 0xaf385624354a2c69, 0x95a62738724c3ad5, 0x5de6fbca914f6a53, 0xbc2584ea9e3267af,
+    0xa42d591cbe35972d, 0xb25e9d8fed27b589, 0x5423b18fe92ab4f5, 0x18f7e6c21a2ed473, 0x357dba865841e2cf,
+    0x12f8dc598956124d, 0x42859f1ba64731b9, 0x3485bf2cb53a4f17, 0x57e8124cb12c5e83, 0xfe4c59ba9c1e5bdf,
+    0x29f76de1fe128b5d, 0x8b7c5ea32e148ac9, 0xfae1c9b54d18ca37, 0x9f2845b6591bd8a3, 0xd4653c78793de821,
+    0x5d9812fcb932167d, 0x3ec7f68dc71425e9, 0x5eda714fe6193457, 0xb8967c51f21a64c3, 0x38e1d2c7652d8341,
+    0xc758fa143cfe719d, 0x71bd8a954bd18ef9, 0xb95e3d765af3be67, 0xfe42c3a878f6bcd3, 0x8a6fc47ba7f9ec51,
+    0x8f6531d984ebf9ad, 0x8b216a7ed5ef1a2b, 0x6c97dba215f23a97, 0x36718d2542e658f3, 0x359aec2652fa6871,
+    0xe7864fd54fea75cd, 0x4eb376587cde954b, 0x6bef874a9ae1c3b7, 0x9b1258edcae6d325, 0x69d82fb1f8d7e291,
+    0x863c1a4215a7cfed, 0xebd9cf2436dc1f5b, 0xecd53af654bf2ec7, 0xd318c52a94e26d35, 0x7e562f3a92e56ca1,
+    0x6c9385fa9ec87a1f, 0x5937c8abaedc897b, 0xb653e741f9bda8e7, 0x48c729a32bc1d865, 0x5c96a7f439b4e6c1,
+    0x41d6bce548b7e53f, 0x4f92675876da149b, 0x3458296ba6cd3419, 0x85694fbcb3cf4285, 0xdc95248ed3c472e1,
+    0x7b8ac96dcda57e4f, 0xc57ea8b21f967eab, 0xb9d61c343e8bad29, 0x3a76ef143a8ebc95, 0x9e3b52476892daf1,
+    0x3f54ba7987a3e96f, 0x784cf51dc5a618db, 0x6e9a34bfe5cb2849, 0x82b953a1f2ad37b5, 0xa7cef3b214bf6723,
+    0x2a4157b651b2748f, 0x382df9754e9583fb, 0x857a1cb65ea8b269, 0x1d24b5f87c8ab1d5, 0x8e52346ba98dcf43,
+    0xe5d7b2fcb671ed9f, 0x2d3b8ce1f7952e1d, 0xcd976b5215a62d79, 0x5ab7d9f324893be5, 0xbc4f5798729d5b63,
+    0xbfc12487617e58bf, 0xcd45837baf72983d, 0x6e38c57dce74b6a9, 0x8673e5bfed89c617, 0xc4d926e1fa7bd583,
+    0x3abef512186bc3df, 0xc18a2b476a92135d, 0xd35c1ef7678532c9, 0x97536fecb6a95137, 0x31f7d59cb27a5f93,
+    0x6e94728a916a5cef, 0x4cf126ebae4f7c6d, 0x2e4c5831fe528bd9, 0xcbd169521e65cb47, 0x9462a5d32c57d9b3,
+    0xc398bd165a6be931, 0x3abe8276574cf68d, 0xeb92457cb87126f9, 0xa9c32b4ed8943567, 0xe35dc12fe27865d3,
+    0x4fdeca61f27b8451, 0x5316caf4315c72ad, 0x4239d1654e5f912b, 0xf3a24c765d42bf87, 0x4dc593787a45bde3,
+    0xfed5236a9a48ed61, 0xfd3584ba9638fabd, 0x8326ba4ed75e1c3b, 0xd2bf3971f6513ba7, 0xc918e7b328746a15,
+    0xfd275eb653476981, 0x1e29bca6513976ed, 0xe54ab7d87f2d965b, 0xc72e35498d2fa4c7, 0xd3647b8cbc62d435,
+    0x42c519fedb46e3a1, 0x9a54217ed948e21f, 0x7ae16f34394c217b, 0xdf278c65463c2fd7, 0x19326e4a98316e45,
+    0xb45f1cda95346db1, 0x391cea5ba1367b2f, 0x34c6f29dcf197a8b, 0x8296ad5cbd1ca9f7, 0x397b82cfeb1fc975,
+    0xfe37dc154b23e7d1, 0xfa5c38243a15e64f, 0xadcf8157692815ab, 0x4e3978dba81c3529, 0x2ad57f8cb71e4395,
+    0xa85b9fcdc64273f1, 0x4951f86ed324816f, 0xe89c754bade47fcb, 0x93bf81a21df7ae39, 0x7fdae4532cf9bda5,
+    0x59fbe12659fedc13, 0xc293ed7658d1ea7f, 0xebf1ad4987f419eb, 0x1963fabdc6f72a59, 0xad357f8ed4fa38c5,
+    0xa81d475fe2fd6843, 0xc91f857212de659f, 0x84539f2762f3951d, 0x62d1fac54fe5b379, 0x5293bc176cd8b2e5,
+    0xdcf832698aebd163, 0x5d3c94a8769bceaf, 0x9562e14cb8c31f2d, 0x2f5ae841f6d42e89, 0xb7e8d14216d73cf5,
+    0x9df64c2324ea5c73, 0x1a426d3542db59cf, 0x61b83dc761cf794d, 0x298ab3576fd2a7b9, 0xc41f35ebaed5c827,
+    0x7bd3926febc8d693, 0x72c3f1ded7a9c4ef, 0x1ed8567218acf36d, 0x2cf53e1658c123d9, 0x2db4183989d65247,
+    0xcf961d7a95d861b3, 0xe2798c5a94ca7f21, 0x61489fda91ab6e7d, 0x81d5a2ebad8f7ce9, 0xa5e836b1fea2bc57,
+    0x8daf46521e95dac3, 0x29ce7bd43cb8ea41, 0xa697cde4368af79d, 0xc12694f767ae281b, 0x1d69328cb9c13687,
+    0x75c8f63dc7b456e3, 0x186cba9fe3c98561, 0x576f4ad1f1a973bd, 0xdf6a749541ad923b, 0x59ce71843e8fb1a7,
+    0xa43d2bc65c82bef3, 0xcfd53e176b95de71, 0xb7294a565876fbcd, 0x2f7e8a1dc78a1d4b, 0x4c68f3aed58e2cb7,
+    0xc34d2a71f7a16b25, 0xde1a2f5325b46a91, 0x7a26b5f4329567fd, 0x96a8fb25418a976b, 0xc9243df54f6ca5d7,
+    0x38f4eb7a9d8fc645, 0x4c1725fbac83e4b1, 0xfa18e45dca86e32f, 0xca6425f1fa79128b, 0x8d1cbe93298b31f7,
+    0x176528b3278d3f65, 0xe517c43875826ec1, 0xcd69f71a92847c3f, 0x42195d3ba1657c9b, 0x2a856f9dcf58ab19,
+    0x934e127cbe4dca85, 0xc1f89d7eda5fc8e1, 0xa47b38521b62e75f, 0x638ef5c43a7516cb, 0x3f7e59265b7a2639,
+    0xf8d5ebca987c34a5, 0x3d476a9cb68e7513, 0xeb82f69dc461827f, 0xc683b25ed26481eb, 0x2d5871fede36af49,
+    0xc7d138621f38aeb5, 0x4c1d9e354e5bcd23, 0x2b693cd5493edb8f, 0xf724e56879531afb, 0xb15c9aedca452b69,
+    0x1563a98dc74839d5, 0x3d29184fe74c6953, 0x7428d95fe23d56af, 0x9a2f6db43451962d, 0x8da29fb76153b489,
+    0xec51b3476e27b3f5, 0x82a46fd98e4ad273, 0xba2ce4d8793ad1cf, 0xe3867c5a982cef3d, 0x976ab1ced8432fa9,
+    0x2be84531f9364e17, 0x53876c4217295d83, 0x321ec8f434295adf, 0xcab61237632e7a5d, 0xcb4f96587231a8c9,
+    0x8596d73baf14c937, 0xf98e216cbe16d7a3, 0x24968bfedc3ae721, 0x7ae3bc5fe91bf47d, 0xe1c2b7a43a2f14e9,
+    0xf2d8b5c98b124357, 0x72be4c69891762c3, 0x617abd3cb73a8241, 0xd325cf6a931a6f8d, 0x6392d51ba21c7df9,
+    0x7c5e619a9cefad67, 0x648eb15feaf2cbd3, 0x7b895ed32cf6eb51, 0xc4852af329e6f8ad, 0xb489afd658fc192b,
+    0x58312f7656fe2897, 0x5e6c87aba8e157f3, 0xf7c6283dc5f48671, 0xe24f13acb2f674cd, 0xa7356cdfe1fa934b,
+    0x8253ab9431fda2b7, 0xfb6eca154edfc125, 0x1ecabf365bc3df81, 0xe97b5da658a4fced, 0xcdfb796879d81e5b,
+    0x215cd74a96ea2dc7, 0x814e2afcb7de4c35, 0xa4b852e1f5e26ba1, 0xb5d478e325d4791f, 0xa67e51d432e5987b,
+    0x62e8cb4541d9a6e7, 0x2f6c48a54fbdc765, 0xf461ad787bafd5c1, 0x4e5876da9ab2e43f, 0x26e785afead6139b,
+    0x83aef641f8da4319, 0x284b69f329dc4185, 0xfe685db436ac5fd1, 0xe6ca518765b17d4f, 0xeab6324762c37dab,
+    0x8d34e72981d6ac29, 0x76d93f587fa8cb95, 0xa6d3187bad8bc9f1, 0xb645891dca9ed86f, 0x25ea6f932ca317db,
+    0x85d1a2743bc62749, 0x9b687c1548c936b5, 0x5f294bea98bc7623, 0x468dbfea94ad638f, 0xe47c61fdc4a182fb,
+    0x5b768adfe2c4b169, 0xdf5647cede86afc5, 0x1b458f621f89ce43, 0x62bfa4c32b6adc9f, 0xc723efd5497efb1d,
+    0x5e841ba76ba32c79, 0xfa861b7cb8963ae5, 0x79a832fed7b95a63, 0xdb1a268ed38a57bf, 0x946753d1f29e873d,
+    0xb2975f832381b5a9, 0xa913dbf762a4c517, 0x7c8bfea65f97d483, 0xf53ba7465b68c2df, 0x2c7b5d198a7bf15d,
+    0x146e7bacba7f21c9, 0x4ca9d7beda934f27, 0x37fed981f7865e93, 0xa7fc361214675bef, 0x527cae83235a7b6d,
+    0xfb36e8a5425e7ad9, 0x27469f1a9281ca47, 0x135ce7da9f64d8b3, 0x751b936cbd67e831, 0xc2985a6dcb49f58d,
+    0xbd286cafea6c15f9, 0x3af154b21b8f2467, 0x2fca4d765a8264d3, 0xbcd13e876a978351, 0xf186cb9a945871ad,
+    0xe5673c4a935a8f1b, 0x4def62acb14dae87, 0x2e746d9baf51bce3, 0x64c2ba51fd54ec61, 0x8fdc51721c35f9bd,
+    0x4e721ba54d591a3b, 0x1b953a865b4d29a7, 0x25be76898a6f4915, 0x2bf543cdca536781, 0x32568eacb63475ed,
+    0xa91458bfe238945b, 0xeac267b1f14ba3c7, 0x793f1c45416ec235, 0x38f41c576f53e2a1, 0x5fb74dc65a23cefd,
+    0xde8c7a498c371f6b, 0x6d4f2c198a392ed7, 0x1a7fe42cb92c3d45, 0x3ac9465ed73f5cb1, 0xb34e92afe6437a2f,
+    0xb489a1721524798b, 0xf681cd754326a8f7, 0x5be84c67612bc875, 0x5a9176e87f2ec6d1, 0x2d9e6bfa9c21e54f,
+    0x562738bdcd2514ab, 0xd658a12fec183429, 0x8ecd9271fa1b4295, 0x6e98b3d5493c62f1, 0x2b365cf4371d6e5f,
+    0xd59ebf1765127ecb, 0x4abf1cd98415ad39, 0x6db241ca9217bca5, 0xf17ba6398ef9db13, 0xc7f531d98aebd97f,
+    0x19a6d34ba8cdf7eb, 0x6b481f521cf32859, 0xc5e714f32af637c5, 0xc3df587659fa6743, 0x6479c3a875eb649f,
+    0x2e148fca95fe841d, 0x78ca1ebdc4f1b279, 0xb3a249fdc2f4b1e5, 0x2d9658fcbed7cf53, 0x45ebcf821eb7cdaf,
+    0x215e9ac439bafc2d, 0xe418a7254acf1d89, 0xed1b6ac879d23bf5, 0x86df2a1ba9e65b73, 0x9ca7582ba4d758cf,
+    0x2a418cbdc3eb784d, 0x3e69a421f2de86b9, 0x1db9265434e1c627, 0x65ec912761e4d593, 0x7d9ba4854da6c3ef,
+    0x3bd4c7f65cb9f26d, 0xadc593f87abc12d9, 0x63294e1cbacf3147, 0xc7fda6bed8c25fa3, 0x92d53ba1f8c67e21,
+    0x53cf6d1214b86c7d, 0xfeb6a29323ca7be9, 0xc98db14542ceab57, 0xe1b459a872b1d9c3, 0x28651f398fb5e941,
+    0xc416b5298ca5f69d, 0xc8adb41fedca271b, 0x6d2a9e81fabd2587, 0x1dfc485219af45e3, 0xa498d1365ac38461,
+    0x6478b9d546a572bd, 0x4e357c1875c8913b, 0x69f1ae87628baf97, 0xb5fd76ca918cadf3, 0xf75d6a4cbf92ed71,
+    0xce48562feb73facd, 0x5e9d1ba32e971c4b, 0xe89f35143d892ab7, 0xab18ed476b9d4a25, 0xd28cf93767af5891,
+    0x1e75c96ba59276fd, 0x9cb7581ed3a4956b, 0xb4ea8c6fe298a4d7, 0x8cb75961f19bc345, 0xfade6395428ed3b1,
+    0x97cb2ad65d83e12f, 0xf85be9176e95218b, 0xe1834db65b862fe7, 0x8db51e6a9b8a3e65, 0x179e538ba87b5dc1,
+    0x3a2b86cdc57e6b3f, 0x2def8461f4627a9b, 0x9b748df32475ba19, 0xd73f18e43267c985, 0x5483a2c6526ac7e1,
+    0xcb9d6a787e4cd65f, 0xd3641b7a9e7215cb, 0x3aebc97dcd862539, 0xc6158b9fec7843a5, 0xc6384ea1fa8b7413,
+    0xf2dbc493295c617f, 0xe816fca3254e6fdb, 0xfbe4c5187562ae49, 0x683e4db98264adb5, 0x789ac2fba168dc23,
+    0x97af5c387e39da8f, 0x5c92463a9a3ce8fb, 0xe573a4f1fd512a69, 0x37e41b821c6438d5, 0x9d1cef232c496853,
+    0xcead6fb5483965af, 0x8df9bc5a974c852d, 0x53b176dcb54fa389, 0x9eb46a1dc463b2f5, 0xd58e413fe256d173,
+    0x4815672bad26cebf, 0x1b8349621c29fe3d, 0xe196a4c54c3d1ea9, 0xd4f785e98c524d17, 0xf9e4b32a9b245c83,
+    0x28c61e4ba82659df, 0x74c61b8dc62a795d, 0x3bdec81fe42d87c9, 0x46edb72fe42fb837, 0x5461f8d21542d6a3,
+    0x1fb536798347e621, 0x794a2b165e18f37d, 0x4eba36587d2b13e9, 0x63ed479bac1e3257, 0x642dcabedb4261c3,
+    0x8659c73eda257f31, 0x359abfe1f7156e8d, 0x7f584ae325187cf9, 0x6a3591f4341dac67, 0x85bcae67641fbad3,
+    0x3c456e1a9423ea51, 0x8cdb9e276ce3f7ad, 0xd4a62e3badf7182b, 0x8d46735edcfb2697, 0x7c92db1ed9ec46f3,
+    0x452be7c32aef6571, 0x1eb847d548f273cd, 0xd98fc3a657f6924b, 0x536e2cd764f8a1b7, 0xc6512ad983eabf15,
+    0x8d91b52a92fdce81, 0x4ab52fc98ca1fbed, 0x2b3c7a51fce41d5b, 0xac5748d21de62bc7, 0x4ca56e232cea4b35,
+    0xb6dec7a548ed59a1, 0xd49fa51657ce681f, 0xfc45e37ba5e2967b, 0xa6d2ef3cb3d4a5e7, 0x42a7f93ed2e9c465,
+    0xcbf96da1f2ead4c1, 0x2d9634a541bcd23f, 0xeb9243d65fd3129b, 0x5b3c6d487ed64219, 0xf2a9ed676bc83f75,
+    0x915dafc878b95ed1, 0xc12bd7ea97ab6c4f, 0x13df54bed49f6cab, 0x6295bdc1f5d3ab29, 0x94be687213d4ca95,
+    0x47b3a89543b7c8f1, 0xc81be3d541bad76f, 0xdf8649e54e8cf5db, 0x1c832a5baec12649, 0xd687425badc634b5,
+    0x9d63e12febc97523, 0x46e29cbfe7ba628f, 0xcda81463269c71fb, 0x48f7de6324ae8f59, 0xdfb195476492aec5,
+    0x642e813982a6cd43, 0x2ae4b7187186db9f, 0xe8f4d6598e79fa1d, 0x54f9837dcd8e1b79, 0x96a452c1fca139e5,
+    0x94c8fed21db45963, 0x72549f632a9756bf, 0x731cb4d5479a863d, 0x6b5a2147657d84a9, 0x1d38f29ba59fb417,
+    0x314bc87dc5a4d283, 0xfb6d543cb285c1df, 0xbd8543acbc67ef4d, 0x645982d32e6a1fb9, 0xa4cf6e154c8d3e27,
+    0xfe4c86d76c815d93, 0xe2fdba4769735aef, 0xa8364e5cb9857a6d, 0x9e58ab3dc45a78d9, 0x869a75bfe36db947,
+    0xe38714afe26fc7b3, 0x4d9826a32594e731, 0xf79deb643175f48d, 0xef3798465e6814f9, 0x497c815a9e8c2367,
+    0xf926b78a9b7e52d3, 0x37da1cfedc938251, 0x498a76cdc8536f9d, 0xcf6a3bd1f7568e1b, 0x489bfae21549ad87,
+    0x28cef643245cabe3, 0xb5fed498735fdb61, 0xc35169f87152f8bd, 0x5e2134cbaf56193b, 0x2e8197cdce4928a7,
+    0x9438ea6fed6c4815, 0xc28b4a31fb4e5681, 0x78e5f4d32a5174ed, 0x5c6b1e832a64935b, 0x475bfec65846a2c7,
+    0x7c8e2b5a976ac135, 0x2b543fd9834bcf91, 0x83f714b9813ebcfd, 0x839cae6dcf431e6b, 0x53cfad81fe352cd7,
+    0xcd1a67421e293c45, 0x2fa8b9754d3c5ab1, 0x4a123d565a3d692f, 0x945b3c176a31978b, 0x3b9f1a4cb823a6f7,
+    0xd1798c4ed428c675, 0xb875a14fe439c5d1, 0x17eda48fe12bd34f, 0x1936b4d5413ef2ab, 0x1aedfcb87f154329,
+    0x58c1d7698e274195, 0xc17ae2f87b285fe1, 0x62478b19891a6d5f, 0x8d57f13a971e6dcb, 0x5e62b4dfe721ac39,
+    0x7cf286b1f613cba5, 0x47f8eab54627da13, 0x28a149b54319d87f, 0x1e8af356521af6eb, 0xe65caf476dfe1759,
+    0x1ef9c76a9df136c5, 0x4bf6319cbcf57643, 0x7f58bacdcae7639f, 0x987e42dfe7fa831d, 0xc8f95a4326fda179,
+    0x2cf56b1324ce9fd5, 0x5d267e9876f2ce53, 0x3e12a6f762e4dcaf, 0xeb62af7981e7fb2d, 0xd91a73f87feb1c89,
+    0x21468f7a9bcd2af5, 0xd4538791fce15a73, 0x4be963521ad357cf, 0xb97f68c32ae6874d, 0x7cd3f1b436ea85b9,
+    0xd8725ac986edb527, 0x4cdb128985dfc493, 0xe39db65a94b3c2ef, 0x7a6de38cb2c5f16d, 0x3d79584fefc821d9,
+    0x318a9cb21ecb2f37, 0xbc8a54132cbd4ea3, 0xef53b6d76bc37d21, 0x2fa1b45659c36b7d, 0x8ec4761986c57ae9,
+    0x48b21eadc4d9ba57, 0x3e91ab4fe4adb8c3, 0xe45b23afe3bfd841, 0xbdac519213b2f59d, 0xc4351b7653d7261b,
+    0x523a79c65fca2487, 0x49327fa87dab54e3, 0xb86dc94a9cbe7361, 0x9b7284edc9a271bd, 0x7c41d5fed7a48f2b,
+    0x2396a5f1f4b5ae97, 0xe48bf1d21598acf3, 0xa87db3e4349bdc71, 0x8a6f9d45427fe9cd, 0x2e1d3a8982c31a4b,
+    0xe31f82798fa529b7, 0xb358ec7dceba4925, 0xda52643fedac5791, 0x297d3c8fe98c65fd, 0x51d2ec632ca1946b,
+    0xc4ed72832894a3d7, 0xbe3a4d6767a8c245, 0xb49c61287589d2b1, 0x8cd4eba9837ace1f, 0xed16547a916dfe7b,
+    0x25b3f41cbf832de7, 0xc69fd241fe973d65, 0x2a4b95832e785bc1, 0x5ec789a32c7b6a3f, 0x89d37b643a5e689b,
+    0x18a9ce376a72b819, 0xe5a4f16cb693c785, 0x57462bfcb487c6e1, 0xa1e7f35dc279d45f, 0xcb67a93fe16af3cb,
+    0xe14fd276528f1439, 0xb2dae6f76f8342a5, 0x85c392b76e987213, 0xac9d64787b485e6f, 0xd241c3a878496edb,
+    0x4fadb53cb75e8d49, 0x12c67dbfe761acb5, 0x592ae3f1f675db23, 0x7fea63921345d98f, 0x8791ca343248e7fb,
+    0xc3b61d78725d1869, 0x758e43698e4f27d5, 0xfe94582cbe826753, 0xe39f671cbc3564af, 0x3782dbcfeb59842d,
+    0x8274c6b1f74ca289, 0x9fc7b643284da1f5, 0x7c928f654851cf63, 0xbdcae3976543cdbf, 0x6d4ce3598246fc3d,
+    0xd975361cb2481da9, 0x37524afbaf4d3c17, 0x2bf6913dcd2f4b83, 0xd8e4c36feb3258df, 0xafc671b21c24785d,
+    0x5d3c6fb43b2786c9, 0xfd81c2e6592cb637, 0xf7c185a9872ec5a3, 0xd1256e8cb863e521, 0x641e8a5cb534f27d,
+    0x6fb3215ed34712e9, 0x395e48afef2b3157, 0x76ed2ca32e1c4fb3, 0xb3c81d265c2f6e31, 0xf5b481365b126c8d,
+    0x2b8c4ed76a147bf9, 0x14fe628dc918ab67, 0xe364b28dc61ab9d3, 0xa58b312dc62ed951, 0x894d5ebfe421f6ad,
+    0x4efa8d254635172b, 0x24b1c3d763182597, 0xabc932876de945f3, 0x2b74c8d98dfc6471, 0xdfa5c24879fe62cd,
+    0x6e28abfdcaf2914b, 0xfacb637dc6e39fa7, 0x5346f82ed6f7be15, 0x124968a325f9cd81, 0xacdb2f6323f9caed,
+    0x8b679c3542defa5b, 0x175b8c3981f32ac7, 0xfb96c45a9fe74a35, 0xd87fe56cbde958a1, 0xce3472fdcadb671f,
+    0x8e2cd531f9de857b, 0x2d46bea329d1a4e7, 0x2d46a9f329e4c365, 0x2b79cef656e7d3c1, 0xa5c67b2875c9d13f,
+    0x541df2b762caef8b, 0xd3b9481a92bd1ef7, 0x2af76decbfc23e75, 0x48be7531feb65cd1, 0x98e41b621dc86b4f,
+    0x95ec6b1328dc69ab, 0xe27d1b4547ce8a29, 0x469a25d767d1c895, 0x94fd827a96b4c7f1, 0x8d927f6ba3b7d56f,
+    0xac96eb3dc2a8f4db, 0xdab692f1f2cd1549, 0x62a19dc541cf23b5, 0x5cb698e76fc57423, 0xeb9f21454db5618f,
+    0x2c9fd6754a976feb, 0xb14c926767ab8e59, 0x574afc8ba68e9dc5, 0x3da1624fe7a1dc43, 0x5e2b984fe483da9f,
+    0x74bd5af324a6f91d, 0xbed6ca7543cb1a79, 0x1963d52761ac28e5, 0xcea6f3487eaf4863, 0x516d2e798d9265bf,
+    0x8b1534acbca6853d, 0x6387b1dfecb783a9, 0xd47be8c1f89cb317, 0x2fb7e643279ec183, 0x982a5b643571becf,
+    0x9a32e4c76583fe4d, 0xd9eca74873861eb9, 0xd8a2793cb19a3d27, 0x364dc2ebaf7d4c93, 0x1a39dcebab6d49ef,
+    0x3c6275a1fc82796d, 0x3d6e1b721c6487d9, 0x2a7f48132c69b847, 0x1d326c75487ac6b3, 0x95b2ec3a978ed631,
+    0xf31e2c8ba571f38d, 0x6baf579dc48513f9, 0x8a6935cfe1a93267, 0x35cd72afef7a51d3, 0x24ad1f932e7c6f41,
+    0xf896a2732b4f5e9d, 0xbf312da65c638d1b, 0x3d4b1f276b54ac87, 0x24b79d5a9857bae3, 0x9ac4b86dc75bda61,
+    0x521ead4ba34ce7bd, 0x649fc581f572183b, 0xd17fa9b2138426a7, 0x12a43d8762894715, 0x213657a87f4b6581,
+    0x14edfab87c4b63ed, 0x8b6d724a9c4f825b, 0xdf94a71edb53a1c7, 0x2f7a9cded946bf25, 0xa29bc361f647ce91,
+    0xbdaf63521538cbfd, 0x8915e7c3243dfc6b, 0xab2468d984512bd7, 0x67ec532ba1763b45, 0x81dcae4baf3759b1,
+    0x35217facbd3a682f, 0x529de14fec2d768b, 0xadc5b28eda2e95f7, 0x451eb7a21b32c475, 0xe7d495165936c4d1,
+    0x6e1cf5a76738d24f, 0xdfac52487539f1ab, 0x32f5de4cb65e3129, 0x74915fedc2413f85, 0x2a3fb94cbf245de1,
+    0x9d7512efed176c5f, 0xbcf65a932e186acb, 0x469a2ef54c1d8b39, 0x893271f5481fb9a5, 0x6478fb398a24d913,
+    0x579e36dba814d67f, 0xef73da4ba417f5eb, 0xba5142efe42c1659, 0x9ab68f41f31e24c5, 0x8e3bfdc986217543,
+    0x6bdc27a54de3629f, 0xac3971e65cf6821d, 0x713bd9a54be78f69, 0xc9a8125767fa9ed5, 0x75864bda97febd53,
+    0xc21bdf6a95e1dbaf, 0x9e4f3b1dc5e4fa2d, 0xb5469ae324f61b89, 0xf31e4c6543ea29f5, 0x4e8612b761fd4973,
+    0xc8fb39265dbe46cf, 0xf6d37e4a9ce2864d, 0x3f8521abace584b9, 0x3a5fd48edae9b427, 0x4a7f5231f7ebc293,
+    0xafe1bd5326acb1ef, 0xb719d3f436b1ef5d, 0x2f4d536765d41fc9, 0x1c89734a94d82e37, 0x82f15a3981e94da3,
+    0x7bd8f53a9fbd6c21, 0x4cfb7d2a9cbf5a7d, 0xd682be91fbc278e9, 0xf95167b21cd4b957, 0xc8b6972329d8b7c3,
+    0x4981eb7658cbd741, 0xcf24391765ace49d, 0x61a9fd4ba7d3251b, 0xce9ba81dc4d52387, 0x23b75aced1c852e3,
+    0xce4ab56fefcb7261, 0x635f47821e8b5fad, 0x16795cf43c9f7e2b, 0xcd89b1354cb2ad97, 0xb593dce76895abf3,
+    0xf64e19da96a8db71, 0xd5f721aba479e8cd, 0x8f46ac2dc39df84b, 0x352de681f4c128b7, 0xa716dcb213c64825,
+    0xbf81e26542c85691, 0xad36f8943e8964fd, 0x5efb79265e9d836b, 0xb9d21fa76b8f92d7, 0x253af49edba3c145,
+    0x8c61fd2ed785cfa1, 0xa3ec4b2fe587cd1f, 0x65b719421469fd7b, 0xfa57edb4348d1ce7, 0x4ebd287984a13c65,
+    0x865a3cd982945ac1, 0xf48e931bae87693f, 0x45e7892dce5a679b, 0x36bce24fec6da719, 0x617934dfea7fb685,
+    0xfe1b7d232a83c5e1, 0x4c2eda832986d35f, 0x2a7cd6f54567f2cb, 0xc5e9d8aba68c1239, 0xa8e1476cb48e31a5,
+    0x7a45e93cb3825ef1, 0x32b795fcbe735d6f, 0xe352a871fe456cdb, 0xfae7b5321e5a8c49, 0x457c6f932c4d9ab5,
+    0x7b1c3856596fca23, 0x8ca694b76952d78f, 0xc37fd48a9754e6fb, 0x8d94bcfed45a1769, 0xa8c9e23fe37b26d5,
+    0x7e9d5a41f18e4653, 0xf67148e5427163af, 0x1a96cf854f65832d, 0x89b42c165e46a189, 0x6923bda76b389fe5,
+    0x6b1fc789894cbe63, 0x1afc3549863eacbf, 0x5e6a8c1dc752fb3d, 0xab9dc761f6451ca9, 0xfac6d1b326593b17,
+    0x613cfae7625c4a83, 0x64dbc8e7613c47df, 0xf47e8c6a9f31875d, 0xc8efd57bae2385c9, 0x1e643cbdcd28b537,
+    0x86ce4bafeb29c4a3, 0x5a6cef71f95cd421, 0x67a5fe83283fe17d, 0x3a6f8927685421e9, 0xb6d78e5a98362f47,
+    0x5d9713ca95284eb3, 0x892de45ba24b6d31, 0x31e57fda9f1e5b8d, 0x6a3c4efdcd217af9, 0x5f4e9761fd13ba67,
+    0xc1ad89432c16b8d3, 0xa294f1d54b2ad851, 0x6a7341e5471be5ad, 0xca73edb9871ef52b, 0xe6a1bc3dc8132497,
+    0xab8972edc61754f3, 0xb475acdfe42a6371, 0x3fe8b76cbef961cd, 0x4f8bae521dec7f3b, 0x6cfd9b432bdf8ea7,
+    0x4b28e6d76af3bd15, 0x2c5a4de769f5dc81, 0x1723fb4875f6c9ed, 0x8714c26984eaf95b, 0x5dbfa61cb4fe19c7,
+    0x1489cdefe6f14935, 0x418627e323f457a1, 0x2be9f14542e8761f, 0x1e23db843fea847b, 0x1754afd65bdc93e7,
+    0x528afd498adfb265, 0xc9153aeba9e4d2c1, 0x5f6ec39ba7b5ce2f, 0x8fb54c2ed4c6fe8b, 0x26d7e18325ca1df7,
+    0x36bdc82434ce2d75, 0xf2ae953874e25bd1, 0xc4fe16b981d36a4f, 0x14dba9e87fd568ab, 0x3ed4bf287edba829,
+    0xb8135e7feacdb795, 0xa2d6198ed8aeb6f1, 0x1843abc219b2d46f, 0x1db89f2327a5f3db, 0xe2b1864767da1349,
+    0x7bc5a34986dc32b5, 0x3f1aec7ba5ce6123, 0xc2f7693ba2b15e7f, 0x81de672baf936deb, 0xc8a6f5e1feb68d59,
+    0xfc5439721ea89bc5, 0x162894e32a9dcb43, 0x781cb364367ec89f, 0x835cbd9767a3f81d, 0x9b128a4cb6c51879,
+    0x58632a4dc4b927e5, 0xc6e7d48fe2bc4763, 0x215684dfe19d54bf, 0x4c19872652b1843d, 0x82c91b543fb482a9,
+    0x91b842f65ea8b217, 0x3a2edb565c89bf73, 0x782f35e65769adcf, 0x9263f7da967fec4d, 0xe5d6784fe6831db9,
+    0x4a265ec1f5a63c27, 0xfdb953c215a84b93, 0xa7ce31d4327a48ef, 0x39fce285419e586d, 0x835ae9d65f7186d9,
+    0xf59c67dbae93b647, 0xc549d86bad87c5b3, 0x2be49a8feb8ad531, 0xf6eb8ad1f76be28d, 0x7498ea53276de1f9,
+    0x732db94659a43167, 0x4b7fc95875864fc3, 0x4c9f53aba3896e41, 0x56af7dc9816a5c9d, 0x8c316dba9f5e7c1b,
+    0x2175f46ede51ab87, 0xbe84f271fc64b9e3, 0x164758e32c57d961, 0xa87ec4d32948e6bd, 0x468ce9d5485cf63b,
+    0x8375b1ea986f15a7, 0xb9567fcdc8934615, 0x6bda752ed3976481, 0x2acb57fdc15862ed, 0xac5e498fef4c815b,
+    0xbd95f8621e3d8fb7, 0xe2713dc54d61be25, 0xe9a8d2576b54cd91, 0x261d3c976835cafd, 0xbde5216a9738fa6b,
+    0xbf8a791cb64c1ad7, 0x4b659d3ed76f2a45, 0x6cdb35e1f46358b1, 0x5194dab21345672f, 0x4d98ec654139758b,
+    0xd8521f365e2b94f7, 0x2d817ef98d2eb375, 0x4b89c27a9b52c3d1, 0xf9a1be4cba35d14f, 0xb2419e7dc725ef9b,
+    0x7ab1958fe74a2f19, 0xd41b8f72173c2e85, 0xa47db526563f4ce1, 0x35a2fce984326b5f, 0xc8725169812469cb,
+    0x8a3eb56cbf178a39, 0x98d72e1a9e1cb8a5, 0x1847fcaedb2ec813, 0xce15769fea21d57f, 0xd8294bc32913f4eb,
+    0x35b6f9a76b281459, 0x9afeb258781a23c5, 0x1a6c347ba81d6243, 0x1ef64c9ba42e519f, 0xe381924ba3126efb,
+    0xb95a271cbdf38e69, 0x95e146bfebf69cd5, 0xf4e3ab721df9bc53, 0x6fc8b75327ebc9af, 0x96c48bf547cfe92d,
+    0x5b3e62c767f31a89, 0x3a861dfba7e628f5, 0xcb7e352dc5fa4873, 0xf8e653dcb2ea45cf, 0x74eb6cfdc1fe754d,
+    0x68af2c1542f183b9, 0x8c2934f54fe5b327, 0xdbfe29765de7c193, 0x6b7cdfe548b7aedf, 0x3d2519c767bace5d,
+    0x76dae92875aefdc9, 0xe49783cdc8e42d37, 0x8495ea61f5e64ca3, 0x3ac895f435e96b21, 0x76139ea432eb597d,
+    0x368c2b1541cd67e9, 0x9bd38c276fd1b857, 0x527e86b98ed4b6c3, 0xcd1ef38babc8d641, 0xc4f5368dc7b8e39d,
+    0x1db648efe7acf31b, 0xc29ea67439cf1287, 0xe148acb768c451e3, 0xc4a12f5984c76f51, 0x9615dac762b75ead,
+    0x7a14fdb981ca7d2b, 0x641af2576fae8c97, 0xe84567fdcd91baf3, 0xf75e6d91fcb4da71, 0x39fa51821a95e7cd,
+    0x68cafd7328a9f74b, 0x418ca3e548ad16b7, 0xd27e489a98bf3725, 0xf76d8b4cb7c36591, 0x758bef4cb2a563fd,
+    0x7a1593cfe1c9826b, 0x71354e2fef8b91d7, 0x718fe6421e8daf35, 0xc3478fb54d82cea1, 0x94c28af65a84dc1f,
+    0xa3f8dbe54985fc7b, 0x1c6ae7dba6891be7, 0xc73ba95dc79d2b65, 0x65d284aed58f49c1, 0x1b27e3afe4a2683f,
+    0xbc1367a212a4769b, 0x81d7a23542b8a619, 0xcf2379a43f7cb485, 0xce83b2476c7db4e1, 0x6e7395da9b81d25f,
+    0xd59cfe2ba974f1cb, 0xab7d28efeba82139, 0xec58dbafe67a2f95, 0x2ef41783267b4df1, 0x18b7f563237e4c6f,
+    0x71feb34653726adb, 0x3d2e681ba1758b49, 0x2e4b61798f47a9b5, 0x8ea1dc4bae6bc923, 0x392ab15cba4dc68f,
+    0x48c52f6ed961e5fb, 0x6cdefb432c841569, 0xc5df1b243a7824d5, 0xfb56c938798b6453, 0xc37dfe49846c52af,
+    0x629c147ba46f712d, 0x5f62b9cdc1528f79, 0xd36a192cbf349de5, 0xb7236951fe48bd63, 0x6c3a5f421d38cabf,
+    0xa9e625f3294cea3d, 0xe6a541876c521ba9, 0x34c71f6a9b653a17, 0xa4eb738dca574983, 0x8d9273acb53946df,
+    0xa97c43bfe23c765d, 0x8172439fe13f74c9, 0x249acb365162b437, 0x4a9275365f46c2a3, 0x72fc15e87e59d321,
+    0xeba825465a29cf6d, 0xd913c4f7672bfed9, 0x128e49fdca512e47, 0x528b3aefe8254db3, 0x5b4fe6a1f7486c31,
+    0xf6d4acb214295a8d, 0xb9c76de5432c68f9, 0x3f7e85d6512fa967, 0xa42cf8398f12b7d3, 0xaf52cdebae26d751,
+    0x7ec218fa9b17e4ad, 0x412365ced91af42b, 0xea6b3581fa2e1397, 0xf19c34b76a4152f3, 0x4dcfbe598a356271,
+    0x39b2165874165fbd, 0xbd45cf3984197e3b, 0x361829fa921c8da7, 0xdf6e32a98dfeac15, 0x1765a9dbacf2db81,
+    0x15f28adcb9f3c8ed, 0xe31784b21ae6f85b, 0x3b1987e439fa18c7, 0xa38b6c5769fd2835, 0xec78a31987ef46a1,
+    0x2ec365dba6e3751f, 0xfa2519bdc2f5837b, 0x9e41a56dc1f892e7, 0x261bf97edfecb165, 0x9c481a232ecdafb1,
+    0x4316e9d54ab1cd2f, 0x967b8ed549c3fd8b, 0x234c1bf659d61cf7, 0xd93ecf8a98ea2c75, 0x3d6279ba96ec4ad1,
+    0x6a1b832cb3ce594f, 0x5edc7961f3e267ab, 0xc3da6e4213e5a729, 0xf5a27ce431e8b695, 0x93fba1c54ecab5f1,
+    0x43cead765badc36f, 0xb5743d1879a1f2db, 0x3682fcadcbd61249, 0xd482917fe9d831b5, 0x24b5e89fe7ca5f13,
+    0xcf456be215ab4d7f, 0x68e4bd73239f5ceb, 0x5d924bf763d28c59, 0xdb3ce5a871d49ac5, 0x27eacb687fb8ca43,
+    0x93d8ac676d8ac79f, 0x6fde5b2cba9ce71d, 0x3c5d8721fbc21679, 0xe4d6b9a21ab426e5, 0x24b1a5632ac94563,
+    0x7a813c6546a953bf, 0x71c5a48985ac723d, 0xc1e68a7983bf71a9, 0x8149fedcb1a29ef5, 0x3b1289fdcf95be73,
+    0x96d8c14fed76abcf, 0xd753e9c21c79eb4d, 0x4fb6e273286dfab9, 0x49f6cd876ca13b27, 0xf45ade7878b54a93,
+    0x6c19258ba59647ef, 0xf769a8edc39a576d, 0xd7125a3fe28c75d9, 0x14c57e6fe19fa547, 0x7eb81ca65192c4b3,
+    0x712ec4865f97d431, 0x4ba2f6154c67e18d, 0xc2abe7954a58dfe9, 0xc9e3d54a9a8d1f57, 0xb19a53fcb9814ec3,
+    0x3a6851efe8956d41, 0xfae95b61f3765b9d, 0x48e5fad324697a1b, 0xc36ed7f4325d9a87, 0xb4f3dc96516fa8e3,
+    0x4d8f976a9f73d861, 0xfe1ab6898c64e5bd, 0xe2ac517bac68f53b, 0x5c18e2dfeb6c14a7, 0xd658c9f1fa8e3415,
+    0xc6e18d454b926381, 0xef3ac924387461ed, 0xa27648d983567f4b, 0x6e1d538762498eb7, 0x14fd398a916cad25,
+    0x1fce28b98e4fbc91, 0x61834acbab42c9fd, 0x4b68ec3fec34f96b, 0x9e5f4c232c4819d7, 0x5269bef43b6c2945,
+    0x6c42e5b7695e47b1, 0x4af826dba951762f, 0xfa73542dc653748b, 0x2e754b3dc24693f7, 0xa28be79fe14ab275,
+    0xb8341e6fef4cb2d1, 0xb6c4fe121c2dbe3f, 0xfe82ac954c32fe9b, 0x6c94b3187c462e19, 0xbdf53ac87b392d85,
+    0xd321685a983a4be1, 0x7146ef8cb72d4a5f, 0xdca345bfe53168cb, 0x5bc3d4a1f524a839, 0x8e35d4721326b7a5,
+    0x645b1397624ac713, 0xa25d14e65e1bc47f, 0x94fce6b76a1fd3eb, 0x84192e7cbd241359, 0x251c486edb1732c5,
+    0x971385bfeb2a6143, 0xbcf25d8ed61a4e8f, 0xb57e1df3261c5dfb, 0xe6f1798545218d69, 0xe7ad643874139bd5,
+    0x5c9378ba9217cb53, 0x4eb271865de6c8af, 0x7a3e29b87bfae82d, 0x9742debcbaedf689, 0x18675a9edae127f5,
+    0x3d8f9c721bf54673, 0x71e2a6f328e754cf, 0x3af24b9656fa734d, 0x45829b3764fd72b9, 0x48569fca94efa127,
+    0xf4e85acba1e2bf83, 0xdb37c5a98eb4acdf, 0x2836ebf1fab7ec5d, 0xaf9ce1521ad8fbc9, 0x128eab354ade1c37,
+    0xc865ad2769e14ba3, 0xbca5f78989e56a21, 0xcd76842ba4e6587d, 0x64892bfcb3da76e9, 0xc36152bdc2eda657,
+    0x7139a58fe1dfa5c3, 0xe18495a762e3d541, 0x6927ed543fb5e29d, 0xbe3819f65dc8f21b, 0xa5963fd76bdc2187,
+    0x35fd97b878ac2fd3, 0x7689d1fcb9c26e51, 0xbca8347fe6b35cad, 0xd58ae271f4d67c2b, 0x5b34de1213da8b97,
+    0x6e4dc93542bca9f3, 0xd2f18c5652bfc971, 0xabd94e565f92e6cd, 0xb64de8798da5f64b, 0xe495df2badc915b7,
+    0xd39be52feabc3625, 0x6de47cb1f8be5491, 0xab5e6f7438a162fd, 0x97bc8e1437c4816b, 0xde7896a543a58fc7,
+    0x95c1deb872b9ae35, 0x4256cfe8728cbda1, 0xf8e5c2d98d7ecb1f, 0xc4815b7dcd82fa7b, 0xf62a9b71fc951ae7,
+    0xa68513e21db92a65, 0x3b7219543a9b48c1, 0xa926b7e5489d573f, 0x481cfb2986a1759b, 0xe94b1c5dc6b4a519,
+    0xd2a7134ed2a7b385, 0xb5d3ca6ed289b3e1, 0xac9b528ede7bc15f, 0xfb936e521c5edfab, 0x9cab15e65d841f29,
+    0x61e92d354c862e95, 0x1fe84cb76a784cf1, 0xcf9e6d5a987a4b6f, 0xe2817cfba46e59db, 0xe854a71fe5718a49,
+    0x6fd23951f273a8b5, 0x583f1e421497c823, 0xdbe1c3a43169c58f, 0x36cfea243e5ad4fb, 0xd6a73ec87c5ef369,
+    0x327ad46bac8423d5, 0x5c4b921edc986253, 0x216a49bed96851af, 0xb6dc81efe75a6f1d, 0x9cf63ea2154d6e79,
+    0xa198cf5434619ce5, 0x6d8ec1798274bc63, 0xc471a3687145c9bf, 0x6d71e5a87f48e93d, 0x83b1c6598d3cf7a9,
+    0xc5fd8b7edc5f2917, 0xfe295d61fc624783, 0xcaf714e21a3645df, 0x1d59b8e32a39745d, 0x854ea726564b73c9,
+    0x32d9c56a965ea237, 0x8791ae6cb562c1a3, 0xc2e5f74a9143adef, 0xc3df284baf25ce6d, 0x7a15982feb27fcd9,
+    0x9bae81432e3c1d47, 0xabfe4d165a4f2cb3, 0x278db4a98c546b31, 0x714f69a87a24598d, 0x25768fecb52867f9,
+    0xbc31fd9ed42ca867, 0x312c765dc42ea6d3, 0xb2853ae1f342d651, 0x713f98e65124e3ad, 0x473ed5265e17f32b,
+    0x6c3452876e3b1297, 0xac6f73598b2c41f3, 0x5dfe7b1a9a2e4f61, 0x9efc547ba8125ebd, 0x5d7b9a6fe8157d3b,
+    0x35927cf1f4168ca7, 0x368297c4362cab15, 0x51498d76542eca81, 0x659bdc876321c7ed, 0xf6a82c976de2f75b,
+    0x5b36941a9df516c7, 0x92d1b4fcbcfa2735, 0xd69b31fed9fc45a1, 0xbe743a6dc8ed641f, 0x76b21dc439f1827b,
+    0x51cde63436f491e7, 0x4bce938763e7af45, 0x1c456d3763f8aeb1, 0xadf1c7b871eabc2f, 0x6b39e8f76dafec8b,
+    0xc5918f6bacd31bf7, 0xbc4da5e1fce62b75, 0x98fcd1532be849d1, 0xad547ec329db584f, 0xd68cae1437de56ab,
+    0xa8becd7987e1a629, 0xe2936adba6e3b495, 0xc62175dba3d7b4f1, 0x267da89cb1d9c26f, 0x9c287badcf9ae1db,
+    0x13dc45a21cadef39, 0xafec41254dc32fa5, 0xbc3d45a76bc75e13, 0xc5a9284659b84c7f, 0xa61cdeb876c95aeb,
+    0x3a75c8dba4ce7b59, 0xe98a1d6fe4d1a9c5, 0xfde498b1f2d5c943, 0xb3f7968212b5c69f, 0x923f4be542b9e61d,
+    0xfe627bd43eacf479, 0xd67941b87caf14e5, 0x1e7c9f2badc25463, 0x1574928dc9a652bf, 0x6cda8e7fe8b9713d,
+    0xb27a41dfe4ab6f89, 0xbd5aec32149c8df5, 0xfe81b6d545a1bd73, 0x8d34b5165283bacf, 0xd5947fb87196ea4d,
+    0x9da327e65e67f8b9, 0xba52413cbe9d1a27, 0x65db2a9edcaf2893, 0xdab39f1eda9246ef, 0x13fe86d21ba4756d,
+    0x7951e84326a874d9, 0x87cafed6569ca347, 0x943abe18758ea2b3, 0xe293a8bcb6a4d231, 0xa7425f8ba183cf7d,
+    0x29da73cbac65fde9, 0xd4a693e1fd8a1e57, 0xd4cb1f321e7b2dc3, 0xb619eda43b8f5c41, 0x28d36c154b725a9d,
+    0xb963da176a85791b, 0x9c637eadc456a987, 0x9f37154dc46ba7e3, 0x75db341ed38ec761, 0x78fbc351f271e4bd,
+    0x9a4c2db32185f43b, 0xbfd296a54f6813a7, 0xd4325c687e8b4315, 0xd6b15c8a9c7d5281, 0x25d61978785e4fcd,
+    0x61298c5dc9627e4b, 0x659748bfe6548db7, 0x42de83b1f468ac25, 0xf52abd83245acb91, 0xa1783ef4324cb8fd,
+    0x4c2a6b387251f86b, 0x83f769da9f5418d7, 0x9f25d14cbe692845, 0x6c5bf87dcd5a46b1, 0x243af8ceda4c652f,
+    0xe3b145dfe94f638b, 0xd694b1a21a5392f7, 0x6cb259843946b175, 0x84bdcea76547afc1, 0x56dce7f87249bd3f,
+    0xd29475a8713ced9b, 0x4dfb893cbf532d19, 0xa1b2c6dede342c85, 0x7c93a8e1fc374ae1, 0x5ad963f21c2a495f,
+    0x97ac8634392d57cb, 0xa8d751965a2f8739, 0xed65938a9832b6a5, 0xb4379a6cb847c613, 0x9f3e618cb428c37f,
+    0x2371564dc139d2eb, 0x73b429adce2df159, 0x3c42ea176f4231c5, 0xb46d29a87d165f23, 0x5974cbf65b164d8f,
+    0x3bda52c769185cfb, 0xf283d71ba81d7c69, 0xade6987cb61f8ad5, 0x5198236fe712ca53, 0xb946e78fe314c7af,
+    0x8b6c12a43418e72d, 0xb9861c35421bf589, 0xd627e9354dec16f5, 0xb127acf98cef2573, 0xa41fc2b98ae253cf,
+    0xfa4532bcbaf6724d, 0x837cd62ed6f871b9, 0x73b629ced5eb9f17, 0xbf597de215fdae83, 0x8fb7596434e1abdf,
+    0xb2acd84762f3eb5d, 0xed631cf761e5fac9, 0x21c47e898fea1b37, 0x67a8ef298ced29a3, 0x79ecf16dcbdf5921,
+    0xd4ab2781fae2567d, 0x5fe43cb21ad475e9, 0x2daf68e328e9a457, 0xac3487b656eba4c3, 0x5dc3bef986dec341,
+    0x5f7dc86984c2e19d, 0xbda7362981b3def9, 0xf31adbecbec81f67, 0x7ed832a1fcb92ed3, 0xca7f8ed32ebc4d51,
+    0x5984f6c3289f4bad, 0x48d2e7f659d37a2b, 0x2bd574e656d48a97, 0x9b432c8a95c7a8f3, 0x6a9ef81ba4dbc871,
+    0xc124a78ba29eb5cd, 0x1a7de62fe2c1f54b, 0xb27f953432d514b7, 0xec4691a76fc93425, 0x9d5ab6876ecb5391,
+    0x291c5d676a9b51fd, 0xc293f4d8789e6f5b, 0x42df6b3cb6a28ec7, 0xa4395b7fe7b6ad35, 0xc42d68a1f497bca1,
+    0x56e7db132489ca1f, 0x59387e24328de97b, 0x813dfec763b219e7, 0xfd1734298fb42965, 0x8965b72a9ea847c1,
+    0x41f95a6cbc9a563f, 0xacb2345fea8d649b, 0x296d5a4fe7af8419, 0xe6f19c7219a3b285, 0x83df14c54796b2e1,
+    0x38fe17d65387be4f, 0x7cf95e365268deab, 0xf6b14e29817cfd29, 0x9b1f73acbf812d95, 0xb625f84dcd854bf1,
+    0x65c9a7dfec874a6f, 0x3e45af621c6958db, 0x26dfa1c32b6d7849, 0x2f5e9714386f97b5, 0x7e64ca8ba894c723,
+    0x5ace638ba375c48f, 0xa642c83ba267d3fb, 0x76ab943ed17bf269, 0xc293aefdcf7e12d5, 0x76e4d1254f926153,
+    0xaef658b32c634e9f, 0x3967bdc54b576e1d, 0xa13b4e765b4a6d79, 0xd94b5c2a974c8be5, 0x8e2f1b5dc75fab63,
+    0xd572149ed452c8bf, 0xb7ead461f265e83d, 0x9de165321247f6a9, 0xc58d9246536c2817, 0x6f4ceda87f5e2683,
+    0x586dcae98c6154df, 0x3e69a1cbac64735d, 0x7416df9edb4672c9, 0x21e8dbcfe95ba137, 0x1c6a384fe64caf93,
+    0x89b61752153d9cef, 0x19a63d743542ec6d, 0x61fedb276234fbd9, 0xf15ec63ba2591c47, 0x75bca8498f4c2ab3,
+    0xf481d2bcbd4e5a31, 0xe428a56fec31578d, 0x6d8c5befeb2376f9, 0x74fa8c321c28a567, 0x32afcd454829a5d3,
+    0xcaf65d38783dc451, 0x57ed6cb8753fc2ad, 0x689fa3dba654f12b, 0x9cb8f56ed3462197, 0xb3e45afcbd182fe3,
+    0x64a8bcd1fd2b4e61, 0xf546bc732a1e4cbd, 0x4a7bcd165d217c3b, 0xab3429d65c138ba7, 0xf81b5a498927ba15,
+    0x3b845f7cb62ac981, 0x8fe4579a941ab6ed, 0x1a2e78cdc31fe65b, 0x8c245b71f42315c7, 0x4ce5372874182635,
+    0xd72eabc43ef854a1, 0xe742afc65cea631f, 0xd8417c365afd617b, 0x27c9e3f658ce6fd7, 0x271b3a4cb8f2ae45,
+    0x849c5f1dc6f5adb1, 0x5473bafed4e7cb2f, 0x1d498f3213f9ea8b, 0xda19fb8432dce9f7, 0x73ab518983f12a75,
+    0x16eabd987fe548d1, 0x2c5e7b6a9cd8574f, 0x86b2af398ce965ab, 0xeab5643dcaed8529, 0x7eadc58fe7dfa395,
+    0x4df6c2e328d4b3f1, 0x31e2a5d437d5c16f, 0xf97dc3e543a6dfcb, 0x8b1945d762cafe39, 0x6bc1e72982cd1ea5,
+    0x4a6ced7bafc25d13, 0xc1daf53badc34b7f, 0xf3de5ac1fac659eb, 0x6cd437e21cdb7a59, 0x629bf71327bd98c5,
+    0x941358a657cfb843, 0x4acb73f876b2c59f, 0x7f49e3ba94b6e51d, 0xab459f7cb2c8f379, 0xb395f76ed2cb13e5,
+    0xc9da856edfbe4263, 0x38aec7d43ea251bf, 0x6b98a3d43ca46f2d, 0xe8c5f6b43cb56e89, 0xd2ec1bf547a98cf5,
+    0x4ab8d539869dac73, 0x17def469847ea9cf, 0x4cae563dc5a2e94d, 0xa695d14fe2a4f7b9, 0x895f26c434ca1927,
+    0xdaf927b651bc2793, 0x291e8bd54d8c35ef, 0x8fb13dc98ea1746d, 0xf2438e698ca473d9, 0xbc7a149edcb8a247,
+    0xa8d3476fe789a1b3, 0x5647eabfe68cbf21, 0x6357b892146fbe7d, 0xecb56a943472fce9, 0x21746ed983a61d57,
+    0x6bd12c9871982bc3, 0x8197f53a9f8c5b41, 0x6d43a78bac6e489d, 0xe784516fed92781b, 0x2fb3da61fc93a687,
+    0xd5ba13e21b87a6e3, 0xbe369f14398ac561, 0xa91e83c5456ac3bd, 0x2145b689857fe23b, 0xfe26817dc59412a7,
+    0xcb4f298ed3a84215, 0x192fe4adce694f71, 0x5283e671fb594ecd, 0x4fc679821c5e6d4b, 0xfc9d5b343d518cb7,
+    0x6ed932a76c74ab25, 0xe3bd62187856ca91, 0xe1743c2a9548b7fd, 0xfe74965ba34ce76b, 0x79e2d31cb24ef5d7,
+    0x85b7fa21f1932745, 0x916afc74328745b1, 0x581236943e59642f, 0x3527d9165e4c628b, 0xcb9f1d676b4d81f7,
+    0x4523fd9a9b41af65, 0xf49bd28cb854aec1, 0xc1235a9ed746bc3f, 0x6dbe7c31f437ec9b, 0xc1f7da53254cfb19,
+    0xa5ecb1f7634f1b85, 0xa6e5d1c9826349e1, 0x3f7ed24a9e26485f, 0xd6935e2a9e2856cb, 0x96fe7a8cbd2c8639,
+    0x9b53d46edb2e94a5, 0xde38ac51fa62c513, 0x645df8721934c27f, 0x4a6279e54736d1eb, 0xf6e9bd376528ef49,
+    0xd52143c9843c1fb5, 0xc39fea4ba15f4e23, 0x321f56dbae124c8f, 0xb5e6124dcd145afb, 0x95bf8361fd187b69,
+    0x5dfae8932c1b89d5, 0xd17439f54a1eb953, 0xc53ea1865821c6af, 0x7c2841ea9814e62d, 0x2b6e91dcb516f489,
+    0xb5a97e3dc62a14f5, 0x2b845a7fe51d2473, 0xac6d7f9babed42cf, 0xf27963d43ef2714d, 0xf16d5a832ce36fa9,
+    0x91e6c7b54bf69e17, 0x2b3fcd1657f9ad83, 0x93e45ab765eb9adf, 0x2ecba3f984efca5d, 0xefd5a23cb4e2f8c9,
+    0xb912ca3fe4f61a37, 0xbf61c54214f928a3, 0x9f263be763fc5821, 0xacf129743fce457d, 0xaf3b2ed76cd174e9,
+    0x21f7589a9ce4a357, 0x43fd85acb9e7a2c3, 0xbf42573ed8eac241, 0x9b754d3fe4cabf8d, 0x8fa469d214aecdf9,
+    0x823cfe6545d31e67, 0x2f9c751874e62cd3, 0x21e85af982e94c51, 0x5b4a2d676fcb49ad, 0x874a1de98dce692b,
+    0xb297acefecd1a897, 0xcea14d2fe9c4a7f3, 0xa489d2e32ad8c671, 0x65a814c326a8b4cd, 0x2ae8c91656ace34b,
+    0xba489f6764aef2b7, 0x7a5de63cb7d64325, 0xe15823cdc3d75291, 0x8653712bac974fed, 0x5a64b8d1fd9a6e5b,
+    0x87cadf521b9e6dc7, 0x3b9fd1854db1ac35, 0x45b9f3e65894cba1, 0x2879bf4657a6c91f, 0x5b8432c764a9e87b,
+    0x6a8179eba39bf6e7, 0x68ac41bed3bf1865, 0x6deb45f1f2b346c1, 0xa5f1974321b7653f, 0x425a1f932fa8639b,
+    0xba78e5265eac8319, 0xeafc38176c9ea185, 0x5c294bf87982afd1, 0xde73fc1ba783bd4f, 0x41689a5dc475edab,
+    0x2897b51fe478fc29, 0x2694eca3248d1c95, 0xe4b158c6548e3af1, 0xeac3f24871a2496f, 0x29856e176f8457db,
+    0x738256dcbe6a8749, 0x4c86f2abad7c96b5, 0x837f6baeda8eb623, 0xab763e9fe971c38f, 0x816cd3721874d2fb,
+    0xc63e18b43587f169, 0xfa176d58768a21d5, 0x9437ed2a958c2f43, 0x84cb3d79816e3d9f, 0xd4c739ebaf736c1d,
+    0xba91f75ede546c79, 0xc794a5d1fc478ae5, 0x9b54f1321d5cba63, 0x65eab423284da7bf, 0x48e93a265961e73d,
+    0xc76b31f98763f5a9, 0xa8215fbdc5892617, 0x42c5df1ed47b2583, 0x154286fdc16b43df, 0x812c465dce4f625d,
+    0x54678b932f5371c9, 0x8c6f19b43d459f27, 0xc12a4d565c47ae93, 0xbdc1e94657389bef, 0xfb167e39873ecb6d,
+    0x8b63fe4cb641fad9, 0xdc931aefe8651b47, 0x2fbe3c81f45729b3, 0x15bf76e3246b5931, 0xef2975c6513c468d,
+    0xdb7612f54d2e65f9, 0x538bdcfa9e32a467, 0x589fd74a9c26a4d3, 0x245af98edb49c351, 0x42615edfe739c1ad,
+    0x8cde76afe63cdf1b, 0xf9821ac439421f87, 0xf963aeb767452de3, 0xc862913a95384d61, 0xbe45c21871284abd,
+    0xa8d62b498f1d6a3b, 0x185943bcbd1f69a7, 0x6e25d93fed23b915, 0xf4e86971fb25c781, 0x5d9e41f32917b5ed,
+    0xb23c9ef4381ae45b, 0x58d24f36561df3c7, 0xdae2967cb9612435, 0xf7641c8dc72653a1, 0xf85b2c4dc438621f,
+    0xd64e923bade85f6b, 0x6c798f4dcbfa6ed7, 0x34c7f6921bfe9d45, 0xc7e6f9b549f2acb1, 0x392d714658e4ca2f,
+    0x3df6e48546f5e98b, 0x4f1de8c764d9e8f7, 0x2b643e9cb4fd1975, 0x7a986fbcb4ef37d1, 0x83bf761ed1e2564f,
+    0xd7c8245321f564ab, 0x92adf6143fea8429, 0xda9481354deca295, 0xf2edca1769cda2f1, 0x192e65c878c1be5f,
+    0x8ade3fc986a3decb, 0x8e9671fcb5c6fd39, 0x5bdf3421f4e91da5, 0x67d9eab326ed4c13, 0xedcf6a3542ce3a7f,
+    0xb5efa84761d258eb, 0xc24aefb76fd47859, 0x8e4da5276ed897c5, 0xc38e175a9adcb743, 0x2a518c9dc7adb49f,
+    0xa9d8f3c1f8b2e41d, 0x9f1d5c8218c4f279, 0x7b12fea547c812e5, 0x8e71fb2987db4163, 0xd91625c7629b3eaf,
+    0xc3a7614981af5e2d, 0xe862f15bafb26d89, 0x8efc16adcda48bf5, 0xed597431fdc8ab73, 0xc4f968121b79a8cf,
+    0xc71d24f3279ec84d, 0x69f8cbe547a1f6b9, 0x4a85196ba9c51827, 0x194fe37cb5c82693, 0x52b4e36cb2a934ef,
+    0x8291c5bfe1ac536d, 0x1259c48dce8f62d9, 0xafc76de32fb3a147, 0x6187f9d32d859fa3, 0x7e325ab65c98be21,
+    0x317986a54869bc7d, 0x2fe3bd98756cdbe9, 0x42b57d3ed8a21c57, 0x5bdca28fe6952ac3, 0x23694ed1f3b85a41,
+    0x48d3f1e2128a479d, 0x7af84b15429d671b, 0x18ad62543e6f9587, 0xa36e7bd87d82a5e3, 0xc36927dbad97c461,
+    0x2e5d873ba967c2bd, 0xdfb5149ed87ae13b, 0x49327bced45cef97, 0x23d498a547812ef3, 0x2dca65b436954e71,
+    0x324f7dc652764bcd, 0x1d48b2c981796c4b, 0x2cbf17898f4d6ab7, 0x257d9e1cbd6f9a25, 0x134cadbfed63c891,
+    0xde9a327fe954b6fd, 0xda54e3721a48e56b, 0x624e71b3285af4d7, 0x3f75a198798e1645, 0xfed5a26ba78254b1,
+    0xf7db462cb485632f, 0x3fb864ced257618b, 0xd9516facbd396fe7, 0x3d42c5b1fd3c9e65, 0xcdaf58932b4f9dc1,
+    0x91a3b6d54a52cb3f, 0x3eca17d65834ea9b, 0x1239aec76847fa19, 0xfb43825cb74c1a85, 0xd2e4157cb65d38e1,
+    0x1a7c3b4ed361475f, 0x26db4c51f14365cb, 0xd8b1ae6321478539, 0x1f64d3954f2b93a5, 0xeb4567987e5db413,
+    0x96e4bd176a3eb17f, 0xd62a34e87832cfdb, 0xe9df3a5cb825fe49, 0xf1a7c89ed7381eb5, 0xf46329e1f75b4d23,
+    0x67a94812152d3b8f, 0x1af596c7643159fb, 0x3512874981237a69, 0xb174a6d87f1698d5, 0xd81265ca9e1ab853,
+    0xc5d7e6a9891cb5af, 0x3f2b5decb91fc52d, 0x23419c7fea12f389, 0xe21bc6f54a2713f5, 0x3fa4d217691a4273,
+    0x6b92c538762a41cf, 0xafc82b79841c5f3d, 0x3a48f56cb3216ea9, 0x473eadfbaef39d17, 0x4281da9cbdf5ac83,
+    0x3f8e76adc8e6a9df, 0xde1397c218fac95d, 0xc6fa745326fde7c9, 0x43adf9876af21937, 0x32cb971a98f527a3,
+    0x6b18592cb6f95721, 0xfa2eb3dcb2fa547d, 0x8e16b3acb1fc63e9, 0xf1543aedcedf9257, 0x91bec8f32fe4a1c3,
+    0xb178ec454cd6bf31, 0xeab8c5f439c6be8d, 0xfb76421546b8dcf9, 0x71e34d8985bdfc67, 0xc5d3461ba7e12bd3,
+    0x4ab79f1ed7e64b51, 0x3a879cd1f2e648ad, 0xc6fae14213ea682b, 0x8fa3571431ed8697, 0xfc3719254dbe96f3,
+    0xef2dc1498ed3c571, 0xf17d962879a5b3cd, 0x42af9c8ba9c8e24b, 0x918cbf4ed6caf1b7, 0xe38da6c1f8ce3125,
+    0x768f9a5437c24f81, 0x6c9d7a8325a34ced, 0x7bfa1ce542c76d5b, 0x759be1d651d96bc7, 0xf26ce3187fad9b35,
+    0x36742f187d8fb9a1, 0xdb5cf6aedba3c81f, 0x27b89ca1f9a4e67b, 0x3e8bc64219a8f5e7, 0xbf385d1439bc1765,
+    0x14c23af767ae35c1, 0xbe56932a97b1643f, 0xf63da52ba3c4629b, 0x823a4b1ed3c78219, 0x5f7eab9dce8a9f75,
+    0x47f2b581fc7b9ed1, 0xb74ec8921b7eac4f, 0xeb1cd2543972ecab, 0xaef618d54a85fb29, 0x9d6efa3767a81b95,
+    0xc19e74fba68b39f1, 0x1a7b4e8cb49d386f, 0xcdb1962fe39156db, 0x2c4f5db1f1b38649, 0x46ebc98321a794b5,
+    0x7a8b42954f8ab523, 0x41f732a54d6cb28f, 0x19db3f76596ec1fb, 0x8234f7a98a72ef59, 0x4f738d1cb9861fc5,
+    0x4751c98ed7892e43, 0xa5b8c23fe46a3c9f, 0x6ecbd1a3247e5b1d, 0x21bf374543816b79, 0xc8f254e7617389e5,
+    0x3fa5b4298f57b963, 0x531fa7287d48a6bf, 0xf6b72c3a9a5bc63d, 0x689257fdc85fe4a9, 0x76c2b841fb942517,
+    0x695ce3b21b972483, 0xc1ab6754376842df, 0x324ae859847b615d, 0x3c2b4d58724d5fb9, 0x5a3fe84cb3619e27,
+    0x2bf7486cbf54ad93, 0xe6fb9a8cbc359aef, 0xfd5eab31fb38ca6d, 0x3971afb21a3be8d9, 0x14ae95232a3ef947,
+    0x27db19e87a6428b3, 0x761a42bcba675831, 0x415a37bcb639458d, 0x1435892dc23b64f9, 0xd84165fed14e9367,
+    0xe3c5846fef51a2d3, 0x15fe69743f46c251, 0x13bf2a743c25bf9d, 0xe5a3f8b65a38de1b, 0x4325adf6592bfd87,
+    0x1543f78a984f1ce3, 0x5164fbded9534c61, 0x52731b4fe62549bd, 0xc24fa6d1f428693b, 0x6b38a952132c68a7,
+    0xac463987623ea815, 0x1279ed687f32c681, 0xc3f421a87c13b4ed, 0x43f7958a9c17e35b, 0x7a19462cba19f2c7,
+    0xcb198d3fea4d1235, 0xd37ec6bfe83f42a1, 0x1acd2e9437124efd, 0x95cfb8a437145e6b, 0x192fc34653186cd7,
+    0xa67f8d59821b9c45, 0x6a132dc76efd9ab1, 0xde153b287adeb92f, 0x9ae6438dcaf2e78b, 0x9ae4865dc9d4e6f7,
+    0x82e6dc132bfa1875, 0x4fb7932548fb36d1, 0x3fd958a767ed354f, 0x7d2c148985f163ab, 0x1a4fbe3cb4f58329,
+    0x3cbf267dc2f7a195, 0xda19f52badc89fe1, 0x86d4a19fe9cbad5f, 0xd45781b2189fadcb, 0xb87649254ad2fc39,
+    0x4db7382549e61ca5, 0x3eb52ca878e94b13, 0xfe6a8b4985db397f, 0x71e2538a93cd47eb, 0x93a4f56ed3e18759,
+    0xf3b98471f1e396c5, 0xb1c29e5321e8b643, 0x71eb2da32ec8b39f, 0xf87e9db65eabc31d, 0xe8f5d3765abfe179,
+    0x8cf39d6a9ac421e5, 0x63ad85fcb9c72f53, 0xcb53f98dc5b73daf, 0xe97adb61f4ba5c2d, 0x368aef7213be5c89,
+    0xaecd613543c18af5, 0x45b928e761d4ba73, 0xeda7bc854e95a7cf, 0x642a31d76ea9c74d, 0x92ea65387a8ce5b9,
+    0xb3ac76edc9aef527, 0xfd6829a1fac42593, 0xa47df9e218a643ef, 0x67beaf9437b9526d, 0x9a32485654ab61d9,
+    0x8fc4139762ad8f37, 0x7c48eda982b19ea3, 0x7a68d5ebaf95bd21, 0xd2ec154bae85cb7d, 0xb28d5cf1fb67dae9,
+    0xc9ba64f21b8cfa57, 0x312d6a854a8f19c3, 0x5423dbc87ab35941, 0x74d835b987a5469d, 0x59fe437dc4a9761b,
+    0xf217c4ded2ac9487, 0x12ba9c8dc18d94e3, 0x75ac438fef92c361, 0xcbf249d32f74c1bd, 0xcae2b6343c76df2b,
+    0x83c1e6243b58fe97, 0x3baf12d7697b1df3, 0xe9f1764ba98f3d71, 0x3a91864cb6724acd, 0xba867d5fe3856a4b,
+    0x52374ba1f25869b7, 0x3bfa7652137ca925, 0xfbcd2785426eb791, 0xda1c2b854e61b5fd, 0xfd3c78298d73e46b,
+    0xc4e8d15a9b56f3d7, 0xb13a4c7edc8b1345, 0x593e718fe97d43b1, 0xc7bdaf3ed87e512f, 0x389c6b7218625f7b,
+    0x57cb964323546de7, 0x63bac49872489d65, 0x39d6eca8725a9bc1, 0x5d9b41387e4dba3f, 0x2e19c8abad41e89b,
+    0x461fb72edc54f819, 0x2a975dc1fc471985, 0xc872ed432b5a37e1, 0xc48f5b23294c365f, 0x5c961e37673f54cb,
+    0xb5ea87fcb7628439, 0xf2784cadc34692a5, 0x8db54a3ed469b213, 0x89461bacbd29ae6f, 0x592adf61f92caedb,
+    0xec65a8432c31fd49, 0x4ad5cf176c341db5, 0xc26e41d87b584c23, 0xe25acf6767293a8f, 0x8b69f53a962c48fb,
+    0x43ec859dc42f5869, 0x74be85dfe43297d5, 0x6bf572e1f126b753, 0x6b1ad9f43127b4af, 0x8b793e265f1ac42d,
+    0x7a231de65c1de289, 0x5fbd497a9c4312f5, 0xfe528d4cbc264173, 0x42513f8ba8163ebf, 0xe194c6fdc7195e3d,
+    0xbaf895d1f41c5da9, 0x59e72ad4352f8c17, 0xfeb49c276512ab83, 0x435c12676214a8df, 0xb14a89354ef6c85d,
+    0xb48e7d165bf8e6c9, 0x26c98fba9aecf637, 0x869532adc9ef16a3, 0x519d784feaf45621, 0x5d8491e219f6537d
+};
+
+static inline ElkRandomState
+elk_random_state_create(u64 seed)
+{
+    u64 key = elk_random_keys[seed % ECO_ARRAY_SIZE(elk_random_keys) ];
+
+    return (ElkRandomState){ .key = key, .counter = seed };
+}
+
+static inline u64
+elk_random_helper_squares(u64 key, u64 cnt)
+{
+    u64 y = cnt * key;
+    u64 x = y;
+    u64 z = y + key;
+    x = x * x + y;     x = (x>>32) | (x<<32);       /* round 1 */
+    x = x * x + z;     x = (x>>32) | (x<<32);       /* round 2 */
+    x = x * x + y;     x = (x>>32) | (x<<32);       /* round 3 */
+    u64 t = x * x + z;
+    x = t;             x = (x>>32) | (x<<32);       /* round 4 */
+
+   return t ^ ((x * x + y) >> 32);                  /* round 5 */
+}
+
+static inline ElkRandomState
+elk_random_state_split(ElkRandomState const *state, u64 stream_id)
+{
+    /* Use the parent generator as a hash. The first round spreads out the stream_id, the second ties the result to the
+     * parent's position in its own stream so splitting a substream again gives new substreams.
+     */
+    u64 h = elk_random_helper_squares(state->key, stream_id);
+    h = elk_random_helper_squares(state->key, h ^ state->counter);
+
+    u64 key = elk_random_keys[h % ECO_ARRAY_SIZE(elk_random_keys)];
+    u64 counter = elk_random_helper_squares(key, h);
+
+    return (ElkRandomState){ .key = key, .counter = counter };
+}
+
+static inline void
+elk_random_state_skip(ElkRandomState *state, u64 n)
+{
+    state->counter += n;
+}
+
+static inline u64
+elk_random_state_uniform_u64(ElkRandomState *state)
+{
+    u64 cnt = state->counter++;
+    return elk_random_helper_squares(state->key, cnt);
+}
+
+static inline f64
+elk_random_state_uniform_f64(ElkRandomState *state)
+{
+    return 5.42101086242752217e-20 * elk_random_state_uniform_u64(state);
+}
+
+/* Full 128 bit product of a and b, return the high 64 bits and put the low 64 bits in lo. */
+static inline u64
+elk_mul_u64_wide(u64 a, u64 b, u64 *lo)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    u64 hi = 0;
+    *lo = _umul128(a, b, &hi);
+    return hi;
+#else
+    unsigned __int128 m = (unsigned __int128)a * (unsigned __int128)b;
+    *lo = (u64)m;
+    return (u64)(m >> 64);
+#endif
+}
+
+static inline u64
+elk_random_state_uniform_bounded_u64(ElkRandomState *state, u64 bound)
+{
+    Assert(bound > 0);
+
+    u64 lo = 0;
+    u64 hi = elk_mul_u64_wide(elk_random_state_uniform_u64(state), bound, &lo);
+    if(lo < bound)
+    {
+        u64 threshold = -bound % bound;
+        while(lo < threshold)
+        {
+            hi = elk_mul_u64_wide(elk_random_state_uniform_u64(state), bound, &lo);
+        }
+    }
+
+    return hi;
+}
+
+static inline void
+elk_random_state_uniform_bounded_pair_u64(ElkRandomState *state, u64 bound0, u64 bound1, u64 *out0, u64 *out1)
+{
+    Assert(bound0 > 0 && bound1 > 0);
+
+    u64 product_hi = 0;
+    u64 product = 0;
+    product_hi = elk_mul_u64_wide(bound0, bound1, &product);
+    Assert(product_hi == 0);
+
+    u64 lo = 0;
+    u64 r0 = elk_mul_u64_wide(elk_random_state_uniform_u64(state), bound0, &lo);
+    u64 r1 = elk_mul_u64_wide(lo, bound1, &lo);
+
+    if(lo < product)
+    {
+        u64 threshold = -product % product;
+        while(lo < threshold)
+        {
+            r0 = elk_mul_u64_wide(elk_random_state_uniform_u64(state), bound0, &lo);
+            r1 = elk_mul_u64_wide(lo, bound1, &lo);
+        }
+    }
+
+    *out0 = r0;
+    *out1 = r1;
+}
+
+#if __AVX2__
+
+typedef union
+{
+    __m256i vec;
+    u64 arr[4];
+} ElkM256iPun;
+
+static inline ElkAVX2RandomState 
+elk_avx2_random_state_create(u64 i_seed)
+{
+    ElkM256iPun seed = {0};
+    ElkM256iPun key = {0};
+
+    seed.arr[0] = i_seed + 0; seed.arr[1] = i_seed + 1; seed.arr[2] = i_seed + 2; seed.arr[3] = i_seed + 3;
+
+    key.arr[0] = elk_random_keys[(i_seed + 0) % ECO_ARRAY_SIZE(elk_random_keys) ];
+    key.arr[1] = elk_random_keys[(i_seed + 1) % ECO_ARRAY_SIZE(elk_random_keys) ];
+    key.arr[2] = elk_random_keys[(i_seed + 2) % ECO_ARRAY_SIZE(elk_random_keys) ];
+    key.arr[3] = elk_random_keys[(i_seed + 3) % ECO_ARRAY_SIZE(elk_random_keys) ];
+
+    return (ElkAVX2RandomState){ .key = key.vec, .counter = seed.vec };
+}
+
+static inline ElkAVX2RandomState 
+elk_avx2_random_state_split(ElkRandomState const *state, u64 stream_id)
+{
+    ElkM256iPun counter = {0};
+    ElkM256iPun key = {0};
+
+    /* Lane i is the same substream as elk_random_state_split(state, 4 * stream_id + i). */
+    for(i32 i = 0; i < 4; ++i)
+    {
+        ElkRandomState lane = elk_random_state_split(state, 4 * stream_id + i);
+        key.arr[i] = lane.key;
+        counter.arr[i] = lane.counter;
+    }
+
+    return (ElkAVX2RandomState){ .key = key.vec, .counter = counter.vec };
+}
+
+static inline void
+elk_avx2_random_state_skip(ElkAVX2RandomState *state, u64 n)
+{
+    state->counter = _mm256_add_epi64(state->counter, _mm256_set1_epi64x((i64)n));
+}
+
+/* Helper: 64-bit unsigned multiply (low 64 bits of a*b) for AVX2 - thanks Grok */
+static inline __m256i 
+elk_mul64_epu64(__m256i a, __m256i b)
+{
+    /* Based on tested implementations (e.g. Agner Fog + improvements) */
+    __m256i b_swap   = _mm256_shuffle_epi32(b, _MM_SHUFFLE(2, 3, 0, 1));  /* swap high/low 32-bit halves */
+    __m256i cross    = _mm256_mullo_epi32(a, b_swap);                     /* cross products (L*H + H*L)  */
+
+    __m256i prodlh   = _mm256_slli_epi64(cross, 32);
+    __m256i prodhl   = _mm256_and_si256(cross, _mm256_set1_epi64x(0xFFFFFFFF00000000ULL));
+    __m256i sumcross = _mm256_add_epi64(prodlh, prodhl);
+
+    __m256i prodll   = _mm256_mul_epu32(a, b);
+    return _mm256_add_epi64(prodll, sumcross);
+}
+
+/* Vectorized u64 generator - produces 4 random u64s - thanks Grok */
+static inline __m256i
+elk_avx2_random_state_uniform_u64(ElkAVX2RandomState *state)
+{
+    __m256i cnt = state->counter;
+    state->counter = _mm256_add_epi64(cnt, _mm256_set1_epi64x(1));  /* increment by 1 (vector) */
+
+    __m256i key = state->key;
+
+    __m256i y = elk_mul64_epu64(cnt, key);
+    __m256i x = y;
+    __m256i z = _mm256_add_epi64(y, key);
+
+    /* Round 1 */
+    x = elk_mul64_epu64(x, x);
+    x = _mm256_add_epi64(x, y);
+    x = _mm256_or_si256(_mm256_srli_epi64(x, 32), _mm256_slli_epi64(x, 32));
+
+    /* Round 2 */
+    x = elk_mul64_epu64(x, x);
+    x = _mm256_add_epi64(x, z);
+    x = _mm256_or_si256(_mm256_srli_epi64(x, 32), _mm256_slli_epi64(x, 32));
+
+    /* Round 3 */
+    x = elk_mul64_epu64(x, x);
+    x = _mm256_add_epi64(x, y);
+    x = _mm256_or_si256(_mm256_srli_epi64(x, 32), _mm256_slli_epi64(x, 32));
+
+    /* Round 4 */
+    __m256i t = elk_mul64_epu64(x, x);
+    t = _mm256_add_epi64(t, z);
+    x = _mm256_or_si256(_mm256_srli_epi64(t, 32), _mm256_slli_epi64(t, 32));
+
+    /* Round 5 */
+    __m256i final_mul = elk_mul64_epu64(x, x);
+    final_mul = _mm256_add_epi64(final_mul, y);
+    __m256i high = _mm256_srli_epi64(final_mul, 32);
+
+    return _mm256_xor_si256(t, high);
+}
+
+static inline __m256d
+elk_uint64_to_double53_avx2(__m256i x)
+{
+    /* Thank you Grok */
+
+    /* Set the implicit leading 1 and use exponent for 2^0 */
+    __m256i magic = _mm256_set1_epi64x(0x3FF0000000000000ULL);  /* 1.0 in double (biased exponent) */
+
+    /* Put the high 52 bits of x into the mantissa */
+    __m256i mant = _mm256_srli_epi64(x, 12);                    /* 52 bits                         */
+    __m256i bits = _mm256_or_si256(mant, magic);
+
+    __m256d d = _mm256_castsi256_pd(bits);
+    return _mm256_sub_pd(d, _mm256_set1_pd(1.0));               /* subtract 1.0                    */
+}
+
+static inline __m256d
+elk_avx2_random_state_uniform_f64(ElkAVX2RandomState *state)
+{
+    __m256i u = elk_avx2_random_state_uniform_u64(state);
+    return elk_uint64_to_double53_avx2(u);
+}
+
+static inline __m256i
+elk_avx2_random_state_uniform_bounded_u32(ElkAVX2RandomState *state, u32 bound)
+{
+    Assert(bound > 0);
+
+    __m256i vbound = _mm256_set1_epi64x(bound);
+    __m256i low_mask = _mm256_set1_epi64x(0xFFFFFFFF);
+
+    /* Use the high 32 bits of each random u64, they are the best quality bits. */
+    __m256i x = _mm256_srli_epi64(elk_avx2_random_state_uniform_u64(state), 32);
+    __m256i m = _mm256_mul_epu32(x, vbound);
+    __m256i lo = _mm256_and_si256(m, low_mask);
+
+    /* All values fit in 32 bits, so the signed 64 bit compare works. */
+    __m256i reject = _mm256_cmpgt_epi64(vbound, lo);
+    if(!_mm256_testz_si256(reject, reject))
+    {
+        __m256i threshold = _mm256_set1_epi64x((u32)-bound % bound);
+        reject = _mm256_cmpgt_epi64(threshold, lo);
+        while(!_mm256_testz_si256(reject, reject))
+        {
+            x = _mm256_srli_epi64(elk_avx2_random_state_uniform_u64(state), 32);
+            __m256i m_retry = _mm256_mul_epu32(x, vbound);
+            m = _mm256_blendv_epi8(m, m_retry, reject);
+            lo = _mm256_and_si256(m, low_mask);
+            reject = _mm256_cmpgt_epi64(threshold, lo);
+        }
+    }
+
+    return _mm256_srli_epi64(m, 32);
+}
+
+#endif
+
+#if ELK_AVX_512
+
+typedef union
+{
+    __m512i vec;
+    u64 arr[8];
+} ElkM512iPun;
+
+static inline ElkAVX512RandomState 
+elk_avx512_random_state_create(u64 i_seed)
+{
+    ElkM512iPun seed = {0};
+    ElkM512iPun key = {0};
+
+    seed.arr[0] = i_seed + 0; seed.arr[1] = i_seed + 1; seed.arr[2] = i_seed + 2; seed.arr[3] = i_seed + 3;
+    seed.arr[4] = i_seed + 4; seed.arr[5] = i_seed + 5; seed.arr[6] = i_seed + 6; seed.arr[7] = i_seed + 7;
+
+    key.arr[0] = elk_random_keys[(i_seed + 0) % ECO_ARRAY_SIZE(elk_random_keys) ];
+    key.arr[1] = elk_random_keys[(i_seed + 1) % ECO_ARRAY_SIZE(elk_random_keys) ];
+    key.arr[2] = elk_random_keys[(i_seed + 2) % ECO_ARRAY_SIZE(elk_random_keys) ];
+    key.arr[3] = elk_random_keys[(i_seed + 3) % ECO_ARRAY_SIZE(elk_random_keys) ];
+    key.arr[4] = elk_random_keys[(i_seed + 4) % ECO_ARRAY_SIZE(elk_random_keys) ];
+    key.arr[5] = elk_random_keys[(i_seed + 5) % ECO_ARRAY_SIZE(elk_random_keys) ];
+    key.arr[6] = elk_random_keys[(i_seed + 6) % ECO_ARRAY_SIZE(elk_random_keys) ];
+    key.arr[7] = elk_random_keys[(i_seed + 7) % ECO_ARRAY_SIZE(elk_random_keys) ];
+
+    return (ElkAVX512RandomState){ .key = key.vec, .counter = seed.vec };
+}
+
+static inline ElkAVX512RandomState 
+elk_avx512_random_state_split(ElkRandomState const *state, u64 stream_id)
+{
+    ElkM512iPun counter = {0};
+    ElkM512iPun key = {0};
+
+    /* Lane i is the same substream as elk_random_state_split(state, 8 * stream_id + i). */
+    for(i32 i = 0; i < 8; ++i)
+    {
+        ElkRandomState lane = elk_random_state_split(state, 8 * stream_id + i);
+        key.arr[i] = lane.key;
+        counter.arr[i] = lane.counter;
+    }
+
+    return (ElkAVX512RandomState){ .key = key.vec, .counter = counter.vec };
+}
+
+static inline void
+elk_avx512_random_state_skip(ElkAVX512RandomState *state, u64 n)
+{
+    state->counter = _mm512_add_epi64(state->counter, _mm512_set1_epi64((i64)n));
+}
+
+static inline __m512i 
+elk_avx512_random_state_uniform_u64(ElkAVX512RandomState *state)
+{
+    __m512i cnt = state->counter;
+    state->counter = _mm512_add_epi64(cnt, _mm512_set1_epi64(1));
+
+    __m512i key = state->key;
+
+    __m512i y = _mm512_mullo_epi64(cnt, key);
+    __m512i x = y;
+    __m512i z = _mm512_add_epi64(y, key);
+
+    /* Round 1 */
+    x = _mm512_mullo_epi64(x, x);
+    x = _mm512_add_epi64(x, y);
+    x = _mm512_or_si512(_mm512_srli_epi64(x, 32), _mm512_slli_epi64(x, 32));
+
+    /* Round 2 */
+    x = _mm512_mullo_epi64(x, x);
+    x = _mm512_add_epi64(x, z);
+    x = _mm512_or_si512(_mm512_srli_epi64(x, 32), _mm512_slli_epi64(x, 32));
+
+    /* Round 3 */
+    x = _mm512_mullo_epi64(x, x);
+    x = _mm512_add_epi64(x, y);
+    x = _mm512_or_si512(_mm512_srli_epi64(x, 32), _mm512_slli_epi64(x, 32));
+
+    /* Round 4 */
+    __m512i t = _mm512_mullo_epi64(x, x);
+    t = _mm512_add_epi64(t, z);
+    x = _mm512_or_si512(_mm512_srli_epi64(t, 32), _mm512_slli_epi64(t, 32));
+
+    /* Round 5 */
+    __m512i final_mul = _mm512_mullo_epi64(x, x);
+    final_mul = _mm512_add_epi64(final_mul, y);
+    __m512i high = _mm512_srli_epi64(final_mul, 32);
+
+    return _mm512_xor_si512(t, high);
+}
+
+static inline __m512d 
+uint64_to_double53_avx512(__m512i x)
+{
+    /* High-quality conversion using full 53 bits of precision */
+    __m512i magic = _mm512_set1_epi64(0x3FF0000000000000ULL); /* 1.0 in IEEE 754 double  */
+    __m512i mant  = _mm512_srli_epi64(x, 12);                 /* 52 bits into mantissa   */
+    __m512i bits  = _mm512_or_si512(mant, magic);
+
+    __m512d d = _mm512_castsi512_pd(bits);
+    return _mm512_sub_pd(d, _mm512_set1_pd(1.0));
+}
+
+static inline __m512d
+elk_avx512_random_state_uniform_f64(ElkAVX512RandomState *state)
+{
+    __m512i u = elk_avx512_random_state_uniform_u64(state);
+    return uint64_to_double53_avx512(u);
+}
+
+static inline __m512i
+elk_avx512_random_state_uniform_bounded_u32(ElkAVX512RandomState *state, u32 bound)
+{
+    Assert(bound > 0);
+
+    __m512i vbound = _mm512_set1_epi64(bound);
+    __m512i low_mask = _mm512_set1_epi64(0xFFFFFFFF);
+
+    /* Use the high 32 bits of each random u64, they are the best quality bits. */
+    __m512i x = _mm512_srli_epi64(elk_avx512_random_state_uniform_u64(state), 32);
+    __m512i m = _mm512_mul_epu32(x, vbound);
+
+    __mmask8 reject = _mm512_cmplt_epu64_mask(_mm512_and_si512(m, low_mask), vbound);
+    if(reject)
+    {
+        __m512i threshold = _mm512_set1_epi64((u32)-bound % bound);
+        reject = _mm512_cmplt_epu64_mask(_mm512_and_si512(m, low_mask), threshold);
+        while(reject)
+        {
+            x = _mm512_srli_epi64(elk_avx512_random_state_uniform_u64(state), 32);
+            m = _mm512_mask_mul_epu32(m, reject, x, vbound);
+            reject = _mm512_cmplt_epu64_mask(_mm512_and_si512(m, low_mask), threshold);
+        }
+    }
+
+    return _mm512_srli_epi64(m, 32);
+}
+
+#if 0
+
+/* This version is faster, but of lower quality in the conversion according to Grok. */
+static inline __m512d
+elk_avx512_random_state_uniform_f64_fast(ElkAVX512RandomState *state)
+{
+    __m512i u = elk_avx512_random_state_uniform_u64(state);
+    __m512d d = _mm512_cvtepu64_pd(u);                    /* Native AVX-512 conversion */
+    const __m512d scale = _mm512_set1_pd(5.42101086242752217e-20);
+    return _mm512_mul_pd(d, scale);
+}
+
+#endif
+
+#endif
+
+static inline ElkKahanAccumulator
+elk_kahan_accumulator_add(ElkKahanAccumulator acc, f64 value)
+{
+    f64 y = value - acc.err;
+    volatile f64 t = acc.sum + value;
+    volatile f64 z = t - acc.sum;
+    acc.err = z - y;
+    acc.sum = t;
+
+    return acc;
+}
+
+
+static inline ElkKahanAccumulator
+elk_kahan_accumulator_merge(ElkKahanAccumulator a, ElkKahanAccumulator b)
+{
+    /* The errors are additive, add in the error from merging the sums. */
+    ElkKahanAccumulator acc = elk_kahan_accumulator_add(a, b.sum);
+    acc.err += b.err;
+
+    return acc;
+}
+
+static inline f64
+elk_kahan_accumulator_result(ElkKahanAccumulator acc)
+{
+    return acc.sum - acc.err;
+}
+
+#if __AVX2__
+
+static inline ElkAVX2KahanAccumulator 
+elk_avx2_kahan_accumulator_add(ElkAVX2KahanAccumulator acc, __m256d value)
+{
+    __m256d y = _mm256_sub_pd(value,acc.err);
+    volatile __m256d t = _mm256_add_pd(acc.sum, value);
+    volatile __m256d z = _mm256_sub_pd(t, acc.sum);
+    acc.err = _mm256_sub_pd(z, y);
+    acc.sum = t;
+
+    return acc;
+}
+
+static inline ElkKahanAccumulator
+elk_avx2_kahan_accumulator_reduce(ElkAVX2KahanAccumulator acc)
+{
+    f64 sums[4];
+    f64 errs[4];
+    _mm256_storeu_pd(sums, acc.sum);
+    _mm256_storeu_pd(errs, acc.err);
+
+    ElkKahanAccumulator result = {0};
+    for(i32 i = 0; i < 4; ++i)
+    {
+        result = elk_kahan_accumulator_merge(result, (ElkKahanAccumulator){ .sum = sums[i], .err = errs[i] });
+    }
+
+    return result;
+}
+
+#endif
+
+#if ELK_AVX_512
+
+static inline ElkAVX512KahanAccumulator 
+elk_avx512_kahan_accumulator_add(ElkAVX512KahanAccumulator acc, __m512d value)
+{
+    __m512d y = _mm512_sub_pd(value,acc.err);
+    volatile __m512d t = _mm512_add_pd(acc.sum, value);
+    volatile __m512d z = _mm512_sub_pd(t, acc.sum);
+    acc.err = _mm512_sub_pd(z, y);
+    acc.sum = t;
+
+    return acc;
+}
+
+static inline ElkKahanAccumulator
+elk_avx512_kahan_accumulator_reduce(ElkAVX512KahanAccumulator acc)
+{
+    f64 sums[8];
+    f64 errs[8];
+    _mm512_storeu_pd(sums, acc.sum);
+    _mm512_storeu_pd(errs, acc.err);
+
+    ElkKahanAccumulator result = {0};
+    for(i32 i = 0; i < 8; ++i)
+    {
+        result = elk_kahan_accumulator_merge(result, (ElkKahanAccumulator){ .sum = sums[i], .err = errs[i] });
+    }
+
+    return result;
+}
+
+#endif
+
+#if ELK_AVX_512
+
+static inline f64
+elk_kahan_sum_f64(size n, f64 const *data)
+{
+    Assert(n >= 0);
+
+    ElkAVX512KahanAccumulator acc0 = {0}, acc1 = {0}, acc2 = {0}, acc3 = {0};
+
+    size i = 0;
+    for(; i + 32 <= n; i += 32)
+    {
+        acc0 = elk_avx512_kahan_accumulator_add(acc0, _mm512_loadu_pd(data + i +  0));
+        acc1 = elk_avx512_kahan_accumulator_add(acc1, _mm512_loadu_pd(data + i +  8));
+        acc2 = elk_avx512_kahan_accumulator_add(acc2, _mm512_loadu_pd(data + i + 16));
+        acc3 = elk_avx512_kahan_accumulator_add(acc3, _mm512_loadu_pd(data + i + 24));
+    }
+
+    for(; i + 8 <= n; i += 8)
+    {
+        acc0 = elk_avx512_kahan_accumulator_add(acc0, _mm512_loadu_pd(data + i));
+    }
+
+    if(i < n)
+    {
+        __mmask8 mask = (__mmask8)((1u << (n - i)) - 1u);
+        acc1 = elk_avx512_kahan_accumulator_add(acc1, _mm512_maskz_loadu_pd(mask, data + i));
+    }
+
+    ElkKahanAccumulator result = elk_avx512_kahan_accumulator_reduce(acc0);
+    result = elk_kahan_accumulator_merge(result, elk_avx512_kahan_accumulator_reduce(acc1));
+    result = elk_kahan_accumulator_merge(result, elk_avx512_kahan_accumulator_reduce(acc2));
+    result = elk_kahan_accumulator_merge(result, elk_avx512_kahan_accumulator_reduce(acc3));
+
+    return elk_kahan_accumulator_result(result);
+}
+
+static inline f64
+elk_kahan_sum_strided_f64(size n, void const *data, size offset, size stride)
+{
+    Assert(n >= 0);
+
+    byte const *base = (byte const *)data + offset;
+    __m512i idx = _mm512_mullo_epi64(_mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0), _mm512_set1_epi64(stride));
+
+    ElkAVX512KahanAccumulator acc0 = {0}, acc1 = {0};
+
+    size i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        acc0 = elk_avx512_kahan_accumulator_add(acc0, _mm512_i64gather_pd(idx, base + (i + 0) * stride, 1));
+        acc1 = elk_avx512_kahan_accumulator_add(acc1, _mm512_i64gather_pd(idx, base + (i + 8) * stride, 1));
+    }
+
+    ElkKahanAccumulator result = elk_avx512_kahan_accumulator_reduce(acc0);
+    result = elk_kahan_accumulator_merge(result, elk_avx512_kahan_accumulator_reduce(acc1));
+
+    for(; i < n; ++i)
+    {
+        f64 val;
+        memcpy(&val, base + i * stride, sizeof(val));
+        result = elk_kahan_accumulator_add(result, val);
+    }
+
+    return elk_kahan_accumulator_result(result);
+}
+
+#elif __AVX2__
+
+static inline f64
+elk_kahan_sum_f64(size n, f64 const *data)
+{
+    Assert(n >= 0);
+
+    ElkAVX2KahanAccumulator acc0 = {0}, acc1 = {0}, acc2 = {0}, acc3 = {0};
+
+    size i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        acc0 = elk_avx2_kahan_accumulator_add(acc0, _mm256_loadu_pd(data + i +  0));
+        acc1 = elk_avx2_kahan_accumulator_add(acc1, _mm256_loadu_pd(data + i +  4));
+        acc2 = elk_avx2_kahan_accumulator_add(acc2, _mm256_loadu_pd(data + i +  8));
+        acc3 = elk_avx2_kahan_accumulator_add(acc3, _mm256_loadu_pd(data + i + 12));
+    }
+
+    for(; i + 4 <= n; i += 4)
+    {
+        acc0 = elk_avx2_kahan_accumulator_add(acc0, _mm256_loadu_pd(data + i));
+    }
+
+    ElkKahanAccumulator result = elk_avx2_kahan_accumulator_reduce(acc0);
+    result = elk_kahan_accumulator_merge(result, elk_avx2_kahan_accumulator_reduce(acc1));
+    result = elk_kahan_accumulator_merge(result, elk_avx2_kahan_accumulator_reduce(acc2));
+    result = elk_kahan_accumulator_merge(result, elk_avx2_kahan_accumulator_reduce(acc3));
+
+    for(; i < n; ++i)
+    {
+        result = elk_kahan_accumulator_add(result, data[i]);
+    }
+
+    return elk_kahan_accumulator_result(result);
+}
+
+static inline f64
+elk_kahan_sum_strided_f64(size n, void const *data, size offset, size stride)
+{
+    Assert(n >= 0);
+
+    byte const *base = (byte const *)data + offset;
+    __m256i idx = _mm256_set_epi64x(3 * stride, 2 * stride, stride, 0);
+
+    ElkAVX2KahanAccumulator acc0 = {0}, acc1 = {0};
+
+    size i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        acc0 = elk_avx2_kahan_accumulator_add(acc0, _mm256_i64gather_pd((double const *)(base + (i + 0) * stride), idx, 1));
+        acc1 = elk_avx2_kahan_accumulator_add(acc1, _mm256_i64gather_pd((double const *)(base + (i + 4) * stride), idx, 1));
+    }
+
+    ElkKahanAccumulator result = elk_avx2_kahan_accumulator_reduce(acc0);
+    result = elk_kahan_accumulator_merge(result, elk_avx2_kahan_accumulator_reduce(acc1));
+
+    for(; i < n; ++i)
+    {
+        f64 val;
+        memcpy(&val, base + i * stride, sizeof(val));
+        result = elk_kahan_accumulator_add(result, val);
+    }
+
+    return elk_kahan_accumulator_result(result);
+}
+
+#else
+
+static inline f64
+elk_kahan_sum_f64(size n, f64 const *data)
+{
+    Assert(n >= 0);
+
+    /* Two independent accumulators so the additions can overlap. */
+    ElkKahanAccumulator acc0 = {0}, acc1 = {0};
+
+    size i = 0;
+    for(; i + 2 <= n; i += 2)
+    {
+        acc0 = elk_kahan_accumulator_add(acc0, data[i + 0]);
+        acc1 = elk_kahan_accumulator_add(acc1, data[i + 1]);
+    }
+
+    if(i < n) { acc0 = elk_kahan_accumulator_add(acc0, data[i]); }
+
+    return elk_kahan_accumulator_result(elk_kahan_accumulator_merge(acc0, acc1));
+}
+
+static inline f64
+elk_kahan_sum_strided_f64(size n, void const *data, size offset, size stride)
+{
+    Assert(n >= 0);
+
+    byte const *base = (byte const *)data + offset;
+    ElkKahanAccumulator acc = {0};
+
+    for(size i = 0; i < n; ++i)
+    {
+        f64 val;
+        memcpy(&val, base + i * stride, sizeof(val));
+        acc = elk_kahan_accumulator_add(acc, val);
+    }
+
+    return elk_kahan_accumulator_result(acc);
+}
+
+#endif
+
+static inline ElkStatistics
+elk_statistics_add(ElkStatistics stats, f64 value)
+{
+    if(value != value)
+    {
+        stats.nan_count++;
+        return stats;
+    }
+
+    if(stats.count == 0)
+    {
+        stats.min = value;
+        stats.max = value;
+    }
+    else
+    {
+        stats.min = value < stats.min ? value : stats.min;
+        stats.max = value > stats.max ? value : stats.max;
+    }
+
+    stats.count++;
+    f64 const delta = value - stats.mean;
+    stats.mean += delta / stats.count;
+    stats.m2 += delta * (value - stats.mean);
+
+    return stats;
+}
+
+static inline ElkStatistics
+elk_statistics_merge(ElkStatistics a, ElkStatistics b)
+{
+    size const nan_count = a.nan_count + b.nan_count;
+
+    if(b.count == 0) { a.nan_count = nan_count; return a; }
+    if(a.count == 0) { b.nan_count = nan_count; return b; }
+
+    f64 const n = (f64)(a.count + b.count);
+    f64 const delta = b.mean - a.mean;
+    f64 const w = b.count / n;
+
+    ElkStatistics result = 
+        {
+            .count = a.count + b.count,
+            .nan_count = nan_count,
+            .min = b.min < a.min ? b.min : a.min,
+            .max = b.max > a.max ? b.max : a.max,
+            .mean = a.mean + delta * w,
+            .m2 = a.m2 + b.m2 + delta * delta * a.count * w
+        };
+
+    return result;
+}
+
+static inline f64
+elk_statistics_variance(ElkStatistics stats)
+{
+    return stats.count > 1 ? stats.m2 / (stats.count - 1) : 0.0;
+}
+
+/* Number of vectors loaded per block in the SIMD versions. Each block gets a two pass mean and m2 computed from registers,
+ * then merged into the running statistics for each lane. */
+#define ELK_STATISTICS_BLOCK 16
+
+#if ELK_AVX_512
+
+typedef struct
+{
+    __m512d count;
+    __m512d mean;
+    __m512d m2;
+    __m512d min;
+    __m512d max;
+    size nan_count;
+} ElkAVX512Statistics;
+
+static inline ElkAVX512Statistics
+elk_statistics_helper_avx512_block(ElkAVX512Statistics acc, __m512d const xs[ELK_STATISTICS_BLOCK])
+{
+    __m512d const zero = _mm512_setzero_pd();
+    __m512d const one = _mm512_set1_pd(1.0);
+
+    __mmask8 ok[ELK_STATISTICS_BLOCK];
+    __m512d sum = zero;
+    __m512d cnt = zero;
+    for(i32 j = 0; j < ELK_STATISTICS_BLOCK; ++j)
+    {
+        ok[j] = _mm512_cmp_pd_mask(xs[j], xs[j], _CMP_ORD_Q);
+        sum = _mm512_mask_add_pd(sum, ok[j], sum, xs[j]);
+        cnt = _mm512_mask_add_pd(cnt, ok[j], cnt, one);
+        acc.min = _mm512_mask_min_pd(acc.min, ok[j], acc.min, xs[j]);
+        acc.max = _mm512_mask_max_pd(acc.max, ok[j], acc.max, xs[j]);
+        acc.nan_count += 8 - __builtin_popcount(ok[j]);
+    }
+
+    __mmask8 const has = _mm512_cmp_pd_mask(cnt, zero, _CMP_GT_OQ);
+    __m512d const bmean = _mm512_maskz_div_pd(has, sum, cnt);
+
+    __m512d bm2 = zero;
+    for(i32 j = 0; j < ELK_STATISTICS_BLOCK; ++j)
+    {
+        __m512d const d = _mm512_sub_pd(xs[j], bmean);
+        bm2 = _mm512_mask_add_pd(bm2, ok[j], bm2, _mm512_mul_pd(d, d));
+    }
+
+    __m512d const n = _mm512_add_pd(acc.count, cnt);
+    __m512d const delta = _mm512_sub_pd(bmean, acc.mean);
+    __m512d const w = _mm512_maskz_div_pd(has, cnt, n);
+
+    acc.mean = _mm512_add_pd(acc.mean, _mm512_mul_pd(delta, w));
+    acc.m2 = _mm512_add_pd(_mm512_add_pd(acc.m2, bm2), _mm512_mul_pd(_mm512_mul_pd(delta, delta), _mm512_mul_pd(acc.count, w)));
+    acc.count = n;
+
+    return acc;
+}
+
+#elif __AVX2__
+
+typedef struct
+{
+    __m256d count;
+    __m256d mean;
+    __m256d m2;
+    __m256d min;
+    __m256d max;
+    size nan_count;
+} ElkAVX2Statistics;
+
+static inline ElkAVX2Statistics
+elk_statistics_helper_avx2_block(ElkAVX2Statistics acc, __m256d const xs[ELK_STATISTICS_BLOCK])
+{
+    __m256d const zero = _mm256_setzero_pd();
+    __m256d const one = _mm256_set1_pd(1.0);
+
+    __m256d ok[ELK_STATISTICS_BLOCK];
+    __m256d sum = zero;
+    __m256d cnt = zero;
+    for(i32 j = 0; j < ELK_STATISTICS_BLOCK; ++j)
+    {
+        ok[j] = _mm256_cmp_pd(xs[j], xs[j], _CMP_ORD_Q);
+        sum = _mm256_add_pd(sum, _mm256_and_pd(ok[j], xs[j]));
+        cnt = _mm256_add_pd(cnt, _mm256_and_pd(ok[j], one));
+        acc.min = _mm256_blendv_pd(acc.min, _mm256_min_pd(acc.min, xs[j]), ok[j]);
+        acc.max = _mm256_blendv_pd(acc.max, _mm256_max_pd(acc.max, xs[j]), ok[j]);
+        acc.nan_count += 4 - __builtin_popcount(_mm256_movemask_pd(ok[j]));
+    }
+
+    __m256d const has = _mm256_cmp_pd(cnt, zero, _CMP_GT_OQ);
+    __m256d const bmean = _mm256_and_pd(has, _mm256_div_pd(sum, _mm256_max_pd(cnt, one)));
+
+    __m256d bm2 = zero;
+    for(i32 j = 0; j < ELK_STATISTICS_BLOCK; ++j)
+    {
+        __m256d const d = _mm256_sub_pd(xs[j], bmean);
+        bm2 = _mm256_add_pd(bm2, _mm256_and_pd(ok[j], _mm256_mul_pd(d, d)));
+    }
+
+    __m256d const n = _mm256_add_pd(acc.count, cnt);
+    __m256d const delta = _mm256_sub_pd(bmean, acc.mean);
+    __m256d const w = _mm256_and_pd(has, _mm256_div_pd(cnt, _mm256_max_pd(n, one)));
+
+    acc.mean = _mm256_add_pd(acc.mean, _mm256_mul_pd(delta, w));
+    acc.m2 = _mm256_add_pd(_mm256_add_pd(acc.m2, bm2), _mm256_mul_pd(_mm256_mul_pd(delta, delta), _mm256_mul_pd(acc.count, w)));
+    acc.count = n;
+
+    return acc;
+}
+
+#endif
+
+static inline ElkStatistics
+elk_statistics_helper_accumulate(size n, byte const *base, size stride, b32 is_f32)
+{
+    Assert(n >= 0);
+
+    size const contiguous_stride = is_f32 ? sizeof(f32) : sizeof(f64);
+    b32 const contiguous = stride == contiguous_stride;
+
+    ElkStatistics result = {0};
+    size i = 0;
+
+#if ELK_AVX_512
+
+    __m512d const inf = _mm512_castsi512_pd(_mm512_set1_epi64(0x7FF0000000000000));
+    __m512i const idx = _mm512_mullo_epi64(_mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0), _mm512_set1_epi64(stride));
+
+    ElkAVX512Statistics acc = { .min = inf, .max = _mm512_sub_pd(_mm512_setzero_pd(), inf) };
+
+    for(; i + 8 * ELK_STATISTICS_BLOCK <= n; i += 8 * ELK_STATISTICS_BLOCK)
+    {
+        __m512d xs[ELK_STATISTICS_BLOCK];
+        for(i32 j = 0; j < ELK_STATISTICS_BLOCK; ++j)
+        {
+            byte const *p = base + (i + 8 * j) * stride;
+            if(contiguous)
+            {
+                xs[j] = is_f32 ? _mm512_cvtps_pd(_mm256_loadu_ps((f32 const *)p)) : _mm512_loadu_pd(p);
+            }
+            else
+            {
+                xs[j] = is_f32 ? _mm512_cvtps_pd(_mm512_i64gather_ps(idx, p, 1)) : _mm512_i64gather_pd(idx, p, 1);
+            }
+        }
+
+        acc = elk_statistics_helper_avx512_block(acc, xs);
+    }
+
+    f64 counts[8], means[8], m2s[8], mins[8], maxs[8];
+    _mm512_storeu_pd(counts, acc.count);
+    _mm512_storeu_pd(means, acc.mean);
+    _mm512_storeu_pd(m2s, acc.m2);
+    _mm512_storeu_pd(mins, acc.min);
+    _mm512_storeu_pd(maxs, acc.max);
+
+    for(i32 l = 0; l < 8; ++l)
+    {
+        ElkStatistics lane = { .count = (size)counts[l], .min = mins[l], .max = maxs[l], .mean = means[l], .m2 = m2s[l] };
+        result = elk_statistics_merge(result, lane);
+    }
+    result.nan_count += acc.nan_count;
+
+#elif __AVX2__
+
+    __m256d const inf = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FF0000000000000));
+    __m256i const idx = _mm256_set_epi64x(3 * stride, 2 * stride, stride, 0);
+
+    ElkAVX2Statistics acc = { .min = inf, .max = _mm256_sub_pd(_mm256_setzero_pd(), inf) };
+
+    for(; i + 4 * ELK_STATISTICS_BLOCK <= n; i += 4 * ELK_STATISTICS_BLOCK)
+    {
+        __m256d xs[ELK_STATISTICS_BLOCK];
+        for(i32 j = 0; j < ELK_STATISTICS_BLOCK; ++j)
+        {
+            byte const *p = base + (i + 4 * j) * stride;
+            if(contiguous)
+            {
+                xs[j] = is_f32 ? _mm256_cvtps_pd(_mm_loadu_ps((f32 const *)p)) : _mm256_loadu_pd((f64 const *)p);
+            }
+            else
+            {
+                xs[j] = is_f32 ? _mm256_cvtps_pd(_mm256_i64gather_ps((f32 const *)p, idx, 1))
+                               : _mm256_i64gather_pd((f64 const *)p, idx, 1);
+            }
+        }
+
+        acc = elk_statistics_helper_avx2_block(acc, xs);
+    }
+
+    f64 counts[4], means[4], m2s[4], mins[4], maxs[4];
+    _mm256_storeu_pd(counts, acc.count);
+    _mm256_storeu_pd(means, acc.mean);
+    _mm256_storeu_pd(m2s, acc.m2);
+    _mm256_storeu_pd(mins, acc.min);
+    _mm256_storeu_pd(maxs, acc.max);
+
+    for(i32 l = 0; l < 4; ++l)
+    {
+        ElkStatistics lane = { .count = (size)counts[l], .min = mins[l], .max = maxs[l], .mean = means[l], .m2 = m2s[l] };
+        result = elk_statistics_merge(result, lane);
+    }
+    result.nan_count += acc.nan_count;
+
+#else
+    (void)contiguous;
+#endif
+
+    /* Whatever is left over, or everything if there is no SIMD available. */
+    ElkStatistics tail = {0};
+    for(; i < n; ++i)
+    {
+        byte const *p = base + i * stride;
+        if(is_f32)
+        {
+            f32 val;
+            memcpy(&val, p, sizeof(val));
+            tail = elk_statistics_add(tail, val);
+        }
+        else
+        {
+            f64 val;
+            memcpy(&val, p, sizeof(val));
+            tail = elk_statistics_add(tail, val);
+        }
+    }
+
+    return elk_statistics_merge(result, tail);
+}
+
+static inline ElkStatistics
+elk_statistics_f64(size n, f64 const *data)
+{
+    return elk_statistics_helper_accumulate(n, (byte const *)data, sizeof(f64), false);
+}
+
+static inline ElkStatistics
+elk_statistics_f32(size n, f32 const *data)
+{
+    return elk_statistics_helper_accumulate(n, (byte const *)data, sizeof(f32), true);
+}
+
+static inline ElkStatistics
+elk_statistics_strided_f64(size n, void const *data, size offset, size stride)
+{
+    return elk_statistics_helper_accumulate(n, (byte const *)data + offset, stride, false);
+}
+
+static inline ElkStatistics
+elk_statistics_strided_f32(size n, void const *data, size offset, size stride)
+{
+    return elk_statistics_helper_accumulate(n, (byte const *)data + offset, stride, true);
+}
+
+#pragma warning(pop)
+#endif
@@ -0,0 +1,6038 @@
+#ifndef _MAGPIE_H_
+#define _MAGPIE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+#include "elk.h"
+
+/* Parts of the standard C library used here that elk.h doesn't declare. */
+void *memmove(void *dest, void const *src, size_t num_bytes);
+
+#ifndef MAG_STATS
+#define MAG_STATS 0
+#endif
+
+#if MAG_STATS
+#include <stdio.h>
+#include <inttypes.h>
+#endif
+
+#pragma warning(push)
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                         Memory
+ *---------------------------------------------------------------------------------------------------------------------------
+ * Request big chunks of memory from the OS, bypassing the CRT. The system may round up your requested memory size, but it
+ * will return an error instead of rounding down if there isn't enough memory.
+ */
+typedef struct
+{
+    byte *mem;
+    size size;
+    size page_size;        /* size of the pages actually backing the memory, 0 if unknown (e.g. mag_wrap_memory) */
+    void *populate_worker; /* platform specific, only used with MAG_MEM_POPULATE_BACKGROUND */
+    u8 flags; /* bit field, 0x1 = valid, 0x2 = is owned, 0x4 = mirrored, 0x8 = file mapping */
+} MagMemoryBlock;
+
+/* How pages get faulted in. Pre-faulting (populating) all the pages means no page faults slow down the program later, but
+ * that is wasted time (and memory) if most of a big allocation is never used. With MAG_MEM_POPULATE_BACKGROUND the memory is
+ * returned right away and a helper thread faults the pages in, the helper is stopped and joined by mag_sys_memory_free. 
+ *
+ * Where the platform can't do it (background on Apple or Windows, anything on emscripten) it falls back to lazy. The 
+ * default is populate now on Linux and lazy everywhere else.
+ */
+typedef enum 
+{ 
+    MAG_MEM_POPULATE_DEFAULT,    /* Whatever mag_sys_memory_allocate does on this platform. */
+    MAG_MEM_POPULATE_NOW,        /* Fault in all pages before returning.                     */
+    MAG_MEM_POPULATE_LAZY,       /* Pages are faulted in the first time they are touched.    */
+    MAG_MEM_POPULATE_BACKGROUND  /* Return right away and fault pages in on a helper thread. */
+} MagMemoryPopulate;
+
+/* What kind of pages back the memory. Huge pages cut down on TLB misses for big tables and buffers that are accessed all 
+ * over the place. Explicit huge pages come out of a pool the administrator has to reserve ahead of time (on Linux see 
+ * /proc/sys/vm/nr_hugepages), transparent huge pages are only a request the kernel may or may not honor.
+ *
+ * If the requested pages aren't available it falls back to the next smaller explicit size, then transparent huge pages, 
+ * then regular pages. The allocation size is rounded up to a multiple of the page size that was used, and that page size
+ * is reported in MagMemoryBlock.page_size. For transparent huge pages that is the huge page size if the kernel accepted the
+ * request, but the kernel can still back some of the range with small pages.
+ *
+ * Only Linux supports all of these. Apple only has 2 MiB superpages on Intel, Windows only has its large page size (and 
+ * only with the SeLockMemoryPrivilege), and emscripten has none of them.
+ */
+typedef enum
+{
+    MAG_MEM_PAGES_DEFAULT,          /* Regular system pages.                             */
+    MAG_MEM_PAGES_TRANSPARENT_HUGE, /* Ask the kernel to use huge pages (MADV_HUGEPAGE). */
+    MAG_MEM_PAGES_HUGE_2MiB,        /* Explicit 2 MiB huge pages (MAP_HUGETLB).          */
+    MAG_MEM_PAGES_HUGE_1GiB         /* Explicit 1 GiB huge pages (MAP_HUGETLB).          */
+} MagMemoryPages;
+
+/* Which NUMA node the pages come from. On machines with more than one memory node (multi socket servers) memory attached
+ * to another socket is slower to get at, so the memory a thread works on should live on that thread's node. By default a
+ * page lands on the node of the thread that first touches it, which goes wrong when one thread allocates and populates
+ * memory that threads on another socket will use.
+ *
+ * MAG_MEM_NUMA_LOCAL places the pages on the node of the calling thread, MAG_MEM_NUMA_NODE on MagMemoryOptions.numa_node,
+ * and MAG_MEM_NUMA_INTERLEAVE spreads them round robin over all the nodes, which suits big tables every thread reads. The
+ * placement is a preference, if the node runs out of memory the pages come from somewhere else. Arenas turn
+ * MAG_MEM_NUMA_LOCAL into the node of the thread that creates them, so every block they ever allocate lands on that node.
+ * Create per-thread arenas on the worker thread itself (e.g. at the start of a CoyThreadPool task) to keep them local.
+ *
+ * Only Linux (mbind) and Windows (VirtualAllocExNuma, without interleaving) support this, elsewhere it is ignored.
+ */
+typedef enum
+{
+    MAG_MEM_NUMA_DEFAULT,   /* The OS policy, usually the node of the first thread to touch each page. */
+    MAG_MEM_NUMA_LOCAL,     /* The node of the calling thread.                                         */
+    MAG_MEM_NUMA_NODE,      /* The node in MagMemoryOptions.numa_node.                                 */
+    MAG_MEM_NUMA_INTERLEAVE /* Round robin over all nodes, page by page.                               */
+} MagMemoryNuma;
+
+/* Zero initialized options are the platform defaults, same as mag_sys_memory_allocate. */
+typedef struct
+{
+    MagMemoryPopulate populate;
+    MagMemoryPages pages;
+    MagMemoryNuma numa;
+    i32 numa_node; /* only used with MAG_MEM_NUMA_NODE */
+} MagMemoryOptions;
+
+static inline MagMemoryBlock mag_sys_memory_allocate(size minimum_num_bytes);
+static inline MagMemoryBlock mag_sys_memory_allocate_options(size minimum_num_bytes, MagMemoryOptions options);
+static inline void mag_sys_memory_free(MagMemoryBlock *mem);
+
+/* Reserve address space without any memory behind it, then commit and decommit pages inside of it as needed. A reserved 
+ * block is released with mag_sys_memory_free. The start and size of commit / decommit calls must be multiples of the page
+ * size. Committed pages are zeroed by the OS when they are first touched. On emscripten there is no virtual memory, so a 
+ * reservation allocates everything up front and commit / decommit do nothing.
+ */
+static inline size mag_sys_memory_page_size(void);
+static inline MagMemoryBlock mag_sys_memory_reserve(size minimum_num_bytes);
+static inline b32 mag_sys_memory_commit(void *start, size num_bytes);
+static inline void mag_sys_memory_decommit(void *start, size num_bytes);
+static inline MagMemoryBlock mag_wrap_memory(size buf_size, void *buffer);
+
+/* Give the physical memory behind committed pages back to the OS while the pages stay committed and usable, the next
+ * touch faults in a fresh page. Meant for memory that will be needed again but not soon, an arena after a big job. The
+ * contents are lost, what the pages hold afterwards depends on the platform (zeros on Linux and Apple). Start and size
+ * must be multiples of the page size backing the memory. Does nothing on emscripten.
+ */
+static inline void mag_sys_memory_purge(void *start, size num_bytes);
+
+/* NUMA topology, see MagMemoryNuma. Without NUMA support there is one node, node 0. The current node can change as soon as
+ * the OS moves the thread to another CPU, pin threads that care.
+ *
+ * mag_sys_memory_first_touch faults in every page of the range from the calling thread, so with MAG_MEM_NUMA_DEFAULT the
+ * pages land on its node. Allocate a big shared buffer lazily, then have each worker first touch the part it works on
+ * before anyone else uses the memory. It writes back whatever value each touched byte already holds.
+ */
+static inline i32 mag_sys_memory_numa_num_nodes(void);
+static inline i32 mag_sys_memory_numa_current_node(void);
+static inline void mag_sys_memory_first_touch(void *start, size num_bytes);
+
+/* Map the same pages twice, back to back, so mem[i] and mem[i + size] are the same byte for all i < size. Any span of up
+ * to size bytes starting anywhere in the first half is contiguous, which takes the wrap around logic out of circular
+ * buffers, see MagRingBuffer. The size is rounded up to the page size (the allocation granularity on Windows) and 2 * size
+ * bytes of address space are used. Free it with mag_sys_memory_free like any other block. Not supported on emscripten, it
+ * returns an invalid block there.
+ */
+static inline MagMemoryBlock mag_sys_memory_allocate_mirrored(size minimum_num_bytes);
+
+/* Map a file into memory, creating it if it doesn't exist. The mapping is shared, so what is already in the file is there to
+ * read and writes end up in the file. A file smaller than minimum_num_bytes is grown to that rounded up to the page size,
+ * anything else is mapped whole and left as it is (with 0 that is any existing file, an empty one is an error). Free it
+ * with mag_sys_memory_free. mag_sys_memory_flush waits until the changes are on disk, on Windows only until the OS has
+ * them. Not supported on emscripten, it returns an invalid block.
+ */
+static inline MagMemoryBlock mag_sys_memory_map_file(char const *path, size minimum_num_bytes);
+static inline b32 mag_sys_memory_flush(MagMemoryBlock *mem);
+
+#define MAG_MEM_IS_VALID(mem_block) (((mem_block).flags & 0x01u) > 0)
+#define MAG_MEM_IS_OWNED(mem_block) (((mem_block).flags & 0x02u) > 0)
+#define MAG_MEM_IS_VALID_AND_OWNED(mem_block) (((mem_block).flags & (0x01u | 0x02u)) == 0x03u)
+#define MAG_MEM_IS_MIRRORED(mem_block) (((mem_block).flags & 0x04u) > 0)
+#define MAG_MEM_IS_FILE_MAPPED(mem_block) (((mem_block).flags & 0x08u) > 0)
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                      Ring Buffer
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * A byte queue on top of mirrored memory. Everything waiting to be read is always one contiguous span, and so is all the
+ * free space, no matter where they are in the buffer. Streaming parsers can work directly on the data and readers can
+ * fill the free space in one call, without any copies to handle the wrap around.
+ *
+ * Write into mag_ring_buffer_write_ptr() and then mag_ring_buffer_commit() what was written, read from
+ * mag_ring_buffer_read_ptr() and then mag_ring_buffer_consume() what was used. Not thread safe.
+ */
+typedef struct
+{
+    MagMemoryBlock buf;  /* Mirrored memory, buf.size is the capacity.                      */
+    size read_offset;    /* Where the data starts, always in the first half of the mapping. */
+    size len;            /* Bytes waiting to be read.                                       */
+} MagRingBuffer;
+
+static inline MagRingBuffer mag_ring_buffer_create(size minimum_capacity);  /* Check MAG_MEM_IS_VALID(ring.buf) for errors. */
+static inline void mag_ring_buffer_destroy(MagRingBuffer *ring);
+static inline size mag_ring_buffer_capacity(MagRingBuffer const *ring);
+static inline size mag_ring_buffer_free_space(MagRingBuffer const *ring);
+static inline byte *mag_ring_buffer_read_ptr(MagRingBuffer *ring);          /* ring->len contiguous bytes.                */
+static inline void mag_ring_buffer_consume(MagRingBuffer *ring, size num_bytes);
+static inline byte *mag_ring_buffer_write_ptr(MagRingBuffer *ring);         /* free space contiguous bytes.               */
+static inline void mag_ring_buffer_commit(MagRingBuffer *ring, size num_bytes);
+static inline b32 mag_ring_buffer_push(MagRingBuffer *ring, size num_bytes, void const *src); /* false if it won't fit.   */
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                 Allocation Statistics
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * Define MAG_STATS to 1 and the static, dynamic, and virtual arenas, the static and dynamic pools, and the TLSF allocator 
+ * keep count of what they do in a member named stats. Use them to tune things like the default_block_size of a dynamic 
+ * arena for a job, lots of blocks means it is too small and a peak far below it means it is too big. With MAG_STATS 0 
+ * (the default) the member doesn't exist and none of the counting is compiled in.
+ *
+ * bytes_in_use is what has been handed out (padding included) and not freed, reset, or restored away yet. The arenas can
+ * only free their last allocation. A realloc that has to copy also counts as an allocation. Blocks are whatever the 
+ * allocator gets from the OS: dynamic arena and pool blocks, virtual arena commits, or the one buffer the others own.
+ *
+ * The allocators meant to be shared between threads (concurrent arena, concurrent pool, slab) keep their stats in
+ * relaxed atomics instead, get a MagAllocStats snapshot with mag_atomic_alloc_stats_read. Concurrent arena caches and
+ * slab magazines count on their own and add to the allocator's counts when they go back to it for more memory (or the
+ * magazine is flushed), so a snapshot misses what each of them did since. Their peak is the highest bytes_in_use any of
+ * those updates saw. None of them realloc.
+ */
+typedef struct
+{
+    u64 num_allocs;
+    u64 bytes_requested;       /* Sum of the num_bytes asked for.                   */
+    u64 bytes_padding;         /* Bytes lost to alignment and size rounding.        */
+    u64 num_blocks;            /* Times memory was acquired from the OS.            */
+    u64 num_realloc_in_place;
+    u64 num_realloc_copy;
+    size bytes_in_use;
+    size peak_bytes_in_use;    /* High water mark of bytes_in_use.                  */
+} MagAllocStats;
+
+typedef struct
+{
+    _Atomic(u64) num_allocs;
+    _Atomic(u64) bytes_requested;
+    _Atomic(u64) bytes_padding;
+    _Atomic(u64) num_blocks;
+    _Atomic(size) bytes_in_use;
+    _Atomic(size) peak_bytes_in_use;
+} MagAtomicAllocStats;
+
+#if MAG_STATS
+#define MAG_STATS_UPDATE(update) update
+static inline void mag_alloc_stats_print(char const *label, MagAllocStats const *stats); /* One line to stdout. */
+static inline MagAllocStats mag_atomic_alloc_stats_read(MagAtomicAllocStats *stats);    /* Snapshot, no reallocs.  */
+#else
+#define MAG_STATS_UPDATE(update)
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                 Static Arena Allocator
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * A statically sized, non-growable arena allocator that works on top of a user supplied buffer, or one created by the 
+ * library depending on how the arena is created.
+ *
+ * Allocations are zeroed. The *_alloc_uninit versions (here and for the other arenas) skip the memset, use them for large
+ * buffers that are about to be completely overwritten anyway, like file contents or sort scratch space.
+ */
+
+typedef struct
+{
+    MagMemoryBlock buf;
+    size buf_offset;
+
+    /* Keep track of the previous allocation for realloc and free. */
+    void *prev_ptr;
+    size prev_offset;
+
+#if MAG_STATS
+    MagAllocStats stats;
+#endif
+} MagStaticArena;
+
+static inline MagStaticArena mag_static_arena_create(size buf_size, byte buffer[]);
+static inline MagStaticArena mag_static_arena_allocate_and_create(size num_bytes);
+static inline MagStaticArena mag_static_arena_allocate_and_create_options(size num_bytes, MagMemoryOptions options);
+static inline void mag_static_arena_destroy(MagStaticArena *arena);
+
+/* WARNING: If you do a reset with a copy of the original arena struct (e.g. pass by value), it will corrupt the arena. */
+static inline void mag_static_arena_reset(MagStaticArena *arena);                                           /* Set offset to 0, invalidates all previous allocations */
+
+static inline void *mag_static_arena_alloc(MagStaticArena *arena, size num_bytes, size alignment);          /* ret NULL if out of memory (OOM)                       */
+static inline void *mag_static_arena_alloc_uninit(MagStaticArena *arena, size num_bytes, size alignment);   /* Same as above, but memory is NOT zeroed               */
+static inline void *mag_static_arena_realloc(MagStaticArena *arena, void *ptr, size asize, size alignment); /* ret NULL if ptr is not most recent allocation         */
+static inline void mag_static_arena_free(MagStaticArena *arena, void *ptr);                                 /* Undo if it was last allocation, otherwise no-op       */
+
+/* Also see eco_arena_malloc and related macros below. */
+#define mag_static_arena_malloc(arena, type)                (type *)MAG_TRACE_CALL(mag_static_arena_alloc,        (arena), sizeof(type), _Alignof(type))
+#define mag_static_arena_nmalloc(arena, count, type)        (type *)MAG_TRACE_CALL(mag_static_arena_alloc,        (arena), (count) * sizeof(type), _Alignof(type))
+#define mag_static_arena_nrealloc(arena, ptr, count, type)  (type *)MAG_TRACE_CALL(mag_static_arena_realloc,      (arena), (ptr), sizeof(type) * (count), _Alignof(type))
+#define mag_static_arena_malloc_uninit(arena, type)         (type *)MAG_TRACE_CALL(mag_static_arena_alloc_uninit, (arena), sizeof(type), _Alignof(type))
+#define mag_static_arena_nmalloc_uninit(arena, count, type) (type *)MAG_TRACE_CALL(mag_static_arena_alloc_uninit, (arena), (count) * sizeof(type), _Alignof(type))
+
+/* Persistent static arenas. The arena lives in a file mapping, so whatever is built in it outlives the process. Open the
+ * file again on the next start and the data is ready to use, no rebuilding. A small header at the front of the file keeps
+ * the arena's offset and a root, the one allocation to look up after reopening (e.g. a table header) that everything else
+ * hangs off of.
+ *
+ * The file can land at a different address every time it is mapped, so pointers stored in the arena are garbage after a
+ * reopen. Store offsets instead, mag_static_arena_offset_of() and mag_static_arena_ptr_at() convert back and forth, and
+ * offset 0 is the header so it works as NULL. The layout of the data is the file format, a file is only good for builds
+ * with the same struct layouts.
+ *
+ * mag_static_arena_destroy() saves the offset and unmaps the file, mag_static_arena_sync() saves it and waits for the disk.
+ * If the process dies, anything allocated since the last sync may be handed out again after reopening. Resetting keeps the
+ * header and clears the root. Only one process at a time should have a file open.
+ */
+static inline MagStaticArena mag_static_arena_open_file(char const *path, size num_bytes); /* Check MAG_MEM_IS_VALID(arena.buf) */
+static inline b32 mag_static_arena_sync(MagStaticArena *arena);
+static inline void mag_static_arena_set_root(MagStaticArena *arena, void *root);
+static inline void *mag_static_arena_root(MagStaticArena const *arena);                     /* NULL if never set          */
+static inline size mag_static_arena_offset_of(MagStaticArena const *arena, void const *ptr); /* 0 for NULL                 */
+static inline void *mag_static_arena_ptr_at(MagStaticArena const *arena, size offset);       /* NULL for 0                 */
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                Dynamic Arena Allocator
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * A dynamically growable arena allocator that works with the system allocator to grow indefinitely.
+ *
+ * Always use a pointer to the arena to collect the correct usage statistics. Utilize a save-point if you want to pass it
+ * in to a temporary function and then restore to the save point when you get it back, see mag_dyn_arena_savepoint().
+ */
+
+/* A dynamically size arena. */
+typedef struct MagDynArenaBlock MagDynArenaBlock;
+typedef struct 
+{
+    MagDynArenaBlock *head_block;
+    MagDynArenaBlock *current_block;
+    size current_offset;
+    size default_block_size;
+    MagMemoryOptions block_options; /* used for every block this arena allocates */
+
+    /* Keep track of the previous allocation for realloc and free. */
+    void *prev_ptr;
+    size prev_offset;
+
+#if MAG_STATS
+    MagAllocStats stats;
+#endif
+} MagDynArena;
+
+static inline MagDynArena mag_dyn_arena_create(size default_block_size);
+static inline MagDynArena mag_dyn_arena_create_options(size default_block_size, MagMemoryOptions options);
+static inline void mag_dyn_arena_destroy(MagDynArena *arena);
+
+/* WARNING: If you do a reset with a copy of the original arena struct (e.g. pass by value), it will corrupt the arena. */
+static inline void mag_dyn_arena_reset(MagDynArena *arena, b32 coalesce);                                 /* Coalesce, keep the same size but in single block, else frees all excess blocks. */
+static inline void mag_dyn_arena_reset_default(MagDynArena *arena);                                       /* Assumes Coalesce is true.                                                       */
+static inline void *mag_dyn_arena_alloc(MagDynArena *arena, size num_bytes, size alignment);              /* ret NULL if out of memory (OOM)                                                 */
+static inline void *mag_dyn_arena_alloc_uninit(MagDynArena *arena, size num_bytes, size alignment);       /* Same as above, but memory is NOT zeroed                                         */
+static inline void *mag_dyn_arena_realloc(MagDynArena *arena, void *ptr, size num_bytes, size alignment); /* May move memory to a new address.                                               */
+static inline void mag_dyn_arena_free(MagDynArena *arena, void *ptr);                                     /* Undo if it was last allocation, otherwise no-op                                 */
+
+#define mag_dyn_arena_malloc(arena, type)                (type *)MAG_TRACE_CALL(mag_dyn_arena_alloc,        (arena),           sizeof(type),           _Alignof(type))
+#define mag_dyn_arena_nmalloc(arena, count, type)        (type *)MAG_TRACE_CALL(mag_dyn_arena_alloc,        (arena), (count) * sizeof(type),           _Alignof(type))
+#define mag_dyn_arena_nrealloc(arena, ptr, count, type)  (type *)MAG_TRACE_CALL(mag_dyn_arena_realloc,      (arena), (ptr),  sizeof(type) * (count), _Alignof(type))
+#define mag_dyn_arena_malloc_uninit(arena, type)         (type *)MAG_TRACE_CALL(mag_dyn_arena_alloc_uninit, (arena),           sizeof(type), _Alignof(type))
+#define mag_dyn_arena_nmalloc_uninit(arena, count, type) (type *)MAG_TRACE_CALL(mag_dyn_arena_alloc_uninit, (arena), (count) * sizeof(type), _Alignof(type))
+
+static inline size mag_dyn_arena_usage_ceiling(MagDynArena *arena);
+
+/* A coalescing reset keeps the high water mark resident for good, so one big job can pin gigabytes for the rest of a long
+ * running process. mag_dyn_arena_reset_trim() doesn't coalesce and keeps every block and its address space, but the pages
+ * past the first watermark bytes of the arena are purged (see mag_sys_memory_purge). They fault back in as they are used
+ * again, so resident memory follows what the jobs actually use instead of the biggest one so far. The price is the page
+ * faults when the next big job comes along.
+ */
+static inline void mag_dyn_arena_reset_trim(MagDynArena *arena, size watermark);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                               Dynamic Arena Block Cache
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * Short lived dynamic arenas (one per request, one per file, etc) map and unmap their blocks every time they are created
+ * and destroyed, which means system calls and page faults on fresh pages every time. With the block cache turned on, 
+ * blocks freed by destroy and reset go into a cache instead, and new blocks come from the cache when one is big enough. 
+ * The memory is still mapped, and the pages the block's last arena touched are still faulted in.
+ *
+ * Blocks are kept in lists by size class (the highest bit of their size). A request takes the first big enough block 
+ * from its own class, or any block from the next class up, so a block is never more than about 4 times bigger than asked 
+ * for. When keeping a block would put the cache over its limit, the block goes back to the OS.
+ *
+ * The cache is off (a limit of 0) until mag_block_cache_configure is called. It is shared by all threads and protected by 
+ * a spin lock. Blocks that use huge pages, are placed on a NUMA node, or populate in the background are never cached, so
+ * arenas with those options always map and unmap their own. Arenas that ask for MAG_MEM_POPULATE_NOW give their blocks to
+ * the cache but never take from it, since a cached block may be missing pages. Like everything else in this library, the
+ * cache is per translation unit.
+ */
+#define MAG_BLOCK_CACHE_NUM_CLASSES 64
+
+typedef struct
+{
+    atomic_flag lock;
+    _Atomic(size) max_bytes;                                   /* 0 means the cache is off. */
+    size cached_bytes;
+    MagDynArenaBlock *classes[MAG_BLOCK_CACHE_NUM_CLASSES];
+} MagBlockCache;
+
+static MagBlockCache mag_block_cache;
+
+static inline void mag_block_cache_configure(size max_bytes); /* Set the limit, trims down to it. 0 turns the cache off. */
+static inline void mag_block_cache_trim(size max_bytes);      /* Give blocks back to the OS until at most max_bytes are left. */
+static inline size mag_block_cache_bytes(void);               /* How many bytes the cache is holding.                       */
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                             Virtual Memory Arena Allocator
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * An arena that reserves a large range of address space up front and commits pages as the allocations reach them, so all
+ * allocations are contiguous, growing the most recent allocation with realloc never copies, and the reserved but unused
+ * address space costs no memory. Reserve generously, e.g. many GiB on 64 bit systems.
+ *
+ * Memory is committed in chunks of MAG_VIRTUAL_ARENA_COMMIT_CHUNK bytes to limit the number of system calls. Resetting with
+ * decommit = true returns all the committed pages to the OS, mag_virtual_arena_reset_default() does that. Freshly committed
+ * pages are already zero, so zeroing allocations only memset memory that was used before.
+ */
+#define MAG_VIRTUAL_ARENA_COMMIT_CHUNK ECO_MiB(1)
+
+typedef struct
+{
+    MagMemoryBlock buf;     /* The whole reserved range.                                           */
+    size buf_offset;
+    size committed;         /* Bytes committed from the start of buf.                              */
+    size high_water;        /* Memory at and beyond this offset hasn't been touched since commit.  */
+
+    /* Keep track of the previous allocation for realloc and free. */
+    void *prev_ptr;
+    size prev_offset;
+
+#if MAG_STATS
+    MagAllocStats stats;
+#endif
+} MagVirtualArena;
+
+static inline MagVirtualArena mag_virtual_arena_create(size reserve_num_bytes);
+static inline void mag_virtual_arena_destroy(MagVirtualArena *arena);
+
+/* WARNING: If you do a reset with a copy of the original arena struct (e.g. pass by value), it will corrupt the arena. */
+static inline void mag_virtual_arena_reset(MagVirtualArena *arena, b32 decommit);                                 /* Decommit returns the memory to the OS.         */
+static inline void mag_virtual_arena_reset_default(MagVirtualArena *arena);                                       /* Assumes decommit is true.                      */
+static inline void mag_virtual_arena_reset_trim(MagVirtualArena *arena, size watermark);                          /* Only decommit past watermark bytes.            */
+static inline void *mag_virtual_arena_alloc(MagVirtualArena *arena, size num_bytes, size alignment);              /* ret NULL if out of reserved space              */
+static inline void *mag_virtual_arena_alloc_uninit(MagVirtualArena *arena, size num_bytes, size alignment);       /* Same as above, but memory is NOT zeroed        */
+static inline void *mag_virtual_arena_realloc(MagVirtualArena *arena, void *ptr, size num_bytes, size alignment); /* Only copies if ptr wasn't the last allocation. */
+static inline void mag_virtual_arena_free(MagVirtualArena *arena, void *ptr);                                     /* Undo if it was last allocation, otherwise no-op*/
+
+#define mag_virtual_arena_malloc(arena, type)               (type *)mag_virtual_arena_alloc((arena),           sizeof(type),           _Alignof(type))
+#define mag_virtual_arena_nmalloc(arena, count, type)       (type *)mag_virtual_arena_alloc((arena), (count) * sizeof(type),           _Alignof(type))
+#define mag_virtual_arena_nrealloc(arena, ptr, count, type) (type *)mag_virtual_arena_realloc((arena), (ptr),  sizeof(type) * (count), _Alignof(type))
+#define mag_virtual_arena_malloc_uninit(arena, type)         (type *)mag_virtual_arena_alloc_uninit((arena),           sizeof(type), _Alignof(type))
+#define mag_virtual_arena_nmalloc_uninit(arena, count, type) (type *)mag_virtual_arena_alloc_uninit((arena), (count) * sizeof(type), _Alignof(type))
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                               Concurrent Arena Allocator
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * A growable arena many threads can allocate from at the same time, e.g. parallel parsing stages writing into shared output 
+ * storage. Allocations bump the offset of the current block with an atomic fetch-add. When a block is full, the thread 
+ * that noticed allocates a new one and swaps it in with a compare-and-swap, there are no locks. A thread that loses that 
+ * race keeps its block as a spare for the next time the arena grows.
+ *
+ * Large allocations (more than a quarter of the default block size) get a block of their own so they don't waste the rest
+ * of the current one.
+ *
+ * Threads that allocate a lot should each use a MagConcurrentArenaCache. It grabs a chunk of the arena at a time and hands
+ * out allocations from it without any atomic operations. A cache belongs to a single thread.
+ *
+ * There is no realloc or free, and create, destroy, and reset are NOT thread safe. A reset invalidates all the caches, 
+ * create new ones after it. This isn't part of MagAllocator since it can't do what the other arenas can.
+ */
+#define MAG_CONCURRENT_ARENA_GRAIN ((size)16)        /* Every allocation is a multiple of this and aligned to it. */
+#define MAG_CONCURRENT_ARENA_CACHE_SIZE ECO_KiB(64)  /* How much a cache takes from the arena at a time.          */
+
+typedef struct MagConcurrentArenaBlock MagConcurrentArenaBlock;
+typedef struct
+{
+    _Atomic(MagConcurrentArenaBlock *) current; /* The block being bumped.                                    */
+    _Atomic(MagConcurrentArenaBlock *) blocks;  /* Every block the arena owns, newest first.                   */
+    _Atomic(MagConcurrentArenaBlock *) spare;   /* A block from a lost growth race, not in the blocks list.   */
+    size default_block_size;
+    MagMemoryOptions block_options;
+
+#if MAG_STATS
+    MagAtomicAllocStats stats;
+#endif
+} MagConcurrentArena;
+
+static inline MagConcurrentArena mag_concurrent_arena_create(size default_block_size);
+static inline MagConcurrentArena mag_concurrent_arena_create_options(size default_block_size, MagMemoryOptions options);
+static inline void mag_concurrent_arena_destroy(MagConcurrentArena *arena);
+static inline void mag_concurrent_arena_reset(MagConcurrentArena *arena);                                   /* Keeps the newest block, frees the rest.     */
+
+static inline void *mag_concurrent_arena_alloc(MagConcurrentArena *arena, size num_bytes, size alignment);        /* Thread safe, ret NULL if out of memory.     */
+static inline void *mag_concurrent_arena_alloc_uninit(MagConcurrentArena *arena, size num_bytes, size alignment); /* Same as above, but memory is NOT zeroed.    */
+
+#define mag_concurrent_arena_malloc(arena, type)               (type *)mag_concurrent_arena_alloc((arena),           sizeof(type), _Alignof(type))
+#define mag_concurrent_arena_nmalloc(arena, count, type)       (type *)mag_concurrent_arena_alloc((arena), (count) * sizeof(type), _Alignof(type))
+#define mag_concurrent_arena_malloc_uninit(arena, type)         (type *)mag_concurrent_arena_alloc_uninit((arena),           sizeof(type), _Alignof(type))
+#define mag_concurrent_arena_nmalloc_uninit(arena, count, type) (type *)mag_concurrent_arena_alloc_uninit((arena), (count) * sizeof(type), _Alignof(type))
+
+typedef struct
+{
+    MagConcurrentArena *arena;
+    byte *next;
+    byte *end;
+
+#if MAG_STATS
+    MagAllocStats stats; /* Not added to the arena's yet. */
+#endif
+} MagConcurrentArenaCache;
+
+static inline MagConcurrentArenaCache mag_concurrent_arena_cache_create(MagConcurrentArena *arena);
+static inline void *mag_concurrent_arena_cache_alloc(MagConcurrentArenaCache *cache, size num_bytes, size alignment);
+static inline void *mag_concurrent_arena_cache_alloc_uninit(MagConcurrentArenaCache *cache, size num_bytes, size alignment);
+
+#define mag_concurrent_arena_cache_malloc(cache, type)         (type *)mag_concurrent_arena_cache_alloc((cache),           sizeof(type), _Alignof(type))
+#define mag_concurrent_arena_cache_nmalloc(cache, count, type) (type *)mag_concurrent_arena_cache_alloc((cache), (count) * sizeof(type), _Alignof(type))
+#define mag_concurrent_arena_cache_malloc_uninit(cache, type)  (type *)mag_concurrent_arena_cache_alloc_uninit((cache),   sizeof(type), _Alignof(type))
+#define mag_concurrent_arena_cache_nmalloc_uninit(cache, count, type)                                                        \
+    (type *)mag_concurrent_arena_cache_alloc_uninit((cache), (count) * sizeof(type), _Alignof(type))
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                    Arena Savepoints
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * Take a savepoint before handing an arena to code that only needs temporary memory, then restore it afterwards to throw
+ * away everything allocated since. This is the safe way to "borrow" an arena, copying the arena struct and using the copy
+ * corrupts the original.
+ *
+ * Savepoints must be restored in the reverse order they were taken (like a stack), and a savepoint is invalidated by
+ * restoring an older one or resetting the arena. A dynamic arena keeps any blocks it added after the savepoint, so they
+ * are reused by the next allocations instead of going back to the OS. A virtual arena keeps its committed pages.
+ */
+typedef struct
+{
+    void *block;       /* The current block of a dynamic arena, unused by the other arenas. */
+    size offset;
+
+    void *prev_ptr;
+    size prev_offset;
+
+#if MAG_STATS
+    size bytes_in_use; /* Only used by the dynamic arena, the others work it out from offset. */
+#endif
+} MagArenaSavepoint;
+
+static inline MagArenaSavepoint mag_static_arena_savepoint(MagStaticArena *arena);
+static inline void mag_static_arena_restore(MagStaticArena *arena, MagArenaSavepoint savepoint);
+static inline MagArenaSavepoint mag_dyn_arena_savepoint(MagDynArena *arena);
+static inline void mag_dyn_arena_restore(MagDynArena *arena, MagArenaSavepoint savepoint);
+static inline MagArenaSavepoint mag_virtual_arena_savepoint(MagVirtualArena *arena);
+static inline void mag_virtual_arena_restore(MagVirtualArena *arena, MagArenaSavepoint savepoint);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                  Static Pool Allocator
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * This is an error prone and brittle type. If you get it all working, a refactor or code edit later is likely to break it.
+ *
+ * WARNING: It is the user's responsibility to make sure that there is at least object_size * num_objects bytes in the
+ * backing buffer. If that isn't true, you'll probably get a seg-fault during initialization.
+ *
+ * WARNING: Object_size must be a multiple of sizeof(void*) to ensure the buffer is aligned to hold pointers also.
+ *
+ * WARNING: It is the user's responsibility to make sure the buffer is correctly aligned for the type of objects they will
+ * be storing in it. If using a stack allocated or static memory section, you should use an _Alignas to force the alignment.
+ */
+typedef struct 
+{
+    size object_size;    /* The size of each object                                 */
+    size num_objects;    /* The capacity, or number of objects storable in the pool */
+    void *free;          /* The head of a free list of available slots for objects  */
+    MagMemoryBlock buf;  /* The buffer we actually store the data in                */
+
+#if MAG_STATS
+    MagAllocStats stats;
+#endif
+} MagStaticPool;
+
+static inline MagStaticPool mag_static_pool_create(size object_size, size num_objects, byte buffer[]);
+static inline void mag_static_pool_destroy(MagStaticPool *pool);
+static inline void mag_static_pool_reset(MagStaticPool *pool);
+static inline void mag_static_pool_free(MagStaticPool *pool, void *ptr);
+static inline void *mag_static_pool_alloc(MagStaticPool *pool); /* returns NULL if there's no more space available. */
+/* no mag_static_pool_realloc because that doesn't make sense! */
+
+#define mag_static_pool_malloc(alloc, type) (type *)mag_static_pool_alloc(alloc)
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                  Dynamic Pool Allocator
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * A pool of same sized objects that never runs out. When the free list is empty it gets another block with room for
+ * objects_per_block objects from the OS and threads it onto the free list. Blocks are only returned to the OS by destroy.
+ *
+ * Objects are aligned to the largest power of 2 that divides object_size, up to _Alignof(max_align_t). Not thread safe, see
+ * MagConcurrentPool for that.
+ */
+typedef struct MagDynPoolBlock MagDynPoolBlock;
+typedef struct
+{
+    size object_size;
+    size objects_per_block;
+    void *free;               /* The head of a free list of available slots for objects  */
+    MagDynPoolBlock *blocks;  /* Every block this pool owns.                              */
+
+#if MAG_STATS
+    MagAllocStats stats;
+#endif
+} MagDynPool;
+
+static inline MagDynPool mag_dyn_pool_create(size object_size, size objects_per_block);
+static inline void mag_dyn_pool_destroy(MagDynPool *pool);
+static inline void mag_dyn_pool_reset(MagDynPool *pool);      /* Everything is free again, keeps the blocks.         */
+static inline void mag_dyn_pool_free(MagDynPool *pool, void *ptr);
+static inline void *mag_dyn_pool_alloc(MagDynPool *pool);     /* returns NULL only if the OS is out of memory.        */
+
+#define mag_dyn_pool_malloc(alloc, type) (type *)mag_dyn_pool_alloc(alloc)
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                Concurrent Pool Allocator
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * A lock-free pool of same sized objects that any thread can allocate from or free to, e.g. messages allocated by one
+ * pipeline stage and freed by the next. It reserves address space for max_objects up front and commits it as the pool is
+ * used, like MagVirtualArena, so a generous max_objects is cheap.
+ *
+ * The free list is a Treiber stack. Objects are identified by a 32 bit index, and the head of the list packs that index
+ * with a 32 bit tag that changes on every push and pop. This makes compare-and-swap on the head safe from the ABA problem
+ * with plain 64 bit atomics.
+ *
+ * Objects are aligned to the largest power of 2 that divides object_size, up to the page size. Create, destroy, and reset
+ * are NOT thread safe.
+ */
+#define MAG_CONCURRENT_POOL_COMMIT_CHUNK ECO_KiB(64)
+
+typedef struct
+{
+    MagMemoryBlock buf;        /* Address space reserved for max_objects.                                    */
+    size object_size;
+    u32 max_objects;
+    _Atomic(u64) head;         /* Index of the first free object in the low 32 bits, ABA tag in the high 32. */
+    _Atomic(u32) num_touched;  /* Objects below this index have been handed out at least once.              */
+    _Atomic(size) committed;   /* Bytes committed from the start of buf.                                     */
+
+#if MAG_STATS
+    MagAtomicAllocStats stats;
+#endif
+} MagConcurrentPool;
+
+static inline MagConcurrentPool mag_concurrent_pool_create(size object_size, u32 max_objects);
+static inline void mag_concurrent_pool_destroy(MagConcurrentPool *pool);
+static inline void mag_concurrent_pool_reset(MagConcurrentPool *pool);
+static inline void mag_concurrent_pool_free(MagConcurrentPool *pool, void *ptr);      /* Thread safe.                         */
+static inline void *mag_concurrent_pool_alloc(MagConcurrentPool *pool);               /* Thread safe, NULL if out of objects. */
+static inline void *mag_concurrent_pool_alloc_uninit(MagConcurrentPool *pool);        /* Same as above, but NOT zeroed.       */
+
+#define mag_concurrent_pool_malloc(alloc, type) (type *)mag_concurrent_pool_alloc(alloc)
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                     TLSF Allocator
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * A general purpose allocator with individual frees using two-level segregated fit (TLSF). Allocating and freeing take a
+ * bounded amount of time no matter how many allocations are live, and neighboring free blocks are always merged, so it
+ * holds up well in long running programs that free things in any order (caches, hash map nodes, etc).
+ *
+ * Free blocks are kept in lists bucketed by the highest bit of their size (first level) and then split into
+ * MAG_TLSF_SL_COUNT linear ranges (second level). A bitmap for each level finds the first non-empty list big enough for a 
+ * request with a couple of bit scans. Allocations may waste up to 1/MAG_TLSF_SL_COUNT of their size to keep it O(1).
+ *
+ * All the bookkeeping lives at the start of the memory block, which never grows. Every allocation has a 16 byte header.
+ */
+#define MAG_TLSF_SL_COUNT_LOG2 5
+#define MAG_TLSF_SL_COUNT (1 << MAG_TLSF_SL_COUNT_LOG2)
+#define MAG_TLSF_ALIGN_LOG2 4
+#define MAG_TLSF_ALIGN (1 << MAG_TLSF_ALIGN_LOG2)                         /* Minimum alignment of all allocations.       */
+#define MAG_TLSF_FL_SHIFT (MAG_TLSF_SL_COUNT_LOG2 + MAG_TLSF_ALIGN_LOG2)
+#define MAG_TLSF_FL_MAX 40                                                /* Largest block is just under 2^40 bytes.      */
+#define MAG_TLSF_FL_COUNT (MAG_TLSF_FL_MAX - MAG_TLSF_FL_SHIFT + 1)
+
+typedef struct MagTlsfBlock MagTlsfBlock;
+typedef struct MagTlsfControl MagTlsfControl;
+
+typedef struct
+{
+    MagMemoryBlock buf;
+    MagTlsfControl *control; /* Stored at the beginning of buf. */
+
+#if MAG_STATS
+    MagAllocStats stats;
+#endif
+} MagTlsf;
+
+static inline MagTlsf mag_tlsf_create(size num_bytes);
+static inline MagTlsf mag_tlsf_create_options(size num_bytes, MagMemoryOptions options);
+static inline void mag_tlsf_destroy(MagTlsf *tlsf);
+static inline void mag_tlsf_reset(MagTlsf *tlsf);                                                 /* Free everything at once.                    */
+static inline void *mag_tlsf_alloc(MagTlsf *tlsf, size num_bytes, size alignment);                /* ret NULL if there is no big enough block.   */
+static inline void *mag_tlsf_alloc_uninit(MagTlsf *tlsf, size num_bytes, size alignment);         /* Same as above, but memory is NOT zeroed.    */
+static inline void *mag_tlsf_realloc(MagTlsf *tlsf, void *ptr, size num_bytes, size alignment);   /* Grows in place if the next block is free.   */
+static inline void mag_tlsf_free(MagTlsf *tlsf, void *ptr);                                       /* NULL is a no-op.                            */
+static inline size mag_tlsf_usable_size(void *ptr);                                               /* Bytes available at ptr, at least requested. */
+
+#define mag_tlsf_malloc(tlsf, type)               (type *)mag_tlsf_alloc((tlsf),           sizeof(type),           _Alignof(type))
+#define mag_tlsf_nmalloc(tlsf, count, type)       (type *)mag_tlsf_alloc((tlsf), (count) * sizeof(type),           _Alignof(type))
+#define mag_tlsf_nrealloc(tlsf, ptr, count, type) (type *)mag_tlsf_realloc((tlsf), (ptr),  sizeof(type) * (count), _Alignof(type))
+#define mag_tlsf_malloc_uninit(tlsf, type)         (type *)mag_tlsf_alloc_uninit((tlsf),           sizeof(type), _Alignof(type))
+#define mag_tlsf_nmalloc_uninit(tlsf, count, type) (type *)mag_tlsf_alloc_uninit((tlsf), (count) * sizeof(type), _Alignof(type))
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                  Slab Allocator
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * A growable allocator for lots of small objects of assorted sizes. Each request is rounded up to one of a fixed set of
+ * size classes, and each class keeps a free list threaded through its slabs the same way MagStaticPool does. When a class 
+ * runs out, it gets a new slab of slab_size bytes from mag_sys_memory_allocate. Memory is not returned to the OS until
+ * reset or destroy.
+ *
+ * Objects up to MAG_SLAB_MAX_OBJECT_SIZE bytes with alignments up to MAG_SLAB_MAX_ALIGN are supported, bigger requests
+ * return NULL. Freeing requires the same size and alignment used to allocate, that's how the class is found without a 
+ * header on every object.
+ *
+ * Each class has a spin lock, so a MagSlabAllocator can be shared between threads. Threads that allocate a lot should use
+ * a MagSlabMagazine, a per-thread cache of free objects for each class that only takes the lock to move half a magazine 
+ * at a time. Flush a magazine before its thread is done with it, otherwise the objects it holds are stuck there until 
+ * the allocator is reset. Reset and destroy are NOT thread safe, and they invalidate all the magazines.
+ */
+#define MAG_SLAB_NUM_CLASSES 14
+#define MAG_SLAB_MAX_OBJECT_SIZE ECO_KiB(2)
+#define MAG_SLAB_MAX_ALIGN 64
+#define MAG_SLAB_DEFAULT_SLAB_SIZE ECO_KiB(64)
+#define MAG_SLAB_MAGAZINE_SIZE 32
+
+typedef struct MagSlabBlock MagSlabBlock;
+typedef struct
+{
+    size object_size;
+    atomic_flag lock;
+    void *free;              /* Free list threaded through the slabs.  */
+    MagSlabBlock *slabs;     /* Every slab this class owns.            */
+} MagSlabClass;
+
+typedef struct
+{
+    size slab_size;
+    MagSlabClass classes[MAG_SLAB_NUM_CLASSES];
+
+#if MAG_STATS
+    MagAtomicAllocStats stats;
+#endif
+} MagSlabAllocator;
+
+static inline MagSlabAllocator mag_slab_create(size slab_size);                                         /* 0 for the default slab size.  */
+static inline void mag_slab_destroy(MagSlabAllocator *slab);
+static inline void mag_slab_reset(MagSlabAllocator *slab);                                               /* Give all the slabs back.      */
+static inline void *mag_slab_alloc(MagSlabAllocator *slab, size num_bytes, size alignment);              /* ret NULL if too big or OOM.   */
+static inline void *mag_slab_alloc_uninit(MagSlabAllocator *slab, size num_bytes, size alignment);       /* Memory is NOT zeroed.         */
+static inline void mag_slab_free(MagSlabAllocator *slab, void *ptr, size num_bytes, size alignment);     /* Must match the alloc.         */
+
+#define mag_slab_malloc(slab, type)              (type *)mag_slab_alloc((slab),           sizeof(type), _Alignof(type))
+#define mag_slab_nmalloc(slab, count, type)      (type *)mag_slab_alloc((slab), (count) * sizeof(type), _Alignof(type))
+#define mag_slab_malloc_uninit(slab, type)        (type *)mag_slab_alloc_uninit((slab),           sizeof(type), _Alignof(type))
+#define mag_slab_nmalloc_uninit(slab, count, type)(type *)mag_slab_alloc_uninit((slab), (count) * sizeof(type), _Alignof(type))
+#define mag_slab_mfree(slab, ptr, type)           mag_slab_free((slab), (ptr),           sizeof(type), _Alignof(type))
+#define mag_slab_nfree(slab, ptr, count, type)    mag_slab_free((slab), (ptr), (count) * sizeof(type), _Alignof(type))
+
+typedef struct
+{
+    MagSlabAllocator *slab;
+    i32 counts[MAG_SLAB_NUM_CLASSES];
+    void *objects[MAG_SLAB_NUM_CLASSES][MAG_SLAB_MAGAZINE_SIZE];
+
+#if MAG_STATS
+    MagAllocStats stats; /* Not added to the allocator's yet. */
+#endif
+} MagSlabMagazine;
+
+static inline MagSlabMagazine mag_slab_magazine_create(MagSlabAllocator *slab);
+static inline void mag_slab_magazine_flush(MagSlabMagazine *mag);                                        /* Return everything it holds.   */
+static inline void *mag_slab_magazine_alloc(MagSlabMagazine *mag, size num_bytes, size alignment);
+static inline void *mag_slab_magazine_alloc_uninit(MagSlabMagazine *mag, size num_bytes, size alignment);
+static inline void mag_slab_magazine_free(MagSlabMagazine *mag, void *ptr, size num_bytes, size alignment);
+
+#define mag_slab_magazine_malloc(mag, type)         (type *)mag_slab_magazine_alloc((mag),           sizeof(type), _Alignof(type))
+#define mag_slab_magazine_nmalloc(mag, count, type) (type *)mag_slab_magazine_alloc((mag), (count) * sizeof(type), _Alignof(type))
+#define mag_slab_magazine_mfree(mag, ptr, type)      mag_slab_magazine_free((mag), (ptr),           sizeof(type), _Alignof(type))
+#define mag_slab_magazine_nfree(mag, ptr, count, type)                                                                       \
+    mag_slab_magazine_free((mag), (ptr), (count) * sizeof(type), _Alignof(type))
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                 Generalized Allocator
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * A generalized interface to allocators.
+ */
+
+typedef enum { MAG_ALLOC_T_STATIC_ARENA, MAG_ALLOC_T_DYN_ARENA, MAG_ALLOC_T_VIRTUAL_ARENA, MAG_ALLOC_T_TLSF } MagAllocatorType;
+
+typedef struct
+{
+    MagAllocatorType type;
+    union
+    {
+        MagStaticArena static_arena;
+        MagDynArena dyn_arena;
+        MagVirtualArena virtual_arena;
+        MagTlsf tlsf;
+    };
+} MagAllocator;
+
+static inline MagAllocator mag_allocator_dyn_arena_create(size default_block_size);
+static inline MagAllocator mag_allocator_static_arena_create(size buf_size, byte buffer[]);
+static inline MagAllocator mag_allocator_virtual_arena_create(size reserve_num_bytes);
+static inline MagAllocator mag_allocator_tlsf_create(size num_bytes);
+static inline MagAllocator mag_allocator_from_dyn_arena(MagDynArena *arena);         /* Takes ownership of arena and zeros original struct. */
+static inline MagAllocator mag_allocator_from_static_arena(MagStaticArena *arena);   /* Takes ownership of arena and zeros original struct. */
+static inline MagAllocator mag_allocator_from_virtual_arena(MagVirtualArena *arena); /* Takes ownership of arena and zeros original struct. */
+static inline MagAllocator mag_allocator_from_tlsf(MagTlsf *tlsf);                   /* Takes ownership of tlsf and zeros original struct.  */
+
+#define eco_allocator_take(arena) _Generic((arena),                                                                         \
+                                     MagStaticArena *:  mag_allocator_from_static_arena,                                    \
+                                     MagDynArena *:     mag_allocator_from_dyn_arena,                                       \
+                                     MagVirtualArena *: mag_allocator_from_virtual_arena,                                   \
+                                     MagTlsf *:         mag_allocator_from_tlsf                                             \
+                                  )(arena)
+
+static inline void mag_allocator_destroy(MagAllocator *arena);
+static inline void mag_allocator_reset(MagAllocator *arena); /* Clear all previous allocations. */
+static inline void *mag_allocator_alloc(MagAllocator *alloc, size num_bytes, size alignment);
+static inline void *mag_allocator_alloc_uninit(MagAllocator *alloc, size num_bytes, size alignment);
+static inline void *mag_allocator_realloc(MagAllocator *alloc, void *ptr, size num_bytes, size alignment);
+static inline void mag_allocator_free(MagAllocator *alloc, void *ptr);
+static inline MagArenaSavepoint mag_allocator_savepoint(MagAllocator *alloc);                /* Not supported by TLSF allocators. */
+static inline void mag_allocator_restore(MagAllocator *alloc, MagArenaSavepoint savepoint);  /* Not supported by TLSF allocators. */
+
+#if MAG_STATS
+static inline MagAllocStats *mag_allocator_stats(MagAllocator *alloc);                       /* The stats of the wrapped allocator. */
+#endif
+
+#define mag_allocator_malloc(arena, type)                (type *)MAG_TRACE_CALL(mag_allocator_alloc,        (arena),           sizeof(type),           _Alignof(type))
+#define mag_allocator_nmalloc(arena, count, type)        (type *)MAG_TRACE_CALL(mag_allocator_alloc,        (arena), (count) * sizeof(type),           _Alignof(type))
+#define mag_allocator_nrealloc(arena, ptr, count, type)  (type *)MAG_TRACE_CALL(mag_allocator_realloc,      (arena), (ptr),  sizeof(type) * (count), _Alignof(type))
+#define mag_allocator_malloc_uninit(arena, type)         (type *)MAG_TRACE_CALL(mag_allocator_alloc_uninit, (arena),           sizeof(type), _Alignof(type))
+#define mag_allocator_nmalloc_uninit(arena, count, type) (type *)MAG_TRACE_CALL(mag_allocator_alloc_uninit, (arena), (count) * sizeof(type), _Alignof(type))
+
+#define eco_arena_malloc(alloc, type) (type *)(MAG_TRACE_MARK_SITE(alloc), _Generic((alloc),                                \
+                                                           MagStaticArena *:     mag_static_arena_alloc,                    \
+                                                           MagDynArena *:        mag_dyn_arena_alloc,                       \
+                                                           MagVirtualArena *:    mag_virtual_arena_alloc,                   \
+                                                           MagTlsf *:            mag_tlsf_alloc,                            \
+                                                           MagConcurrentArena *: mag_concurrent_arena_alloc,                \
+                                                           MagAllocator *:       mag_allocator_alloc                        \
+                                                       )(alloc, sizeof(type), _Alignof(type)))
+
+#define eco_arena_nmalloc(alloc, count, type) (type *)(MAG_TRACE_MARK_SITE(alloc), _Generic((alloc),                        \
+                                                           MagStaticArena *:     mag_static_arena_alloc,                    \
+                                                           MagDynArena *:        mag_dyn_arena_alloc,                       \
+                                                           MagVirtualArena *:    mag_virtual_arena_alloc,                   \
+                                                           MagTlsf *:            mag_tlsf_alloc,                            \
+                                                           MagConcurrentArena *: mag_concurrent_arena_alloc,                \
+                                                           MagAllocator *:       mag_allocator_alloc                        \
+                                                       )(alloc, (count) * sizeof(type), _Alignof(type)))
+
+#define eco_arena_malloc_uninit(alloc, type) (type *)(MAG_TRACE_MARK_SITE(alloc), _Generic((alloc),                         \
+                                                           MagStaticArena *:     mag_static_arena_alloc_uninit,             \
+                                                           MagDynArena *:        mag_dyn_arena_alloc_uninit,                \
+                                                           MagVirtualArena *:    mag_virtual_arena_alloc_uninit,            \
+                                                           MagTlsf *:            mag_tlsf_alloc_uninit,                     \
+                                                           MagConcurrentArena *: mag_concurrent_arena_alloc_uninit,         \
+                                                           MagAllocator *:       mag_allocator_alloc_uninit                 \
+                                                       )(alloc, sizeof(type), _Alignof(type)))
+
+#define eco_arena_nmalloc_uninit(alloc, count, type) (type *)(MAG_TRACE_MARK_SITE(alloc), _Generic((alloc),                 \
+                                                           MagStaticArena *:     mag_static_arena_alloc_uninit,             \
+                                                           MagDynArena *:        mag_dyn_arena_alloc_uninit,                \
+                                                           MagVirtualArena *:    mag_virtual_arena_alloc_uninit,            \
+                                                           MagTlsf *:            mag_tlsf_alloc_uninit,                     \
+                                                           MagConcurrentArena *: mag_concurrent_arena_alloc_uninit,         \
+                                                           MagAllocator *:       mag_allocator_alloc_uninit                 \
+                                                       )(alloc, (count) * sizeof(type), _Alignof(type)))
+
+#define eco_arena_nrealloc(alloc, ptr, count, type) (MAG_TRACE_MARK_SITE(alloc), _Generic((alloc),                          \
+                                                            MagStaticArena *:  mag_static_arena_realloc,                    \
+                                                            MagDynArena *:     mag_dyn_arena_realloc,                       \
+                                                            MagVirtualArena *: mag_virtual_arena_realloc,                   \
+                                                            MagTlsf *:         mag_tlsf_realloc,                            \
+                                                            MagAllocator *:    mag_allocator_realloc                        \
+                                                       )(alloc, ptr, sizeof(type) * (count), _Alignof(type)))
+
+#define eco_arena_destroy(alloc)                       _Generic((alloc),                                                    \
+                                                           MagStaticArena *:     mag_static_arena_destroy,                  \
+                                                           MagDynArena *:        mag_dyn_arena_destroy,                     \
+                                                           MagVirtualArena *:    mag_virtual_arena_destroy,                 \
+                                                           MagTlsf *:            mag_tlsf_destroy,                          \
+                                                           MagConcurrentArena *: mag_concurrent_arena_destroy,              \
+                                                           MagAllocator *:       mag_allocator_destroy                      \
+                                                       )(alloc)
+
+#define eco_arena_free(alloc, ptr) (MAG_TRACE_MARK_SITE(alloc), _Generic((alloc),                                           \
+                                                           MagStaticArena *:  mag_static_arena_free,                        \
+                                                           MagDynArena *:     mag_dyn_arena_free,                           \
+                                                           MagVirtualArena *: mag_virtual_arena_free,                       \
+                                                           MagTlsf *:         mag_tlsf_free,                                \
+                                                           MagAllocator *:    mag_allocator_free                            \
+                                                       )(alloc, ptr))
+
+#define eco_arena_reset(alloc) (MAG_TRACE_MARK_SITE(alloc), _Generic((alloc),                                               \
+                                                           MagStaticArena *:     mag_static_arena_reset,                    \
+                                                           MagDynArena *:        mag_dyn_arena_reset_default,               \
+                                                           MagVirtualArena *:    mag_virtual_arena_reset_default,           \
+                                                           MagTlsf *:            mag_tlsf_reset,                            \
+                                                           MagConcurrentArena *: mag_concurrent_arena_reset,                \
+                                                           MagAllocator *:       mag_allocator_reset                        \
+                                                       )(alloc))
+
+#define eco_arena_savepoint(alloc)                     _Generic((alloc),                                                    \
+                                                           MagStaticArena *:  mag_static_arena_savepoint,                   \
+                                                           MagDynArena *:     mag_dyn_arena_savepoint,                      \
+                                                           MagVirtualArena *: mag_virtual_arena_savepoint,                  \
+                                                           MagAllocator *:    mag_allocator_savepoint                       \
+                                                       )(alloc)
+
+#define eco_arena_restore(alloc, savepoint)            _Generic((alloc),                                                    \
+                                                           MagStaticArena *:  mag_static_arena_restore,                     \
+                                                           MagDynArena *:     mag_dyn_arena_restore,                        \
+                                                           MagVirtualArena *: mag_virtual_arena_restore,                    \
+                                                           MagAllocator *:    mag_allocator_restore                         \
+                                                       )(alloc, savepoint)
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                   Allocation Tracing
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * Define MAG_TRACE to 1 and every alloc, realloc, free, and reset on a static arena, dynamic arena, or MagAllocator is
+ * reported to the hook set for the calling thread, along with the file and line it was called from. Use it to find the
+ * call sites behind a memory problem, like lots of tiny allocations or reallocs that keep copying. CoyAllocTrace in
+ * coyote.h is a hook that timestamps the events and logs them to a file for offline analysis.
+ *
+ * The call site comes from the malloc style macros (mag_dyn_arena_nmalloc etc.) and the eco_arena_* generics, they call
+ * the *_traced versions of the functions with __FILE__ and __LINE__. That only applies to code after the end of this
+ * file, so calls made from inside this library (e.g. a MagStrBuilder growing) have a NULL file, and so does calling one
+ * of the functions directly or through a pointer. Call its *_traced version to pass a site along. The generics mark the
+ * site before their arguments are evaluated, so a traced call nested in those arguments takes the site instead. A
+ * MagAllocator wrapping a static or dynamic arena is reported as that arena. The hook must not use a traced allocator on
+ * its own thread.
+ *
+ * Like everything else in this library the hook is per translation unit, a hook set in one file doesn't see the
+ * allocations made in another. To share one, define MAG_TRACE_SHARED_HOOK to 1 in every file that includes this one,
+ * and MAG_TRACE_HOOK_STORAGE in exactly one of them to hold it.
+ *
+ * With MAG_TRACE 0 (the default) none of it is compiled in. With it on and no hook set, each call costs a few thread
+ * local stores.
+ */
+#ifndef MAG_TRACE
+#define MAG_TRACE 0
+#endif
+
+typedef enum { MAG_TRACE_ALLOC, MAG_TRACE_REALLOC, MAG_TRACE_FREE, MAG_TRACE_RESET } MagTraceOp;
+
+typedef struct
+{
+    void const *allocator;           /* The arena or MagAllocator that was called.     */
+    void const *ptr;                 /* Returned by alloc or realloc, NULL on failure. */
+    void const *old_ptr;             /* Passed in to realloc or free.                  */
+    size num_bytes;                  /* Requested by alloc or realloc.                 */
+    size alignment;
+    char const *file;                /* Call site, NULL if unknown.                    */
+    i32 line;
+    MagTraceOp op;
+    MagAllocatorType allocator_type;
+} MagTraceEvent;
+
+typedef void (*MagTraceHook)(MagTraceEvent const *event, void *user_data);
+
+#ifndef MAG_TRACE_SHARED_HOOK
+#define MAG_TRACE_SHARED_HOOK 0
+#endif
+
+#if MAG_TRACE_SHARED_HOOK
+extern _Thread_local MagTraceHook mag_trace_thread_hook;
+extern _Thread_local void *mag_trace_thread_hook_data;
+#ifdef MAG_TRACE_HOOK_STORAGE
+_Thread_local MagTraceHook mag_trace_thread_hook;
+_Thread_local void *mag_trace_thread_hook_data;
+#endif
+#else
+static _Thread_local MagTraceHook mag_trace_thread_hook;
+static _Thread_local void *mag_trace_thread_hook_data;
+#endif
+
+/* The site only has to live from a *_traced call to the record it makes, so it never has to be shared. */
+static _Thread_local char const *mag_trace_thread_file;
+static _Thread_local i32 mag_trace_thread_line;
+
+static inline void mag_trace_set_hook(MagTraceHook hook, void *user_data); /* For the calling thread, NULL to stop. */
+
+static inline void *mag_static_arena_alloc_traced(MagStaticArena *arena, size num_bytes, size alignment, char const *file, i32 line);
+static inline void *mag_static_arena_alloc_uninit_traced(MagStaticArena *arena, size num_bytes, size alignment, char const *file, i32 line);
+static inline void *mag_static_arena_realloc_traced(MagStaticArena *arena, void *ptr, size asize, size alignment, char const *file, i32 line);
+static inline void mag_static_arena_free_traced(MagStaticArena *arena, void *ptr, char const *file, i32 line);
+static inline void mag_static_arena_reset_traced(MagStaticArena *arena, char const *file, i32 line);
+
+static inline void *mag_dyn_arena_alloc_traced(MagDynArena *arena, size num_bytes, size alignment, char const *file, i32 line);
+static inline void *mag_dyn_arena_alloc_uninit_traced(MagDynArena *arena, size num_bytes, size alignment, char const *file, i32 line);
+static inline void *mag_dyn_arena_realloc_traced(MagDynArena *arena, void *ptr, size num_bytes, size alignment, char const *file, i32 line);
+static inline void mag_dyn_arena_free_traced(MagDynArena *arena, void *ptr, char const *file, i32 line);
+static inline void mag_dyn_arena_reset_traced(MagDynArena *arena, b32 coalesce, char const *file, i32 line);
+static inline void mag_dyn_arena_reset_default_traced(MagDynArena *arena, char const *file, i32 line);
+static inline void mag_dyn_arena_reset_trim_traced(MagDynArena *arena, size watermark, char const *file, i32 line);
+
+static inline void *mag_allocator_alloc_traced(MagAllocator *alloc, size num_bytes, size alignment, char const *file, i32 line);
+static inline void *mag_allocator_alloc_uninit_traced(MagAllocator *alloc, size num_bytes, size alignment, char const *file, i32 line);
+static inline void *mag_allocator_realloc_traced(MagAllocator *alloc, void *ptr, size num_bytes, size alignment, char const *file, i32 line);
+static inline void mag_allocator_free_traced(MagAllocator *alloc, void *ptr, char const *file, i32 line);
+static inline void mag_allocator_reset_traced(MagAllocator *alloc, char const *file, i32 line);
+
+#if MAG_TRACE
+#define MAG_TRACE_RECORD(record) record
+#else
+#define MAG_TRACE_RECORD(record)
+#endif
+
+/* Plain calls until the end of this file, see above. */
+#define MAG_TRACE_CALL(func, ...) func(__VA_ARGS__)
+#define MAG_TRACE_MARK_SITE(alloc) ((void)0)
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                     Scratch Arenas
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * A pair of dynamic arenas per thread for temporary allocations. Bind a MagScratchSet to a thread, then mag_scratch_begin()
+ * hands out one of its arenas along with a savepoint and mag_scratch_end() throws away everything allocated since. Each 
+ * thread has its own set, so there is no locking.
+ *
+ * Pass the arena the caller wants its results in as the conflict, and the scratch arena will be the other one of the pair.
+ * That way temporary allocations never end up interleaved with results that must outlive them, even when a function that
+ * uses scratch memory is handed a scratch arena by its caller to put its results in.
+ *
+ * The bound set is tracked in a _Thread_local pointer, which like everything else in this library is per translation unit.
+ * The CoyThreadPool in coyote.h binds a set in every worker thread.
+ */
+typedef struct
+{
+    MagDynArena arenas[2];
+} MagScratchSet;
+
+typedef struct
+{
+    MagDynArena *arena;
+    MagArenaSavepoint savepoint;
+} MagScratch;
+
+static _Thread_local MagScratchSet *mag_scratch_thread_set;
+
+static inline MagScratchSet mag_scratch_set_create(size default_block_size); /* Pages are faulted in as they are used.   */
+static inline void mag_scratch_set_destroy(MagScratchSet *set);
+static inline void mag_scratch_set_bind(MagScratchSet *set);                  /* Bind to calling thread, NULL to unbind.   */
+static inline MagScratchSet *mag_scratch_set_bound(void);                     /* NULL if no set is bound to this thread.   */
+
+static inline MagScratch mag_scratch_begin(void const *conflict);             /* conflict may be NULL, needs a bound set.  */
+static inline void mag_scratch_end(MagScratch scratch);                       /* Free everything allocated since begin.    */
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                      String Slice
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * Add some allocator enabled functionality to ElkStr.
+ */
+
+
+static inline ElkStr mag_str_alloc_copy_static(ElkStr src, MagStaticArena *arena);                    /* Allocate space and create a copy.                                                        */
+static inline ElkStr mag_str_append_static(ElkStr dest, ElkStr src, MagStaticArena *arena);           /* If dest wasn't the last thing allocated on arena, this fails and returns an empty string */
+static inline ElkStr mag_str_append_cstr_static(ElkStr dest, char const *src, MagStaticArena *arena); /* If dest wasn't the last thing allocated on arena, this fails and returns an empty string */
+
+static inline ElkStr mag_str_alloc_copy_dyn(ElkStr src, MagDynArena *arena);
+static inline ElkStr mag_str_append_dyn(ElkStr dest, ElkStr src, MagDynArena *arena); 
+static inline ElkStr mag_str_append_cstr_dyn(ElkStr dest, char const *src, MagDynArena *arena);
+
+static inline ElkStr mag_str_alloc_copy_alloc(ElkStr src, MagAllocator *alloc);
+static inline ElkStr mag_str_append_alloc(ElkStr dest, ElkStr src, MagAllocator *alloc); 
+static inline ElkStr mag_str_append_cstr_alloc(ElkStr dest, char const *src, MagAllocator *alloc);
+
+#define eco_str_alloc_copy(src, alloc) _Generic((alloc),                                                                    \
+                                             MagStaticArena *: mag_str_alloc_copy_static,                                   \
+                                             MagDynArena *:    mag_str_alloc_copy_dyn,                                      \
+                                             MagAllocator *:   mag_str_alloc_copy_alloc                                     \
+                                         )(src, alloc)
+
+#define eco_str_append(dest, src, alloc) _Generic((alloc),                                                                  \
+                                             MagStaticArena *: mag_str_append_static,                                       \
+                                             MagDynArena *:    mag_str_append_dyn,                                          \
+                                             MagAllocator *:   mag_str_append_alloc                                         \
+                                         )(dest, src, alloc)
+
+#define eco_str_append_cstr(dest, src, alloc) _Generic((alloc),                                                             \
+                                                  MagStaticArena *: mag_str_append_cstr_static,                             \
+                                                  MagDynArena *:    mag_str_append_cstr_dyn,                                \
+                                                  MagAllocator *:   mag_str_append_cstr_alloc                               \
+                                              )(dest, src, alloc)
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                     String Builder
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * Build a long string out of lots of small pieces. The mag_str_append_* functions above grow the destination by exactly 
+ * what is appended, and every time it can't grow in place the whole string is copied. The builder doubles its capacity 
+ * instead, so the copies add up to no more than the final length.
+ *
+ * If the allocator runs out of memory the builder remembers it, every following append is a no-op, and finish returns a
+ * NULL string (elk_str_null). So check once at the end instead of after every append.
+ *
+ * Finish hands the buffer over as a null terminated ElkStr and leaves the builder empty, ready to build another string. 
+ * Unused capacity is given back if that can be done without moving the string. On arenas the builder should be the only
+ * thing allocating while it grows, otherwise each time it grows the old buffer is left behind.
+ */
+#define MAG_STR_BUILDER_MIN_CAPACITY 64
+#define MAG_STR_BUILDER_MAX_DECIMAL_PLACES 15
+
+typedef enum { MAG_STR_BUILDER_T_STATIC_ARENA, MAG_STR_BUILDER_T_DYN_ARENA, MAG_STR_BUILDER_T_ALLOCATOR } MagStrBuilderType;
+
+typedef struct
+{
+    MagStrBuilderType type;
+    void *alloc;       /* Points to a MagStaticArena, MagDynArena, or MagAllocator depending on type. */
+    char *buf;
+    size len;
+    size capacity;     /* Not counting room for the null terminator.                                  */
+    b32 failed;        /* Out of memory, everything since is dropped.                                 */
+} MagStrBuilder;
+
+static inline MagStrBuilder mag_str_builder_create_static(MagStaticArena *arena, size capacity); /* Reserves capacity, 0 waits for first append. */
+static inline MagStrBuilder mag_str_builder_create_dyn(MagDynArena *arena, size capacity);
+static inline MagStrBuilder mag_str_builder_create_alloc(MagAllocator *alloc, size capacity);
+static inline void mag_str_builder_reset(MagStrBuilder *builder);                       /* Empty it, but keep the buffer.                  */
+static inline b32 mag_str_builder_reserve(MagStrBuilder *builder, size num_chars);      /* Make room to append num_chars, false on OOM.    */
+static inline ElkStr mag_str_builder_finish(MagStrBuilder *builder);                    /* elk_str_null if anything failed.                */
+
+static inline void mag_str_builder_append(MagStrBuilder *builder, ElkStr src);
+static inline void mag_str_builder_append_cstr(MagStrBuilder *builder, char const *src);
+static inline void mag_str_builder_append_char(MagStrBuilder *builder, char c);
+static inline void mag_str_builder_append_i64(MagStrBuilder *builder, i64 value);
+static inline void mag_str_builder_append_u64(MagStrBuilder *builder, u64 value);
+static inline void mag_str_builder_append_f64(MagStrBuilder *builder, f64 value, i32 decimal_places); /* See below.            */
+static inline void mag_str_builder_append_time(MagStrBuilder *builder, ElkTime time);   /* YYYY-MM-DD HH:MM:SS                             */
+static inline void mag_str_builder_append_date(MagStrBuilder *builder, ElkDate date);   /* YYYY-MM-DD                                      */
+
+/* Floats are rounded to decimal_places digits after the decimal point, at most MAG_STR_BUILDER_MAX_DECIMAL_PLACES. Values
+ * with value * 10^decimal_places of 1e18 or more are written in scientific notation instead (e.g. 1.50e+20). NaN and 
+ * infinity are written as nan, inf, and -inf.
+ */
+
+#define eco_str_builder_create(alloc, capacity) _Generic((alloc),                                                           \
+                                                    MagStaticArena *: mag_str_builder_create_static,                        \
+                                                    MagDynArena *:    mag_str_builder_create_dyn,                           \
+                                                    MagAllocator *:   mag_str_builder_create_alloc                          \
+                                                )(alloc, capacity)
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                 Cache Line Alignment
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * Allocations that get a whole number of cache lines to themselves. Arenas pack allocations back to back, so two threads'
+ * counters or buffers allocated one after the other usually end up on the same cache line, and every write by one thread
+ * invalidates the line for the other (false sharing). These round the size up to a multiple of MAG_CACHE_LINE_SIZE and
+ * align the start to it, so nothing else can land on the same lines. That is also the alignment aligned AVX-512 loads
+ * and stores need.
+ *
+ * For one value per thread use a MagSlotArray. Each slot is padded to MAG_FALSE_SHARING_SIZE, two cache lines, because
+ * x86 CPUs prefetch the neighboring line of a 128 byte pair too, which shares the pair much like a single line would. Size
+ * it with the number of threads and index it with the thread's number, e.g. coy_threadpool_worker_index() in a
+ * CoyThreadPool task.
+ */
+#define MAG_CACHE_LINE_SIZE 64
+#define MAG_FALSE_SHARING_SIZE 128
+
+static inline size mag_cacheline_round_up(size num_bytes);
+
+#define mag_static_arena_alloc_cacheline(arena, num_bytes)                                                                  \
+    MAG_TRACE_CALL(mag_static_arena_alloc, (arena), mag_cacheline_round_up(num_bytes), MAG_CACHE_LINE_SIZE)
+#define mag_dyn_arena_alloc_cacheline(arena, num_bytes)                                                                     \
+    MAG_TRACE_CALL(mag_dyn_arena_alloc, (arena), mag_cacheline_round_up(num_bytes), MAG_CACHE_LINE_SIZE)
+#define mag_virtual_arena_alloc_cacheline(arena, num_bytes)                                                                 \
+    mag_virtual_arena_alloc((arena), mag_cacheline_round_up(num_bytes), MAG_CACHE_LINE_SIZE)
+#define mag_tlsf_alloc_cacheline(tlsf, num_bytes)                                                                           \
+    mag_tlsf_alloc((tlsf), mag_cacheline_round_up(num_bytes), MAG_CACHE_LINE_SIZE)
+#define mag_concurrent_arena_alloc_cacheline(arena, num_bytes)                                                              \
+    mag_concurrent_arena_alloc((arena), mag_cacheline_round_up(num_bytes), MAG_CACHE_LINE_SIZE)
+#define mag_allocator_alloc_cacheline(alloc, num_bytes)                                                                     \
+    MAG_TRACE_CALL(mag_allocator_alloc, (alloc), mag_cacheline_round_up(num_bytes), MAG_CACHE_LINE_SIZE)
+
+#define eco_arena_alloc_cacheline(alloc, num_bytes) (MAG_TRACE_MARK_SITE(alloc), _Generic((alloc),                          \
+                                                           MagStaticArena *:     mag_static_arena_alloc,                    \
+                                                           MagDynArena *:        mag_dyn_arena_alloc,                       \
+                                                           MagVirtualArena *:    mag_virtual_arena_alloc,                   \
+                                                           MagTlsf *:            mag_tlsf_alloc,                            \
+                                                           MagConcurrentArena *: mag_concurrent_arena_alloc,                \
+                                                           MagAllocator *:       mag_allocator_alloc                        \
+                                                       )(alloc, mag_cacheline_round_up(num_bytes), MAG_CACHE_LINE_SIZE))
+
+#define eco_arena_nmalloc_cacheline(alloc, count, type) (type *)eco_arena_alloc_cacheline((alloc), (count) * sizeof(type))
+
+typedef struct
+{
+    byte *mem;
+    size num_slots;
+    size stride;    /* The slot size rounded up to MAG_FALSE_SHARING_SIZE. */
+} MagSlotArray;
+
+static inline size mag_slot_array_num_bytes(size num_slots, size slot_size);
+static inline MagSlotArray mag_slot_array_wrap(size num_slots, size slot_size, void *mem);   /* Cache line aligned mem.   */
+static inline void *mag_slot_array_get(MagSlotArray const *slots, size index);
+
+#define mag_slot_array_get_as(slots, index, type) ((type *)mag_slot_array_get((slots), (index)))
+
+/* Allocate a zeroed slot array big enough for num_slots of type. Check slots.mem for out of memory. */
+#define eco_slot_array_create(alloc, num_slots, type)                                                                       \
+    mag_slot_array_wrap((num_slots), sizeof(type), (MAG_TRACE_MARK_SITE(alloc), _Generic((alloc),                           \
+                                                       MagStaticArena *:     mag_static_arena_alloc,                        \
+                                                       MagDynArena *:        mag_dyn_arena_alloc,                           \
+                                                       MagVirtualArena *:    mag_virtual_arena_alloc,                       \
+                                                       MagTlsf *:            mag_tlsf_alloc,                                \
+                                                       MagConcurrentArena *: mag_concurrent_arena_alloc,                    \
+                                                       MagAllocator *:       mag_allocator_alloc                            \
+                                                   )(alloc, mag_slot_array_num_bytes((num_slots), sizeof(type)),            \
+                                                     MAG_FALSE_SHARING_SIZE)))
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                 Bulk Array Allocation
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * Allocate a set of parallel arrays (the columns of a struct of arrays table) in one call. They all have room for the
+ * same number of elements and share one allocation, one after the other, each starting on its own cache line
+ * (MAG_ARRAYS_ALIGN). So any element type with an alignment up to that works. That's one allocation (and one memset)
+ * instead of one per column, and no column shares a cache line with its neighbor.
+ *
+ * Describe each array with a MagArraySpec, MAG_ARRAY_SPEC(ptr) makes one from the pointer variable the array goes in. The
+ * alloc functions zero everything. The realloc functions read the current arrays through the same specs, resize the whole
+ * allocation, move every array to its new spot, zero the new elements, and update the pointers. If they fail everything
+ * is left as it was, shrinking always works. Free the set by freeing the first array, it is the start of the allocation.
+ *
+ *     i32 *ids = NULL;
+ *     f64 *values = NULL;
+ *     MagArraySpec arrays[] = { MAG_ARRAY_SPEC(ids), MAG_ARRAY_SPEC(values) };
+ *     eco_arrays_alloc(arena, 100, ECO_ARRAY_SIZE(arrays), arrays);      // ids and values hold 100 each
+ *     eco_arrays_realloc(arena, 100, 1000, ECO_ARRAY_SIZE(arrays), arrays); // now 1000 each
+ *
+ * The same as with anything else on an arena, growing is cheap if the arrays were the last allocation.
+ */
+#define MAG_ARRAYS_ALIGN MAG_CACHE_LINE_SIZE
+
+typedef struct
+{
+    void **ptr;        /* The pointer variable for the array, set by alloc and read and set by realloc. */
+    size element_size;
+} MagArraySpec;
+
+#define MAG_ARRAY_SPEC(ptr_var) (MagArraySpec){ .ptr = (void **)&(ptr_var), .element_size = sizeof(*(ptr_var)) }
+
+static inline b32 mag_arrays_alloc_static(MagStaticArena *arena, size count, size num_arrays, MagArraySpec const arrays[]);
+static inline b32 mag_arrays_alloc_dyn(MagDynArena *arena, size count, size num_arrays, MagArraySpec const arrays[]);
+static inline b32 mag_arrays_alloc_virtual(MagVirtualArena *arena, size count, size num_arrays, MagArraySpec const arrays[]);
+static inline b32 mag_arrays_alloc_tlsf(MagTlsf *tlsf, size count, size num_arrays, MagArraySpec const arrays[]);
+static inline b32 mag_arrays_alloc_concurrent(MagConcurrentArena *arena, size count, size num_arrays, MagArraySpec const arrays[]);
+static inline b32 mag_arrays_alloc_alloc(MagAllocator *alloc, size count, size num_arrays, MagArraySpec const arrays[]);
+
+static inline b32 mag_arrays_realloc_static(MagStaticArena *arena, size old_count, size new_count, size num_arrays, MagArraySpec const arrays[]);
+static inline b32 mag_arrays_realloc_dyn(MagDynArena *arena, size old_count, size new_count, size num_arrays, MagArraySpec const arrays[]);
+static inline b32 mag_arrays_realloc_virtual(MagVirtualArena *arena, size old_count, size new_count, size num_arrays, MagArraySpec const arrays[]);
+static inline b32 mag_arrays_realloc_tlsf(MagTlsf *tlsf, size old_count, size new_count, size num_arrays, MagArraySpec const arrays[]);
+static inline b32 mag_arrays_realloc_alloc(MagAllocator *alloc, size old_count, size new_count, size num_arrays, MagArraySpec const arrays[]);
+
+/* The concurrent arena can't realloc, the same as with eco_arena_nrealloc. */
+#define eco_arrays_alloc(alloc, count, num_arrays, arrays) _Generic((alloc),                                                \
+                                                    MagStaticArena *:     mag_arrays_alloc_static,                          \
+                                                    MagDynArena *:        mag_arrays_alloc_dyn,                             \
+                                                    MagVirtualArena *:    mag_arrays_alloc_virtual,                         \
+                                                    MagTlsf *:            mag_arrays_alloc_tlsf,                            \
+                                                    MagConcurrentArena *: mag_arrays_alloc_concurrent,                      \
+                                                    MagAllocator *:       mag_arrays_alloc_alloc                            \
+                                                )(alloc, count, num_arrays, arrays)
+
+#define eco_arrays_realloc(alloc, old_count, new_count, num_arrays, arrays) _Generic((alloc),                               \
+                                                    MagStaticArena *:  mag_arrays_realloc_static,                           \
+                                                    MagDynArena *:     mag_arrays_realloc_dyn,                              \
+                                                    MagVirtualArena *: mag_arrays_realloc_virtual,                          \
+                                                    MagTlsf *:         mag_arrays_realloc_tlsf,                             \
+                                                    MagAllocator *:    mag_arrays_realloc_alloc                             \
+                                                )(alloc, old_count, new_count, num_arrays, arrays)
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *
+ *
+ *                                          Implementation of `inline` functions.
+ *                                                      Internal Only
+ *
+ *
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+static inline b32
+mag_is_power_of_2(uptr p)
+{
+    return (p & (p - 1)) == 0;
+}
+
+static inline uptr
+mag_align_pointer(uptr ptr, usize align)
+{
+
+    Assert(mag_is_power_of_2(align));
+
+    uptr a = (uptr)align;
+    uptr mod = ptr & (a - 1); /* Same as (ptr % a) but faster as 'a' is a power of 2 */
+
+    if (mod != 0)
+    {
+        /* push the address forward to the next value which is aligned               */
+        ptr += a - mod;
+    }
+
+    return ptr;
+}
+
+static inline MagMemoryBlock 
+mag_wrap_memory(size buf_size, void *buffer)
+{
+    return (MagMemoryBlock){ .mem = buffer, .size = buf_size, .flags = 0x01u | 0x00u };
+}
+
+static inline void
+mag_sys_memory_first_touch(void *start, size num_bytes)
+{
+    if(num_bytes <= 0) { return; }
+
+    /* One byte is enough to fault in the whole page. */
+    size const page_size = mag_sys_memory_page_size();
+    byte volatile *ptr = start;
+    byte volatile *end = ptr + num_bytes;
+    for(; ptr < end; ptr = (byte volatile *)mag_align_pointer((uptr)ptr + 1, page_size)) { *ptr = *ptr; }
+}
+
+static inline MagMemoryOptions
+mag_memory_options_resolve_numa_internal(MagMemoryOptions options)
+{
+    /* Pin it down now, later blocks may be allocated by some other thread. */
+    if(options.numa == MAG_MEM_NUMA_LOCAL)
+    {
+        options.numa = MAG_MEM_NUMA_NODE;
+        options.numa_node = mag_sys_memory_numa_current_node();
+    }
+
+    return options;
+}
+
+static inline MagRingBuffer
+mag_ring_buffer_create(size minimum_capacity)
+{
+    return (MagRingBuffer){ .buf = mag_sys_memory_allocate_mirrored(minimum_capacity) };
+}
+
+static inline void
+mag_ring_buffer_destroy(MagRingBuffer *ring)
+{
+    mag_sys_memory_free(&ring->buf);
+    *ring = (MagRingBuffer){0};
+}
+
+static inline size
+mag_ring_buffer_capacity(MagRingBuffer const *ring)
+{
+    return ring->buf.size;
+}
+
+static inline size
+mag_ring_buffer_free_space(MagRingBuffer const *ring)
+{
+    return ring->buf.size - ring->len;
+}
+
+static inline byte *
+mag_ring_buffer_read_ptr(MagRingBuffer *ring)
+{
+    return ring->buf.mem + ring->read_offset;
+}
+
+static inline void
+mag_ring_buffer_consume(MagRingBuffer *ring, size num_bytes)
+{
+    Assert(num_bytes >= 0 && num_bytes <= ring->len);
+
+    ring->len -= num_bytes;
+    ring->read_offset += num_bytes;
+    if(ring->read_offset >= ring->buf.size) { ring->read_offset -= ring->buf.size; }
+
+    /* Nothing left, start over at the front so the data stays in as few pages as possible. */
+    if(ring->len == 0) { ring->read_offset = 0; }
+}
+
+static inline byte *
+mag_ring_buffer_write_ptr(MagRingBuffer *ring)
+{
+    /* The mirror makes this valid even when it is past the end of the first half. */
+    return ring->buf.mem + ring->read_offset + ring->len;
+}
+
+static inline void
+mag_ring_buffer_commit(MagRingBuffer *ring, size num_bytes)
+{
+    Assert(num_bytes >= 0 && num_bytes <= mag_ring_buffer_free_space(ring));
+    ring->len += num_bytes;
+}
+
+static inline b32
+mag_ring_buffer_push(MagRingBuffer *ring, size num_bytes, void const *src)
+{
+    if(num_bytes > mag_ring_buffer_free_space(ring)) { return false; }
+
+    memcpy(mag_ring_buffer_write_ptr(ring), src, num_bytes);
+    mag_ring_buffer_commit(ring, num_bytes);
+
+    return true;
+}
+
+#if MAG_STATS
+static inline void
+mag_alloc_stats_use(MagAllocStats *stats, size num_bytes)
+{
+    /* num_bytes is negative when memory is given back. */
+    stats->bytes_in_use += num_bytes;
+    stats->peak_bytes_in_use = stats->bytes_in_use > stats->peak_bytes_in_use ? stats->bytes_in_use : stats->peak_bytes_in_use;
+}
+
+static inline void
+mag_alloc_stats_alloc(MagAllocStats *stats, size num_bytes, size padding)
+{
+    stats->num_allocs++;
+    stats->bytes_requested += num_bytes;
+    stats->bytes_padding += padding;
+    mag_alloc_stats_use(stats, num_bytes + padding);
+}
+
+static inline void
+mag_alloc_stats_realloc(MagAllocStats *stats, b32 in_place, size growth)
+{
+    if(in_place) { stats->num_realloc_in_place++; }
+    else         { stats->num_realloc_copy++;     }
+    mag_alloc_stats_use(stats, growth);
+}
+
+static inline void
+mag_alloc_stats_print(char const *label, MagAllocStats const *stats)
+{
+    u64 const total = stats->bytes_requested + stats->bytes_padding;
+    f64 const padding_pct = total ? 100.0 * (f64)stats->bytes_padding / (f64)total : 0.0;
+
+    printf("%-32s Allocs: %8"PRIu64" Requested: %12"PRIu64" Padding: %6.2lf%% Blocks: %5"PRIu64" Peak: %12"PRId64
+           " Reallocs in place: %"PRIu64" copied: %"PRIu64"\n", label, stats->num_allocs, stats->bytes_requested, 
+           padding_pct, stats->num_blocks, (i64)stats->peak_bytes_in_use, stats->num_realloc_in_place, 
+           stats->num_realloc_copy);
+}
+
+static inline void
+mag_atomic_alloc_stats_add(MagAtomicAllocStats *stats, MagAllocStats const *delta)
+{
+    /* Skip the counts that didn't change, each one is a trip to a cache line the other threads are hitting too. */
+    memory_order const relaxed = memory_order_relaxed;
+    if(delta->num_allocs)      { atomic_fetch_add_explicit(&stats->num_allocs, delta->num_allocs, relaxed); }
+    if(delta->bytes_requested) { atomic_fetch_add_explicit(&stats->bytes_requested, delta->bytes_requested, relaxed); }
+    if(delta->bytes_padding)   { atomic_fetch_add_explicit(&stats->bytes_padding, delta->bytes_padding, relaxed); }
+    if(delta->num_blocks)      { atomic_fetch_add_explicit(&stats->num_blocks, delta->num_blocks, relaxed); }
+
+    if(delta->bytes_in_use)
+    {
+        size const previous = atomic_fetch_add_explicit(&stats->bytes_in_use, delta->bytes_in_use, relaxed);
+        size const in_use = previous + delta->bytes_in_use;
+
+        /* A failed swap reloads peak, stop once somebody else has stored a bigger one. */
+        _Atomic(size) *stored_peak = &stats->peak_bytes_in_use;
+        size peak = atomic_load_explicit(stored_peak, relaxed);
+        while(in_use > peak && !atomic_compare_exchange_weak_explicit(stored_peak, &peak, in_use, relaxed, relaxed)) {}
+    }
+}
+
+static inline void
+mag_atomic_alloc_stats_use(MagAtomicAllocStats *stats, size num_bytes)
+{
+    /* num_bytes is negative when memory is given back. */
+    mag_atomic_alloc_stats_add(stats, &(MagAllocStats){ .bytes_in_use = num_bytes });
+}
+
+static inline MagAllocStats
+mag_atomic_alloc_stats_read(MagAtomicAllocStats *stats)
+{
+    return (MagAllocStats)
+    {
+        .num_allocs = atomic_load_explicit(&stats->num_allocs, memory_order_relaxed),
+        .bytes_requested = atomic_load_explicit(&stats->bytes_requested, memory_order_relaxed),
+        .bytes_padding = atomic_load_explicit(&stats->bytes_padding, memory_order_relaxed),
+        .num_blocks = atomic_load_explicit(&stats->num_blocks, memory_order_relaxed),
+        .bytes_in_use = atomic_load_explicit(&stats->bytes_in_use, memory_order_relaxed),
+        .peak_bytes_in_use = atomic_load_explicit(&stats->peak_bytes_in_use, memory_order_relaxed),
+    };
+}
+#endif
+
+static inline void
+mag_trace_set_hook(MagTraceHook hook, void *user_data)
+{
+    mag_trace_thread_hook = hook;
+    mag_trace_thread_hook_data = user_data;
+}
+
+static inline void
+mag_trace_mark_site_internal(char const *file, i32 line)
+{
+    mag_trace_thread_file = file;
+    mag_trace_thread_line = line;
+}
+
+static inline void
+mag_trace_skip_site_internal(char const *file, i32 line)
+{
+    /* For the allocators that aren't traced, marking a site for them would leave it for the next traced call. */
+    (void)file;
+    (void)line;
+}
+
+static inline void
+mag_trace_record_internal(MagTraceOp op, MagAllocatorType allocator_type, void const *allocator, void const *ptr,
+        void const *old_ptr, size num_bytes, size alignment)
+{
+    MagTraceEvent const event =
+        {
+            .allocator = allocator,
+            .ptr = ptr,
+            .old_ptr = old_ptr,
+            .num_bytes = num_bytes,
+            .alignment = alignment,
+            .file = mag_trace_thread_file,
+            .line = mag_trace_thread_line,
+            .op = op,
+            .allocator_type = allocator_type
+        };
+
+    /* The site only belongs to the call that marked it. */
+    mag_trace_thread_file = NULL;
+    mag_trace_thread_line = 0;
+
+    if(mag_trace_thread_hook) { mag_trace_thread_hook(&event, mag_trace_thread_hook_data); }
+}
+
+static inline void *
+mag_static_arena_alloc_traced(MagStaticArena *arena, size num_bytes, size alignment, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    return mag_static_arena_alloc(arena, num_bytes, alignment);
+}
+
+static inline void *
+mag_static_arena_alloc_uninit_traced(MagStaticArena *arena, size num_bytes, size alignment, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    return mag_static_arena_alloc_uninit(arena, num_bytes, alignment);
+}
+
+static inline void *
+mag_static_arena_realloc_traced(MagStaticArena *arena, void *ptr, size asize, size alignment, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    return mag_static_arena_realloc(arena, ptr, asize, alignment);
+}
+
+static inline void
+mag_static_arena_free_traced(MagStaticArena *arena, void *ptr, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    mag_static_arena_free(arena, ptr);
+}
+
+static inline void
+mag_static_arena_reset_traced(MagStaticArena *arena, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    mag_static_arena_reset(arena);
+}
+
+static inline void *
+mag_dyn_arena_alloc_traced(MagDynArena *arena, size num_bytes, size alignment, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    return mag_dyn_arena_alloc(arena, num_bytes, alignment);
+}
+
+static inline void *
+mag_dyn_arena_alloc_uninit_traced(MagDynArena *arena, size num_bytes, size alignment, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    return mag_dyn_arena_alloc_uninit(arena, num_bytes, alignment);
+}
+
+static inline void *
+mag_dyn_arena_realloc_traced(MagDynArena *arena, void *ptr, size num_bytes, size alignment, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    return mag_dyn_arena_realloc(arena, ptr, num_bytes, alignment);
+}
+
+static inline void
+mag_dyn_arena_free_traced(MagDynArena *arena, void *ptr, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    mag_dyn_arena_free(arena, ptr);
+}
+
+static inline void
+mag_dyn_arena_reset_traced(MagDynArena *arena, b32 coalesce, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    mag_dyn_arena_reset(arena, coalesce);
+}
+
+static inline void
+mag_dyn_arena_reset_default_traced(MagDynArena *arena, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    mag_dyn_arena_reset_default(arena);
+}
+
+static inline void
+mag_dyn_arena_reset_trim_traced(MagDynArena *arena, size watermark, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    mag_dyn_arena_reset_trim(arena, watermark);
+}
+
+static inline void *
+mag_allocator_alloc_traced(MagAllocator *alloc, size num_bytes, size alignment, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    return mag_allocator_alloc(alloc, num_bytes, alignment);
+}
+
+static inline void *
+mag_allocator_alloc_uninit_traced(MagAllocator *alloc, size num_bytes, size alignment, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    return mag_allocator_alloc_uninit(alloc, num_bytes, alignment);
+}
+
+static inline void *
+mag_allocator_realloc_traced(MagAllocator *alloc, void *ptr, size num_bytes, size alignment, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    return mag_allocator_realloc(alloc, ptr, num_bytes, alignment);
+}
+
+static inline void
+mag_allocator_free_traced(MagAllocator *alloc, void *ptr, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    mag_allocator_free(alloc, ptr);
+}
+
+static inline void
+mag_allocator_reset_traced(MagAllocator *alloc, char const *file, i32 line)
+{
+    MAG_TRACE_RECORD(mag_trace_mark_site_internal(file, line));
+    mag_allocator_reset(alloc);
+}
+
+static inline MagStaticArena
+mag_static_arena_create_internal(MagMemoryBlock mem)
+{
+    return (MagStaticArena) 
+        {
+            .buf = mem,
+            .buf_offset = 0,
+            .prev_ptr = NULL,
+            .prev_offset = 0,
+        };
+}
+
+static inline MagStaticArena
+mag_static_arena_create(size buf_size, byte buffer[])
+{
+    Assert(buffer && buf_size > 0);
+    MagMemoryBlock mblk = mag_wrap_memory(buf_size, buffer);
+    return mag_static_arena_create_internal(mblk);
+}
+
+static inline MagStaticArena 
+mag_static_arena_allocate_and_create(size num_bytes)
+{
+    return mag_static_arena_allocate_and_create_options(num_bytes, (MagMemoryOptions){0});
+}
+
+static inline MagStaticArena 
+mag_static_arena_allocate_and_create_options(size num_bytes, MagMemoryOptions options)
+{
+    Assert(num_bytes > 0);
+
+    MagMemoryBlock mem = mag_sys_memory_allocate_options(num_bytes, options);
+    MagStaticArena arena = {0};
+
+    if(MAG_MEM_IS_VALID(mem))
+    {
+        arena = mag_static_arena_create_internal(mem);
+        MAG_STATS_UPDATE(arena.stats.num_blocks = 1);
+    }
+
+    return arena;
+}
+
+#define MAG_STATIC_ARENA_FILE_MAGIC UINT64_C(0x414E45524147414D) /* "MAGARENA" in a little endian file */
+
+typedef struct
+{
+    u64 magic;
+    size buf_offset;
+    size root_offset;
+} MagStaticArenaFileHeader;
+
+static inline MagStaticArenaFileHeader *
+mag_static_arena_file_header(MagStaticArena const *arena)
+{
+    Assert(MAG_MEM_IS_FILE_MAPPED(arena->buf));
+    return (MagStaticArenaFileHeader *)arena->buf.mem;
+}
+
+static inline MagStaticArena
+mag_static_arena_open_file(char const *path, size num_bytes)
+{
+    Assert(num_bytes > 0);
+
+    /* Look at what's there before growing it, so a file that isn't an arena is left alone. */
+    MagMemoryBlock mem = mag_sys_memory_map_file(path, 0);
+    if(MAG_MEM_IS_VALID(mem))
+    {
+        MagStaticArenaFileHeader const *header = (MagStaticArenaFileHeader const *)mem.mem;
+        StopIf(mem.size < (size)sizeof(*header) || header->magic != MAG_STATIC_ARENA_FILE_MAGIC, goto UNMAP);
+        if(mem.size < num_bytes) { mag_sys_memory_free(&mem); }
+    }
+
+    if(!MAG_MEM_IS_VALID(mem)) { mem = mag_sys_memory_map_file(path, num_bytes); }
+    StopIf(!MAG_MEM_IS_VALID(mem), goto ERR_RETURN);
+
+    MagStaticArena arena = mag_static_arena_create_internal(mem);
+    MagStaticArenaFileHeader *header = mag_static_arena_file_header(&arena);
+    if(header->magic == 0)
+    {
+        /* A brand new file. */
+        header->magic = MAG_STATIC_ARENA_FILE_MAGIC;
+        header->buf_offset = sizeof(*header);
+        header->root_offset = 0;
+    }
+
+    /* Don't trust a header that was cut short or scribbled on. */
+    StopIf(header->magic != MAG_STATIC_ARENA_FILE_MAGIC, goto UNMAP);
+    StopIf(header->buf_offset < (size)sizeof(*header) || header->buf_offset > mem.size, goto UNMAP);
+    StopIf(header->root_offset < 0 || header->root_offset >= header->buf_offset, goto UNMAP);
+
+    arena.buf_offset = header->buf_offset;
+    arena.prev_offset = header->buf_offset;
+    MAG_STATS_UPDATE(arena.stats.num_blocks = 1);
+    MAG_STATS_UPDATE(mag_alloc_stats_use(&arena.stats, header->buf_offset));
+
+    return arena;
+
+UNMAP:
+    mag_sys_memory_free(&mem);
+ERR_RETURN:
+    return (MagStaticArena){0};
+}
+
+static inline b32
+mag_static_arena_sync(MagStaticArena *arena)
+{
+    mag_static_arena_file_header(arena)->buf_offset = arena->buf_offset;
+    return mag_sys_memory_flush(&arena->buf);
+}
+
+static inline void
+mag_static_arena_set_root(MagStaticArena *arena, void *root)
+{
+    MagStaticArenaFileHeader *header = mag_static_arena_file_header(arena);
+
+    /* Save the offset too, so the root never points at space the arena thinks is free. */
+    header->root_offset = mag_static_arena_offset_of(arena, root);
+    header->buf_offset = arena->buf_offset;
+}
+
+static inline void *
+mag_static_arena_root(MagStaticArena const *arena)
+{
+    return mag_static_arena_ptr_at(arena, mag_static_arena_file_header(arena)->root_offset);
+}
+
+static inline size
+mag_static_arena_offset_of(MagStaticArena const *arena, void const *ptr)
+{
+    if(!ptr) { return 0; }
+
+    Assert((byte const *)ptr > arena->buf.mem && (byte const *)ptr < arena->buf.mem + arena->buf.size);
+    return (byte const *)ptr - arena->buf.mem;
+}
+
+static inline void *
+mag_static_arena_ptr_at(MagStaticArena const *arena, size offset)
+{
+    Assert(offset >= 0 && offset < arena->buf.size);
+    return offset ? arena->buf.mem + offset : NULL;
+}
+
+static inline void
+mag_static_arena_destroy(MagStaticArena *arena)
+{
+    if(MAG_MEM_IS_FILE_MAPPED(arena->buf)) { mag_static_arena_file_header(arena)->buf_offset = arena->buf_offset; }
+
+    MagMemoryBlock mem = arena->buf;
+    *arena = (MagStaticArena){0};
+    if(MAG_MEM_IS_OWNED(mem))
+    {
+        mag_sys_memory_free(&mem);
+    }
+    return;
+}
+
+static inline void
+mag_static_arena_reset(MagStaticArena *arena)
+{
+    Assert(arena->buf.mem);
+    arena->buf_offset = 0;
+    arena->prev_ptr = NULL;
+    arena->prev_offset = 0;
+    MAG_STATS_UPDATE(arena->stats.bytes_in_use = 0);
+
+    /* The header of a persistent arena stays. */
+    if(MAG_MEM_IS_FILE_MAPPED(arena->buf))
+    {
+        MagStaticArenaFileHeader *header = mag_static_arena_file_header(arena);
+        arena->buf_offset = sizeof(*header);
+        arena->prev_offset = sizeof(*header);
+        header->buf_offset = sizeof(*header);
+        header->root_offset = 0;
+        MAG_STATS_UPDATE(arena->stats.bytes_in_use = sizeof(*header));
+    }
+
+    MAG_TRACE_RECORD(mag_trace_record_internal(MAG_TRACE_RESET, MAG_ALLOC_T_STATIC_ARENA, arena, NULL, NULL, 0, 0));
+    return;
+}
+
+static inline void *
+mag_static_arena_alloc_uninit_internal(MagStaticArena *arena, size num_bytes, size alignment)
+{
+    Assert(num_bytes > 0 && alignment > 0);
+
+    /* Align 'curr_offset' forward to the specified alignment */
+    uptr curr_ptr = (uptr)arena->buf.mem + (uptr)arena->buf_offset;
+    uptr offset = mag_align_pointer(curr_ptr, alignment);
+    offset -= (uptr)arena->buf.mem; /* change to relative offset */
+
+    /* Check to see if there is enough space left */
+    if ((size)(offset + num_bytes) <= arena->buf.size)
+    {
+        void *ptr = &arena->buf.mem[offset];
+        MAG_STATS_UPDATE(mag_alloc_stats_alloc(&arena->stats, num_bytes, (size)offset - arena->buf_offset));
+
+        arena->prev_offset = arena->buf_offset;
+        arena->prev_ptr = ptr;
+
+        arena->buf_offset = offset + num_bytes;
+        return ptr;
+    }
+
+    return NULL;
+}
+
+static inline void *
+mag_static_arena_alloc(MagStaticArena *arena, size num_bytes, size alignment)
+{
+    void *ptr = mag_static_arena_alloc_uninit_internal(arena, num_bytes, alignment);
+    if(ptr) { memset(ptr, 0, num_bytes); }
+    MAG_TRACE_RECORD(mag_trace_record_internal(MAG_TRACE_ALLOC, MAG_ALLOC_T_STATIC_ARENA, arena, ptr, NULL, num_bytes, alignment));
+    return ptr;
+}
+
+static inline void *
+mag_static_arena_alloc_uninit(MagStaticArena *arena, size num_bytes, size alignment)
+{
+    void *ptr = mag_static_arena_alloc_uninit_internal(arena, num_bytes, alignment);
+    MAG_TRACE_RECORD(mag_trace_record_internal(MAG_TRACE_ALLOC, MAG_ALLOC_T_STATIC_ARENA, arena, ptr, NULL, num_bytes, alignment));
+    return ptr;
+}
+
+static inline void * 
+mag_static_arena_realloc_internal(MagStaticArena *arena, void *ptr, size asize, size alignment)
+{
+    Assert(asize > 0);
+
+    if(ptr == arena->prev_ptr)
+    {
+        /* Get previous extra offset due to alignment */
+        uptr offset = (uptr)ptr - (uptr)arena->buf.mem; /* relative offset accounting for alignment */
+
+        /* Check to see if there is enough space left */
+        if ((size)(offset + asize) <= arena->buf.size)
+        {
+            MAG_STATS_UPDATE(mag_alloc_stats_realloc(&arena->stats, true, (size)(offset + asize) - arena->buf_offset));
+            arena->buf_offset = offset + asize;
+            return ptr;
+        }
+    }
+
+    /* NOTE: Another option here would be to allocate a whole new chunk of memory and memcpy the contents of the old 
+     * memory to that new chunk. While that could work, doing it much would waste a lot of memory and really increase the
+     * odds of running out of memory. So I decided that if the user starts using it in a way where they're asking for a 
+     * realloc when this wasn't the last allocation, I would refuse to do it to force a different design. If that level of
+     * flexibility is needed, maybe a dynamic arena is needed? Maybe a more general allocator (a la malloc/free)?
+     *
+     * This could be a bad thing if the user just grabs a bunch (say 2 GiB) at the beginning of the program execution just
+     * to make sure they never run out of memory. But in this design I'm favoring the use case where the user has a small 
+     * chunk of memory, maybe even on the stack, that they're using for a workspace.
+     */
+
+    return NULL;
+}
+
+static inline void * 
+mag_static_arena_realloc(MagStaticArena *arena, void *ptr, size asize, size alignment)
+{
+    void *new = mag_static_arena_realloc_internal(arena, ptr, asize, alignment);
+    MAG_TRACE_RECORD(mag_trace_record_internal(MAG_TRACE_REALLOC, MAG_ALLOC_T_STATIC_ARENA, arena, new, ptr, asize, alignment));
+    return new;
+}
+
+static inline void
+mag_static_arena_free(MagStaticArena *arena, void *ptr)
+{
+    if(ptr == arena->prev_ptr)
+    {
+        MAG_STATS_UPDATE(mag_alloc_stats_use(&arena->stats, arena->prev_offset - arena->buf_offset));
+        arena->buf_offset = arena->prev_offset;
+    }
+
+    MAG_TRACE_RECORD(mag_trace_record_internal(MAG_TRACE_FREE, MAG_ALLOC_T_STATIC_ARENA, arena, NULL, ptr, 0, 0));
+    return;
+}
+
+struct MagDynArenaBlock
+{
+    MagMemoryBlock buf;
+    size max_buf_offset;
+
+    struct MagDynArenaBlock *next;
+};
+
+static inline void
+mag_block_cache_lock(void)
+{
+    while(atomic_flag_test_and_set_explicit(&mag_block_cache.lock, memory_order_acquire)) { /* spin */ }
+}
+
+static inline void
+mag_block_cache_unlock(void)
+{
+    atomic_flag_clear_explicit(&mag_block_cache.lock, memory_order_release);
+}
+
+static inline i32
+mag_block_cache_class(size num_bytes)
+{
+    return 63 - __builtin_clzll((u64)num_bytes);
+}
+
+/* The cache doesn't know which node a block came from or what its pages are, so those never go in or come out. */
+static inline b32
+mag_block_cache_excludes(MagMemoryOptions options)
+{
+    return options.pages != MAG_MEM_PAGES_DEFAULT || options.numa != MAG_MEM_NUMA_DEFAULT ||
+           options.populate == MAG_MEM_POPULATE_BACKGROUND;
+}
+
+static inline MagDynArenaBlock *
+mag_block_cache_take(size num_bytes, MagMemoryOptions options)
+{
+    /* A cached block only has the pages its last arena touched, so it can't stand in for a populated one. */
+    if(mag_block_cache_excludes(options) || options.populate == MAG_MEM_POPULATE_NOW ||
+       atomic_load_explicit(&mag_block_cache.max_bytes, memory_order_relaxed) == 0)
+    {
+        return NULL;
+    }
+
+    i32 const size_class = mag_block_cache_class(num_bytes);
+
+    mag_block_cache_lock();
+
+    /* Blocks in the same class might be too small, anything in the next class up is big enough. */
+    MagDynArenaBlock **link = &mag_block_cache.classes[size_class];
+    while(*link && (*link)->buf.size < num_bytes) { link = &(*link)->next; }
+    if(!*link && size_class + 1 < MAG_BLOCK_CACHE_NUM_CLASSES) { link = &mag_block_cache.classes[size_class + 1]; }
+
+    MagDynArenaBlock *block = *link;
+    if(block)
+    {
+        *link = block->next;
+        mag_block_cache.cached_bytes -= block->buf.size;
+    }
+
+    mag_block_cache_unlock();
+
+    return block;
+}
+
+static inline b32
+mag_block_cache_give(MagDynArenaBlock *block, MagMemoryOptions options)
+{
+    if(mag_block_cache_excludes(options)) { return false; }
+
+    size const max_bytes = atomic_load_explicit(&mag_block_cache.max_bytes, memory_order_relaxed);
+    if(max_bytes == 0) { return false; }
+
+    mag_block_cache_lock();
+
+    b32 const keep = mag_block_cache.cached_bytes + block->buf.size <= max_bytes;
+    if(keep)
+    {
+        i32 const size_class = mag_block_cache_class(block->buf.size);
+        block->next = mag_block_cache.classes[size_class];
+        mag_block_cache.classes[size_class] = block;
+        mag_block_cache.cached_bytes += block->buf.size;
+    }
+
+    mag_block_cache_unlock();
+
+    return keep;
+}
+
+static inline void
+mag_block_cache_trim(size max_bytes)
+{
+    /* Unlink the blocks while holding the lock, but unmap them after letting it go. Biggest blocks go first. */
+    MagDynArenaBlock *to_free = NULL;
+
+    mag_block_cache_lock();
+    for(i32 i = MAG_BLOCK_CACHE_NUM_CLASSES - 1; i >= 0 && mag_block_cache.cached_bytes > max_bytes; --i)
+    {
+        while(mag_block_cache.classes[i] && mag_block_cache.cached_bytes > max_bytes)
+        {
+            MagDynArenaBlock *block = mag_block_cache.classes[i];
+            mag_block_cache.classes[i] = block->next;
+            mag_block_cache.cached_bytes -= block->buf.size;
+
+            block->next = to_free;
+            to_free = block;
+        }
+    }
+    mag_block_cache_unlock();
+
+    while(to_free)
+    {
+        MagDynArenaBlock *next = to_free->next;
+        mag_sys_memory_free(&to_free->buf);
+        to_free = next;
+    }
+}
+
+static inline void
+mag_block_cache_configure(size max_bytes)
+{
+    Assert(max_bytes >= 0);
+    atomic_store_explicit(&mag_block_cache.max_bytes, max_bytes, memory_order_relaxed);
+    mag_block_cache_trim(max_bytes);
+}
+
+static inline size
+mag_block_cache_bytes(void)
+{
+    mag_block_cache_lock();
+    size const cached_bytes = mag_block_cache.cached_bytes;
+    mag_block_cache_unlock();
+
+    return cached_bytes;
+}
+
+static inline void
+mag_dyn_arena_block_free(MagDynArenaBlock *block, MagMemoryOptions options)
+{
+    if(!mag_block_cache_give(block, options)) { mag_sys_memory_free(&block->buf); }
+}
+
+static inline MagDynArenaBlock *
+mag_dyn_arena_block_create(size block_size, MagMemoryOptions options)
+{
+    MagDynArenaBlock *cached = mag_block_cache_take(block_size + sizeof(MagDynArenaBlock), options);
+    if(cached)
+    {
+        cached->max_buf_offset = sizeof(MagDynArenaBlock);
+        cached->next = NULL;
+        return cached;
+    }
+
+    MagMemoryBlock mem = mag_sys_memory_allocate_options(block_size + sizeof(MagDynArenaBlock), options);
+    if(MAG_MEM_IS_VALID(mem))
+    {
+        /* Place the block metadata at the beginning of the memory block. */
+        MagDynArenaBlock *block = (void *)mem.mem;
+        block->max_buf_offset = sizeof(MagDynArenaBlock);
+        block->buf = mem;
+        block->next = NULL;
+
+        return block;
+    }
+
+    return NULL;
+}
+
+static inline void *
+mag_dyn_arena_block_alloc(MagDynArena *arena, MagDynArenaBlock *block, size num_bytes, size alignment)
+{
+    Assert(num_bytes > 0 && alignment > 0);
+
+    /* Align 'curr_offset' forward to the specified alignment */
+    uptr curr_ptr = (uptr)block->buf.mem + (uptr)arena->current_offset;
+    uptr offset = mag_align_pointer(curr_ptr, alignment);
+    offset -= (uptr)block->buf.mem; /* change to relative offset from start of buffer */
+
+    /* Check to see if there is enough space left */
+    if ((size)(offset + num_bytes) <= block->buf.size)
+    {
+        void *ptr = &block->buf.mem[offset];
+
+        arena->prev_offset = arena->current_offset;
+        arena->prev_ptr = ptr;
+
+        MAG_STATS_UPDATE(mag_alloc_stats_alloc(&arena->stats, num_bytes, (size)offset - arena->current_offset));
+        arena->current_offset = offset + num_bytes;
+        block->max_buf_offset = block->max_buf_offset < arena->current_offset ? arena->current_offset : block->max_buf_offset;
+
+        return ptr;
+    }
+
+    return NULL;
+}
+
+static inline MagDynArena 
+mag_dyn_arena_create(size default_block_size)
+{
+    return mag_dyn_arena_create_options(default_block_size, (MagMemoryOptions){0});
+}
+
+static inline MagDynArena 
+mag_dyn_arena_create_options(size default_block_size, MagMemoryOptions options)
+{
+    MagDynArena arena = {0};
+    options = mag_memory_options_resolve_numa_internal(options);
+
+    MagDynArenaBlock *block = mag_dyn_arena_block_create(default_block_size, options);
+    if(block) 
+    { 
+        arena.head_block = block;
+        arena.current_block = block;
+        arena.current_offset = sizeof(MagDynArenaBlock);
+        arena.default_block_size = default_block_size;
+        arena.block_options = options;
+
+        arena.prev_offset = 0;
+        arena.prev_ptr = block;
+
+        MAG_STATS_UPDATE(arena.stats.num_blocks = 1);
+    }
+
+    return arena;
+}
+
+static inline void 
+mag_dyn_arena_destroy(MagDynArena *arena)
+{
+    MagDynArenaBlock *curr = arena->head_block;
+
+    /* Iterate through the linked list and free all the blocks. */
+    while(curr)
+    {
+        MagDynArenaBlock *next = curr->next;
+        mag_dyn_arena_block_free(curr, arena->block_options);
+        curr = next;
+    }
+
+    *arena = (MagDynArena){0};
+
+    return;
+}
+
+static inline void 
+mag_dyn_arena_reset(MagDynArena *arena, b32 coalesce)
+{
+    /* Only actually do the coalesce if there is more than 1 block. */
+    b32 do_coalesce = coalesce && (arena->head_block->next != NULL);
+
+    MagDynArenaBlock *curr = NULL;
+    if(do_coalesce)
+    {
+        size allocations_ceiling = mag_dyn_arena_usage_ceiling(arena);
+
+        /* Delete all the blocks. */
+        curr = arena->head_block;
+        while(curr)
+        {
+            MagDynArenaBlock *next = curr->next;
+            mag_dyn_arena_block_free(curr, arena->block_options);
+            curr = next;
+        }
+
+        /* Create a block large enough to hold ALL the data from last time in a single block. */
+        MagDynArenaBlock *block = mag_dyn_arena_block_create(allocations_ceiling, arena->block_options);
+        if(!block) { Panic(); } /* This shouldn't happen, we literally just freed this much or more memory! */
+        MAG_STATS_UPDATE(arena->stats.num_blocks++);
+
+        arena->head_block = block;
+        arena->current_block = block;
+        arena->current_offset = sizeof(MagDynArenaBlock);
+        /* arena->default_block_size = ...doesn't need changed; */
+
+        arena->prev_offset = 0;
+        arena->prev_ptr = block;
+    }
+    else
+    {
+        /* Set the new current block to the head of the list. */
+        arena->current_block  = arena->head_block;
+        arena->current_offset = sizeof(MagDynArenaBlock);
+        /* arena->default_block_size = ...doesn't need changed; */
+
+        arena->prev_offset = 0;
+        arena->prev_ptr = arena->head_block;
+    }
+
+    MAG_STATS_UPDATE(arena->stats.bytes_in_use = 0);
+    MAG_TRACE_RECORD(mag_trace_record_internal(MAG_TRACE_RESET, MAG_ALLOC_T_DYN_ARENA, arena, NULL, NULL, 0, 0));
+
+    return;
+}
+
+static inline void 
+mag_dyn_arena_reset_default(MagDynArena *arena)
+{
+    mag_dyn_arena_reset(arena, true);
+}
+
+static inline void
+mag_dyn_arena_reset_trim(MagDynArena *arena, size watermark)
+{
+    mag_dyn_arena_reset(arena, false);
+
+    size kept = 0;
+    for(MagDynArenaBlock *block = arena->head_block; block; block = block->next)
+    {
+        /* The header has to stay, the blocks are linked through it. */
+        size keep = watermark - kept;
+        keep = keep < (size)sizeof(MagDynArenaBlock) ? (size)sizeof(MagDynArenaBlock) : keep;
+
+        if(keep < block->buf.size)
+        {
+            size const page_size = block->buf.page_size ? block->buf.page_size : mag_sys_memory_page_size();
+            size const purge_start = ((keep + page_size - 1) / page_size) * page_size;
+            if(purge_start < block->buf.size)
+            {
+                mag_sys_memory_purge(block->buf.mem + purge_start, block->buf.size - purge_start);
+                block->max_buf_offset = block->max_buf_offset < purge_start ? block->max_buf_offset : purge_start;
+            }
+        }
+
+        kept += keep < block->buf.size ? keep : block->buf.size;
+    }
+}
+
+static inline void
+mag_dyn_arena_block_remove(MagDynArenaBlock *block, MagDynArenaBlock *prev)
+{
+    Assert(block);
+
+    MagDynArenaBlock *next = block->next;
+    if(prev) { prev->next = next; }
+}
+
+static inline void
+mag_dyn_arena_block_insert(MagDynArenaBlock *block, MagDynArenaBlock *after_this_one, MagDynArenaBlock *before_this_one)
+{
+    Assert(block);
+
+    if(after_this_one) { after_this_one->next = block; }
+    block->next = before_this_one;
+}
+
+static inline MagDynArenaBlock *
+mag_dyn_arena_add_block_internal(MagDynArena *arena, size min_bytes)
+{
+
+    /* Search through the list to find a large enough block. */
+
+    /* Take the first one if possible, no fixup needed. */
+    MagDynArenaBlock *curr = arena->current_block->next;
+    MagDynArenaBlock *prev = NULL;
+    if(curr)
+    {
+        if(curr->buf.size >= min_bytes + (size)sizeof(MagDynArenaBlock)) { return curr; }
+        prev = curr;
+        curr = curr->next;
+    }
+
+    while(curr)
+    {
+        if(curr->buf.size >= min_bytes + (size)sizeof(MagDynArenaBlock))
+        {
+            prev->next = curr->next;
+            curr->next = arena->current_block->next;
+            arena->current_block->next = curr;
+            return curr;
+        }
+
+        prev = curr;
+        curr = curr->next;
+    }
+
+    /* If you couldn't find a large enough block on the main list, create a new one and insert it. */
+    MagDynArenaBlock *block = mag_dyn_arena_block_create(min_bytes, arena->block_options);
+    if(!block) { return NULL; }
+    MAG_STATS_UPDATE(arena->stats.num_blocks++);
+
+    block->next = arena->current_block->next;
+    arena->current_block->next = block;
+    arena->current_block = block;
+
+    return block;
+}
+
+static inline void *
+mag_dyn_arena_alloc_uninit_internal(MagDynArena *arena, size num_bytes, size alignment)
+{
+    Assert(num_bytes > 0 && alignment > 0);
+
+    /* Look for space in the current block. */
+    MagDynArenaBlock *block = arena->current_block;
+    void *ptr = mag_dyn_arena_block_alloc(arena, block, num_bytes, alignment);
+    if(ptr) { return ptr; }
+
+    /* We need to add another block. */
+    size block_size = num_bytes + alignment > arena->default_block_size ? num_bytes + alignment : arena->default_block_size;
+    block = mag_dyn_arena_add_block_internal(arena, block_size);
+    if(block)
+    {
+        arena->current_offset = sizeof(MagDynArenaBlock);
+        arena->current_block = block;
+        ptr = mag_dyn_arena_block_alloc(arena, block, num_bytes, alignment);
+    }
+
+    /* Give up. */
+    return ptr;
+}
+
+static inline void *
+mag_dyn_arena_alloc(MagDynArena *arena, size num_bytes, size alignment)
+{
+    void *ptr = mag_dyn_arena_alloc_uninit_internal(arena, num_bytes, alignment);
+    if(ptr) { memset(ptr, 0, num_bytes); }
+    MAG_TRACE_RECORD(mag_trace_record_internal(MAG_TRACE_ALLOC, MAG_ALLOC_T_DYN_ARENA, arena, ptr, NULL, num_bytes, alignment));
+    return ptr;
+}
+
+static inline void *
+mag_dyn_arena_alloc_uninit(MagDynArena *arena, size num_bytes, size alignment)
+{
+    void *ptr = mag_dyn_arena_alloc_uninit_internal(arena, num_bytes, alignment);
+    MAG_TRACE_RECORD(mag_trace_record_internal(MAG_TRACE_ALLOC, MAG_ALLOC_T_DYN_ARENA, arena, ptr, NULL, num_bytes, alignment));
+    return ptr;
+}
+
+static inline void *
+mag_dyn_arena_realloc_internal(MagDynArena *arena, void *ptr, size num_bytes, size alignment)
+{
+    Assert(num_bytes > 0);
+
+    if(ptr == arena->prev_ptr)
+    {
+        /* Get previous extra offset due to alignment */
+        uptr offset = (uptr)ptr - (uptr)arena->current_block->buf.mem; /* relative offset accounting for alignment */
+
+        /* Check to see if there is enough space left */
+        if ((size)(offset + num_bytes) <= arena->current_block->buf.size)
+        {
+            MAG_STATS_UPDATE(mag_alloc_stats_realloc(&arena->stats, true, (size)(offset + num_bytes) - arena->current_offset));
+            arena->current_offset = offset + num_bytes;
+            return ptr;
+        }
+    }
+
+    /* Get the previous allocation size, or at least a ceiling for it. Nothing in a block goes past its max_buf_offset. */
+    MagDynArenaBlock *block = arena->current_block;
+    size end_offset = arena->current_offset;
+    if((byte *)ptr < block->buf.mem || (byte *)ptr >= block->buf.mem + end_offset)
+    {
+        block = arena->head_block;
+        while(block && ((byte *)ptr < block->buf.mem || (byte *)ptr >= block->buf.mem + block->max_buf_offset))
+        {
+            block = block->next;
+        }
+
+        Assert(block); /* ptr didn't come from this arena! */
+        end_offset = block->max_buf_offset;
+    }
+
+    size prev_alloc_size_ceiling = (size)(block->buf.mem + end_offset - (byte *)ptr);
+    prev_alloc_size_ceiling = prev_alloc_size_ceiling < num_bytes ? prev_alloc_size_ceiling : num_bytes;
+
+    void *new = mag_dyn_arena_alloc_uninit_internal(arena, num_bytes, alignment);
+    if(new) 
+    {
+        memcpy(new, ptr, prev_alloc_size_ceiling); 
+        MAG_STATS_UPDATE(mag_alloc_stats_realloc(&arena->stats, false, 0));
+    }
+
+    return new;
+}
+
+static inline void *
+mag_dyn_arena_realloc(MagDynArena *arena, void *ptr, size num_bytes, size alignment)
+{
+    void *new = mag_dyn_arena_realloc_internal(arena, ptr, num_bytes, alignment);
+    MAG_TRACE_RECORD(mag_trace_record_internal(MAG_TRACE_REALLOC, MAG_ALLOC_T_DYN_ARENA, arena, new, ptr, num_bytes, alignment));
+    return new;
+}
+
+static inline void 
+mag_dyn_arena_free(MagDynArena *arena, void *ptr)
+{
+    if(ptr == arena->prev_ptr)
+    {
+        MAG_STATS_UPDATE(mag_alloc_stats_use(&arena->stats, arena->prev_offset - arena->current_offset));
+        arena->current_offset = arena->prev_offset;
+    }
+
+    MAG_TRACE_RECORD(mag_trace_record_internal(MAG_TRACE_FREE, MAG_ALLOC_T_DYN_ARENA, arena, NULL, ptr, 0, 0));
+    return;
+}
+
+static inline size
+mag_dyn_arena_usage_ceiling(MagDynArena *arena)
+{
+    size total_allocation_size = 0;
+
+    MagDynArenaBlock *curr = arena->head_block;
+
+    while(curr)
+    {
+        total_allocation_size += curr->max_buf_offset;
+        curr = curr->next;
+    }
+
+    return total_allocation_size;
+}
+
+static inline MagArenaSavepoint
+mag_static_arena_savepoint(MagStaticArena *arena)
+{
+    return (MagArenaSavepoint)
+        {
+            .offset = arena->buf_offset,
+            .prev_ptr = arena->prev_ptr,
+            .prev_offset = arena->prev_offset,
+        };
+}
+
+static inline void
+mag_static_arena_restore(MagStaticArena *arena, MagArenaSavepoint savepoint)
+{
+    Assert(savepoint.offset <= arena->buf_offset);
+
+    MAG_STATS_UPDATE(mag_alloc_stats_use(&arena->stats, savepoint.offset - arena->buf_offset));
+    arena->buf_offset = savepoint.offset;
+    arena->prev_ptr = savepoint.prev_ptr;
+    arena->prev_offset = savepoint.prev_offset;
+}
+
+static inline MagArenaSavepoint
+mag_dyn_arena_savepoint(MagDynArena *arena)
+{
+    MagArenaSavepoint savepoint = 
+        {
+            .block = arena->current_block,
+            .offset = arena->current_offset,
+            .prev_ptr = arena->prev_ptr,
+            .prev_offset = arena->prev_offset,
+        };
+
+    MAG_STATS_UPDATE(savepoint.bytes_in_use = arena->stats.bytes_in_use);
+
+    return savepoint;
+}
+
+static inline void
+mag_dyn_arena_restore(MagDynArena *arena, MagArenaSavepoint savepoint)
+{
+    Assert(savepoint.block);
+
+    /* Blocks are only ever added or shuffled after the current block, so the saved block is still in the list and every
+     * block added since comes after it, ready to be reused. */
+    arena->current_block = savepoint.block;
+    arena->current_offset = savepoint.offset;
+    arena->prev_ptr = savepoint.prev_ptr;
+    arena->prev_offset = savepoint.prev_offset;
+    MAG_STATS_UPDATE(arena->stats.bytes_in_use = savepoint.bytes_in_use);
+}
+
+static inline MagVirtualArena
+mag_virtual_arena_create(size reserve_num_bytes)
+{
+    MagVirtualArena arena = {0};
+    arena.buf = mag_sys_memory_reserve(reserve_num_bytes);
+    return arena;
+}
+
+static inline void
+mag_virtual_arena_destroy(MagVirtualArena *arena)
+{
+    mag_sys_memory_free(&arena->buf);
+    memset(arena, 0, sizeof(*arena));
+}
+
+static inline void
+mag_virtual_arena_reset(MagVirtualArena *arena, b32 decommit)
+{
+    Assert(arena->buf.mem);
+
+    if(decommit && arena->committed > 0)
+    {
+        mag_sys_memory_decommit(arena->buf.mem, arena->committed);
+        arena->committed = 0;
+        arena->high_water = 0;
+    }
+
+    arena->buf_offset = 0;
+    arena->prev_ptr = NULL;
+    arena->prev_offset = 0;
+    MAG_STATS_UPDATE(arena->stats.bytes_in_use = 0);
+}
+
+static inline void
+mag_virtual_arena_reset_default(MagVirtualArena *arena)
+{
+    mag_virtual_arena_reset(arena, true);
+}
+
+static inline void
+mag_virtual_arena_reset_trim(MagVirtualArena *arena, size watermark)
+{
+    mag_virtual_arena_reset(arena, false);
+    StopIf(watermark >= arena->committed, return);
+
+    size const chunk = MAG_VIRTUAL_ARENA_COMMIT_CHUNK;
+    size const keep = ((watermark + chunk - 1) / chunk) * chunk;
+    if(keep < arena->committed)
+    {
+        mag_sys_memory_decommit(arena->buf.mem + keep, arena->committed - keep);
+        arena->committed = keep;
+        arena->high_water = arena->high_water < keep ? arena->high_water : keep;
+    }
+}
+
+static inline b32
+mag_virtual_arena_commit_to(MagVirtualArena *arena, size end_offset)
+{
+    if(end_offset <= arena->committed) { return true; }
+
+    size chunk = MAG_VIRTUAL_ARENA_COMMIT_CHUNK;
+    size new_committed = ((end_offset + chunk - 1) / chunk) * chunk;
+    new_committed = new_committed < arena->buf.size ? new_committed : arena->buf.size;
+
+    b32 success = mag_sys_memory_commit(arena->buf.mem + arena->committed, new_committed - arena->committed);
+    if(success) 
+    {
+        arena->committed = new_committed;
+        MAG_STATS_UPDATE(arena->stats.num_blocks++);
+    }
+
+    return success;
+}
+
+static inline void *
+mag_virtual_arena_alloc(MagVirtualArena *arena, size num_bytes, size alignment)
+{
+    size const high_water = arena->high_water;
+
+    byte *ptr = mag_virtual_arena_alloc_uninit(arena, num_bytes, alignment);
+    if(ptr)
+    {
+        /* Only memory below the old high water mark may have been used, the rest is fresh from the OS. */
+        size const offset = ptr - arena->buf.mem;
+        if(offset < high_water)
+        {
+            size const dirty = high_water - offset;
+            memset(ptr, 0, dirty < num_bytes ? dirty : num_bytes);
+        }
+    }
+
+    return ptr;
+}
+
+static inline void *
+mag_virtual_arena_alloc_uninit(MagVirtualArena *arena, size num_bytes, size alignment)
+{
+    Assert(num_bytes > 0 && alignment > 0);
+
+    /* Align 'curr_offset' forward to the specified alignment */
+    uptr curr_ptr = (uptr)arena->buf.mem + (uptr)arena->buf_offset;
+    uptr offset = mag_align_pointer(curr_ptr, alignment);
+    offset -= (uptr)arena->buf.mem; /* change to relative offset */
+
+    /* Check to see if there is enough space left */
+    size const end = (size)(offset + num_bytes);
+    if (end <= arena->buf.size && mag_virtual_arena_commit_to(arena, end))
+    {
+        void *ptr = &arena->buf.mem[offset];
+        MAG_STATS_UPDATE(mag_alloc_stats_alloc(&arena->stats, num_bytes, (size)offset - arena->buf_offset));
+
+        arena->prev_offset = arena->buf_offset;
+        arena->prev_ptr = ptr;
+
+        arena->buf_offset = end;
+        arena->high_water = arena->high_water < end ? end : arena->high_water;
+
+        return ptr;
+    }
+
+    return NULL;
+}
+
+static inline void *
+mag_virtual_arena_realloc(MagVirtualArena *arena, void *ptr, size num_bytes, size alignment)
+{
+    Assert(num_bytes > 0);
+
+    uptr offset = (uptr)ptr - (uptr)arena->buf.mem;
+
+    if(ptr == arena->prev_ptr)
+    {
+        /* Grow or shrink in place, committing more memory if needed. */
+        size const end = (size)(offset + num_bytes);
+        if(end <= arena->buf.size && mag_virtual_arena_commit_to(arena, end))
+        {
+            MAG_STATS_UPDATE(mag_alloc_stats_realloc(&arena->stats, true, end - arena->buf_offset));
+            arena->buf_offset = end;
+            arena->high_water = arena->high_water < end ? end : arena->high_water;
+            return ptr;
+        }
+
+        return NULL;
+    }
+
+    /* Not the last allocation, the old allocation is no bigger than everything after it. */
+    size prev_alloc_size_ceiling = arena->buf_offset - (size)offset;
+    prev_alloc_size_ceiling = prev_alloc_size_ceiling < num_bytes ? prev_alloc_size_ceiling : num_bytes;
+
+    void *new = mag_virtual_arena_alloc_uninit(arena, num_bytes, alignment);
+    if(new) 
+    {
+        memcpy(new, ptr, prev_alloc_size_ceiling); 
+        MAG_STATS_UPDATE(mag_alloc_stats_realloc(&arena->stats, false, 0));
+    }
+
+    return new;
+}
+
+static inline void
+mag_virtual_arena_free(MagVirtualArena *arena, void *ptr)
+{
+    if(ptr == arena->prev_ptr)
+    {
+        MAG_STATS_UPDATE(mag_alloc_stats_use(&arena->stats, arena->prev_offset - arena->buf_offset));
+        arena->buf_offset = arena->prev_offset;
+    }
+
+    return;
+}
+
+static inline MagArenaSavepoint
+mag_virtual_arena_savepoint(MagVirtualArena *arena)
+{
+    return (MagArenaSavepoint)
+        {
+            .offset = arena->buf_offset,
+            .prev_ptr = arena->prev_ptr,
+            .prev_offset = arena->prev_offset,
+        };
+}
+
+static inline void
+mag_virtual_arena_restore(MagVirtualArena *arena, MagArenaSavepoint savepoint)
+{
+    Assert(savepoint.offset <= arena->buf_offset);
+
+    /* high_water stays where it is, so zeroing allocations still clear the memory handed out again. */
+    MAG_STATS_UPDATE(mag_alloc_stats_use(&arena->stats, savepoint.offset - arena->buf_offset));
+    arena->buf_offset = savepoint.offset;
+    arena->prev_ptr = savepoint.prev_ptr;
+    arena->prev_offset = savepoint.prev_offset;
+}
+
+struct MagConcurrentArenaBlock
+{
+    MagMemoryBlock buf;
+    _Atomic(size) offset;
+    MagConcurrentArenaBlock *next;
+};
+
+static inline size
+mag_concurrent_arena_block_start(void)
+{
+    size const grain = MAG_CONCURRENT_ARENA_GRAIN;
+    return ((sizeof(MagConcurrentArenaBlock) + grain - 1) / grain) * grain;
+}
+
+static inline MagConcurrentArenaBlock *
+mag_concurrent_arena_block_create(size block_size, MagMemoryOptions options)
+{
+    MagMemoryBlock mem = mag_sys_memory_allocate_options(block_size + mag_concurrent_arena_block_start(), options);
+    if(MAG_MEM_IS_VALID(mem))
+    {
+        /* Place the block metadata at the beginning of the memory block. */
+        MagConcurrentArenaBlock *block = (void *)mem.mem;
+        block->buf = mem;
+        block->next = NULL;
+        atomic_init(&block->offset, mag_concurrent_arena_block_start());
+
+        return block;
+    }
+
+    return NULL;
+}
+
+static inline void
+mag_concurrent_arena_push_block(MagConcurrentArena *arena, MagConcurrentArenaBlock *block)
+{
+    MagConcurrentArenaBlock *head = atomic_load_explicit(&arena->blocks, memory_order_relaxed);
+    do
+    {
+        block->next = head;
+    } while(!atomic_compare_exchange_weak_explicit(&arena->blocks, &head, block, memory_order_release, memory_order_relaxed));
+}
+
+static inline MagConcurrentArena
+mag_concurrent_arena_create(size default_block_size)
+{
+    return mag_concurrent_arena_create_options(default_block_size, (MagMemoryOptions){0});
+}
+
+static inline MagConcurrentArena
+mag_concurrent_arena_create_options(size default_block_size, MagMemoryOptions options)
+{
+    options = mag_memory_options_resolve_numa_internal(options);
+    MagConcurrentArena arena = { .default_block_size = default_block_size, .block_options = options };
+    atomic_init(&arena.current, NULL);
+    atomic_init(&arena.blocks, NULL);
+    atomic_init(&arena.spare, NULL);
+
+    MagConcurrentArenaBlock *block = mag_concurrent_arena_block_create(default_block_size, options);
+    if(block)
+    {
+        atomic_init(&arena.current, block);
+        atomic_init(&arena.blocks, block);
+        MAG_STATS_UPDATE(atomic_init(&arena.stats.num_blocks, 1));
+    }
+
+    return arena;
+}
+
+static inline void
+mag_concurrent_arena_destroy(MagConcurrentArena *arena)
+{
+    MagConcurrentArenaBlock *curr = atomic_load(&arena->blocks);
+    while(curr)
+    {
+        MagConcurrentArenaBlock *next = curr->next;
+        mag_sys_memory_free(&curr->buf);
+        curr = next;
+    }
+
+    MagConcurrentArenaBlock *spare = atomic_load(&arena->spare);
+    if(spare) { mag_sys_memory_free(&spare->buf); }
+
+    atomic_store(&arena->current, NULL);
+    atomic_store(&arena->blocks, NULL);
+    atomic_store(&arena->spare, NULL);
+}
+
+static inline void
+mag_concurrent_arena_reset(MagConcurrentArena *arena)
+{
+    MagConcurrentArenaBlock *current = atomic_load(&arena->current);
+    Assert(current);
+
+    /* Big allocations can be in newer blocks than the current one, so walk the whole list. */
+    MagConcurrentArenaBlock *curr = atomic_load(&arena->blocks);
+    while(curr)
+    {
+        MagConcurrentArenaBlock *next = curr->next;
+        if(curr != current) { mag_sys_memory_free(&curr->buf); }
+        curr = next;
+    }
+
+    current->next = NULL;
+    atomic_store(&current->offset, mag_concurrent_arena_block_start());
+    atomic_store(&arena->blocks, current);
+    MAG_STATS_UPDATE(atomic_store(&arena->stats.bytes_in_use, 0));
+}
+
+static inline b32
+mag_concurrent_arena_grow(MagConcurrentArena *arena, MagConcurrentArenaBlock *full)
+{
+    /* Somebody else may have already replaced it. */
+    if(atomic_load_explicit(&arena->current, memory_order_acquire) != full) { return true; }
+
+    MagConcurrentArenaBlock *block = atomic_exchange_explicit(&arena->spare, NULL, memory_order_acquire);
+    if(!block)
+    {
+        block = mag_concurrent_arena_block_create(arena->default_block_size, arena->block_options);
+        if(!block) { return false; }
+        MAG_STATS_UPDATE(mag_atomic_alloc_stats_add(&arena->stats, &(MagAllocStats){ .num_blocks = 1 }));
+    }
+
+    MagConcurrentArenaBlock *expected = full;
+    if(atomic_compare_exchange_strong_explicit(&arena->current, &expected, block, memory_order_acq_rel, memory_order_acquire))
+    {
+        mag_concurrent_arena_push_block(arena, block);
+        return true;
+    }
+
+    /* Lost the race, save the block for next time. If there already is a spare it just waits in the list to be freed. */
+    MagConcurrentArenaBlock *no_spare = NULL;
+    if(!atomic_compare_exchange_strong_explicit(&arena->spare, &no_spare, block, memory_order_release, memory_order_relaxed))
+    {
+        mag_concurrent_arena_push_block(arena, block);
+    }
+
+    return true;
+}
+
+static inline void *
+mag_concurrent_arena_alloc(MagConcurrentArena *arena, size num_bytes, size alignment)
+{
+    void *ptr = mag_concurrent_arena_alloc_uninit(arena, num_bytes, alignment);
+    if(ptr) { memset(ptr, 0, num_bytes); }
+    return ptr;
+}
+
+static inline size
+mag_concurrent_arena_request_size(size num_bytes, size alignment)
+{
+    /* Offsets are always a multiple of the grain, so only bigger alignments need padding. */
+    size const grain = MAG_CONCURRENT_ARENA_GRAIN;
+    size const padding = alignment > grain ? alignment - grain : 0;
+    return ((num_bytes + padding + grain - 1) / grain) * grain;
+}
+
+static inline void *
+mag_concurrent_arena_bump(MagConcurrentArena *arena, size num_bytes, size alignment)
+{
+    Assert(num_bytes > 0 && alignment > 0 && mag_is_power_of_2(alignment));
+
+    size const request = mag_concurrent_arena_request_size(num_bytes, alignment);
+    if(request > arena->default_block_size / 4)
+    {
+        MagConcurrentArenaBlock *block = mag_concurrent_arena_block_create(request, arena->block_options);
+        if(!block) { return NULL; }
+        MAG_STATS_UPDATE(mag_atomic_alloc_stats_add(&arena->stats, &(MagAllocStats){ .num_blocks = 1 }));
+
+        /* Nobody else can see the block until it is pushed. */
+        size const start = atomic_load_explicit(&block->offset, memory_order_relaxed);
+        atomic_store_explicit(&block->offset, start + request, memory_order_relaxed);
+        mag_concurrent_arena_push_block(arena, block);
+
+        return (void *)mag_align_pointer((uptr)block->buf.mem + start, alignment);
+    }
+
+    while(true)
+    {
+        MagConcurrentArenaBlock *block = atomic_load_explicit(&arena->current, memory_order_acquire);
+        StopIf(!block, return NULL);
+
+        /* If this runs past the end the block is full, and every other thread will see that too. */
+        size const start = atomic_fetch_add_explicit(&block->offset, request, memory_order_relaxed);
+        if(start + request <= block->buf.size)
+        {
+            return (void *)mag_align_pointer((uptr)block->buf.mem + start, alignment);
+        }
+
+        if(!mag_concurrent_arena_grow(arena, block)) { return NULL; }
+    }
+}
+
+static inline void *
+mag_concurrent_arena_alloc_uninit(MagConcurrentArena *arena, size num_bytes, size alignment)
+{
+    void *ptr = mag_concurrent_arena_bump(arena, num_bytes, alignment);
+
+#if MAG_STATS
+    if(ptr)
+    {
+        MagAllocStats delta = {0};
+        mag_alloc_stats_alloc(&delta, num_bytes, mag_concurrent_arena_request_size(num_bytes, alignment) - num_bytes);
+        mag_atomic_alloc_stats_add(&arena->stats, &delta);
+    }
+#endif
+
+    return ptr;
+}
+
+static inline MagConcurrentArenaCache
+mag_concurrent_arena_cache_create(MagConcurrentArena *arena)
+{
+    return (MagConcurrentArenaCache){ .arena = arena };
+}
+
+static inline void *
+mag_concurrent_arena_cache_alloc(MagConcurrentArenaCache *cache, size num_bytes, size alignment)
+{
+    void *ptr = mag_concurrent_arena_cache_alloc_uninit(cache, num_bytes, alignment);
+    if(ptr) { memset(ptr, 0, num_bytes); }
+    return ptr;
+}
+
+static inline void *
+mag_concurrent_arena_cache_alloc_uninit(MagConcurrentArenaCache *cache, size num_bytes, size alignment)
+{
+    Assert(num_bytes > 0 && alignment > 0 && mag_is_power_of_2(alignment));
+
+    if(cache->next)
+    {
+        uptr ptr = mag_align_pointer((uptr)cache->next, alignment);
+        if(ptr + num_bytes <= (uptr)cache->end)
+        {
+            MAG_STATS_UPDATE(mag_alloc_stats_alloc(&cache->stats, num_bytes, (size)(ptr - (uptr)cache->next)));
+            cache->next = (byte *)(ptr + num_bytes);
+            return (void *)ptr;
+        }
+    }
+
+    /* Refill with a chunk that is sure to come from a shared block, and send big requests straight to the arena. */
+    size refill = cache->arena->default_block_size / 4;
+    refill = refill < MAG_CONCURRENT_ARENA_CACHE_SIZE ? refill : MAG_CONCURRENT_ARENA_CACHE_SIZE;
+    if(num_bytes + alignment > refill / 4)
+    {
+        return mag_concurrent_arena_alloc_uninit(cache->arena, num_bytes, alignment);
+    }
+
+    byte *chunk = mag_concurrent_arena_bump(cache->arena, refill, MAG_CONCURRENT_ARENA_GRAIN);
+    if(!chunk) { return NULL; }
+
+#if MAG_STATS
+    /* What was left of the old chunk is padding now, and the whole new chunk is in use as far as the arena can tell. */
+    cache->stats.bytes_padding += cache->end - cache->next;
+    cache->stats.bytes_in_use = refill;
+    mag_atomic_alloc_stats_add(&cache->arena->stats, &cache->stats);
+    cache->stats = (MagAllocStats){0};
+#endif
+
+    uptr ptr = mag_align_pointer((uptr)chunk, alignment);
+    MAG_STATS_UPDATE(mag_alloc_stats_alloc(&cache->stats, num_bytes, (size)(ptr - (uptr)chunk)));
+    cache->next = (byte *)(ptr + num_bytes);
+    cache->end = chunk + refill;
+
+    return (void *)ptr;
+}
+
+static inline void
+mag_static_pool_initialize_linked_list(byte *buffer, size object_size, size num_objects)
+{
+
+    /* Initialize the free list to a linked list. */
+
+    /* start by pointing to last element and assigning it NULL */
+    size offset = object_size * (num_objects - 1);
+    uptr *ptr = (uptr *)&buffer[offset];
+    *ptr = (uptr)NULL;
+
+    /* Then work backwards to the front of the list. */
+    while (offset) 
+    {
+        size next_offset = offset;
+        offset -= object_size;
+        ptr = (uptr *)&buffer[offset];
+        uptr next = (uptr)&buffer[next_offset];
+        *ptr = next;
+    }
+
+    return;
+}
+
+static inline void
+mag_static_pool_reset(MagStaticPool *pool)
+{
+    Assert(pool && pool->buf.mem && pool->num_objects && pool->object_size);
+
+    /* Initialize the free list to a linked list. */
+    mag_static_pool_initialize_linked_list(pool->buf.mem, pool->object_size, pool->num_objects);
+    pool->free = &pool->buf.mem[0];
+    MAG_STATS_UPDATE(pool->stats.bytes_in_use = 0);
+}
+
+static inline MagStaticPool
+mag_static_pool_create(size object_size, size num_objects, byte buffer[])
+{
+    Assert(object_size >= sizeof(void *));       /* Need to be able to fit at least a pointer! */
+    Assert(object_size % _Alignof(void *) == 0); /* Need for alignment of pointers.            */
+    Assert(num_objects > 0);
+
+    MagMemoryBlock mblk = mag_wrap_memory(num_objects * object_size, buffer);
+    MagStaticPool pool = { .buf = mblk, .object_size = object_size, .num_objects = num_objects };
+
+    mag_static_pool_reset(&pool);
+
+    return pool;
+}
+
+static inline void
+mag_static_pool_destroy(MagStaticPool *pool)
+{
+    mag_sys_memory_free(&pool->buf);
+    memset(pool, 0, sizeof(*pool));
+}
+
+static inline void
+mag_static_pool_free(MagStaticPool *pool, void *ptr)
+{
+    uptr *next = ptr;
+    *next = (uptr)pool->free;
+    pool->free = ptr;
+    MAG_STATS_UPDATE(mag_alloc_stats_use(&pool->stats, -pool->object_size));
+}
+
+static inline void *
+mag_static_pool_alloc(MagStaticPool *pool)
+{
+    void *ptr = pool->free;
+    uptr *next = pool->free;
+
+    if (ptr) 
+    {
+        pool->free = (void *)*next;
+        memset(ptr, 0, pool->object_size);
+        MAG_STATS_UPDATE(mag_alloc_stats_alloc(&pool->stats, pool->object_size, 0));
+    }
+
+    return ptr;
+}
+
+
+struct MagDynPoolBlock
+{
+    MagMemoryBlock buf;
+    MagDynPoolBlock *next;
+};
+
+static inline size
+mag_dyn_pool_objects_offset(void)
+{
+    size const align = _Alignof(max_align_t);
+    return ((sizeof(MagDynPoolBlock) + align - 1) / align) * align;
+}
+
+static inline MagDynPool
+mag_dyn_pool_create(size object_size, size objects_per_block)
+{
+    Assert(object_size >= sizeof(void *));       /* Need to be able to fit at least a pointer! */
+    Assert(object_size % _Alignof(void *) == 0); /* Need for alignment of pointers.            */
+    Assert(objects_per_block > 0);
+
+    return (MagDynPool){ .object_size = object_size, .objects_per_block = objects_per_block };
+}
+
+static inline void
+mag_dyn_pool_destroy(MagDynPool *pool)
+{
+    MagDynPoolBlock *curr = pool->blocks;
+    while(curr)
+    {
+        MagDynPoolBlock *next = curr->next;
+        mag_sys_memory_free(&curr->buf);
+        curr = next;
+    }
+
+    memset(pool, 0, sizeof(*pool));
+}
+
+static inline void
+mag_dyn_pool_thread_block(MagDynPool *pool, MagDynPoolBlock *block)
+{
+    /* Put all the objects in the block on the front of the free list. */
+    byte *objects = block->buf.mem + mag_dyn_pool_objects_offset();
+    mag_static_pool_initialize_linked_list(objects, pool->object_size, pool->objects_per_block);
+
+    uptr *last = (uptr *)(objects + (pool->objects_per_block - 1) * pool->object_size);
+    *last = (uptr)pool->free;
+    pool->free = objects;
+}
+
+static inline void
+mag_dyn_pool_reset(MagDynPool *pool)
+{
+    pool->free = NULL;
+    for(MagDynPoolBlock *block = pool->blocks; block; block = block->next) { mag_dyn_pool_thread_block(pool, block); }
+    MAG_STATS_UPDATE(pool->stats.bytes_in_use = 0);
+}
+
+static inline void
+mag_dyn_pool_free(MagDynPool *pool, void *ptr)
+{
+    uptr *next = ptr;
+    *next = (uptr)pool->free;
+    pool->free = ptr;
+    MAG_STATS_UPDATE(mag_alloc_stats_use(&pool->stats, -pool->object_size));
+}
+
+static inline void *
+mag_dyn_pool_alloc(MagDynPool *pool)
+{
+    if(!pool->free)
+    {
+        MagMemoryBlock mem = 
+            mag_sys_memory_allocate(mag_dyn_pool_objects_offset() + pool->object_size * pool->objects_per_block);
+        if(!MAG_MEM_IS_VALID(mem)) { return NULL; }
+
+        MagDynPoolBlock *block = (void *)mem.mem;
+        block->buf = mem;
+        block->next = pool->blocks;
+        pool->blocks = block;
+        MAG_STATS_UPDATE(pool->stats.num_blocks++);
+
+        mag_dyn_pool_thread_block(pool, block);
+    }
+
+    void *ptr = pool->free;
+    uptr *next = pool->free;
+    pool->free = (void *)*next;
+    memset(ptr, 0, pool->object_size);
+    MAG_STATS_UPDATE(mag_alloc_stats_alloc(&pool->stats, pool->object_size, 0));
+
+    return ptr;
+}
+
+#define MAG_CONCURRENT_POOL_NIL UINT32_MAX
+
+static inline MagConcurrentPool
+mag_concurrent_pool_create(size object_size, u32 max_objects)
+{
+    Assert(object_size >= sizeof(u32) && object_size % sizeof(u32) == 0); /* Free objects hold the next index. */
+    Assert(max_objects > 0 && max_objects < MAG_CONCURRENT_POOL_NIL);
+
+    MagConcurrentPool pool = { .object_size = object_size, .max_objects = max_objects };
+    pool.buf = mag_sys_memory_reserve(object_size * max_objects);
+    atomic_init(&pool.head, MAG_CONCURRENT_POOL_NIL);
+    atomic_init(&pool.num_touched, 0);
+    atomic_init(&pool.committed, 0);
+
+    return pool;
+}
+
+static inline void
+mag_concurrent_pool_destroy(MagConcurrentPool *pool)
+{
+    mag_sys_memory_free(&pool->buf);
+    pool->max_objects = 0;
+    atomic_store(&pool->head, MAG_CONCURRENT_POOL_NIL);
+    atomic_store(&pool->num_touched, 0);
+    atomic_store(&pool->committed, 0);
+}
+
+static inline void
+mag_concurrent_pool_reset(MagConcurrentPool *pool)
+{
+    /* Keep the committed memory, it gets reused from the start. */
+    atomic_store(&pool->head, MAG_CONCURRENT_POOL_NIL);
+    atomic_store(&pool->num_touched, 0);
+    MAG_STATS_UPDATE(atomic_store(&pool->stats.bytes_in_use, 0));
+}
+
+static inline _Atomic(u32) *
+mag_concurrent_pool_next(MagConcurrentPool *pool, u32 idx)
+{
+    return (_Atomic(u32) *)(pool->buf.mem + idx * pool->object_size);
+}
+
+static inline void
+mag_concurrent_pool_free(MagConcurrentPool *pool, void *ptr)
+{
+    if(!ptr) { return; }
+
+    size const offset = (byte *)ptr - pool->buf.mem;
+    Assert(offset >= 0 && offset % pool->object_size == 0);
+    u32 const idx = (u32)(offset / pool->object_size);
+    Assert(idx < atomic_load_explicit(&pool->num_touched, memory_order_relaxed));
+
+    u64 head = atomic_load_explicit(&pool->head, memory_order_relaxed);
+    u64 new_head = 0;
+    do
+    {
+        atomic_store_explicit(mag_concurrent_pool_next(pool, idx), (u32)head, memory_order_relaxed);
+        new_head = (((head >> 32) + 1) << 32) | idx;
+    } while(!atomic_compare_exchange_weak_explicit(&pool->head, &head, new_head, memory_order_release, memory_order_relaxed));
+
+    MAG_STATS_UPDATE(mag_atomic_alloc_stats_use(&pool->stats, -pool->object_size));
+}
+
+static inline void *
+mag_concurrent_pool_alloc(MagConcurrentPool *pool)
+{
+    void *ptr = mag_concurrent_pool_alloc_uninit(pool);
+    if(ptr) { memset(ptr, 0, pool->object_size); }
+    return ptr;
+}
+
+static inline void *
+mag_concurrent_pool_pop(MagConcurrentPool *pool)
+{
+    /* Pop the free list. The memory is never decommitted, so reading next from an object someone else just took is safe,
+     * the changed tag makes the swap fail. */
+    u64 head = atomic_load_explicit(&pool->head, memory_order_acquire);
+    while((u32)head != MAG_CONCURRENT_POOL_NIL)
+    {
+        u32 const idx = (u32)head;
+        u32 const next = atomic_load_explicit(mag_concurrent_pool_next(pool, idx), memory_order_relaxed);
+        u64 const new_head = (((head >> 32) + 1) << 32) | next;
+
+        if(atomic_compare_exchange_weak_explicit(&pool->head, &head, new_head, memory_order_acquire, memory_order_acquire))
+        {
+            return pool->buf.mem + idx * pool->object_size;
+        }
+    }
+
+    /* Empty, take an object that has never been used. */
+    u32 idx = atomic_load_explicit(&pool->num_touched, memory_order_relaxed);
+    do
+    {
+        if(idx >= pool->max_objects) { return NULL; }
+    } while(!atomic_compare_exchange_weak_explicit(&pool->num_touched, &idx, idx + 1, memory_order_relaxed, memory_order_relaxed));
+
+    /* Commit everything from the last committed chunk through this object, so there are never any gaps below committed. */
+    size const end = (size)(idx + 1) * pool->object_size;
+    size committed = atomic_load_explicit(&pool->committed, memory_order_acquire);
+    if(end > committed)
+    {
+        size const chunk = MAG_CONCURRENT_POOL_COMMIT_CHUNK;
+        size const start = (committed / chunk) * chunk;
+        size stop = ((end + chunk - 1) / chunk) * chunk;
+        stop = stop < pool->buf.size ? stop : pool->buf.size;
+
+        StopIf(!mag_sys_memory_commit(pool->buf.mem + start, stop - start), return NULL);
+        MAG_STATS_UPDATE(mag_atomic_alloc_stats_add(&pool->stats, &(MagAllocStats){ .num_blocks = 1 }));
+
+        while(committed < stop)
+        {
+            if(atomic_compare_exchange_weak_explicit(&pool->committed, &committed, stop, memory_order_release, memory_order_acquire))
+            {
+                break;
+            }
+        }
+    }
+
+    return pool->buf.mem + idx * pool->object_size;
+}
+
+static inline void *
+mag_concurrent_pool_alloc_uninit(MagConcurrentPool *pool)
+{
+    void *ptr = mag_concurrent_pool_pop(pool);
+
+#if MAG_STATS
+    if(ptr)
+    {
+        MagAllocStats delta = {0};
+        mag_alloc_stats_alloc(&delta, pool->object_size, 0);
+        mag_atomic_alloc_stats_add(&pool->stats, &delta);
+    }
+#endif
+
+    return ptr;
+}
+
+struct MagTlsfBlock
+{
+    MagTlsfBlock *prev_phys;    /* Only valid if the previous block is free.                       */
+    size size;                  /* Payload size, the low bits hold MAG_TLSF_BLOCK_* flags.         */
+
+    /* Only valid in free blocks, these overlap the payload. */
+    MagTlsfBlock *next_free;
+    MagTlsfBlock *prev_free;
+};
+
+struct MagTlsfControl
+{
+    u32 fl_bitmap;
+    u32 sl_bitmap[MAG_TLSF_FL_COUNT];
+    MagTlsfBlock *blocks[MAG_TLSF_FL_COUNT][MAG_TLSF_SL_COUNT];
+};
+
+#define MAG_TLSF_BLOCK_FREE ((size)1)
+#define MAG_TLSF_BLOCK_PREV_FREE ((size)2)
+#define MAG_TLSF_BLOCK_FLAGS (MAG_TLSF_ALIGN - 1)
+#define MAG_TLSF_HEADER_SIZE ((size)offsetof(MagTlsfBlock, next_free))
+#define MAG_TLSF_MIN_BLOCK_SIZE ((size)(sizeof(MagTlsfBlock) - MAG_TLSF_HEADER_SIZE))
+#define MAG_TLSF_MAX_BLOCK_SIZE (((size)1 << MAG_TLSF_FL_MAX) - MAG_TLSF_ALIGN)
+
+_Static_assert(sizeof(MagTlsfBlock) % MAG_TLSF_ALIGN == 0, "TLSF headers must keep payloads aligned");
+_Static_assert(MAG_TLSF_HEADER_SIZE % MAG_TLSF_ALIGN == 0, "TLSF headers must keep payloads aligned");
+_Static_assert(MAG_TLSF_FL_COUNT <= 32 && MAG_TLSF_SL_COUNT <= 32, "TLSF bitmaps are 32 bits");
+
+static inline size mag_tlsf_block_size(MagTlsfBlock *block) { return block->size & ~MAG_TLSF_BLOCK_FLAGS; }
+static inline b32 mag_tlsf_block_is_free(MagTlsfBlock *block) { return (block->size & MAG_TLSF_BLOCK_FREE) != 0; }
+static inline b32 mag_tlsf_block_is_prev_free(MagTlsfBlock *block) { return (block->size & MAG_TLSF_BLOCK_PREV_FREE) != 0; }
+static inline byte *mag_tlsf_block_payload(MagTlsfBlock *block) { return (byte *)block + MAG_TLSF_HEADER_SIZE; }
+static inline MagTlsfBlock *mag_tlsf_block_from_payload(void *ptr) { return (MagTlsfBlock *)((byte *)ptr - MAG_TLSF_HEADER_SIZE); }
+
+static inline void
+mag_tlsf_block_set_size(MagTlsfBlock *block, size num_bytes)
+{
+    block->size = num_bytes | (block->size & MAG_TLSF_BLOCK_FLAGS);
+}
+
+static inline MagTlsfBlock *
+mag_tlsf_block_next(MagTlsfBlock *block)
+{
+    return (MagTlsfBlock *)(mag_tlsf_block_payload(block) + mag_tlsf_block_size(block));
+}
+
+static inline MagTlsfBlock *
+mag_tlsf_block_link_next(MagTlsfBlock *block)
+{
+    MagTlsfBlock *next = mag_tlsf_block_next(block);
+    next->prev_phys = block;
+    return next;
+}
+
+static inline void
+mag_tlsf_block_mark_free(MagTlsfBlock *block)
+{
+    MagTlsfBlock *next = mag_tlsf_block_link_next(block);
+    next->size |= MAG_TLSF_BLOCK_PREV_FREE;
+    block->size |= MAG_TLSF_BLOCK_FREE;
+}
+
+static inline void
+mag_tlsf_block_mark_used(MagTlsfBlock *block)
+{
+    MagTlsfBlock *next = mag_tlsf_block_next(block);
+    next->size &= ~MAG_TLSF_BLOCK_PREV_FREE;
+    block->size &= ~MAG_TLSF_BLOCK_FREE;
+}
+
+static inline void
+mag_tlsf_mapping(size num_bytes, i32 *fl, i32 *sl)
+{
+    if(num_bytes < ((size)1 << MAG_TLSF_FL_SHIFT))
+    {
+        /* Small blocks all go in the first list, split linearly. */
+        *fl = 0;
+        *sl = (i32)(num_bytes / (((size)1 << MAG_TLSF_FL_SHIFT) / MAG_TLSF_SL_COUNT));
+    }
+    else
+    {
+        i32 const msb = 63 - __builtin_clzll((u64)num_bytes);
+        *sl = (i32)((num_bytes >> (msb - MAG_TLSF_SL_COUNT_LOG2)) ^ MAG_TLSF_SL_COUNT);
+        *fl = msb - (MAG_TLSF_FL_SHIFT - 1);
+    }
+}
+
+static inline void
+mag_tlsf_mapping_search(size num_bytes, i32 *fl, i32 *sl)
+{
+    /* Round up to the next list so any block in it is big enough. */
+    if(num_bytes >= ((size)1 << MAG_TLSF_FL_SHIFT))
+    {
+        i32 const msb = 63 - __builtin_clzll((u64)num_bytes);
+        num_bytes += ((size)1 << (msb - MAG_TLSF_SL_COUNT_LOG2)) - 1;
+    }
+
+    mag_tlsf_mapping(num_bytes, fl, sl);
+}
+
+static inline MagTlsfBlock *
+mag_tlsf_find_suitable(MagTlsfControl *control, i32 *fl, i32 *sl)
+{
+    if(*fl >= MAG_TLSF_FL_COUNT) { return NULL; }
+
+    u32 sl_map = control->sl_bitmap[*fl] & (~(u32)0 << *sl);
+    if(!sl_map)
+    {
+        u32 const fl_map = *fl + 1 < 32 ? control->fl_bitmap & (~(u32)0 << (*fl + 1)) : 0;
+        if(!fl_map) { return NULL; }
+
+        *fl = __builtin_ctz(fl_map);
+        sl_map = control->sl_bitmap[*fl];
+    }
+
+    Assert(sl_map);
+    *sl = __builtin_ctz(sl_map);
+
+    return control->blocks[*fl][*sl];
+}
+
+static inline void
+mag_tlsf_remove_free(MagTlsfControl *control, MagTlsfBlock *block)
+{
+    i32 fl = 0, sl = 0;
+    mag_tlsf_mapping(mag_tlsf_block_size(block), &fl, &sl);
+
+    MagTlsfBlock *prev = block->prev_free;
+    MagTlsfBlock *next = block->next_free;
+    if(next) { next->prev_free = prev; }
+    if(prev) { prev->next_free = next; }
+
+    if(control->blocks[fl][sl] == block)
+    {
+        control->blocks[fl][sl] = next;
+        if(!next)
+        {
+            control->sl_bitmap[fl] &= ~((u32)1 << sl);
+            if(!control->sl_bitmap[fl]) { control->fl_bitmap &= ~((u32)1 << fl); }
+        }
+    }
+}
+
+static inline void
+mag_tlsf_insert_free(MagTlsfControl *control, MagTlsfBlock *block)
+{
+    i32 fl = 0, sl = 0;
+    mag_tlsf_mapping(mag_tlsf_block_size(block), &fl, &sl);
+
+    MagTlsfBlock *head = control->blocks[fl][sl];
+    block->next_free = head;
+    block->prev_free = NULL;
+    if(head) { head->prev_free = block; }
+
+    control->blocks[fl][sl] = block;
+    control->fl_bitmap |= (u32)1 << fl;
+    control->sl_bitmap[fl] |= (u32)1 << sl;
+}
+
+static inline b32
+mag_tlsf_block_can_split(MagTlsfBlock *block, size num_bytes)
+{
+    return mag_tlsf_block_size(block) >= num_bytes + MAG_TLSF_HEADER_SIZE + MAG_TLSF_MIN_BLOCK_SIZE;
+}
+
+static inline MagTlsfBlock *
+mag_tlsf_block_split(MagTlsfBlock *block, size num_bytes)
+{
+    /* The remainder starts right after the first num_bytes of the payload and is returned marked free. */
+    MagTlsfBlock *remaining = (MagTlsfBlock *)(mag_tlsf_block_payload(block) + num_bytes);
+    size const remaining_size = mag_tlsf_block_size(block) - num_bytes - MAG_TLSF_HEADER_SIZE;
+
+    remaining->size = remaining_size;
+    mag_tlsf_block_set_size(block, num_bytes);
+    mag_tlsf_block_link_next(block);
+    mag_tlsf_block_mark_free(remaining);
+
+    return remaining;
+}
+
+static inline MagTlsfBlock *
+mag_tlsf_block_absorb(MagTlsfBlock *prev, MagTlsfBlock *block)
+{
+    mag_tlsf_block_set_size(prev, mag_tlsf_block_size(prev) + mag_tlsf_block_size(block) + MAG_TLSF_HEADER_SIZE);
+    mag_tlsf_block_link_next(prev);
+    return prev;
+}
+
+static inline MagTlsfBlock *
+mag_tlsf_merge_prev(MagTlsfControl *control, MagTlsfBlock *block)
+{
+    if(mag_tlsf_block_is_prev_free(block))
+    {
+        MagTlsfBlock *prev = block->prev_phys;
+        Assert(prev && mag_tlsf_block_is_free(prev));
+        mag_tlsf_remove_free(control, prev);
+        block = mag_tlsf_block_absorb(prev, block);
+    }
+
+    return block;
+}
+
+static inline MagTlsfBlock *
+mag_tlsf_merge_next(MagTlsfControl *control, MagTlsfBlock *block)
+{
+    MagTlsfBlock *next = mag_tlsf_block_next(block);
+    if(mag_tlsf_block_is_free(next))
+    {
+        mag_tlsf_remove_free(control, next);
+        block = mag_tlsf_block_absorb(block, next);
+    }
+
+    return block;
+}
+
+static inline void
+mag_tlsf_trim_used(MagTlsfControl *control, MagTlsfBlock *block, size num_bytes)
+{
+    /* Give back the tail of a used block, merging it with the block after it. */
+    if(mag_tlsf_block_can_split(block, num_bytes))
+    {
+        MagTlsfBlock *remaining = mag_tlsf_block_split(block, num_bytes);
+        remaining->size &= ~MAG_TLSF_BLOCK_PREV_FREE;
+        remaining = mag_tlsf_merge_next(control, remaining);
+        mag_tlsf_insert_free(control, remaining);
+    }
+}
+
+static inline size
+mag_tlsf_adjust_size(size num_bytes)
+{
+    size adjusted = (num_bytes + MAG_TLSF_ALIGN - 1) & ~(size)(MAG_TLSF_ALIGN - 1);
+    return adjusted < MAG_TLSF_MIN_BLOCK_SIZE ? MAG_TLSF_MIN_BLOCK_SIZE : adjusted;
+}
+
+static inline MagTlsf
+mag_tlsf_create(size num_bytes)
+{
+    return mag_tlsf_create_options(num_bytes, (MagMemoryOptions){0});
+}
+
+static inline MagTlsf
+mag_tlsf_create_options(size num_bytes, MagMemoryOptions options)
+{
+    size const control_size = mag_tlsf_adjust_size(sizeof(MagTlsfControl));
+    Assert(num_bytes > 0);
+
+    /* Room for the control structure, a header for the first block, and a sentinel header at the end. */
+    MagMemoryBlock buf = mag_sys_memory_allocate_options(control_size + 2 * MAG_TLSF_HEADER_SIZE + num_bytes, options);
+    if(!MAG_MEM_IS_VALID(buf)) { return (MagTlsf){0}; }
+
+    MagTlsf tlsf = { .buf = buf, .control = (MagTlsfControl *)buf.mem };
+    mag_tlsf_reset(&tlsf);
+    MAG_STATS_UPDATE(tlsf.stats.num_blocks = 1);
+
+    return tlsf;
+}
+
+static inline void
+mag_tlsf_destroy(MagTlsf *tlsf)
+{
+    mag_sys_memory_free(&tlsf->buf);
+    tlsf->control = NULL;
+}
+
+static inline void
+mag_tlsf_reset(MagTlsf *tlsf)
+{
+    MagTlsfControl *control = tlsf->control;
+    Assert(control);
+    memset(control, 0, sizeof(*control));
+
+    size const control_size = mag_tlsf_adjust_size(sizeof(MagTlsfControl));
+    size block_size = (tlsf->buf.size - control_size - 2 * MAG_TLSF_HEADER_SIZE) & ~(size)(MAG_TLSF_ALIGN - 1);
+    block_size = block_size < MAG_TLSF_MAX_BLOCK_SIZE ? block_size : MAG_TLSF_MAX_BLOCK_SIZE;
+
+    /* One big free block, followed by a zero size used block so nothing ever merges past the end. */
+    MagTlsfBlock *block = (MagTlsfBlock *)(tlsf->buf.mem + control_size);
+    block->prev_phys = NULL;
+    block->size = block_size;
+    mag_tlsf_block_mark_free(block);
+    mag_tlsf_insert_free(control, block);
+
+    MagTlsfBlock *sentinel = mag_tlsf_block_next(block);
+    sentinel->size = MAG_TLSF_BLOCK_PREV_FREE;
+
+    MAG_STATS_UPDATE(tlsf->stats.bytes_in_use = 0);
+}
+
+static inline void *
+mag_tlsf_alloc(MagTlsf *tlsf, size num_bytes, size alignment)
+{
+    void *ptr = mag_tlsf_alloc_uninit(tlsf, num_bytes, alignment);
+    if(ptr) { memset(ptr, 0, num_bytes); }
+    return ptr;
+}
+
+static inline void *
+mag_tlsf_alloc_uninit(MagTlsf *tlsf, size num_bytes, size alignment)
+{
+    Assert(num_bytes > 0 && alignment > 0 && mag_is_power_of_2(alignment));
+    MagTlsfControl *control = tlsf->control;
+
+    size const adjusted = mag_tlsf_adjust_size(num_bytes);
+
+    /* Bigger alignments need room to split a free block off the front. */
+    size const gap_min = MAG_TLSF_HEADER_SIZE + MAG_TLSF_MIN_BLOCK_SIZE;
+    size const search_size = alignment > MAG_TLSF_ALIGN ? adjusted + alignment + gap_min : adjusted;
+    StopIf(num_bytes > MAG_TLSF_MAX_BLOCK_SIZE || search_size > MAG_TLSF_MAX_BLOCK_SIZE, return NULL);
+
+    i32 fl = 0, sl = 0;
+    mag_tlsf_mapping_search(search_size, &fl, &sl);
+    MagTlsfBlock *block = mag_tlsf_find_suitable(control, &fl, &sl);
+    if(!block) { return NULL; }
+
+    Assert(mag_tlsf_block_size(block) >= search_size);
+    mag_tlsf_remove_free(control, block);
+
+    if(alignment > MAG_TLSF_ALIGN)
+    {
+        byte *payload = mag_tlsf_block_payload(block);
+        uptr aligned = mag_align_pointer((uptr)payload, alignment);
+        if(aligned != (uptr)payload && aligned - (uptr)payload < (uptr)gap_min)
+        {
+            aligned = mag_align_pointer((uptr)payload + gap_min, alignment);
+        }
+
+        /* Give the gap in front back as a free block of its own. */
+        if(aligned != (uptr)payload)
+        {
+            MagTlsfBlock *aligned_block = mag_tlsf_block_split(block, (size)(aligned - (uptr)payload) - MAG_TLSF_HEADER_SIZE);
+            aligned_block->size |= MAG_TLSF_BLOCK_PREV_FREE;
+            mag_tlsf_insert_free(control, block);
+            block = aligned_block;
+        }
+    }
+
+    if(mag_tlsf_block_can_split(block, adjusted))
+    {
+        MagTlsfBlock *remaining = mag_tlsf_block_split(block, adjusted);
+        mag_tlsf_insert_free(control, remaining);
+    }
+
+    mag_tlsf_block_mark_used(block);
+    MAG_STATS_UPDATE(mag_alloc_stats_alloc(&tlsf->stats, num_bytes, mag_tlsf_block_size(block) - num_bytes));
+
+    return mag_tlsf_block_payload(block);
+}
+
+static inline void *
+mag_tlsf_realloc(MagTlsf *tlsf, void *ptr, size num_bytes, size alignment)
+{
+    Assert(num_bytes > 0);
+    if(!ptr) { return mag_tlsf_alloc_uninit(tlsf, num_bytes, alignment); }
+    StopIf(num_bytes > MAG_TLSF_MAX_BLOCK_SIZE, return NULL);
+
+    MagTlsfControl *control = tlsf->control;
+    MagTlsfBlock *block = mag_tlsf_block_from_payload(ptr);
+    Assert(!mag_tlsf_block_is_free(block));
+
+    size const adjusted = mag_tlsf_adjust_size(num_bytes);
+    size const current = mag_tlsf_block_size(block);
+
+    if(((uptr)ptr & (alignment - 1)) == 0)
+    {
+        MagTlsfBlock *next = mag_tlsf_block_next(block);
+        size const combined = current + MAG_TLSF_HEADER_SIZE + mag_tlsf_block_size(next);
+
+        if(adjusted <= current || (mag_tlsf_block_is_free(next) && adjusted <= combined))
+        {
+            /* Shrink, or grow into the free block after this one. */
+            if(adjusted > current)
+            {
+                block = mag_tlsf_merge_next(control, block);
+                mag_tlsf_block_mark_used(block);
+            }
+
+            mag_tlsf_trim_used(control, block, adjusted);
+            MAG_STATS_UPDATE(mag_alloc_stats_realloc(&tlsf->stats, true, mag_tlsf_block_size(block) - current));
+            return ptr;
+        }
+    }
+
+    void *new = mag_tlsf_alloc_uninit(tlsf, num_bytes, alignment);
+    if(new)
+    {
+        memcpy(new, ptr, current < num_bytes ? current : num_bytes);
+        mag_tlsf_free(tlsf, ptr);
+        MAG_STATS_UPDATE(mag_alloc_stats_realloc(&tlsf->stats, false, 0));
+    }
+
+    return new;
+}
+
+static inline void
+mag_tlsf_free(MagTlsf *tlsf, void *ptr)
+{
+    if(!ptr) { return; }
+
+    MagTlsfControl *control = tlsf->control;
+    MagTlsfBlock *block = mag_tlsf_block_from_payload(ptr);
+    Assert(!mag_tlsf_block_is_free(block)); /* Double free? */
+    MAG_STATS_UPDATE(mag_alloc_stats_use(&tlsf->stats, -mag_tlsf_block_size(block)));
+
+    mag_tlsf_block_mark_free(block);
+    block = mag_tlsf_merge_prev(control, block);
+    block = mag_tlsf_merge_next(control, block);
+    mag_tlsf_insert_free(control, block);
+}
+
+static inline size
+mag_tlsf_usable_size(void *ptr)
+{
+    return ptr ? mag_tlsf_block_size(mag_tlsf_block_from_payload(ptr)) : 0;
+}
+
+struct MagSlabBlock
+{
+    MagMemoryBlock buf;
+    MagSlabBlock *next;
+};
+
+static size const mag_slab_class_sizes[MAG_SLAB_NUM_CLASSES] = 
+    { 16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048 };
+
+_Static_assert(sizeof(MagSlabBlock) <= MAG_SLAB_MAX_ALIGN, "slab header must fit before the first object");
+
+static inline i32
+mag_slab_class_index(size num_bytes, size alignment)
+{
+    Assert(num_bytes > 0 && alignment > 0 && mag_is_power_of_2(alignment));
+    StopIf(alignment > MAG_SLAB_MAX_ALIGN, return -1);
+
+    /* Every class at least this big is a multiple of the alignment, and objects start on a MAG_SLAB_MAX_ALIGN boundary. */
+    num_bytes = (num_bytes + alignment - 1) & ~(alignment - 1);
+    StopIf(num_bytes > MAG_SLAB_MAX_OBJECT_SIZE, return -1);
+
+    /* Classes are 16, 32, 48 and then 2 per power of 2: 2^n and 1.5 * 2^n. */
+    if(num_bytes <= 64) { return (i32)((num_bytes + 15) / 16) - 1; }
+
+    i32 const msb = 63 - __builtin_clzll((u64)(num_bytes - 1));
+    size const half_step = (size)1 << (msb - 1);
+    i32 const idx = 2 * (msb - 6) + 4 + (num_bytes > ((size)1 << msb) + half_step ? 1 : 0);
+
+    Assert(mag_slab_class_sizes[idx] >= num_bytes && mag_slab_class_sizes[idx] % alignment == 0);
+    return idx;
+}
+
+static inline void
+mag_slab_lock(MagSlabClass *size_class)
+{
+    while(atomic_flag_test_and_set_explicit(&size_class->lock, memory_order_acquire)) { /* spin */ }
+}
+
+static inline void
+mag_slab_unlock(MagSlabClass *size_class)
+{
+    atomic_flag_clear_explicit(&size_class->lock, memory_order_release);
+}
+
+static inline b32
+mag_slab_class_grow(MagSlabAllocator *slab, MagSlabClass *size_class)
+{
+    /* Call with the lock held. */
+    MagMemoryBlock mem = mag_sys_memory_allocate(slab->slab_size);
+    if(!MAG_MEM_IS_VALID(mem)) { return false; }
+    MAG_STATS_UPDATE(mag_atomic_alloc_stats_add(&slab->stats, &(MagAllocStats){ .num_blocks = 1 }));
+
+    MagSlabBlock *block = (void *)mem.mem;
+    block->buf = mem;
+    block->next = size_class->slabs;
+    size_class->slabs = block;
+
+    size const num_objects = (mem.size - MAG_SLAB_MAX_ALIGN) / size_class->object_size;
+    Assert(num_objects > 0);
+
+    /* Thread the new objects onto the front of the free list. */
+    byte *objects = mem.mem + MAG_SLAB_MAX_ALIGN;
+    mag_static_pool_initialize_linked_list(objects, size_class->object_size, num_objects);
+    *(uptr *)(objects + (num_objects - 1) * size_class->object_size) = (uptr)size_class->free;
+    size_class->free = objects;
+
+    return true;
+}
+
+static inline MagSlabAllocator
+mag_slab_create(size slab_size)
+{
+    slab_size = slab_size > 0 ? slab_size : MAG_SLAB_DEFAULT_SLAB_SIZE;
+    Assert(slab_size >= MAG_SLAB_MAX_ALIGN + MAG_SLAB_MAX_OBJECT_SIZE);
+
+    MagSlabAllocator slab = { .slab_size = slab_size };
+    for(i32 i = 0; i < MAG_SLAB_NUM_CLASSES; ++i)
+    {
+        slab.classes[i].object_size = mag_slab_class_sizes[i];
+        atomic_flag_clear(&slab.classes[i].lock);
+    }
+
+    return slab;
+}
+
+static inline void
+mag_slab_reset(MagSlabAllocator *slab)
+{
+    for(i32 i = 0; i < MAG_SLAB_NUM_CLASSES; ++i)
+    {
+        MagSlabClass *size_class = &slab->classes[i];
+
+        MagSlabBlock *curr = size_class->slabs;
+        while(curr)
+        {
+            MagSlabBlock *next = curr->next;
+            mag_sys_memory_free(&curr->buf);
+            curr = next;
+        }
+
+        size_class->slabs = NULL;
+        size_class->free = NULL;
+    }
+
+    MAG_STATS_UPDATE(atomic_store(&slab->stats.bytes_in_use, 0));
+}
+
+static inline void
+mag_slab_destroy(MagSlabAllocator *slab)
+{
+    mag_slab_reset(slab);
+    slab->slab_size = 0;
+}
+
+static inline void *
+mag_slab_alloc(MagSlabAllocator *slab, size num_bytes, size alignment)
+{
+    void *ptr = mag_slab_alloc_uninit(slab, num_bytes, alignment);
+    if(ptr) { memset(ptr, 0, num_bytes); }
+    return ptr;
+}
+
+static inline void *
+mag_slab_alloc_uninit(MagSlabAllocator *slab, size num_bytes, size alignment)
+{
+    i32 const idx = mag_slab_class_index(num_bytes, alignment);
+    if(idx < 0) { return NULL; }
+
+    MagSlabClass *size_class = &slab->classes[idx];
+    mag_slab_lock(size_class);
+
+    if(!size_class->free) { mag_slab_class_grow(slab, size_class); }
+
+    uptr *ptr = size_class->free;
+    if(ptr) { size_class->free = (void *)*ptr; }
+
+    mag_slab_unlock(size_class);
+
+#if MAG_STATS
+    if(ptr)
+    {
+        MagAllocStats delta = {0};
+        mag_alloc_stats_alloc(&delta, num_bytes, size_class->object_size - num_bytes);
+        mag_atomic_alloc_stats_add(&slab->stats, &delta);
+    }
+#endif
+
+    return ptr;
+}
+
+static inline void
+mag_slab_free(MagSlabAllocator *slab, void *ptr, size num_bytes, size alignment)
+{
+    if(!ptr) { return; }
+
+    i32 const idx = mag_slab_class_index(num_bytes, alignment);
+    Assert(idx >= 0);
+
+    MagSlabClass *size_class = &slab->classes[idx];
+    mag_slab_lock(size_class);
+    *(uptr *)ptr = (uptr)size_class->free;
+    size_class->free = ptr;
+    mag_slab_unlock(size_class);
+
+    MAG_STATS_UPDATE(mag_atomic_alloc_stats_use(&slab->stats, -size_class->object_size));
+}
+
+static inline MagSlabMagazine
+mag_slab_magazine_create(MagSlabAllocator *slab)
+{
+    return (MagSlabMagazine){ .slab = slab };
+}
+
+#if MAG_STATS
+static inline void
+mag_slab_magazine_add_stats(MagSlabMagazine *mag)
+{
+    mag_atomic_alloc_stats_add(&mag->slab->stats, &mag->stats);
+    mag->stats = (MagAllocStats){0};
+}
+#endif
+
+static inline void
+mag_slab_magazine_return(MagSlabMagazine *mag, i32 idx, i32 num_objects)
+{
+    /* Hand the top num_objects back to the class in one go. */
+    Assert(num_objects <= mag->counts[idx]);
+    if(num_objects == 0) { return; }
+
+    void **objects = &mag->objects[idx][mag->counts[idx] - num_objects];
+    for(i32 i = 0; i < num_objects - 1; ++i) { *(uptr *)objects[i] = (uptr)objects[i + 1]; }
+
+    MagSlabClass *size_class = &mag->slab->classes[idx];
+    mag_slab_lock(size_class);
+    *(uptr *)objects[num_objects - 1] = (uptr)size_class->free;
+    size_class->free = objects[0];
+    mag_slab_unlock(size_class);
+
+    mag->counts[idx] -= num_objects;
+    MAG_STATS_UPDATE(mag_slab_magazine_add_stats(mag));
+}
+
+static inline void
+mag_slab_magazine_flush(MagSlabMagazine *mag)
+{
+    for(i32 i = 0; i < MAG_SLAB_NUM_CLASSES; ++i) { mag_slab_magazine_return(mag, i, mag->counts[i]); }
+    MAG_STATS_UPDATE(mag_slab_magazine_add_stats(mag));
+}
+
+static inline void *
+mag_slab_magazine_alloc(MagSlabMagazine *mag, size num_bytes, size alignment)
+{
+    void *ptr = mag_slab_magazine_alloc_uninit(mag, num_bytes, alignment);
+    if(ptr) { memset(ptr, 0, num_bytes); }
+    return ptr;
+}
+
+static inline void *
+mag_slab_magazine_alloc_uninit(MagSlabMagazine *mag, size num_bytes, size alignment)
+{
+    i32 const idx = mag_slab_class_index(num_bytes, alignment);
+    if(idx < 0) { return NULL; }
+
+    if(mag->counts[idx] == 0)
+    {
+        /* Refill half the magazine so the next few frees have room too. */
+        MagSlabClass *size_class = &mag->slab->classes[idx];
+        mag_slab_lock(size_class);
+        while(mag->counts[idx] < MAG_SLAB_MAGAZINE_SIZE / 2)
+        {
+            if(!size_class->free && !mag_slab_class_grow(mag->slab, size_class)) { break; }
+
+            uptr *obj = size_class->free;
+            size_class->free = (void *)*obj;
+            mag->objects[idx][mag->counts[idx]++] = obj;
+        }
+        mag_slab_unlock(size_class);
+        MAG_STATS_UPDATE(mag_slab_magazine_add_stats(mag));
+
+        if(mag->counts[idx] == 0) { return NULL; }
+    }
+
+    MAG_STATS_UPDATE(mag_alloc_stats_alloc(&mag->stats, num_bytes, mag_slab_class_sizes[idx] - num_bytes));
+    return mag->objects[idx][--mag->counts[idx]];
+}
+
+static inline void
+mag_slab_magazine_free(MagSlabMagazine *mag, void *ptr, size num_bytes, size alignment)
+{
+    if(!ptr) { return; }
+
+    i32 const idx = mag_slab_class_index(num_bytes, alignment);
+    Assert(idx >= 0);
+
+    MAG_STATS_UPDATE(mag_alloc_stats_use(&mag->stats, -mag_slab_class_sizes[idx]));
+    if(mag->counts[idx] == MAG_SLAB_MAGAZINE_SIZE) { mag_slab_magazine_return(mag, idx, MAG_SLAB_MAGAZINE_SIZE / 2); }
+    mag->objects[idx][mag->counts[idx]++] = ptr;
+}
+
+static inline MagAllocator 
+mag_allocator_dyn_arena_create(size default_block_size)
+{
+    MagAllocator alloc = { .type = MAG_ALLOC_T_DYN_ARENA };
+    alloc.dyn_arena = mag_dyn_arena_create(default_block_size);
+    return alloc;
+}
+
+static inline MagAllocator 
+mag_allocator_static_arena_create(size buf_size, byte buffer[])
+{
+    MagAllocator alloc = { .type = MAG_ALLOC_T_STATIC_ARENA };
+    alloc.static_arena = mag_static_arena_create(buf_size, buffer);
+    return alloc;
+}
+
+static inline MagAllocator 
+mag_allocator_virtual_arena_create(size reserve_num_bytes)
+{
+    MagAllocator alloc = { .type = MAG_ALLOC_T_VIRTUAL_ARENA };
+    alloc.virtual_arena = mag_virtual_arena_create(reserve_num_bytes);
+    return alloc;
+}
+
+static inline MagAllocator 
+mag_allocator_tlsf_create(size num_bytes)
+{
+    MagAllocator alloc = { .type = MAG_ALLOC_T_TLSF };
+    alloc.tlsf = mag_tlsf_create(num_bytes);
+    return alloc;
+}
+
+static inline MagAllocator 
+mag_allocator_from_dyn_arena(MagDynArena *arena)
+{
+    MagAllocator alloc = { .type = MAG_ALLOC_T_DYN_ARENA, .dyn_arena = *arena };
+    *arena = (MagDynArena) {0};
+    return alloc;
+}
+
+static inline MagAllocator 
+mag_allocator_from_static_arena(MagStaticArena *arena)
+{
+    MagAllocator alloc = { .type = MAG_ALLOC_T_STATIC_ARENA, .static_arena = *arena };
+    *arena = (MagStaticArena) {0};
+    return alloc;
+}
+
+static inline MagAllocator 
+mag_allocator_from_virtual_arena(MagVirtualArena *arena)
+{
+    MagAllocator alloc = { .type = MAG_ALLOC_T_VIRTUAL_ARENA, .virtual_arena = *arena };
+    *arena = (MagVirtualArena) {0};
+    return alloc;
+}
+
+static inline MagAllocator 
+mag_allocator_from_tlsf(MagTlsf *tlsf)
+{
+    MagAllocator alloc = { .type = MAG_ALLOC_T_TLSF, .tlsf = *tlsf };
+    *tlsf = (MagTlsf) {0};
+    return alloc;
+}
+
+static inline void 
+mag_allocator_destroy(MagAllocator *alloc)
+{
+    switch(alloc->type)
+    {
+        case MAG_ALLOC_T_STATIC_ARENA:  mag_static_arena_destroy(&alloc->static_arena);   break;
+        case MAG_ALLOC_T_DYN_ARENA:     mag_dyn_arena_destroy(&alloc->dyn_arena);         break;
+        case MAG_ALLOC_T_VIRTUAL_ARENA: mag_virtual_arena_destroy(&alloc->virtual_arena); break;
+        case MAG_ALLOC_T_TLSF:          mag_tlsf_destroy(&alloc->tlsf);                   break;
+        default: { Panic(); }
+    }
+}
+
+#if MAG_TRACE
+static inline void
+mag_allocator_trace_internal(MagAllocator *alloc, MagTraceOp op, void const *ptr, void const *old_ptr, size num_bytes,
+        size alignment)
+{
+    /* The arenas report themselves. */
+    if(alloc->type == MAG_ALLOC_T_VIRTUAL_ARENA || alloc->type == MAG_ALLOC_T_TLSF)
+    {
+        mag_trace_record_internal(op, alloc->type, alloc, ptr, old_ptr, num_bytes, alignment);
+    }
+}
+#endif
+
+static inline void 
+mag_allocator_reset(MagAllocator *alloc)
+{
+    switch(alloc->type)
+    {
+        case MAG_ALLOC_T_STATIC_ARENA:  mag_static_arena_reset(&alloc->static_arena);           break;
+        case MAG_ALLOC_T_DYN_ARENA:     mag_dyn_arena_reset_default(&alloc->dyn_arena);         break;
+        case MAG_ALLOC_T_VIRTUAL_ARENA: mag_virtual_arena_reset_default(&alloc->virtual_arena); break;
+        case MAG_ALLOC_T_TLSF:          mag_tlsf_reset(&alloc->tlsf);                           break;
+        default: { Panic(); }
+    }
+
+    MAG_TRACE_RECORD(mag_allocator_trace_internal(alloc, MAG_TRACE_RESET, NULL, NULL, 0, 0));
+}
+
+static inline void *
+mag_allocator_alloc(MagAllocator *alloc, size num_bytes, size alignment)
+{
+    void *ptr = NULL;
+    switch(alloc->type)
+    {
+        case MAG_ALLOC_T_STATIC_ARENA:  ptr = mag_static_arena_alloc(&alloc->static_arena, num_bytes, alignment);   break;
+        case MAG_ALLOC_T_DYN_ARENA:     ptr = mag_dyn_arena_alloc(&alloc->dyn_arena, num_bytes, alignment);         break;
+        case MAG_ALLOC_T_VIRTUAL_ARENA: ptr = mag_virtual_arena_alloc(&alloc->virtual_arena, num_bytes, alignment); break;
+        case MAG_ALLOC_T_TLSF:          ptr = mag_tlsf_alloc(&alloc->tlsf, num_bytes, alignment);                   break;
+        default: { Panic(); }
+    }
+
+    MAG_TRACE_RECORD(mag_allocator_trace_internal(alloc, MAG_TRACE_ALLOC, ptr, NULL, num_bytes, alignment));
+    return ptr;
+}
+
+static inline void *
+mag_allocator_alloc_uninit(MagAllocator *alloc, size num_bytes, size alignment)
+{
+    void *ptr = NULL;
+    switch(alloc->type)
+    {
+        case MAG_ALLOC_T_STATIC_ARENA:  ptr = mag_static_arena_alloc_uninit(&alloc->static_arena, num_bytes, alignment);   break;
+        case MAG_ALLOC_T_DYN_ARENA:     ptr = mag_dyn_arena_alloc_uninit(&alloc->dyn_arena, num_bytes, alignment);         break;
+        case MAG_ALLOC_T_VIRTUAL_ARENA: ptr = mag_virtual_arena_alloc_uninit(&alloc->virtual_arena, num_bytes, alignment); break;
+        case MAG_ALLOC_T_TLSF:          ptr = mag_tlsf_alloc_uninit(&alloc->tlsf, num_bytes, alignment);                   break;
+        default: { Panic(); }
+    }
+
+    MAG_TRACE_RECORD(mag_allocator_trace_internal(alloc, MAG_TRACE_ALLOC, ptr, NULL, num_bytes, alignment));
+    return ptr;
+}
+
+static inline void *
+mag_allocator_realloc(MagAllocator *alloc, void *ptr, size num_bytes, size alignment)
+{
+    void *new = NULL;
+    switch(alloc->type)
+    {
+        case MAG_ALLOC_T_STATIC_ARENA:  new = mag_static_arena_realloc(&alloc->static_arena, ptr, num_bytes, alignment);   break;
+        case MAG_ALLOC_T_DYN_ARENA:     new = mag_dyn_arena_realloc(&alloc->dyn_arena, ptr, num_bytes, alignment);         break;
+        case MAG_ALLOC_T_VIRTUAL_ARENA: new = mag_virtual_arena_realloc(&alloc->virtual_arena, ptr, num_bytes, alignment); break;
+        case MAG_ALLOC_T_TLSF:          new = mag_tlsf_realloc(&alloc->tlsf, ptr, num_bytes, alignment);                   break;
+        default: { Panic(); }
+    }
+
+    MAG_TRACE_RECORD(mag_allocator_trace_internal(alloc, MAG_TRACE_REALLOC, new, ptr, num_bytes, alignment));
+    return new;
+}
+
+static inline void 
+mag_allocator_free(MagAllocator *alloc, void *ptr)
+{
+    switch(alloc->type)
+    {
+        case MAG_ALLOC_T_STATIC_ARENA:  mag_static_arena_free(&alloc->static_arena, ptr);   break;
+        case MAG_ALLOC_T_DYN_ARENA:     mag_dyn_arena_free(&alloc->dyn_arena, ptr);         break;
+        case MAG_ALLOC_T_VIRTUAL_ARENA: mag_virtual_arena_free(&alloc->virtual_arena, ptr); break;
+        case MAG_ALLOC_T_TLSF:          mag_tlsf_free(&alloc->tlsf, ptr);                   break;
+        default: { Panic(); }
+    }
+
+    MAG_TRACE_RECORD(mag_allocator_trace_internal(alloc, MAG_TRACE_FREE, NULL, ptr, 0, 0));
+}
+
+static inline MagArenaSavepoint
+mag_allocator_savepoint(MagAllocator *alloc)
+{
+    switch(alloc->type)
+    {
+        case MAG_ALLOC_T_STATIC_ARENA:  return mag_static_arena_savepoint(&alloc->static_arena);
+        case MAG_ALLOC_T_DYN_ARENA:     return mag_dyn_arena_savepoint(&alloc->dyn_arena);
+        case MAG_ALLOC_T_VIRTUAL_ARENA: return mag_virtual_arena_savepoint(&alloc->virtual_arena);
+        default: { Panic(); }
+    }
+
+    return (MagArenaSavepoint){0};
+}
+
+static inline void
+mag_allocator_restore(MagAllocator *alloc, MagArenaSavepoint savepoint)
+{
+    switch(alloc->type)
+    {
+        case MAG_ALLOC_T_STATIC_ARENA:  mag_static_arena_restore(&alloc->static_arena, savepoint);   break;
+        case MAG_ALLOC_T_DYN_ARENA:     mag_dyn_arena_restore(&alloc->dyn_arena, savepoint);         break;
+        case MAG_ALLOC_T_VIRTUAL_ARENA: mag_virtual_arena_restore(&alloc->virtual_arena, savepoint); break;
+        default: { Panic(); }
+    }
+}
+
+#if MAG_STATS
+static inline MagAllocStats *
+mag_allocator_stats(MagAllocator *alloc)
+{
+    switch(alloc->type)
+    {
+        case MAG_ALLOC_T_STATIC_ARENA:  return &alloc->static_arena.stats;
+        case MAG_ALLOC_T_DYN_ARENA:     return &alloc->dyn_arena.stats;
+        case MAG_ALLOC_T_VIRTUAL_ARENA: return &alloc->virtual_arena.stats;
+        case MAG_ALLOC_T_TLSF:          return &alloc->tlsf.stats;
+        default: { Panic(); }
+    }
+
+    return NULL;
+}
+#endif
+
+static inline MagScratchSet
+mag_scratch_set_create(size default_block_size)
+{
+    MagScratchSet set = {0};
+    MagMemoryOptions const populate_lazy = { .populate = MAG_MEM_POPULATE_LAZY };
+    for(size i = 0; i < ECO_ARRAY_SIZE(set.arenas); ++i)
+    {
+        set.arenas[i] = mag_dyn_arena_create_options(default_block_size, populate_lazy);
+    }
+
+    return set;
+}
+
+static inline void
+mag_scratch_set_destroy(MagScratchSet *set)
+{
+    if(mag_scratch_thread_set == set) { mag_scratch_thread_set = NULL; }
+
+    for(size i = 0; i < ECO_ARRAY_SIZE(set->arenas); ++i)
+    {
+        mag_dyn_arena_destroy(&set->arenas[i]);
+    }
+}
+
+static inline void
+mag_scratch_set_bind(MagScratchSet *set)
+{
+    mag_scratch_thread_set = set;
+}
+
+static inline MagScratchSet *
+mag_scratch_set_bound(void)
+{
+    return mag_scratch_thread_set;
+}
+
+static inline MagScratch
+mag_scratch_begin(void const *conflict)
+{
+    MagScratchSet *set = mag_scratch_thread_set;
+    PanicIf(!set);
+
+    MagDynArena *arena = conflict == &set->arenas[0] ? &set->arenas[1] : &set->arenas[0];
+    return (MagScratch){ .arena = arena, .savepoint = mag_dyn_arena_savepoint(arena) };
+}
+
+static inline void
+mag_scratch_end(MagScratch scratch)
+{
+    mag_dyn_arena_restore(scratch.arena, scratch.savepoint);
+}
+
+static inline ElkStr 
+mag_str_alloc_copy_static(ElkStr src, MagStaticArena *arena)
+{
+    ElkStr ret_val = {0};
+
+    size copy_len = src.len + 1; /* Add room for terminating zero. */
+    char *buffer = mag_static_arena_nmalloc(arena, copy_len, char);
+    StopIf(!buffer, return ret_val); /* Return NULL string if out of memory */
+
+    ret_val = elk_str_copy(copy_len, buffer, src);
+
+    return ret_val;
+}
+
+static inline ElkStr 
+mag_str_append_static(ElkStr dest, ElkStr src, MagStaticArena *arena)
+{
+    ElkStr result = {0};
+
+    if(src.len <= 0) { return result; }
+
+    size new_len = dest.len + src.len;
+    char *buf = dest.start;
+    buf = mag_static_arena_nrealloc(arena, buf, new_len + 1, char); /* +1 for null terminator. */
+
+    if(!buf) { return result; }
+
+    result.start = buf;
+    result.len = new_len;
+    char *dest_ptr = dest.start + dest.len;
+    memcpy(dest_ptr, src.start, src.len);
+    result.start[result.len] = '\0';
+
+    return result;
+}
+
+static inline ElkStr 
+mag_str_append_cstr_static(ElkStr dest, char const *src, MagStaticArena *arena)
+{
+    ElkStr result = {0};
+
+    size src_len = 0;
+    while(src[src_len]) { ++src_len; }
+
+    size new_len = dest.len + src_len;
+    char *buf = dest.start;
+    buf = mag_static_arena_nrealloc(arena, buf, new_len + 1, char); /* +1 for null terminator. */
+
+    if(!buf) { return result; }
+
+    result.start = buf;
+    result.len = new_len;
+    char *dest_ptr = dest.start + dest.len;
+    memcpy(dest_ptr, src, src_len);
+    result.start[result.len] = '\0';
+
+    return result;
+}
+
+static inline ElkStr 
+mag_str_alloc_copy_dyn(ElkStr src, MagDynArena *arena)
+{
+    ElkStr ret_val = {0};
+
+    size copy_len = src.len + 1; /* Add room for terminating zero. */
+    char *buffer = mag_dyn_arena_nmalloc(arena, copy_len, char);
+    StopIf(!buffer, return ret_val); /* Return NULL string if out of memory */
+
+    ret_val = elk_str_copy(copy_len, buffer, src);
+
+    return ret_val;
+}
+
+static inline ElkStr 
+mag_str_append_dyn(ElkStr dest, ElkStr src, MagDynArena *arena)
+{
+    ElkStr result = {0};
+
+    if(src.len <= 0) { return result; }
+
+    size new_len = dest.len + src.len;
+    char *buf = dest.start;
+    buf = mag_dyn_arena_nrealloc(arena, buf, new_len + 1, char); /* +1 for null terminator */
+
+    if(!buf)
+    { 
+        /* Failed to grow in place. */
+        buf = mag_dyn_arena_nmalloc(arena, new_len, char);
+        if(buf)
+        {
+            char *dest_ptr = buf;
+            memcpy(dest_ptr, dest.start, dest.len);
+            dest_ptr = dest_ptr + dest.len;
+            memcpy(dest_ptr, src.start, src.len);
+
+            result.start = buf;
+            result.len = new_len;
+        }
+
+        /* else leave result as empty - a null string. */
+    }
+    else
+    {
+        /* Grew in place! */
+        result.start = buf;
+        result.len = new_len;
+        char *dest_ptr = dest.start + dest.len;
+        memcpy(dest_ptr, src.start, src.len);
+    }
+    result.start[result.len] = '\0';
+
+    return result;
+}
+
+static inline ElkStr 
+mag_str_append_cstr_dyn(ElkStr dest, char const *src, MagDynArena *arena)
+{
+    ElkStr result = {0};
+
+    size src_len = 0;
+    while(src[src_len]) { ++src_len; }
+
+    size new_len = dest.len + src_len;
+    char *buf = dest.start;
+    buf = mag_dyn_arena_nrealloc(arena, buf, new_len + 1, char); /* +1 for null terminator. */
+
+    if(!buf)
+    { 
+        /* Failed to grow in place. */
+        buf = mag_dyn_arena_nmalloc(arena, new_len + 1, char);
+        if(buf)
+        {
+            char *dest_ptr = buf;
+            memcpy(dest_ptr, dest.start, dest.len);
+            dest_ptr = dest_ptr + dest.len;
+            memcpy(dest_ptr, src, src_len);
+
+            result.start = buf;
+            result.len = new_len;
+        }
+    }
+    else
+    {
+        /* Grew in place! */
+        result.start = buf;
+        result.len = new_len;
+        char *dest_ptr = dest.start + dest.len;
+        memcpy(dest_ptr, src, src_len);
+    }
+    result.start[result.len] = '\0';
+
+    return result;
+}
+
+static inline ElkStr 
+mag_str_alloc_copy_alloc(ElkStr src, MagAllocator *alloc)
+{
+    ElkStr ret_val = {0};
+
+    size copy_len = src.len + 1; /* Add room for terminating zero. */
+    char *buffer = mag_allocator_nmalloc(alloc, copy_len, char);
+    StopIf(!buffer, return ret_val); /* Return NULL string if out of memory. */
+
+    ret_val = elk_str_copy(copy_len, buffer, src);
+
+    return ret_val;
+}
+
+static inline ElkStr 
+mag_str_append_alloc(ElkStr dest, ElkStr src, MagAllocator *alloc)
+{
+    ElkStr result = {0};
+
+    if(src.len <= 0) { return result; }
+
+    size new_len = dest.len + src.len;
+    char *buf = dest.start;
+    buf = mag_allocator_nrealloc(alloc, buf, new_len + 1, char); /* +1 for null terminator */
+
+    if(!buf)
+    { 
+        /* Failed to grow in place. */
+        buf = mag_allocator_nmalloc(alloc, new_len, char);
+        if(buf)
+        {
+            char *dest_ptr = buf;
+            memcpy(dest_ptr, dest.start, dest.len);
+            dest_ptr = dest_ptr + dest.len;
+            memcpy(dest_ptr, src.start, src.len);
+
+            result.start = buf;
+            result.len = new_len;
+        }
+
+        /* else leave result as empty - a null string. */
+    }
+    else
+    {
+        /* Grew in place! */
+        result.start = buf;
+        result.len = new_len;
+        char *dest_ptr = dest.start + dest.len;
+        memcpy(dest_ptr, src.start, src.len);
+    }
+    result.start[result.len] = '\0';
+
+    return result;
+}
+
+static inline ElkStr 
+mag_str_append_cstr_alloc(ElkStr dest, char const *src, MagAllocator *alloc)
+{
+    ElkStr result = {0};
+
+    size src_len = 0;
+    while(src[src_len]) { ++src_len; }
+
+    size new_len = dest.len + src_len;
+    char *buf = dest.start;
+    buf = mag_allocator_nrealloc(alloc, buf, new_len + 1, char); /* +1 for null terminator. */
+
+    if(!buf)
+    { 
+        /* Failed to grow in place. */
+        buf = mag_allocator_nmalloc(alloc, new_len + 1, char);
+        if(buf)
+        {
+            char *dest_ptr = buf;
+            memcpy(dest_ptr, dest.start, dest.len);
+            dest_ptr = dest_ptr + dest.len;
+            memcpy(dest_ptr, src, src_len);
+
+            result.start = buf;
+            result.len = new_len;
+        }
+    }
+    else
+    {
+        /* Grew in place! */
+        result.start = buf;
+        result.len = new_len;
+        char *dest_ptr = dest.start + dest.len;
+        memcpy(dest_ptr, src, src_len);
+    }
+    result.start[result.len] = '\0';
+
+    return result;
+}
+
+static inline MagStrBuilder
+mag_str_builder_create_static(MagStaticArena *arena, size capacity)
+{
+    MagStrBuilder builder = { .type = MAG_STR_BUILDER_T_STATIC_ARENA, .alloc = arena };
+    if(capacity > 0) { mag_str_builder_reserve(&builder, capacity); }
+    return builder;
+}
+
+static inline MagStrBuilder
+mag_str_builder_create_dyn(MagDynArena *arena, size capacity)
+{
+    MagStrBuilder builder = { .type = MAG_STR_BUILDER_T_DYN_ARENA, .alloc = arena };
+    if(capacity > 0) { mag_str_builder_reserve(&builder, capacity); }
+    return builder;
+}
+
+static inline MagStrBuilder
+mag_str_builder_create_alloc(MagAllocator *alloc, size capacity)
+{
+    MagStrBuilder builder = { .type = MAG_STR_BUILDER_T_ALLOCATOR, .alloc = alloc };
+    if(capacity > 0) { mag_str_builder_reserve(&builder, capacity); }
+    return builder;
+}
+
+static inline void
+mag_str_builder_reset(MagStrBuilder *builder)
+{
+    builder->len = 0;
+    builder->failed = false;
+}
+
+static inline b32
+mag_str_builder_reserve(MagStrBuilder *builder, size num_chars)
+{
+    if(builder->failed) { return false; }
+
+    size const needed = builder->len + num_chars;
+    if(needed <= builder->capacity) { return true; }
+
+    size capacity = builder->capacity * 2;
+    capacity = capacity > needed ? capacity : needed;
+    capacity = capacity > MAG_STR_BUILDER_MIN_CAPACITY ? capacity : MAG_STR_BUILDER_MIN_CAPACITY;
+
+    /* Try to grow in place first, the allocators copy if they can't. Static arenas give up instead. */
+    char *buf = NULL;
+    if(builder->buf)
+    {
+        switch(builder->type)
+        {
+            case MAG_STR_BUILDER_T_STATIC_ARENA: buf = mag_static_arena_nrealloc(builder->alloc, builder->buf, capacity + 1, char); break;
+            case MAG_STR_BUILDER_T_DYN_ARENA:    buf = mag_dyn_arena_nrealloc(builder->alloc, builder->buf, capacity + 1, char);    break;
+            case MAG_STR_BUILDER_T_ALLOCATOR:    buf = mag_allocator_nrealloc(builder->alloc, builder->buf, capacity + 1, char);    break;
+        }
+    }
+
+    if(!buf)
+    {
+        switch(builder->type)
+        {
+            case MAG_STR_BUILDER_T_STATIC_ARENA: buf = mag_static_arena_nmalloc_uninit(builder->alloc, capacity + 1, char); break;
+            case MAG_STR_BUILDER_T_DYN_ARENA:    buf = mag_dyn_arena_nmalloc_uninit(builder->alloc, capacity + 1, char);    break;
+            case MAG_STR_BUILDER_T_ALLOCATOR:    buf = mag_allocator_nmalloc_uninit(builder->alloc, capacity + 1, char);    break;
+        }
+
+        if(buf && builder->len > 0) { memcpy(buf, builder->buf, builder->len); }
+    }
+
+    if(!buf)
+    {
+        builder->failed = true;
+        return false;
+    }
+
+    builder->buf = buf;
+    builder->capacity = capacity;
+
+    return true;
+}
+
+static inline b32
+mag_str_builder_is_last_allocation_internal(MagStrBuilder *builder)
+{
+    switch(builder->type)
+    {
+        case MAG_STR_BUILDER_T_STATIC_ARENA: return ((MagStaticArena *)builder->alloc)->prev_ptr == builder->buf;
+        case MAG_STR_BUILDER_T_DYN_ARENA:    return ((MagDynArena *)builder->alloc)->prev_ptr == builder->buf;
+        case MAG_STR_BUILDER_T_ALLOCATOR:
+        {
+            MagAllocator *alloc = builder->alloc;
+            switch(alloc->type)
+            {
+                case MAG_ALLOC_T_STATIC_ARENA:  return alloc->static_arena.prev_ptr == builder->buf;
+                case MAG_ALLOC_T_DYN_ARENA:     return alloc->dyn_arena.prev_ptr == builder->buf;
+                case MAG_ALLOC_T_VIRTUAL_ARENA: return alloc->virtual_arena.prev_ptr == builder->buf;
+                case MAG_ALLOC_T_TLSF:          return true; /* Always shrinks in place. */
+            }
+        }
+    }
+
+    return false;
+}
+
+static inline ElkStr
+mag_str_builder_finish(MagStrBuilder *builder)
+{
+    ElkStr result = {0};
+
+    /* Even an empty string needs a buffer for the terminator. */
+    if(!builder->buf) { mag_str_builder_reserve(builder, 1); }
+
+    if(!builder->failed)
+    {
+        /* Give back the unused capacity, but only where shrinking can't move the string. */
+        if(builder->capacity > builder->len && mag_str_builder_is_last_allocation_internal(builder))
+        {
+            char *buf = NULL;
+            switch(builder->type)
+            {
+                case MAG_STR_BUILDER_T_STATIC_ARENA: buf = mag_static_arena_nrealloc(builder->alloc, builder->buf, builder->len + 1, char); break;
+                case MAG_STR_BUILDER_T_DYN_ARENA:    buf = mag_dyn_arena_nrealloc(builder->alloc, builder->buf, builder->len + 1, char);    break;
+                case MAG_STR_BUILDER_T_ALLOCATOR:    buf = mag_allocator_nrealloc(builder->alloc, builder->buf, builder->len + 1, char);    break;
+            }
+            Assert(buf == builder->buf);
+        }
+
+        builder->buf[builder->len] = '\0';
+        result = (ElkStr){ .start = builder->buf, .len = builder->len };
+    }
+
+    /* The string belongs to the caller now, start over with a fresh buffer next time. */
+    *builder = (MagStrBuilder){ .type = builder->type, .alloc = builder->alloc };
+
+    return result;
+}
+
+static inline void
+mag_str_builder_append_bytes_internal(MagStrBuilder *builder, char const *src, size len)
+{
+    if(len <= 0 || !mag_str_builder_reserve(builder, len)) { return; }
+
+    memcpy(builder->buf + builder->len, src, len);
+    builder->len += len;
+}
+
+static inline void
+mag_str_builder_append(MagStrBuilder *builder, ElkStr src)
+{
+    mag_str_builder_append_bytes_internal(builder, src.start, src.len);
+}
+
+static inline void
+mag_str_builder_append_cstr(MagStrBuilder *builder, char const *src)
+{
+    size src_len = 0;
+    while(src[src_len]) { ++src_len; }
+
+    mag_str_builder_append_bytes_internal(builder, src, src_len);
+}
+
+static inline void
+mag_str_builder_append_char(MagStrBuilder *builder, char c)
+{
+    if(!mag_str_builder_reserve(builder, 1)) { return; }
+    builder->buf[builder->len++] = c;
+}
+
+static inline void
+mag_str_builder_append_digits_internal(MagStrBuilder *builder, u64 value, i32 min_digits)
+{
+    /* Fill a buffer from the back, a u64 has at most 20 digits. */
+    char digits[24];
+    i32 num_digits = 0;
+    do
+    {
+        digits[sizeof(digits) - 1 - num_digits++] = (char)('0' + value % 10);
+        value /= 10;
+    } while(value || num_digits < min_digits);
+
+    mag_str_builder_append_bytes_internal(builder, &digits[sizeof(digits) - num_digits], num_digits);
+}
+
+static inline void
+mag_str_builder_append_u64(MagStrBuilder *builder, u64 value)
+{
+    mag_str_builder_append_digits_internal(builder, value, 1);
+}
+
+static inline void
+mag_str_builder_append_i64(MagStrBuilder *builder, i64 value)
+{
+    u64 magnitude = (u64)value;
+    if(value < 0)
+    {
+        mag_str_builder_append_char(builder, '-');
+        magnitude = (u64)0 - magnitude; /* Works for INT64_MIN too. */
+    }
+
+    mag_str_builder_append_digits_internal(builder, magnitude, 1);
+}
+
+static inline void
+mag_str_builder_append_f64(MagStrBuilder *builder, f64 value, i32 decimal_places)
+{
+    Assert(decimal_places >= 0 && decimal_places <= MAG_STR_BUILDER_MAX_DECIMAL_PLACES);
+
+    if(value != value) { mag_str_builder_append_cstr(builder, "nan"); return; }
+    if(value < 0.0)
+    {
+        mag_str_builder_append_char(builder, '-');
+        value = -value;
+    }
+    if(value - value != 0.0) { mag_str_builder_append_cstr(builder, "inf"); return; }
+
+    u64 scale = 1;
+    for(i32 i = 0; i < decimal_places; ++i) { scale *= 10; }
+
+    /* Keep value * scale well inside the range of a u64 by switching to scientific notation for big values. */
+    i32 exponent = 0;
+    if(value >= 1.0e18 / (f64)scale)
+    {
+        while(value >= 10.0) { value /= 10.0; ++exponent; }
+    }
+
+    u64 rounded = (u64)(value * (f64)scale + 0.5);
+    if(exponent && rounded >= 10 * scale)
+    {
+        /* Rounded up to 10.00..., e.g. 9.999e+20 to 2 places. */
+        rounded /= 10;
+        ++exponent;
+    }
+
+    mag_str_builder_append_digits_internal(builder, rounded / scale, 1);
+    if(decimal_places > 0)
+    {
+        mag_str_builder_append_char(builder, '.');
+        mag_str_builder_append_digits_internal(builder, rounded % scale, decimal_places);
+    }
+
+    if(exponent)
+    {
+        mag_str_builder_append_cstr(builder, "e+");
+        mag_str_builder_append_digits_internal(builder, (u64)exponent, 2);
+    }
+}
+
+static inline void
+mag_str_builder_append_date(MagStrBuilder *builder, ElkDate date)
+{
+    ElkStructDate sdate = elk_make_struct_date(date);
+
+    mag_str_builder_append_digits_internal(builder, (u64)sdate.year, 4);
+    mag_str_builder_append_char(builder, '-');
+    mag_str_builder_append_digits_internal(builder, (u64)sdate.month, 2);
+    mag_str_builder_append_char(builder, '-');
+    mag_str_builder_append_digits_internal(builder, (u64)sdate.day, 2);
+}
+
+static inline void
+mag_str_builder_append_time(MagStrBuilder *builder, ElkTime time)
+{
+    ElkStructTime stime = elk_make_struct_time(time);
+
+    mag_str_builder_append_digits_internal(builder, (u64)stime.year, 4);
+    mag_str_builder_append_char(builder, '-');
+    mag_str_builder_append_digits_internal(builder, (u64)stime.month, 2);
+    mag_str_builder_append_char(builder, '-');
+    mag_str_builder_append_digits_internal(builder, (u64)stime.day, 2);
+    mag_str_builder_append_char(builder, ' ');
+    mag_str_builder_append_digits_internal(builder, (u64)stime.hour, 2);
+    mag_str_builder_append_char(builder, ':');
+    mag_str_builder_append_digits_internal(builder, (u64)stime.minute, 2);
+    mag_str_builder_append_char(builder, ':');
+    mag_str_builder_append_digits_internal(builder, (u64)stime.second, 2);
+}
+
+static inline size
+mag_cacheline_round_up(size num_bytes)
+{
+    Assert(num_bytes > 0 && num_bytes <= PTRDIFF_MAX - MAG_CACHE_LINE_SIZE);
+    return (size)mag_align_pointer((uptr)num_bytes, MAG_CACHE_LINE_SIZE);
+}
+
+static inline size
+mag_slot_array_stride_internal(size slot_size)
+{
+    Assert(slot_size > 0 && slot_size <= PTRDIFF_MAX - MAG_FALSE_SHARING_SIZE);
+    return (size)mag_align_pointer((uptr)slot_size, MAG_FALSE_SHARING_SIZE);
+}
+
+static inline size
+mag_slot_array_num_bytes(size num_slots, size slot_size)
+{
+    size const stride = mag_slot_array_stride_internal(slot_size);
+    Assert(num_slots > 0 && num_slots <= PTRDIFF_MAX / stride);
+    return num_slots * stride;
+}
+
+static inline MagSlotArray
+mag_slot_array_wrap(size num_slots, size slot_size, void *mem)
+{
+    Assert(((uptr)mem % MAG_CACHE_LINE_SIZE) == 0);
+    return (MagSlotArray){ .mem = mem, .num_slots = num_slots, .stride = mag_slot_array_stride_internal(slot_size) };
+}
+
+static inline void *
+mag_slot_array_get(MagSlotArray const *slots, size index)
+{
+    Assert(slots->mem && index >= 0 && index < slots->num_slots);
+    return slots->mem + index * slots->stride;
+}
+
+static inline size
+mag_arrays_offset_internal(size count, size index, MagArraySpec const arrays[])
+{
+    /* Where array number index starts, or the total size with index == number of arrays. */
+    size offset = 0;
+    for(size i = 0; i < index; ++i)
+    {
+        Assert(arrays[i].element_size > 0 && count <= (PTRDIFF_MAX - offset - MAG_ARRAYS_ALIGN) / arrays[i].element_size);
+        offset += (size)mag_align_pointer((uptr)(count * arrays[i].element_size), MAG_ARRAYS_ALIGN);
+    }
+
+    return offset;
+}
+
+static inline void
+mag_arrays_place_internal(byte *base, size count, size num_arrays, MagArraySpec const arrays[])
+{
+    for(size i = 0; i < num_arrays; ++i) { *arrays[i].ptr = base + mag_arrays_offset_internal(count, i, arrays); }
+}
+
+static inline void
+mag_arrays_move_internal(byte *base, size old_count, size new_count, size num_arrays, MagArraySpec const arrays[])
+{
+    /* Growing pushes every array further back, so start with the last one. Shrinking pulls them forward, so start with the
+     * first one. Either way nothing gets overwritten before it is moved. The first array never moves. */
+    size const keep = old_count < new_count ? old_count : new_count;
+    for(size n = 1; n < num_arrays; ++n)
+    {
+        size const i = new_count > old_count ? num_arrays - n : n;
+        byte *src = base + mag_arrays_offset_internal(old_count, i, arrays);
+        byte *dest = base + mag_arrays_offset_internal(new_count, i, arrays);
+        memmove(dest, src, keep * arrays[i].element_size);
+    }
+
+    for(size i = 0; i < num_arrays && new_count > old_count; ++i)
+    {
+        byte *array = base + mag_arrays_offset_internal(new_count, i, arrays);
+        memset(array + old_count * arrays[i].element_size, 0, (new_count - old_count) * arrays[i].element_size);
+    }
+}
+
+static inline b32
+mag_arrays_alloc_static(MagStaticArena *arena, size count, size num_arrays, MagArraySpec const arrays[])
+{
+    Assert(count > 0 && num_arrays > 0);
+
+    byte *base = mag_static_arena_alloc(arena, mag_arrays_offset_internal(count, num_arrays, arrays), MAG_ARRAYS_ALIGN);
+    StopIf(!base, return false);
+
+    mag_arrays_place_internal(base, count, num_arrays, arrays);
+    return true;
+}
+
+static inline b32
+mag_arrays_alloc_dyn(MagDynArena *arena, size count, size num_arrays, MagArraySpec const arrays[])
+{
+    Assert(count > 0 && num_arrays > 0);
+
+    byte *base = mag_dyn_arena_alloc(arena, mag_arrays_offset_internal(count, num_arrays, arrays), MAG_ARRAYS_ALIGN);
+    StopIf(!base, return false);
+
+    mag_arrays_place_internal(base, count, num_arrays, arrays);
+    return true;
+}
+
+static inline b32
+mag_arrays_alloc_virtual(MagVirtualArena *arena, size count, size num_arrays, MagArraySpec const arrays[])
+{
+    Assert(count > 0 && num_arrays > 0);
+
+    size const num_bytes = mag_arrays_offset_internal(count, num_arrays, arrays);
+    byte *base = mag_virtual_arena_alloc(arena, num_bytes, MAG_ARRAYS_ALIGN);
+    StopIf(!base, return false);
+
+    mag_arrays_place_internal(base, count, num_arrays, arrays);
+    return true;
+}
+
+static inline b32
+mag_arrays_alloc_tlsf(MagTlsf *tlsf, size count, size num_arrays, MagArraySpec const arrays[])
+{
+    Assert(count > 0 && num_arrays > 0);
+
+    size const num_bytes = mag_arrays_offset_internal(count, num_arrays, arrays);
+    byte *base = mag_tlsf_alloc(tlsf, num_bytes, MAG_ARRAYS_ALIGN);
+    StopIf(!base, return false);
+
+    mag_arrays_place_internal(base, count, num_arrays, arrays);
+    return true;
+}
+
+static inline b32
+mag_arrays_alloc_concurrent(MagConcurrentArena *arena, size count, size num_arrays, MagArraySpec const arrays[])
+{
+    Assert(count > 0 && num_arrays > 0);
+
+    size const num_bytes = mag_arrays_offset_internal(count, num_arrays, arrays);
+    byte *base = mag_concurrent_arena_alloc(arena, num_bytes, MAG_ARRAYS_ALIGN);
+    StopIf(!base, return false);
+
+    mag_arrays_place_internal(base, count, num_arrays, arrays);
+    return true;
+}
+
+static inline b32
+mag_arrays_alloc_alloc(MagAllocator *alloc, size count, size num_arrays, MagArraySpec const arrays[])
+{
+    Assert(count > 0 && num_arrays > 0);
+
+    byte *base = mag_allocator_alloc(alloc, mag_arrays_offset_internal(count, num_arrays, arrays), MAG_ARRAYS_ALIGN);
+    StopIf(!base, return false);
+
+    mag_arrays_place_internal(base, count, num_arrays, arrays);
+    return true;
+}
+
+static inline byte *
+mag_arrays_realloc_begin_internal(size old_count, size new_count, size num_arrays, MagArraySpec const arrays[])
+{
+    Assert(old_count > 0 && new_count > 0 && num_arrays > 0);
+
+    /* Shrinking moves the arrays before the realloc, it could give the tail away (TLSF) before they're moved out of it. */
+    byte *base = *arrays[0].ptr;
+    if(new_count < old_count) { mag_arrays_move_internal(base, old_count, new_count, num_arrays, arrays); }
+
+    return base;
+}
+
+static inline b32
+mag_arrays_realloc_end_internal(byte *new_base, byte *base, size old_count, size new_count, size num_arrays,
+        MagArraySpec const arrays[])
+{
+    /* If shrinking fails the arrays are already in place. */
+    StopIf(!new_base && new_count > old_count, return false);
+    if(!new_base) { new_base = base; }
+
+    if(new_count > old_count) { mag_arrays_move_internal(new_base, old_count, new_count, num_arrays, arrays); }
+    mag_arrays_place_internal(new_base, new_count, num_arrays, arrays);
+
+    return true;
+}
+
+static inline b32
+mag_arrays_realloc_static(MagStaticArena *arena, size old_count, size new_count, size num_arrays, MagArraySpec const arrays[])
+{
+    byte *base = mag_arrays_realloc_begin_internal(old_count, new_count, num_arrays, arrays);
+    size const num_bytes = mag_arrays_offset_internal(new_count, num_arrays, arrays);
+    byte *new_base = mag_static_arena_realloc(arena, base, num_bytes, MAG_ARRAYS_ALIGN);
+    return mag_arrays_realloc_end_internal(new_base, base, old_count, new_count, num_arrays, arrays);
+}
+
+static inline b32
+mag_arrays_realloc_dyn(MagDynArena *arena, size old_count, size new_count, size num_arrays, MagArraySpec const arrays[])
+{
+    byte *base = mag_arrays_realloc_begin_internal(old_count, new_count, num_arrays, arrays);
+    size const num_bytes = mag_arrays_offset_internal(new_count, num_arrays, arrays);
+    byte *new_base = mag_dyn_arena_realloc(arena, base, num_bytes, MAG_ARRAYS_ALIGN);
+    return mag_arrays_realloc_end_internal(new_base, base, old_count, new_count, num_arrays, arrays);
+}
+
+static inline b32
+mag_arrays_realloc_virtual(MagVirtualArena *arena, size old_count, size new_count, size num_arrays, MagArraySpec const arrays[])
+{
+    byte *base = mag_arrays_realloc_begin_internal(old_count, new_count, num_arrays, arrays);
+    size const num_bytes = mag_arrays_offset_internal(new_count, num_arrays, arrays);
+    byte *new_base = mag_virtual_arena_realloc(arena, base, num_bytes, MAG_ARRAYS_ALIGN);
+    return mag_arrays_realloc_end_internal(new_base, base, old_count, new_count, num_arrays, arrays);
+}
+
+static inline b32
+mag_arrays_realloc_tlsf(MagTlsf *tlsf, size old_count, size new_count, size num_arrays, MagArraySpec const arrays[])
+{
+    byte *base = mag_arrays_realloc_begin_internal(old_count, new_count, num_arrays, arrays);
+    size const num_bytes = mag_arrays_offset_internal(new_count, num_arrays, arrays);
+    byte *new_base = mag_tlsf_realloc(tlsf, base, num_bytes, MAG_ARRAYS_ALIGN);
+    return mag_arrays_realloc_end_internal(new_base, base, old_count, new_count, num_arrays, arrays);
+}
+
+static inline b32
+mag_arrays_realloc_alloc(MagAllocator *alloc, size old_count, size new_count, size num_arrays, MagArraySpec const arrays[])
+{
+    byte *base = mag_arrays_realloc_begin_internal(old_count, new_count, num_arrays, arrays);
+    size const num_bytes = mag_arrays_offset_internal(new_count, num_arrays, arrays);
+    byte *new_base = mag_allocator_realloc(alloc, base, num_bytes, MAG_ARRAYS_ALIGN);
+    return mag_arrays_realloc_end_internal(new_base, base, old_count, new_count, num_arrays, arrays);
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+
+#pragma warning(disable: 4142)
+#ifndef _MAGPIE_WIN32_H_
+#define _MAGPIE_WIN32_H_
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                 Windows Implementation
+ *-------------------------------------------------------------------------------------------------------------------------*/
+#include <windows.h>
+
+_Static_assert(UINT32_MAX < INTPTR_MAX, "DWORD cannot be cast to intptr_t safely.");
+
+static inline i32
+mag_sys_memory_numa_num_nodes(void)
+{
+    ULONG highest = 0;
+    StopIf(!GetNumaHighestNodeNumber(&highest), return 1);
+    return (i32)highest + 1;
+}
+
+static inline i32
+mag_sys_memory_numa_current_node(void)
+{
+    PROCESSOR_NUMBER processor = {0};
+    GetCurrentProcessorNumberEx(&processor);
+
+    USHORT node = 0;
+    StopIf(!GetNumaProcessorNodeEx(&processor, &node) || node == MAXUSHORT, return 0);
+    return (i32)node;
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_allocate(size minimum_num_bytes)
+{
+    return mag_sys_memory_allocate_options(minimum_num_bytes, (MagMemoryOptions){ .populate = MAG_MEM_POPULATE_LAZY });
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_allocate_options(size minimum_num_bytes, MagMemoryOptions options)
+{
+    Assert(minimum_num_bytes > 0);
+    StopIf(minimum_num_bytes <= 0, goto ERR_RETURN);
+
+    SYSTEM_INFO info = {0};
+    GetSystemInfo(&info);
+    uptr page_size = info.dwPageSize;
+    uptr alloc_gran = info.dwAllocationGranularity;
+
+    uptr target_granularity = (uptr)minimum_num_bytes > alloc_gran ? alloc_gran : page_size;
+
+    uptr allocation_size = minimum_num_bytes + target_granularity - (minimum_num_bytes % target_granularity);
+
+    Assert(allocation_size <= INTPTR_MAX);
+    StopIf(allocation_size > INTPTR_MAX, goto ERR_RETURN);
+
+    size a_size = (size)allocation_size;
+
+    /* There is only one large page size, and it needs the SeLockMemoryPrivilege. Without it this fails and we fall back. 
+     * Large pages are always committed and locked in memory, so populating doesn't matter for them. */
+    void *mem = NULL;
+    uptr large_page_size = GetLargePageMinimum();
+    if(options.pages != MAG_MEM_PAGES_DEFAULT && large_page_size > 0)
+    {
+        uptr large_size = ((minimum_num_bytes + large_page_size - 1) / large_page_size) * large_page_size;
+        if(large_size <= INTPTR_MAX)
+        {
+            mem = VirtualAlloc(NULL, large_size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if(mem)
+            {
+                return (MagMemoryBlock)
+                    {.mem = mem, .size = (size)large_size, .page_size = (size)large_page_size, .flags = 0x01u | 0x02u };
+            }
+        }
+    }
+
+    /* There is no interleaving policy for VirtualAlloc, so that gets the default. If the preferred node can't be used it
+     * falls back to the default too. */
+    if(options.numa == MAG_MEM_NUMA_LOCAL || options.numa == MAG_MEM_NUMA_NODE)
+    {
+        DWORD node = options.numa == MAG_MEM_NUMA_LOCAL ? mag_sys_memory_numa_current_node() : options.numa_node;
+        mem = VirtualAllocExNuma(GetCurrentProcess(), NULL, allocation_size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, node);
+    }
+
+    if(!mem) { mem = VirtualAlloc(NULL, allocation_size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE); }
+    Assert(mem);
+    StopIf(!mem, goto ERR_RETURN);
+
+    /* Committed pages aren't backed until they are touched, so touch them all now. Background populating is lazy. */
+    if(options.populate == MAG_MEM_POPULATE_NOW)
+    {
+        for(size offset = 0; offset < a_size; offset += page_size) { ((byte volatile *)mem)[offset] = 0; }
+    }
+
+    return (MagMemoryBlock){.mem = mem, .size = a_size, .page_size = (size)page_size, .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock) { 0 };
+}
+
+static inline size
+mag_sys_memory_page_size(void)
+{
+    SYSTEM_INFO info = {0};
+    GetSystemInfo(&info);
+    return (size)info.dwPageSize;
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_reserve(size minimum_num_bytes)
+{
+    Assert(minimum_num_bytes > 0);
+    StopIf(minimum_num_bytes <= 0, goto ERR_RETURN);
+
+    SYSTEM_INFO info = {0};
+    GetSystemInfo(&info);
+    uptr alloc_gran = info.dwAllocationGranularity;
+
+    uptr allocation_size = ((minimum_num_bytes + alloc_gran - 1) / alloc_gran) * alloc_gran;
+    StopIf(allocation_size > INTPTR_MAX, goto ERR_RETURN);
+
+    void *mem = VirtualAlloc(NULL, allocation_size, MEM_RESERVE, PAGE_NOACCESS);
+    StopIf(!mem, goto ERR_RETURN);
+
+    return (MagMemoryBlock){.mem = mem, .size = (size)allocation_size, .page_size = (size)info.dwPageSize, .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock) { 0 };
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_allocate_mirrored(size minimum_num_bytes)
+{
+    Assert(minimum_num_bytes > 0);
+    StopIf(minimum_num_bytes <= 0, goto ERR_RETURN);
+
+    SYSTEM_INFO info = {0};
+    GetSystemInfo(&info);
+    uptr alloc_gran = info.dwAllocationGranularity;
+
+    /* Views have to start on the allocation granularity, so both halves are a multiple of it. */
+    uptr allocation_size = ((minimum_num_bytes + alloc_gran - 1) / alloc_gran) * alloc_gran;
+    StopIf(allocation_size > INTPTR_MAX / 2, goto ERR_RETURN);
+
+    HANDLE mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)((u64)allocation_size >> 32),
+            (DWORD)(allocation_size & 0xFFFFFFFF), NULL);
+    StopIf(!mapping, goto ERR_RETURN);
+
+    /* Find a hole big enough for both views, then map them into it. Another thread could take the hole between the
+     * VirtualFree and the second MapViewOfFileEx, so try a few times. */
+    byte *mem = NULL;
+    for(i32 tries = 0; tries < 10 && !mem; ++tries)
+    {
+        byte *hole = VirtualAlloc(NULL, 2 * allocation_size, MEM_RESERVE, PAGE_NOACCESS);
+        if(!hole) { break; }
+        VirtualFree(hole, 0, MEM_RELEASE);
+
+        void *first = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, allocation_size, hole);
+        void *second = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, allocation_size, hole + allocation_size);
+        if(first && second) { mem = hole; }
+        else
+        {
+            if(first) { UnmapViewOfFile(first); }
+            if(second) { UnmapViewOfFile(second); }
+        }
+    }
+
+    /* The views keep the mapping alive. */
+    CloseHandle(mapping);
+    StopIf(!mem, goto ERR_RETURN);
+
+    return (MagMemoryBlock){.mem = mem, .size = (size)allocation_size, .page_size = (size)info.dwPageSize, .flags = 0x01u | 0x02u | 0x04u };
+
+ERR_RETURN:
+    return (MagMemoryBlock) { 0 };
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_map_file(char const *path, size minimum_num_bytes)
+{
+    Assert(path && minimum_num_bytes >= 0);
+
+    SYSTEM_INFO info = {0};
+    GetSystemInfo(&info);
+    u64 page_size = info.dwPageSize;
+
+    HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, OPEN_ALWAYS,
+            FILE_ATTRIBUTE_NORMAL, NULL);
+    StopIf(file == INVALID_HANDLE_VALUE, goto ERR_RETURN);
+
+    LARGE_INTEGER file_size = {0};
+    StopIf(!GetFileSizeEx(file, &file_size), goto CLOSE_FILE);
+
+    /* A mapping bigger than the file grows the file, never cut anything off. */
+    u64 nbytes = (u64)file_size.QuadPart;
+    if(nbytes < (u64)minimum_num_bytes) { nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size; }
+    StopIf(nbytes == 0 || nbytes > INTPTR_MAX, goto CLOSE_FILE);
+
+    HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READWRITE, (DWORD)(nbytes >> 32), (DWORD)(nbytes & 0xFFFFFFFF),
+            NULL);
+    StopIf(!mapping, goto CLOSE_FILE);
+
+    /* The view keeps the mapping and the file open. */
+    void *mem = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, nbytes);
+    CloseHandle(mapping);
+    CloseHandle(file);
+    StopIf(!mem, goto ERR_RETURN);
+
+    return (MagMemoryBlock){.mem = mem, .size = (size)nbytes, .page_size = (size)page_size, .flags = 0x01u | 0x02u | 0x08u };
+
+CLOSE_FILE:
+    CloseHandle(file);
+ERR_RETURN:
+    return (MagMemoryBlock) { 0 };
+}
+
+static inline b32
+mag_sys_memory_flush(MagMemoryBlock *mem)
+{
+    /* Without the file handle there is no FlushFileBuffers, so this only hands the pages to the OS. */
+    StopIf(!MAG_MEM_IS_FILE_MAPPED(*mem), return true);
+    return FlushViewOfFile(mem->mem, 0) != 0;
+}
+
+static inline b32
+mag_sys_memory_commit(void *start, size num_bytes)
+{
+    return VirtualAlloc(start, num_bytes, MEM_COMMIT, PAGE_READWRITE) != NULL;
+}
+
+static inline void
+mag_sys_memory_decommit(void *start, size num_bytes)
+{
+    /*BOOL success =*/ VirtualFree(start, num_bytes, MEM_DECOMMIT);
+}
+
+static inline void
+mag_sys_memory_purge(void *start, size num_bytes)
+{
+    /* MEM_RESET keeps the pages committed but stops them from being paged out, unlocking pages that aren't locked takes
+     * them out of the working set. Decommit and commit would do it too, but large pages can't be decommitted. */
+    VirtualAlloc(start, num_bytes, MEM_RESET, PAGE_READWRITE);
+    VirtualUnlock(start, num_bytes);
+}
+
+static inline void
+mag_sys_memory_free(MagMemoryBlock *mem)
+{
+    if(MAG_MEM_IS_VALID_AND_OWNED(*mem))
+    {
+        /* Copy them out in case the MagMemoryBlock is stored in memory it allocated! It happens. */
+        byte *smem = mem->mem;
+        size sz = mem->size;
+        b32 mirrored = MAG_MEM_IS_MIRRORED(*mem);
+        b32 file_mapped = MAG_MEM_IS_FILE_MAPPED(*mem);
+        memset(mem, 0, sizeof(*mem));
+
+        if(mirrored)
+        {
+            UnmapViewOfFile(smem);
+            UnmapViewOfFile(smem + sz);
+        }
+        else if(file_mapped)
+        {
+            UnmapViewOfFile(smem);
+        }
+        else
+        {
+            /*BOOL success =*/ VirtualFree(smem, 0, MEM_RELEASE);
+        }
+    }
+
+    return;
+}
+
+#endif
+
+#pragma warning(default: 4142)
+
+#elif defined(__linux__)
+
+#ifndef _MAGPIE_LINUX_H_
+#define _MAGPIE_LINUX_H_
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                  Linux Implementation
+ *---------------------------------------------------------------------------------------------------------------------------
+ * Linux specific implementation goes here - things NOT in common with Apple / BSD
+ */
+#include <fcntl.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+/* The reason for a seperate Linux and Apple impelementation is on Linux I can use the MAP_POPULATE flag, but I cannot on 
+ * Apple. This flag pre-faults all the pages, so you don't have to worry about page faults slowing down the program.
+ */
+
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23 /* Linux 5.14, older kernels return EINVAL and the memory just stays lazy. */
+#endif
+
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
+#ifndef MPOL_INTERLEAVE
+#define MPOL_INTERLEAVE 3
+#endif
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+
+typedef struct
+{
+    pthread_t thread;
+    byte *mem;
+    size size;
+    size chunk;
+    _Atomic(b32) cancel;
+} MagLinuxPopulateWorker;
+
+static inline void *
+mag_sys_memory_populate_worker(void *arg)
+{
+    MagLinuxPopulateWorker *worker = arg;
+
+    /* Go in chunks so mag_sys_memory_free doesn't have to wait long to cancel it. */
+    size const chunk = worker->chunk;
+    for(size offset = 0; offset < worker->size; offset += chunk)
+    {
+        if(atomic_load_explicit(&worker->cancel, memory_order_relaxed)) { break; }
+
+        size const len = worker->size - offset < chunk ? worker->size - offset : chunk;
+        if(madvise(worker->mem + offset, len, MADV_POPULATE_WRITE) != 0) { break; }
+    }
+
+    return NULL;
+}
+
+static inline i32
+mag_sys_memory_numa_num_nodes(void)
+{
+    /* A list of ranges like "0-1" or "0,2-3", the last number is the highest node. */
+    char buf[256] = {0};
+    int fd = open("/sys/devices/system/node/online", O_RDONLY | O_CLOEXEC);
+    StopIf(fd == -1, return 1);
+    ssize_t len = read(fd, buf, sizeof(buf) - 1);
+    close(fd);
+    StopIf(len <= 0, return 1);
+
+    i32 highest = 0;
+    i32 value = 0;
+    for(ssize_t i = 0; i < len; ++i)
+    {
+        if(buf[i] >= '0' && buf[i] <= '9') { value = 10 * value + (buf[i] - '0'); }
+        else { highest = value > highest ? value : highest; value = 0; }
+    }
+    highest = value > highest ? value : highest;
+
+    return highest + 1;
+}
+
+static inline i32
+mag_sys_memory_numa_current_node(void)
+{
+    unsigned cpu = 0;
+    unsigned node = 0;
+    StopIf(syscall(SYS_getcpu, &cpu, &node, NULL) != 0, return 0);
+    return (i32)node;
+}
+
+static inline void
+mag_sys_memory_numa_bind(MagMemoryBlock *mem, MagMemoryOptions options)
+{
+    /* Called before any pages are faulted in, after that it would only apply to pages touched later. */
+    u64 node_mask = 0;
+    int mode = MPOL_PREFERRED;
+    switch(options.numa)
+    {
+        case MAG_MEM_NUMA_LOCAL:
+        {
+            i32 const node = mag_sys_memory_numa_current_node();
+            StopIf(node < 0 || node >= 64, return);
+            node_mask = UINT64_C(1) << node;
+        } break;
+
+        case MAG_MEM_NUMA_NODE:
+        {
+            StopIf(options.numa_node < 0 || options.numa_node >= 64, return);
+            node_mask = UINT64_C(1) << options.numa_node;
+        } break;
+
+        case MAG_MEM_NUMA_INTERLEAVE:
+        {
+            i32 const num_nodes = mag_sys_memory_numa_num_nodes();
+            node_mask = num_nodes >= 64 ? UINT64_MAX : (UINT64_C(1) << num_nodes) - 1;
+            mode = MPOL_INTERLEAVE;
+        } break;
+
+        default: return;
+    }
+
+    /* No libnuma, so straight to the syscall. If it fails (no NUMA in the kernel, or a node that doesn't exist) the memory
+     * is still good, it just goes wherever the default policy puts it. The kernel wants one more than the mask's bits. */
+    /* long result = */ syscall(SYS_mbind, mem->mem, mem->size, mode, &node_mask, 8 * sizeof(node_mask) + 1, 0);
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_allocate(size minimum_num_bytes)
+{
+    return mag_sys_memory_allocate_options(minimum_num_bytes, (MagMemoryOptions){ .populate = MAG_MEM_POPULATE_NOW });
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_map_huge(size minimum_num_bytes, size page_size, int page_flag, int map_flags)
+{
+    usize nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+
+    /* Fails right away if the reserved pool doesn't have enough pages of this size left. */
+    void *ptr = mmap(NULL, nbytes, PROT_READ | PROT_WRITE, map_flags | MAP_HUGETLB | page_flag, -1, 0);
+    StopIf(ptr == MAP_FAILED, goto ERR_RETURN);
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_map_transparent_huge(size minimum_num_bytes, size page_size, b32 populate_now)
+{
+    size const huge_size = ECO_MiB(2);
+    usize nbytes = ((minimum_num_bytes + huge_size - 1) / huge_size) * huge_size;
+
+    /* The kernel can only use a huge page for an aligned 2 MiB range, so map extra and trim it to alignment. It also has 
+     * to know before the pages are faulted in, so no MAP_POPULATE here. */
+    byte *ptr = mmap(NULL, nbytes + huge_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    StopIf(ptr == MAP_FAILED, goto ERR_RETURN);
+
+    byte *aligned = (byte *)mag_align_pointer((uptr)ptr, huge_size);
+    size const head = aligned - ptr;
+    size const tail = huge_size - head;
+    if(head > 0) { munmap(ptr, head); }
+    if(tail > 0) { munmap(aligned + nbytes, tail); }
+
+    /* If transparent huge pages are turned off this fails, but the memory is still fine with regular pages. */
+    b32 huge = madvise(aligned, nbytes, MADV_HUGEPAGE) == 0;
+
+    if(populate_now && madvise(aligned, nbytes, MADV_POPULATE_WRITE) != 0)
+    {
+        for(usize offset = 0; offset < nbytes; offset += page_size) { ((byte volatile *)aligned)[offset] = 0; }
+    }
+
+    return (MagMemoryBlock){ .mem = aligned, .size = nbytes, .page_size = huge ? huge_size : page_size, .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_allocate_options(size minimum_num_bytes, MagMemoryOptions options)
+{
+    Assert(minimum_num_bytes > 0);
+
+    long page_size = sysconf(_SC_PAGESIZE);
+    StopIf(page_size == -1, goto ERR_RETURN);
+
+    b32 const populate_now = options.populate == MAG_MEM_POPULATE_DEFAULT || options.populate == MAG_MEM_POPULATE_NOW;
+    b32 const numa = options.numa != MAG_MEM_NUMA_DEFAULT;
+    int map_flags = MAP_PRIVATE | MAP_ANON;
+
+    /* The NUMA policy has to be in place before the pages are faulted in, so populate after binding. */
+    if(populate_now && !numa) { map_flags |= MAP_POPULATE; }
+
+    /* Try the requested pages, then fall back one size at a time. */
+    MagMemoryBlock mem = { 0 };
+    if(options.pages == MAG_MEM_PAGES_HUGE_1GiB)
+    {
+        mem = mag_sys_memory_map_huge(minimum_num_bytes, ECO_GiB(1), MAP_HUGE_1GB, map_flags);
+    }
+
+    if(!MAG_MEM_IS_VALID(mem) && (options.pages == MAG_MEM_PAGES_HUGE_1GiB || options.pages == MAG_MEM_PAGES_HUGE_2MiB))
+    {
+        mem = mag_sys_memory_map_huge(minimum_num_bytes, ECO_MiB(2), MAP_HUGE_2MB, map_flags);
+    }
+
+    if(!MAG_MEM_IS_VALID(mem) && options.pages != MAG_MEM_PAGES_DEFAULT)
+    {
+        mem = mag_sys_memory_map_transparent_huge(minimum_num_bytes, page_size, populate_now && !numa);
+    }
+
+    if(!MAG_MEM_IS_VALID(mem))
+    {
+        usize nbytes = minimum_num_bytes + page_size - (minimum_num_bytes % page_size);
+
+        void *ptr = mmap(NULL,                                    /* the starting address, NULL = don't care                */
+                         nbytes,                                  /* the amount of memory to allocate                       */
+                         PROT_READ | PROT_WRITE,                  /* we should have read and write access to the memory     */
+                         map_flags,                               /* not backed by a file, this is pure memory              */
+                         -1,                                      /* recommended file descriptor for portability            */
+                         0);                                      /* offset into what? this isn't a file, so should be zero */
+
+        StopIf(ptr == MAP_FAILED, goto ERR_RETURN);
+
+        mem = (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u };
+    }
+
+    if(numa)
+    {
+        mag_sys_memory_numa_bind(&mem, options);
+
+        if(populate_now && madvise(mem.mem, mem.size, MADV_POPULATE_WRITE) != 0)
+        {
+            for(size offset = 0; offset < mem.size; offset += mem.page_size) { ((byte volatile *)mem.mem)[offset] = 0; }
+        }
+    }
+
+    if(options.populate == MAG_MEM_POPULATE_BACKGROUND)
+    {
+        /* If the helper can't be started, the memory is still good, it's just lazy. */
+        MagLinuxPopulateWorker *worker = mmap(NULL, sizeof(*worker), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+        if(worker != MAP_FAILED)
+        {
+            worker->mem = mem.mem;
+            worker->size = mem.size;
+            worker->chunk = mem.page_size > ECO_MiB(2) ? mem.page_size : ECO_MiB(2);
+            atomic_init(&worker->cancel, false);
+
+            if(pthread_create(&worker->thread, NULL, mag_sys_memory_populate_worker, worker) == 0)
+            {
+                mem.populate_worker = worker;
+            }
+            else
+            {
+                munmap(worker, sizeof(*worker));
+            }
+        }
+    }
+
+    return mem;
+
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline size
+mag_sys_memory_page_size(void)
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? (size)page_size : ECO_KiB(4);
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_reserve(size minimum_num_bytes)
+{
+    Assert(minimum_num_bytes > 0);
+
+    size page_size = mag_sys_memory_page_size();
+    usize nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+
+    /* No access and no swap reserved, this is only address space until pages are committed. */
+    void *ptr = mmap(NULL, nbytes, PROT_NONE, MAP_PRIVATE | MAP_ANON | MAP_NORESERVE, -1, 0);
+    StopIf(ptr == MAP_FAILED, goto ERR_RETURN);
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_allocate_mirrored(size minimum_num_bytes)
+{
+    Assert(minimum_num_bytes > 0);
+
+    size page_size = mag_sys_memory_page_size();
+    usize nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+
+    /* An anonymous file holds the pages, so they can be mapped more than once. */
+    int fd = memfd_create("magpie_mirrored", MFD_CLOEXEC);
+    StopIf(fd == -1, goto ERR_RETURN);
+    StopIf(ftruncate(fd, nbytes) != 0, goto CLOSE_FILE);
+
+    /* Reserve room for both copies so nothing else can land between them, then map the file over each half. */
+    byte *ptr = mmap(NULL, 2 * nbytes, PROT_NONE, MAP_PRIVATE | MAP_ANON | MAP_NORESERVE, -1, 0);
+    StopIf(ptr == MAP_FAILED, goto CLOSE_FILE);
+
+    void *first = mmap(ptr, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void *second = mmap(ptr + nbytes, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    StopIf(first == MAP_FAILED || second == MAP_FAILED, goto UNMAP);
+
+    /* The mappings keep the file alive. */
+    close(fd);
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u | 0x04u };
+
+UNMAP:
+    munmap(ptr, 2 * nbytes);
+CLOSE_FILE:
+    close(fd);
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_map_file(char const *path, size minimum_num_bytes)
+{
+    Assert(path && minimum_num_bytes >= 0);
+
+    size page_size = mag_sys_memory_page_size();
+
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    StopIf(fd == -1, goto ERR_RETURN);
+
+    struct stat info = {0};
+    StopIf(fstat(fd, &info) != 0, goto CLOSE_FILE);
+
+    /* Grow it if it is too small (sparse, so no disk is used until pages are written), never cut anything off. */
+    size nbytes = info.st_size;
+    if(nbytes < minimum_num_bytes)
+    {
+        nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+        StopIf(ftruncate(fd, nbytes) != 0, goto CLOSE_FILE);
+    }
+    StopIf(nbytes == 0, goto CLOSE_FILE);
+
+    void *ptr = mmap(NULL, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    StopIf(ptr == MAP_FAILED, goto CLOSE_FILE);
+
+    /* The mapping keeps the file open. */
+    close(fd);
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u | 0x08u };
+
+CLOSE_FILE:
+    close(fd);
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline b32
+mag_sys_memory_flush(MagMemoryBlock *mem)
+{
+    StopIf(!MAG_MEM_IS_FILE_MAPPED(*mem), return true);
+    return msync(mem->mem, mem->size, MS_SYNC) == 0;
+}
+
+static inline b32
+mag_sys_memory_commit(void *start, size num_bytes)
+{
+    return mprotect(start, num_bytes, PROT_READ | PROT_WRITE) == 0;
+}
+
+static inline void
+mag_sys_memory_decommit(void *start, size num_bytes)
+{
+    /* Drop the pages so the memory goes back to the OS, and they'll be zero if they are ever committed again. */
+    madvise(start, num_bytes, MADV_DONTNEED);
+    mprotect(start, num_bytes, PROT_NONE);
+}
+
+static inline void
+mag_sys_memory_purge(void *start, size num_bytes)
+{
+    /* Not MADV_FREE, it only hands the pages over once the system is low on memory, so RSS wouldn't go down until then. */
+    madvise(start, num_bytes, MADV_DONTNEED);
+}
+
+static inline void
+mag_sys_memory_free(MagMemoryBlock *mem)
+{
+    if(MAG_MEM_IS_VALID_AND_OWNED(*mem))
+    {
+        /* Copy them out in case the MagMemoryBlock is stored in memory it allocated! It happens. */
+        void *smem = mem->mem;
+        size_t sz = MAG_MEM_IS_MIRRORED(*mem) ? 2 * mem->size : mem->size;
+        MagLinuxPopulateWorker *worker = mem->populate_worker;
+        memset(mem, 0, sizeof(*mem));
+
+        /* The helper thread must be done with the memory before it goes away. */
+        if(worker)
+        {
+            atomic_store(&worker->cancel, true);
+            pthread_join(worker->thread, NULL);
+            munmap(worker, sizeof(*worker));
+        }
+
+        /* int success = */ munmap(smem, sz);
+    }
+
+    return;
+}
+
+#endif
+
+
+#elif defined(__APPLE__)
+
+#ifndef _MAGPIE_APPLE_OSX_H_
+#define _MAGPIE_APPLE_OSX_H_
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                               Apple/MacOSX Implementation
+ *---------------------------------------------------------------------------------------------------------------------------
+ * Apple / BSD specific implementation goes here - things NOT in common with Linux
+ */
+#include <fcntl.h>
+#include <mach/vm_statistics.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* The reason for a seperate Linux and Apple impelementation is on Linux I can use the MAP_POPULATE flag, but I cannot on 
+ * Apple. This flag pre-faults all the pages, so you don't have to worry about page faults slowing down the program. Apple
+ * gives far LESS control over allocation.
+ */
+
+static inline MagMemoryBlock 
+mag_sys_memory_allocate(size minimum_num_bytes)
+{
+    return mag_sys_memory_allocate_options(minimum_num_bytes, (MagMemoryOptions){ .populate = MAG_MEM_POPULATE_LAZY });
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_allocate_options(size minimum_num_bytes, MagMemoryOptions options)
+{
+    Assert(minimum_num_bytes > 0);
+
+    long page_size = sysconf(_SC_PAGESIZE);
+    StopIf(page_size == -1, goto ERR_RETURN);
+    usize nbytes = minimum_num_bytes + page_size - (minimum_num_bytes % page_size);
+
+    void *ptr = MAP_FAILED;
+
+#ifdef VM_FLAGS_SUPERPAGE_SIZE_2MB
+    /* Any huge page request gets 2 MiB superpages, which are only supported on Intel. Otherwise fall back to regular pages. */
+    if(options.pages != MAG_MEM_PAGES_DEFAULT)
+    {
+        usize huge_nbytes = ((minimum_num_bytes + ECO_MiB(2) - 1) / ECO_MiB(2)) * ECO_MiB(2);
+        ptr = mmap(NULL, huge_nbytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, VM_FLAGS_SUPERPAGE_SIZE_2MB, 0);
+        if(ptr != MAP_FAILED)
+        {
+            nbytes = huge_nbytes;
+            page_size = ECO_MiB(2);
+        }
+    }
+#endif
+
+    if(ptr == MAP_FAILED)
+    {
+        ptr = mmap(NULL,                     /* the starting address, NULL = don't care                */
+                   nbytes,                   /* the amount of memory to allocate                       */
+                   PROT_READ | PROT_WRITE,   /* we should have read and write access to the memory     */
+                   MAP_PRIVATE | MAP_ANON,   /* not backed by a file, this is pure memory              */
+                   -1,                       /* recommended file descriptor for portability            */
+                   0);                       /* offset into what? this isn't a file, so should be zero */
+    }
+
+    StopIf(ptr == MAP_FAILED, goto ERR_RETURN);
+
+    /* No MAP_POPULATE, so touch every page. There is no safe way to do this in the background, so that is lazy. */
+    if(options.populate == MAG_MEM_POPULATE_NOW)
+    {
+        for(usize offset = 0; offset < nbytes; offset += page_size) { ((byte volatile *)ptr)[offset] = 0; }
+    }
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline i32
+mag_sys_memory_numa_num_nodes(void)
+{
+    return 1; /* No NUMA here, MagMemoryOptions.numa is ignored. */
+}
+
+static inline i32
+mag_sys_memory_numa_current_node(void)
+{
+    return 0;
+}
+
+static inline size
+mag_sys_memory_page_size(void)
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? (size)page_size : ECO_KiB(4);
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_reserve(size minimum_num_bytes)
+{
+    Assert(minimum_num_bytes > 0);
+
+    size page_size = mag_sys_memory_page_size();
+    usize nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+
+    /* No access and no swap reserved, this is only address space until pages are committed. */
+    void *ptr = mmap(NULL, nbytes, PROT_NONE, MAP_PRIVATE | MAP_ANON | MAP_NORESERVE, -1, 0);
+    StopIf(ptr == MAP_FAILED, goto ERR_RETURN);
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_allocate_mirrored(size minimum_num_bytes)
+{
+    Assert(minimum_num_bytes > 0);
+
+    size page_size = mag_sys_memory_page_size();
+    usize nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+
+    /* There is no memfd_create, so use a temporary file that is deleted right away. */
+    char path[] = "/tmp/magpie_mirrored_XXXXXX";
+    int fd = mkstemp(path);
+    StopIf(fd == -1, goto ERR_RETURN);
+    unlink(path);
+    StopIf(ftruncate(fd, nbytes) != 0, goto CLOSE_FILE);
+
+    /* Reserve room for both copies so nothing else can land between them, then map the file over each half. */
+    byte *ptr = mmap(NULL, 2 * nbytes, PROT_NONE, MAP_PRIVATE | MAP_ANON | MAP_NORESERVE, -1, 0);
+    StopIf(ptr == MAP_FAILED, goto CLOSE_FILE);
+
+    void *first = mmap(ptr, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void *second = mmap(ptr + nbytes, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    StopIf(first == MAP_FAILED || second == MAP_FAILED, goto UNMAP);
+
+    /* The mappings keep the file alive. */
+    close(fd);
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u | 0x04u };
+
+UNMAP:
+    munmap(ptr, 2 * nbytes);
+CLOSE_FILE:
+    close(fd);
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_map_file(char const *path, size minimum_num_bytes)
+{
+    Assert(path && minimum_num_bytes >= 0);
+
+    size page_size = mag_sys_memory_page_size();
+
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    StopIf(fd == -1, goto ERR_RETURN);
+
+    struct stat info = {0};
+    StopIf(fstat(fd, &info) != 0, goto CLOSE_FILE);
+
+    /* Grow it if it is too small (sparse, so no disk is used until pages are written), never cut anything off. */
+    size nbytes = info.st_size;
+    if(nbytes < minimum_num_bytes)
+    {
+        nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+        StopIf(ftruncate(fd, nbytes) != 0, goto CLOSE_FILE);
+    }
+    StopIf(nbytes == 0, goto CLOSE_FILE);
+
+    void *ptr = mmap(NULL, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    StopIf(ptr == MAP_FAILED, goto CLOSE_FILE);
+
+    /* The mapping keeps the file open. */
+    close(fd);
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u | 0x08u };
+
+CLOSE_FILE:
+    close(fd);
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline b32
+mag_sys_memory_flush(MagMemoryBlock *mem)
+{
+    StopIf(!MAG_MEM_IS_FILE_MAPPED(*mem), return true);
+    return msync(mem->mem, mem->size, MS_SYNC) == 0;
+}
+
+static inline b32
+mag_sys_memory_commit(void *start, size num_bytes)
+{
+    return mprotect(start, num_bytes, PROT_READ | PROT_WRITE) == 0;
+}
+
+static inline void
+mag_sys_memory_decommit(void *start, size num_bytes)
+{
+    /* MADV_DONTNEED is only a hint on Apple, mapping fresh pages over the range really gives the memory back. */
+    mmap(start, num_bytes, PROT_NONE, MAP_FIXED | MAP_PRIVATE | MAP_ANON | MAP_NORESERVE, -1, 0);
+}
+
+static inline void
+mag_sys_memory_purge(void *start, size num_bytes)
+{
+    /* Same as decommit, but the new pages are usable right away. */
+    mmap(start, num_bytes, PROT_READ | PROT_WRITE, MAP_FIXED | MAP_PRIVATE | MAP_ANON, -1, 0);
+}
+
+static inline void
+mag_sys_memory_free(MagMemoryBlock *mem)
+{
+    if(MAG_MEM_IS_VALID_AND_OWNED(*mem))
+    {
+        /* Copy them out in case the MagMemoryBlock is stored in memory it allocated! It happens. */
+        void *smem = mem->mem;
+        size_t sz = MAG_MEM_IS_MIRRORED(*mem) ? 2 * mem->size : mem->size;
+        memset(mem, 0, sizeof(*mem));
+        /* int success = */ munmap(smem, sz);
+    }
+
+    return;
+}
+
+#endif
+
+
+#elif defined(__EMSCRIPTEN__)
+
+#ifndef _MAGPIE_LINUX_H_
+#define _MAGPIE_LINUX_H_
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                  Linux Implementation
+ *---------------------------------------------------------------------------------------------------------------------------
+ * emscripten specific implementation goes here
+ */
+#include <stdlib.h>
+
+static inline MagMemoryBlock 
+mag_sys_memory_allocate(size minimum_num_bytes)
+{
+    return mag_sys_memory_allocate_options(minimum_num_bytes, (MagMemoryOptions){ .populate = MAG_MEM_POPULATE_LAZY });
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_allocate_options(size minimum_num_bytes, MagMemoryOptions options)
+{
+    Assert(minimum_num_bytes > 0);
+
+    void *ptr = malloc(minimum_num_bytes);
+
+    StopIf(ptr == NULL, goto ERR_RETURN);
+
+    return (MagMemoryBlock){ .mem = ptr, .size = minimum_num_bytes, .page_size = ECO_KiB(64), .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline i32
+mag_sys_memory_numa_num_nodes(void)
+{
+    return 1; /* No NUMA here, MagMemoryOptions.numa is ignored. */
+}
+
+static inline i32
+mag_sys_memory_numa_current_node(void)
+{
+    return 0;
+}
+
+static inline size
+mag_sys_memory_page_size(void)
+{
+    return ECO_KiB(64); /* WebAssembly page size */
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_reserve(size minimum_num_bytes)
+{
+    /* No virtual memory, so we have to take it all now. */
+    return mag_sys_memory_allocate(minimum_num_bytes);
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_allocate_mirrored(size minimum_num_bytes)
+{
+    /* No virtual memory, so there is no way to map the same memory twice. */
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_map_file(char const *path, size minimum_num_bytes)
+{
+    /* No mmap of real files here. */
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline b32
+mag_sys_memory_flush(MagMemoryBlock *mem)
+{
+    return !MAG_MEM_IS_FILE_MAPPED(*mem);
+}
+
+static inline b32
+mag_sys_memory_commit(void *start, size num_bytes)
+{
+    return true;
+}
+
+static inline void
+mag_sys_memory_decommit(void *start, size num_bytes)
+{
+    /* Zero it so it behaves the same as freshly committed memory on the other platforms. */
+    memset(start, 0, num_bytes);
+}
+
+static inline void
+mag_sys_memory_purge(void *start, size num_bytes)
+{
+    /* There is no OS to give it back to. */
+}
+
+static inline void
+mag_sys_memory_free(MagMemoryBlock *mem)
+{
+    if(MAG_MEM_IS_VALID_AND_OWNED(*mem))
+    {
+        /* Copy them out in case the MagMemoryBlock is stored in memory it allocated! It happens. */
+        void *smem = mem->mem;
+        free(smem);
+    }
+
+    return;
+}
+
+#endif
+
+
+#else
+#error "Platform not supported by Magpie Library"
+#endif
+
+#if MAG_TRACE
+/* Everything after this point passes its call site along with the traced calls, see Allocation Tracing above. */
+#undef MAG_TRACE_CALL
+#undef MAG_TRACE_MARK_SITE
+
+#define MAG_TRACE_CALL(func, ...) func##_traced(__VA_ARGS__, __FILE__, __LINE__)
+#define MAG_TRACE_MARK_SITE(alloc) _Generic((alloc),                                                                        \
+                                       MagStaticArena *: mag_trace_mark_site_internal,                                      \
+                                       MagDynArena *:    mag_trace_mark_site_internal,                                      \
+                                       MagAllocator *:   mag_trace_mark_site_internal,                                      \
+                                       default:          mag_trace_skip_site_internal                                       \
+                                   )(__FILE__, __LINE__)
+#endif
+
+#pragma warning(pop)
+
+#endif
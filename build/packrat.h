@@ -0,0 +1,2281 @@
+#ifndef _PACKRAT_H_
+#define _PACKRAT_H_
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                     String Interner
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * size_exp - The interner is backed by a hash table with a capacity that is a power of 2. The size_exp is that power of two.
+ *     This value is only used initially, if the table needs to expand, it will, so it's OK to start with small values here.
+ *     However, if you know it will grow larger, it's better to start larger! For most reasonable use cases, it really
+ *     probably shouldn't be smaller than 5, but no checks are done for this.
+ *
+ * NOTE: A cstring is a null terminated string of unknown length.
+ *
+ * NOTE: The interner copies any successfully interned string, so once it has been interned you can reclaim the memory that 
+ * was holding it before.
+ */
+typedef struct /* Internal only */
+{
+    u64 hash;
+    ElkStr str;
+} PakStringInternerHandle;
+
+typedef struct 
+{
+    MagAllocator *storage;            /* This is where to store the strings.           */
+
+    PakStringInternerHandle *handles; /* The hash table - handles index into storage.  */
+    u32 num_handles;                  /* The number of handles.                        */
+    i8 size_exp;                      /* Used to keep track of the length of *handles. */
+} PakStringInterner;
+
+
+static inline PakStringInterner pak_string_interner_create(i8 size_exp, MagAllocator *storage);
+static inline void pak_string_interner_destroy(PakStringInterner *interner);
+static inline ElkStr pak_string_interner_intern_cstring(PakStringInterner *interner, char *string);
+static inline ElkStr pak_string_interner_intern(PakStringInterner *interner, ElkStr str);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *                                         
+ *                                                       Collections
+ *
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                         
+ *                                                   Ordered Collections
+ *
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ *  Ordered collections are things like arrays (sometimes called vectors), queues, dequeues, and heaps. I'm taking a 
+ *  different approach to how I implement them. They will be implemented in two parts.
+ *
+ *  The first part is the ledger, which just does all the bookkeeping about how full the collection is, which elements are
+ *  valid, and the order of elements. A user can use these with their own supplied buffer for storing objects. The ledger
+ *  types only track indexes.
+ *
+ *  One advantage of the ledger approach is that the user can manage their own memory, allowing them to use the most
+ *  efficient allocation strategy. 
+ *
+ *  Another advantage of this is that if you have several parallel collections (e.g. parallel arrays), you can use a single
+ *  instance of a bookkeeping type (e.g. PakQueueLedger) to track the state of all the arrays that back it. Further,
+ *  different collections in the parallel collections can have different sized objects.
+ *
+ *  Complicated memory management can be a disadvantage of the ledger approach. For instance, implementing growable
+ *  collections can require shuffling objects around in the backing buffer during the resize operation. A queue, for 
+ *  instance, is non-trivial to expand because you have to account for wrap-around (assuming it is backed by a circular
+ *  buffer). So not all the ledger types APIs will directly support resizing, and even those that do will further require 
+ *  the user to make sure that as they allocate more memory in the backing buffer, they also update the ledger. Finally, if
+ *  you want to pass the collection as a whole to a function, you'll have to pass the ledger and buffer(s) separately or
+ *  create your own composite type to package them together in.
+ *
+ *  The second part is an implementation that manages memory for the user. This gives the user less control over how memory
+ *  is allocated / freed, but it also burdens them less with the responsibility of doing so. These types can reliably be
+ *  expanded on demand. These types will internally use the ledger types.
+ *
+ *  The more full featured types that manage memory also require the use of void pointers for adding and retrieving data 
+ *  from the collections. So they are less type safe, whereas when using just the ledger types they only deal in indexes, so
+ *  you can make the backing buffer have any type you want.
+ *
+ *  Adjacent just means that the objects are stored adjacently in memory. All of the collection ledger types must be backed
+ *  by an array or a block of contiguous memory.
+ */
+
+static size const PAK_COLLECTION_EMPTY = -1;
+static size const PAK_COLLECTION_FULL = -2;
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                      Queue Ledger
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * Mind the PAK_COLLECTION_FULL and PAK_COLLECTION_EMPTY return values.
+ */
+
+typedef struct 
+{
+    size capacity;
+    size length;
+    size front;
+    size back;
+} PakQueueLedger;
+
+static inline PakQueueLedger pak_queue_ledger_create(size capacity);
+static inline b32 pak_queue_ledger_full(PakQueueLedger *queue);
+static inline b32 pak_queue_ledger_empty(PakQueueLedger *queue);
+static inline size pak_queue_ledger_push_back_index(PakQueueLedger *queue);  /* index of next location to put an object   */
+static inline size pak_queue_ledger_pop_front_index(PakQueueLedger *queue);  /* index of next location to take object     */
+static inline size pak_queue_ledger_peek_front_index(PakQueueLedger *queue); /* index of next object, but not incremented */
+static inline size pak_queue_ledger_len(PakQueueLedger const *queue);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                      Array Ledger
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * Mind the PAK_COLLECTION_FULL and PAK_COLLECTION_EMPTY return values.
+ */
+typedef struct 
+{
+    size capacity;
+    size length;
+} PakArrayLedger;
+
+static inline PakArrayLedger pak_array_ledger_create(size capacity);
+static inline b32 pak_array_ledger_full(PakArrayLedger *array);
+static inline b32 pak_array_ledger_empty(PakArrayLedger *array);
+static inline size pak_array_ledger_push_back_index(PakArrayLedger *array);
+static inline size pak_array_ledger_pop_back_index(PakArrayLedger *array);
+static inline size pak_array_ledger_len(PakArrayLedger const *array);
+static inline void pak_array_ledger_reset(PakArrayLedger *array);
+static inline void pak_array_ledger_set_capacity(PakArrayLedger *array, size capacity);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                      Stack Ledger
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * Mind the PAK_COLLECTION_FULL and PAK_COLLECTION_EMPTY return values.
+ */
+typedef struct 
+{
+    size capacity;
+    size length;
+} PakStackLedger;
+
+static inline PakStackLedger pak_stack_ledger_create(size capacity);
+static inline b32 pak_stack_ledger_full(PakStackLedger *stack);
+static inline b32 pak_stack_ledger_empty(PakStackLedger *stack);
+static inline size pak_stack_ledger_push_index(PakStackLedger *stack);
+static inline size pak_stack_ledger_pop_index(PakStackLedger *stack);
+static inline size pak_stack_ledger_len(PakStackLedger const *stack);
+static inline void pak_stack_ledger_reset(PakStackLedger *stack);
+static inline void pak_stack_ledger_set_capacity(PakStackLedger *stack, size capacity);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                         
+ *                                                  Unordered Collections
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                    Hash Map (Table)
+ *---------------------------------------------------------------------------------------------------------------------------
+ * The table size must be a power of two, so size_exp is used to calcualte the size of the table. If it needs to grow in 
+ * size, it will grow the table, so this is only a starting point.
+ *
+ * The ELkHashMap does NOT copy any objects, so it only stores pointers. The user has to manage the memory for their own
+ * objects.
+ */
+typedef struct /* Internal Only */
+{
+    u64 hash;
+    void *key;
+    void *value;
+} PakHashMapHandle;
+
+typedef struct 
+{
+    MagAllocator *alloc;
+    PakHashMapHandle *handles;
+    size num_handles;
+    ElkSimpleHash hasher;
+    ElkEqFunction eq;
+    i8 size_exp;
+} PakHashMap;
+
+typedef size PakHashMapKeyIter;
+
+static inline PakHashMap pak_hash_map_create(i8 size_exp, ElkSimpleHash key_hash, ElkEqFunction key_eq, MagAllocator *alloc);
+static inline void pak_hash_map_destroy(PakHashMap *map);
+static inline void *pak_hash_map_insert(PakHashMap *map, void *key, void *value); /* if return != value, key was already in the map  */
+static inline void *pak_hash_map_lookup(PakHashMap *map, void *key); /* return NULL if not in map, otherwise return pointer to value */
+static inline size pak_hash_map_len(PakHashMap *map);
+static inline PakHashMapKeyIter pak_hash_map_key_iter(PakHashMap *map);
+
+static inline void *pak_hash_map_key_iter_next(PakHashMap *map, PakHashMapKeyIter *iter);
+
+/*--------------------------------------------------------------------------------------------------------------------------
+ *                                            Hash Map (Table, ElkStr as keys)
+ *---------------------------------------------------------------------------------------------------------------------------
+ * Designed for use when keys are strings.
+ *
+ * Values are not copied, they are stored as pointers, so the user must manage memory.
+ *
+ * Uses fnv1a hash.
+ */
+typedef struct
+{
+    u64 hash;
+    ElkStr key;
+    void *value;
+} PakStrMapHandle;
+
+typedef struct 
+{
+    MagAllocator *alloc;
+    PakStrMapHandle *handles;
+    size num_handles;
+    i8 size_exp;
+} PakStrMap;
+
+typedef size PakStrMapKeyIter;
+typedef size PakStrMapHandleIter;
+
+static inline PakStrMap pak_str_map_create(i8 size_exp, MagAllocator *alloc);
+static inline void pak_str_map_destroy(PakStrMap *map);
+static inline void *pak_str_map_insert(PakStrMap *map, ElkStr key, void *value); /* if return != value, key was already in the map                           */
+static inline void *pak_str_map_lookup(PakStrMap *map, ElkStr key); /* return NULL if not in map, otherwise return pointer to value                          */
+static inline PakStrMapHandle const *pak_str_map_lookup_handle(PakStrMap *map, ElkStr key); /* return NULL if not in map, otherwise return pointer to handle */
+static inline size pak_str_map_len(PakStrMap *map);
+static inline PakStrMapKeyIter pak_str_map_key_iter(PakStrMap *map);
+static inline PakStrMapHandleIter pak_str_map_handle_iter(PakStrMap *map);
+
+static inline ElkStr pak_str_map_key_iter_next(PakStrMap *map, PakStrMapKeyIter *iter);
+static inline PakStrMapHandle pak_str_map_handle_iter_next(PakStrMap *map, PakStrMapHandleIter *iter);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                        Hash Set
+ *---------------------------------------------------------------------------------------------------------------------------
+ * The table size must be a power of two, so size_exp is used to calcualte the size of the table. If it needs to grow in 
+ * size, it will grow the table, so this is only a starting point.
+ *
+ * The ELkHashSet does NOT copy any objects, so it only stores pointers. The user has to manage the memory for their own
+ * objects.
+ */
+typedef struct /* Internal only */
+{
+    u64 hash;
+    void *value;
+} PakHashSetHandle;
+
+typedef struct 
+{
+    MagAllocator *alloc;
+    PakHashSetHandle *handles;
+    size num_handles;
+    ElkSimpleHash hasher;
+    ElkEqFunction eq;
+    i8 size_exp;
+} PakHashSet;
+
+typedef size PakHashSetIter;
+
+static inline PakHashSet pak_hash_set_create(i8 size_exp, ElkSimpleHash val_hash, ElkEqFunction val_eq, MagAllocator *alloc);
+static inline void pak_hash_set_destroy(PakHashSet *set);
+static inline void *pak_hash_set_insert(PakHashSet *set, void *value); /* if return != value, value was already in the set    */
+static inline void *pak_hash_set_lookup(PakHashSet *set, void *value); /* return NULL if not in set, else return ptr to value */
+static inline size pak_hash_set_len(PakHashSet *set);
+static inline PakHashSetIter pak_hash_set_value_iter(PakHashSet *set);
+
+static inline void *pak_hash_set_value_iter_next(PakHashSet *set, PakHashSetIter *iter);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                            Generic Macros for Collections
+ *---------------------------------------------------------------------------------------------------------------------------
+ * These macros take any collection and return a result.
+ */
+#define pak_len(x) _Generic((x),                                                                                            \
+        PakQueueLedger *: pak_queue_ledger_len,                                                                             \
+        PakArrayLedger *: pak_array_ledger_len,                                                                             \
+        PakReservoirLedger *: pak_reservoir_ledger_len,                                                                     \
+        PakHashMap *: pak_hash_map_len,                                                                                     \
+        PakStrMap *: pak_str_map_len,                                                                                       \
+        PakHashSet *: pak_hash_set_len)(x)
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *                                         
+ *                                                        Sorting
+ *
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                       Radix Sort 
+ *---------------------------------------------------------------------------------------------------------------------------
+ * I've only implemented radix sort for fixed size signed intengers, unsigned integers, and floating point types thus far.
+ *
+ * The sort requires extra memory that depends on the size of the list being sorted, so the user must provide that. In order
+ * to ensure proper alignment and size, the user must provide the scratch buffer. Probably using an arena with 
+ * eco_arena_nmalloc() to create a buffer and then freeing it after the sort would be the most efficient way to handle that.
+ *
+ * The API is set up for sorting an array of structures. The 'offset' argument is the offset in bytes into the structure 
+ * where the sort key can be found. The 'stride' argument is just the size of the structures so we know how to iterate the
+ * array. The sort order (ascending / descending) and sort key type (signed integer, unsigned integer, floating) are passed
+ * as arguments. The sort key type includes the size of the sort key in bits.
+ */
+
+typedef enum
+{
+    PAK_RADIX_SORT_UINT8,
+    PAK_RADIX_SORT_INT8,
+    PAK_RADIX_SORT_UINT16,
+    PAK_RADIX_SORT_INT16,
+    PAK_RADIX_SORT_UINT32,
+    PAK_RADIX_SORT_INT32,
+    PAK_RADIX_SORT_F32,
+    PAK_RADIX_SORT_UINT64,
+    PAK_RADIX_SORT_INT64,
+    PAK_RADIX_SORT_F64,
+} PakRadixSortByType;
+
+typedef enum { PAK_SORT_ASCENDING, PAK_SORT_DESCENDING } PakSortOrder;
+
+static inline void pak_radix_sort(
+        void *buffer, 
+        size num, 
+        size offset, 
+        size stride, 
+        void *scratch, 
+        PakRadixSortByType sort_type, 
+        PakSortOrder order);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *                                         
+ *                                                  Shuffling and Sampling
+ *
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                        Shuffle
+ *---------------------------------------------------------------------------------------------------------------------------
+ * A Fisher-Yates shuffle of an array of structures, using the same conventions as pak_radix_sort. The 'stride' argument is
+ * the size of the structures, and whole structures are moved. Random indexes come in pairs from a single call to the 
+ * generator (see elk_random_state_uniform_bounded_pair_u64), which about halves the cost of the random numbers.
+ *
+ * To shuffle several parallel arrays the same way, shuffle an array of indexes and use it to gather the parallel arrays.
+ */
+static inline void pak_shuffle(void *buffer, size num, size stride, ElkRandomState *state);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                 Reservoir Sampling Ledger
+ *---------------------------------------------------------------------------------------------------------------------------
+ *
+ * Sample 'capacity' items uniformly without replacement from a stream of unknown length. Like the other ledgers, this only
+ * does the bookkeeping, the user stores the samples in their own buffer (or parallel buffers). Offer every item in the stream
+ * to the ledger, if the returned index is not PAK_RESERVOIR_SKIP, store the item at that index, overwriting whatever is 
+ * there. When the stream is done, the first pak_reservoir_ledger_len() slots of the buffer hold the sample.
+ *
+ * This is the classic Algorithm R. Once the reservoir is full, each offer costs a single bounded random integer, which
+ * avoids the logarithms (and math.h) needed by the skip based algorithms.
+ */
+static size const PAK_RESERVOIR_SKIP = -3;
+
+typedef struct
+{
+    size capacity;
+    size length;            /* number of slots filled, never more than capacity. */
+    i64 num_seen;           /* number of items offered so far.                   */
+    ElkRandomState *state;  /* not owned by the ledger.                          */
+} PakReservoirLedger;
+
+static inline PakReservoirLedger pak_reservoir_ledger_create(size capacity, ElkRandomState *state);
+static inline size pak_reservoir_ledger_offer_index(PakReservoirLedger *res); /* index to store the item or PAK_RESERVOIR_SKIP */
+static inline size pak_reservoir_ledger_len(PakReservoirLedger const *res);
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *
+ *
+ *                                                 Histograms and Quantiles
+ *
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                       Histogram
+ *---------------------------------------------------------------------------------------------------------------------------
+ * A histogram with num_bins equal width bins covering [min, max). Values below min, at or above max, and NaN are counted
+ * separately, retrieve those with pak_histogram_count() and the special bins below.
+ *
+ * Bin indexes are computed with SIMD and the counts are spread over PAK_HISTOGRAM_SUBS interleaved sub-histograms so runs of
+ * values that land in the same bin don't stall waiting on the previous increment of the same counter. The sub-histograms
+ * are only added together when reading the counts.
+ *
+ * For multiple threads, give each thread its own histogram with the same min, max, and num_bins, then combine them with
+ * pak_histogram_merge(). pak_histogram_quantile() interpolates linearly within a bin, so its accuracy is limited by the
+ * bin width. Use the quantile sketch below when the range of the data isn't known ahead of time.
+ */
+#define PAK_HISTOGRAM_SUBS 4
+
+static i32 const PAK_HISTOGRAM_BELOW = -1;
+static i32 const PAK_HISTOGRAM_ABOVE = -2;
+static i32 const PAK_HISTOGRAM_NAN = -3;
+
+typedef struct
+{
+    u64 *counts;    /* PAK_HISTOGRAM_SUBS sub-histograms of num_bins + 3 slots: below, bins..., above, NaN. */
+    f64 min;
+    f64 max;
+    f64 scale;      /* num_bins / (max - min) */
+    i32 num_bins;
+} PakHistogram;
+
+static inline PakHistogram pak_histogram_create(f64 min, f64 max, i32 num_bins, MagAllocator *alloc);
+static inline void pak_histogram_add_f64(PakHistogram *hist, size n, f64 const *data);
+static inline void pak_histogram_add_f32(PakHistogram *hist, size n, f32 const *data);
+static inline void pak_histogram_merge(PakHistogram *dest, PakHistogram const *src);
+static inline u64 pak_histogram_count(PakHistogram const *hist, i32 bin); /* bin may also be one of the special bins above */
+static inline f64 pak_histogram_quantile(PakHistogram const *hist, f64 q); /* q in [0, 1], NaN values are not included */
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                    Quantile Sketch
+ *---------------------------------------------------------------------------------------------------------------------------
+ * A streaming, mergeable quantile sketch in the style of KLL, using equal capacity compactors. Values go into level 0 and 
+ * when a level fills up with k values it is sorted and every other value (starting at a random offset) is promoted to the
+ * next level with twice the weight. Memory is k values per level and there are about log2(n / k) levels, so it grows very
+ * slowly with the number of values. The rank error shrinks as k grows, with 2 million values k = 128 gave a worst case
+ * rank error of about 0.8% and k = 256 about 0.4%.
+ *
+ * Level buffers and a k value sort buffer are allocated from alloc, which must outlive the sketch. The min, max, and counts
+ * are exact. NaN values are counted and otherwise ignored. Sketches with the same k, e.g. one per thread, are combined with 
+ * pak_quantile_sketch_merge(), which leaves src untouched. Querying sorts the levels in place, so the sketch is not const.
+ */
+#define PAK_QUANTILE_SKETCH_MAX_LEVELS 48
+
+typedef struct
+{
+    MagAllocator *alloc;
+    ElkRandomState *state;                          /* not owned by the sketch.                   */
+    f64 *levels[PAK_QUANTILE_SKETCH_MAX_LEVELS];    /* each level has room for k values           */
+    i32 lens[PAK_QUANTILE_SKETCH_MAX_LEVELS];
+    f64 *sort_scratch;
+    i32 k;
+    i32 num_levels;
+    u64 count;                                      /* number of non-NaN values added             */
+    u64 nan_count;
+    f64 min;
+    f64 max;
+} PakQuantileSketch;
+
+static inline PakQuantileSketch pak_quantile_sketch_create(i32 k, ElkRandomState *state, MagAllocator *alloc);
+static inline void pak_quantile_sketch_add(PakQuantileSketch *sketch, f64 value);
+static inline void pak_quantile_sketch_merge(PakQuantileSketch *dest, PakQuantileSketch const *src);
+static inline f64 pak_quantile_sketch_quantile(PakQuantileSketch *sketch, f64 q); /* q in [0, 1] */
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *
+ *
+ *                                          Implementation of `inline` functions.
+ *
+ *
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+static inline PakStringInterner 
+pak_string_interner_create(i8 size_exp, MagAllocator *storage)
+{
+    Assert(size_exp > 0 && size_exp <= 31); /* Come on, 2^31 is HUGE */
+
+    usize const handles_len = (usize)(1 << size_exp);
+    PakStringInternerHandle *handles = eco_arena_nmalloc(storage, handles_len, PakStringInternerHandle);
+    PanicIf(!handles);
+
+    return (PakStringInterner)
+    {
+        .storage = storage,
+        .handles = handles,
+        .num_handles = 0, 
+        .size_exp = size_exp
+    };
+}
+
+static inline void
+pak_string_interner_destroy(PakStringInterner *interner)
+{
+    return;
+}
+
+static inline b32
+pak_hash_table_large_enough(usize num_handles, i8 size_exp)
+{
+    /* Shoot for no more than 75% of slots filled. */
+    return num_handles < 3 * (1 << size_exp) / 4;
+}
+
+static inline u32
+pak_hash_lookup(u64 hash, i8 exp, u32 idx)
+{
+    /* Copied from https://nullprogram.com/blog/2022/08/08
+     * All code & writing on this blog is in the public domain.
+     */
+    u32 mask = (UINT32_C(1) << exp) - 1;
+    u32 step = (u32)((hash >> (64 - exp)) | 1);    /* the | 1 forces an odd number */
+    return (idx + step) & mask;
+}
+
+static inline void
+pak_string_interner_expand_table(PakStringInterner *interner)
+{
+    i8 const size_exp = interner->size_exp;
+    i8 const new_size_exp = size_exp + 1;
+
+    usize const handles_len = (usize)(1 << size_exp);
+    usize const new_handles_len = (usize)(1 << new_size_exp);
+
+    PakStringInternerHandle *new_handles = eco_arena_nmalloc(interner->storage, new_handles_len, PakStringInternerHandle);
+    PanicIf(!new_handles);
+
+    for (u32 i = 0; i < handles_len; i++) 
+    {
+        PakStringInternerHandle *handle = &interner->handles[i];
+
+        if (handle->str.start == NULL) { continue; } /* Skip if it's empty */
+
+        /* Find the position in the new table and update it. */
+        u64 const hash = handle->hash;
+        u32 j = hash & 0xffffffff; /* truncate */
+        while (true) 
+        {
+            j = pak_hash_lookup(hash, new_size_exp, j);
+            PakStringInternerHandle *new_handle = &new_handles[j];
+
+            if (!new_handle->str.start)
+            {
+                /* empty - put it here. Don't need to check for room because we just expanded
+                 * the hash table of handles, and we're not copying anything new into storage,
+                 * it's already there!
+                 */
+                *new_handle = *handle;
+                break;
+            }
+        }
+    }
+
+    interner->handles = new_handles;
+    interner->size_exp = new_size_exp;
+
+    return;
+}
+
+static inline ElkStr
+pak_string_interner_intern_cstring(PakStringInterner *interner, char *string)
+{
+    ElkStr str = elk_str_from_cstring(string);
+    return pak_string_interner_intern(interner, str);
+}
+
+static inline ElkStr
+pak_string_interner_intern(PakStringInterner *interner, ElkStr str)
+{
+    /* Inspired by https://nullprogram.com/blog/2022/08/08
+     * All code & writing on this blog is in the public domain.
+     */
+
+    u64 const hash = elk_fnv1a_hash_str(str);
+    u32 i = hash & 0xffffffff; /* truncate */
+    while (true)
+    {
+        i = pak_hash_lookup(hash, interner->size_exp, i);
+        PakStringInternerHandle *handle = &interner->handles[i];
+
+        if (!handle->str.start)
+        {
+            /* empty, insert here if room in the table of handles. Check for room first! */
+            if (pak_hash_table_large_enough(interner->num_handles, interner->size_exp))
+            {
+                char *dest = eco_arena_nmalloc_uninit(interner->storage, str.len + 1, char);
+                PanicIf(!dest);
+                ElkStr interned_str = elk_str_copy(str.len + 1, dest, str);
+
+                *handle = (PakStringInternerHandle){.hash = hash, .str = interned_str};
+                interner->num_handles += 1;
+
+                return handle->str;
+            }
+            else 
+            {
+                /* Grow the table so we have room */
+                pak_string_interner_expand_table(interner);
+
+                /* Recurse because all the state needed by the *_lookup function was just crushed
+                 * by the expansion of the table.
+                 */
+                return pak_string_interner_intern(interner, str);
+            }
+        }
+        else if (handle->hash == hash && elk_str_eq(str, handle->str)) 
+        {
+            /* found it! */
+            return handle->str;
+        }
+    }
+}
+
+static inline PakQueueLedger
+pak_queue_ledger_create(size capacity)
+{
+    return (PakQueueLedger)
+    {
+        .capacity = capacity, 
+        .length = 0,
+        .front = 0, 
+        .back = 0
+    };
+}
+
+static inline b32 
+pak_queue_ledger_full(PakQueueLedger *queue)
+{ 
+    return queue->length == queue->capacity;
+}
+
+static inline b32
+pak_queue_ledger_empty(PakQueueLedger *queue)
+{ 
+    return queue->length == 0;
+}
+
+static inline size
+pak_queue_ledger_push_back_index(PakQueueLedger *queue)
+{
+    if(pak_queue_ledger_full(queue)) { return PAK_COLLECTION_FULL; }
+
+    size idx = queue->back % queue->capacity;
+    queue->back += 1;
+    queue->length += 1;
+    return idx;
+}
+
+static inline size
+pak_queue_ledger_pop_front_index(PakQueueLedger *queue)
+{
+    if(pak_queue_ledger_empty(queue)) { return PAK_COLLECTION_EMPTY; }
+
+    size idx = queue->front % queue->capacity;
+    queue->front += 1;
+    queue->length -= 1;
+    return idx;
+}
+
+static inline size
+pak_queue_ledger_peek_front_index(PakQueueLedger *queue)
+{
+    if(queue->length == 0) { return PAK_COLLECTION_EMPTY; }
+    return queue->front % queue->capacity;
+}
+
+static inline size
+pak_queue_ledger_len(PakQueueLedger const *queue)
+{
+    return queue->length;
+}
+
+static inline PakArrayLedger
+pak_array_ledger_create(size capacity)
+{
+    Assert(capacity > 0);
+    return (PakArrayLedger)
+    {
+        .capacity = capacity,
+        .length = 0
+    };
+}
+
+static inline b32 
+pak_array_ledger_full(PakArrayLedger *array)
+{ 
+    return array->length == array->capacity;
+}
+
+static inline b32
+pak_array_ledger_empty(PakArrayLedger *array)
+{ 
+    return array->length == 0;
+}
+
+static inline size
+pak_array_ledger_push_back_index(PakArrayLedger *array)
+{
+    if(pak_array_ledger_full(array)) { return PAK_COLLECTION_FULL; }
+
+    size idx = array->length;
+    array->length += 1;
+    return idx;
+}
+
+static inline size
+pak_array_ledger_pop_back_index(PakArrayLedger *array)
+{
+    if(pak_array_ledger_empty(array)) { return PAK_COLLECTION_EMPTY; }
+
+    return --array->length;
+}
+
+static inline size
+pak_array_ledger_len(PakArrayLedger const *array)
+{
+    return array->length;
+}
+
+static inline void
+pak_array_ledger_reset(PakArrayLedger *array)
+{
+    array->length = 0;
+}
+
+static inline void
+pak_array_ledger_set_capacity(PakArrayLedger *array, size capacity)
+{
+    Assert(capacity > 0);
+    array->capacity = capacity;
+}
+
+static inline PakStackLedger 
+pak_stack_ledger_create(size capacity)
+{
+    Assert(capacity > 0);
+    return (PakStackLedger)
+    {
+        .capacity = capacity,
+        .length = 0
+    };
+}
+
+static inline b32 
+pak_stack_ledger_full(PakStackLedger *stack)
+{
+    return stack->length == stack->capacity;
+}
+
+static inline b32 
+pak_stack_ledger_empty(PakStackLedger *stack)
+{
+    return stack->length == 0;
+}
+
+static inline size 
+pak_stack_ledger_push_index(PakStackLedger *stack)
+{
+    if(pak_stack_ledger_full(stack)) { return PAK_COLLECTION_FULL; }
+
+    size idx = stack->length;
+    stack->length += 1;
+    return idx;
+}
+
+static inline size 
+pak_stack_ledger_pop_index(PakStackLedger *stack)
+{
+    if(pak_stack_ledger_empty(stack)) { return PAK_COLLECTION_EMPTY; }
+
+    return --stack->length;
+}
+
+static inline size 
+pak_stack_ledger_len(PakStackLedger const *stack)
+{
+    return stack->length;
+}
+
+static inline void 
+pak_stack_ledger_reset(PakStackLedger *stack)
+{
+    stack->length = 0;
+}
+
+static inline void 
+pak_stack_ledger_set_capacity(PakStackLedger *stack, size capacity)
+{
+    Assert(capacity > 0);
+    stack->capacity = capacity;
+}
+
+static PakHashMap 
+pak_hash_map_create(i8 size_exp, ElkSimpleHash key_hash, ElkEqFunction key_eq, MagAllocator *alloc)
+{
+    Assert(size_exp > 0 && size_exp <= 31); /* Come on, 31 is HUGE */
+
+    size const handles_len = (size)(1 << size_exp);
+    PakHashMapHandle *handles = eco_arena_nmalloc(alloc, handles_len, PakHashMapHandle);
+    PanicIf(!handles);
+
+    return (PakHashMap)
+    {
+        .alloc = alloc,
+        .handles = handles,
+        .num_handles = 0, 
+        .hasher = key_hash,
+        .eq = key_eq,
+        .size_exp = size_exp
+    };
+}
+
+static inline void 
+pak_hash_map_destroy(PakHashMap *map)
+{
+    return;
+}
+
+static inline void
+pak_hash_table_expand(PakHashMap *map)
+{
+    i8 const size_exp = map->size_exp;
+    i8 const new_size_exp = size_exp + 1;
+
+    size const handles_len = (size)(1 << size_exp);
+    size const new_handles_len = (size)(1 << new_size_exp);
+
+    PakHashMapHandle *new_handles = eco_arena_nmalloc(map->alloc, new_handles_len, PakHashMapHandle);
+    PanicIf(!new_handles);
+
+    for (u32 i = 0; i < handles_len; i++) 
+    {
+        PakHashMapHandle *handle = &map->handles[i];
+
+        if (handle->key == NULL) { continue; } /* Skip if it's empty */
+
+        /* Find the position in the new table and update it. */
+        u64 const hash = handle->hash;
+        u32 j = hash & 0xffffffff; /* truncate */
+        while (true) 
+        {
+            j = pak_hash_lookup(hash, new_size_exp, j);
+            PakHashMapHandle *new_handle = &new_handles[j];
+
+            if (!new_handle->key)
+            {
+                /* empty - put it here. Don't need to check for room because we just expanded
+                /  the hash table of handles, and we're not copying anything new into storage,
+                 * it's already there!
+                 */
+                *new_handle = *handle;
+                break;
+            }
+        }
+    }
+
+    map->handles = new_handles;
+    map->size_exp = new_size_exp;
+
+    return;
+}
+
+static inline void *
+pak_hash_map_insert(PakHashMap *map, void *key, void *value)
+{
+    /* Inspired by https://nullprogram.com/blog/2022/08/08
+     * All code & writing on this blog is in the public domain. 
+     */
+
+    u64 const hash = map->hasher(key);
+    u32 i = hash & 0xffffffff; /* truncate */
+    while (true)
+    {
+        i = pak_hash_lookup(hash, map->size_exp, i);
+        PakHashMapHandle *handle = &map->handles[i];
+
+        if (!handle->key)
+        {
+            /* empty, insert here if room in the table of handles. Check for room first! */
+            if (pak_hash_table_large_enough(map->num_handles, map->size_exp))
+            {
+
+                *handle = (PakHashMapHandle){.hash = hash, .key=key, .value=value};
+                map->num_handles += 1;
+
+                return handle->value;
+            }
+            else 
+            {
+                /* Grow the table so we have room */
+                pak_hash_table_expand(map);
+
+                /* Recurse because all the state needed by the *_lookup function was just crushed
+                 * by the expansion of the table.
+                 */
+                return pak_hash_map_insert(map, key, value);
+            }
+        }
+        else if (handle->hash == hash && map->eq(handle->key, key)) 
+        {
+            /* found it! */
+            return handle->value;
+        }
+    }
+
+    return NULL;
+}
+
+static inline void *
+pak_hash_map_lookup(PakHashMap *map, void *key)
+{
+    /* Inspired by https://nullprogram.com/blog/2022/08/08
+     * All code & writing on this blog is in the public domain.
+     */
+
+    u64 const hash = map->hasher(key);
+    u32 i = hash & 0xffffffff; /* truncate */
+    while (true)
+    {
+        i = pak_hash_lookup(hash, map->size_exp, i);
+        PakHashMapHandle *handle = &map->handles[i];
+
+        if (!handle->key)
+        {
+            return NULL;
+            
+        }
+        else if (handle->hash == hash && map->eq(handle->key, key)) 
+        {
+            /* found it! */
+            return handle->value;
+        }
+    }
+
+    return NULL;
+}
+
+static inline size 
+pak_hash_map_len(PakHashMap *map)
+{
+    return map->num_handles;
+}
+
+static inline PakHashMapKeyIter 
+pak_hash_map_key_iter(PakHashMap *map)
+{
+    return 0;
+}
+
+static inline void *
+pak_hash_map_key_iter_next(PakHashMap *map, PakHashMapKeyIter *iter)
+{
+    size const max_iter = (size)(1 << map->size_exp);
+    void *next_key = NULL;
+    if(*iter >= max_iter) { return next_key; }
+
+    do
+    {
+        next_key = map->handles[*iter].key;
+        *iter += 1;
+
+    } while(next_key == NULL && *iter < max_iter);
+
+    return next_key;
+}
+
+static inline PakStrMap 
+pak_str_map_create(i8 size_exp, MagAllocator *alloc)
+{
+    Assert(size_exp > 0 && size_exp <= 31); /* Come on, 31 is HUGE */
+
+    size const handles_len = (size)(1 << size_exp);
+    PakStrMapHandle *handles = eco_arena_nmalloc(alloc, handles_len, PakStrMapHandle);
+    PanicIf(!handles);
+
+    return (PakStrMap)
+    {
+        .alloc = alloc,
+        .handles = handles,
+        .num_handles = 0, 
+        .size_exp = size_exp,
+    };
+}
+
+static inline void
+pak_str_map_destroy(PakStrMap *map)
+{
+    return;
+}
+
+static inline void
+pak_str_table_expand(PakStrMap *map)
+{
+    i8 const size_exp = map->size_exp;
+    i8 const new_size_exp = size_exp + 1;
+
+    size const handles_len = (size)(1 << size_exp);
+    size const new_handles_len = (size)(1 << new_size_exp);
+
+    PakStrMapHandle *new_handles = eco_arena_nmalloc(map->alloc, new_handles_len, PakStrMapHandle);
+    PanicIf(!new_handles);
+
+    for (u32 i = 0; i < handles_len; i++) 
+    {
+        PakStrMapHandle *handle = &map->handles[i];
+
+        if (handle->key.start == NULL) { continue; } /* Skip if it's empty */
+
+        /* Find the position in the new table and update it. */
+        u64 const hash = handle->hash;
+        u32 j = hash & 0xffffffff; /* truncate */
+        while (true) 
+        {
+            j = pak_hash_lookup(hash, new_size_exp, j);
+            PakStrMapHandle *new_handle = &new_handles[j];
+
+            if (!new_handle->key.start)
+            {
+                /* empty - put it here. Don't need to check for room because we just expanded
+                 * the hash table of handles, and we're not copying anything new into storage,
+                 * it's already there!
+                 */
+                *new_handle = *handle;
+                break;
+            }
+        }
+    }
+
+    map->handles = new_handles;
+    map->size_exp = new_size_exp;
+
+    return;
+}
+
+static inline void *
+pak_str_map_insert(PakStrMap *map, ElkStr key, void *value)
+{
+    /* Inspired by https://nullprogram.com/blog/2022/08/08
+     * All code & writing on this blog is in the public domain.
+     */
+
+    u64 const hash = elk_fnv1a_hash_str(key);
+    u32 i = hash & 0xffffffff; /* truncate */
+    while (true)
+    {
+        i = pak_hash_lookup(hash, map->size_exp, i);
+        PakStrMapHandle *handle = &map->handles[i];
+
+        if (!handle->key.start)
+        {
+            /* empty, insert here if room in the table of handles. Check for room first! */
+            if (pak_hash_table_large_enough(map->num_handles, map->size_exp))
+            {
+
+                *handle = (PakStrMapHandle){.hash = hash, .key=key, .value=value};
+                map->num_handles += 1;
+
+                return handle->value;
+            }
+            else 
+            {
+                /* Grow the table so we have room */
+                pak_str_table_expand(map);
+
+                /* Recurse because all the state needed by the *_lookup function was just crushed
+                 * by the expansion of the table.
+                 */
+                return pak_str_map_insert(map, key, value);
+            }
+        }
+        else if (handle->hash == hash && elk_str_eq(key, handle->key)) 
+        {
+            /* found it! Replace value */
+            void *tmp = handle->value;
+            handle->value = value;
+
+            return tmp;
+        }
+    }
+}
+
+static inline void *
+pak_str_map_lookup(PakStrMap *map, ElkStr key)
+{
+    /* Inspired by https://nullprogram.com/blog/2022/08/08
+     * All code & writing on this blog is in the public domain.
+     */
+
+    u64 const hash = elk_fnv1a_hash_str(key);
+    u32 i = hash & 0xffffffff; /* truncate */
+    while (true)
+    {
+        i = pak_hash_lookup(hash, map->size_exp, i);
+        PakStrMapHandle *handle = &map->handles[i];
+
+        if (!handle->key.start) { return NULL; }
+        else if (handle->hash == hash && elk_str_eq(key, handle->key)) 
+        {
+            /* found it! */
+            return handle->value;
+        }
+    }
+
+    return NULL;
+}
+
+static inline PakStrMapHandle const *
+pak_str_map_lookup_handle(PakStrMap *map, ElkStr key)
+{
+    /* Inspired by https://nullprogram.com/blog/2022/08/08
+     * All code & writing on this blog is in the public domain.
+     */
+
+    u64 const hash = elk_fnv1a_hash_str(key);
+    u32 i = hash & 0xffffffff; /* truncate */
+    while (true)
+    {
+        i = pak_hash_lookup(hash, map->size_exp, i);
+        PakStrMapHandle *handle = &map->handles[i];
+
+        if (!handle->key.start) { return NULL; }
+        else if (handle->hash == hash && elk_str_eq(key, handle->key)) 
+        {
+            /* found it! */
+            return handle;
+        }
+    }
+
+    return NULL;
+}
+
+static inline size
+pak_str_map_len(PakStrMap *map)
+{
+    return map->num_handles;
+}
+
+static inline PakHashMapKeyIter 
+pak_str_map_key_iter(PakStrMap *map)
+{
+    return 0;
+}
+
+static inline PakStrMapHandleIter 
+pak_str_map_handle_iter(PakStrMap *map)
+{
+    return 0;
+}
+
+static inline ElkStr 
+pak_str_map_key_iter_next(PakStrMap *map, PakStrMapKeyIter *iter)
+{
+    size const max_iter = (size)(1 << map->size_exp);
+    if(*iter < max_iter) 
+    {
+        ElkStr next_key = map->handles[*iter].key;
+        *iter += 1;
+        while(next_key.start == NULL && *iter < max_iter)
+        {
+            next_key = map->handles[*iter].key;
+            *iter += 1;
+        }
+
+        return next_key;
+    }
+    else
+    {
+        return (ElkStr){.start=NULL, .len=0};
+    }
+
+}
+
+static inline PakStrMapHandle 
+pak_str_map_handle_iter_next(PakStrMap *map, PakStrMapHandleIter *iter)
+{
+    size const max_iter = (size)(1 << map->size_exp);
+    if(*iter < max_iter) 
+    {
+        PakStrMapHandle next = map->handles[*iter];
+        *iter += 1;
+        while(next.key.start == NULL && *iter < max_iter)
+        {
+            next = map->handles[*iter];
+            *iter += 1;
+        }
+
+        return next;
+    }
+    else
+    {
+        return (PakStrMapHandle){ .key = (ElkStr){.start=NULL, .len=0}, .hash = 0, .value = NULL };
+    }
+}
+
+static inline PakHashSet 
+pak_hash_set_create(i8 size_exp, ElkSimpleHash val_hash, ElkEqFunction val_eq, MagAllocator *alloc)
+{
+    Assert(size_exp > 0 && size_exp <= 31); /* Come on, 31 is HUGE */
+
+    size const handles_len = (size)(1 << size_exp);
+    PakHashSetHandle *handles = eco_arena_nmalloc(alloc, handles_len, PakHashSetHandle);
+    PanicIf(!handles);
+
+    return (PakHashSet)
+    {
+        .alloc = alloc,
+        .handles = handles,
+        .num_handles = 0, 
+        .hasher = val_hash,
+        .eq = val_eq,
+        .size_exp = size_exp
+    };
+}
+
+static inline void 
+pak_hash_set_destroy(PakHashSet *set)
+{
+    return;
+}
+
+static void
+pak_hash_set_expand(PakHashSet *set)
+{
+    i8 const size_exp = set->size_exp;
+    i8 const new_size_exp = size_exp + 1;
+
+    size const handles_len = (size)(1 << size_exp);
+    size const new_handles_len = (size)(1 << new_size_exp);
+
+    PakHashSetHandle *new_handles = eco_arena_nmalloc(set->alloc, new_handles_len, PakHashSetHandle);
+    PanicIf(!new_handles);
+
+    for (u32 i = 0; i < handles_len; i++) 
+    {
+        PakHashSetHandle *handle = &set->handles[i];
+
+        if (handle->value == NULL) { continue; } /* Skip if it's empty */
+
+        /* Find the position in the new table and update it. */
+        u64 const hash = handle->hash;
+        u32 j = hash & 0xffffffff; /* truncate */
+        while (true) 
+        {
+            j = pak_hash_lookup(hash, new_size_exp, j);
+            PakHashSetHandle *new_handle = &new_handles[j];
+
+            if (!new_handle->value)
+            {
+                /* empty - put it here. Don't need to check for room because we just expanded
+                 * the hash table of handles, and we're not copying anything new into storage,
+                 * it's already there!
+                 */
+                *new_handle = *handle;
+                break;
+            }
+        }
+    }
+
+    set->handles = new_handles;
+    set->size_exp = new_size_exp;
+
+    return;
+}
+
+static inline void *
+pak_hash_set_insert(PakHashSet *set, void *value)
+{
+    /* Inspired by https://nullprogram.com/blog/2022/08/08
+     * All code & writing on this blog is in the public domain.
+     */
+
+    u64 const hash = set->hasher(value);
+    u32 i = hash & 0xffffffff; /* truncate */
+    while (true)
+    {
+        i = pak_hash_lookup(hash, set->size_exp, i);
+        PakHashSetHandle *handle = &set->handles[i];
+
+        if (!handle->value)
+        {
+            /* empty, insert here if room in the table of handles. Check for room first! */
+            if (pak_hash_table_large_enough(set->num_handles, set->size_exp))
+            {
+
+                *handle = (PakHashSetHandle){.hash = hash, .value=value};
+                set->num_handles += 1;
+
+                return handle->value;
+            }
+            else 
+            {
+                /* Grow the table so we have room */
+                pak_hash_set_expand(set);
+
+                /* Recurse because all the state needed by the *_lookup function was just crushed
+                 * by the expansion of the set. 
+                 */
+                return pak_hash_set_insert(set, value);
+            }
+        }
+        else if (handle->hash == hash && set->eq(handle->value, value)) 
+        {
+            /* found it! */
+            return handle->value;
+        }
+    }
+
+    return NULL;
+}
+
+static inline void *
+pak_hash_set_lookup(PakHashSet *set, void *value)
+{
+    /* Inspired by https://nullprogram.com/blog/2022/08/08
+     * All code & writing on this blog is in the public domain.
+     */
+
+    u64 const hash = set->hasher(value);
+    u32 i = hash & 0xffffffff; /* truncate */
+    while (true)
+    {
+        i = pak_hash_lookup(hash, set->size_exp, i);
+        PakHashSetHandle *handle = &set->handles[i];
+
+        if (!handle->value)
+        {
+            return NULL;
+        }
+        else if (handle->hash == hash && set->eq(handle->value, value)) 
+        {
+            /* found it! */
+            return handle->value;
+        }
+    }
+
+    return NULL;
+}
+
+static inline size 
+pak_hash_set_len(PakHashSet *set)
+{
+    return set->num_handles;
+}
+
+static inline PakHashSetIter
+pak_hash_set_value_iter(PakHashSet *set)
+{
+    return 0;
+}
+
+static inline void *
+pak_hash_set_value_iter_next(PakHashSet *set, PakHashSetIter *iter)
+{
+    size const max_iter = (size)(1 << set->size_exp);
+    void *next_value = NULL;
+    if(*iter >= max_iter) { return next_value; }
+
+    do
+    {
+        next_value = set->handles[*iter].value;
+        *iter += 1;
+
+    } while(next_value == NULL && *iter < max_iter);
+
+    return next_value;
+}
+
+#define PAK_I8_FLIP(x) ((x) ^ UINT8_C(0x80))
+#define PAK_I8_FLIP_BACK(x) PAK_I8_FLIP(x)
+
+#define PAK_I16_FLIP(x) ((x) ^ UINT16_C(0x8000))
+#define PAK_I16_FLIP_BACK(x) PAK_I16_FLIP(x)
+
+#define PAK_I32_FLIP(x) ((x) ^ UINT32_C(0x80000000))
+#define PAK_I32_FLIP_BACK(x) PAK_I32_FLIP(x)
+
+#define PAK_I64_FLIP(x) ((x) ^ UINT64_C(0x8000000000000000))
+#define PAK_I64_FLIP_BACK(x) PAK_I64_FLIP(x)
+
+#define PAK_F32_FLIP(x) ((x) ^ (-(i32)(((u32)(x)) >> 31) | UINT32_C(0x80000000)))
+#define PAK_F32_FLIP_BACK(x) ((x) ^ (((((u32)(x)) >> 31) - 1) | UINT32_C(0x80000000)))
+
+#define PAK_F64_FLIP(x) ((x) ^ (-(i64)(((u64)(x)) >> 63) | UINT64_C(0x8000000000000000)))
+#define PAK_F64_FLIP_BACK(x) ((x) ^ (((((u64)(x)) >> 63) - 1) | UINT64_C(0x8000000000000000)))
+
+static inline void
+pak_radix_pre_sort_transform(void *buffer, size num, size offset, size stride, PakRadixSortByType sort_type)
+{
+    Assert(
+           sort_type == PAK_RADIX_SORT_UINT64 || sort_type == PAK_RADIX_SORT_INT64 || sort_type == PAK_RADIX_SORT_F64
+        || sort_type == PAK_RADIX_SORT_UINT32 || sort_type == PAK_RADIX_SORT_INT32 || sort_type == PAK_RADIX_SORT_F32
+        || sort_type == PAK_RADIX_SORT_UINT16 || sort_type == PAK_RADIX_SORT_INT16
+        || sort_type == PAK_RADIX_SORT_UINT8  || sort_type == PAK_RADIX_SORT_INT8
+    );
+
+    for(size i = 0; i < num; ++i)
+    {
+        switch(sort_type)
+        {
+            case PAK_RADIX_SORT_F64:
+            {
+                /* Flip bits so doubles sort correctly. */
+                u64 *v = (u64 *)((byte *)buffer + offset + i * stride);
+                *v = PAK_F64_FLIP(*v);
+            } break;
+
+            case PAK_RADIX_SORT_INT64:
+            {
+                /* Flip bits so two's complement signed integers sort correctly. */
+                u64 *v = (u64 *)((byte *)buffer + offset + i * stride);
+                *v = PAK_I64_FLIP(*v);
+            } break;
+
+            case PAK_RADIX_SORT_F32:
+            {
+                /* Flip bits so doubles sort correctly. */
+                u32 *v = (u32 *)((byte *)buffer + offset + i * stride);
+                *v = PAK_F32_FLIP(*v);
+            } break;
+
+            case PAK_RADIX_SORT_INT32:
+            {
+                /* Flip bits so two's complement signed integers sort correctly. */
+                u32 *v = (u32 *)((byte *)buffer + offset + i * stride);
+                *v = PAK_I32_FLIP(*v);
+            } break;
+
+            case PAK_RADIX_SORT_INT16:
+            {
+                /* Flip bits so two's complement signed integers sort correctly. */
+                u16 *v = (u16 *)((byte *)buffer + offset + i * stride);
+                *v = PAK_I16_FLIP(*v);
+            } break;
+
+            case PAK_RADIX_SORT_INT8:
+            {
+                /* Flip bits so two's complement signed integers sort correctly. */
+                u8 *v = (u8 *)((byte *)buffer + offset + i * stride);
+                *v = PAK_I8_FLIP(*v);
+            } break;
+
+            /* Fall through without doing anything. */
+            case PAK_RADIX_SORT_UINT64:
+            case PAK_RADIX_SORT_UINT32:
+            case PAK_RADIX_SORT_UINT16:
+            case PAK_RADIX_SORT_UINT8: {}
+        }
+    }
+}
+
+static inline void
+pak_radix_post_sort_transform(void *buffer, size num, size offset, size stride, PakRadixSortByType sort_type)
+{
+    Assert(
+           sort_type == PAK_RADIX_SORT_UINT64 || sort_type == PAK_RADIX_SORT_INT64 || sort_type == PAK_RADIX_SORT_F64
+        || sort_type == PAK_RADIX_SORT_UINT32 || sort_type == PAK_RADIX_SORT_INT32 || sort_type == PAK_RADIX_SORT_F32
+        || sort_type == PAK_RADIX_SORT_UINT16 || sort_type == PAK_RADIX_SORT_INT16
+        || sort_type == PAK_RADIX_SORT_UINT8  || sort_type == PAK_RADIX_SORT_INT8
+    );
+
+    for(size i = 0; i < num; ++i)
+    {
+        switch(sort_type)
+        {
+            case PAK_RADIX_SORT_F64:
+            {
+                /* Flip bits so doubles sort correctly. */
+                u64 *v = (u64 *)((byte *)buffer + offset + i * stride);
+                *v = PAK_F64_FLIP_BACK(*v);
+            } break;
+
+            case PAK_RADIX_SORT_INT64:
+            {
+                /* Flip bits so two's complement signed integers sort correctly. */
+                u64 *v = (u64 *)((byte *)buffer + offset + i * stride);
+                *v = PAK_I64_FLIP_BACK(*v);
+            } break;
+
+            case PAK_RADIX_SORT_F32:
+            {
+                /* Flip bits so doubles sort correctly. */
+                u32 *v = (u32 *)((byte *)buffer + offset + i * stride);
+                *v = PAK_F32_FLIP_BACK(*v);
+            } break;
+
+            case PAK_RADIX_SORT_INT32:
+            {
+                /* Flip bits so two's complement signed integers sort correctly. */
+                u32 *v = (u32 *)((byte *)buffer + offset + i * stride);
+                *v = PAK_I32_FLIP_BACK(*v);
+            } break;
+
+            case PAK_RADIX_SORT_INT16:
+            {
+                /* Flip bits so two's complement signed integers sort correctly. */
+                u16 *v = (u16 *)((byte *)buffer + offset + i * stride);
+                *v = PAK_I16_FLIP_BACK(*v);
+            } break;
+
+            case PAK_RADIX_SORT_INT8:
+            {
+                /* Flip bits so two's complement signed integers sort correctly. */
+                u8 *v = (u8 *)((byte *)buffer + offset + i * stride);
+                *v = PAK_I8_FLIP_BACK(*v);
+            } break;
+
+            /* Fall through with no-op */
+            case PAK_RADIX_SORT_UINT64:
+            case PAK_RADIX_SORT_UINT32:
+            case PAK_RADIX_SORT_UINT16:
+            case PAK_RADIX_SORT_UINT8: {}
+        }
+    }
+}
+
+static inline void
+pak_radix_sort_8(void *buffer, size num, size offset, size stride, void *scratch, PakSortOrder order)
+{
+    i64 counts[256] = {0};
+
+    /* Build the histograms. */
+    byte *position = (byte *)buffer + offset;
+
+    for(size i = 0; i < num; ++i)
+    {
+        u8 b0 = *(u8 *)position;
+        counts[b0] += 1;
+        position += stride;
+    }
+
+    /* Sum the histograms. */
+    if(order == PAK_SORT_ASCENDING)
+    {
+        for(size i = 1; i < 256; ++i)
+        {
+            counts[i] += counts[i - 1];
+        }
+    }
+    else
+    {
+        for(size i = 254; i >= 0; --i)
+        {
+            counts[i] += counts[i + 1];
+        }
+    }
+
+    /* Build the output array. */
+    void *dest = scratch;
+    void *source = buffer;
+    for(size i = num - 1; i >= 0; --i)
+    {
+        void *val_src = (byte *)source + i * stride;
+        u8 cnts_idx = *((u8 *)val_src + offset);
+        void *val_dest = (byte *)dest + (--counts[cnts_idx]) * stride;
+
+        memcpy(val_dest, val_src, stride);
+    }
+
+    /* Copy back to the original buffer. */
+    memcpy(buffer, scratch, stride * num);
+}
+
+static inline void
+pak_radix_sort_16(void *buffer, size num, size offset, size stride, void *scratch, PakSortOrder order)
+{
+    i64 counts[256][2] = {0};
+    i32 skips[2] = {1, 1};
+
+    /* Build the histograms. */
+    byte *position = (byte *)buffer + offset;
+
+    u16 val = *(u16 *)position;
+    u8 b0 = UINT16_C(0xFF) & (val >>  0);
+    u8 b1 = UINT16_C(0xFF) & (val >>  8);
+
+    counts[b0][0] += 1;
+    counts[b1][1] += 1;
+
+    position += stride;
+
+    u8 initial_values[2] = {b0, b1};
+
+    for(size i = 1; i < num; ++i)
+    {
+        val = *(u16 *)position;
+        b0 = UINT16_C(0xFF) & (val >>  0);
+        b1 = UINT16_C(0xFF) & (val >>  8);
+
+        counts[b0][0] += 1;
+        counts[b1][1] += 1;
+
+        skips[0] &= initial_values[0] == b0;
+        skips[1] &= initial_values[1] == b1;
+
+        position += stride;
+    }
+
+    /* Sum the histograms. */
+    if(order == PAK_SORT_ASCENDING)
+    {
+        for(size i = 1; i < 256; ++i)
+        {
+            counts[i][0] += counts[i - 1][0];
+            counts[i][1] += counts[i - 1][1];
+        }
+    }
+    else
+    {
+        for(size i = 254; i >= 0; --i)
+        {
+            counts[i][0] += counts[i + 1][0];
+            counts[i][1] += counts[i + 1][1];
+        }
+    }
+
+    /* Build the output array. */
+    void *dest = scratch;
+    void *source = buffer;
+    size num_skips = 0;
+    for(size b = 0; b < 2; ++b)
+    {
+        if(!skips[b])
+        {
+            for(size i = num - 1; i >= 0; --i)
+            {
+                void *val_src = (byte *)source + i * stride;
+                u16 val = *(u16 *)((byte *)val_src + offset);
+                u8 cnts_idx = UINT16_C(0xFF) & (val >> (b * 8));
+                void *val_dest = (byte *)dest + (--counts[cnts_idx][b]) * stride;
+
+                memcpy(val_dest, val_src, stride);
+            }
+
+            /* Flip the source & destination buffers. */
+            dest = dest == scratch ? buffer : scratch;
+            source = source == scratch ? buffer : scratch;
+        }
+        else
+        {
+            num_skips++;
+        }
+    }
+
+    /* Swap back into the original buffer. */
+    if(num_skips % 2)
+    {
+        memcpy(buffer, scratch, num * stride);
+    }
+}
+
+static inline void
+pak_radix_sort_32(void *buffer, size num, size offset, size stride, void *scratch, PakSortOrder order)
+{
+    i64 counts[256][4] = {0};
+    i32 skips[4] = {1, 1, 1, 1};
+
+    /* Build the histograms. */
+    byte *position = (byte *)buffer + offset;
+
+    u32 val = *(u32 *)position;
+    u8 b0 = UINT32_C(0xFF) & (val >>  0);
+    u8 b1 = UINT32_C(0xFF) & (val >>  8);
+    u8 b2 = UINT32_C(0xFF) & (val >> 16);
+    u8 b3 = UINT32_C(0xFF) & (val >> 24);
+
+    counts[b0][0] += 1;
+    counts[b1][1] += 1;
+    counts[b2][2] += 1;
+    counts[b3][3] += 1;
+
+    position += stride;
+
+    u8 initial_values[4] = {b0, b1, b2, b3};
+
+    for(size i = 1; i < num; ++i)
+    {
+        val = *(u32 *)position;
+        b0 = UINT32_C(0xFF) & (val >>  0);
+        b1 = UINT32_C(0xFF) & (val >>  8);
+        b2 = UINT32_C(0xFF) & (val >> 16);
+        b3 = UINT32_C(0xFF) & (val >> 24);
+
+        counts[b0][0] += 1;
+        counts[b1][1] += 1;
+        counts[b2][2] += 1;
+        counts[b3][3] += 1;
+
+        skips[0] &= initial_values[0] == b0;
+        skips[1] &= initial_values[1] == b1;
+        skips[2] &= initial_values[2] == b2;
+        skips[3] &= initial_values[3] == b3;
+
+        position += stride;
+    }
+
+    /* Sum the histograms. */
+    if(order == PAK_SORT_ASCENDING)
+    {
+        for(size i = 1; i < 256; ++i)
+        {
+            counts[i][0] += counts[i - 1][0];
+            counts[i][1] += counts[i - 1][1];
+            counts[i][2] += counts[i - 1][2];
+            counts[i][3] += counts[i - 1][3];
+        }
+    }
+    else
+    {
+        for(size i = 254; i >= 0; --i)
+        {
+            counts[i][0] += counts[i + 1][0];
+            counts[i][1] += counts[i + 1][1];
+            counts[i][2] += counts[i + 1][2];
+            counts[i][3] += counts[i + 1][3];
+        }
+    }
+
+    /* Build the output array. */
+    void *dest = scratch;
+    void *source = buffer;
+    size num_skips = 0;
+    for(size b = 0; b < 4; ++b)
+    {
+        if(!skips[b])
+        {
+            for(size i = num - 1; i >= 0; --i)
+            {
+                void *val_src = (byte *)source + i * stride;
+                u32 val = *(u32 *)((byte *)val_src + offset);
+                u8 cnts_idx = UINT32_C(0xFF) & (val >> (b * 8));
+                void *val_dest = (byte *)dest + (--counts[cnts_idx][b]) * stride;
+
+                memcpy(val_dest, val_src, stride);
+            }
+
+            /* Flip the source & destination buffers. */
+            dest = dest == scratch ? buffer : scratch;
+            source = source == scratch ? buffer : scratch;
+        }
+        else
+        {
+            num_skips++;
+        }
+    }
+
+    /* Swap back into the original buffer. */
+    if(num_skips % 2)
+    {
+        memcpy(buffer, scratch, num * stride);
+    }
+}
+
+static inline void
+pak_radix_sort_64(void *buffer, size num, size offset, size stride, void *scratch, PakSortOrder order)
+{
+    i64 counts[256][8] = {0};
+    i32 skips[8] = {1, 1, 1, 1, 1, 1, 1, 1};
+
+    /* Build the histograms. */
+    byte *position = (byte *)buffer + offset;
+
+    u64 val = *(u64 *)position;
+    u8 b0 = UINT64_C(0xFF) & (val >>  0);
+    u8 b1 = UINT64_C(0xFF) & (val >>  8);
+    u8 b2 = UINT64_C(0xFF) & (val >> 16);
+    u8 b3 = UINT64_C(0xFF) & (val >> 24);
+    u8 b4 = UINT64_C(0xFF) & (val >> 32);
+    u8 b5 = UINT64_C(0xFF) & (val >> 40);
+    u8 b6 = UINT64_C(0xFF) & (val >> 48);
+    u8 b7 = UINT64_C(0xFF) & (val >> 56);
+
+    counts[b0][0] += 1;
+    counts[b1][1] += 1;
+    counts[b2][2] += 1;
+    counts[b3][3] += 1;
+    counts[b4][4] += 1;
+    counts[b5][5] += 1;
+    counts[b6][6] += 1;
+    counts[b7][7] += 1;
+
+    position += stride;
+
+    u8 initial_values[8] = {b0, b1, b2, b3, b4, b5, b6, b7};
+
+    for(size i = 1; i < num; ++i)
+    {
+        val = *(u64 *)position;
+        b0 = UINT64_C(0xFF) & (val >>  0);
+        b1 = UINT64_C(0xFF) & (val >>  8);
+        b2 = UINT64_C(0xFF) & (val >> 16);
+        b3 = UINT64_C(0xFF) & (val >> 24);
+        b4 = UINT64_C(0xFF) & (val >> 32);
+        b5 = UINT64_C(0xFF) & (val >> 40);
+        b6 = UINT64_C(0xFF) & (val >> 48);
+        b7 = UINT64_C(0xFF) & (val >> 56);
+
+        counts[b0][0] += 1;
+        counts[b1][1] += 1;
+        counts[b2][2] += 1;
+        counts[b3][3] += 1;
+        counts[b4][4] += 1;
+        counts[b5][5] += 1;
+        counts[b6][6] += 1;
+        counts[b7][7] += 1;
+
+        skips[0] &= initial_values[0] == b0;
+        skips[1] &= initial_values[1] == b1;
+        skips[2] &= initial_values[2] == b2;
+        skips[3] &= initial_values[3] == b3;
+        skips[4] &= initial_values[4] == b4;
+        skips[5] &= initial_values[5] == b5;
+        skips[6] &= initial_values[6] == b6;
+        skips[7] &= initial_values[7] == b7;
+
+        position += stride;
+    }
+
+    /* Sum the histograms. */
+    if(order == PAK_SORT_ASCENDING)
+    {
+        for(size i = 1; i < 256; ++i)
+        {
+            counts[i][0] += counts[i - 1][0];
+            counts[i][1] += counts[i - 1][1];
+            counts[i][2] += counts[i - 1][2];
+            counts[i][3] += counts[i - 1][3];
+            counts[i][4] += counts[i - 1][4];
+            counts[i][5] += counts[i - 1][5];
+            counts[i][6] += counts[i - 1][6];
+            counts[i][7] += counts[i - 1][7];
+        }
+    }
+    else
+    {
+        for(size i = 254; i >= 0; --i)
+        {
+            counts[i][0] += counts[i + 1][0];
+            counts[i][1] += counts[i + 1][1];
+            counts[i][2] += counts[i + 1][2];
+            counts[i][3] += counts[i + 1][3];
+            counts[i][4] += counts[i + 1][4];
+            counts[i][5] += counts[i + 1][5];
+            counts[i][6] += counts[i + 1][6];
+            counts[i][7] += counts[i + 1][7];
+        }
+    }
+
+    /* Build the output array. */
+    void *dest = scratch;
+    void *source = buffer;
+    size num_skips = 0;
+    for(size b = 0; b < 8; ++b)
+    {
+        if(!skips[b])
+        {
+            for(size i = num - 1; i >= 0; --i)
+            {
+                void *val_src = (byte *)source + i * stride;
+                u64 val = *(u64 *)((byte *)val_src + offset);
+                u8 cnts_idx = UINT64_C(0xFF) & (val >> (b * 8));
+                void *val_dest = (byte *)dest + (--counts[cnts_idx][b]) * stride;
+
+                memcpy(val_dest, val_src, stride);
+            }
+
+            /* Flip the source & destination buffers. */
+            dest = dest == scratch ? buffer : scratch;
+            source = source == scratch ? buffer : scratch;
+        }
+        else
+        {
+            num_skips++;
+        }
+    }
+
+    /* Swap back into the original buffer. */
+    if(num_skips % 2)
+    {
+        memcpy(buffer, scratch, num * stride);
+    }
+}
+
+static inline void
+pak_radix_sort(void *buffer, size num, size offset, size stride, void *scratch, PakRadixSortByType sort_type, PakSortOrder order)
+{
+    pak_radix_pre_sort_transform(buffer, num, offset, stride, sort_type);
+
+    switch(sort_type)
+    {
+        case PAK_RADIX_SORT_UINT64:
+        case PAK_RADIX_SORT_INT64:
+        case PAK_RADIX_SORT_F64:
+        {
+            pak_radix_sort_64(buffer, num, offset, stride, scratch, order);
+        } break;
+
+        case PAK_RADIX_SORT_UINT32:
+        case PAK_RADIX_SORT_INT32:
+        case PAK_RADIX_SORT_F32:
+        {
+            pak_radix_sort_32(buffer, num, offset, stride, scratch, order);
+        } break;
+
+        case PAK_RADIX_SORT_UINT16:
+        case PAK_RADIX_SORT_INT16:
+        {
+            pak_radix_sort_16(buffer, num, offset, stride, scratch, order);
+        } break;
+
+        case PAK_RADIX_SORT_UINT8:
+        case PAK_RADIX_SORT_INT8:
+        {
+            pak_radix_sort_8(buffer, num, offset, stride, scratch, order);
+        } break;
+
+        default: Panic();
+    }
+    
+    pak_radix_post_sort_transform(buffer, num, offset, stride, sort_type);
+}
+
+static inline void
+pak_shuffle_swap(byte *a, byte *b, size stride)
+{
+    if(a == b) { return; }
+
+    switch(stride)
+    {
+        case 8: { u64 t; memcpy(&t, a, 8); memcpy(a, b, 8); memcpy(b, &t, 8); } break;
+        case 4: { u32 t; memcpy(&t, a, 4); memcpy(a, b, 4); memcpy(b, &t, 4); } break;
+        default:
+        {
+            byte tmp[64];
+            while(stride > 0)
+            {
+                size chunk = stride > (size)sizeof(tmp) ? (size)sizeof(tmp) : stride;
+                memcpy(tmp, a, chunk);
+                memcpy(a, b, chunk);
+                memcpy(b, tmp, chunk);
+                a += chunk;
+                b += chunk;
+                stride -= chunk;
+            }
+        }
+    }
+}
+
+static inline void
+pak_shuffle(void *buffer, size num, size stride, ElkRandomState *state)
+{
+    Assert(num >= 0 && stride > 0);
+
+    byte *base = buffer;
+    size i = num - 1;
+
+    /* Two indexes per random number while the product of the bounds fits in 64 bits. */
+    while(i >= 2 && (u64)i <= UINT32_MAX)
+    {
+        u64 j0 = 0;
+        u64 j1 = 0;
+        elk_random_state_uniform_bounded_pair_u64(state, (u64)i + 1, (u64)i, &j0, &j1);
+
+        pak_shuffle_swap(base + i * stride, base + j0 * stride, stride);
+        pak_shuffle_swap(base + (i - 1) * stride, base + j1 * stride, stride);
+        i -= 2;
+    }
+
+    while(i >= 1)
+    {
+        u64 j = elk_random_state_uniform_bounded_u64(state, (u64)i + 1);
+        pak_shuffle_swap(base + i * stride, base + j * stride, stride);
+        i -= 1;
+    }
+}
+
+static inline PakReservoirLedger
+pak_reservoir_ledger_create(size capacity, ElkRandomState *state)
+{
+    Assert(capacity > 0 && state);
+    return (PakReservoirLedger){ .capacity = capacity, .length = 0, .num_seen = 0, .state = state };
+}
+
+static inline size
+pak_reservoir_ledger_offer_index(PakReservoirLedger *res)
+{
+    res->num_seen += 1;
+
+    /* Still filling the reservoir. */
+    if(res->length < res->capacity) { return res->length++; }
+
+    /* Keep this item with probability capacity / num_seen, replacing a random member of the sample. */
+    u64 j = elk_random_state_uniform_bounded_u64(res->state, (u64)res->num_seen);
+    if(j < (u64)res->capacity) { return (size)j; }
+
+    return PAK_RESERVOIR_SKIP;
+}
+
+static inline size
+pak_reservoir_ledger_len(PakReservoirLedger const *res)
+{
+    return res->length;
+}
+
+
+static inline PakHistogram
+pak_histogram_create(f64 min, f64 max, i32 num_bins, MagAllocator *alloc)
+{
+    Assert(max > min && num_bins > 0);
+
+    u64 *counts = eco_arena_nmalloc(alloc, PAK_HISTOGRAM_SUBS * (num_bins + 3), u64);
+    PanicIf(!counts);
+
+    return (PakHistogram){ .counts = counts, .min = min, .max = max, .scale = num_bins / (max - min), .num_bins = num_bins };
+}
+
+static inline i32
+pak_histogram_slot(PakHistogram const *hist, f64 value)
+{
+    if(value != value) { return hist->num_bins + 2; }
+
+    f64 const f = (value - hist->min) * hist->scale;
+    if(f < 0.0) { return 0; }
+    if(f >= hist->num_bins) { return hist->num_bins + 1; }
+
+    return (i32)f + 1;
+}
+
+static inline void
+pak_histogram_add_helper(PakHistogram *hist, size n, void const *data, b32 is_f32)
+{
+    Assert(n >= 0);
+
+    i32 const slots = hist->num_bins + 3;
+    u64 *counts = hist->counts;
+    size i = 0;
+
+#if __AVX2__
+
+    __m256d const vmin = _mm256_set1_pd(hist->min);
+    __m256d const vscale = _mm256_set1_pd(hist->scale);
+    __m256d const lo = _mm256_set1_pd(-1.0);
+    __m256d const hi = _mm256_set1_pd(hist->num_bins);
+    __m256d const one = _mm256_set1_pd(1.0);
+    __m256d const nan_slot = _mm256_set1_pd(hist->num_bins + 2);
+
+    /* Lane j always goes to sub-histogram j, this assumes PAK_HISTOGRAM_SUBS is 4. */
+    u64 *c0 = counts + 0 * slots;
+    u64 *c1 = counts + 1 * slots;
+    u64 *c2 = counts + 2 * slots;
+    u64 *c3 = counts + 3 * slots;
+
+    for(; i + 4 <= n; i += 4)
+    {
+        __m256d x = is_f32 ? _mm256_cvtps_pd(_mm_loadu_ps((f32 const *)data + i)) : _mm256_loadu_pd((f64 const *)data + i);
+        __m256d const ok = _mm256_cmp_pd(x, x, _CMP_ORD_Q);
+
+        __m256d f = _mm256_floor_pd(_mm256_mul_pd(_mm256_sub_pd(x, vmin), vscale));
+        f = _mm256_min_pd(_mm256_max_pd(f, lo), hi);
+        f = _mm256_blendv_pd(nan_slot, _mm256_add_pd(f, one), ok);
+
+        i32 idx[4];
+        _mm_storeu_si128((__m128i *)idx, _mm256_cvttpd_epi32(f));
+
+        c0[idx[0]]++;
+        c1[idx[1]]++;
+        c2[idx[2]]++;
+        c3[idx[3]]++;
+    }
+
+#endif
+
+    for(; i < n; ++i)
+    {
+        f64 const val = is_f32 ? ((f32 const *)data)[i] : ((f64 const *)data)[i];
+        counts[(i % PAK_HISTOGRAM_SUBS) * slots + pak_histogram_slot(hist, val)]++;
+    }
+}
+
+static inline void
+pak_histogram_add_f64(PakHistogram *hist, size n, f64 const *data)
+{
+    pak_histogram_add_helper(hist, n, data, false);
+}
+
+static inline void
+pak_histogram_add_f32(PakHistogram *hist, size n, f32 const *data)
+{
+    pak_histogram_add_helper(hist, n, data, true);
+}
+
+static inline void
+pak_histogram_merge(PakHistogram *dest, PakHistogram const *src)
+{
+    Assert(dest->num_bins == src->num_bins && dest->min == src->min && dest->max == src->max);
+
+    size const num_counts = PAK_HISTOGRAM_SUBS * (dest->num_bins + 3);
+    for(size i = 0; i < num_counts; ++i) { dest->counts[i] += src->counts[i]; }
+}
+
+static inline u64
+pak_histogram_count(PakHistogram const *hist, i32 bin)
+{
+    i32 slot = bin + 1;
+    if(bin == PAK_HISTOGRAM_BELOW) { slot = 0; }
+    else if(bin == PAK_HISTOGRAM_ABOVE) { slot = hist->num_bins + 1; }
+    else if(bin == PAK_HISTOGRAM_NAN) { slot = hist->num_bins + 2; }
+    Assert(slot >= 0 && slot < hist->num_bins + 3);
+
+    i32 const slots = hist->num_bins + 3;
+    u64 count = 0;
+    for(i32 s = 0; s < PAK_HISTOGRAM_SUBS; ++s) { count += hist->counts[s * slots + slot]; }
+
+    return count;
+}
+
+static inline f64
+pak_histogram_quantile(PakHistogram const *hist, f64 q)
+{
+    Assert(q >= 0.0 && q <= 1.0);
+
+    u64 total = 0;
+    for(i32 b = -1; b <= hist->num_bins; ++b)
+    {
+        total += pak_histogram_count(hist, b == hist->num_bins ? PAK_HISTOGRAM_ABOVE : b);
+    }
+
+    f64 const target = q * total;
+    f64 cum = (f64)pak_histogram_count(hist, PAK_HISTOGRAM_BELOW);
+    if(target <= cum) { return hist->min; }
+
+    for(i32 b = 0; b < hist->num_bins; ++b)
+    {
+        u64 const c = pak_histogram_count(hist, b);
+        if(c > 0 && cum + c >= target)
+        {
+            return hist->min + (b + (target - cum) / c) / hist->scale;
+        }
+        cum += c;
+    }
+
+    return hist->max;
+}
+
+static inline PakQuantileSketch
+pak_quantile_sketch_create(i32 k, ElkRandomState *state, MagAllocator *alloc)
+{
+    Assert(k >= 8 && (k & 1) == 0 && state);
+
+    f64 *sort_scratch = eco_arena_nmalloc_uninit(alloc, k, f64);
+    PanicIf(!sort_scratch);
+
+    return (PakQuantileSketch){ .alloc = alloc, .state = state, .sort_scratch = sort_scratch, .k = k };
+}
+
+static inline void pak_quantile_sketch_push(PakQuantileSketch *sketch, i32 level, f64 value);
+
+static inline void
+pak_quantile_sketch_compact(PakQuantileSketch *sketch, i32 level)
+{
+    PanicIf(level + 1 >= PAK_QUANTILE_SKETCH_MAX_LEVELS);
+
+    f64 *items = sketch->levels[level];
+    i32 const len = sketch->lens[level];
+    Assert(len == sketch->k);
+
+    pak_radix_sort(items, len, 0, sizeof(f64), sketch->sort_scratch, PAK_RADIX_SORT_F64, PAK_SORT_ASCENDING);
+
+    /* Empty the level first, pushing to the next level may cascade, but never back down to this one. */
+    sketch->lens[level] = 0;
+    i32 const offset = (i32)(elk_random_state_uniform_u64(sketch->state) & 1);
+    for(i32 i = offset; i < len; i += 2)
+    {
+        pak_quantile_sketch_push(sketch, level + 1, items[i]);
+    }
+}
+
+static inline void
+pak_quantile_sketch_push(PakQuantileSketch *sketch, i32 level, f64 value)
+{
+    if(!sketch->levels[level])
+    {
+        sketch->levels[level] = eco_arena_nmalloc_uninit(sketch->alloc, sketch->k, f64);
+        PanicIf(!sketch->levels[level]);
+    }
+
+    if(level >= sketch->num_levels) { sketch->num_levels = level + 1; }
+
+    sketch->levels[level][sketch->lens[level]++] = value;
+    if(sketch->lens[level] == sketch->k) { pak_quantile_sketch_compact(sketch, level); }
+}
+
+static inline void
+pak_quantile_sketch_add(PakQuantileSketch *sketch, f64 value)
+{
+    if(value != value)
+    {
+        sketch->nan_count++;
+        return;
+    }
+
+    if(sketch->count == 0)
+    {
+        sketch->min = value;
+        sketch->max = value;
+    }
+    else
+    {
+        sketch->min = value < sketch->min ? value : sketch->min;
+        sketch->max = value > sketch->max ? value : sketch->max;
+    }
+    sketch->count++;
+
+    pak_quantile_sketch_push(sketch, 0, value);
+}
+
+static inline void
+pak_quantile_sketch_merge(PakQuantileSketch *dest, PakQuantileSketch const *src)
+{
+    Assert(dest->k == src->k);
+
+    if(src->count > 0)
+    {
+        if(dest->count == 0)
+        {
+            dest->min = src->min;
+            dest->max = src->max;
+        }
+        else
+        {
+            dest->min = src->min < dest->min ? src->min : dest->min;
+            dest->max = src->max > dest->max ? src->max : dest->max;
+        }
+    }
+
+    dest->count += src->count;
+    dest->nan_count += src->nan_count;
+
+    for(i32 level = 0; level < src->num_levels; ++level)
+    {
+        for(i32 i = 0; i < src->lens[level]; ++i)
+        {
+            pak_quantile_sketch_push(dest, level, src->levels[level][i]);
+        }
+    }
+}
+
+static inline f64
+pak_quantile_sketch_quantile(PakQuantileSketch *sketch, f64 q)
+{
+    Assert(q >= 0.0 && q <= 1.0);
+    Assert(sketch->count > 0);
+
+    if(q == 0.0) { return sketch->min; }
+    if(q == 1.0) { return sketch->max; }
+
+    /* Sort every level, then walk them all in order like a k-way merge, accumulating the weight of each value. */
+    f64 total = 0.0;
+    for(i32 level = 0; level < sketch->num_levels; ++level)
+    {
+        pak_radix_sort(sketch->levels[level], sketch->lens[level], 0, sizeof(f64), sketch->sort_scratch, PAK_RADIX_SORT_F64, PAK_SORT_ASCENDING);
+        total += (f64)sketch->lens[level] * (f64)((u64)1 << level);
+    }
+
+    i32 pos[PAK_QUANTILE_SKETCH_MAX_LEVELS] = {0};
+    f64 const target = q * total;
+    f64 cum = 0.0;
+    while(true)
+    {
+        i32 next = -1;
+        for(i32 level = 0; level < sketch->num_levels; ++level)
+        {
+            if(pos[level] < sketch->lens[level])
+            {
+                if(next < 0 || sketch->levels[level][pos[level]] < sketch->levels[next][pos[next]]) { next = level; }
+            }
+        }
+
+        if(next < 0) { return sketch->max; }
+
+        f64 const value = sketch->levels[next][pos[next]++];
+        cum += (f64)((u64)1 << next);
+        if(cum >= target) { return value; }
+    }
+}
+
+#endif
+
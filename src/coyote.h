@@ -316,6 +316,12 @@ static inline void coy_task_thread_destroy(CoyTaskThread *thread);
  *                                                      Thread Pool
  *---------------------------------------------------------------------------------------------------------------------------
  * A pool of worker threads that can take an arbitrary function and it's data (arguments) for each call.
+ *
+ * Every worker has a MagScratchSet bound to it, so task functions can use mag_scratch_begin() / mag_scratch_end() for 
+ * temporary memory without any locking. Tasks must end all their scratch before returning.
+ *
+ * Tasks can also find out which worker is running them with coy_threadpool_worker_index(). Use it to index per-worker
+ * state, like a MagSlotArray with nthreads slots, so workers never write to the same cache lines.
  */
 
 #define COY_FUTURE_STATE_ERROR    0 /* Initialization is an error! If zero initialized.                                        */
@@ -341,16 +347,29 @@ static inline void coy_future_mark_consumed(CoyFuture *fut);
 static inline b32 coy_future_is_consumed(CoyFuture *fut);
 
 #define COY_MAX_THREAD_POOL_SIZE 32
+#define COY_THREAD_POOL_SCRATCH_BLOCK_SIZE ECO_MiB(1)
+
+typedef struct
+{
+    CoyChannel *queue;
+    MagScratchSet scratch;
+    size index;
+} CoyThreadPoolWorker;
+
 typedef struct
 {
     CoyChannel queue;
     size nthreads;
     CoyThread threads[COY_MAX_THREAD_POOL_SIZE];
+    CoyThreadPoolWorker workers[COY_MAX_THREAD_POOL_SIZE];
 } CoyThreadPool;
 
 static inline void coy_threadpool_initialize(CoyThreadPool *pool, size nthreads);
 static inline void coy_threadpool_destroy(CoyThreadPool *pool);    /* Finish pending tasks and shut down. */
 static inline void coy_threadpool_submit(CoyThreadPool *pool, CoyFuture *fut);
+static inline size coy_threadpool_worker_index(void);     /* [0, nthreads) in a pool worker, -1 in any other thread. */
+
+static _Thread_local size coy_threadpool_thread_worker_index = -1;
 
 typedef struct
 {
@@ -366,6 +385,68 @@ static inline void coy_batch_completion_task_submit(CoyBatchCompletion *bc, CoyF
 static inline void coy_batch_completion_task_done(CoyBatchCompletion *bc); /* Called in worker thread when task complete. */
 static inline void coy_batch_completion_wait(CoyBatchCompletion *bc);      /* Called in thread waiting for tasks.         */
 
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                Asynchronous File Reader
+ *---------------------------------------------------------------------------------------------------------------------------
+ * Read a whole file front to back in big chunks with several reads in flight, so the next chunks are on their way in while
+ * the current one is parsed. CoyFileReader stops for every 32 KiB refill.
+ *
+ * coy_async_file_reader_next() hands out the chunks in file order as slices straight into the reader's buffers. A slice is
+ * good until the next call, which gives its buffer back to be refilled, so copy out any partial record at the end of a
+ * chunk before moving on. An empty slice means the end of the file, or an error if valid is false.
+ *
+ * On Linux reads go through io_uring, which keeps up to num_buffers - 1 of them queued in the kernel. Where there is no
+ * io_uring (older kernels, sandboxes that block it, other platforms) a reader thread fills the free buffers with blocking
+ * reads, one after the other, so I/O still overlaps with parsing. Only for regular files, the size is read when opened.
+ * If io_uring stops answering with reads still in flight, coy_async_file_reader_close() leaks the buffers rather than free
+ * memory the kernel may still write into.
+ *
+ * NOT THREADSAFE, one thread uses each reader.
+ */
+#define COY_ASYNC_FILE_READER_MAX_BUFFERS 16
+
+typedef enum
+{
+    COY_ASYNC_READ_DEFAULT = 0, /* io_uring if the kernel has it, otherwise a reader thread. */
+    COY_ASYNC_READ_IO_URING,    /* Fail to open if io_uring isn't available.                 */
+    COY_ASYNC_READ_THREAD,      /* Always use a reader thread, mostly for testing.           */
+} CoyAsyncReadBackend;
+
+/* Internal only. Lives at the front of the reader's memory so the kernel and the reader thread never see it move. */
+typedef struct
+{
+    iptr handle;
+    size file_size;
+    size buf_size;
+    i32 num_buffers;
+    byte *buffers;
+    size lens[COY_ASYNC_FILE_READER_MAX_BUFFERS];   /* Bytes read into each buffer so far.                   */
+    b32 done[COY_ASYNC_FILE_READER_MAX_BUFFERS];    /* Set when the chunk in a buffer is complete.           */
+    size next_chunk;                                /* Next chunk handed out.                                */
+    size next_read;                                 /* Next chunk to start reading.                          */
+    size read_limit;                                /* Chunks before this one can be read, the rest wait.    */
+    b32 holding;                                    /* The caller has the chunk before next_chunk.           */
+    b32 failed;
+    b32 stop;
+    CoyThread thread;
+    CoyMutex mutex;
+    CoyCondVar cond;
+    _Alignas(16) byte io_uring[256];                /* Platform specific, see coyote_linux.h.                */
+} CoyAsyncFileReaderState;
+
+typedef struct
+{
+    MagMemoryBlock mem;          /* The CoyAsyncFileReaderState followed by the buffers. */
+    CoyAsyncReadBackend backend; /* What is actually in use.                             */
+    b32 valid;                   /* error indicator                                      */
+} CoyAsyncFileReader;
+
+/* buf_size is rounded up to the page size, 0 gets 1 MiB. num_buffers is clamped to [2, COY_ASYNC_FILE_READER_MAX_BUFFERS],
+ * 0 gets 4. The first reads are started before it returns. */
+static inline CoyAsyncFileReader coy_async_file_reader_open(char const *filename, size buf_size, i32 num_buffers, CoyAsyncReadBackend backend);
+static inline ElkStr coy_async_file_reader_next(CoyAsyncFileReader *reader);
+static inline void coy_async_file_reader_close(CoyAsyncFileReader *reader); /* Waits for reads in flight to finish.  */
+
 /*---------------------------------------------------------------------------------------------------------------------------
  *                                                    Profiling Tools
  *---------------------------------------------------------------------------------------------------------------------------
@@ -446,6 +527,107 @@ static inline u64 coy_profile_read_os_page_fault_count(void);
 #else
 #define COY_PROFILE_STATIC_CHECK
 #endif
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                 Allocation Trace Log
+ *---------------------------------------------------------------------------------------------------------------------------
+ * Log what Magpie's allocation tracing reports (build with MAG_TRACE, see magpie.h) to a binary file, then summarize it
+ * by call site to see where the memory goes and which sites are wasteful.
+ *
+ * Each thread that should be traced starts its own CoyAllocTraceBuffer. Recording an event only reads the CPU timer and
+ * copies a record into the buffer. When a buffer fills up it is written through the trace's CoyFileWriter while holding
+ * the trace's mutex. Stop all buffers, each on its own thread, before destroying the trace. A buffer only sees what is
+ * allocated in translation units that share magpie's trace hook, see Allocation Tracing in magpie.h.
+ *
+ * The log is a CoyAllocTraceFileHeader followed by chunks that each start with a u32 tag. A COY_ALLOC_TRACE_TAG_FILE
+ * chunk is a u32 id, a u32 length, and then the file name. A COY_ALLOC_TRACE_TAG_RECORDS chunk is a u32 count followed
+ * by that many CoyAllocTraceRecords. Records refer to file names by id, 0 means the call site isn't known. Timestamps
+ * are coy_profile_read_cpu_timer() ticks.
+ *
+ * coy_alloc_trace_summarize() reads a log back in and totals it up by call site, coy_alloc_trace_summary_write() writes
+ * that out as a text table.
+ */
+#define COY_ALLOC_TRACE_MAGIC UINT64_C(0x454341525447414D) /* "MAGTRACE" in a little endian file */
+#define COY_ALLOC_TRACE_BUFFER_LEN 1024
+#define COY_ALLOC_TRACE_MAX_FILES 256
+#define COY_ALLOC_TRACE_TAG_FILE 1
+#define COY_ALLOC_TRACE_TAG_RECORDS 2
+
+typedef struct
+{
+    u64 magic;
+    u32 version;
+    u32 record_size;
+} CoyAllocTraceFileHeader;
+
+typedef struct
+{
+    u64 timestamp;
+    u64 allocator;        /* Address of the arena or MagAllocator.  */
+    u64 ptr;
+    u64 old_ptr;
+    i64 num_bytes;
+    i64 alignment;
+    u32 file_id;
+    i32 line;
+    u32 thread_id;        /* Numbered from 1 in the order started.  */
+    u8 op;                /* MagTraceOp                             */
+    u8 allocator_type;    /* MagAllocatorType                       */
+    u16 reserved;
+} CoyAllocTraceRecord;
+
+typedef struct
+{
+    CoyFileWriter file;
+    CoyMutex mutex;
+    char const *file_names[COY_ALLOC_TRACE_MAX_FILES]; /* Index is the file id - 1. */
+    i32 num_file_names;
+    u32 num_threads;
+    b32 valid;                                         /* false after any error.    */
+} CoyAllocTrace;
+
+typedef struct
+{
+    CoyAllocTrace *trace;
+    u32 thread_id;
+    i32 len;
+    char const *files[COY_ALLOC_TRACE_BUFFER_LEN];     /* Turned into file ids when flushed. */
+    CoyAllocTraceRecord records[COY_ALLOC_TRACE_BUFFER_LEN];
+} CoyAllocTraceBuffer;
+
+static inline CoyAllocTrace coy_alloc_trace_create(char const *filename);             /* Check valid member for errors.   */
+static inline b32 coy_alloc_trace_destroy(CoyAllocTrace *trace);                      /* false if anything wasn't logged. */
+static inline void coy_alloc_trace_start(CoyAllocTrace *trace, CoyAllocTraceBuffer *buf); /* Trace the calling thread. */
+static inline void coy_alloc_trace_flush(CoyAllocTraceBuffer *buf);
+static inline void coy_alloc_trace_stop(CoyAllocTraceBuffer *buf);                    /* Flushes, call on same thread.    */
+
+typedef struct
+{
+    ElkStr file;               /* Empty if the call site isn't known.          */
+    i32 line;
+    u64 num_allocs;
+    u64 num_reallocs;
+    u64 num_realloc_moves;     /* Reallocs that returned a different pointer.  */
+    u64 num_frees;
+    u64 num_resets;
+    u64 num_failures;          /* Allocs and reallocs that returned NULL.      */
+    u64 bytes_requested;       /* Sum over allocs and reallocs.                */
+    size max_bytes;            /* Biggest single alloc or realloc.             */
+} CoyAllocTraceSite;
+
+typedef struct
+{
+    CoyAllocTraceSite *sites;  /* Sorted by bytes_requested, biggest first.    */
+    size num_sites;
+    u64 num_records;
+    u32 num_threads;
+    u64 first_timestamp;
+    u64 last_timestamp;
+    b32 valid;
+} CoyAllocTraceSummary;
+
+static inline CoyAllocTraceSummary coy_alloc_trace_summarize(char const *filename, MagAllocator *alloc); /* Lives in alloc. */
+static inline b32 coy_alloc_trace_summary_write(CoyAllocTraceSummary const *summary, size max_sites, CoyFileWriter *out);
 /*---------------------------------------------------------------------------------------------------------------------------
  *
  *
@@ -1110,7 +1292,7 @@ coy_file_slurp(char const *filename, byte **out, MagAllocator *alloc)
     size fsize = coy_file_size(filename);
     StopIf(fsize < 0, goto ERR_RETURN);
 
-    *out = mag_allocator_nmalloc(alloc, fsize, byte);
+    *out = mag_allocator_nmalloc_uninit(alloc, fsize, byte);
     StopIf(!*out, goto ERR_RETURN);
 
     size size_read = coy_file_slurp_internal(filename, fsize, *out);
@@ -1129,7 +1311,7 @@ coy_file_slurp_text_static(char const *filename, MagStaticArena *arena)
     size fsize = coy_file_size(filename);
     StopIf(fsize < 0, goto ERR_RETURN);
 
-    byte *out = mag_static_arena_nmalloc(arena, fsize, byte);
+    byte *out = mag_static_arena_nmalloc_uninit(arena, fsize, byte);
     StopIf(!out, goto ERR_RETURN);
 
     size size_read = coy_file_slurp_internal(filename, fsize, out);
@@ -1147,7 +1329,7 @@ coy_file_slurp_text_dyn(char const *filename, MagDynArena *arena)
     size fsize = coy_file_size(filename);
     StopIf(fsize < 0, goto ERR_RETURN);
 
-    byte *out = mag_dyn_arena_nmalloc(arena, fsize, byte);
+    byte *out = mag_dyn_arena_nmalloc_uninit(arena, fsize, byte);
     StopIf(!out, goto ERR_RETURN);
 
     size size_read = coy_file_slurp_internal(filename, fsize, out);
@@ -1165,7 +1347,7 @@ coy_file_slurp_text_allocator(char const *filename, MagAllocator *alloc)
     size fsize = coy_file_size(filename);
     StopIf(fsize < 0, goto ERR_RETURN);
 
-    byte *out = mag_allocator_nmalloc(alloc, fsize, byte);
+    byte *out = mag_allocator_nmalloc_uninit(alloc, fsize, byte);
     StopIf(!out, goto ERR_RETURN);
 
     size size_read = coy_file_slurp_internal(filename, fsize, out);
@@ -1212,9 +1394,13 @@ coy_future_is_consumed(CoyFuture *fut)
 }
 
 static inline void 
-coy_thread_pool_executor_internal(void *input_channel)
+coy_thread_pool_executor_internal(void *worker_data)
 {
-    CoyChannel *tasks = input_channel;
+    CoyThreadPoolWorker *worker = worker_data;
+    mag_scratch_set_bind(&worker->scratch);
+    coy_threadpool_thread_worker_index = worker->index;
+
+    CoyChannel *tasks = worker->queue;
     coy_channel_wait_until_ready_to_receive(tasks);
 
     void *void_task;
@@ -1228,6 +1414,8 @@ coy_thread_pool_executor_internal(void *input_channel)
     }
 
     coy_channel_done_receiving(tasks);
+    mag_scratch_set_bind(NULL);
+    coy_threadpool_thread_worker_index = -1;
 }
 
 static inline void 
@@ -1241,7 +1429,10 @@ coy_threadpool_initialize(CoyThreadPool *pool, size nthreads)
 
     for(size i = 0; i < nthreads; ++i)
     {
-        coy_thread_create(&pool->threads[i], coy_thread_pool_executor_internal, &pool->queue);
+        pool->workers[i].queue = &pool->queue;
+        pool->workers[i].scratch = mag_scratch_set_create(COY_THREAD_POOL_SCRATCH_BLOCK_SIZE);
+        pool->workers[i].index = i;
+        coy_thread_create(&pool->threads[i], coy_thread_pool_executor_internal, &pool->workers[i]);
         coy_channel_register_receiver(&pool->queue);
     }
     coy_channel_wait_until_ready_to_send(&pool->queue);
@@ -1255,6 +1446,7 @@ coy_threadpool_destroy(CoyThreadPool *pool)
     {
         coy_thread_join(&pool->threads[i]);
         coy_thread_destroy(&pool->threads[i]);
+        mag_scratch_set_destroy(&pool->workers[i].scratch);
     }
     coy_channel_destroy(&pool->queue, NULL, NULL);
     memset(pool, 0, sizeof(*pool));
@@ -1267,6 +1459,12 @@ coy_threadpool_submit(CoyThreadPool *pool, CoyFuture *fut)
     coy_channel_send(&pool->queue, fut);
 }
 
+static inline size
+coy_threadpool_worker_index(void)
+{
+    return coy_threadpool_thread_worker_index;
+}
+
 static inline void 
 coy_batch_completion_init(CoyBatchCompletion *bc, CoyThreadPool *pool)
 {
@@ -1315,6 +1513,543 @@ coy_batch_completion_wait(CoyBatchCompletion *bc)
     coy_mutex_unlock(&bc->mutex);
 }
 
+static inline CoyAllocTrace
+coy_alloc_trace_create(char const *filename)
+{
+    CoyAllocTrace trace = { .file = coy_file_create(filename), .mutex = coy_mutex_create() };
+    trace.valid = trace.file.valid && trace.mutex.valid;
+
+    CoyAllocTraceFileHeader const header =
+        { 
+            .magic = COY_ALLOC_TRACE_MAGIC,
+            .version = 1,
+            .record_size = sizeof(CoyAllocTraceRecord)
+        };
+
+    if(trace.valid) { trace.valid = coy_file_write(&trace.file, sizeof(header), (byte const *)&header) == sizeof(header); }
+    return trace;
+}
+
+static inline b32
+coy_alloc_trace_destroy(CoyAllocTrace *trace)
+{
+    b32 valid = trace->valid;
+    if(trace->file.valid)
+    {
+        valid = coy_file_writer_flush(&trace->file) >= 0 && valid;
+        coy_file_writer_close(&trace->file);
+    }
+
+    if(trace->mutex.valid) { coy_mutex_destroy(&trace->mutex); }
+    trace->valid = false;
+    return valid;
+}
+
+static inline void
+coy_alloc_trace_hook_internal(MagTraceEvent const *event, void *user_data)
+{
+    CoyAllocTraceBuffer *buf = user_data;
+    if(buf->len == COY_ALLOC_TRACE_BUFFER_LEN) { coy_alloc_trace_flush(buf); }
+
+    buf->files[buf->len] = event->file;
+    buf->records[buf->len++] = (CoyAllocTraceRecord)
+        {
+            .timestamp = coy_profile_read_cpu_timer(),
+            .allocator = (uptr)event->allocator,
+            .ptr = (uptr)event->ptr,
+            .old_ptr = (uptr)event->old_ptr,
+            .num_bytes = event->num_bytes,
+            .alignment = event->alignment,
+            .line = event->line,
+            .thread_id = buf->thread_id,
+            .op = (u8)event->op,
+            .allocator_type = (u8)event->allocator_type
+        };
+}
+
+static inline void
+coy_alloc_trace_start(CoyAllocTrace *trace, CoyAllocTraceBuffer *buf)
+{
+    coy_mutex_lock(&trace->mutex);
+    buf->thread_id = ++trace->num_threads;
+    coy_mutex_unlock(&trace->mutex);
+
+    buf->trace = trace;
+    buf->len = 0;
+    mag_trace_set_hook(coy_alloc_trace_hook_internal, buf);
+}
+
+/* Call with the mutex held. Writes out the name the first time a file is seen. */
+static inline u32
+coy_alloc_trace_file_id_internal(CoyAllocTrace *trace, char const *file)
+{
+    if(!file) { return 0; }
+
+    /* Each translation unit has its own copy of __FILE__, so compare names too. */
+    for(i32 i = 0; i < trace->num_file_names; ++i)
+    {
+        if(trace->file_names[i] == file || coy_null_term_strings_equal(trace->file_names[i], file)) { return (u32)i + 1; }
+    }
+
+    StopIf(trace->num_file_names == COY_ALLOC_TRACE_MAX_FILES, return 0);
+
+    trace->file_names[trace->num_file_names++] = file;
+    u32 const id = (u32)trace->num_file_names;
+    ElkStr const name = elk_str_from_cstring((char *)file);
+
+    b32 written = coy_file_write_u32(&trace->file, COY_ALLOC_TRACE_TAG_FILE);
+    written = written && coy_file_write_u32(&trace->file, id);
+    written = written && coy_file_write_u32(&trace->file, (u32)name.len);
+    written = written && coy_file_write(&trace->file, name.len, (byte const *)name.start) == name.len;
+    trace->valid = trace->valid && written;
+
+    return id;
+}
+
+static inline void
+coy_alloc_trace_flush(CoyAllocTraceBuffer *buf)
+{
+    StopIf(buf->len == 0, return);
+
+    CoyAllocTrace *trace = buf->trace;
+    coy_mutex_lock(&trace->mutex);
+
+    for(i32 i = 0; i < buf->len; ++i) { buf->records[i].file_id = coy_alloc_trace_file_id_internal(trace, buf->files[i]); }
+
+    size const num_bytes = buf->len * sizeof(buf->records[0]);
+    b32 written = coy_file_write_u32(&trace->file, COY_ALLOC_TRACE_TAG_RECORDS);
+    written = written && coy_file_write_u32(&trace->file, (u32)buf->len);
+    written = written && coy_file_write(&trace->file, num_bytes, (byte const *)buf->records) == num_bytes;
+    trace->valid = trace->valid && written;
+
+    coy_mutex_unlock(&trace->mutex);
+    buf->len = 0;
+}
+
+static inline void
+coy_alloc_trace_stop(CoyAllocTraceBuffer *buf)
+{
+    mag_trace_set_hook(NULL, NULL);
+    coy_alloc_trace_flush(buf);
+}
+
+static inline u64
+coy_alloc_trace_site_hash_internal(u32 file_id, i32 line)
+{
+    u64 const key = ((u64)file_id << 32) | (u32)line;
+    u64 const hash = key * UINT64_C(0x9E3779B97F4A7C15);
+    return hash ^ (hash >> 29);
+}
+
+static inline CoyAllocTraceSummary
+coy_alloc_trace_summarize(char const *filename, MagAllocator *alloc)
+{
+    CoyAllocTraceSummary summary = {0};
+
+    byte *log = NULL;
+    size const log_size = coy_file_slurp(filename, &log, alloc);
+    StopIf(log_size < (size)sizeof(CoyAllocTraceFileHeader), return summary);
+
+    CoyAllocTraceFileHeader header = {0};
+    memcpy(&header, log, sizeof(header));
+    StopIf(header.magic != COY_ALLOC_TRACE_MAGIC || header.record_size != sizeof(CoyAllocTraceRecord), return summary);
+
+    ElkStr file_names[COY_ALLOC_TRACE_MAX_FILES + 1] = {0};
+
+    /* Sites are found through an open addressing table of indexes into the sites array, both grow as needed. */
+    size capacity = 64;
+    CoyAllocTraceSite *sites = mag_allocator_nmalloc(alloc, capacity, CoyAllocTraceSite);
+    u32 *site_file_ids = mag_allocator_nmalloc(alloc, capacity, u32);
+    i32 *table = mag_allocator_nmalloc_uninit(alloc, 2 * capacity, i32);
+    StopIf(!sites || !site_file_ids || !table, return summary);
+    memset(table, 0xFF, 2 * capacity * sizeof(*table));
+
+    summary.first_timestamp = UINT64_MAX;
+
+    size pos = sizeof(header);
+    while(pos + (size)sizeof(u32) <= log_size)
+    {
+        u32 tag = 0;
+        u32 count = 0;
+        memcpy(&tag, log + pos, sizeof(tag));
+        StopIf(pos + 2 * (size)sizeof(u32) > log_size, return summary);
+        memcpy(&count, log + pos + sizeof(tag), sizeof(count));
+        pos += 2 * sizeof(u32);
+
+        if(tag == COY_ALLOC_TRACE_TAG_FILE)
+        {
+            u32 len = 0;
+            StopIf(pos + (size)sizeof(len) > log_size, return summary);
+            memcpy(&len, log + pos, sizeof(len));
+            pos += sizeof(len);
+            StopIf(pos + len > log_size || count == 0 || count > COY_ALLOC_TRACE_MAX_FILES, return summary);
+
+            file_names[count] = (ElkStr){ .start = (char *)log + pos, .len = len };
+            pos += len;
+            continue;
+        }
+
+        StopIf(tag != COY_ALLOC_TRACE_TAG_RECORDS || pos + count * (size)sizeof(CoyAllocTraceRecord) > log_size, return summary);
+
+        for(u32 r = 0; r < count; ++r, pos += sizeof(CoyAllocTraceRecord))
+        {
+            CoyAllocTraceRecord rec = {0};
+            memcpy(&rec, log + pos, sizeof(rec));
+            StopIf(rec.file_id > COY_ALLOC_TRACE_MAX_FILES, return summary);
+
+            summary.num_records++;
+            summary.num_threads = rec.thread_id > summary.num_threads ? rec.thread_id : summary.num_threads;
+            summary.first_timestamp = rec.timestamp < summary.first_timestamp ? rec.timestamp : summary.first_timestamp;
+            summary.last_timestamp = rec.timestamp > summary.last_timestamp ? rec.timestamp : summary.last_timestamp;
+
+            /* Grow and rehash when the table gets half full. */
+            if(summary.num_sites == capacity)
+            {
+                size const new_capacity = 2 * capacity;
+                sites = mag_allocator_nrealloc(alloc, sites, new_capacity, CoyAllocTraceSite);
+                site_file_ids = mag_allocator_nrealloc(alloc, site_file_ids, new_capacity, u32);
+                table = mag_allocator_nmalloc_uninit(alloc, 2 * new_capacity, i32);
+                StopIf(!sites || !site_file_ids || !table, return summary);
+                memset(table, 0xFF, 2 * new_capacity * sizeof(*table));
+
+                capacity = new_capacity;
+                for(i32 i = 0; i < summary.num_sites; ++i)
+                {
+                    size slot = coy_alloc_trace_site_hash_internal(site_file_ids[i], sites[i].line) & (2 * capacity - 1);
+                    while(table[slot] >= 0) { slot = (slot + 1) & (2 * capacity - 1); }
+                    table[slot] = i;
+                }
+            }
+
+            size slot = coy_alloc_trace_site_hash_internal(rec.file_id, rec.line) & (2 * capacity - 1);
+            while(table[slot] >= 0 && (site_file_ids[table[slot]] != rec.file_id || sites[table[slot]].line != rec.line))
+            {
+                slot = (slot + 1) & (2 * capacity - 1);
+            }
+
+            if(table[slot] < 0)
+            {
+                table[slot] = (i32)summary.num_sites;
+                site_file_ids[summary.num_sites] = rec.file_id;
+                sites[summary.num_sites++] = (CoyAllocTraceSite){ .line = rec.line };
+            }
+
+            CoyAllocTraceSite *site = &sites[table[slot]];
+            switch(rec.op)
+            {
+                case MAG_TRACE_ALLOC:   site->num_allocs++;   break;
+                case MAG_TRACE_REALLOC: site->num_reallocs++; break;
+                case MAG_TRACE_FREE:    site->num_frees++;    break;
+                case MAG_TRACE_RESET:   site->num_resets++;   break;
+                default: { StopIf(true, return summary); }
+            }
+
+            if(rec.op == MAG_TRACE_ALLOC || rec.op == MAG_TRACE_REALLOC)
+            {
+                site->num_failures += rec.ptr == 0;
+                site->num_realloc_moves += rec.op == MAG_TRACE_REALLOC && rec.ptr && rec.ptr != rec.old_ptr;
+                site->bytes_requested += rec.num_bytes;
+                site->max_bytes = rec.num_bytes > site->max_bytes ? rec.num_bytes : site->max_bytes;
+            }
+        }
+    }
+
+    for(i32 i = 0; i < summary.num_sites; ++i) { sites[i].file = file_names[site_file_ids[i]]; }
+
+    /* Insertion sort, there are seldom more than a few hundred sites. */
+    for(i32 i = 1; i < summary.num_sites; ++i)
+    {
+        CoyAllocTraceSite const site = sites[i];
+        i32 j = i - 1;
+        while(j >= 0 && sites[j].bytes_requested < site.bytes_requested) { sites[j + 1] = sites[j]; --j; }
+        sites[j + 1] = site;
+    }
+
+    summary.first_timestamp = summary.num_records ? summary.first_timestamp : 0;
+    summary.sites = sites;
+    summary.valid = true;
+    return summary;
+}
+
+/* Writes the line and empties the builder for the next one. */
+static inline b32
+coy_alloc_trace_write_line_internal(MagStrBuilder *builder, CoyFileWriter *out)
+{
+    mag_str_builder_append_char(builder, '\n');
+    StopIf(builder->failed, return false);
+    size const len = builder->len;
+    size const written = coy_file_write(out, len, (byte const *)builder->buf);
+    mag_str_builder_reset(builder);
+    return written == len;
+}
+
+static inline b32
+coy_alloc_trace_summary_write(CoyAllocTraceSummary const *summary, size max_sites, CoyFileWriter *out)
+{
+    _Alignas(16) byte line_buffer[512];
+    MagStaticArena arena_instance = mag_static_arena_create(sizeof(line_buffer), line_buffer);
+    MagStrBuilder builder = mag_str_builder_create_static(&arena_instance, sizeof(line_buffer) - 1);
+
+    mag_str_builder_append_cstr(&builder, "Records: ");
+    mag_str_builder_append_u64(&builder, summary->num_records);
+    mag_str_builder_append_cstr(&builder, " Threads: ");
+    mag_str_builder_append_u64(&builder, summary->num_threads);
+    mag_str_builder_append_cstr(&builder, " Sites: ");
+    mag_str_builder_append_i64(&builder, summary->num_sites);
+    mag_str_builder_append_cstr(&builder, " Ticks: ");
+    mag_str_builder_append_u64(&builder, summary->last_timestamp - summary->first_timestamp);
+    StopIf(!coy_alloc_trace_write_line_internal(&builder, out), return false);
+
+    for(i32 i = 0; i < summary->num_sites && i < max_sites; ++i)
+    {
+        CoyAllocTraceSite const *site = &summary->sites[i];
+        u64 const num_sized = site->num_allocs + site->num_reallocs;
+
+        if(site->file.len)
+        {
+            mag_str_builder_append(&builder, site->file);
+            mag_str_builder_append_char(&builder, ':');
+            mag_str_builder_append_i64(&builder, site->line);
+        }
+        else { mag_str_builder_append_cstr(&builder, "(unknown)"); }
+
+        mag_str_builder_append_cstr(&builder, " allocs: ");
+        mag_str_builder_append_u64(&builder, site->num_allocs);
+        mag_str_builder_append_cstr(&builder, " reallocs: ");
+        mag_str_builder_append_u64(&builder, site->num_reallocs);
+        mag_str_builder_append_cstr(&builder, " (moved ");
+        mag_str_builder_append_u64(&builder, site->num_realloc_moves);
+        mag_str_builder_append_cstr(&builder, ") frees: ");
+        mag_str_builder_append_u64(&builder, site->num_frees);
+        mag_str_builder_append_cstr(&builder, " resets: ");
+        mag_str_builder_append_u64(&builder, site->num_resets);
+        mag_str_builder_append_cstr(&builder, " failed: ");
+        mag_str_builder_append_u64(&builder, site->num_failures);
+        mag_str_builder_append_cstr(&builder, " bytes: ");
+        mag_str_builder_append_u64(&builder, site->bytes_requested);
+        mag_str_builder_append_cstr(&builder, " avg: ");
+        mag_str_builder_append_u64(&builder, num_sized ? site->bytes_requested / num_sized : 0);
+        mag_str_builder_append_cstr(&builder, " max: ");
+        mag_str_builder_append_i64(&builder, site->max_bytes);
+        StopIf(!coy_alloc_trace_write_line_internal(&builder, out), return false);
+    }
+
+    return true;
+}
+
+/* Platform specific parts of the async file reader. The io_uring ones only do something on Linux. */
+static inline iptr coy_file_open_read_handle_internal(char const *filename);                          /* -1 on error */
+static inline void coy_file_close_handle_internal(iptr handle);
+static inline size coy_file_read_at_internal(iptr handle, size offset, size num_bytes, byte *buffer); /* -1 on error */
+static inline b32 coy_async_file_reader_uring_start_internal(CoyAsyncFileReaderState *state);
+static inline void coy_async_file_reader_uring_submit_internal(CoyAsyncFileReaderState *state); /* Up to read_limit.    */
+static inline void coy_async_file_reader_uring_wait_internal(CoyAsyncFileReaderState *state);   /* For one completion.  */
+static inline b32 coy_async_file_reader_uring_stop_internal(CoyAsyncFileReaderState *state);    /* Drains, or false.    */
+
+static inline size
+coy_async_file_reader_num_chunks_internal(CoyAsyncFileReaderState const *state)
+{
+    return (state->file_size + state->buf_size - 1) / state->buf_size;
+}
+
+static inline size
+coy_async_file_reader_chunk_len_internal(CoyAsyncFileReaderState const *state, size chunk)
+{
+    size const remaining = state->file_size - chunk * state->buf_size;
+    return remaining < state->buf_size ? remaining : state->buf_size;
+}
+
+static inline void
+coy_async_file_reader_thread_internal(void *thread_data)
+{
+    CoyAsyncFileReaderState *state = thread_data;
+    size const num_chunks = coy_async_file_reader_num_chunks_internal(state);
+
+    coy_mutex_lock(&state->mutex);
+    while(true)
+    {
+        while(!state->stop && (state->next_read >= state->read_limit || state->next_read >= num_chunks))
+        {
+            coy_condvar_sleep(&state->cond, &state->mutex);
+        }
+
+        if(state->stop) { break; }
+
+        /* The buffer belongs to this thread until it's marked done, so read without the lock. */
+        size const chunk = state->next_read++;
+        i32 const buf = (i32)(chunk % state->num_buffers);
+        coy_mutex_unlock(&state->mutex);
+
+        size const num_bytes_read = coy_file_read_at_internal(
+                state->handle,
+                chunk * state->buf_size,
+                coy_async_file_reader_chunk_len_internal(state, chunk),
+                state->buffers + buf * state->buf_size);
+
+        coy_mutex_lock(&state->mutex);
+        state->lens[buf] = num_bytes_read < 0 ? 0 : num_bytes_read;
+        state->failed |= num_bytes_read < 0;
+        state->done[buf] = true;
+        coy_condvar_wake_all(&state->cond);
+    }
+    coy_mutex_unlock(&state->mutex);
+}
+
+static inline b32
+coy_async_file_reader_thread_start_internal(CoyAsyncFileReaderState *state)
+{
+    state->mutex = coy_mutex_create();
+    state->cond = coy_condvar_create();
+    StopIf(!state->mutex.valid || !state->cond.valid, goto ERR_RETURN);
+    StopIf(!coy_thread_create(&state->thread, coy_async_file_reader_thread_internal, state), goto ERR_RETURN);
+
+    return true;
+
+ERR_RETURN:
+    if(state->mutex.valid) { coy_mutex_destroy(&state->mutex); }
+    if(state->cond.valid) { coy_condvar_destroy(&state->cond); }
+    return false;
+}
+
+static inline CoyAsyncFileReader
+coy_async_file_reader_open(char const *filename, size buf_size, i32 num_buffers, CoyAsyncReadBackend backend)
+{
+    iptr handle = -1;
+    MagMemoryBlock mem = {0};
+
+    size const page_size = mag_sys_memory_page_size();
+    buf_size = buf_size > 0 ? buf_size : ECO_MiB(1);
+    buf_size = ((buf_size + page_size - 1) / page_size) * page_size;
+    num_buffers = num_buffers > 0 ? num_buffers : 4;
+    num_buffers = num_buffers < 2 ? 2 : num_buffers;
+    num_buffers = num_buffers > COY_ASYNC_FILE_READER_MAX_BUFFERS ? COY_ASYNC_FILE_READER_MAX_BUFFERS : num_buffers;
+
+    size const file_size = coy_file_size(filename);
+    StopIf(file_size < 0, goto ERR_RETURN);
+    handle = coy_file_open_read_handle_internal(filename);
+    StopIf(handle == -1, goto ERR_RETURN);
+
+    /* The buffers start on a page boundary after the state. */
+    size const state_size = ((sizeof(CoyAsyncFileReaderState) + page_size - 1) / page_size) * page_size;
+    mem = mag_sys_memory_allocate(state_size + num_buffers * buf_size);
+    StopIf(!MAG_MEM_IS_VALID(mem), goto ERR_RETURN);
+
+    CoyAsyncFileReaderState *state = (CoyAsyncFileReaderState *)mem.mem;
+    *state = (CoyAsyncFileReaderState)
+        {
+            .handle = handle,
+            .file_size = file_size,
+            .buf_size = buf_size,
+            .num_buffers = num_buffers,
+            .buffers = mem.mem + state_size,
+            .read_limit = num_buffers,
+        };
+
+    CoyAsyncFileReader reader = { .mem = mem, .valid = true };
+    if(backend != COY_ASYNC_READ_THREAD && coy_async_file_reader_uring_start_internal(state))
+    {
+        reader.backend = COY_ASYNC_READ_IO_URING;
+        coy_async_file_reader_uring_submit_internal(state);
+    }
+    else
+    {
+        StopIf(backend == COY_ASYNC_READ_IO_URING, goto ERR_RETURN);
+        StopIf(!coy_async_file_reader_thread_start_internal(state), goto ERR_RETURN);
+        reader.backend = COY_ASYNC_READ_THREAD;
+    }
+
+    return reader;
+
+ERR_RETURN:
+    if(handle != -1) { coy_file_close_handle_internal(handle); }
+    mag_sys_memory_free(&mem);
+    return (CoyAsyncFileReader){0};
+}
+
+static inline ElkStr
+coy_async_file_reader_next(CoyAsyncFileReader *reader)
+{
+    StopIf(!reader->valid, goto ERR_RETURN);
+
+    CoyAsyncFileReaderState *state = (CoyAsyncFileReaderState *)reader->mem.mem;
+    b32 const uring = reader->backend == COY_ASYNC_READ_IO_URING;
+    if(!uring) { coy_mutex_lock(&state->mutex); }
+
+    /* Hand back the last chunk's buffer, that makes room for one more read. */
+    if(state->holding)
+    {
+        i32 const held = (i32)((state->next_chunk - 1) % state->num_buffers);
+        state->done[held] = false;
+        state->lens[held] = 0;
+        state->holding = false;
+    }
+    state->read_limit = state->next_chunk + state->num_buffers;
+
+    ElkStr chunk = {0};
+    if(state->next_chunk < coy_async_file_reader_num_chunks_internal(state))
+    {
+        i32 const buf = (i32)(state->next_chunk % state->num_buffers);
+        if(uring)
+        {
+            coy_async_file_reader_uring_submit_internal(state);
+            while(!state->done[buf] && !state->failed) { coy_async_file_reader_uring_wait_internal(state); }
+        }
+        else
+        {
+            coy_condvar_wake_all(&state->cond);
+            while(!state->done[buf] && !state->failed) { coy_condvar_sleep(&state->cond, &state->mutex); }
+        }
+
+        if(!state->failed)
+        {
+            chunk = (ElkStr){ .start = (char *)(state->buffers + buf * state->buf_size), .len = state->lens[buf] };
+            state->holding = true;
+            state->next_chunk += 1;
+        }
+    }
+
+    reader->valid = !state->failed;
+    if(!uring) { coy_mutex_unlock(&state->mutex); }
+
+    return chunk;
+
+ERR_RETURN:
+    return (ElkStr){0};
+}
+
+static inline void
+coy_async_file_reader_close(CoyAsyncFileReader *reader)
+{
+    if(MAG_MEM_IS_VALID(reader->mem))
+    {
+        CoyAsyncFileReaderState *state = (CoyAsyncFileReaderState *)reader->mem.mem;
+        b32 drained = true;
+        if(reader->backend == COY_ASYNC_READ_IO_URING)
+        {
+            drained = coy_async_file_reader_uring_stop_internal(state);
+        }
+        else
+        {
+            coy_mutex_lock(&state->mutex);
+            state->stop = true;
+            coy_condvar_wake_all(&state->cond);
+            coy_mutex_unlock(&state->mutex);
+
+            coy_thread_join(&state->thread);
+            coy_thread_destroy(&state->thread);
+            coy_mutex_destroy(&state->mutex);
+            coy_condvar_destroy(&state->cond);
+        }
+
+        coy_file_close_handle_internal(state->handle);
+
+        /* Leaked on purpose if the kernel might still write into the buffers. */
+        if(drained) { mag_sys_memory_free(&reader->mem); }
+    }
+
+    memset(reader, 0, sizeof(*reader));
+}
+
 #if defined(_WIN32) || defined(_WIN64)
 
 #pragma warning(disable: 4142)
@@ -42,4 +42,30 @@ coy_profile_read_os_page_fault_count(void)
     return (u64)(usage.ru_minflt + usage.ru_majflt);
 }
 
+/* No io_uring here, CoyAsyncFileReader always uses its reader thread. */
+static inline b32
+coy_async_file_reader_uring_start_internal(CoyAsyncFileReaderState *state)
+{
+    return false;
+}
+
+static inline void
+coy_async_file_reader_uring_submit_internal(CoyAsyncFileReaderState *state)
+{
+    /* Never started. */
+}
+
+static inline void
+coy_async_file_reader_uring_wait_internal(CoyAsyncFileReaderState *state)
+{
+    /* Never started. */
+}
+
+static inline b32
+coy_async_file_reader_uring_stop_internal(CoyAsyncFileReaderState *state)
+{
+    /* Never started. */
+    return true;
+}
+
 #endif
@@ -4,8 +4,10 @@
  *                                                  Linux Implementation
  *-------------------------------------------------------------------------------------------------------------------------*/
 // Linux specific implementation goes here - things NOT in common with Apple / BSD
+#include <errno.h>
 #include <fcntl.h>
 #include <linux/perf_event.h>
+#include <stdatomic.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <sys/syscall.h>
@@ -15,6 +17,19 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+/* Old kernel headers don't have io_uring, then CoyAsyncFileReader always uses its reader thread. */
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+
+#if defined(IORING_OFF_SQES) && defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define COY_HAS_IO_URING 1
+#else
+#define COY_HAS_IO_URING 0
+#endif
+
 static inline i32 
 coy_cpu_count(void)
 {
@@ -67,4 +82,231 @@ coy_profile_read_os_page_fault_count(void)
     return count;
 }
 
+#if COY_HAS_IO_URING
+
+/* The io_uring side of CoyAsyncFileReader. No liburing, it's only a few syscalls and the rings are shared memory. */
+typedef struct
+{
+    int fd;
+    void *ring;                   /* The submission and completion rings share one mapping. */
+    size ring_size;
+    struct io_uring_sqe *sqes;
+    size sqes_size;
+    u32 *sq_head;
+    u32 *sq_tail;
+    u32 *sq_mask;
+    u32 *sq_array;
+    u32 *cq_head;
+    u32 *cq_tail;
+    u32 *cq_mask;
+    struct io_uring_cqe *cqes;
+    u32 num_unsubmitted;          /* In the ring, but the kernel hasn't been told yet.      */
+    i32 num_in_flight;            /* Submitted or waiting to be, not completed.             */
+} CoyIoUring;
+
+static inline CoyIoUring *
+coy_io_uring_internal(CoyAsyncFileReaderState *state)
+{
+    _Static_assert(sizeof(CoyIoUring) <= sizeof(state->io_uring), "CoyAsyncFileReaderState.io_uring is too small.");
+    return (CoyIoUring *)state->io_uring;
+}
+
+static inline b32
+coy_async_file_reader_uring_start_internal(CoyAsyncFileReaderState *state)
+{
+    CoyIoUring *ring = coy_io_uring_internal(state);
+    memset(ring, 0, sizeof(*ring));
+
+    /* Never more reads in flight than buffers, so the rings can't overflow. */
+    struct io_uring_params params = {0};
+    ring->fd = (int)syscall(__NR_io_uring_setup, (unsigned)state->num_buffers, &params);
+    StopIf(ring->fd < 0, goto ERR_RETURN);
+
+    /* IORING_OP_READ came with 5.6, and so did this flag. Single mmap is older than both. */
+    StopIf(!(params.features & IORING_FEAT_RW_CUR_POS) || !(params.features & IORING_FEAT_SINGLE_MMAP), goto CLOSE_AND_ERR);
+
+    size const sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(u32);
+    size const cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->ring_size = sq_ring_size > cq_ring_size ? sq_ring_size : cq_ring_size;
+    ring->ring = mmap(NULL, ring->ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    StopIf(ring->ring == MAP_FAILED, goto CLOSE_AND_ERR);
+
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    StopIf(ring->sqes == MAP_FAILED, goto UNMAP_AND_ERR);
+
+    byte *base = ring->ring;
+    ring->sq_head = (u32 *)(base + params.sq_off.head);
+    ring->sq_tail = (u32 *)(base + params.sq_off.tail);
+    ring->sq_mask = (u32 *)(base + params.sq_off.ring_mask);
+    ring->sq_array = (u32 *)(base + params.sq_off.array);
+    ring->cq_head = (u32 *)(base + params.cq_off.head);
+    ring->cq_tail = (u32 *)(base + params.cq_off.tail);
+    ring->cq_mask = (u32 *)(base + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(base + params.cq_off.cqes);
+
+    return true;
+
+UNMAP_AND_ERR:
+    munmap(ring->ring, ring->ring_size);
+CLOSE_AND_ERR:
+    close(ring->fd);
+ERR_RETURN:
+    return false;
+}
+
+/* Queue a read of whatever is still missing from a chunk, the kernel finds out on the next enter. */
+static inline void
+coy_async_file_reader_uring_queue_internal(CoyAsyncFileReaderState *state, size chunk)
+{
+    CoyIoUring *ring = coy_io_uring_internal(state);
+    i32 const buf = (i32)(chunk % state->num_buffers);
+    size const num_bytes = coy_async_file_reader_chunk_len_internal(state, chunk) - state->lens[buf];
+
+    /* Only this thread writes the tail, the kernel only reads it. */
+    u32 const tail = *ring->sq_tail;
+    u32 const index = tail & *ring->sq_mask;
+
+    struct io_uring_sqe *sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = (i32)state->handle;
+    sqe->off = (u64)(chunk * state->buf_size + state->lens[buf]);
+    sqe->addr = (u64)(uptr)(state->buffers + buf * state->buf_size + state->lens[buf]);
+    sqe->len = (u32)num_bytes;
+    sqe->user_data = (u64)chunk;
+
+    ring->sq_array[index] = index;
+    atomic_store_explicit((_Atomic u32 *)ring->sq_tail, tail + 1, memory_order_release);
+
+    ring->num_unsubmitted += 1;
+    ring->num_in_flight += 1;
+}
+
+static inline b32
+coy_async_file_reader_uring_enter_internal(CoyAsyncFileReaderState *state, u32 min_complete)
+{
+    CoyIoUring *ring = coy_io_uring_internal(state);
+    u32 const flags = min_complete ? IORING_ENTER_GETEVENTS : 0;
+
+    long rc = syscall(__NR_io_uring_enter, ring->fd, ring->num_unsubmitted, min_complete, flags, NULL, 0);
+    if(rc >= 0) { ring->num_unsubmitted -= (u32)rc; }
+
+    /* Interrupted or short on kernel resources, try again on the next call. */
+    StopIf(rc < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY, goto ERR_RETURN);
+    return true;
+
+ERR_RETURN:
+    state->failed = true;
+    return false;
+}
+
+static inline void
+coy_async_file_reader_uring_submit_internal(CoyAsyncFileReaderState *state)
+{
+    size const num_chunks = coy_async_file_reader_num_chunks_internal(state);
+    while(state->next_read < state->read_limit && state->next_read < num_chunks)
+    {
+        coy_async_file_reader_uring_queue_internal(state, state->next_read);
+        state->next_read += 1;
+    }
+
+    if(coy_io_uring_internal(state)->num_unsubmitted) { coy_async_file_reader_uring_enter_internal(state, 0); }
+}
+
+static inline void
+coy_async_file_reader_uring_wait_internal(CoyAsyncFileReaderState *state)
+{
+    CoyIoUring *ring = coy_io_uring_internal(state);
+
+    u32 head = *ring->cq_head;
+    if(head == atomic_load_explicit((_Atomic u32 *)ring->cq_tail, memory_order_acquire))
+    {
+        StopIf(!coy_async_file_reader_uring_enter_internal(state, 1), return);
+    }
+
+    u32 const tail = atomic_load_explicit((_Atomic u32 *)ring->cq_tail, memory_order_acquire);
+    for(; head != tail; ++head)
+    {
+        struct io_uring_cqe const *cqe = &ring->cqes[head & *ring->cq_mask];
+        size const chunk = (size)cqe->user_data;
+        i32 const buf = (i32)(chunk % state->num_buffers);
+        ring->num_in_flight -= 1;
+
+        if(cqe->res < 0)
+        {
+            if(cqe->res == -EINTR || cqe->res == -EAGAIN) { coy_async_file_reader_uring_queue_internal(state, chunk); }
+            else { state->failed = true; }
+            continue;
+        }
+
+        /* Short reads happen, ask for the rest. Zero means the file got shorter since it was opened. */
+        state->lens[buf] += cqe->res;
+        if(cqe->res == 0 || state->lens[buf] == coy_async_file_reader_chunk_len_internal(state, chunk))
+        {
+            state->done[buf] = true;
+        }
+        else
+        {
+            coy_async_file_reader_uring_queue_internal(state, chunk);
+        }
+    }
+    atomic_store_explicit((_Atomic u32 *)ring->cq_head, head, memory_order_release);
+
+    if(ring->num_unsubmitted) { coy_async_file_reader_uring_enter_internal(state, 0); }
+}
+
+static inline b32
+coy_async_file_reader_uring_stop_internal(CoyAsyncFileReaderState *state)
+{
+    CoyIoUring *ring = coy_io_uring_internal(state);
+
+    /* The kernel may still be writing into the buffers, they can't be unmapped until it's done. */
+    while(ring->num_in_flight > 0)
+    {
+        b32 const empty = *ring->cq_head == atomic_load_explicit((_Atomic u32 *)ring->cq_tail, memory_order_acquire);
+        StopIf(empty && !coy_async_file_reader_uring_enter_internal(state, 1), break);
+        coy_async_file_reader_uring_wait_internal(state);
+    }
+
+    /* If entering failed, closing the ring cancels the reads the kernel has, but that finishes in the background. Only
+     * the ones it never saw are safe to forget, otherwise the buffers have to stay. */
+    b32 const drained = ring->num_in_flight == (i32)ring->num_unsubmitted;
+
+    munmap(ring->sqes, ring->sqes_size);
+    munmap(ring->ring, ring->ring_size);
+    close(ring->fd);
+
+    return drained;
+}
+
+#else
+
+static inline b32
+coy_async_file_reader_uring_start_internal(CoyAsyncFileReaderState *state)
+{
+    return false;
+}
+
+static inline void
+coy_async_file_reader_uring_submit_internal(CoyAsyncFileReaderState *state)
+{
+    /* Never started. */
+}
+
+static inline void
+coy_async_file_reader_uring_wait_internal(CoyAsyncFileReaderState *state)
+{
+    /* Never started. */
+}
+
+static inline b32
+coy_async_file_reader_uring_stop_internal(CoyAsyncFileReaderState *state)
+{
+    /* Never started. */
+    return true;
+}
+
+#endif
+
 #endif
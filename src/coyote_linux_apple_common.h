@@ -5,6 +5,7 @@
  *-------------------------------------------------------------------------------------------------------------------------*/
 
 #include <dirent.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <pthread.h>
 #include <sys/ioctl.h>
@@ -358,6 +359,43 @@ coy_file_reader_close(CoyFileReader *file)
     file->valid = false;
 }
 
+static inline iptr
+coy_file_open_read_handle_internal(char const *filename)
+{
+    int fd = open(filename, O_RDONLY, 0);
+    return fd >= 0 ? (iptr)fd : -1;
+}
+
+static inline void
+coy_file_close_handle_internal(iptr handle)
+{
+    close((int)handle);
+}
+
+static inline size
+coy_file_read_at_internal(iptr handle, size offset, size num_bytes, byte *buffer)
+{
+    size total_num_bytes_read = 0;
+    while(total_num_bytes_read < num_bytes)
+    {
+        ssize_t num_bytes_read = pread((int)handle,
+                                       buffer + total_num_bytes_read,
+                                       num_bytes - total_num_bytes_read,
+                                       offset + total_num_bytes_read);
+
+        if(num_bytes_read < 0 && errno == EINTR) { continue; }
+        StopIf(num_bytes_read < 0, goto ERR_RETURN);
+        if(num_bytes_read == 0) { break; }
+
+        total_num_bytes_read += num_bytes_read;
+    }
+
+    return total_num_bytes_read;
+
+ERR_RETURN:
+    return -1;
+}
+
 static inline size 
 coy_file_size(char const *filename)
 {
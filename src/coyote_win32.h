@@ -366,6 +366,57 @@ coy_file_reader_close(CoyFileReader *file)
     return;
 }
 
+static inline iptr
+coy_file_open_read_handle_internal(char const *filename)
+{
+    HANDLE fh = CreateFileA(filename,                  // [in]           LPCSTR                lpFileName,
+                            GENERIC_READ,              // [in]           DWORD                 dwDesiredAccess,
+                            FILE_SHARE_READ,           // [in]           DWORD                 dwShareMode,
+                            NULL,                      // [in, optional] LPSECURITY_ATTRIBUTES lpSecurityAttributes,
+                            OPEN_EXISTING,             // [in]           DWORD                 dwCreationDisposition,
+                            FILE_FLAG_SEQUENTIAL_SCAN, // [in]           DWORD                 dwFlagsAndAttributes,
+                            NULL);                     // [in, optional] HANDLE                hTemplateFile
+
+    return fh != INVALID_HANDLE_VALUE ? (iptr)fh : -1;
+}
+
+static inline void
+coy_file_close_handle_internal(iptr handle)
+{
+    CloseHandle((HANDLE)handle);
+}
+
+static inline size
+coy_file_read_at_internal(iptr handle, size offset, size num_bytes, byte *buffer)
+{
+    size total_num_bytes_read = 0;
+    while(total_num_bytes_read < num_bytes)
+    {
+        /* On a synchronous handle the OVERLAPPED only carries the offset. */
+        u64 const position = (u64)(offset + total_num_bytes_read);
+        OVERLAPPED overlapped = { .Offset = (DWORD)(position & 0xFFFFFFFF), .OffsetHigh = (DWORD)(position >> 32) };
+
+        size const remaining = num_bytes - total_num_bytes_read;
+        DWORD const to_read = (DWORD)(remaining > INT32_MAX ? INT32_MAX : remaining);
+        DWORD nbytes_read = 0;
+        BOOL success = ReadFile((HANDLE)handle,                // [in]                HANDLE       hFile,
+                                buffer + total_num_bytes_read, // [out]               LPVOID       lpBuffer,
+                                to_read,                       // [in]                DWORD        nNumberOfBytesToRead,
+                                &nbytes_read,                  // [out, optional]     LPDWORD      lpNumberOfBytesRead,
+                                &overlapped);                  // [in, out, optional] LPOVERLAPPED lpOverlapped
+
+        StopIf(!success && GetLastError() != ERROR_HANDLE_EOF, goto ERR_RETURN);
+        if(nbytes_read == 0) { break; }
+
+        total_num_bytes_read += nbytes_read;
+    }
+
+    return total_num_bytes_read;
+
+ERR_RETURN:
+    return -1;
+}
+
 static inline size 
 coy_file_slurp_internal(char const *filename, size buf_size, byte *buffer)
 {
@@ -887,4 +938,30 @@ coy_profile_read_os_timer(void)
     return value.QuadPart;
 }
 
+/* No io_uring here, CoyAsyncFileReader always uses its reader thread. */
+static inline b32
+coy_async_file_reader_uring_start_internal(CoyAsyncFileReaderState *state)
+{
+    return false;
+}
+
+static inline void
+coy_async_file_reader_uring_submit_internal(CoyAsyncFileReaderState *state)
+{
+    /* Never started. */
+}
+
+static inline void
+coy_async_file_reader_uring_wait_internal(CoyAsyncFileReaderState *state)
+{
+    /* Never started. */
+}
+
+static inline b32
+coy_async_file_reader_uring_stop_internal(CoyAsyncFileReaderState *state)
+{
+    /* Never started. */
+    return true;
+}
+
 #endif
@@ -430,6 +430,12 @@ static inline ElkStr elk_csv_simple_unquote_str(ElkStr str);
  *
  * Philox and Threefish were some of the original design ideas for the counter based PRNGs, but this one is based on an
  * algorithm by Bernard Widynski. The paper for the algorithm can be found at https://arxiv.org/abs/2004.06278.
+ *
+ * Since the output only depends on the key and the counter, jumping ahead is just an addition to the counter. For parallel
+ * work, split the problem into tasks (NOT threads) and give each task its own substream with elk_random_state_split() using
+ * the task index as the stream_id. The substream only depends on the parent state and the stream_id, so the results are bit
+ * identical no matter how many threads the tasks get spread over. Substreams get a key from the same table of vetted keys
+ * as elk_random_state_create() and a hashed starting counter, so overlapping sequences are vanishingly unlikely.
  */
 typedef struct
 {
@@ -438,9 +444,23 @@ typedef struct
 } ElkRandomState;
 
 static inline ElkRandomState elk_random_state_create(u64 seed);
+static inline ElkRandomState elk_random_state_split(ElkRandomState const *state, u64 stream_id); /* Parent is unchanged. */
+static inline void elk_random_state_skip(ElkRandomState *state, u64 n);                /* Same as n calls to uniform_u64.  */
 static inline u64 elk_random_state_uniform_u64(ElkRandomState *state);                 /* Includes the whole range of u64. */
 static inline f64 elk_random_state_uniform_f64(ElkRandomState *state);                 /* Random deviate in 0.-1.          */
 
+/* Unbiased random integers in [0, bound) using Daniel Lemire's nearly divisionless method, https://arxiv.org/abs/1805.10941.
+ * The slow path with the division is only taken with a probability of about bound / 2^64.
+ *
+ * The paired version gets two values from a single call to the generator, one in [0, bound0) and one in [0, bound1), which
+ * is useful for shuffling. It requires bound0 * bound1 to fit in a u64. See https://arxiv.org/abs/2408.06213.
+ */
+static inline u64 elk_random_state_uniform_bounded_u64(ElkRandomState *state, u64 bound);
+static inline void elk_random_state_uniform_bounded_pair_u64(ElkRandomState *state, u64 bound0, u64 bound1, u64 *out0, u64 *out1);
+
+/* The vectorized bounded integer generators are limited to 32 bit bounds since there is no 64 x 64 -> 128 bit multiply
+ * instruction for vectors. Each result is in the low half of a 64 bit lane.
+ */
 #if __AVX2__
 
 typedef struct
@@ -450,8 +470,11 @@ typedef struct
 } ElkAVX2RandomState;
 
 static inline ElkAVX2RandomState elk_avx2_random_state_create(u64 seed);
+static inline ElkAVX2RandomState elk_avx2_random_state_split(ElkRandomState const *state, u64 stream_id); /* 4 substreams */
+static inline void elk_avx2_random_state_skip(ElkAVX2RandomState *state, u64 n);       /* Skips n values in EVERY lane.    */
 static inline __m256i elk_avx2_random_state_uniform_u64(ElkAVX2RandomState *state);    /* Includes the whole range of u64. */
 static inline __m256d elk_avx2_random_state_uniform_f64(ElkAVX2RandomState *state);    /* Random deviate in 0.-1.          */
+static inline __m256i elk_avx2_random_state_uniform_bounded_u32(ElkAVX2RandomState *state, u32 bound); /* u64 lanes  */
 
 #endif
 
@@ -464,8 +487,11 @@ typedef struct
 } ElkAVX512RandomState;
 
 static inline ElkAVX512RandomState elk_avx512_random_state_create(u64 seed);
+static inline ElkAVX512RandomState elk_avx512_random_state_split(ElkRandomState const *state, u64 stream_id); /* 8 subs */
+static inline void elk_avx512_random_state_skip(ElkAVX512RandomState *state, u64 n);   /* Skips n values in EVERY lane.    */
 static inline __m512i elk_avx512_random_state_uniform_u64(ElkAVX512RandomState *state); /* Includes the whole range of u64.*/
 static inline __m512d elk_avx512_random_state_uniform_f64(ElkAVX512RandomState *state); /* Random deviate in 0.-1.         */
+static inline __m512i elk_avx512_random_state_uniform_bounded_u32(ElkAVX512RandomState *state, u32 bound); /* u64 lanes */
 
 #endif
 
@@ -479,7 +505,13 @@ static inline __m512d elk_avx512_random_state_uniform_f64(ElkAVX512RandomState *
 
 /* Kahan summation for more accurately adding floating point numbers.
  *
- * This accumulator is best just zero initialized.
+ * This accumulator is best just zero initialized. The err member accumulates the rounding error of all the additions, so the
+ * compensated total is sum - err, use elk_kahan_accumulator_result() to get it. Accumulators from different threads or 
+ * different chunks of an array can be combined with elk_kahan_accumulator_merge().
+ *
+ * The array functions use the widest vector accumulator available with several independent accumulators in flight to hide
+ * the latency of the additions, then reduce them all at the end. The strided version follows the pak_radix_sort convention,
+ * 'offset' is the offset in bytes into a structure where the f64 is and 'stride' is the size of the structure.
  */
 typedef struct
 {
@@ -488,6 +520,24 @@ typedef struct
 } ElkKahanAccumulator;
 
 static inline ElkKahanAccumulator elk_kahan_accumulator_add(ElkKahanAccumulator acc, f64 value);
+static inline ElkKahanAccumulator elk_kahan_accumulator_merge(ElkKahanAccumulator a, ElkKahanAccumulator b);
+static inline f64 elk_kahan_accumulator_result(ElkKahanAccumulator acc);
+
+static inline f64 elk_kahan_sum_f64(size n, f64 const *data);
+static inline f64 elk_kahan_sum_strided_f64(size n, void const *data, size offset, size stride);
+
+#if __AVX2__
+
+typedef struct
+{
+    __m256d sum;
+    __m256d err;
+} ElkAVX2KahanAccumulator;
+
+static inline ElkAVX2KahanAccumulator elk_avx2_kahan_accumulator_add(ElkAVX2KahanAccumulator acc, __m256d value);
+static inline ElkKahanAccumulator elk_avx2_kahan_accumulator_reduce(ElkAVX2KahanAccumulator acc);
+
+#endif
 
 #if ELK_AVX_512
 
@@ -498,9 +548,41 @@ typedef struct
 } ElkAVX512KahanAccumulator;
 
 static inline ElkAVX512KahanAccumulator elk_avx512_kahan_accumulator_add(ElkAVX512KahanAccumulator acc, __m512d value);
+static inline ElkKahanAccumulator elk_avx512_kahan_accumulator_reduce(ElkAVX512KahanAccumulator acc);
 
 #endif
 
+/* Single pass statistics.
+ *
+ * Count, NaN count, min, max, mean, and variance from one pass over the data. NaN values are counted in nan_count and
+ * otherwise ignored, so count is the number of non-NaN values and min/max are only meaningful when count > 0. The mean and
+ * m2 (sum of squared deviations from the mean) are updated with Welford's algorithm for single values, and the array 
+ * functions process the data in small blocks that are merged in with the parallel update of Chan et al., one set of
+ * statistics per vector lane. 
+ *
+ * This is best just zero initialized. Statistics computed on different threads or different chunks of an array are combined
+ * with elk_statistics_merge(). The strided versions follow the pak_radix_sort convention, 'offset' is the offset in bytes 
+ * into a structure where the value is and 'stride' is the size of the structure.
+ */
+typedef struct
+{
+    size count;     /* Number of non-NaN values.                      */
+    size nan_count; /* Number of NaN values skipped.                  */
+    f64 min;
+    f64 max;
+    f64 mean;
+    f64 m2;         /* Sum of squared deviations from the mean.       */
+} ElkStatistics;
+
+static inline ElkStatistics elk_statistics_add(ElkStatistics stats, f64 value);
+static inline ElkStatistics elk_statistics_merge(ElkStatistics a, ElkStatistics b);
+static inline f64 elk_statistics_variance(ElkStatistics stats); /* Unbiased sample variance, 0.0 if count < 2.         */
+
+static inline ElkStatistics elk_statistics_f64(size n, f64 const *data);
+static inline ElkStatistics elk_statistics_f32(size n, f32 const *data);
+static inline ElkStatistics elk_statistics_strided_f64(size n, void const *data, size offset, size stride);
+static inline ElkStatistics elk_statistics_strided_f32(size n, void const *data, size offset, size stride);
+
 /*---------------------------------------------------------------------------------------------------------------------------
  *
  *
@@ -7658,11 +7740,8 @@ elk_random_state_create(u64 seed)
 }
 
 static inline u64
-elk_random_state_uniform_u64(ElkRandomState *state)
+elk_random_helper_squares(u64 key, u64 cnt)
 {
-    u64 cnt = state->counter++;
-    u64 key = state->key;
-    
     u64 y = cnt * key;
     u64 x = y;
     u64 z = y + key;
@@ -7675,12 +7754,102 @@ elk_random_state_uniform_u64(ElkRandomState *state)
    return t ^ ((x * x + y) >> 32);                  /* round 5 */
 }
 
+static inline ElkRandomState
+elk_random_state_split(ElkRandomState const *state, u64 stream_id)
+{
+    /* Use the parent generator as a hash. The first round spreads out the stream_id, the second ties the result to the
+     * parent's position in its own stream so splitting a substream again gives new substreams.
+     */
+    u64 h = elk_random_helper_squares(state->key, stream_id);
+    h = elk_random_helper_squares(state->key, h ^ state->counter);
+
+    u64 key = elk_random_keys[h % ECO_ARRAY_SIZE(elk_random_keys)];
+    u64 counter = elk_random_helper_squares(key, h);
+
+    return (ElkRandomState){ .key = key, .counter = counter };
+}
+
+static inline void
+elk_random_state_skip(ElkRandomState *state, u64 n)
+{
+    state->counter += n;
+}
+
+static inline u64
+elk_random_state_uniform_u64(ElkRandomState *state)
+{
+    u64 cnt = state->counter++;
+    return elk_random_helper_squares(state->key, cnt);
+}
+
 static inline f64
 elk_random_state_uniform_f64(ElkRandomState *state)
 {
     return 5.42101086242752217e-20 * elk_random_state_uniform_u64(state);
 }
 
+/* Full 128 bit product of a and b, return the high 64 bits and put the low 64 bits in lo. */
+static inline u64
+elk_mul_u64_wide(u64 a, u64 b, u64 *lo)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    u64 hi = 0;
+    *lo = _umul128(a, b, &hi);
+    return hi;
+#else
+    unsigned __int128 m = (unsigned __int128)a * (unsigned __int128)b;
+    *lo = (u64)m;
+    return (u64)(m >> 64);
+#endif
+}
+
+static inline u64
+elk_random_state_uniform_bounded_u64(ElkRandomState *state, u64 bound)
+{
+    Assert(bound > 0);
+
+    u64 lo = 0;
+    u64 hi = elk_mul_u64_wide(elk_random_state_uniform_u64(state), bound, &lo);
+    if(lo < bound)
+    {
+        u64 threshold = -bound % bound;
+        while(lo < threshold)
+        {
+            hi = elk_mul_u64_wide(elk_random_state_uniform_u64(state), bound, &lo);
+        }
+    }
+
+    return hi;
+}
+
+static inline void
+elk_random_state_uniform_bounded_pair_u64(ElkRandomState *state, u64 bound0, u64 bound1, u64 *out0, u64 *out1)
+{
+    Assert(bound0 > 0 && bound1 > 0);
+
+    u64 product_hi = 0;
+    u64 product = 0;
+    product_hi = elk_mul_u64_wide(bound0, bound1, &product);
+    Assert(product_hi == 0);
+
+    u64 lo = 0;
+    u64 r0 = elk_mul_u64_wide(elk_random_state_uniform_u64(state), bound0, &lo);
+    u64 r1 = elk_mul_u64_wide(lo, bound1, &lo);
+
+    if(lo < product)
+    {
+        u64 threshold = -product % product;
+        while(lo < threshold)
+        {
+            r0 = elk_mul_u64_wide(elk_random_state_uniform_u64(state), bound0, &lo);
+            r1 = elk_mul_u64_wide(lo, bound1, &lo);
+        }
+    }
+
+    *out0 = r0;
+    *out1 = r1;
+}
+
 #if __AVX2__
 
 typedef union
@@ -7705,6 +7874,29 @@ elk_avx2_random_state_create(u64 i_seed)
     return (ElkAVX2RandomState){ .key = key.vec, .counter = seed.vec };
 }
 
+static inline ElkAVX2RandomState 
+elk_avx2_random_state_split(ElkRandomState const *state, u64 stream_id)
+{
+    ElkM256iPun counter = {0};
+    ElkM256iPun key = {0};
+
+    /* Lane i is the same substream as elk_random_state_split(state, 4 * stream_id + i). */
+    for(i32 i = 0; i < 4; ++i)
+    {
+        ElkRandomState lane = elk_random_state_split(state, 4 * stream_id + i);
+        key.arr[i] = lane.key;
+        counter.arr[i] = lane.counter;
+    }
+
+    return (ElkAVX2RandomState){ .key = key.vec, .counter = counter.vec };
+}
+
+static inline void
+elk_avx2_random_state_skip(ElkAVX2RandomState *state, u64 n)
+{
+    state->counter = _mm256_add_epi64(state->counter, _mm256_set1_epi64x((i64)n));
+}
+
 /* Helper: 64-bit unsigned multiply (low 64 bits of a*b) for AVX2 - thanks Grok */
 static inline __m256i 
 elk_mul64_epu64(__m256i a, __m256i b)
@@ -7785,6 +7977,38 @@ elk_avx2_random_state_uniform_f64(ElkAVX2RandomState *state)
     return elk_uint64_to_double53_avx2(u);
 }
 
+static inline __m256i
+elk_avx2_random_state_uniform_bounded_u32(ElkAVX2RandomState *state, u32 bound)
+{
+    Assert(bound > 0);
+
+    __m256i vbound = _mm256_set1_epi64x(bound);
+    __m256i low_mask = _mm256_set1_epi64x(0xFFFFFFFF);
+
+    /* Use the high 32 bits of each random u64, they are the best quality bits. */
+    __m256i x = _mm256_srli_epi64(elk_avx2_random_state_uniform_u64(state), 32);
+    __m256i m = _mm256_mul_epu32(x, vbound);
+    __m256i lo = _mm256_and_si256(m, low_mask);
+
+    /* All values fit in 32 bits, so the signed 64 bit compare works. */
+    __m256i reject = _mm256_cmpgt_epi64(vbound, lo);
+    if(!_mm256_testz_si256(reject, reject))
+    {
+        __m256i threshold = _mm256_set1_epi64x((u32)-bound % bound);
+        reject = _mm256_cmpgt_epi64(threshold, lo);
+        while(!_mm256_testz_si256(reject, reject))
+        {
+            x = _mm256_srli_epi64(elk_avx2_random_state_uniform_u64(state), 32);
+            __m256i m_retry = _mm256_mul_epu32(x, vbound);
+            m = _mm256_blendv_epi8(m, m_retry, reject);
+            lo = _mm256_and_si256(m, low_mask);
+            reject = _mm256_cmpgt_epi64(threshold, lo);
+        }
+    }
+
+    return _mm256_srli_epi64(m, 32);
+}
+
 #endif
 
 #if ELK_AVX_512
@@ -7816,6 +8040,29 @@ elk_avx512_random_state_create(u64 i_seed)
     return (ElkAVX512RandomState){ .key = key.vec, .counter = seed.vec };
 }
 
+static inline ElkAVX512RandomState 
+elk_avx512_random_state_split(ElkRandomState const *state, u64 stream_id)
+{
+    ElkM512iPun counter = {0};
+    ElkM512iPun key = {0};
+
+    /* Lane i is the same substream as elk_random_state_split(state, 8 * stream_id + i). */
+    for(i32 i = 0; i < 8; ++i)
+    {
+        ElkRandomState lane = elk_random_state_split(state, 8 * stream_id + i);
+        key.arr[i] = lane.key;
+        counter.arr[i] = lane.counter;
+    }
+
+    return (ElkAVX512RandomState){ .key = key.vec, .counter = counter.vec };
+}
+
+static inline void
+elk_avx512_random_state_skip(ElkAVX512RandomState *state, u64 n)
+{
+    state->counter = _mm512_add_epi64(state->counter, _mm512_set1_epi64((i64)n));
+}
+
 static inline __m512i 
 elk_avx512_random_state_uniform_u64(ElkAVX512RandomState *state)
 {
@@ -7875,6 +8122,34 @@ elk_avx512_random_state_uniform_f64(ElkAVX512RandomState *state)
     return uint64_to_double53_avx512(u);
 }
 
+static inline __m512i
+elk_avx512_random_state_uniform_bounded_u32(ElkAVX512RandomState *state, u32 bound)
+{
+    Assert(bound > 0);
+
+    __m512i vbound = _mm512_set1_epi64(bound);
+    __m512i low_mask = _mm512_set1_epi64(0xFFFFFFFF);
+
+    /* Use the high 32 bits of each random u64, they are the best quality bits. */
+    __m512i x = _mm512_srli_epi64(elk_avx512_random_state_uniform_u64(state), 32);
+    __m512i m = _mm512_mul_epu32(x, vbound);
+
+    __mmask8 reject = _mm512_cmplt_epu64_mask(_mm512_and_si512(m, low_mask), vbound);
+    if(reject)
+    {
+        __m512i threshold = _mm512_set1_epi64((u32)-bound % bound);
+        reject = _mm512_cmplt_epu64_mask(_mm512_and_si512(m, low_mask), threshold);
+        while(reject)
+        {
+            x = _mm512_srli_epi64(elk_avx512_random_state_uniform_u64(state), 32);
+            m = _mm512_mask_mul_epu32(m, reject, x, vbound);
+            reject = _mm512_cmplt_epu64_mask(_mm512_and_si512(m, low_mask), threshold);
+        }
+    }
+
+    return _mm512_srli_epi64(m, 32);
+}
+
 #if 0
 
 /* This version is faster, but of lower quality in the conversion according to Grok. */
@@ -7904,6 +8179,55 @@ elk_kahan_accumulator_add(ElkKahanAccumulator acc, f64 value)
 }
 
 
+static inline ElkKahanAccumulator
+elk_kahan_accumulator_merge(ElkKahanAccumulator a, ElkKahanAccumulator b)
+{
+    /* The errors are additive, add in the error from merging the sums. */
+    ElkKahanAccumulator acc = elk_kahan_accumulator_add(a, b.sum);
+    acc.err += b.err;
+
+    return acc;
+}
+
+static inline f64
+elk_kahan_accumulator_result(ElkKahanAccumulator acc)
+{
+    return acc.sum - acc.err;
+}
+
+#if __AVX2__
+
+static inline ElkAVX2KahanAccumulator 
+elk_avx2_kahan_accumulator_add(ElkAVX2KahanAccumulator acc, __m256d value)
+{
+    __m256d y = _mm256_sub_pd(value,acc.err);
+    volatile __m256d t = _mm256_add_pd(acc.sum, value);
+    volatile __m256d z = _mm256_sub_pd(t, acc.sum);
+    acc.err = _mm256_sub_pd(z, y);
+    acc.sum = t;
+
+    return acc;
+}
+
+static inline ElkKahanAccumulator
+elk_avx2_kahan_accumulator_reduce(ElkAVX2KahanAccumulator acc)
+{
+    f64 sums[4];
+    f64 errs[4];
+    _mm256_storeu_pd(sums, acc.sum);
+    _mm256_storeu_pd(errs, acc.err);
+
+    ElkKahanAccumulator result = {0};
+    for(i32 i = 0; i < 4; ++i)
+    {
+        result = elk_kahan_accumulator_merge(result, (ElkKahanAccumulator){ .sum = sums[i], .err = errs[i] });
+    }
+
+    return result;
+}
+
+#endif
+
 #if ELK_AVX_512
 
 static inline ElkAVX512KahanAccumulator 
@@ -7918,7 +8242,510 @@ elk_avx512_kahan_accumulator_add(ElkAVX512KahanAccumulator acc, __m512d value)
     return acc;
 }
 
+static inline ElkKahanAccumulator
+elk_avx512_kahan_accumulator_reduce(ElkAVX512KahanAccumulator acc)
+{
+    f64 sums[8];
+    f64 errs[8];
+    _mm512_storeu_pd(sums, acc.sum);
+    _mm512_storeu_pd(errs, acc.err);
+
+    ElkKahanAccumulator result = {0};
+    for(i32 i = 0; i < 8; ++i)
+    {
+        result = elk_kahan_accumulator_merge(result, (ElkKahanAccumulator){ .sum = sums[i], .err = errs[i] });
+    }
+
+    return result;
+}
+
+#endif
+
+#if ELK_AVX_512
+
+static inline f64
+elk_kahan_sum_f64(size n, f64 const *data)
+{
+    Assert(n >= 0);
+
+    ElkAVX512KahanAccumulator acc0 = {0}, acc1 = {0}, acc2 = {0}, acc3 = {0};
+
+    size i = 0;
+    for(; i + 32 <= n; i += 32)
+    {
+        acc0 = elk_avx512_kahan_accumulator_add(acc0, _mm512_loadu_pd(data + i +  0));
+        acc1 = elk_avx512_kahan_accumulator_add(acc1, _mm512_loadu_pd(data + i +  8));
+        acc2 = elk_avx512_kahan_accumulator_add(acc2, _mm512_loadu_pd(data + i + 16));
+        acc3 = elk_avx512_kahan_accumulator_add(acc3, _mm512_loadu_pd(data + i + 24));
+    }
+
+    for(; i + 8 <= n; i += 8)
+    {
+        acc0 = elk_avx512_kahan_accumulator_add(acc0, _mm512_loadu_pd(data + i));
+    }
+
+    if(i < n)
+    {
+        __mmask8 mask = (__mmask8)((1u << (n - i)) - 1u);
+        acc1 = elk_avx512_kahan_accumulator_add(acc1, _mm512_maskz_loadu_pd(mask, data + i));
+    }
+
+    ElkKahanAccumulator result = elk_avx512_kahan_accumulator_reduce(acc0);
+    result = elk_kahan_accumulator_merge(result, elk_avx512_kahan_accumulator_reduce(acc1));
+    result = elk_kahan_accumulator_merge(result, elk_avx512_kahan_accumulator_reduce(acc2));
+    result = elk_kahan_accumulator_merge(result, elk_avx512_kahan_accumulator_reduce(acc3));
+
+    return elk_kahan_accumulator_result(result);
+}
+
+static inline f64
+elk_kahan_sum_strided_f64(size n, void const *data, size offset, size stride)
+{
+    Assert(n >= 0);
+
+    byte const *base = (byte const *)data + offset;
+    __m512i idx = _mm512_mullo_epi64(_mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0), _mm512_set1_epi64(stride));
+
+    ElkAVX512KahanAccumulator acc0 = {0}, acc1 = {0};
+
+    size i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        acc0 = elk_avx512_kahan_accumulator_add(acc0, _mm512_i64gather_pd(idx, base + (i + 0) * stride, 1));
+        acc1 = elk_avx512_kahan_accumulator_add(acc1, _mm512_i64gather_pd(idx, base + (i + 8) * stride, 1));
+    }
+
+    ElkKahanAccumulator result = elk_avx512_kahan_accumulator_reduce(acc0);
+    result = elk_kahan_accumulator_merge(result, elk_avx512_kahan_accumulator_reduce(acc1));
+
+    for(; i < n; ++i)
+    {
+        f64 val;
+        memcpy(&val, base + i * stride, sizeof(val));
+        result = elk_kahan_accumulator_add(result, val);
+    }
+
+    return elk_kahan_accumulator_result(result);
+}
+
+#elif __AVX2__
+
+static inline f64
+elk_kahan_sum_f64(size n, f64 const *data)
+{
+    Assert(n >= 0);
+
+    ElkAVX2KahanAccumulator acc0 = {0}, acc1 = {0}, acc2 = {0}, acc3 = {0};
+
+    size i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        acc0 = elk_avx2_kahan_accumulator_add(acc0, _mm256_loadu_pd(data + i +  0));
+        acc1 = elk_avx2_kahan_accumulator_add(acc1, _mm256_loadu_pd(data + i +  4));
+        acc2 = elk_avx2_kahan_accumulator_add(acc2, _mm256_loadu_pd(data + i +  8));
+        acc3 = elk_avx2_kahan_accumulator_add(acc3, _mm256_loadu_pd(data + i + 12));
+    }
+
+    for(; i + 4 <= n; i += 4)
+    {
+        acc0 = elk_avx2_kahan_accumulator_add(acc0, _mm256_loadu_pd(data + i));
+    }
+
+    ElkKahanAccumulator result = elk_avx2_kahan_accumulator_reduce(acc0);
+    result = elk_kahan_accumulator_merge(result, elk_avx2_kahan_accumulator_reduce(acc1));
+    result = elk_kahan_accumulator_merge(result, elk_avx2_kahan_accumulator_reduce(acc2));
+    result = elk_kahan_accumulator_merge(result, elk_avx2_kahan_accumulator_reduce(acc3));
+
+    for(; i < n; ++i)
+    {
+        result = elk_kahan_accumulator_add(result, data[i]);
+    }
+
+    return elk_kahan_accumulator_result(result);
+}
+
+static inline f64
+elk_kahan_sum_strided_f64(size n, void const *data, size offset, size stride)
+{
+    Assert(n >= 0);
+
+    byte const *base = (byte const *)data + offset;
+    __m256i idx = _mm256_set_epi64x(3 * stride, 2 * stride, stride, 0);
+
+    ElkAVX2KahanAccumulator acc0 = {0}, acc1 = {0};
+
+    size i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        acc0 = elk_avx2_kahan_accumulator_add(acc0, _mm256_i64gather_pd((double const *)(base + (i + 0) * stride), idx, 1));
+        acc1 = elk_avx2_kahan_accumulator_add(acc1, _mm256_i64gather_pd((double const *)(base + (i + 4) * stride), idx, 1));
+    }
+
+    ElkKahanAccumulator result = elk_avx2_kahan_accumulator_reduce(acc0);
+    result = elk_kahan_accumulator_merge(result, elk_avx2_kahan_accumulator_reduce(acc1));
+
+    for(; i < n; ++i)
+    {
+        f64 val;
+        memcpy(&val, base + i * stride, sizeof(val));
+        result = elk_kahan_accumulator_add(result, val);
+    }
+
+    return elk_kahan_accumulator_result(result);
+}
+
+#else
+
+static inline f64
+elk_kahan_sum_f64(size n, f64 const *data)
+{
+    Assert(n >= 0);
+
+    /* Two independent accumulators so the additions can overlap. */
+    ElkKahanAccumulator acc0 = {0}, acc1 = {0};
+
+    size i = 0;
+    for(; i + 2 <= n; i += 2)
+    {
+        acc0 = elk_kahan_accumulator_add(acc0, data[i + 0]);
+        acc1 = elk_kahan_accumulator_add(acc1, data[i + 1]);
+    }
+
+    if(i < n) { acc0 = elk_kahan_accumulator_add(acc0, data[i]); }
+
+    return elk_kahan_accumulator_result(elk_kahan_accumulator_merge(acc0, acc1));
+}
+
+static inline f64
+elk_kahan_sum_strided_f64(size n, void const *data, size offset, size stride)
+{
+    Assert(n >= 0);
+
+    byte const *base = (byte const *)data + offset;
+    ElkKahanAccumulator acc = {0};
+
+    for(size i = 0; i < n; ++i)
+    {
+        f64 val;
+        memcpy(&val, base + i * stride, sizeof(val));
+        acc = elk_kahan_accumulator_add(acc, val);
+    }
+
+    return elk_kahan_accumulator_result(acc);
+}
+
+#endif
+
+static inline ElkStatistics
+elk_statistics_add(ElkStatistics stats, f64 value)
+{
+    if(value != value)
+    {
+        stats.nan_count++;
+        return stats;
+    }
+
+    if(stats.count == 0)
+    {
+        stats.min = value;
+        stats.max = value;
+    }
+    else
+    {
+        stats.min = value < stats.min ? value : stats.min;
+        stats.max = value > stats.max ? value : stats.max;
+    }
+
+    stats.count++;
+    f64 const delta = value - stats.mean;
+    stats.mean += delta / stats.count;
+    stats.m2 += delta * (value - stats.mean);
+
+    return stats;
+}
+
+static inline ElkStatistics
+elk_statistics_merge(ElkStatistics a, ElkStatistics b)
+{
+    size const nan_count = a.nan_count + b.nan_count;
+
+    if(b.count == 0) { a.nan_count = nan_count; return a; }
+    if(a.count == 0) { b.nan_count = nan_count; return b; }
+
+    f64 const n = (f64)(a.count + b.count);
+    f64 const delta = b.mean - a.mean;
+    f64 const w = b.count / n;
+
+    ElkStatistics result = 
+        {
+            .count = a.count + b.count,
+            .nan_count = nan_count,
+            .min = b.min < a.min ? b.min : a.min,
+            .max = b.max > a.max ? b.max : a.max,
+            .mean = a.mean + delta * w,
+            .m2 = a.m2 + b.m2 + delta * delta * a.count * w
+        };
+
+    return result;
+}
+
+static inline f64
+elk_statistics_variance(ElkStatistics stats)
+{
+    return stats.count > 1 ? stats.m2 / (stats.count - 1) : 0.0;
+}
+
+/* Number of vectors loaded per block in the SIMD versions. Each block gets a two pass mean and m2 computed from registers,
+ * then merged into the running statistics for each lane. */
+#define ELK_STATISTICS_BLOCK 16
+
+#if ELK_AVX_512
+
+typedef struct
+{
+    __m512d count;
+    __m512d mean;
+    __m512d m2;
+    __m512d min;
+    __m512d max;
+    size nan_count;
+} ElkAVX512Statistics;
+
+static inline ElkAVX512Statistics
+elk_statistics_helper_avx512_block(ElkAVX512Statistics acc, __m512d const xs[ELK_STATISTICS_BLOCK])
+{
+    __m512d const zero = _mm512_setzero_pd();
+    __m512d const one = _mm512_set1_pd(1.0);
+
+    __mmask8 ok[ELK_STATISTICS_BLOCK];
+    __m512d sum = zero;
+    __m512d cnt = zero;
+    for(i32 j = 0; j < ELK_STATISTICS_BLOCK; ++j)
+    {
+        ok[j] = _mm512_cmp_pd_mask(xs[j], xs[j], _CMP_ORD_Q);
+        sum = _mm512_mask_add_pd(sum, ok[j], sum, xs[j]);
+        cnt = _mm512_mask_add_pd(cnt, ok[j], cnt, one);
+        acc.min = _mm512_mask_min_pd(acc.min, ok[j], acc.min, xs[j]);
+        acc.max = _mm512_mask_max_pd(acc.max, ok[j], acc.max, xs[j]);
+        acc.nan_count += 8 - __builtin_popcount(ok[j]);
+    }
+
+    __mmask8 const has = _mm512_cmp_pd_mask(cnt, zero, _CMP_GT_OQ);
+    __m512d const bmean = _mm512_maskz_div_pd(has, sum, cnt);
+
+    __m512d bm2 = zero;
+    for(i32 j = 0; j < ELK_STATISTICS_BLOCK; ++j)
+    {
+        __m512d const d = _mm512_sub_pd(xs[j], bmean);
+        bm2 = _mm512_mask_add_pd(bm2, ok[j], bm2, _mm512_mul_pd(d, d));
+    }
+
+    __m512d const n = _mm512_add_pd(acc.count, cnt);
+    __m512d const delta = _mm512_sub_pd(bmean, acc.mean);
+    __m512d const w = _mm512_maskz_div_pd(has, cnt, n);
+
+    acc.mean = _mm512_add_pd(acc.mean, _mm512_mul_pd(delta, w));
+    acc.m2 = _mm512_add_pd(_mm512_add_pd(acc.m2, bm2), _mm512_mul_pd(_mm512_mul_pd(delta, delta), _mm512_mul_pd(acc.count, w)));
+    acc.count = n;
+
+    return acc;
+}
+
+#elif __AVX2__
+
+typedef struct
+{
+    __m256d count;
+    __m256d mean;
+    __m256d m2;
+    __m256d min;
+    __m256d max;
+    size nan_count;
+} ElkAVX2Statistics;
+
+static inline ElkAVX2Statistics
+elk_statistics_helper_avx2_block(ElkAVX2Statistics acc, __m256d const xs[ELK_STATISTICS_BLOCK])
+{
+    __m256d const zero = _mm256_setzero_pd();
+    __m256d const one = _mm256_set1_pd(1.0);
+
+    __m256d ok[ELK_STATISTICS_BLOCK];
+    __m256d sum = zero;
+    __m256d cnt = zero;
+    for(i32 j = 0; j < ELK_STATISTICS_BLOCK; ++j)
+    {
+        ok[j] = _mm256_cmp_pd(xs[j], xs[j], _CMP_ORD_Q);
+        sum = _mm256_add_pd(sum, _mm256_and_pd(ok[j], xs[j]));
+        cnt = _mm256_add_pd(cnt, _mm256_and_pd(ok[j], one));
+        acc.min = _mm256_blendv_pd(acc.min, _mm256_min_pd(acc.min, xs[j]), ok[j]);
+        acc.max = _mm256_blendv_pd(acc.max, _mm256_max_pd(acc.max, xs[j]), ok[j]);
+        acc.nan_count += 4 - __builtin_popcount(_mm256_movemask_pd(ok[j]));
+    }
+
+    __m256d const has = _mm256_cmp_pd(cnt, zero, _CMP_GT_OQ);
+    __m256d const bmean = _mm256_and_pd(has, _mm256_div_pd(sum, _mm256_max_pd(cnt, one)));
+
+    __m256d bm2 = zero;
+    for(i32 j = 0; j < ELK_STATISTICS_BLOCK; ++j)
+    {
+        __m256d const d = _mm256_sub_pd(xs[j], bmean);
+        bm2 = _mm256_add_pd(bm2, _mm256_and_pd(ok[j], _mm256_mul_pd(d, d)));
+    }
+
+    __m256d const n = _mm256_add_pd(acc.count, cnt);
+    __m256d const delta = _mm256_sub_pd(bmean, acc.mean);
+    __m256d const w = _mm256_and_pd(has, _mm256_div_pd(cnt, _mm256_max_pd(n, one)));
+
+    acc.mean = _mm256_add_pd(acc.mean, _mm256_mul_pd(delta, w));
+    acc.m2 = _mm256_add_pd(_mm256_add_pd(acc.m2, bm2), _mm256_mul_pd(_mm256_mul_pd(delta, delta), _mm256_mul_pd(acc.count, w)));
+    acc.count = n;
+
+    return acc;
+}
+
 #endif
 
+static inline ElkStatistics
+elk_statistics_helper_accumulate(size n, byte const *base, size stride, b32 is_f32)
+{
+    Assert(n >= 0);
+
+    size const contiguous_stride = is_f32 ? sizeof(f32) : sizeof(f64);
+    b32 const contiguous = stride == contiguous_stride;
+
+    ElkStatistics result = {0};
+    size i = 0;
+
+#if ELK_AVX_512
+
+    __m512d const inf = _mm512_castsi512_pd(_mm512_set1_epi64(0x7FF0000000000000));
+    __m512i const idx = _mm512_mullo_epi64(_mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0), _mm512_set1_epi64(stride));
+
+    ElkAVX512Statistics acc = { .min = inf, .max = _mm512_sub_pd(_mm512_setzero_pd(), inf) };
+
+    for(; i + 8 * ELK_STATISTICS_BLOCK <= n; i += 8 * ELK_STATISTICS_BLOCK)
+    {
+        __m512d xs[ELK_STATISTICS_BLOCK];
+        for(i32 j = 0; j < ELK_STATISTICS_BLOCK; ++j)
+        {
+            byte const *p = base + (i + 8 * j) * stride;
+            if(contiguous)
+            {
+                xs[j] = is_f32 ? _mm512_cvtps_pd(_mm256_loadu_ps((f32 const *)p)) : _mm512_loadu_pd(p);
+            }
+            else
+            {
+                xs[j] = is_f32 ? _mm512_cvtps_pd(_mm512_i64gather_ps(idx, p, 1)) : _mm512_i64gather_pd(idx, p, 1);
+            }
+        }
+
+        acc = elk_statistics_helper_avx512_block(acc, xs);
+    }
+
+    f64 counts[8], means[8], m2s[8], mins[8], maxs[8];
+    _mm512_storeu_pd(counts, acc.count);
+    _mm512_storeu_pd(means, acc.mean);
+    _mm512_storeu_pd(m2s, acc.m2);
+    _mm512_storeu_pd(mins, acc.min);
+    _mm512_storeu_pd(maxs, acc.max);
+
+    for(i32 l = 0; l < 8; ++l)
+    {
+        ElkStatistics lane = { .count = (size)counts[l], .min = mins[l], .max = maxs[l], .mean = means[l], .m2 = m2s[l] };
+        result = elk_statistics_merge(result, lane);
+    }
+    result.nan_count += acc.nan_count;
+
+#elif __AVX2__
+
+    __m256d const inf = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FF0000000000000));
+    __m256i const idx = _mm256_set_epi64x(3 * stride, 2 * stride, stride, 0);
+
+    ElkAVX2Statistics acc = { .min = inf, .max = _mm256_sub_pd(_mm256_setzero_pd(), inf) };
+
+    for(; i + 4 * ELK_STATISTICS_BLOCK <= n; i += 4 * ELK_STATISTICS_BLOCK)
+    {
+        __m256d xs[ELK_STATISTICS_BLOCK];
+        for(i32 j = 0; j < ELK_STATISTICS_BLOCK; ++j)
+        {
+            byte const *p = base + (i + 4 * j) * stride;
+            if(contiguous)
+            {
+                xs[j] = is_f32 ? _mm256_cvtps_pd(_mm_loadu_ps((f32 const *)p)) : _mm256_loadu_pd((f64 const *)p);
+            }
+            else
+            {
+                xs[j] = is_f32 ? _mm256_cvtps_pd(_mm256_i64gather_ps((f32 const *)p, idx, 1))
+                               : _mm256_i64gather_pd((f64 const *)p, idx, 1);
+            }
+        }
+
+        acc = elk_statistics_helper_avx2_block(acc, xs);
+    }
+
+    f64 counts[4], means[4], m2s[4], mins[4], maxs[4];
+    _mm256_storeu_pd(counts, acc.count);
+    _mm256_storeu_pd(means, acc.mean);
+    _mm256_storeu_pd(m2s, acc.m2);
+    _mm256_storeu_pd(mins, acc.min);
+    _mm256_storeu_pd(maxs, acc.max);
+
+    for(i32 l = 0; l < 4; ++l)
+    {
+        ElkStatistics lane = { .count = (size)counts[l], .min = mins[l], .max = maxs[l], .mean = means[l], .m2 = m2s[l] };
+        result = elk_statistics_merge(result, lane);
+    }
+    result.nan_count += acc.nan_count;
+
+#else
+    (void)contiguous;
+#endif
+
+    /* Whatever is left over, or everything if there is no SIMD available. */
+    ElkStatistics tail = {0};
+    for(; i < n; ++i)
+    {
+        byte const *p = base + i * stride;
+        if(is_f32)
+        {
+            f32 val;
+            memcpy(&val, p, sizeof(val));
+            tail = elk_statistics_add(tail, val);
+        }
+        else
+        {
+            f64 val;
+            memcpy(&val, p, sizeof(val));
+            tail = elk_statistics_add(tail, val);
+        }
+    }
+
+    return elk_statistics_merge(result, tail);
+}
+
+static inline ElkStatistics
+elk_statistics_f64(size n, f64 const *data)
+{
+    return elk_statistics_helper_accumulate(n, (byte const *)data, sizeof(f64), false);
+}
+
+static inline ElkStatistics
+elk_statistics_f32(size n, f32 const *data)
+{
+    return elk_statistics_helper_accumulate(n, (byte const *)data, sizeof(f32), true);
+}
+
+static inline ElkStatistics
+elk_statistics_strided_f64(size n, void const *data, size offset, size stride)
+{
+    return elk_statistics_helper_accumulate(n, (byte const *)data + offset, stride, false);
+}
+
+static inline ElkStatistics
+elk_statistics_strided_f32(size n, void const *data, size offset, size stride)
+{
+    return elk_statistics_helper_accumulate(n, (byte const *)data + offset, stride, true);
+}
+
 #pragma warning(pop)
 #endif
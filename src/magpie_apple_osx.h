@@ -5,8 +5,12 @@
  *---------------------------------------------------------------------------------------------------------------------------
  * Apple / BSD specific implementation goes here - things NOT in common with Linux
  */
+#include <fcntl.h>
+#include <mach/vm_statistics.h>
+#include <stdlib.h>
 #include <sys/mman.h>
 #include <sys/resource.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 /* The reason for a seperate Linux and Apple impelementation is on Linux I can use the MAP_POPULATE flag, but I cannot on 
@@ -16,6 +20,12 @@
 
 static inline MagMemoryBlock 
 mag_sys_memory_allocate(size minimum_num_bytes)
+{
+    return mag_sys_memory_allocate_options(minimum_num_bytes, (MagMemoryOptions){ .populate = MAG_MEM_POPULATE_LAZY });
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_allocate_options(size minimum_num_bytes, MagMemoryOptions options)
 {
     Assert(minimum_num_bytes > 0);
 
@@ -23,21 +33,182 @@ mag_sys_memory_allocate(size minimum_num_bytes)
     StopIf(page_size == -1, goto ERR_RETURN);
     usize nbytes = minimum_num_bytes + page_size - (minimum_num_bytes % page_size);
 
-    void *ptr = mmap(NULL,                     /* the starting address, NULL = don't care                */
-                     nbytes,                   /* the amount of memory to allocate                       */
-                     PROT_READ | PROT_WRITE,   /* we should have read and write access to the memory     */
-                     MAP_PRIVATE | MAP_ANON,   /* not backed by a file, this is pure memory              */
-                     -1,                       /* recommended file descriptor for portability            */
-                     0);                       /* offset into what? this isn't a file, so should be zero */
+    void *ptr = MAP_FAILED;
+
+#ifdef VM_FLAGS_SUPERPAGE_SIZE_2MB
+    /* Any huge page request gets 2 MiB superpages, which are only supported on Intel. Otherwise fall back to regular pages. */
+    if(options.pages != MAG_MEM_PAGES_DEFAULT)
+    {
+        usize huge_nbytes = ((minimum_num_bytes + ECO_MiB(2) - 1) / ECO_MiB(2)) * ECO_MiB(2);
+        ptr = mmap(NULL, huge_nbytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, VM_FLAGS_SUPERPAGE_SIZE_2MB, 0);
+        if(ptr != MAP_FAILED)
+        {
+            nbytes = huge_nbytes;
+            page_size = ECO_MiB(2);
+        }
+    }
+#endif
+
+    if(ptr == MAP_FAILED)
+    {
+        ptr = mmap(NULL,                     /* the starting address, NULL = don't care                */
+                   nbytes,                   /* the amount of memory to allocate                       */
+                   PROT_READ | PROT_WRITE,   /* we should have read and write access to the memory     */
+                   MAP_PRIVATE | MAP_ANON,   /* not backed by a file, this is pure memory              */
+                   -1,                       /* recommended file descriptor for portability            */
+                   0);                       /* offset into what? this isn't a file, so should be zero */
+    }
 
     StopIf(ptr == MAP_FAILED, goto ERR_RETURN);
 
-    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .flags = 0x01u | 0x02u };
+    /* No MAP_POPULATE, so touch every page. There is no safe way to do this in the background, so that is lazy. */
+    if(options.populate == MAG_MEM_POPULATE_NOW)
+    {
+        for(usize offset = 0; offset < nbytes; offset += page_size) { ((byte volatile *)ptr)[offset] = 0; }
+    }
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline i32
+mag_sys_memory_numa_num_nodes(void)
+{
+    return 1; /* No NUMA here, MagMemoryOptions.numa is ignored. */
+}
+
+static inline i32
+mag_sys_memory_numa_current_node(void)
+{
+    return 0;
+}
+
+static inline size
+mag_sys_memory_page_size(void)
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? (size)page_size : ECO_KiB(4);
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_reserve(size minimum_num_bytes)
+{
+    Assert(minimum_num_bytes > 0);
+
+    size page_size = mag_sys_memory_page_size();
+    usize nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+
+    /* No access and no swap reserved, this is only address space until pages are committed. */
+    void *ptr = mmap(NULL, nbytes, PROT_NONE, MAP_PRIVATE | MAP_ANON | MAP_NORESERVE, -1, 0);
+    StopIf(ptr == MAP_FAILED, goto ERR_RETURN);
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_allocate_mirrored(size minimum_num_bytes)
+{
+    Assert(minimum_num_bytes > 0);
+
+    size page_size = mag_sys_memory_page_size();
+    usize nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+
+    /* There is no memfd_create, so use a temporary file that is deleted right away. */
+    char path[] = "/tmp/magpie_mirrored_XXXXXX";
+    int fd = mkstemp(path);
+    StopIf(fd == -1, goto ERR_RETURN);
+    unlink(path);
+    StopIf(ftruncate(fd, nbytes) != 0, goto CLOSE_FILE);
+
+    /* Reserve room for both copies so nothing else can land between them, then map the file over each half. */
+    byte *ptr = mmap(NULL, 2 * nbytes, PROT_NONE, MAP_PRIVATE | MAP_ANON | MAP_NORESERVE, -1, 0);
+    StopIf(ptr == MAP_FAILED, goto CLOSE_FILE);
+
+    void *first = mmap(ptr, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void *second = mmap(ptr + nbytes, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    StopIf(first == MAP_FAILED || second == MAP_FAILED, goto UNMAP);
+
+    /* The mappings keep the file alive. */
+    close(fd);
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u | 0x04u };
 
+UNMAP:
+    munmap(ptr, 2 * nbytes);
+CLOSE_FILE:
+    close(fd);
 ERR_RETURN:
     return (MagMemoryBlock){ 0 };
 }
 
+static inline MagMemoryBlock
+mag_sys_memory_map_file(char const *path, size minimum_num_bytes)
+{
+    Assert(path && minimum_num_bytes >= 0);
+
+    size page_size = mag_sys_memory_page_size();
+
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    StopIf(fd == -1, goto ERR_RETURN);
+
+    struct stat info = {0};
+    StopIf(fstat(fd, &info) != 0, goto CLOSE_FILE);
+
+    /* Grow it if it is too small (sparse, so no disk is used until pages are written), never cut anything off. */
+    size nbytes = info.st_size;
+    if(nbytes < minimum_num_bytes)
+    {
+        nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+        StopIf(ftruncate(fd, nbytes) != 0, goto CLOSE_FILE);
+    }
+    StopIf(nbytes == 0, goto CLOSE_FILE);
+
+    void *ptr = mmap(NULL, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    StopIf(ptr == MAP_FAILED, goto CLOSE_FILE);
+
+    /* The mapping keeps the file open. */
+    close(fd);
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u | 0x08u };
+
+CLOSE_FILE:
+    close(fd);
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline b32
+mag_sys_memory_flush(MagMemoryBlock *mem)
+{
+    StopIf(!MAG_MEM_IS_FILE_MAPPED(*mem), return true);
+    return msync(mem->mem, mem->size, MS_SYNC) == 0;
+}
+
+static inline b32
+mag_sys_memory_commit(void *start, size num_bytes)
+{
+    return mprotect(start, num_bytes, PROT_READ | PROT_WRITE) == 0;
+}
+
+static inline void
+mag_sys_memory_decommit(void *start, size num_bytes)
+{
+    /* MADV_DONTNEED is only a hint on Apple, mapping fresh pages over the range really gives the memory back. */
+    mmap(start, num_bytes, PROT_NONE, MAP_FIXED | MAP_PRIVATE | MAP_ANON | MAP_NORESERVE, -1, 0);
+}
+
+static inline void
+mag_sys_memory_purge(void *start, size num_bytes)
+{
+    /* Same as decommit, but the new pages are usable right away. */
+    mmap(start, num_bytes, PROT_READ | PROT_WRITE, MAP_FIXED | MAP_PRIVATE | MAP_ANON, -1, 0);
+}
+
 static inline void
 mag_sys_memory_free(MagMemoryBlock *mem)
 {
@@ -45,7 +216,7 @@ mag_sys_memory_free(MagMemoryBlock *mem)
     {
         /* Copy them out in case the MagMemoryBlock is stored in memory it allocated! It happens. */
         void *smem = mem->mem;
-        size_t sz = mem->size;
+        size_t sz = MAG_MEM_IS_MIRRORED(*mem) ? 2 * mem->size : mem->size;
         memset(mem, 0, sizeof(*mem));
         /* int success = */ munmap(smem, sz);
     }
@@ -9,6 +9,12 @@
 
 static inline MagMemoryBlock 
 mag_sys_memory_allocate(size minimum_num_bytes)
+{
+    return mag_sys_memory_allocate_options(minimum_num_bytes, (MagMemoryOptions){ .populate = MAG_MEM_POPULATE_LAZY });
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_allocate_options(size minimum_num_bytes, MagMemoryOptions options)
 {
     Assert(minimum_num_bytes > 0);
 
@@ -16,12 +22,76 @@ mag_sys_memory_allocate(size minimum_num_bytes)
 
     StopIf(ptr == NULL, goto ERR_RETURN);
 
-    return (MagMemoryBlock){ .mem = ptr, .size = minimum_num_bytes, .flags = 0x01u | 0x02u };
+    return (MagMemoryBlock){ .mem = ptr, .size = minimum_num_bytes, .page_size = ECO_KiB(64), .flags = 0x01u | 0x02u };
 
 ERR_RETURN:
     return (MagMemoryBlock){ 0 };
 }
 
+static inline i32
+mag_sys_memory_numa_num_nodes(void)
+{
+    return 1; /* No NUMA here, MagMemoryOptions.numa is ignored. */
+}
+
+static inline i32
+mag_sys_memory_numa_current_node(void)
+{
+    return 0;
+}
+
+static inline size
+mag_sys_memory_page_size(void)
+{
+    return ECO_KiB(64); /* WebAssembly page size */
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_reserve(size minimum_num_bytes)
+{
+    /* No virtual memory, so we have to take it all now. */
+    return mag_sys_memory_allocate(minimum_num_bytes);
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_allocate_mirrored(size minimum_num_bytes)
+{
+    /* No virtual memory, so there is no way to map the same memory twice. */
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_map_file(char const *path, size minimum_num_bytes)
+{
+    /* No mmap of real files here. */
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline b32
+mag_sys_memory_flush(MagMemoryBlock *mem)
+{
+    return !MAG_MEM_IS_FILE_MAPPED(*mem);
+}
+
+static inline b32
+mag_sys_memory_commit(void *start, size num_bytes)
+{
+    return true;
+}
+
+static inline void
+mag_sys_memory_decommit(void *start, size num_bytes)
+{
+    /* Zero it so it behaves the same as freshly committed memory on the other platforms. */
+    memset(start, 0, num_bytes);
+}
+
+static inline void
+mag_sys_memory_purge(void *start, size num_bytes)
+{
+    /* There is no OS to give it back to. */
+}
+
 static inline void
 mag_sys_memory_free(MagMemoryBlock *mem)
 {
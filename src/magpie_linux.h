@@ -14,35 +14,390 @@
 #include <sys/types.h>
 #include <sys/mman.h>
 #include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
 
 /* The reason for a seperate Linux and Apple impelementation is on Linux I can use the MAP_POPULATE flag, but I cannot on 
  * Apple. This flag pre-faults all the pages, so you don't have to worry about page faults slowing down the program.
  */
 
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23 /* Linux 5.14, older kernels return EINVAL and the memory just stays lazy. */
+#endif
+
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
+#ifndef MPOL_INTERLEAVE
+#define MPOL_INTERLEAVE 3
+#endif
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+
+typedef struct
+{
+    pthread_t thread;
+    byte *mem;
+    size size;
+    size chunk;
+    _Atomic(b32) cancel;
+} MagLinuxPopulateWorker;
+
+static inline void *
+mag_sys_memory_populate_worker(void *arg)
+{
+    MagLinuxPopulateWorker *worker = arg;
+
+    /* Go in chunks so mag_sys_memory_free doesn't have to wait long to cancel it. */
+    size const chunk = worker->chunk;
+    for(size offset = 0; offset < worker->size; offset += chunk)
+    {
+        if(atomic_load_explicit(&worker->cancel, memory_order_relaxed)) { break; }
+
+        size const len = worker->size - offset < chunk ? worker->size - offset : chunk;
+        if(madvise(worker->mem + offset, len, MADV_POPULATE_WRITE) != 0) { break; }
+    }
+
+    return NULL;
+}
+
+static inline i32
+mag_sys_memory_numa_num_nodes(void)
+{
+    /* A list of ranges like "0-1" or "0,2-3", the last number is the highest node. */
+    char buf[256] = {0};
+    int fd = open("/sys/devices/system/node/online", O_RDONLY | O_CLOEXEC);
+    StopIf(fd == -1, return 1);
+    ssize_t len = read(fd, buf, sizeof(buf) - 1);
+    close(fd);
+    StopIf(len <= 0, return 1);
+
+    i32 highest = 0;
+    i32 value = 0;
+    for(ssize_t i = 0; i < len; ++i)
+    {
+        if(buf[i] >= '0' && buf[i] <= '9') { value = 10 * value + (buf[i] - '0'); }
+        else { highest = value > highest ? value : highest; value = 0; }
+    }
+    highest = value > highest ? value : highest;
+
+    return highest + 1;
+}
+
+static inline i32
+mag_sys_memory_numa_current_node(void)
+{
+    unsigned cpu = 0;
+    unsigned node = 0;
+    StopIf(syscall(SYS_getcpu, &cpu, &node, NULL) != 0, return 0);
+    return (i32)node;
+}
+
+static inline void
+mag_sys_memory_numa_bind(MagMemoryBlock *mem, MagMemoryOptions options)
+{
+    /* Called before any pages are faulted in, after that it would only apply to pages touched later. */
+    u64 node_mask = 0;
+    int mode = MPOL_PREFERRED;
+    switch(options.numa)
+    {
+        case MAG_MEM_NUMA_LOCAL:
+        {
+            i32 const node = mag_sys_memory_numa_current_node();
+            StopIf(node < 0 || node >= 64, return);
+            node_mask = UINT64_C(1) << node;
+        } break;
+
+        case MAG_MEM_NUMA_NODE:
+        {
+            StopIf(options.numa_node < 0 || options.numa_node >= 64, return);
+            node_mask = UINT64_C(1) << options.numa_node;
+        } break;
+
+        case MAG_MEM_NUMA_INTERLEAVE:
+        {
+            i32 const num_nodes = mag_sys_memory_numa_num_nodes();
+            node_mask = num_nodes >= 64 ? UINT64_MAX : (UINT64_C(1) << num_nodes) - 1;
+            mode = MPOL_INTERLEAVE;
+        } break;
+
+        default: return;
+    }
+
+    /* No libnuma, so straight to the syscall. If it fails (no NUMA in the kernel, or a node that doesn't exist) the memory
+     * is still good, it just goes wherever the default policy puts it. The kernel wants one more than the mask's bits. */
+    /* long result = */ syscall(SYS_mbind, mem->mem, mem->size, mode, &node_mask, 8 * sizeof(node_mask) + 1, 0);
+}
+
 static inline MagMemoryBlock 
 mag_sys_memory_allocate(size minimum_num_bytes)
+{
+    return mag_sys_memory_allocate_options(minimum_num_bytes, (MagMemoryOptions){ .populate = MAG_MEM_POPULATE_NOW });
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_map_huge(size minimum_num_bytes, size page_size, int page_flag, int map_flags)
+{
+    usize nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+
+    /* Fails right away if the reserved pool doesn't have enough pages of this size left. */
+    void *ptr = mmap(NULL, nbytes, PROT_READ | PROT_WRITE, map_flags | MAP_HUGETLB | page_flag, -1, 0);
+    StopIf(ptr == MAP_FAILED, goto ERR_RETURN);
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_map_transparent_huge(size minimum_num_bytes, size page_size, b32 populate_now)
+{
+    size const huge_size = ECO_MiB(2);
+    usize nbytes = ((minimum_num_bytes + huge_size - 1) / huge_size) * huge_size;
+
+    /* The kernel can only use a huge page for an aligned 2 MiB range, so map extra and trim it to alignment. It also has 
+     * to know before the pages are faulted in, so no MAP_POPULATE here. */
+    byte *ptr = mmap(NULL, nbytes + huge_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    StopIf(ptr == MAP_FAILED, goto ERR_RETURN);
+
+    byte *aligned = (byte *)mag_align_pointer((uptr)ptr, huge_size);
+    size const head = aligned - ptr;
+    size const tail = huge_size - head;
+    if(head > 0) { munmap(ptr, head); }
+    if(tail > 0) { munmap(aligned + nbytes, tail); }
+
+    /* If transparent huge pages are turned off this fails, but the memory is still fine with regular pages. */
+    b32 huge = madvise(aligned, nbytes, MADV_HUGEPAGE) == 0;
+
+    if(populate_now && madvise(aligned, nbytes, MADV_POPULATE_WRITE) != 0)
+    {
+        for(usize offset = 0; offset < nbytes; offset += page_size) { ((byte volatile *)aligned)[offset] = 0; }
+    }
+
+    return (MagMemoryBlock){ .mem = aligned, .size = nbytes, .page_size = huge ? huge_size : page_size, .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_allocate_options(size minimum_num_bytes, MagMemoryOptions options)
 {
     Assert(minimum_num_bytes > 0);
 
     long page_size = sysconf(_SC_PAGESIZE);
     StopIf(page_size == -1, goto ERR_RETURN);
-    usize nbytes = minimum_num_bytes + page_size - (minimum_num_bytes % page_size);
 
-    void *ptr = mmap(NULL,                                    /* the starting address, NULL = don't care                */
-                     nbytes,                                  /* the amount of memory to allocate                       */
-                     PROT_READ | PROT_WRITE,                  /* we should have read and write access to the memory     */
-                     MAP_PRIVATE | MAP_ANON | MAP_POPULATE,   /* not backed by a file, this is pure memory              */
-                     -1,                                      /* recommended file descriptor for portability            */
-                     0);                                      /* offset into what? this isn't a file, so should be zero */
+    b32 const populate_now = options.populate == MAG_MEM_POPULATE_DEFAULT || options.populate == MAG_MEM_POPULATE_NOW;
+    b32 const numa = options.numa != MAG_MEM_NUMA_DEFAULT;
+    int map_flags = MAP_PRIVATE | MAP_ANON;
+
+    /* The NUMA policy has to be in place before the pages are faulted in, so populate after binding. */
+    if(populate_now && !numa) { map_flags |= MAP_POPULATE; }
+
+    /* Try the requested pages, then fall back one size at a time. */
+    MagMemoryBlock mem = { 0 };
+    if(options.pages == MAG_MEM_PAGES_HUGE_1GiB)
+    {
+        mem = mag_sys_memory_map_huge(minimum_num_bytes, ECO_GiB(1), MAP_HUGE_1GB, map_flags);
+    }
+
+    if(!MAG_MEM_IS_VALID(mem) && (options.pages == MAG_MEM_PAGES_HUGE_1GiB || options.pages == MAG_MEM_PAGES_HUGE_2MiB))
+    {
+        mem = mag_sys_memory_map_huge(minimum_num_bytes, ECO_MiB(2), MAP_HUGE_2MB, map_flags);
+    }
+
+    if(!MAG_MEM_IS_VALID(mem) && options.pages != MAG_MEM_PAGES_DEFAULT)
+    {
+        mem = mag_sys_memory_map_transparent_huge(minimum_num_bytes, page_size, populate_now && !numa);
+    }
+
+    if(!MAG_MEM_IS_VALID(mem))
+    {
+        usize nbytes = minimum_num_bytes + page_size - (minimum_num_bytes % page_size);
+
+        void *ptr = mmap(NULL,                                    /* the starting address, NULL = don't care                */
+                         nbytes,                                  /* the amount of memory to allocate                       */
+                         PROT_READ | PROT_WRITE,                  /* we should have read and write access to the memory     */
+                         map_flags,                               /* not backed by a file, this is pure memory              */
+                         -1,                                      /* recommended file descriptor for portability            */
+                         0);                                      /* offset into what? this isn't a file, so should be zero */
+
+        StopIf(ptr == MAP_FAILED, goto ERR_RETURN);
+
+        mem = (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u };
+    }
+
+    if(numa)
+    {
+        mag_sys_memory_numa_bind(&mem, options);
 
+        if(populate_now && madvise(mem.mem, mem.size, MADV_POPULATE_WRITE) != 0)
+        {
+            for(size offset = 0; offset < mem.size; offset += mem.page_size) { ((byte volatile *)mem.mem)[offset] = 0; }
+        }
+    }
+
+    if(options.populate == MAG_MEM_POPULATE_BACKGROUND)
+    {
+        /* If the helper can't be started, the memory is still good, it's just lazy. */
+        MagLinuxPopulateWorker *worker = mmap(NULL, sizeof(*worker), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+        if(worker != MAP_FAILED)
+        {
+            worker->mem = mem.mem;
+            worker->size = mem.size;
+            worker->chunk = mem.page_size > ECO_MiB(2) ? mem.page_size : ECO_MiB(2);
+            atomic_init(&worker->cancel, false);
+
+            if(pthread_create(&worker->thread, NULL, mag_sys_memory_populate_worker, worker) == 0)
+            {
+                mem.populate_worker = worker;
+            }
+            else
+            {
+                munmap(worker, sizeof(*worker));
+            }
+        }
+    }
+
+    return mem;
+
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline size
+mag_sys_memory_page_size(void)
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? (size)page_size : ECO_KiB(4);
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_reserve(size minimum_num_bytes)
+{
+    Assert(minimum_num_bytes > 0);
+
+    size page_size = mag_sys_memory_page_size();
+    usize nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+
+    /* No access and no swap reserved, this is only address space until pages are committed. */
+    void *ptr = mmap(NULL, nbytes, PROT_NONE, MAP_PRIVATE | MAP_ANON | MAP_NORESERVE, -1, 0);
     StopIf(ptr == MAP_FAILED, goto ERR_RETURN);
 
-    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .flags = 0x01u | 0x02u };
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_allocate_mirrored(size minimum_num_bytes)
+{
+    Assert(minimum_num_bytes > 0);
+
+    size page_size = mag_sys_memory_page_size();
+    usize nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+
+    /* An anonymous file holds the pages, so they can be mapped more than once. */
+    int fd = memfd_create("magpie_mirrored", MFD_CLOEXEC);
+    StopIf(fd == -1, goto ERR_RETURN);
+    StopIf(ftruncate(fd, nbytes) != 0, goto CLOSE_FILE);
+
+    /* Reserve room for both copies so nothing else can land between them, then map the file over each half. */
+    byte *ptr = mmap(NULL, 2 * nbytes, PROT_NONE, MAP_PRIVATE | MAP_ANON | MAP_NORESERVE, -1, 0);
+    StopIf(ptr == MAP_FAILED, goto CLOSE_FILE);
+
+    void *first = mmap(ptr, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void *second = mmap(ptr + nbytes, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    StopIf(first == MAP_FAILED || second == MAP_FAILED, goto UNMAP);
+
+    /* The mappings keep the file alive. */
+    close(fd);
 
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u | 0x04u };
+
+UNMAP:
+    munmap(ptr, 2 * nbytes);
+CLOSE_FILE:
+    close(fd);
 ERR_RETURN:
     return (MagMemoryBlock){ 0 };
 }
 
+static inline MagMemoryBlock
+mag_sys_memory_map_file(char const *path, size minimum_num_bytes)
+{
+    Assert(path && minimum_num_bytes >= 0);
+
+    size page_size = mag_sys_memory_page_size();
+
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    StopIf(fd == -1, goto ERR_RETURN);
+
+    struct stat info = {0};
+    StopIf(fstat(fd, &info) != 0, goto CLOSE_FILE);
+
+    /* Grow it if it is too small (sparse, so no disk is used until pages are written), never cut anything off. */
+    size nbytes = info.st_size;
+    if(nbytes < minimum_num_bytes)
+    {
+        nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size;
+        StopIf(ftruncate(fd, nbytes) != 0, goto CLOSE_FILE);
+    }
+    StopIf(nbytes == 0, goto CLOSE_FILE);
+
+    void *ptr = mmap(NULL, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    StopIf(ptr == MAP_FAILED, goto CLOSE_FILE);
+
+    /* The mapping keeps the file open. */
+    close(fd);
+
+    return (MagMemoryBlock){ .mem = ptr, .size = nbytes, .page_size = page_size, .flags = 0x01u | 0x02u | 0x08u };
+
+CLOSE_FILE:
+    close(fd);
+ERR_RETURN:
+    return (MagMemoryBlock){ 0 };
+}
+
+static inline b32
+mag_sys_memory_flush(MagMemoryBlock *mem)
+{
+    StopIf(!MAG_MEM_IS_FILE_MAPPED(*mem), return true);
+    return msync(mem->mem, mem->size, MS_SYNC) == 0;
+}
+
+static inline b32
+mag_sys_memory_commit(void *start, size num_bytes)
+{
+    return mprotect(start, num_bytes, PROT_READ | PROT_WRITE) == 0;
+}
+
+static inline void
+mag_sys_memory_decommit(void *start, size num_bytes)
+{
+    /* Drop the pages so the memory goes back to the OS, and they'll be zero if they are ever committed again. */
+    madvise(start, num_bytes, MADV_DONTNEED);
+    mprotect(start, num_bytes, PROT_NONE);
+}
+
+static inline void
+mag_sys_memory_purge(void *start, size num_bytes)
+{
+    /* Not MADV_FREE, it only hands the pages over once the system is low on memory, so RSS wouldn't go down until then. */
+    madvise(start, num_bytes, MADV_DONTNEED);
+}
+
 static inline void
 mag_sys_memory_free(MagMemoryBlock *mem)
 {
@@ -50,8 +405,18 @@ mag_sys_memory_free(MagMemoryBlock *mem)
     {
         /* Copy them out in case the MagMemoryBlock is stored in memory it allocated! It happens. */
         void *smem = mem->mem;
-        size_t sz = mem->size;
+        size_t sz = MAG_MEM_IS_MIRRORED(*mem) ? 2 * mem->size : mem->size;
+        MagLinuxPopulateWorker *worker = mem->populate_worker;
         memset(mem, 0, sizeof(*mem));
+
+        /* The helper thread must be done with the memory before it goes away. */
+        if(worker)
+        {
+            atomic_store(&worker->cancel, true);
+            pthread_join(worker->thread, NULL);
+            munmap(worker, sizeof(*worker));
+        }
+
         /* int success = */ munmap(smem, sz);
     }
 
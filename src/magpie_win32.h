@@ -8,8 +8,33 @@
 
 _Static_assert(UINT32_MAX < INTPTR_MAX, "DWORD cannot be cast to intptr_t safely.");
 
+static inline i32
+mag_sys_memory_numa_num_nodes(void)
+{
+    ULONG highest = 0;
+    StopIf(!GetNumaHighestNodeNumber(&highest), return 1);
+    return (i32)highest + 1;
+}
+
+static inline i32
+mag_sys_memory_numa_current_node(void)
+{
+    PROCESSOR_NUMBER processor = {0};
+    GetCurrentProcessorNumberEx(&processor);
+
+    USHORT node = 0;
+    StopIf(!GetNumaProcessorNodeEx(&processor, &node) || node == MAXUSHORT, return 0);
+    return (i32)node;
+}
+
 static inline MagMemoryBlock 
 mag_sys_memory_allocate(size minimum_num_bytes)
+{
+    return mag_sys_memory_allocate_options(minimum_num_bytes, (MagMemoryOptions){ .populate = MAG_MEM_POPULATE_LAZY });
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_allocate_options(size minimum_num_bytes, MagMemoryOptions options)
 {
     Assert(minimum_num_bytes > 0);
     StopIf(minimum_num_bytes <= 0, goto ERR_RETURN);
@@ -28,25 +53,218 @@ mag_sys_memory_allocate(size minimum_num_bytes)
 
     size a_size = (size)allocation_size;
 
-    void *mem = VirtualAlloc(NULL, allocation_size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    /* There is only one large page size, and it needs the SeLockMemoryPrivilege. Without it this fails and we fall back. 
+     * Large pages are always committed and locked in memory, so populating doesn't matter for them. */
+    void *mem = NULL;
+    uptr large_page_size = GetLargePageMinimum();
+    if(options.pages != MAG_MEM_PAGES_DEFAULT && large_page_size > 0)
+    {
+        uptr large_size = ((minimum_num_bytes + large_page_size - 1) / large_page_size) * large_page_size;
+        if(large_size <= INTPTR_MAX)
+        {
+            mem = VirtualAlloc(NULL, large_size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if(mem)
+            {
+                return (MagMemoryBlock)
+                    {.mem = mem, .size = (size)large_size, .page_size = (size)large_page_size, .flags = 0x01u | 0x02u };
+            }
+        }
+    }
+
+    /* There is no interleaving policy for VirtualAlloc, so that gets the default. If the preferred node can't be used it
+     * falls back to the default too. */
+    if(options.numa == MAG_MEM_NUMA_LOCAL || options.numa == MAG_MEM_NUMA_NODE)
+    {
+        DWORD node = options.numa == MAG_MEM_NUMA_LOCAL ? mag_sys_memory_numa_current_node() : options.numa_node;
+        mem = VirtualAllocExNuma(GetCurrentProcess(), NULL, allocation_size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, node);
+    }
+
+    if(!mem) { mem = VirtualAlloc(NULL, allocation_size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE); }
     Assert(mem);
     StopIf(!mem, goto ERR_RETURN);
 
-    return (MagMemoryBlock){.mem = mem, .size = a_size, .flags = 0x01u | 0x02u };
+    /* Committed pages aren't backed until they are touched, so touch them all now. Background populating is lazy. */
+    if(options.populate == MAG_MEM_POPULATE_NOW)
+    {
+        for(size offset = 0; offset < a_size; offset += page_size) { ((byte volatile *)mem)[offset] = 0; }
+    }
+
+    return (MagMemoryBlock){.mem = mem, .size = a_size, .page_size = (size)page_size, .flags = 0x01u | 0x02u };
+
+ERR_RETURN:
+    return (MagMemoryBlock) { 0 };
+}
+
+static inline size
+mag_sys_memory_page_size(void)
+{
+    SYSTEM_INFO info = {0};
+    GetSystemInfo(&info);
+    return (size)info.dwPageSize;
+}
+
+static inline MagMemoryBlock 
+mag_sys_memory_reserve(size minimum_num_bytes)
+{
+    Assert(minimum_num_bytes > 0);
+    StopIf(minimum_num_bytes <= 0, goto ERR_RETURN);
+
+    SYSTEM_INFO info = {0};
+    GetSystemInfo(&info);
+    uptr alloc_gran = info.dwAllocationGranularity;
+
+    uptr allocation_size = ((minimum_num_bytes + alloc_gran - 1) / alloc_gran) * alloc_gran;
+    StopIf(allocation_size > INTPTR_MAX, goto ERR_RETURN);
+
+    void *mem = VirtualAlloc(NULL, allocation_size, MEM_RESERVE, PAGE_NOACCESS);
+    StopIf(!mem, goto ERR_RETURN);
+
+    return (MagMemoryBlock){.mem = mem, .size = (size)allocation_size, .page_size = (size)info.dwPageSize, .flags = 0x01u | 0x02u };
 
 ERR_RETURN:
     return (MagMemoryBlock) { 0 };
 }
 
+static inline MagMemoryBlock
+mag_sys_memory_allocate_mirrored(size minimum_num_bytes)
+{
+    Assert(minimum_num_bytes > 0);
+    StopIf(minimum_num_bytes <= 0, goto ERR_RETURN);
+
+    SYSTEM_INFO info = {0};
+    GetSystemInfo(&info);
+    uptr alloc_gran = info.dwAllocationGranularity;
+
+    /* Views have to start on the allocation granularity, so both halves are a multiple of it. */
+    uptr allocation_size = ((minimum_num_bytes + alloc_gran - 1) / alloc_gran) * alloc_gran;
+    StopIf(allocation_size > INTPTR_MAX / 2, goto ERR_RETURN);
+
+    HANDLE mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)((u64)allocation_size >> 32),
+            (DWORD)(allocation_size & 0xFFFFFFFF), NULL);
+    StopIf(!mapping, goto ERR_RETURN);
+
+    /* Find a hole big enough for both views, then map them into it. Another thread could take the hole between the
+     * VirtualFree and the second MapViewOfFileEx, so try a few times. */
+    byte *mem = NULL;
+    for(i32 tries = 0; tries < 10 && !mem; ++tries)
+    {
+        byte *hole = VirtualAlloc(NULL, 2 * allocation_size, MEM_RESERVE, PAGE_NOACCESS);
+        if(!hole) { break; }
+        VirtualFree(hole, 0, MEM_RELEASE);
+
+        void *first = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, allocation_size, hole);
+        void *second = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, allocation_size, hole + allocation_size);
+        if(first && second) { mem = hole; }
+        else
+        {
+            if(first) { UnmapViewOfFile(first); }
+            if(second) { UnmapViewOfFile(second); }
+        }
+    }
+
+    /* The views keep the mapping alive. */
+    CloseHandle(mapping);
+    StopIf(!mem, goto ERR_RETURN);
+
+    return (MagMemoryBlock){.mem = mem, .size = (size)allocation_size, .page_size = (size)info.dwPageSize, .flags = 0x01u | 0x02u | 0x04u };
+
+ERR_RETURN:
+    return (MagMemoryBlock) { 0 };
+}
+
+static inline MagMemoryBlock
+mag_sys_memory_map_file(char const *path, size minimum_num_bytes)
+{
+    Assert(path && minimum_num_bytes >= 0);
+
+    SYSTEM_INFO info = {0};
+    GetSystemInfo(&info);
+    u64 page_size = info.dwPageSize;
+
+    HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, OPEN_ALWAYS,
+            FILE_ATTRIBUTE_NORMAL, NULL);
+    StopIf(file == INVALID_HANDLE_VALUE, goto ERR_RETURN);
+
+    LARGE_INTEGER file_size = {0};
+    StopIf(!GetFileSizeEx(file, &file_size), goto CLOSE_FILE);
+
+    /* A mapping bigger than the file grows the file, never cut anything off. */
+    u64 nbytes = (u64)file_size.QuadPart;
+    if(nbytes < (u64)minimum_num_bytes) { nbytes = ((minimum_num_bytes + page_size - 1) / page_size) * page_size; }
+    StopIf(nbytes == 0 || nbytes > INTPTR_MAX, goto CLOSE_FILE);
+
+    HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READWRITE, (DWORD)(nbytes >> 32), (DWORD)(nbytes & 0xFFFFFFFF),
+            NULL);
+    StopIf(!mapping, goto CLOSE_FILE);
+
+    /* The view keeps the mapping and the file open. */
+    void *mem = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, nbytes);
+    CloseHandle(mapping);
+    CloseHandle(file);
+    StopIf(!mem, goto ERR_RETURN);
+
+    return (MagMemoryBlock){.mem = mem, .size = (size)nbytes, .page_size = (size)page_size, .flags = 0x01u | 0x02u | 0x08u };
+
+CLOSE_FILE:
+    CloseHandle(file);
+ERR_RETURN:
+    return (MagMemoryBlock) { 0 };
+}
+
+static inline b32
+mag_sys_memory_flush(MagMemoryBlock *mem)
+{
+    /* Without the file handle there is no FlushFileBuffers, so this only hands the pages to the OS. */
+    StopIf(!MAG_MEM_IS_FILE_MAPPED(*mem), return true);
+    return FlushViewOfFile(mem->mem, 0) != 0;
+}
+
+static inline b32
+mag_sys_memory_commit(void *start, size num_bytes)
+{
+    return VirtualAlloc(start, num_bytes, MEM_COMMIT, PAGE_READWRITE) != NULL;
+}
+
+static inline void
+mag_sys_memory_decommit(void *start, size num_bytes)
+{
+    /*BOOL success =*/ VirtualFree(start, num_bytes, MEM_DECOMMIT);
+}
+
+static inline void
+mag_sys_memory_purge(void *start, size num_bytes)
+{
+    /* MEM_RESET keeps the pages committed but stops them from being paged out, unlocking pages that aren't locked takes
+     * them out of the working set. Decommit and commit would do it too, but large pages can't be decommitted. */
+    VirtualAlloc(start, num_bytes, MEM_RESET, PAGE_READWRITE);
+    VirtualUnlock(start, num_bytes);
+}
+
 static inline void
 mag_sys_memory_free(MagMemoryBlock *mem)
 {
     if(MAG_MEM_IS_VALID_AND_OWNED(*mem))
     {
         /* Copy them out in case the MagMemoryBlock is stored in memory it allocated! It happens. */
-        void *smem = mem->mem;
-         memset(mem, 0, sizeof(*mem));
-         /*BOOL success =*/ VirtualFree(smem, 0, MEM_RELEASE);
+        byte *smem = mem->mem;
+        size sz = mem->size;
+        b32 mirrored = MAG_MEM_IS_MIRRORED(*mem);
+        b32 file_mapped = MAG_MEM_IS_FILE_MAPPED(*mem);
+        memset(mem, 0, sizeof(*mem));
+
+        if(mirrored)
+        {
+            UnmapViewOfFile(smem);
+            UnmapViewOfFile(smem + sz);
+        }
+        else if(file_mapped)
+        {
+            UnmapViewOfFile(smem);
+        }
+        else
+        {
+            /*BOOL success =*/ VirtualFree(smem, 0, MEM_RELEASE);
+        }
     }
 
     return;
@@ -137,6 +137,143 @@ test_file_slurp(void)
     return;
 }
 
+static void
+test_async_file_reader(void)
+{
+    char path_buf[1024] = {0};
+    Assert(coy_path_append(sizeof(path_buf), path_buf, test_data_dir));
+    Assert(coy_path_append(sizeof(path_buf), path_buf, "async_read_test.bin"));
+
+    /* Not a multiple of the buffer size, so the last chunk is short. */
+    size const file_size = ECO_MiB(3) + 1234;
+    CoyFileWriter writer = coy_file_create(path_buf);
+    Assert(writer.valid);
+    for(size i = 0; i < file_size; ++i) { Assert(coy_file_write_u8(&writer, (u8)(i % 251))); }
+    coy_file_writer_close(&writer);
+
+    CoyAsyncReadBackend const backends[] = { COY_ASYNC_READ_DEFAULT, COY_ASYNC_READ_THREAD };
+    for(i32 b = 0; b < ECO_ARRAY_SIZE(backends); ++b)
+    {
+        CoyAsyncFileReader reader = coy_async_file_reader_open(path_buf, ECO_KiB(64), 4, backends[b]);
+        Assert(reader.valid && reader.backend != COY_ASYNC_READ_DEFAULT);
+        Assert(backends[b] != COY_ASYNC_READ_THREAD || reader.backend == COY_ASYNC_READ_THREAD);
+
+        /* Everything comes back in order. */
+        size total = 0;
+        for(ElkStr chunk = coy_async_file_reader_next(&reader); chunk.len; chunk = coy_async_file_reader_next(&reader))
+        {
+            Assert(chunk.len == ECO_KiB(64) || total + chunk.len == file_size);
+            for(size i = 0; i < chunk.len; ++i) { Assert((u8)chunk.start[i] == (u8)((total + i) % 251)); }
+            total += chunk.len;
+        }
+        Assert(reader.valid && total == file_size);
+
+        /* Stays at the end. */
+        Assert(coy_async_file_reader_next(&reader).len == 0 && reader.valid);
+
+        coy_async_file_reader_close(&reader);
+        Assert(!reader.valid);
+    }
+
+    /* Closing part way through, with reads still in flight. */
+    CoyAsyncFileReader reader = coy_async_file_reader_open(path_buf, ECO_KiB(64), 8, COY_ASYNC_READ_DEFAULT);
+    Assert(coy_async_file_reader_next(&reader).len == ECO_KiB(64));
+    coy_async_file_reader_close(&reader);
+
+    /* Empty and missing files. */
+    writer = coy_file_create(path_buf);
+    coy_file_writer_close(&writer);
+    reader = coy_async_file_reader_open(path_buf, 0, 0, COY_ASYNC_READ_DEFAULT);
+    Assert(reader.valid && coy_async_file_reader_next(&reader).len == 0 && reader.valid);
+    coy_async_file_reader_close(&reader);
+
+    Assert(!coy_async_file_reader_open("I_DO_NOT_EXIST.bin", 0, 0, COY_ASYNC_READ_DEFAULT).valid);
+}
+
+#if MAG_TRACE
+#define TEST_ALLOC_TRACE_THREADS 2
+#define TEST_ALLOC_TRACE_ALLOCS 3000
+
+static void
+test_alloc_trace_worker(void *data)
+{
+    CoyAllocTraceBuffer *buf = data;
+    MagDynArena arena = mag_dyn_arena_create(ECO_KiB(64));
+    coy_alloc_trace_start(buf->trace, buf);
+
+    /* Lots of small ones, one that keeps growing, and a reset. More than fits in the buffer, so it flushes on the way. */
+    for(i32 i = 0; i < TEST_ALLOC_TRACE_ALLOCS; ++i) { Assert(mag_dyn_arena_nmalloc(&arena, 16, byte)); }
+    byte *grow = mag_dyn_arena_nmalloc(&arena, 1, byte);
+    for(i32 i = 1; i <= 100; ++i) { grow = mag_dyn_arena_nrealloc(&arena, grow, 100 * i, byte); Assert(grow); }
+    mag_dyn_arena_reset(&arena, false);
+
+    coy_alloc_trace_stop(buf);
+    mag_dyn_arena_destroy(&arena);
+}
+
+static void
+test_alloc_trace(void)
+{
+    char log_path[1024] = {0};
+    Assert(coy_path_append(sizeof(log_path), log_path, test_data_dir));
+    Assert(coy_path_append(sizeof(log_path), log_path, "alloc_trace.bin"));
+
+    CoyAllocTrace trace = coy_alloc_trace_create(log_path);
+    Assert(trace.valid);
+
+    static CoyAllocTraceBuffer buffers[TEST_ALLOC_TRACE_THREADS] = {0};
+    CoyThread threads[TEST_ALLOC_TRACE_THREADS] = {0};
+    for(i32 t = 0; t < TEST_ALLOC_TRACE_THREADS; ++t)
+    {
+        buffers[t].trace = &trace;
+        Assert(coy_thread_create(&threads[t], test_alloc_trace_worker, &buffers[t]));
+    }
+
+    for(i32 t = 0; t < TEST_ALLOC_TRACE_THREADS; ++t)
+    {
+        Assert(coy_thread_join(&threads[t]));
+        coy_thread_destroy(&threads[t]);
+    }
+
+    Assert(coy_alloc_trace_destroy(&trace));
+
+    /* Four call sites, the growing one asked for the most. */
+    MagAllocator alloc_instance = mag_allocator_dyn_arena_create(ECO_MiB(1));
+    MagAllocator *alloc = &alloc_instance;
+    CoyAllocTraceSummary summary = coy_alloc_trace_summarize(log_path, alloc);
+    Assert(summary.valid && summary.num_threads == TEST_ALLOC_TRACE_THREADS && summary.num_sites == 4);
+    Assert(summary.num_records == TEST_ALLOC_TRACE_THREADS * (TEST_ALLOC_TRACE_ALLOCS + 1 + 100 + 1));
+    Assert(summary.last_timestamp >= summary.first_timestamp);
+
+    CoyAllocTraceSite const *top = &summary.sites[0];
+    ElkStr const this_file = elk_str_from_cstring("fileio.c");
+    Assert(top->file.len >= this_file.len);
+    Assert(elk_str_eq(elk_str_substr(top->file, top->file.len - this_file.len, this_file.len), this_file));
+    Assert(top->num_reallocs == TEST_ALLOC_TRACE_THREADS * 100 && top->max_bytes == 10000 && top->num_failures == 0);
+    Assert(top->bytes_requested == TEST_ALLOC_TRACE_THREADS * 505000);
+
+    CoyAllocTraceSite const *small = &summary.sites[1];
+    Assert(small->num_allocs == TEST_ALLOC_TRACE_THREADS * TEST_ALLOC_TRACE_ALLOCS && small->max_bytes == 16);
+    Assert(small->line != top->line && summary.sites[3].num_resets == TEST_ALLOC_TRACE_THREADS);
+
+    /* The text version. */
+    char text_path[1024] = {0};
+    Assert(coy_path_append(sizeof(text_path), text_path, test_data_dir));
+    Assert(coy_path_append(sizeof(text_path), text_path, "alloc_trace.txt"));
+    CoyFileWriter out = coy_file_create(text_path);
+    Assert(out.valid && coy_alloc_trace_summary_write(&summary, 10, &out));
+    coy_file_writer_close(&out);
+
+    ElkStr text = coy_file_slurp_text_allocator(text_path, alloc);
+    Assert(elk_str_eq(elk_str_substr(text, 0, 9), elk_str_from_cstring("Records: ")));
+    i32 num_lines = 0;
+    for(size i = 0; i < text.len; ++i) { num_lines += text.start[i] == '\n'; }
+    Assert(num_lines == 5);
+
+    eco_arena_destroy(alloc);
+}
+#endif
+
 /*---------------------------------------------------------------------------------------------------------------------------
  *                                                    All file IO tests
  *-------------------------------------------------------------------------------------------------------------------------*/
@@ -147,5 +284,10 @@ coyote_file_tests(void)
     test_file_create_write_append_open_read_close();
     test_memmap_read();
     test_file_slurp();
+    test_async_file_reader();
+
+#if MAG_TRACE
+    test_alloc_trace();
+#endif
 }
 
@@ -545,6 +545,131 @@ test_thread_pool(void)
 #undef NUM_TEST_TASKS
 }
 
+typedef struct
+{
+    i32 n;
+    i64 sum;
+    b32 had_scratch;
+    CoyBatchCompletion *bc;
+} CoyThreadPoolScratchTestTaskData;
+
+static inline void
+coy_thread_pool_scratch_test_task_function(void *data)
+{
+    CoyThreadPoolScratchTestTaskData *td = data;
+
+    td->had_scratch = mag_scratch_set_bound() != NULL;
+    if(td->had_scratch)
+    {
+        MagScratch scratch = mag_scratch_begin(NULL);
+        i64 *vals = mag_dyn_arena_nmalloc(scratch.arena, td->n, i64);
+        for(i32 i = 0; i < td->n; ++i) { vals[i] = i; }
+        for(i32 i = 0; i < td->n; ++i) { td->sum += vals[i]; }
+        mag_scratch_end(scratch);
+    }
+
+    coy_batch_completion_task_done(td->bc);
+}
+
+static void
+test_thread_pool_scratch(void)
+{
+#define NUM_TEST_TASKS 200
+    CoyThreadPool pool_ = {0};
+    CoyThreadPool *pool = &pool_;
+    coy_threadpool_initialize(pool, 4);
+
+    CoyThreadPoolScratchTestTaskData td[NUM_TEST_TASKS] = {0};
+    CoyFuture futures[NUM_TEST_TASKS] = {0};
+    CoyBatchCompletion bc = {0};
+    coy_batch_completion_init(&bc, pool);
+
+    for(i32 i = 0; i < NUM_TEST_TASKS; ++i)
+    {
+        td[i].n = 1000 * (i + 1);
+        td[i].bc = &bc;
+        futures[i] = coy_future_create(coy_thread_pool_scratch_test_task_function, &td[i]);
+        coy_batch_completion_task_submit(&bc, &futures[i]);
+    }
+
+    coy_batch_completion_wait(&bc);
+    coy_batch_completion_destroy(&bc);
+
+    for(i32 i = 0; i < NUM_TEST_TASKS; ++i)
+    {
+        i64 n = td[i].n;
+        Assert(td[i].had_scratch);
+        Assert(td[i].sum == n * (n - 1) / 2);
+    }
+
+    /* Every task ended its scratch, so nothing is left allocated. */
+    for(size i = 0; i < pool->nthreads; ++i)
+    {
+        MagScratchSet *set = &pool->workers[i].scratch;
+        Assert(set->arenas[0].current_block == set->arenas[0].head_block);
+        Assert(set->arenas[0].current_offset == sizeof(MagDynArenaBlock));
+    }
+
+    coy_threadpool_destroy(pool);
+#undef NUM_TEST_TASKS
+}
+
+typedef struct
+{
+    MagSlotArray *counts;
+    CoyBatchCompletion *bc;
+} CoyThreadPoolSlotTestTaskData;
+
+static inline void
+coy_thread_pool_slot_test_task_function(void *data)
+{
+    CoyThreadPoolSlotTestTaskData *td = data;
+
+    /* Only this worker ever touches its slot, so no atomics needed. */
+    size const index = coy_threadpool_worker_index();
+    Assert(index >= 0 && index < td->counts->num_slots);
+    *mag_slot_array_get_as(td->counts, index, i64) += 1;
+
+    coy_batch_completion_task_done(td->bc);
+}
+
+static void
+test_thread_pool_worker_slots(void)
+{
+#define NUM_TEST_TASKS 1000
+    CoyThreadPool pool_ = {0};
+    CoyThreadPool *pool = &pool_;
+    coy_threadpool_initialize(pool, 4);
+    Assert(coy_threadpool_worker_index() == -1);
+
+    MagDynArena arena = mag_dyn_arena_create(ECO_KiB(16));
+    MagSlotArray counts = eco_slot_array_create(&arena, pool->nthreads, i64);
+    Assert(counts.mem);
+
+    CoyThreadPoolSlotTestTaskData td[NUM_TEST_TASKS] = {0};
+    CoyFuture futures[NUM_TEST_TASKS] = {0};
+    CoyBatchCompletion bc = {0};
+    coy_batch_completion_init(&bc, pool);
+
+    for(i32 i = 0; i < NUM_TEST_TASKS; ++i)
+    {
+        td[i] = (CoyThreadPoolSlotTestTaskData){ .counts = &counts, .bc = &bc };
+        futures[i] = coy_future_create(coy_thread_pool_slot_test_task_function, &td[i]);
+        coy_batch_completion_task_submit(&bc, &futures[i]);
+    }
+
+    coy_batch_completion_wait(&bc);
+    coy_batch_completion_destroy(&bc);
+
+    i64 total = 0;
+    for(size i = 0; i < counts.num_slots; ++i) { total += *mag_slot_array_get_as(&counts, i, i64); }
+    Assert(total == NUM_TEST_TASKS);
+
+    coy_threadpool_destroy(pool);
+    mag_dyn_arena_destroy(&arena);
+#undef NUM_TEST_TASKS
+}
+
 /*---------------------------------------------------------------------------------------------------------------------------
  *                                                   All threads tests
  *-------------------------------------------------------------------------------------------------------------------------*/
@@ -584,6 +709,8 @@ coyote_threads_tests(void)
 
     fprintf(stderr,".thread pool..");
     test_thread_pool();
+    test_thread_pool_scratch();
+    test_thread_pool_worker_slots();
 
 }
 
@@ -0,0 +1,191 @@
+#include "test.h"
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *                                                  Test Math Functions
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+static void
+elk_test_kahan_accumulator(void)
+{
+    /* 1.0 is lost when naively added to 1.0e16, but the compensated sum should get it back. */
+    ElkKahanAccumulator acc = {0};
+    acc = elk_kahan_accumulator_add(acc, 1.0e16);
+    for(i32 i = 0; i < 1000; ++i) { acc = elk_kahan_accumulator_add(acc, 1.0); }
+    Assert(elk_kahan_accumulator_result(acc) == 1.0e16 + 1000.0);
+
+    /* Merging two halves should give the same answer. */
+    ElkKahanAccumulator a = {0};
+    ElkKahanAccumulator b = {0};
+    a = elk_kahan_accumulator_add(a, 1.0e16);
+    for(i32 i = 0; i < 500; ++i) { a = elk_kahan_accumulator_add(a, 1.0); }
+    for(i32 i = 0; i < 500; ++i) { b = elk_kahan_accumulator_add(b, 1.0); }
+    Assert(elk_kahan_accumulator_result(elk_kahan_accumulator_merge(a, b)) == 1.0e16 + 1000.0);
+}
+
+static void
+elk_test_kahan_sum(void)
+{
+    /* Check every length through a few vector widths to cover all the remainder handling. */
+    f64 data[200] = {0};
+    for(size n = 0; n < ECO_ARRAY_SIZE(data); ++n)
+    {
+        for(size i = 0; i < n; ++i) { data[i] = 0.25; }
+        data[0] = 1.0e16;
+
+        f64 expected = n > 0 ? 1.0e16 + (n - 1) * 0.25 : 0.0;
+        f64 sum = elk_kahan_sum_f64(n, data);
+        Assert(sum == expected);
+    }
+
+    /* Many small values where the naive sum drifts noticeably. */
+    static f64 tenths[1000000];
+    for(size i = 0; i < ECO_ARRAY_SIZE(tenths); ++i) { tenths[i] = 0.1; }
+    f64 tenths_sum = elk_kahan_sum_f64(ECO_ARRAY_SIZE(tenths), tenths);
+    Assert(tenths_sum > 100000.0 - 2.0e-11 && tenths_sum < 100000.0 + 2.0e-11);
+
+    /* Strided access into an array of structures. */
+    typedef struct { i32 id; f64 value; char name[12]; } Record;
+    Record records[123] = {0};
+    for(size i = 0; i < ECO_ARRAY_SIZE(records); ++i)
+    {
+        records[i].id = (i32)i;
+        records[i].value = i == 0 ? 1.0e16 : 1.0;
+    }
+
+    for(size n = 0; n <= ECO_ARRAY_SIZE(records); ++n)
+    {
+        f64 expected = n > 0 ? 1.0e16 + (n - 1) : 0.0;
+        f64 sum = elk_kahan_sum_strided_f64(n, records, offsetof(Record, value), sizeof(Record));
+        Assert(sum == expected);
+    }
+}
+
+static b32
+elk_test_close(f64 a, f64 b, f64 rel_tol)
+{
+    f64 const diff = a > b ? a - b : b - a;
+    f64 const mag = (a > 0.0 ? a : -a) > 1.0 ? (a > 0.0 ? a : -a) : 1.0;
+    return diff <= rel_tol * mag;
+}
+
+static void
+elk_test_statistics(void)
+{
+    static f64 const ELK_ZERO = 0.0;
+    f64 const nan = 0.0 / ELK_ZERO;
+
+    ElkRandomState state = elk_random_state_create(29);
+
+    /* A large offset makes the naive sum of squares approach fall apart, but not Welford's/Chan's. */
+    static f64 data[10007];
+    static f32 data32[10007];
+    for(size i = 0; i < ECO_ARRAY_SIZE(data); ++i)
+    {
+        data[i] = 1.0e6 + elk_random_state_uniform_f64(&state);
+        data32[i] = (f32)(100.0 + 10.0 * elk_random_state_uniform_f64(&state));
+    }
+    data[17] = nan;
+    data[5000] = nan;
+    data[10006] = nan;
+
+    /* Reference two pass values. */
+    size ref_count = 0;
+    f64 ref_sum = 0.0;
+    f64 ref_min = 2.0e6;
+    f64 ref_max = 0.0;
+    for(size i = 0; i < ECO_ARRAY_SIZE(data); ++i)
+    {
+        if(data[i] != data[i]) { continue; }
+        ref_count++;
+        ref_sum += data[i];
+        ref_min = data[i] < ref_min ? data[i] : ref_min;
+        ref_max = data[i] > ref_max ? data[i] : ref_max;
+    }
+    f64 const ref_mean = ref_sum / ref_count;
+    f64 ref_m2 = 0.0;
+    for(size i = 0; i < ECO_ARRAY_SIZE(data); ++i)
+    {
+        if(data[i] != data[i]) { continue; }
+        ref_m2 += (data[i] - ref_mean) * (data[i] - ref_mean);
+    }
+    f64 const ref_var = ref_m2 / (ref_count - 1);
+
+    ElkStatistics stats = elk_statistics_f64(ECO_ARRAY_SIZE(data), data);
+    Assert(stats.count == ref_count);
+    Assert(stats.nan_count == 3);
+    Assert(stats.min == ref_min);
+    Assert(stats.max == ref_max);
+    Assert(elk_test_close(stats.mean, ref_mean, 1.0e-14));
+    Assert(elk_test_close(elk_statistics_variance(stats), ref_var, 1.0e-9));
+
+    /* Merging the statistics of two uneven pieces should give the same thing. */
+    ElkStatistics a = elk_statistics_f64(3001, data);
+    ElkStatistics b = elk_statistics_f64(ECO_ARRAY_SIZE(data) - 3001, data + 3001);
+    ElkStatistics merged = elk_statistics_merge(a, b);
+    Assert(merged.count == ref_count);
+    Assert(merged.nan_count == 3);
+    Assert(merged.min == ref_min);
+    Assert(merged.max == ref_max);
+    Assert(elk_test_close(merged.mean, ref_mean, 1.0e-14));
+    Assert(elk_test_close(elk_statistics_variance(merged), ref_var, 1.0e-9));
+
+    /* One value at a time. */
+    ElkStatistics single = {0};
+    for(size i = 0; i < ECO_ARRAY_SIZE(data); ++i) { single = elk_statistics_add(single, data[i]); }
+    Assert(single.count == ref_count && single.nan_count == 3);
+    Assert(elk_test_close(single.mean, ref_mean, 1.0e-14));
+    Assert(elk_test_close(elk_statistics_variance(single), ref_var, 1.0e-9));
+
+    /* f32 should agree with adding them one at a time as f64. */
+    ElkStatistics stats32 = elk_statistics_f32(ECO_ARRAY_SIZE(data32), data32);
+    ElkStatistics single32 = {0};
+    for(size i = 0; i < ECO_ARRAY_SIZE(data32); ++i) { single32 = elk_statistics_add(single32, data32[i]); }
+    Assert(stats32.count == ECO_ARRAY_SIZE(data32) && stats32.nan_count == 0);
+    Assert(stats32.min == single32.min && stats32.max == single32.max);
+    Assert(elk_test_close(stats32.mean, single32.mean, 1.0e-12));
+    Assert(elk_test_close(elk_statistics_variance(stats32), elk_statistics_variance(single32), 1.0e-10));
+
+    /* Strided access into an array of structures, for every length through a couple of blocks. */
+    typedef struct { i32 id; f32 value32; f64 value; } Record;
+    static Record records[300];
+    for(size i = 0; i < ECO_ARRAY_SIZE(records); ++i)
+    {
+        records[i].id = (i32)i;
+        records[i].value = data[i];
+        records[i].value32 = data32[i];
+    }
+
+    for(size n = 0; n <= ECO_ARRAY_SIZE(records); ++n)
+    {
+        ElkStatistics expected = elk_statistics_f64(n, data);
+        ElkStatistics strided = elk_statistics_strided_f64(n, records, offsetof(Record, value), sizeof(Record));
+        Assert(strided.count == expected.count && strided.nan_count == expected.nan_count);
+        if(expected.count > 0)
+        {
+            Assert(strided.min == expected.min && strided.max == expected.max);
+            Assert(elk_test_close(strided.mean, expected.mean, 1.0e-14));
+            Assert(elk_test_close(strided.m2, expected.m2, 1.0e-9));
+        }
+
+        ElkStatistics expected32 = elk_statistics_f32(n, data32);
+        ElkStatistics strided32 = elk_statistics_strided_f32(n, records, offsetof(Record, value32), sizeof(Record));
+        Assert(strided32.count == expected32.count && strided32.nan_count == 0);
+        Assert(elk_test_close(strided32.mean, expected32.mean, 1.0e-12));
+    }
+
+    /* All NaN. */
+    f64 nans[100];
+    for(size i = 0; i < ECO_ARRAY_SIZE(nans); ++i) { nans[i] = nan; }
+    ElkStatistics nan_stats = elk_statistics_f64(ECO_ARRAY_SIZE(nans), nans);
+    Assert(nan_stats.count == 0 && nan_stats.nan_count == 100);
+    Assert(elk_statistics_variance(nan_stats) == 0.0);
+}
+
+void
+elk_math_tests(void)
+{
+    elk_test_kahan_accumulator();
+    elk_test_kahan_sum();
+    elk_test_statistics();
+}
@@ -140,6 +140,167 @@ elk_test_random_f64_avx512(void)
 
 #endif
 
+static void
+elk_test_random_skip(void)
+{
+    ElkRandomState stepped_ = elk_random_state_create(42);
+    ElkRandomState *stepped = &stepped_;
+    ElkRandomState skipped = *stepped;
+
+    for(size i = 0; i < 1000; ++i) { elk_random_state_uniform_u64(stepped); }
+    elk_random_state_skip(&skipped, 1000);
+
+    for(size i = 0; i < 100; ++i)
+    {
+        Assert(elk_random_state_uniform_u64(stepped) == elk_random_state_uniform_u64(&skipped));
+    }
+}
+
+static void
+elk_test_random_split(void)
+{
+    ElkRandomState parent = elk_random_state_create(42);
+    ElkRandomState const parent_copy = parent;
+
+    ElkRandomState a = elk_random_state_split(&parent, 0);
+    ElkRandomState b = elk_random_state_split(&parent, 1);
+    ElkRandomState a_again = elk_random_state_split(&parent, 0);
+
+    /* The parent is untouched and splitting is reproducible. */
+    Assert(parent.key == parent_copy.key && parent.counter == parent_copy.counter);
+    Assert(a.key == a_again.key && a.counter == a_again.counter);
+
+    /* Different streams give different sequences. */
+    b32 any_different = false;
+    for(size i = 0; i < 100; ++i)
+    {
+        u64 va = elk_random_state_uniform_u64(&a);
+        u64 vb = elk_random_state_uniform_u64(&b);
+        any_different |= va != vb;
+    }
+    Assert(any_different);
+
+    /* Splitting a child gives different streams than splitting the parent with the same id. */
+    ElkRandomState grand_child = elk_random_state_split(&a_again, 1);
+    Assert(grand_child.key != b.key || grand_child.counter != b.counter);
+
+    /* Tasks get the same numbers regardless of how the tasks are grouped. Do 64 tasks of 1000 numbers each, first in order
+     * and then in reverse order, interleaved a value at a time, like several threads might run them. */
+#define NUM_TASKS 64
+#define NUM_PER_TASK 1000
+    u64 sums_forward[NUM_TASKS] = {0};
+    for(u64 t = 0; t < NUM_TASKS; ++t)
+    {
+        ElkRandomState task = elk_random_state_split(&parent, t);
+        for(size i = 0; i < NUM_PER_TASK; ++i) { sums_forward[t] += elk_random_state_uniform_u64(&task); }
+    }
+
+    u64 sums_interleaved[NUM_TASKS] = {0};
+    ElkRandomState tasks[NUM_TASKS] = {0};
+    for(u64 t = 0; t < NUM_TASKS; ++t) { tasks[NUM_TASKS - 1 - t] = elk_random_state_split(&parent, NUM_TASKS - 1 - t); }
+    for(size i = 0; i < NUM_PER_TASK; ++i)
+    {
+        for(u64 t = 0; t < NUM_TASKS; ++t) { sums_interleaved[t] += elk_random_state_uniform_u64(&tasks[t]); }
+    }
+
+    for(u64 t = 0; t < NUM_TASKS; ++t) { Assert(sums_forward[t] == sums_interleaved[t]); }
+#undef NUM_TASKS
+#undef NUM_PER_TASK
+
+#if __AVX2__
+    ElkAVX2RandomState avx2 = elk_avx2_random_state_split(&parent, 3);
+    elk_avx2_random_state_skip(&avx2, 10);
+    ElkM256iPun avx2_vals = { .vec = elk_avx2_random_state_uniform_u64(&avx2) };
+    for(u64 i = 0; i < 4; ++i)
+    {
+        ElkRandomState lane = elk_random_state_split(&parent, 4 * 3 + i);
+        elk_random_state_skip(&lane, 10);
+        Assert(avx2_vals.arr[i] == elk_random_state_uniform_u64(&lane));
+    }
+#endif
+
+#if ELK_AVX_512
+    ElkAVX512RandomState avx512 = elk_avx512_random_state_split(&parent, 3);
+    elk_avx512_random_state_skip(&avx512, 10);
+    ElkM512iPun avx512_vals = { .vec = elk_avx512_random_state_uniform_u64(&avx512) };
+    for(u64 i = 0; i < 8; ++i)
+    {
+        ElkRandomState lane = elk_random_state_split(&parent, 8 * 3 + i);
+        elk_random_state_skip(&lane, 10);
+        Assert(avx512_vals.arr[i] == elk_random_state_uniform_u64(&lane));
+    }
+#endif
+}
+
+static void
+elk_test_random_bounded(void)
+{
+    ElkRandomState state_ = elk_random_state_create(7);
+    ElkRandomState *state = &state_;
+
+#define NUM_BINS 10
+#define NUM_DRAWS 1000000
+    i64 counts[NUM_BINS] = {0};
+    for(size i = 0; i < NUM_DRAWS; ++i)
+    {
+        u64 val = elk_random_state_uniform_bounded_u64(state, NUM_BINS);
+        Assert(val < NUM_BINS);
+        counts[val] += 1;
+    }
+    for(size i = 0; i < NUM_BINS; ++i) { Assert(counts[i] > 95000 && counts[i] < 105000); }
+
+    /* The whole range is still reachable for large bounds. */
+    u64 const big = UINT64_MAX - 5;
+    for(size i = 0; i < 1000; ++i) { Assert(elk_random_state_uniform_bounded_u64(state, big) < big); }
+    Assert(elk_random_state_uniform_bounded_u64(state, 1) == 0);
+
+    i64 counts0[NUM_BINS] = {0};
+    i64 counts1[3] = {0};
+    for(size i = 0; i < NUM_DRAWS; ++i)
+    {
+        u64 v0 = 0, v1 = 0;
+        elk_random_state_uniform_bounded_pair_u64(state, NUM_BINS, 3, &v0, &v1);
+        Assert(v0 < NUM_BINS && v1 < 3);
+        counts0[v0] += 1;
+        counts1[v1] += 1;
+    }
+    for(size i = 0; i < NUM_BINS; ++i) { Assert(counts0[i] > 95000 && counts0[i] < 105000); }
+    for(size i = 0; i < 3; ++i) { Assert(counts1[i] > 323333 && counts1[i] < 343333); }
+
+#if __AVX2__
+    ElkAVX2RandomState avx2 = elk_avx2_random_state_create(7);
+    i64 avx2_counts[NUM_BINS] = {0};
+    for(size i = 0; i < NUM_DRAWS / 4; ++i)
+    {
+        ElkM256iPun vals = { .vec = elk_avx2_random_state_uniform_bounded_u32(&avx2, NUM_BINS) };
+        for(i32 j = 0; j < 4; ++j)
+        {
+            Assert(vals.arr[j] < NUM_BINS);
+            avx2_counts[vals.arr[j]] += 1;
+        }
+    }
+    for(size i = 0; i < NUM_BINS; ++i) { Assert(avx2_counts[i] > 95000 && avx2_counts[i] < 105000); }
+#endif
+
+#if ELK_AVX_512
+    ElkAVX512RandomState avx512 = elk_avx512_random_state_create(7);
+    i64 avx512_counts[NUM_BINS] = {0};
+    for(size i = 0; i < NUM_DRAWS / 8; ++i)
+    {
+        ElkM512iPun vals = { .vec = elk_avx512_random_state_uniform_bounded_u32(&avx512, NUM_BINS) };
+        for(i32 j = 0; j < 8; ++j)
+        {
+            Assert(vals.arr[j] < NUM_BINS);
+            avx512_counts[vals.arr[j]] += 1;
+        }
+    }
+    for(size i = 0; i < NUM_BINS; ++i) { Assert(avx512_counts[i] > 95000 && avx512_counts[i] < 105000); }
+#endif
+
+#undef NUM_BINS
+#undef NUM_DRAWS
+}
+
 /*---------------------------------------------------------------------------------------------------------------------------
  *                                                       All tests
  *-------------------------------------------------------------------------------------------------------------------------*/
@@ -147,6 +308,9 @@ void
 elk_random_tests(void)
 {
     elk_test_random_f64();
+    elk_test_random_skip();
+    elk_test_random_split();
+    elk_test_random_bounded();
 
 #if __AVX2__
     elk_test_random_f64_avx2();
@@ -253,6 +253,32 @@ test_dynamic_arena_realloc(void)
     mag_dyn_arena_destroy(arena);
 }
 
+static void
+test_dynamic_arena_realloc_other_block(void)
+{
+    MagDynArena arena_instance = mag_dyn_arena_create(ECO_KiB(4));
+    MagDynArena *arena = &arena_instance;
+
+    /* The head block is nearly full, so this one goes into a new block. */
+    Assert(mag_dyn_arena_nmalloc(arena, arena->head_block->buf.size - arena->current_offset - 100, byte));
+    byte *second = mag_dyn_arena_nmalloc(arena, ECO_KiB(2), byte);
+    Assert(second && arena->current_block != arena->head_block);
+    memset(second, 0x5A, ECO_KiB(2));
+
+    /* Not the last allocation anymore, so it has to be copied. */
+    Assert(mag_dyn_arena_nmalloc(arena, 16, byte));
+    byte *grown = mag_dyn_arena_nrealloc(arena, second, ECO_KiB(3), byte);
+    Assert(grown && grown != second);
+    for(i32 i = 0; i < ECO_KiB(2); ++i) { Assert(grown[i] == (byte)0x5A); }
+
+    /* Now second is in a block that isn't the current one either. */
+    byte *moved = mag_dyn_arena_nrealloc(arena, second, ECO_KiB(3), byte);
+    Assert(moved && moved != second);
+    for(i32 i = 0; i < ECO_KiB(2); ++i) { Assert(moved[i] == (byte)0x5A); }
+
+    mag_dyn_arena_destroy(arena);
+}
+
 static void
 test_static_arena_free(void)
 {
@@ -364,6 +390,947 @@ test_static_arena_save_point(void)
     mag_static_arena_destroy(arena);
 }
 
+typedef struct
+{
+    size next; /* Offsets, not pointers, so they still work after the file is mapped somewhere else. */
+    i64 value;
+} TestFileArenaNode;
+
+typedef struct
+{
+    size head;
+    size count;
+} TestFileArenaRoot;
+
+static void
+test_static_arena_file(void)
+{
+    char path[1024] = {0};
+    Assert(coy_path_append(sizeof(path), path, test_data_dir));
+    Assert(coy_path_append(sizeof(path), path, "persistent_arena.bin"));
+    remove(path);
+
+    /* Build a list in a new file. */
+    MagStaticArena arena = mag_static_arena_open_file(path, ECO_KiB(64));
+    Assert(MAG_MEM_IS_VALID(arena.buf) && MAG_MEM_IS_FILE_MAPPED(arena.buf) && arena.buf.size >= ECO_KiB(64));
+    Assert(!mag_static_arena_root(&arena));
+
+    TestFileArenaRoot *root = mag_static_arena_malloc(&arena, TestFileArenaRoot);
+    Assert(root && mag_static_arena_offset_of(&arena, root) > 0);
+    for(i64 i = 0; i < 1000; ++i)
+    {
+        TestFileArenaNode *node = mag_static_arena_malloc(&arena, TestFileArenaNode);
+        Assert(node);
+        node->value = i * i;
+        node->next = root->head;
+        root->head = mag_static_arena_offset_of(&arena, node);
+        root->count += 1;
+    }
+
+    mag_static_arena_set_root(&arena, root);
+    Assert(mag_static_arena_root(&arena) == root);
+    Assert(mag_static_arena_sync(&arena));
+    size const offset = arena.buf_offset;
+    mag_static_arena_destroy(&arena);
+    Assert(!MAG_MEM_IS_VALID(arena.buf));
+
+    /* Open it again, everything is still there and new allocations go after it. */
+    arena = mag_static_arena_open_file(path, ECO_KiB(4));
+    Assert(MAG_MEM_IS_VALID(arena.buf) && arena.buf.size >= ECO_KiB(64) && arena.buf_offset == offset);
+
+    root = mag_static_arena_root(&arena);
+    Assert(root && root->count == 1000);
+    i64 expected = 999;
+    TestFileArenaNode *node = mag_static_arena_ptr_at(&arena, root->head);
+    for(; node; node = mag_static_arena_ptr_at(&arena, node->next))
+    {
+        Assert(node->value == expected * expected);
+        --expected;
+    }
+    Assert(expected == -1);
+
+    i64 *extra = mag_static_arena_nmalloc(&arena, 10, i64);
+    Assert(extra && mag_static_arena_offset_of(&arena, extra) >= offset);
+    mag_static_arena_destroy(&arena);
+
+    /* A bigger size grows the file, the data stays. */
+    arena = mag_static_arena_open_file(path, ECO_MiB(1));
+    Assert(arena.buf.size >= ECO_MiB(1) && arena.buf_offset > offset);
+    root = mag_static_arena_root(&arena);
+    Assert(root && root->count == 1000);
+
+    /* Resetting leaves the header alone. */
+    mag_static_arena_reset(&arena);
+    Assert(!mag_static_arena_root(&arena) && arena.buf_offset > 0);
+    byte *first = mag_static_arena_nmalloc(&arena, 10, byte);
+    Assert(first && mag_static_arena_offset_of(&arena, first) > 0);
+    mag_static_arena_destroy(&arena);
+
+    arena = mag_static_arena_open_file(path, ECO_KiB(4));
+    Assert(MAG_MEM_IS_VALID(arena.buf) && !mag_static_arena_root(&arena));
+    mag_static_arena_destroy(&arena);
+
+    /* Files that aren't arenas are left alone. */
+    CoyFileWriter writer = coy_file_create(path);
+    Assert(writer.valid);
+    char const junk[] = "This is not an arena, it is just some text in a file.";
+    Assert(coy_file_write(&writer, sizeof(junk), junk) == sizeof(junk));
+    coy_file_writer_close(&writer);
+
+    arena = mag_static_arena_open_file(path, ECO_KiB(4));
+    Assert(!MAG_MEM_IS_VALID(arena.buf));
+    Assert(coy_file_size(path) == sizeof(junk));
+
+    remove(path);
+}
+
+typedef struct { i16 x, y, z; } TestArraysVec;
+
+static void
+test_arrays_fill(size count, u8 *tags, f64 *values, TestArraysVec *vecs)
+{
+    for(size i = 0; i < count; ++i)
+    {
+        tags[i] = (u8)i;
+        values[i] = (f64)i * 0.5;
+        vecs[i] = (TestArraysVec){ .x = (i16)i, .y = (i16)-i, .z = 7 };
+    }
+}
+
+static void
+test_arrays_check(size count, size num_filled, u8 *tags, f64 *values, TestArraysVec *vecs)
+{
+    /* Each array starts on a cache line and they don't overlap. */
+    Assert(((uptr)tags % MAG_ARRAYS_ALIGN) == 0 && ((uptr)values % MAG_ARRAYS_ALIGN) == 0);
+    Assert(((uptr)vecs % MAG_ARRAYS_ALIGN) == 0);
+    Assert((byte *)(tags + count) <= (byte *)values && (byte *)(values + count) <= (byte *)vecs);
+
+    for(size i = 0; i < num_filled; ++i)
+    {
+        Assert(tags[i] == (u8)i && values[i] == (f64)i * 0.5);
+        Assert(vecs[i].x == (i16)i && vecs[i].y == (i16)-i && vecs[i].z == 7);
+    }
+
+    for(size i = num_filled; i < count; ++i) { Assert(tags[i] == 0 && values[i] == 0.0 && vecs[i].z == 0); }
+}
+
+static void
+test_arena_arrays(void)
+{
+    u8 *tags = NULL;
+    f64 *values = NULL;
+    TestArraysVec *vecs = NULL;
+    MagArraySpec arrays[] = { MAG_ARRAY_SPEC(tags), MAG_ARRAY_SPEC(values), MAG_ARRAY_SPEC(vecs) };
+    size const num_arrays = ECO_ARRAY_SIZE(arrays);
+
+    /* Dynamic arena, growing in place and shrinking. */
+    MagDynArena dyn_instance = mag_dyn_arena_create(ECO_KiB(64));
+    MagDynArena *dyn = &dyn_instance;
+
+    Assert(eco_arrays_alloc(dyn, 100, num_arrays, arrays));
+    test_arrays_check(100, 0, tags, values, vecs);
+    test_arrays_fill(100, tags, values, vecs);
+
+    u8 *const first = tags;
+    Assert(eco_arrays_realloc(dyn, 100, 1000, num_arrays, arrays));
+    Assert(tags == first);
+    test_arrays_check(1000, 100, tags, values, vecs);
+
+    test_arrays_fill(1000, tags, values, vecs);
+    Assert(eco_arrays_realloc(dyn, 1000, 30, num_arrays, arrays));
+    Assert(tags == first);
+    test_arrays_check(30, 30, tags, values, vecs);
+
+    /* Something else in the way, so they have to be copied. */
+    Assert(mag_dyn_arena_nmalloc(dyn, 10, f64));
+    Assert(eco_arrays_realloc(dyn, 30, 3000, num_arrays, arrays));
+    Assert(tags != first);
+    test_arrays_check(3000, 30, tags, values, vecs);
+
+    mag_dyn_arena_destroy(dyn);
+
+    /* Static arena, failing leaves everything alone. */
+    _Alignas(MAG_ARRAYS_ALIGN) byte buffer[ECO_KiB(4)];
+    MagStaticArena static_instance = mag_static_arena_create(sizeof(buffer), buffer);
+    MagStaticArena *static_arena = &static_instance;
+
+    Assert(eco_arrays_alloc(static_arena, 50, num_arrays, arrays));
+    test_arrays_fill(50, tags, values, vecs);
+    u8 *const static_tags = tags;
+    f64 *const static_values = values;
+    Assert(!eco_arrays_realloc(static_arena, 50, 10000, num_arrays, arrays));
+    Assert(tags == static_tags && values == static_values);
+    test_arrays_check(50, 50, tags, values, vecs);
+    Assert(eco_arrays_realloc(static_arena, 50, 200, num_arrays, arrays));
+    test_arrays_check(200, 50, tags, values, vecs);
+
+    /* Freeing the first array frees them all. */
+    eco_arena_free(static_arena, tags);
+    Assert(static_arena->buf_offset == 0);
+
+    /* TLSF through a MagAllocator gives the tail back when they shrink. */
+    MagAllocator alloc_instance = mag_allocator_tlsf_create(ECO_MiB(1));
+    MagAllocator *alloc = &alloc_instance;
+
+    Assert(eco_arrays_alloc(alloc, 5000, num_arrays, arrays));
+    test_arrays_fill(5000, tags, values, vecs);
+    Assert(eco_arrays_realloc(alloc, 5000, 40, num_arrays, arrays));
+    test_arrays_check(40, 40, tags, values, vecs);
+    Assert(mag_tlsf_usable_size(tags) < 2000);
+
+    Assert(mag_allocator_nmalloc(alloc, 10, f64));
+    Assert(eco_arrays_realloc(alloc, 40, 4000, num_arrays, arrays));
+    test_arrays_check(4000, 40, tags, values, vecs);
+    eco_arena_free(alloc, tags);
+
+    eco_arena_destroy(alloc);
+
+    /* The same calls work on the allocators directly. */
+    MagVirtualArena virtual_instance = mag_virtual_arena_create(ECO_MiB(16));
+    MagVirtualArena *virtual_arena = &virtual_instance;
+
+    Assert(eco_arrays_alloc(virtual_arena, 100, num_arrays, arrays));
+    test_arrays_fill(100, tags, values, vecs);
+    Assert(eco_arrays_realloc(virtual_arena, 100, 20000, num_arrays, arrays));
+    test_arrays_check(20000, 100, tags, values, vecs);
+    eco_arena_destroy(virtual_arena);
+
+    MagTlsf tlsf_instance = mag_tlsf_create(ECO_MiB(1));
+    MagTlsf *tlsf = &tlsf_instance;
+
+    Assert(eco_arrays_alloc(tlsf, 100, num_arrays, arrays));
+    test_arrays_fill(100, tags, values, vecs);
+    Assert(eco_arrays_realloc(tlsf, 100, 20, num_arrays, arrays));
+    test_arrays_check(20, 20, tags, values, vecs);
+    eco_arena_free(tlsf, tags);
+    eco_arena_destroy(tlsf);
+
+    MagConcurrentArena concurrent_instance = mag_concurrent_arena_create(ECO_KiB(64));
+    MagConcurrentArena *concurrent = &concurrent_instance;
+
+    Assert(eco_arrays_alloc(concurrent, 100, num_arrays, arrays));
+    test_arrays_check(100, 0, tags, values, vecs);
+    eco_arena_destroy(concurrent);
+}
+
+static void
+test_arena_cacheline(void)
+{
+    MagDynArena dyn_instance = mag_dyn_arena_create(ECO_KiB(64));
+    MagDynArena *dyn = &dyn_instance;
+    MagAllocator alloc_instance = mag_allocator_tlsf_create(ECO_KiB(64));
+    MagAllocator *alloc = &alloc_instance;
+
+    /* Back to back allocations never share a cache line. */
+    byte *a = eco_arena_alloc_cacheline(dyn, 1);
+    byte *b = mag_dyn_arena_alloc_cacheline(dyn, 65);
+    i32 *c = eco_arena_nmalloc_cacheline(dyn, 3, i32);
+    Assert(a && b && c);
+    Assert(((uptr)a % MAG_CACHE_LINE_SIZE) == 0 && ((uptr)b % MAG_CACHE_LINE_SIZE) == 0);
+    Assert(((uptr)c % MAG_CACHE_LINE_SIZE) == 0);
+    Assert(b - a == MAG_CACHE_LINE_SIZE && (byte *)c - b == 2 * MAG_CACHE_LINE_SIZE);
+    Assert(mag_dyn_arena_malloc(dyn, byte) >= (byte *)c + MAG_CACHE_LINE_SIZE);
+
+    byte *d = eco_arena_alloc_cacheline(alloc, 10);
+    byte *e = mag_allocator_alloc_cacheline(alloc, 10);
+    Assert(d && e && ((uptr)d % MAG_CACHE_LINE_SIZE) == 0 && ((uptr)e % MAG_CACHE_LINE_SIZE) == 0);
+    Assert(e >= d + MAG_CACHE_LINE_SIZE || d >= e + MAG_CACHE_LINE_SIZE);
+
+    /* One padded slot per thread. */
+    MagSlotArray slots = eco_slot_array_create(dyn, 5, i64);
+    Assert(slots.mem && slots.num_slots == 5 && slots.stride == MAG_FALSE_SHARING_SIZE);
+    Assert(((uptr)slots.mem % MAG_FALSE_SHARING_SIZE) == 0);
+    for(size i = 0; i < slots.num_slots; ++i)
+    {
+        i64 *slot = mag_slot_array_get_as(&slots, i, i64);
+        Assert(*slot == 0 && (byte *)slot - slots.mem == i * MAG_FALSE_SHARING_SIZE);
+        *slot = i;
+    }
+
+    typedef struct { f64 values[20]; } TestBigSlot;
+    MagSlotArray big = eco_slot_array_create(alloc, 3, TestBigSlot);
+    Assert(big.mem && big.stride == 2 * MAG_FALSE_SHARING_SIZE);
+    mag_slot_array_get_as(&big, 2, TestBigSlot)->values[19] = 1.0;
+
+    /* Out of memory. */
+    _Alignas(MAG_CACHE_LINE_SIZE) byte buffer[256];
+    MagStaticArena static_instance = mag_static_arena_create(sizeof(buffer), buffer);
+    Assert(mag_static_arena_alloc_cacheline(&static_instance, 200));
+    Assert(!mag_static_arena_alloc_cacheline(&static_instance, 1));
+    Assert(!eco_slot_array_create(&static_instance, 1, i64).mem);
+
+    eco_arena_destroy(alloc);
+    mag_dyn_arena_destroy(dyn);
+}
+
+static void
+test_arena_savepoints(void)
+{
+    /* Static arena. */
+    _Alignas(_Alignof(f64)) byte buffer[100 * sizeof(f64)];
+    MagStaticArena static_instance = mag_static_arena_create(sizeof(buffer), buffer);
+    MagStaticArena *static_arena = &static_instance;
+
+    f64 *keep = mag_static_arena_nmalloc(static_arena, 10, f64);
+    Assert(keep);
+    size const static_offset = static_arena->buf_offset;
+
+    MagArenaSavepoint sp = mag_static_arena_savepoint(static_arena);
+    f64 *temp = mag_static_arena_nmalloc(static_arena, 50, f64);
+    Assert(temp && static_arena->buf_offset > static_offset);
+    mag_static_arena_restore(static_arena, sp);
+    Assert(static_arena->buf_offset == static_offset);
+
+    /* The last allocation before the savepoint can still grow in place. */
+    f64 *grown = mag_static_arena_nrealloc(static_arena, keep, 20, f64);
+    Assert(grown == keep);
+    mag_static_arena_destroy(static_arena);
+
+    /* Dynamic arena, the temporary allocations spill into new blocks that get reused after the restore. */
+    MagDynArena dyn_instance = mag_dyn_arena_create(ECO_KiB(4));
+    MagDynArena *dyn_arena = &dyn_instance;
+
+    i32 *first = mag_dyn_arena_nmalloc(dyn_arena, 100, i32);
+    Assert(first);
+    for(i32 i = 0; i < 100; ++i) { first[i] = i; }
+
+    sp = mag_dyn_arena_savepoint(dyn_arena);
+    MagDynArenaBlock *saved_block = dyn_arena->current_block;
+    i32 *big = mag_dyn_arena_nmalloc(dyn_arena, ECO_KiB(8), i32);
+    Assert(big && dyn_arena->current_block != saved_block);
+    size const ceiling = mag_dyn_arena_usage_ceiling(dyn_arena);
+
+    mag_dyn_arena_restore(dyn_arena, sp);
+    Assert(dyn_arena->current_block == saved_block);
+
+    i32 *big_again = mag_dyn_arena_nmalloc(dyn_arena, ECO_KiB(8), i32);
+    Assert(big_again == big);
+    Assert(mag_dyn_arena_usage_ceiling(dyn_arena) == ceiling);
+    for(i32 i = 0; i < 100; ++i) { Assert(first[i] == i); }
+    mag_dyn_arena_destroy(dyn_arena);
+
+    /* Virtual arena, re-used memory is still zeroed. */
+    MagVirtualArena virt_instance = mag_virtual_arena_create(ECO_MiB(16));
+    MagVirtualArena *virt_arena = &virt_instance;
+
+    sp = mag_virtual_arena_savepoint(virt_arena);
+    byte *dirty = mag_virtual_arena_nmalloc(virt_arena, 1000, byte);
+    Assert(dirty);
+    memset(dirty, 0xFF, 1000);
+    mag_virtual_arena_restore(virt_arena, sp);
+    Assert(virt_arena->buf_offset == 0);
+
+    byte *clean = mag_virtual_arena_nmalloc(virt_arena, 1000, byte);
+    Assert(clean == dirty);
+    for(size i = 0; i < 1000; ++i) { Assert(clean[i] == 0); }
+    mag_virtual_arena_destroy(virt_arena);
+
+    /* Through the generic interfaces. */
+    MagAllocator alloc = mag_allocator_dyn_arena_create(ECO_KiB(4));
+    sp = eco_arena_savepoint(&alloc);
+    Assert(eco_arena_nmalloc(&alloc, 1000, f64));
+    eco_arena_restore(&alloc, sp);
+    Assert(alloc.dyn_arena.current_block == alloc.dyn_arena.head_block);
+    Assert(alloc.dyn_arena.current_offset == sizeof(MagDynArenaBlock));
+    mag_allocator_destroy(&alloc);
+}
+
+static f64 *
+test_scratch_make_squares(i32 n, MagDynArena *out)
+{
+    /* Uses scratch memory while putting the results in out, which may itself be a scratch arena. */
+    MagScratch scratch = mag_scratch_begin(out);
+    Assert(scratch.arena != out);
+
+    i32 *temp = mag_dyn_arena_nmalloc(scratch.arena, n, i32);
+    Assert(temp);
+    for(i32 i = 0; i < n; ++i) { temp[i] = i * i; }
+
+    f64 *results = mag_dyn_arena_nmalloc(out, n, f64);
+    Assert(results);
+    for(i32 i = 0; i < n; ++i) { results[i] = (f64)temp[i]; }
+
+    mag_scratch_end(scratch);
+
+    return results;
+}
+
+static void
+test_scratch_arenas(void)
+{
+    Assert(!mag_scratch_set_bound());
+
+    MagScratchSet set = mag_scratch_set_create(ECO_KiB(64));
+    mag_scratch_set_bind(&set);
+    Assert(mag_scratch_set_bound() == &set);
+
+    MagScratch outer = mag_scratch_begin(NULL);
+    Assert(outer.arena == &set.arenas[0]);
+
+    /* Results go in the outer scratch arena, so the inner scratch has to come from the other one. */
+    f64 *squares = test_scratch_make_squares(1000, outer.arena);
+    Assert(set.arenas[1].current_offset == sizeof(MagDynArenaBlock));
+    for(i32 i = 0; i < 1000; ++i) { Assert(squares[i] == (f64)(i * i)); }
+
+    mag_scratch_end(outer);
+    Assert(set.arenas[0].current_offset == sizeof(MagDynArenaBlock));
+
+    mag_scratch_set_destroy(&set);
+    Assert(!mag_scratch_set_bound());
+}
+
+static void
+test_arena_alloc_uninit(void)
+{
+    _Alignas(_Alignof(i32)) byte buffer[100 * sizeof(i32)];
+    MagStaticArena static_instance = mag_static_arena_create(sizeof(buffer), buffer);
+    MagStaticArena *static_arena = &static_instance;
+
+    MagDynArena dyn_instance = mag_dyn_arena_create(100 * sizeof(i32));
+    MagDynArena *dyn_arena = &dyn_instance;
+
+    MagAllocator alloc_instance = mag_allocator_dyn_arena_create(100 * sizeof(i32));
+    MagAllocator *alloc = &alloc_instance;
+
+    /* Fill some memory, free it, and get the same memory back uninitialized, then zeroed. */
+    i32 *first = eco_arena_nmalloc(static_arena, 10, i32);
+    for(i32 i = 0; i < 10; ++i) { first[i] = i + 1; }
+    eco_arena_free(static_arena, first);
+
+    i32 *second = eco_arena_nmalloc_uninit(static_arena, 10, i32);
+    Assert(second == first);
+    for(i32 i = 0; i < 10; ++i) { Assert(second[i] == i + 1); }
+    eco_arena_free(static_arena, second);
+
+    i32 *third = eco_arena_nmalloc(static_arena, 10, i32);
+    Assert(third == first);
+    for(i32 i = 0; i < 10; ++i) { Assert(third[i] == 0); }
+
+    first = eco_arena_nmalloc(dyn_arena, 10, i32);
+    for(i32 i = 0; i < 10; ++i) { first[i] = i + 1; }
+    eco_arena_free(dyn_arena, first);
+
+    second = eco_arena_nmalloc_uninit(dyn_arena, 10, i32);
+    Assert(second == first);
+    for(i32 i = 0; i < 10; ++i) { Assert(second[i] == i + 1); }
+    eco_arena_free(dyn_arena, second);
+
+    third = eco_arena_nmalloc(dyn_arena, 10, i32);
+    Assert(third == first);
+    for(i32 i = 0; i < 10; ++i) { Assert(third[i] == 0); }
+
+    first = eco_arena_nmalloc(alloc, 10, i32);
+    for(i32 i = 0; i < 10; ++i) { first[i] = i + 1; }
+    eco_arena_free(alloc, first);
+
+    second = eco_arena_nmalloc_uninit(alloc, 10, i32);
+    Assert(second == first);
+    for(i32 i = 0; i < 10; ++i) { Assert(second[i] == i + 1); }
+    eco_arena_free(alloc, second);
+
+    third = eco_arena_nmalloc(alloc, 10, i32);
+    Assert(third == first);
+    for(i32 i = 0; i < 10; ++i) { Assert(third[i] == 0); }
+
+    /* Moving realloc on a dynamic arena still keeps the contents. */
+    i32 *small = eco_arena_nmalloc_uninit(dyn_arena, 10, i32);
+    for(i32 i = 0; i < 10; ++i) { small[i] = i; }
+    i32 *blocker = eco_arena_malloc(dyn_arena, i32);
+    Assert(blocker);
+    i32 *big = eco_arena_nrealloc(dyn_arena, small, 1000, i32);
+    Assert(big && big != small);
+    for(i32 i = 0; i < 10; ++i) { Assert(big[i] == i); }
+
+    eco_arena_destroy(alloc);
+    eco_arena_destroy(dyn_arena);
+    eco_arena_destroy(static_arena);
+}
+
+static void
+test_virtual_arena(void)
+{
+    MagVirtualArena arena_instance = mag_virtual_arena_create(ECO_GiB(8));
+    MagVirtualArena *arena = &arena_instance;
+    Assert(MAG_MEM_IS_VALID(arena->buf));
+    Assert(arena->committed == 0);
+
+    /* Small allocations only commit a little memory. */
+    i32 *small = mag_virtual_arena_nmalloc(arena, 10, i32);
+    Assert(small);
+    Assert(arena->committed > 0 && arena->committed <= MAG_VIRTUAL_ARENA_COMMIT_CHUNK);
+    for(i32 i = 0; i < 10; ++i) { Assert(small[i] == 0); small[i] = i; }
+
+    /* Growing the last allocation never moves it, even across many commit chunks. */
+    i32 *grown = mag_virtual_arena_nrealloc(arena, small, ECO_MiB(10), i32);
+    Assert(grown == small);
+    for(i32 i = 0; i < 10; ++i) { Assert(grown[i] == i); }
+    grown[ECO_MiB(10) - 1] = 42;
+    Assert(arena->committed >= ECO_MiB(40));
+
+    /* Allocations are contiguous. */
+    f64 *next = mag_virtual_arena_malloc(arena, f64);
+    Assert((byte *)next >= (byte *)(grown + ECO_MiB(10)) && (byte *)next < (byte *)(grown + ECO_MiB(10)) + sizeof(f64));
+
+    /* Memory that is reused without a decommit must still be zeroed. */
+    mag_virtual_arena_reset(arena, false);
+    Assert(arena->committed >= ECO_MiB(40));
+    i32 *reused = mag_virtual_arena_nmalloc(arena, ECO_MiB(10), i32);
+    Assert(reused == small);
+    Assert(reused[0] == 0 && reused[9] == 0 && reused[ECO_MiB(10) - 1] == 0);
+
+    /* Uninitialized allocations don't clear it. */
+    reused[5] = 5;
+    mag_virtual_arena_reset(arena, false);
+    i32 *uninit = mag_virtual_arena_nmalloc_uninit(arena, 10, i32);
+    Assert(uninit[5] == 5);
+
+    /* Decommitting gives the memory back, and it comes back zeroed. */
+    mag_virtual_arena_reset_default(arena);
+    Assert(arena->committed == 0);
+    i32 *fresh = mag_virtual_arena_nmalloc(arena, 10, i32);
+    Assert(fresh == small && fresh[5] == 0);
+
+    /* Asking for more than was reserved fails. */
+    Assert(!mag_virtual_arena_nmalloc(arena, ECO_GiB(9), byte));
+
+    /* Not the last allocation, it has to copy. */
+    i32 *blocker = mag_virtual_arena_malloc(arena, i32);
+    Assert(blocker);
+    for(i32 i = 0; i < 10; ++i) { fresh[i] = i; }
+    i32 *moved = mag_virtual_arena_nrealloc(arena, fresh, 20, i32);
+    Assert(moved && moved != fresh);
+    for(i32 i = 0; i < 10; ++i) { Assert(moved[i] == i); }
+
+    mag_virtual_arena_destroy(arena);
+    Assert(!arena->buf.mem);
+
+    /* Through the generalized allocator. */
+    MagAllocator alloc_instance = mag_allocator_virtual_arena_create(ECO_GiB(1));
+    MagAllocator *alloc = &alloc_instance;
+    char *str = eco_arena_nmalloc(alloc, 100, char);
+    Assert(str);
+    char *str2 = eco_arena_nrealloc(alloc, str, 1000, char);
+    Assert(str2 == str);
+    eco_arena_reset(alloc);
+    Assert(alloc->virtual_arena.committed == 0);
+    eco_arena_destroy(alloc);
+}
+
+#define TEST_CONCURRENT_THREADS 4
+#define TEST_CONCURRENT_ALLOCS 20000
+
+typedef struct
+{
+    MagConcurrentArena *arena;
+    u8 id;
+    u8 *allocs[TEST_CONCURRENT_ALLOCS];
+    size sizes[TEST_CONCURRENT_ALLOCS];
+} TestConcurrentArenaThread;
+
+static void
+test_concurrent_arena_producer(void *data)
+{
+    TestConcurrentArenaThread *td = data;
+    MagConcurrentArenaCache cache = mag_concurrent_arena_cache_create(td->arena);
+
+    /* Mix cached and direct allocations, and stamp each one with the thread id so overlaps show up. */
+    for(i32 i = 0; i < TEST_CONCURRENT_ALLOCS; ++i)
+    {
+        size num_bytes = 1 + (i * 7) % 200;
+        u8 *mem = (i % 3 == 0) ? mag_concurrent_arena_alloc_uninit(td->arena, num_bytes, 8)
+                               : mag_concurrent_arena_cache_alloc_uninit(&cache, num_bytes, 8);
+        Assert(mem && ((uptr)mem & 7) == 0);
+        memset(mem, td->id, num_bytes);
+
+        td->allocs[i] = mem;
+        td->sizes[i] = num_bytes;
+    }
+}
+
+static void
+test_concurrent_arena(void)
+{
+    MagConcurrentArena arena_instance = mag_concurrent_arena_create(ECO_KiB(64));
+    MagConcurrentArena *arena = &arena_instance;
+
+    /* Basic allocations are zeroed, aligned, and don't overlap. */
+    i32 *ints = mag_concurrent_arena_nmalloc(arena, 10, i32);
+    Assert(ints);
+    for(i32 i = 0; i < 10; ++i) { Assert(ints[i] == 0); ints[i] = i; }
+
+    f64 *dbl = mag_concurrent_arena_malloc(arena, f64);
+    Assert(dbl && ((uptr)dbl % _Alignof(f64)) == 0 && (byte *)dbl >= (byte *)(ints + 10));
+
+    void *aligned = eco_arena_nmalloc(arena, 3, byte);
+    Assert(aligned);
+    aligned = mag_concurrent_arena_alloc(arena, 100, 256);
+    Assert(aligned && ((uptr)aligned & 255) == 0);
+
+    /* Filling a block grows the arena, and the old allocations are left alone. */
+    for(i32 i = 0; i < 100; ++i) { Assert(mag_concurrent_arena_nmalloc(arena, 1000, byte)); }
+    for(i32 i = 0; i < 10; ++i) { Assert(ints[i] == i); }
+    Assert(atomic_load(&arena->current) != atomic_load(&arena->blocks) || atomic_load(&arena->blocks)->next);
+
+    /* Big allocations get their own block. */
+    byte *big = mag_concurrent_arena_nmalloc(arena, ECO_MiB(1), byte);
+    Assert(big && big[0] == 0 && big[ECO_MiB(1) - 1] == 0);
+
+    /* A reset keeps one block and starts over in it. */
+    eco_arena_reset(arena);
+    Assert(atomic_load(&arena->blocks) == atomic_load(&arena->current) && !atomic_load(&arena->blocks)->next);
+    i32 *again = mag_concurrent_arena_nmalloc_uninit(arena, 10, i32);
+    Assert(again);
+
+    /* Lots of threads hammering on a small block size so they race to grow it. */
+    static TestConcurrentArenaThread thread_data[TEST_CONCURRENT_THREADS];
+    CoyThread threads[TEST_CONCURRENT_THREADS] = {0};
+    for(i32 t = 0; t < TEST_CONCURRENT_THREADS; ++t)
+    {
+        thread_data[t] = (TestConcurrentArenaThread){ .arena = arena, .id = (u8)(t + 1) };
+        Assert(coy_thread_create(&threads[t], test_concurrent_arena_producer, &thread_data[t]));
+    }
+
+    for(i32 t = 0; t < TEST_CONCURRENT_THREADS; ++t)
+    {
+        Assert(coy_thread_join(&threads[t]));
+        coy_thread_destroy(&threads[t]);
+    }
+
+    for(i32 t = 0; t < TEST_CONCURRENT_THREADS; ++t)
+    {
+        for(i32 i = 0; i < TEST_CONCURRENT_ALLOCS; ++i)
+        {
+            u8 *mem = thread_data[t].allocs[i];
+            for(size b = 0; b < thread_data[t].sizes[i]; ++b) { Assert(mem[b] == thread_data[t].id); }
+        }
+    }
+
+    eco_arena_destroy(arena);
+    Assert(!atomic_load(&arena->blocks) && !atomic_load(&arena->current));
+}
+
+static void
+test_block_cache_worker(void *data)
+{
+    u8 const id = *(u8 *)data;
+
+    /* Lots of short lived arenas, each one big enough to need several blocks. */
+    for(i32 cycle = 0; cycle < 200; ++cycle)
+    {
+        MagDynArena arena = mag_dyn_arena_create(ECO_KiB(16));
+        u8 *chunks[50] = {0};
+        for(i32 i = 0; i < 50; ++i)
+        {
+            chunks[i] = mag_dyn_arena_nmalloc(&arena, 1000, u8);
+            Assert(chunks[i]);
+            memset(chunks[i], id, 1000);
+        }
+
+        for(i32 i = 0; i < 50; ++i) { for(i32 b = 0; b < 1000; ++b) { Assert(chunks[i][b] == id); } }
+        mag_dyn_arena_destroy(&arena);
+    }
+}
+
+static void
+test_block_cache(void)
+{
+    Assert(mag_block_cache_bytes() == 0);
+
+    /* With the cache off, blocks go right back to the OS. */
+    MagDynArena arena = mag_dyn_arena_create(ECO_KiB(64));
+    mag_dyn_arena_destroy(&arena);
+    Assert(mag_block_cache_bytes() == 0);
+
+    mag_block_cache_configure(ECO_MiB(4));
+
+    /* A new arena of the same size gets one of the old blocks back, and it acts like a new one. */
+    arena = mag_dyn_arena_create(ECO_KiB(64));
+    for(i32 i = 0; i < 10; ++i) { Assert(mag_dyn_arena_nmalloc(&arena, ECO_KiB(32), byte)); }
+    mag_dyn_arena_destroy(&arena);
+    Assert(mag_block_cache_bytes() > 5 * ECO_KiB(64));
+
+    size const cached = mag_block_cache_bytes();
+    arena = mag_dyn_arena_create(ECO_KiB(64));
+    Assert(!arena.head_block->next && mag_block_cache_bytes() == cached - arena.head_block->buf.size);
+    i32 *ints = mag_dyn_arena_nmalloc(&arena, 100, i32);
+    for(i32 i = 0; i < 100; ++i) { Assert(ints[i] == 0); }
+
+    /* A small request can use a somewhat bigger block, but not a huge one. */
+    MagDynArena small = mag_dyn_arena_create(ECO_KiB(40));
+    Assert(small.head_block && small.head_block->buf.size >= ECO_KiB(40));
+    mag_dyn_arena_destroy(&small);
+    MagDynArena tiny = mag_dyn_arena_create(ECO_KiB(1));
+    Assert(tiny.head_block->buf.size < ECO_KiB(16));
+    mag_dyn_arena_destroy(&tiny);
+    mag_dyn_arena_destroy(&arena);
+
+    /* Background populated and NUMA placed blocks never come from the cache or go into it. */
+    size const before = mag_block_cache_bytes();
+    MagMemoryOptions const populate_background = { .populate = MAG_MEM_POPULATE_BACKGROUND };
+    MagDynArena background = mag_dyn_arena_create_options(ECO_KiB(64), populate_background);
+    Assert(mag_block_cache_bytes() == before);
+    mag_dyn_arena_destroy(&background);
+    Assert(mag_block_cache_bytes() == before);
+
+    MagMemoryOptions const numa_local = { .numa = MAG_MEM_NUMA_LOCAL };
+    MagDynArena placed = mag_dyn_arena_create_options(ECO_KiB(64), numa_local);
+    Assert(mag_block_cache_bytes() == before);
+    mag_dyn_arena_destroy(&placed);
+    Assert(mag_block_cache_bytes() == before);
+
+    /* Populated arenas get fresh pages, but their blocks can be cached for the others. */
+    MagMemoryOptions const populate_now = { .populate = MAG_MEM_POPULATE_NOW };
+    MagDynArena now = mag_dyn_arena_create_options(ECO_KiB(64), populate_now);
+    Assert(mag_block_cache_bytes() == before);
+    mag_dyn_arena_destroy(&now);
+    Assert(mag_block_cache_bytes() > before);
+
+    /* Never more than the limit. */
+    MagDynArena big = mag_dyn_arena_create(ECO_MiB(8));
+    mag_dyn_arena_destroy(&big);
+    Assert(mag_block_cache_bytes() <= ECO_MiB(4));
+
+    /* Several threads sharing the cache. */
+    u8 ids[4] = { 1, 2, 3, 4 };
+    CoyThread threads[4] = {0};
+    for(i32 t = 0; t < 4; ++t) { Assert(coy_thread_create(&threads[t], test_block_cache_worker, &ids[t])); }
+    for(i32 t = 0; t < 4; ++t)
+    {
+        Assert(coy_thread_join(&threads[t]));
+        coy_thread_destroy(&threads[t]);
+    }
+    Assert(mag_block_cache_bytes() > 0 && mag_block_cache_bytes() <= ECO_MiB(4));
+
+    mag_block_cache_trim(ECO_KiB(64));
+    Assert(mag_block_cache_bytes() <= ECO_KiB(64));
+
+    /* Turning it off empties it. */
+    mag_block_cache_configure(0);
+    Assert(mag_block_cache_bytes() == 0);
+}
+
+static void
+test_arena_trim(void)
+{
+    MagMemoryOptions const populate_now = { .populate = MAG_MEM_POPULATE_NOW };
+    MagDynArena arena = mag_dyn_arena_create_options(ECO_MiB(2), populate_now);
+
+    /* Each of these needs a block of its own. */
+    for(i32 i = 0; i < 3; ++i) { Assert(mag_dyn_arena_nmalloc(&arena, ECO_KiB(1536), byte)); }
+    MagDynArenaBlock *head = arena.head_block;
+    Assert(head->next && head->next->next && !head->next->next->next);
+    size const ceiling = mag_dyn_arena_usage_ceiling(&arena);
+
+    /* Only the first MiB stays, but all the blocks are still there. */
+    mag_dyn_arena_reset_trim(&arena, ECO_MiB(1));
+    Assert(arena.head_block == head && arena.current_block == head);
+    Assert(head->next && head->next->next && !head->next->next->next);
+    Assert(mag_dyn_arena_usage_ceiling(&arena) < ceiling);
+
+#if defined(__linux__)
+    /* test_touch_pages_count_faults comes from sys_memory.c, which test.c includes first. */
+    MagMemoryBlock kept = { .mem = head->buf.mem, .size = ECO_MiB(1) };
+    MagMemoryBlock purged = { .mem = head->next->buf.mem + ECO_KiB(64), .size = ECO_MiB(1) };
+    Assert(test_touch_pages_count_faults(purged) > test_touch_pages_count_faults(kept));
+#endif
+
+    /* The blocks get used again, no new ones. */
+    for(i32 i = 0; i < 3; ++i)
+    {
+        byte *mem = mag_dyn_arena_nmalloc(&arena, ECO_KiB(1536), byte);
+        Assert(mem && mem[0] == 0 && mem[ECO_KiB(1536) - 1] == 0);
+    }
+    Assert(!head->next->next->next);
+
+    /* A watermark past the end keeps everything. */
+    mag_dyn_arena_reset_trim(&arena, ECO_GiB(1));
+    Assert(mag_dyn_arena_usage_ceiling(&arena) == ceiling);
+    mag_dyn_arena_destroy(&arena);
+
+    /* The virtual arena keeps what is committed up to the watermark. */
+    MagVirtualArena varena = mag_virtual_arena_create(ECO_MiB(64));
+    byte *mem = mag_virtual_arena_nmalloc(&varena, ECO_MiB(8), byte);
+    Assert(mem && varena.committed >= ECO_MiB(8));
+    memset(mem, 0xAB, ECO_MiB(8));
+
+    mag_virtual_arena_reset_trim(&varena, ECO_KiB(1536));
+    Assert(varena.committed == 2 * MAG_VIRTUAL_ARENA_COMMIT_CHUNK);
+    mem = mag_virtual_arena_nmalloc(&varena, ECO_MiB(8), byte);
+    Assert(mem && mem[0] == 0 && mem[ECO_MiB(8) - 1] == 0);
+    mag_virtual_arena_destroy(&varena);
+}
+
+#if MAG_STATS
+static void
+test_arena_stats(void)
+{
+    /* Static arena, bytes in use follow the offset. */
+    _Alignas(16) byte buffer[256] = {0};
+    MagStaticArena static_arena = mag_static_arena_create(sizeof(buffer), buffer);
+    MagStaticArena *arena = &static_arena;
+
+    Assert(mag_static_arena_nmalloc(arena, 3, char));
+    i32 *ints = mag_static_arena_malloc(arena, i32);
+    Assert(ints && arena->stats.bytes_padding == 1 && arena->stats.bytes_in_use == 8);
+
+    Assert(mag_static_arena_nrealloc(arena, ints, 10, i32) == ints);
+    Assert(arena->stats.num_realloc_in_place == 1 && arena->stats.bytes_in_use == 44);
+
+    mag_static_arena_free(arena, ints);
+    Assert(arena->stats.bytes_in_use == 3 && arena->stats.peak_bytes_in_use == 44);
+    Assert(arena->stats.num_allocs == 2 && arena->stats.bytes_requested == 7 && arena->stats.num_blocks == 0);
+
+    mag_static_arena_reset(arena);
+    Assert(arena->stats.bytes_in_use == 0 && arena->stats.peak_bytes_in_use == 44);
+
+    /* Dynamic arena, every one of these needs a block of its own. */
+    MagDynArena dyn_arena = mag_dyn_arena_create(ECO_KiB(64));
+    Assert(dyn_arena.stats.num_blocks == 1);
+
+    byte *first = mag_dyn_arena_nmalloc(&dyn_arena, ECO_KiB(64), byte);
+    Assert(first && mag_dyn_arena_nmalloc(&dyn_arena, ECO_KiB(64), byte));
+    MagArenaSavepoint savepoint = mag_dyn_arena_savepoint(&dyn_arena);
+    byte *last = mag_dyn_arena_nmalloc(&dyn_arena, ECO_KiB(64), byte);
+    Assert(last && dyn_arena.stats.num_blocks == 3 && dyn_arena.stats.bytes_in_use == 3 * ECO_KiB(64));
+
+    Assert(mag_dyn_arena_nrealloc(&dyn_arena, last, ECO_KiB(1), byte) == last);
+    Assert(mag_dyn_arena_nrealloc(&dyn_arena, first, ECO_KiB(65), byte) != first);
+    Assert(dyn_arena.stats.num_realloc_in_place == 1 && dyn_arena.stats.num_realloc_copy == 1);
+    Assert(dyn_arena.stats.num_allocs == 4 && dyn_arena.stats.peak_bytes_in_use >= 3 * ECO_KiB(64));
+
+    mag_dyn_arena_restore(&dyn_arena, savepoint);
+    Assert(dyn_arena.stats.bytes_in_use == 2 * ECO_KiB(64));
+
+    /* Coalescing gets one more block to hold everything. */
+    u64 const num_blocks = dyn_arena.stats.num_blocks;
+    mag_dyn_arena_reset(&dyn_arena, true);
+    Assert(dyn_arena.stats.bytes_in_use == 0 && dyn_arena.stats.num_blocks == num_blocks + 1);
+    mag_dyn_arena_destroy(&dyn_arena);
+
+    /* Virtual arena, each commit counts as a block. Use it through a MagAllocator. */
+    MagAllocator alloc_instance = mag_allocator_virtual_arena_create(ECO_MiB(64));
+    MagAllocator *alloc = &alloc_instance;
+    MagAllocStats *stats = mag_allocator_stats(alloc);
+
+    Assert(eco_arena_malloc(alloc, byte) && stats->num_blocks == 1);
+    Assert(eco_arena_nmalloc(alloc, 2 * MAG_VIRTUAL_ARENA_COMMIT_CHUNK, byte) && stats->num_blocks == 2);
+    Assert(stats->num_allocs == 2 && stats->bytes_requested == 1 + 2 * MAG_VIRTUAL_ARENA_COMMIT_CHUNK);
+
+    eco_arena_reset(alloc);
+    Assert(stats->bytes_in_use == 0 && stats->peak_bytes_in_use == 1 + 2 * MAG_VIRTUAL_ARENA_COMMIT_CHUNK);
+    eco_arena_destroy(alloc);
+
+    /* Concurrent arena, everything is rounded to the grain. */
+    MagConcurrentArena concurrent = mag_concurrent_arena_create(ECO_KiB(64));
+    Assert(mag_concurrent_arena_nmalloc(&concurrent, 3, byte));
+    MagAllocStats snapshot = mag_atomic_alloc_stats_read(&concurrent.stats);
+    Assert(snapshot.num_blocks == 1 && snapshot.num_allocs == 1 && snapshot.bytes_padding == 13);
+
+    /* A cache's first chunk is in use right away, but its allocations only show up when it takes the next one. */
+    size const chunk = ECO_KiB(16);
+    MagConcurrentArenaCache cache = mag_concurrent_arena_cache_create(&concurrent);
+    for(i32 i = 0; i < chunk / 64; ++i) { Assert(mag_concurrent_arena_cache_nmalloc(&cache, 8, i64)); }
+    snapshot = mag_atomic_alloc_stats_read(&concurrent.stats);
+    Assert(snapshot.num_allocs == 1 && snapshot.bytes_in_use == 16 + chunk);
+
+    Assert(mag_concurrent_arena_cache_nmalloc(&cache, 8, i64));
+    snapshot = mag_atomic_alloc_stats_read(&concurrent.stats);
+    Assert(snapshot.num_allocs == 1 + chunk / 64 && snapshot.bytes_requested == (u64)(3 + chunk));
+    Assert(snapshot.bytes_in_use == 16 + 2 * chunk && snapshot.bytes_padding == 13);
+
+    mag_concurrent_arena_reset(&concurrent);
+    snapshot = mag_atomic_alloc_stats_read(&concurrent.stats);
+    Assert(snapshot.bytes_in_use == 0 && snapshot.peak_bytes_in_use == 16 + 2 * chunk);
+    mag_concurrent_arena_destroy(&concurrent);
+}
+#endif
+
+#if MAG_TRACE
+typedef struct
+{
+    MagTraceEvent events[16];
+    i32 num_events;
+} TestTraceLog;
+
+static void
+test_trace_hook(MagTraceEvent const *event, void *user_data)
+{
+    TestTraceLog *log = user_data;
+    Assert(log->num_events < ECO_ARRAY_SIZE(log->events));
+    log->events[log->num_events++] = *event;
+}
+
+static void
+test_arena_trace(void)
+{
+    TestTraceLog log = {0};
+    mag_trace_set_hook(test_trace_hook, &log);
+
+    _Alignas(16) byte buffer[256] = {0};
+    MagStaticArena static_arena = mag_static_arena_create(sizeof(buffer), buffer);
+    MagStaticArena *arena = &static_arena;
+
+    /* The malloc style macros and the generics know where they were called from. */
+    i32 const first_line = __LINE__ + 1;
+    i32 *ints = mag_static_arena_nmalloc(arena, 4, i32);
+    Assert(mag_static_arena_nrealloc(arena, ints, 250, i32) == NULL);
+    eco_arena_free(arena, ints);
+    eco_arena_reset(arena);
+
+    Assert(log.num_events == 4);
+    MagTraceOp const ops[] = { MAG_TRACE_ALLOC, MAG_TRACE_REALLOC, MAG_TRACE_FREE, MAG_TRACE_RESET };
+    for(i32 i = 0; i < 4; ++i)
+    {
+        MagTraceEvent const *event = &log.events[i];
+        Assert(event->op == ops[i] && event->allocator == arena && event->allocator_type == MAG_ALLOC_T_STATIC_ARENA);
+        Assert(event->file && coy_null_term_strings_equal(event->file, __FILE__) && event->line == first_line + i);
+    }
+
+    Assert(log.events[0].ptr == ints && log.events[0].num_bytes == 16 && log.events[0].alignment == _Alignof(i32));
+    Assert(log.events[1].ptr == NULL && log.events[1].old_ptr == ints && log.events[1].num_bytes == 1000);
+    Assert(log.events[2].old_ptr == ints);
+
+    /* The functions are still functions, called directly they don't know the site unless it's passed to *_traced. */
+    log.num_events = 0;
+    void *(*alloc_func)(MagStaticArena *, size, size) = &mag_static_arena_alloc;
+    Assert(alloc_func(arena, 8, 8) && log.num_events == 1 && log.events[0].file == NULL);
+    Assert(mag_static_arena_alloc_traced(arena, 8, 8, "caller.c", 12) && log.num_events == 2);
+    Assert(coy_null_term_strings_equal(log.events[1].file, "caller.c") && log.events[1].line == 12);
+
+    /* Generics don't leave a site behind for allocators that aren't traced. */
+    MagTlsf tlsf = mag_tlsf_create(ECO_KiB(64));
+    Assert(eco_arena_malloc(&tlsf, f64));
+    mag_static_arena_reset(arena);
+    Assert(log.num_events == 3 && log.events[2].op == MAG_TRACE_RESET && log.events[2].file == NULL);
+    mag_tlsf_destroy(&tlsf);
+
+    /* A MagAllocator over an arena is reported once, as the arena. TLSF is reported as the MagAllocator. */
+    log.num_events = 0;
+    MagAllocator dyn_alloc = mag_allocator_dyn_arena_create(ECO_KiB(4));
+    MagAllocator tlsf_alloc = mag_allocator_tlsf_create(ECO_KiB(64));
+    byte *dyn_mem = eco_arena_nmalloc(&dyn_alloc, 10, byte);
+    byte *tlsf_mem = eco_arena_nmalloc(&tlsf_alloc, 10, byte);
+    Assert(tlsf_mem && eco_arena_nrealloc(&tlsf_alloc, tlsf_mem, 20, byte));
+    Assert(log.num_events == 3);
+    Assert(log.events[0].allocator == &dyn_alloc.dyn_arena && log.events[0].allocator_type == MAG_ALLOC_T_DYN_ARENA);
+    Assert(log.events[0].ptr == dyn_mem && log.events[0].file);
+    Assert(log.events[1].allocator == &tlsf_alloc && log.events[1].allocator_type == MAG_ALLOC_T_TLSF);
+    Assert(log.events[2].op == MAG_TRACE_REALLOC && log.events[2].old_ptr == tlsf_mem && log.events[2].line);
+
+    /* Allocations made inside the library don't have a call site. */
+    log.num_events = 0;
+    MagStrBuilder builder = eco_str_builder_create(&dyn_alloc.dyn_arena, 16);
+    Assert(builder.buf && log.num_events == 1 && log.events[0].file == NULL && log.events[0].line == 0);
+
+    /* Nothing is reported after the hook is removed. */
+    mag_trace_set_hook(NULL, NULL);
+    Assert(eco_arena_malloc(&dyn_alloc, f64) && log.num_events == 1);
+
+    eco_arena_destroy(&dyn_alloc);
+    eco_arena_destroy(&tlsf_alloc);
+}
+#endif
+
 /*---------------------------------------------------------------------------------------------------------------------------
  *                                                All Memory Arena Tests
  *-------------------------------------------------------------------------------------------------------------------------*/
@@ -374,10 +1341,31 @@ magpie_arena_tests(void)
     test_static_arena_realloc();
     test_static_arena_free();
     test_static_arena_save_point();
+    test_static_arena_file();
+    test_arena_arrays();
+    test_arena_cacheline();
 
     test_dynamic_arena();
     test_dynamic_arena_realloc();
+    test_dynamic_arena_realloc_other_block();
     test_dyn_arena_free();
+
+    test_arena_alloc_uninit();
+    test_arena_savepoints();
+    test_scratch_arenas();
+
+    test_virtual_arena();
+    test_concurrent_arena();
+    test_block_cache();
+    test_arena_trim();
+
+#if MAG_STATS
+    test_arena_stats();
+#endif
+
+#if MAG_TRACE
+    test_arena_trace();
+#endif
 }
 
 #pragma warning(pop)
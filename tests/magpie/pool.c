@@ -84,6 +84,153 @@ test_pool_freeing(void)
     mag_static_pool_destroy(pool);
 }
 
+static void
+test_dyn_pool(void)
+{
+    MagDynPool pool_obj = mag_dyn_pool_create(sizeof(f64), TEST_BUF_COUNT);
+    MagDynPool *pool = &pool_obj;
+
+    /* Never runs out, it just adds blocks. */
+    f64 *dubs[10 * TEST_BUF_COUNT] = {0};
+    for(i32 i = 0; i < 10 * TEST_BUF_COUNT; ++i)
+    {
+        dubs[i] = mag_dyn_pool_malloc(pool, f64);
+        Assert(dubs[i] && *dubs[i] == 0.0);
+        *dubs[i] = (f64)i;
+    }
+
+    for(i32 i = 0; i < 10 * TEST_BUF_COUNT; ++i) { Assert(*dubs[i] == (f64)i); }
+
+    i32 num_blocks = 0;
+    for(MagDynPoolBlock *block = pool->blocks; block; block = block->next) { ++num_blocks; }
+    Assert(num_blocks == 10);
+
+    /* Freed slots are reused before adding more blocks. */
+    for(i32 i = 0; i < 10 * TEST_BUF_COUNT; i += 2) { mag_dyn_pool_free(pool, dubs[i]); }
+    for(i32 i = 0; i < 10 * TEST_BUF_COUNT; i += 2) { dubs[i] = mag_dyn_pool_malloc(pool, f64); Assert(dubs[i]); }
+    Assert(!pool->free);
+
+    /* Reset keeps the blocks. */
+    MagDynPoolBlock *blocks = pool->blocks;
+    mag_dyn_pool_reset(pool);
+    for(i32 i = 0; i < 10 * TEST_BUF_COUNT; ++i) { Assert(mag_dyn_pool_malloc(pool, f64)); }
+    Assert(pool->blocks == blocks && !pool->free);
+
+    mag_dyn_pool_destroy(pool);
+    Assert(!pool->blocks);
+}
+
+#define TEST_POOL_MESSAGES 100000
+
+typedef struct
+{
+    u64 id;
+    u64 payload[7];
+} TestPoolMessage;
+
+typedef struct
+{
+    MagConcurrentPool *pool;
+    CoyChannel *chan;
+    u64 num_received;
+    u64 sum;
+} TestPoolStage;
+
+static void
+test_pool_producer(void *data)
+{
+    TestPoolStage *stage = data;
+    coy_channel_wait_until_ready_to_send(stage->chan);
+
+    for(u64 i = 0; i < TEST_POOL_MESSAGES; ++i)
+    {
+        TestPoolMessage *msg = NULL;
+        while(!(msg = mag_concurrent_pool_alloc_uninit(stage->pool))) { /* Wait for the consumer to free some. */ }
+
+        msg->id = i;
+        for(i32 j = 0; j < 7; ++j) { msg->payload[j] = i; }
+        Assert(coy_channel_send(stage->chan, msg));
+    }
+
+    coy_channel_done_sending(stage->chan);
+}
+
+static void
+test_pool_consumer(void *data)
+{
+    TestPoolStage *stage = data;
+    coy_channel_wait_until_ready_to_receive(stage->chan);
+
+    void *val = NULL;
+    while(coy_channel_receive(stage->chan, &val))
+    {
+        TestPoolMessage *msg = val;
+        for(i32 j = 0; j < 7; ++j) { Assert(msg->payload[j] == msg->id); }
+        stage->sum += msg->id;
+        stage->num_received++;
+
+        mag_concurrent_pool_free(stage->pool, msg);
+    }
+
+    coy_channel_done_receiving(stage->chan);
+}
+
+static void
+test_concurrent_pool(void)
+{
+    MagConcurrentPool pool_obj = mag_concurrent_pool_create(sizeof(TestPoolMessage), 1000);
+    MagConcurrentPool *pool = &pool_obj;
+
+    /* Single threaded basics. */
+    TestPoolMessage *first = mag_concurrent_pool_malloc(pool, TestPoolMessage);
+    Assert(first && first->id == 0);
+    first->id = 42;
+    mag_concurrent_pool_free(pool, first);
+    TestPoolMessage *again = mag_concurrent_pool_malloc(pool, TestPoolMessage);
+    Assert(again == first && again->id == 0);
+
+    /* It fills up. */
+    TestPoolMessage *last = NULL;
+    for(i32 i = 1; i < 1000; ++i) { last = mag_concurrent_pool_malloc(pool, TestPoolMessage); Assert(last); }
+    Assert(!mag_concurrent_pool_malloc(pool, TestPoolMessage));
+    mag_concurrent_pool_free(pool, last);
+    Assert(mag_concurrent_pool_malloc(pool, TestPoolMessage) == last);
+
+    mag_concurrent_pool_reset(pool);
+
+    /* Allocate on one thread, free on another, with far more messages than the pool holds. */
+    CoyChannel chan = coy_channel_create();
+    TestPoolStage stage = { .pool = pool, .chan = &chan };
+
+    CoyThread producer_thread = {0};
+    Assert(coy_thread_create(&producer_thread, test_pool_producer, &stage));
+    coy_channel_register_sender(&chan);
+
+    TestPoolStage consumer_stage = { .pool = pool, .chan = &chan };
+    CoyThread consumer_thread = {0};
+    Assert(coy_thread_create(&consumer_thread, test_pool_consumer, &consumer_stage));
+    coy_channel_register_receiver(&chan);
+
+    Assert(coy_thread_join(&producer_thread));
+    coy_thread_destroy(&producer_thread);
+    Assert(coy_thread_join(&consumer_thread));
+    coy_thread_destroy(&consumer_thread);
+    coy_channel_destroy(&chan, NULL, NULL);
+
+    Assert(consumer_stage.num_received == TEST_POOL_MESSAGES);
+    Assert(consumer_stage.sum == (u64)TEST_POOL_MESSAGES * (TEST_POOL_MESSAGES - 1) / 2);
+
+#if MAG_STATS
+    /* None of the counts from either thread got lost. */
+    MagAllocStats const stats = mag_atomic_alloc_stats_read(&pool->stats);
+    Assert(stats.num_allocs == 1002 + TEST_POOL_MESSAGES && stats.bytes_in_use == 0);
+    Assert(stats.peak_bytes_in_use == 1000 * sizeof(TestPoolMessage) && stats.num_blocks > 0);
+#endif
+
+    mag_concurrent_pool_destroy(pool);
+    Assert(!MAG_MEM_IS_VALID(pool->buf));
+}
+
 /*----------------------------------------------------------------------------------------------------------------------------
  *                                                 All Memory Pool Tests
  *--------------------------------------------------------------------------------------------------------------------------*/
@@ -92,4 +239,6 @@ magpie_pool_tests(void)
 {
     test_full_pool();
     test_pool_freeing();
+    test_dyn_pool();
+    test_concurrent_pool();
 }
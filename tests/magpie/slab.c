@@ -0,0 +1,216 @@
+#include "test.h"
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *                                               Tests for the Slab Allocator
+ *
+ *--------------------------------------------------------------------------------------------------------------------------*/
+#define TEST_SLAB_NUM_PTRS 2000
+#define TEST_SLAB_THREADS 4
+
+static void
+test_slab_basic(void)
+{
+    MagSlabAllocator slab_instance = mag_slab_create(0);
+    MagSlabAllocator *slab = &slab_instance;
+
+    /* Every size and alignment gets memory that is aligned and zeroed. */
+    for(size align = 1; align <= MAG_SLAB_MAX_ALIGN; align *= 2)
+    {
+        for(size num_bytes = 1; num_bytes <= MAG_SLAB_MAX_OBJECT_SIZE; num_bytes += 37)
+        {
+            byte *mem = mag_slab_alloc(slab, num_bytes, align);
+            Assert(mem && ((uptr)mem & (align - 1)) == 0);
+            for(size i = 0; i < num_bytes; ++i) { Assert(mem[i] == 0); }
+            memset(mem, 0xAB, num_bytes);
+            mag_slab_free(slab, mem, num_bytes, align);
+        }
+    }
+
+    /* Too big or too aligned. */
+    Assert(!mag_slab_alloc(slab, MAG_SLAB_MAX_OBJECT_SIZE + 1, 1));
+    Assert(!mag_slab_alloc(slab, 8, 2 * MAG_SLAB_MAX_ALIGN));
+
+    /* Freed objects come right back. */
+    f64 *dub = mag_slab_malloc(slab, f64);
+    *dub = 3.14;
+    mag_slab_mfree(slab, dub, f64);
+    f64 *again = mag_slab_malloc_uninit(slab, f64);
+    Assert(again == dub);
+    mag_slab_mfree(slab, again, f64);
+
+    /* Freeing NULL is a no-op. */
+    mag_slab_free(slab, NULL, 8, 8);
+    Assert(mag_slab_malloc(slab, f64) == dub);
+
+    mag_slab_destroy(slab);
+}
+
+static void
+test_slab_growth(void)
+{
+    MagSlabAllocator slab_instance = mag_slab_create(ECO_KiB(16));
+    MagSlabAllocator *slab = &slab_instance;
+
+    /* Way more than fits in one slab. */
+    static i64 *ptrs[TEST_SLAB_NUM_PTRS] = {0};
+    for(i32 i = 0; i < TEST_SLAB_NUM_PTRS; ++i)
+    {
+        ptrs[i] = mag_slab_nmalloc(slab, 4, i64);
+        Assert(ptrs[i]);
+        for(i32 j = 0; j < 4; ++j) { ptrs[i][j] = i; }
+    }
+
+    for(i32 i = 0; i < TEST_SLAB_NUM_PTRS; ++i) { for(i32 j = 0; j < 4; ++j) { Assert(ptrs[i][j] == i); } }
+    MagSlabClass *size_class = &slab->classes[1];
+    Assert(size_class->object_size == 4 * sizeof(i64) && size_class->slabs && size_class->slabs->next);
+
+    /* Free half and reallocate, no new slabs are needed. */
+    MagSlabBlock *slabs = size_class->slabs;
+    for(i32 i = 0; i < TEST_SLAB_NUM_PTRS; i += 2) { mag_slab_nfree(slab, ptrs[i], 4, i64); }
+    for(i32 i = 0; i < TEST_SLAB_NUM_PTRS; i += 2) { ptrs[i] = mag_slab_nmalloc(slab, 4, i64); Assert(ptrs[i]); }
+    Assert(size_class->slabs == slabs);
+
+    mag_slab_reset(slab);
+    Assert(!size_class->slabs && !size_class->free);
+    Assert(mag_slab_nmalloc(slab, 4, i64));
+
+    mag_slab_destroy(slab);
+}
+
+typedef struct
+{
+    MagSlabAllocator *slab;
+    u8 id;
+} TestSlabThread;
+
+static void
+test_slab_churn(void *data)
+{
+    TestSlabThread *td = data;
+    MagSlabMagazine mag = mag_slab_magazine_create(td->slab);
+
+    u8 *ptrs[100] = {0};
+    size sizes[100] = {0};
+    for(i32 iter = 0; iter < 50000; ++iter)
+    {
+        i32 const slot = (iter * 31 + td->id) % 100;
+        if(ptrs[slot])
+        {
+            for(size b = 0; b < sizes[slot]; ++b) { Assert(ptrs[slot][b] == td->id); }
+
+            /* Mix in the shared path too. */
+            if(iter % 5 == 0) { mag_slab_free(td->slab, ptrs[slot], sizes[slot], 8); }
+            else { mag_slab_magazine_free(&mag, ptrs[slot], sizes[slot], 8); }
+            ptrs[slot] = NULL;
+        }
+        else
+        {
+            sizes[slot] = 1 + (iter * 13) % 300;
+            ptrs[slot] = mag_slab_magazine_alloc_uninit(&mag, sizes[slot], 8);
+            Assert(ptrs[slot]);
+            memset(ptrs[slot], td->id, sizes[slot]);
+        }
+    }
+
+    for(i32 i = 0; i < 100; ++i) { mag_slab_magazine_free(&mag, ptrs[i], sizes[i], 8); }
+    mag_slab_magazine_flush(&mag);
+    for(i32 i = 0; i < MAG_SLAB_NUM_CLASSES; ++i) { Assert(mag.counts[i] == 0); }
+}
+
+static void
+test_slab_magazines(void)
+{
+    MagSlabAllocator slab_instance = mag_slab_create(0);
+    MagSlabAllocator *slab = &slab_instance;
+
+    /* A magazine hands back what was just freed. */
+    MagSlabMagazine mag = mag_slab_magazine_create(slab);
+    i32 *ints = mag_slab_magazine_nmalloc(&mag, 10, i32);
+    Assert(ints);
+    for(i32 i = 0; i < 10; ++i) { Assert(ints[i] == 0); }
+    mag_slab_magazine_nfree(&mag, ints, 10, i32);
+    Assert(mag_slab_magazine_nmalloc(&mag, 10, i32) == ints);
+    mag_slab_magazine_nfree(&mag, ints, 10, i32);
+    mag_slab_magazine_flush(&mag);
+
+    /* Several threads sharing one allocator. */
+    TestSlabThread thread_data[TEST_SLAB_THREADS] = {0};
+    CoyThread threads[TEST_SLAB_THREADS] = {0};
+    for(i32 t = 0; t < TEST_SLAB_THREADS; ++t)
+    {
+        thread_data[t] = (TestSlabThread){ .slab = slab, .id = (u8)(t + 1) };
+        Assert(coy_thread_create(&threads[t], test_slab_churn, &thread_data[t]));
+    }
+
+    for(i32 t = 0; t < TEST_SLAB_THREADS; ++t)
+    {
+        Assert(coy_thread_join(&threads[t]));
+        coy_thread_destroy(&threads[t]);
+    }
+
+    /* Everything went back to the free lists. */
+    for(i32 i = 0; i < MAG_SLAB_NUM_CLASSES; ++i)
+    {
+        MagSlabClass *size_class = &slab->classes[i];
+        size num_free = 0;
+        for(uptr *obj = size_class->free; obj; obj = (uptr *)*obj) { ++num_free; }
+
+        size capacity = 0;
+        for(MagSlabBlock *block = size_class->slabs; block; block = block->next)
+        {
+            capacity += (block->buf.size - MAG_SLAB_MAX_ALIGN) / size_class->object_size;
+        }
+
+        Assert(num_free == capacity);
+    }
+
+    mag_slab_destroy(slab);
+}
+
+#if MAG_STATS
+static void
+test_slab_stats(void)
+{
+    MagSlabAllocator slab_instance = mag_slab_create(0);
+    MagSlabAllocator *slab = &slab_instance;
+
+    /* 10 bytes come from the 16 byte class. */
+    byte *direct = mag_slab_nmalloc(slab, 10, byte);
+    MagAllocStats stats = mag_atomic_alloc_stats_read(&slab->stats);
+    Assert(direct && stats.num_allocs == 1 && stats.bytes_padding == 6 && stats.bytes_in_use == 16);
+
+    /* The magazine's refill grows the 48 byte class, but the allocation isn't counted until the magazine is flushed. */
+    MagSlabMagazine mag = mag_slab_magazine_create(slab);
+    i32 *ints = mag_slab_magazine_nmalloc(&mag, 10, i32);
+    stats = mag_atomic_alloc_stats_read(&slab->stats);
+    Assert(ints && stats.num_blocks == 2 && stats.num_allocs == 1);
+
+    mag_slab_magazine_flush(&mag);
+    stats = mag_atomic_alloc_stats_read(&slab->stats);
+    Assert(stats.num_allocs == 2 && stats.bytes_requested == 50 && stats.bytes_padding == 14 && stats.bytes_in_use == 64);
+
+    mag_slab_magazine_nfree(&mag, ints, 10, i32);
+    mag_slab_magazine_flush(&mag);
+    mag_slab_free(slab, direct, 10, 1);
+    stats = mag_atomic_alloc_stats_read(&slab->stats);
+    Assert(stats.bytes_in_use == 0 && stats.peak_bytes_in_use == 64);
+
+    mag_slab_destroy(slab);
+}
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                  All Slab Tests
+ *-------------------------------------------------------------------------------------------------------------------------*/
+void
+magpie_slab_tests(void)
+{
+    test_slab_basic();
+    test_slab_growth();
+    test_slab_magazines();
+
+#if MAG_STATS
+    test_slab_stats();
+#endif
+}
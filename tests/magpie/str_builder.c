@@ -0,0 +1,138 @@
+#include "test.h"
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *                                               Tests for the String Builder
+ *
+ *--------------------------------------------------------------------------------------------------------------------------*/
+static void
+test_str_builder_formats(void)
+{
+    MagDynArena arena_instance = mag_dyn_arena_create(ECO_KiB(4));
+    MagDynArena *arena = &arena_instance;
+
+    MagStrBuilder builder = eco_str_builder_create(arena, 0);
+    mag_str_builder_append_cstr(&builder, "count=");
+    mag_str_builder_append_i64(&builder, -42);
+    mag_str_builder_append_char(&builder, ' ');
+    mag_str_builder_append_i64(&builder, INT64_MIN);
+    mag_str_builder_append_char(&builder, ' ');
+    mag_str_builder_append_u64(&builder, UINT64_MAX);
+    ElkStr str = mag_str_builder_finish(&builder);
+    Assert(elk_str_eq(str, elk_str_from_cstring("count=-42 -9223372036854775808 18446744073709551615")));
+    Assert(elk_str_null_terminated(str));
+
+    /* The builder is ready for another string. */
+    Assert(!builder.buf && builder.len == 0);
+
+    struct { f64 value; i32 decimal_places; char *expected; } const floats[] =
+        {
+            { 3.14159,     2, "3.14"     },
+            { -2.71828,    3, "-2.718"   },
+            { 0.125,       3, "0.125"    },
+            { 7.0,         0, "7"        },
+            { 1.5e20,      2, "1.50e+20" },
+            { 9.999e20,    2, "1.00e+21" },
+            { 0.0 / 0.0,   2, "nan"      },
+            { 1.0 / 0.0,   2, "inf"      },
+            { -1.0 / 0.0,  2, "-inf"     },
+        };
+
+    for(i32 i = 0; i < ECO_ARRAY_SIZE(floats); ++i)
+    {
+        mag_str_builder_append_f64(&builder, floats[i].value, floats[i].decimal_places);
+        str = mag_str_builder_finish(&builder);
+        Assert(elk_str_eq(str, elk_str_from_cstring(floats[i].expected)));
+    }
+
+    mag_str_builder_append_time(&builder, elk_time_from_ymd_and_hms(2024, 2, 29, 13, 5, 9));
+    mag_str_builder_append_char(&builder, '|');
+    mag_str_builder_append_date(&builder, elk_date_from_ymd(999, 12, 31));
+    str = mag_str_builder_finish(&builder);
+    Assert(elk_str_eq(str, elk_str_from_cstring("2024-02-29 13:05:09|0999-12-31")));
+
+    /* Round trip through the parser. */
+    ElkTime parsed = 0;
+    Assert(elk_str_parse_datetime(elk_str_substr(str, 0, 19), &parsed));
+    Assert(parsed == elk_time_from_ymd_and_hms(2024, 2, 29, 13, 5, 9));
+
+    /* Nothing appended is an empty string, not a failure. */
+    str = mag_str_builder_finish(&builder);
+    Assert(str.start && str.len == 0 && str.start[0] == '\0');
+
+    mag_dyn_arena_destroy(arena);
+}
+
+static void
+test_str_builder_growth(void)
+{
+    MagDynArena arena_instance = mag_dyn_arena_create(ECO_KiB(4));
+    MagDynArena *arena = &arena_instance;
+
+    /* Other allocations in between force the builder to move, which it should rarely need to do. */
+    MagStrBuilder builder = mag_str_builder_create_dyn(arena, 0);
+    i32 num_moves = 0;
+    for(i32 i = 0; i < 10000; ++i)
+    {
+        char *buf = builder.buf;
+        mag_str_builder_append_i64(&builder, i % 10);
+        if(buf && buf != builder.buf) { ++num_moves; }
+
+        if(i % 1000 == 0) { Assert(mag_dyn_arena_nmalloc(arena, 100, byte)); }
+    }
+
+    Assert(num_moves < 16);
+    ElkStr str = mag_str_builder_finish(&builder);
+    Assert(str.len == 10000 && elk_str_null_terminated(str));
+    for(i32 i = 0; i < str.len; ++i) { Assert(str.start[i] == '0' + i % 10); }
+
+    mag_dyn_arena_destroy(arena);
+
+    /* The same through a MagAllocator using TLSF, which actually frees the old buffers. */
+    MagAllocator alloc_instance = mag_allocator_tlsf_create(ECO_MiB(1));
+    MagAllocator *alloc = &alloc_instance;
+    builder = eco_str_builder_create(alloc, 16);
+    Assert(builder.buf && builder.capacity >= 16);
+    for(i32 i = 0; i < 1000; ++i) { mag_str_builder_append(&builder, elk_str_from_cstring("abc")); }
+    str = mag_str_builder_finish(&builder);
+    Assert(str.len == 3000 && mag_tlsf_usable_size(str.start) < 3100);
+    eco_arena_destroy(alloc);
+}
+
+static void
+test_str_builder_out_of_memory(void)
+{
+    _Alignas(16) byte buffer[256] = {0};
+    MagStaticArena arena_instance = mag_static_arena_create(sizeof(buffer), buffer);
+    MagStaticArena *arena = &arena_instance;
+
+    /* The unused capacity goes back to the arena. */
+    MagStrBuilder builder = eco_str_builder_create(arena, 0);
+    mag_str_builder_append_cstr(&builder, "hello");
+    ElkStr str = mag_str_builder_finish(&builder);
+    Assert(elk_str_eq(str, elk_str_from_cstring("hello")) && arena->buf_offset == 6);
+
+    /* Fill it up, once it fails everything else is ignored. */
+    for(i32 i = 0; i < 100; ++i) { mag_str_builder_append_cstr(&builder, "0123456789"); }
+    Assert(builder.failed);
+    mag_str_builder_append_char(&builder, 'x');
+    str = mag_str_builder_finish(&builder);
+    Assert(!str.start && str.len == 0);
+
+    /* Starting over works again. */
+    mag_static_arena_reset(arena);
+    mag_str_builder_append_cstr(&builder, "again");
+    str = mag_str_builder_finish(&builder);
+    Assert(elk_str_eq(str, elk_str_from_cstring("again")));
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                               All String Builder Tests
+ *-------------------------------------------------------------------------------------------------------------------------*/
+void
+magpie_str_builder_tests(void)
+{
+    test_str_builder_formats();
+    test_str_builder_growth();
+    test_str_builder_out_of_memory();
+}
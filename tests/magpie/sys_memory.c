@@ -1,5 +1,9 @@
 #include "../test.h"
 
+#if defined(__linux__)
+#include <sys/resource.h>
+#endif
+
 /*--------------------------------------------------------------------------------------------------------------------------
  *
  *                                                    Tests for Memory
@@ -44,6 +48,284 @@ test_allocate_free(void)
     Assert(!MAG_MEM_IS_VALID(mem));
 }
 
+#if defined(__linux__)
+static u64
+test_read_page_fault_count(void)
+{
+    struct rusage usage = {0};
+    getrusage(RUSAGE_THREAD, &usage);
+    return (u64)usage.ru_minflt + (u64)usage.ru_majflt;
+}
+
+static u64
+test_touch_pages_count_faults(MagMemoryBlock mem)
+{
+    u64 const start = test_read_page_fault_count();
+    for(size i = 0; i < mem.size; i += ECO_KiB(4)) { mem.mem[i] = 1; }
+    u64 const end = test_read_page_fault_count();
+
+    return end - start;
+}
+#endif
+
+static void
+test_allocate_populate(void)
+{
+    MagMemoryPopulate const modes[] = 
+        { MAG_MEM_POPULATE_DEFAULT, MAG_MEM_POPULATE_NOW, MAG_MEM_POPULATE_LAZY, MAG_MEM_POPULATE_BACKGROUND };
+
+    for(size m = 0; m < ECO_ARRAY_SIZE(modes); ++m)
+    {
+        MagMemoryBlock mem = mag_sys_memory_allocate_options(ECO_MiB(16), (MagMemoryOptions){ .populate = modes[m] });
+        Assert(MAG_MEM_IS_VALID(mem));
+
+        for(size i = 0; i < mem.size; i += 4093) { Assert(mem.mem[i] == 0); mem.mem[i] = (byte)i; }
+        for(size i = 0; i < mem.size; i += 4093) { Assert(mem.mem[i] == (byte)i); }
+
+        mag_sys_memory_free(&mem);
+        Assert(!MAG_MEM_IS_VALID(mem));
+    }
+
+    /* Freeing right away has to stop the background helper before the memory goes away. */
+    MagMemoryOptions const populate_background = { .populate = MAG_MEM_POPULATE_BACKGROUND };
+    MagMemoryBlock mem = mag_sys_memory_allocate_options(ECO_MiB(64), populate_background);
+    Assert(MAG_MEM_IS_VALID(mem));
+    mag_sys_memory_free(&mem);
+    Assert(!MAG_MEM_IS_VALID(mem) && !mem.populate_worker);
+
+#if defined(__linux__)
+    /* The page fault counters should show the difference. */
+    {
+        MagMemoryOptions const populate_now = { .populate = MAG_MEM_POPULATE_NOW };
+        MagMemoryBlock now = mag_sys_memory_allocate_options(ECO_MiB(16), populate_now);
+        MagMemoryOptions const populate_lazy = { .populate = MAG_MEM_POPULATE_LAZY };
+        MagMemoryBlock lazy = mag_sys_memory_allocate_options(ECO_MiB(16), populate_lazy);
+
+        u64 const now_faults = test_touch_pages_count_faults(now);
+        u64 const lazy_faults = test_touch_pages_count_faults(lazy);
+        Assert(now_faults < lazy_faults);
+
+        mag_sys_memory_free(&now);
+        mag_sys_memory_free(&lazy);
+    }
+#endif
+
+    /* Arenas carry the mode to every block they allocate. */
+    MagMemoryOptions const populate_lazy = { .populate = MAG_MEM_POPULATE_LAZY };
+    MagDynArena arena = mag_dyn_arena_create_options(ECO_KiB(64), populate_lazy);
+    Assert(arena.block_options.populate == MAG_MEM_POPULATE_LAZY);
+    byte *big = mag_dyn_arena_nmalloc(&arena, ECO_MiB(1), byte);
+    Assert(big && big[ECO_MiB(1) - 1] == 0);
+    mag_dyn_arena_destroy(&arena);
+
+    MagStaticArena static_arena = mag_static_arena_allocate_and_create_options(ECO_MiB(1), populate_background);
+    Assert(static_arena.buf.mem);
+    Assert(mag_static_arena_nmalloc(&static_arena, ECO_KiB(512), byte));
+    mag_static_arena_destroy(&static_arena);
+}
+
+static void
+test_allocate_huge_pages(void)
+{
+    MagMemoryPages const pages[] = 
+        { MAG_MEM_PAGES_DEFAULT, MAG_MEM_PAGES_TRANSPARENT_HUGE, MAG_MEM_PAGES_HUGE_2MiB, MAG_MEM_PAGES_HUGE_1GiB };
+
+    size const base_page_size = mag_sys_memory_page_size();
+
+    /* Huge pages are usually not available on a test machine, so mostly this checks the fallback works. */
+    for(size p = 0; p < ECO_ARRAY_SIZE(pages); ++p)
+    {
+        MagMemoryOptions options = { .populate = MAG_MEM_POPULATE_LAZY, .pages = pages[p] };
+        MagMemoryBlock mem = mag_sys_memory_allocate_options(ECO_MiB(3), options);
+        Assert(MAG_MEM_IS_VALID(mem));
+        Assert(mem.size >= ECO_MiB(3));
+        Assert(mem.page_size >= base_page_size);
+        Assert((mem.page_size & (mem.page_size - 1)) == 0);
+        Assert(mem.size % mem.page_size == 0);
+        Assert((uptr)mem.mem % mem.page_size == 0);
+        if(pages[p] == MAG_MEM_PAGES_DEFAULT) { Assert(mem.page_size == base_page_size); }
+
+        for(size i = 0; i < mem.size; i += 4093) { Assert(mem.mem[i] == 0); mem.mem[i] = (byte)i; }
+        for(size i = 0; i < mem.size; i += 4093) { Assert(mem.mem[i] == (byte)i); }
+
+        mag_sys_memory_free(&mem);
+        Assert(!MAG_MEM_IS_VALID(mem));
+    }
+
+    MagMemoryOptions options = { .populate = MAG_MEM_POPULATE_BACKGROUND, .pages = MAG_MEM_PAGES_TRANSPARENT_HUGE };
+    MagDynArena arena = mag_dyn_arena_create_options(ECO_MiB(1), options);
+    Assert(arena.block_options.pages == MAG_MEM_PAGES_TRANSPARENT_HUGE);
+    u64 *big = mag_dyn_arena_nmalloc(&arena, ECO_MiB(4), u64);
+    Assert(big);
+    for(size i = 0; i < ECO_MiB(4); i += 511) { Assert(big[i] == 0); }
+    mag_dyn_arena_destroy(&arena);
+
+    MagStaticArena static_arena = mag_static_arena_allocate_and_create_options(ECO_MiB(2), options);
+    Assert(static_arena.buf.page_size >= base_page_size);
+    Assert(mag_static_arena_nmalloc(&static_arena, ECO_MiB(1), byte));
+    mag_static_arena_destroy(&static_arena);
+}
+
+static void
+test_numa_arena_thread(void *data)
+{
+    MagDynArena *arena = data;
+    *arena = mag_dyn_arena_create_options(ECO_KiB(64), (MagMemoryOptions){ .numa = MAG_MEM_NUMA_LOCAL });
+}
+
+static void
+test_allocate_numa(void)
+{
+    i32 const num_nodes = mag_sys_memory_numa_num_nodes();
+    i32 const node = mag_sys_memory_numa_current_node();
+    Assert(num_nodes >= 1 && node >= 0 && node < num_nodes);
+
+    /* Placement is only a preference, so this works on every machine. Most test machines have one node. */
+    MagMemoryNuma const policies[] = { MAG_MEM_NUMA_DEFAULT, MAG_MEM_NUMA_LOCAL, MAG_MEM_NUMA_NODE, MAG_MEM_NUMA_INTERLEAVE };
+    MagMemoryPopulate const modes[] = { MAG_MEM_POPULATE_NOW, MAG_MEM_POPULATE_LAZY, MAG_MEM_POPULATE_BACKGROUND };
+    for(size p = 0; p < ECO_ARRAY_SIZE(policies); ++p)
+    {
+        for(size m = 0; m < ECO_ARRAY_SIZE(modes); ++m)
+        {
+            MagMemoryOptions options = { .populate = modes[m], .numa = policies[p], .numa_node = num_nodes - 1 };
+            MagMemoryBlock mem = mag_sys_memory_allocate_options(ECO_MiB(4), options);
+            Assert(MAG_MEM_IS_VALID(mem) && mem.size >= ECO_MiB(4));
+
+            for(size i = 0; i < mem.size; i += 4093) { Assert(mem.mem[i] == 0); mem.mem[i] = (byte)i; }
+            for(size i = 0; i < mem.size; i += 4093) { Assert(mem.mem[i] == (byte)i); }
+
+            mag_sys_memory_free(&mem);
+        }
+    }
+
+    /* A nonsense node still gets memory. */
+    MagMemoryOptions const bad_node = { .numa = MAG_MEM_NUMA_NODE, .numa_node = 1000 };
+    MagMemoryBlock mem = mag_sys_memory_allocate_options(ECO_KiB(64), bad_node);
+    Assert(MAG_MEM_IS_VALID(mem));
+    mag_sys_memory_free(&mem);
+
+    /* An arena created on a thread pins itself to that thread's node. */
+    MagDynArena arena = {0};
+    CoyThread thread = {0};
+    Assert(coy_thread_create(&thread, test_numa_arena_thread, &arena));
+    Assert(coy_thread_join(&thread));
+    coy_thread_destroy(&thread);
+    Assert(arena.head_block && arena.block_options.numa == MAG_MEM_NUMA_NODE);
+    Assert(arena.block_options.numa_node >= 0 && arena.block_options.numa_node < num_nodes);
+    Assert(mag_dyn_arena_nmalloc(&arena, ECO_MiB(1), byte));
+    mag_dyn_arena_destroy(&arena);
+}
+
+static void
+test_first_touch(void)
+{
+    MagMemoryOptions const populate_lazy = { .populate = MAG_MEM_POPULATE_LAZY };
+    MagMemoryBlock mem = mag_sys_memory_allocate_options(ECO_MiB(4), populate_lazy);
+    Assert(MAG_MEM_IS_VALID(mem));
+
+    /* Whatever was already there stays put. */
+    for(size i = 0; i < ECO_KiB(64); ++i) { mem.mem[i] = (byte)i; }
+    mag_sys_memory_first_touch(mem.mem + 100, mem.size - 200);
+    for(size i = 0; i < ECO_KiB(64); ++i) { Assert(mem.mem[i] == (byte)i); }
+    Assert(mem.mem[mem.size - 1] == 0);
+
+#if defined(__linux__)
+    /* All the pages are already there. */
+    Assert(test_touch_pages_count_faults(mem) < 16);
+#endif
+
+    mag_sys_memory_first_touch(mem.mem, 0);
+    mag_sys_memory_free(&mem);
+}
+
+static void
+test_purge(void)
+{
+    MagMemoryOptions const populate_now = { .populate = MAG_MEM_POPULATE_NOW };
+    MagMemoryBlock mem = mag_sys_memory_allocate_options(ECO_MiB(8), populate_now);
+    Assert(MAG_MEM_IS_VALID(mem));
+    memset(mem.mem, 1, mem.size);
+
+    /* The back half goes back to the OS but stays usable, the front half isn't touched. */
+    MagMemoryBlock front = { .mem = mem.mem, .size = ECO_MiB(4) };
+    MagMemoryBlock back = { .mem = mem.mem + ECO_MiB(4), .size = ECO_MiB(4) };
+    mag_sys_memory_purge(back.mem, back.size);
+    for(size i = 0; i < front.size; i += 4093) { Assert(front.mem[i] == 1); }
+    back.mem[back.size - 1] = 2;
+    Assert(back.mem[back.size - 1] == 2);
+
+#if defined(__linux__)
+    /* Purged pages come back as zeros and have to be faulted in again. */
+    mag_sys_memory_purge(back.mem, back.size);
+    for(size i = 0; i < back.size; i += 4093) { Assert(back.mem[i] == 0); }
+    mag_sys_memory_purge(back.mem, back.size);
+    Assert(test_touch_pages_count_faults(back) > test_touch_pages_count_faults(front));
+#endif
+
+    mag_sys_memory_free(&mem);
+}
+
+static void
+test_allocate_mirrored(void)
+{
+    MagMemoryBlock mem = mag_sys_memory_allocate_mirrored(1000);
+    Assert(MAG_MEM_IS_VALID_AND_OWNED(mem) && MAG_MEM_IS_MIRRORED(mem));
+    Assert(mem.size >= 1000 && mem.size % mag_sys_memory_page_size() == 0);
+
+    /* Writes through either half show up in the other one. */
+    for(size i = 0; i < mem.size; i += 97) { mem.mem[i] = (byte)(i * 7); }
+    for(size i = 0; i < mem.size; i += 97) { Assert(mem.mem[i + mem.size] == (byte)(i * 7)); }
+
+    memset(mem.mem + mem.size - 10, 0xAB, 20);
+    for(size i = 0; i < 10; ++i) { Assert(mem.mem[i] == (byte)0xAB); }
+
+    mag_sys_memory_free(&mem);
+    Assert(!MAG_MEM_IS_VALID(mem));
+}
+
+static void
+test_ring_buffer(void)
+{
+    MagRingBuffer ring = mag_ring_buffer_create(ECO_KiB(4));
+    Assert(MAG_MEM_IS_VALID(ring.buf));
+    size const capacity = mag_ring_buffer_capacity(&ring);
+    Assert(capacity >= ECO_KiB(4) && mag_ring_buffer_free_space(&ring) == capacity);
+
+    /* Push and pop odd sized records so they land across the end of the buffer over and over. */
+    u32 next_write = 0;
+    u32 next_read = 0;
+    for(i32 round = 0; round < 1000; ++round)
+    {
+        u32 record[37];
+        while(mag_ring_buffer_free_space(&ring) >= (size)sizeof(record))
+        {
+            for(i32 i = 0; i < ECO_ARRAY_SIZE(record); ++i) { record[i] = next_write++; }
+            Assert(mag_ring_buffer_push(&ring, sizeof(record), record));
+        }
+        Assert(!mag_ring_buffer_push(&ring, sizeof(record), record));
+
+        /* Read straight out of the buffer, no matter where it wraps. */
+        size const num_values = ring.len / sizeof(u32) / 2;
+        u32 const *values = (u32 const *)mag_ring_buffer_read_ptr(&ring);
+        for(size i = 0; i < num_values; ++i) { Assert(values[i] == next_read++); }
+        mag_ring_buffer_consume(&ring, num_values * sizeof(u32));
+    }
+
+    /* Write in place too. */
+    size const free_space = mag_ring_buffer_free_space(&ring);
+    memset(mag_ring_buffer_write_ptr(&ring), 0x5A, free_space);
+    mag_ring_buffer_commit(&ring, free_space);
+    Assert(ring.len == capacity && mag_ring_buffer_free_space(&ring) == 0);
+    byte const *tail = mag_ring_buffer_read_ptr(&ring) + capacity - free_space;
+    for(size i = 0; i < free_space; ++i) { Assert(tail[i] == (byte)0x5A); }
+
+    mag_ring_buffer_consume(&ring, ring.len);
+    Assert(ring.len == 0 && ring.read_offset == 0);
+
+    mag_ring_buffer_destroy(&ring);
+    Assert(!MAG_MEM_IS_VALID(ring.buf));
+}
+
 /*---------------------------------------------------------------------------------------------------------------------------
  *                                                     All file Memory
  *-------------------------------------------------------------------------------------------------------------------------*/
@@ -51,5 +333,12 @@ void
 magpie_sys_memory_tests(void)
 {
     test_allocate_free();
+    test_allocate_populate();
+    test_allocate_huge_pages();
+    test_allocate_numa();
+    test_first_touch();
+    test_purge();
+    test_allocate_mirrored();
+    test_ring_buffer();
 }
 
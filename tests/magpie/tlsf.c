@@ -0,0 +1,245 @@
+#include "test.h"
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *                                               Tests for the TLSF Allocator
+ *
+ *--------------------------------------------------------------------------------------------------------------------------*/
+#define TEST_TLSF_NUM_PTRS 500
+
+static void
+test_tlsf_basic(void)
+{
+    MagTlsf tlsf_instance = mag_tlsf_create(ECO_MiB(1));
+    MagTlsf *tlsf = &tlsf_instance;
+    Assert(MAG_MEM_IS_VALID(tlsf->buf));
+
+    i32 *ints = mag_tlsf_nmalloc(tlsf, 10, i32);
+    Assert(ints && ((uptr)ints % MAG_TLSF_ALIGN) == 0);
+    for(i32 i = 0; i < 10; ++i) { Assert(ints[i] == 0); ints[i] = i; }
+
+    f64 *dubs = mag_tlsf_nmalloc(tlsf, 10, f64);
+    Assert(dubs && (byte *)dubs >= (byte *)(ints + 10));
+    for(i32 i = 0; i < 10; ++i) { dubs[i] = (f64)i; }
+
+    /* Freed memory is reused. */
+    mag_tlsf_free(tlsf, ints);
+    i32 *again = mag_tlsf_nmalloc_uninit(tlsf, 10, i32);
+    Assert(again == ints);
+    for(i32 i = 0; i < 10; ++i) { Assert(dubs[i] == (f64)i); }
+
+    /* Big alignments. */
+    for(size align = 32; align <= ECO_KiB(4); align *= 2)
+    {
+        byte *aligned = mag_tlsf_alloc(tlsf, 100, align);
+        Assert(aligned && ((uptr)aligned & (align - 1)) == 0);
+        Assert(mag_tlsf_usable_size(aligned) >= 100);
+    }
+
+    /* Too big. */
+    Assert(!mag_tlsf_nmalloc(tlsf, ECO_MiB(2), byte));
+
+    mag_tlsf_free(tlsf, NULL);
+    mag_tlsf_destroy(tlsf);
+    Assert(!MAG_MEM_IS_VALID(tlsf->buf));
+}
+
+static void
+test_tlsf_coalescing(void)
+{
+    MagTlsf tlsf_instance = mag_tlsf_create(ECO_MiB(1));
+    MagTlsf *tlsf = &tlsf_instance;
+
+    /* Chop the whole thing up. */
+    byte *ptrs[TEST_TLSF_NUM_PTRS] = {0};
+    for(i32 i = 0; i < TEST_TLSF_NUM_PTRS; ++i)
+    {
+        ptrs[i] = mag_tlsf_nmalloc(tlsf, ECO_KiB(1) + i, byte);
+        Assert(ptrs[i]);
+    }
+
+    /* Free the evens, then the odds, so the neighbors have to merge in both directions. */
+    for(i32 i = 0; i < TEST_TLSF_NUM_PTRS; i += 2) { mag_tlsf_free(tlsf, ptrs[i]); }
+    Assert(!mag_tlsf_nmalloc(tlsf, ECO_KiB(900), byte));
+    for(i32 i = 1; i < TEST_TLSF_NUM_PTRS; i += 2) { mag_tlsf_free(tlsf, ptrs[i]); }
+
+    /* Everything merged back into one block. */
+    byte *big = mag_tlsf_nmalloc(tlsf, ECO_KiB(900), byte);
+    Assert(big && big[0] == 0 && big[ECO_KiB(900) - 1] == 0);
+    mag_tlsf_free(tlsf, big);
+
+    /* Reset gets everything back too. */
+    for(i32 i = 0; i < TEST_TLSF_NUM_PTRS; ++i) { Assert(mag_tlsf_nmalloc(tlsf, ECO_KiB(1), byte)); }
+    mag_tlsf_reset(tlsf);
+    Assert(mag_tlsf_nmalloc(tlsf, ECO_KiB(900), byte));
+
+    mag_tlsf_destroy(tlsf);
+}
+
+static void
+test_tlsf_realloc(void)
+{
+    MagTlsf tlsf_instance = mag_tlsf_create(ECO_MiB(1));
+    MagTlsf *tlsf = &tlsf_instance;
+
+    /* Grows in place when followed by free space. */
+    i32 *ints = mag_tlsf_nmalloc(tlsf, 10, i32);
+    for(i32 i = 0; i < 10; ++i) { ints[i] = i; }
+    i32 *grown = mag_tlsf_nrealloc(tlsf, ints, 1000, i32);
+    Assert(grown == ints);
+    for(i32 i = 0; i < 10; ++i) { Assert(grown[i] == i); }
+
+    /* Shrinking never moves, and the tail is given back. */
+    i32 *shrunk = mag_tlsf_nrealloc(tlsf, grown, 20, i32);
+    Assert(shrunk == grown);
+    i32 *after = mag_tlsf_nmalloc(tlsf, 10, i32);
+    Assert((byte *)after < (byte *)(shrunk + 1000));
+
+    /* Blocked by another allocation, so it has to move. */
+    i32 *moved = mag_tlsf_nrealloc(tlsf, shrunk, 1000, i32);
+    Assert(moved && moved != shrunk);
+    for(i32 i = 0; i < 10; ++i) { Assert(moved[i] == i); }
+
+    /* The old spot was freed. */
+    i32 *reused = mag_tlsf_nmalloc(tlsf, 20, i32);
+    Assert(reused == shrunk);
+
+    /* NULL acts like alloc. */
+    Assert(mag_tlsf_nrealloc(tlsf, NULL, 10, i32));
+
+    mag_tlsf_destroy(tlsf);
+}
+
+static void
+test_tlsf_random(void)
+{
+    MagTlsf tlsf_instance = mag_tlsf_create(ECO_MiB(4));
+    MagTlsf *tlsf = &tlsf_instance;
+
+    u8 *ptrs[TEST_TLSF_NUM_PTRS] = {0};
+    size sizes[TEST_TLSF_NUM_PTRS] = {0};
+    u64 state = 0x9E3779B97F4A7C15;
+
+    /* Random allocs, frees, and reallocs, checking nobody stomps on anybody else's memory. */
+    for(i32 iter = 0; iter < 100000; ++iter)
+    {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        u32 const r = (u32)(state >> 33);
+        i32 const slot = r % TEST_TLSF_NUM_PTRS;
+        u8 const tag = (u8)slot;
+
+        if(ptrs[slot])
+        {
+            for(size b = 0; b < sizes[slot]; ++b) { Assert(ptrs[slot][b] == tag); }
+
+            if(r & 0x40000000)
+            {
+                size const num_bytes = 1 + (r >> 8) % ECO_KiB(8);
+                u8 *new = mag_tlsf_realloc(tlsf, ptrs[slot], num_bytes, (size)1 << ((r >> 4) % 7));
+                Assert(new);
+                for(size b = 0; b < sizes[slot] && b < num_bytes; ++b) { Assert(new[b] == tag); }
+                memset(new, tag, num_bytes);
+                ptrs[slot] = new;
+                sizes[slot] = num_bytes;
+            }
+            else
+            {
+                mag_tlsf_free(tlsf, ptrs[slot]);
+                ptrs[slot] = NULL;
+            }
+        }
+        else
+        {
+            size const num_bytes = 1 + (r >> 8) % ECO_KiB(8);
+            size const alignment = (size)1 << ((r >> 4) % 9);
+            ptrs[slot] = mag_tlsf_alloc_uninit(tlsf, num_bytes, alignment);
+            Assert(ptrs[slot] && ((uptr)ptrs[slot] & (alignment - 1)) == 0);
+            memset(ptrs[slot], tag, num_bytes);
+            sizes[slot] = num_bytes;
+        }
+    }
+
+    for(i32 i = 0; i < TEST_TLSF_NUM_PTRS; ++i) { mag_tlsf_free(tlsf, ptrs[i]); }
+    Assert(mag_tlsf_nmalloc(tlsf, ECO_MiB(3), byte));
+
+    mag_tlsf_destroy(tlsf);
+}
+
+static void
+test_tlsf_allocator(void)
+{
+    MagAllocator alloc_instance = mag_allocator_tlsf_create(ECO_MiB(1));
+    MagAllocator *alloc = &alloc_instance;
+
+    char *str = eco_arena_nmalloc(alloc, 100, char);
+    Assert(str);
+    char *other = eco_arena_nmalloc(alloc, 100, char);
+    Assert(other);
+
+    /* Unlike the arenas, freeing something that wasn't the last allocation gives the memory back. */
+    eco_arena_free(alloc, str);
+    char *again = eco_arena_nmalloc(alloc, 100, char);
+    Assert(again == str);
+
+    char *str2 = eco_arena_nrealloc(alloc, again, 1000, char);
+    Assert(str2);
+
+    eco_arena_reset(alloc);
+    eco_arena_destroy(alloc);
+
+    /* Taking ownership. */
+    MagTlsf tlsf = mag_tlsf_create(ECO_KiB(64));
+    MagAllocator taken = eco_allocator_take(&tlsf);
+    Assert(taken.type == MAG_ALLOC_T_TLSF && !tlsf.control);
+    Assert(eco_arena_malloc(&taken, f64));
+    eco_arena_destroy(&taken);
+}
+
+#if MAG_STATS
+static void
+test_tlsf_stats(void)
+{
+    MagTlsf tlsf_instance = mag_tlsf_create(ECO_MiB(1));
+    MagTlsf *tlsf = &tlsf_instance;
+    Assert(tlsf->stats.num_blocks == 1);
+
+    /* Sizes get rounded up to the alignment. */
+    byte *a = mag_tlsf_nmalloc(tlsf, 10, byte);
+    byte *b = mag_tlsf_nmalloc(tlsf, 100, byte);
+    Assert(a && b && tlsf->stats.bytes_requested == 110);
+    Assert(tlsf->stats.bytes_padding == (u64)(mag_tlsf_usable_size(a) + mag_tlsf_usable_size(b) - 110));
+
+    /* b is followed by free space, a isn't. */
+    Assert(mag_tlsf_realloc(tlsf, b, 1000, 1) == b);
+    Assert(mag_tlsf_realloc(tlsf, a, 1000, 1) != a);
+    Assert(tlsf->stats.num_realloc_in_place == 1 && tlsf->stats.num_realloc_copy == 1 && tlsf->stats.num_allocs == 3);
+
+    size const peak = tlsf->stats.peak_bytes_in_use;
+    Assert(peak >= 2000);
+    mag_tlsf_reset(tlsf);
+    Assert(tlsf->stats.bytes_in_use == 0 && tlsf->stats.peak_bytes_in_use == peak);
+
+    byte *c = mag_tlsf_nmalloc(tlsf, 10, byte);
+    mag_tlsf_free(tlsf, c);
+    Assert(tlsf->stats.bytes_in_use == 0);
+
+    mag_tlsf_destroy(tlsf);
+}
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                  All TLSF Tests
+ *-------------------------------------------------------------------------------------------------------------------------*/
+void
+magpie_tlsf_tests(void)
+{
+    test_tlsf_basic();
+    test_tlsf_coalescing();
+    test_tlsf_realloc();
+    test_tlsf_random();
+    test_tlsf_allocator();
+
+#if MAG_STATS
+    test_tlsf_stats();
+#endif
+}
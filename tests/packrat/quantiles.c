@@ -0,0 +1,143 @@
+#include "test.h"
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *                                                 Histograms and Quantiles
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+static b32
+test_quantile_close(f64 a, f64 b, f64 tol)
+{
+    return (a > b ? a - b : b - a) <= tol;
+}
+
+static void
+test_histogram(void)
+{
+#define NUM_VALUES 100003
+#define NUM_BINS 100
+    static byte buffer[ECO_KiB(64)];
+    MagAllocator arena_i = mag_allocator_static_arena_create(sizeof(buffer), buffer);
+    MagAllocator *arena = &arena_i;
+
+    static f64 const ZERO = 0.0;
+    f64 const nan = 0.0 / ZERO;
+
+    ElkRandomState state = elk_random_state_create(30);
+
+    static f64 data[NUM_VALUES];
+    static f32 data32[NUM_VALUES];
+    for(size i = 0; i < NUM_VALUES; ++i)
+    {
+        data[i] = 2.0 + 4.0 * elk_random_state_uniform_f64(&state); /* [2, 6) */
+        data32[i] = (f32)data[i];
+    }
+    data[10] = nan;
+    data[11] = 1.0;
+    data[12] = 9.0;
+    data[13] = 7.0;     /* exactly max, goes in the above bin. */
+    data[14] = 3.0;     /* exactly min, goes in bin 0.         */
+
+    /* Straight forward reference counts. */
+    u64 ref[NUM_BINS] = {0};
+    u64 ref_below = 0, ref_above = 0, ref_nan = 0;
+    for(size i = 0; i < NUM_VALUES; ++i)
+    {
+        f64 const v = data[i];
+        if(v != v) { ref_nan++; }
+        else if(v < 3.0) { ref_below++; }
+        else if(v >= 7.0) { ref_above++; }
+        else { ref[(i32)((v - 3.0) * (NUM_BINS / 4.0))]++; }
+    }
+    Assert(ref_nan == 1 && ref_above >= 2 && ref_below >= 1);
+
+    PakHistogram hist = pak_histogram_create(3.0, 7.0, NUM_BINS, arena);
+    pak_histogram_add_f64(&hist, NUM_VALUES, data);
+
+    Assert(pak_histogram_count(&hist, PAK_HISTOGRAM_NAN) == ref_nan);
+    Assert(pak_histogram_count(&hist, PAK_HISTOGRAM_BELOW) == ref_below);
+    Assert(pak_histogram_count(&hist, PAK_HISTOGRAM_ABOVE) == ref_above);
+    for(i32 b = 0; b < NUM_BINS; ++b) { Assert(pak_histogram_count(&hist, b) == ref[b]); }
+
+    /* Per thread style: pieces in separate histograms, then merged. */
+    PakHistogram h1 = pak_histogram_create(3.0, 7.0, NUM_BINS, arena);
+    PakHistogram h2 = pak_histogram_create(3.0, 7.0, NUM_BINS, arena);
+    pak_histogram_add_f64(&h1, 33333, data);
+    pak_histogram_add_f64(&h2, NUM_VALUES - 33333, data + 33333);
+    pak_histogram_merge(&h1, &h2);
+    for(i32 b = -3; b < NUM_BINS; ++b) { Assert(pak_histogram_count(&h1, b) == pak_histogram_count(&hist, b)); }
+
+    /* Half of the values are in [2, 4) and half in [4, 6), so the median is near 4.0 and the bins are 0.04 wide. */
+    Assert(test_quantile_close(pak_histogram_quantile(&hist, 0.5), 4.0, 0.04));
+    Assert(pak_histogram_quantile(&hist, 0.0) == 3.0);
+    Assert(pak_histogram_quantile(&hist, 1.0) == 7.0);
+
+    /* f32 data */
+    PakHistogram h32 = pak_histogram_create(3.0, 7.0, NUM_BINS, arena);
+    pak_histogram_add_f32(&h32, NUM_VALUES, data32);
+    u64 total = 0;
+    for(i32 b = -3; b < NUM_BINS; ++b) { total += pak_histogram_count(&h32, b); }
+    Assert(total == NUM_VALUES);
+    Assert(pak_histogram_count(&h32, PAK_HISTOGRAM_NAN) == 0);
+    Assert(test_quantile_close(pak_histogram_quantile(&h32, 0.5), 4.0, 0.04));
+#undef NUM_BINS
+#undef NUM_VALUES
+}
+
+static void
+test_quantile_sketch(void)
+{
+#define NUM_VALUES 2000000
+#define NUM_PIECES 4
+    static byte buffer[ECO_MiB(2)];
+    MagAllocator arena_i = mag_allocator_static_arena_create(sizeof(buffer), buffer);
+    MagAllocator *arena = &arena_i;
+
+    static f64 const ZERO = 0.0;
+    f64 const nan = 0.0 / ZERO;
+
+    ElkRandomState state = elk_random_state_create(31);
+
+    PakQuantileSketch sketch = pak_quantile_sketch_create(256, &state, arena);
+    PakQuantileSketch pieces[NUM_PIECES] = {0};
+    for(i32 p = 0; p < NUM_PIECES; ++p) { pieces[p] = pak_quantile_sketch_create(256, &state, arena); }
+
+    /* A shuffled sequence of 0, 1, ..., NUM_VALUES - 1 so the true quantiles are known exactly. */
+    static u32 values[NUM_VALUES];
+    for(u32 i = 0; i < NUM_VALUES; ++i) { values[i] = i; }
+    pak_shuffle(values, NUM_VALUES, sizeof(u32), &state);
+
+    for(size i = 0; i < NUM_VALUES; ++i)
+    {
+        pak_quantile_sketch_add(&sketch, values[i]);
+        pak_quantile_sketch_add(&pieces[i % NUM_PIECES], values[i]);
+    }
+    pak_quantile_sketch_add(&sketch, nan);
+
+    Assert(sketch.count == NUM_VALUES && sketch.nan_count == 1);
+    Assert(sketch.min == 0.0 && sketch.max == NUM_VALUES - 1);
+
+    for(i32 p = 1; p < NUM_PIECES; ++p) { pak_quantile_sketch_merge(&pieces[0], &pieces[p]); }
+    Assert(pieces[0].count == NUM_VALUES && pieces[0].nan_count == 0);
+    Assert(pieces[0].min == 0.0 && pieces[0].max == NUM_VALUES - 1);
+
+    f64 const qs[] = {0.001, 0.01, 0.05, 0.1, 0.25, 0.5, 0.75, 0.9, 0.95, 0.99, 0.999};
+    for(size i = 0; i < ECO_ARRAY_SIZE(qs); ++i)
+    {
+        f64 const truth = qs[i] * (NUM_VALUES - 1);
+        Assert(test_quantile_close(pak_quantile_sketch_quantile(&sketch, qs[i]), truth, 0.01 * NUM_VALUES));
+        Assert(test_quantile_close(pak_quantile_sketch_quantile(&pieces[0], qs[i]), truth, 0.01 * NUM_VALUES));
+    }
+
+    Assert(pak_quantile_sketch_quantile(&sketch, 0.0) == 0.0);
+    Assert(pak_quantile_sketch_quantile(&sketch, 1.0) == NUM_VALUES - 1);
+#undef NUM_PIECES
+#undef NUM_VALUES
+}
+
+void
+pak_quantile_tests(void)
+{
+    test_histogram();
+    test_quantile_sketch();
+}
@@ -0,0 +1,147 @@
+#include "test.h"
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *
+ *                                                  Shuffling and Sampling
+ *
+ *-------------------------------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+    i32 id;
+    f64 payload[12]; /* Make it big enough to test the chunked swap. */
+} ShuffleTestStruct;
+
+static void
+test_shuffle_is_permutation(void)
+{
+#define NUM_ITEMS 1001
+    ElkRandomState state = elk_random_state_create(13);
+
+    static ShuffleTestStruct items[NUM_ITEMS] = {0};
+    for(i32 i = 0; i < NUM_ITEMS; ++i)
+    {
+        items[i].id = i;
+        items[i].payload[11] = (f64)i;
+    }
+
+    pak_shuffle(items, NUM_ITEMS, sizeof(ShuffleTestStruct), &state);
+
+    b32 seen[NUM_ITEMS] = {0};
+    i32 num_in_place = 0;
+    for(i32 i = 0; i < NUM_ITEMS; ++i)
+    {
+        Assert(items[i].id >= 0 && items[i].id < NUM_ITEMS);
+        Assert(!seen[items[i].id]);
+        Assert(items[i].payload[11] == (f64)items[i].id);
+        seen[items[i].id] = true;
+        num_in_place += items[i].id == i;
+    }
+    Assert(num_in_place < 10);
+
+    /* Same seed, same shuffle. */
+    u64 ids[NUM_ITEMS] = {0};
+    u64 ids2[NUM_ITEMS] = {0};
+    for(i32 i = 0; i < NUM_ITEMS; ++i) { ids[i] = i; ids2[i] = i; }
+
+    ElkRandomState s1 = elk_random_state_create(99);
+    ElkRandomState s2 = elk_random_state_create(99);
+    pak_shuffle(ids, NUM_ITEMS, sizeof(u64), &s1);
+    pak_shuffle(ids2, NUM_ITEMS, sizeof(u64), &s2);
+    for(i32 i = 0; i < NUM_ITEMS; ++i) { Assert(ids[i] == ids2[i]); }
+#undef NUM_ITEMS
+}
+
+static void
+test_shuffle_is_uniform(void)
+{
+    ElkRandomState state = elk_random_state_create(21);
+
+    /* Index the 24 permutations of 4 items by the positions of the items. */
+    i64 counts[256] = {0};
+    i32 const num_trials = 240000;
+    for(i32 t = 0; t < num_trials; ++t)
+    {
+        u32 vals[4] = {0, 1, 2, 3};
+        pak_shuffle(vals, 4, sizeof(u32), &state);
+        counts[vals[0] | (vals[1] << 2) | (vals[2] << 4) | (vals[3] << 6)] += 1;
+    }
+
+    i32 num_perms = 0;
+    for(i32 i = 0; i < 256; ++i)
+    {
+        if(counts[i])
+        {
+            num_perms += 1;
+            Assert(counts[i] > 9500 && counts[i] < 10500);
+        }
+    }
+    Assert(num_perms == 24);
+
+    /* Edge cases. */
+    u32 one = 5;
+    pak_shuffle(&one, 1, sizeof(u32), &state);
+    Assert(one == 5);
+    pak_shuffle(NULL, 0, sizeof(u32), &state);
+}
+
+static void
+test_reservoir_ledger(void)
+{
+#define CAPACITY 100
+#define STREAM_LEN 10000
+    ElkRandomState state = elk_random_state_create(5);
+
+    i64 first_taken = 0;
+    i64 last_taken = 0;
+    i32 const num_trials = 1000;
+
+    for(i32 t = 0; t < num_trials; ++t)
+    {
+        i32 sample[CAPACITY] = {0};
+        PakReservoirLedger res = pak_reservoir_ledger_create(CAPACITY, &state);
+
+        for(i32 i = 0; i < STREAM_LEN; ++i)
+        {
+            size idx = pak_reservoir_ledger_offer_index(&res);
+            if(idx != PAK_RESERVOIR_SKIP)
+            {
+                Assert(idx >= 0 && idx < CAPACITY);
+                sample[idx] = i;
+            }
+        }
+
+        Assert(pak_len(&res) == CAPACITY);
+
+        b32 seen[STREAM_LEN] = {0};
+        for(i32 i = 0; i < CAPACITY; ++i)
+        {
+            Assert(!seen[sample[i]]);
+            seen[sample[i]] = true;
+        }
+
+        first_taken += seen[0];
+        last_taken += seen[STREAM_LEN - 1];
+    }
+
+    /* Each item should be in the sample about 1% of the time. */
+    Assert(first_taken > 3 && first_taken < 25);
+    Assert(last_taken > 3 && last_taken < 25);
+
+    /* A short stream is taken in full. */
+    PakReservoirLedger res = pak_reservoir_ledger_create(CAPACITY, &state);
+    for(i32 i = 0; i < 10; ++i) { Assert(pak_reservoir_ledger_offer_index(&res) == i); }
+    Assert(pak_len(&res) == 10);
+#undef CAPACITY
+#undef STREAM_LEN
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------
+ *                                                       All tests
+ *-------------------------------------------------------------------------------------------------------------------------*/
+void
+pak_shuffle_tests(void)
+{
+    test_shuffle_is_permutation();
+    test_shuffle_is_uniform();
+    test_reservoir_ledger();
+}
@@ -23,6 +23,7 @@ main(int argc, char *argv[])
     elk_parse_tests();
     elk_csv_tests();
     elk_random_tests();
+    elk_math_tests();
     COY_END_PROFILE(ap);
     fprintf(stderr, ".complete.\n");
 
@@ -32,6 +33,9 @@ main(int argc, char *argv[])
     magpie_sys_memory_tests();
     magpie_arena_tests();
     magpie_pool_tests();
+    magpie_tlsf_tests();
+    magpie_slab_tests();
+    magpie_str_builder_tests();
     COY_END_PROFILE(ap);
     fprintf(stderr, ".complete.\n");
 
@@ -75,6 +79,8 @@ main(int argc, char *argv[])
     pak_hash_table_tests();
     pak_hash_set_tests();
     pak_sort_tests();
+    pak_shuffle_tests();
+    pak_quantile_tests();
     COY_END_PROFILE(ap);
     fprintf(stderr, ".complete.\n");
 
@@ -115,10 +121,14 @@ main(int argc, char *argv[])
 #include "elk/time.c"
 #include "elk/date.c"
 #include "elk/random.c"
+#include "elk/math.c"
 
 #include "magpie/sys_memory.c"
 #include "magpie/arena.c"
 #include "magpie/pool.c"
+#include "magpie/tlsf.c"
+#include "magpie/slab.c"
+#include "magpie/str_builder.c"
 
 #include "coyote/fileio.c"
 #include "coyote/file_name_iterator.c"
@@ -131,5 +141,7 @@ main(int argc, char *argv[])
 #include "packrat/hash_set.c"
 #include "packrat/hash_tables.c"
 #include "packrat/sort.c"
+#include "packrat/shuffle.c"
+#include "packrat/quantiles.c"
 #include "packrat/string_interner.c"
 
@@ -22,10 +22,14 @@ void elk_str_tests(void);
 void elk_parse_tests(void);
 void elk_csv_tests(void);
 void elk_random_tests(void);
+void elk_math_tests(void);
 
 void magpie_sys_memory_tests(void);
 void magpie_arena_tests(void);
 void magpie_pool_tests(void);
+void magpie_tlsf_tests(void);
+void magpie_slab_tests(void);
+void magpie_str_builder_tests(void);
 
 void coyote_time_tests(void);
 void coyote_file_tests(void);
@@ -41,5 +45,7 @@ void pak_string_interner_tests(void);
 void pak_hash_table_tests(void);
 void pak_hash_set_tests(void);
 void pak_sort_tests(void);
+void pak_shuffle_tests(void);
+void pak_quantile_tests(void);
 
 #endif